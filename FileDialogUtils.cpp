@@ -1,17 +1,17 @@
 //=============================================================================
 //
-// t@C_CAO [FileDialogUtils.cpp]
+// ファイルダイアログ処理 [FileDialogUtils.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "FileDialogUtils.h"
 
 //=============================================================================
-// t@Cۑ
+// ファイルを保存
 //=============================================================================
 std::string OpenWindowsSaveFileDialog(void)
 {
@@ -19,8 +19,8 @@ std::string OpenWindowsSaveFileDialog(void)
 
     OPENFILENAMEA ofn = { 0 };
     ofn.lStructSize   = sizeof(OPENFILENAMEA);
-    ofn.hwndOwner     = NULL; // EBhEnh
-    ofn.lpstrFilter   = "JSON Files\0*.json\0All Files\0*.*\0"; // t@C̎ނ̖O
+    ofn.hwndOwner     = NULL; // ウィンドウハンドル
+    ofn.lpstrFilter   = "JSON Files\0*.json\0All Files\0*.*\0"; // ファイルの種類の名前
     ofn.lpstrFile     = szFile;
     ofn.nMaxFile      = MAX_PATH;
     ofn.Flags         = OFN_FILEMUSTEXIST | OFN_NOCHANGEDIR | OFN_EXPLORER;
@@ -33,7 +33,7 @@ std::string OpenWindowsSaveFileDialog(void)
     return std::string();
 }
 //=============================================================================
-// t@CJ
+// ファイルを開く
 //=============================================================================
 std::string OpenWindowsOpenFileDialog(void)
 {
@@ -42,7 +42,7 @@ std::string OpenWindowsOpenFileDialog(void)
     OPENFILENAMEA ofn = { 0 };
     ofn.lStructSize   = sizeof(OPENFILENAMEA);
     ofn.hwndOwner     = NULL;
-    ofn.lpstrFilter   = "JSON Files\0*.json\0All Files\0*.*\0"; // t@C̎ނ̖O
+    ofn.lpstrFilter   = "JSON Files\0*.json\0All Files\0*.*\0"; // ファイルの種類の名前
     ofn.lpstrFile     = szFile;
     ofn.nMaxFile      = MAX_PATH;
     ofn.Flags         = OFN_FILEMUSTEXIST | OFN_NOCHANGEDIR | OFN_EXPLORER;
@@ -1,145 +1,66 @@
 //=============================================================================
 //
-// ʉ|bvAbvGtFNg [SEpopupeffect.cpp]
+// 効果音ポップアップエフェクト処理 [SEpopupeffect.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "SEpopupeffect.h"
+#include "particlesystem.h"
+#include "random.h"
 
 
 //=============================================================================
-// RXgN^
+// 生成処理
 //=============================================================================
-CSEPopupEffect::CSEPopupEffect()
-{
-	// l̃NA
-	memset(m_szPath, 0, sizeof(m_szPath));	// t@CpX
-	m_nLife = 0;							// 
-}
-//=============================================================================
-// fXgN^
-//=============================================================================
-CSEPopupEffect::~CSEPopupEffect()
-{
-	// Ȃ
-}
-//=============================================================================
-// 
-//=============================================================================
-CSEPopupEffect* CSEPopupEffect::Create(const char* path, D3DXVECTOR3 pos, D3DXCOLOR col, int nLife)
-{
-	CSEPopupEffect* pSEPopupEffect = new CSEPopupEffect;
-
-	// nullptr
-	if (pSEPopupEffect == nullptr)
-	{
-		return nullptr;
-	}
-
-	pSEPopupEffect->SetPath(path);
-	pSEPopupEffect->SetPos(pos);
-	pSEPopupEffect->SetCol(col);
-	pSEPopupEffect->SetLife(nLife);
-
-	// s
-	if (FAILED(pSEPopupEffect->Init()))
-	{
-		return nullptr;
-	}
-
-	return pSEPopupEffect;
-}
-//=============================================================================
-// 
-//=============================================================================
-HRESULT CSEPopupEffect::Init(void)
-{
-	// r{[hɃt@CpXݒ肷
-	CObjectBillboard::SetPath(m_szPath);
-
-	// GtFNg̏
-	CEffect::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// XV
-//=============================================================================
-void CSEPopupEffect::Update(void)
-{
-	// p[^̐ݒ
-	SetupParameter();
-
-	// s
-	m_nLife--;
-
-	if (m_nLife <= 0)
-	{
-		// I
-		Uninit();
-		return;
-	}
-
-	// GtFNg̍XV
-	CEffect::Update();
-}
-//=============================================================================
-// p[^ݒ菈
-//=============================================================================
-void CSEPopupEffect::SetupParameter(void)
+bool CSEPopupEffect::Create(const char* path, D3DXVECTOR3 pos, D3DXCOLOR col, int nLife)
 {
 	EffectDesc desc;
 
-	// eNX`̎w
-	desc.path = m_szPath;
-
-	// ʒu
-	desc.pos = GetPos();
+	// テクスチャの指定
+	desc.path = (path != nullptr) ? path : " ";
 
-	// a߂ă_ʒuɃX|[
-	float radiusMax = 80.0f;
+	CRandom& random = CRandom::Get(CRandom::STREAM_EFFECT);
 
-	// 0.0`1.0 ̗
-	float r = (rand() % 10000) / 10000.0f;
+	// 0.0～1.0 の乱数
+	float r = random.Float();
 
-	// ċψɕz
-	float radius = sqrtf(r) * radiusMax;
+	// 平方根を取って均一に分布させる
+	float radius = sqrtf(r) * SPAWN_RADIUS;
 
-	float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-	float speed = (rand() % 80) / 60.0f + 0.2f;
+	float angle = random.Angle();
+	float speed = random.Range(MIN_SPEED, MAX_SPEED);
 
-	// ʒu
-	D3DXVECTOR3 offPos = GetPos();
-	desc.pos.x = offPos.x + cosf(angle) * radius;
-	desc.pos.z = offPos.z + sinf(angle) * radius;
-	desc.pos.y = offPos.y;
+	// 位置
+	desc.pos.x = pos.x + cosf(angle) * radius;
+	desc.pos.z = pos.z + sinf(angle) * radius;
+	desc.pos.y = pos.y;
 
 	desc.move.x = cosf(angle) * speed;
 	desc.move.z = sinf(angle) * speed;
-	desc.move.y = (rand() % 300) / 100.0f + 0.05f; // 
+	desc.move.y = random.Range(MIN_RISE, MAX_RISE); // 少しだけ上方向
 
-	// F̐ݒ
-	desc.col = GetCol();
+	// 色の設定
+	desc.col = col;
 
-	// a̐ݒ
-	desc.fRadius = 35.0f + (rand() % 30);
+	// 半径の設定
+	desc.fRadius = random.Range(MIN_SIZE, MAX_SIZE);
 
-	// ̐ݒ
-	desc.nLife = GetLife();
+	// 寿命の設定
+	desc.nLife = nLife;
 
-	// d͂̐ݒ
-	desc.fGravity = -0.001f;
+	// 重力の設定
+	desc.fGravity = GRAVITY;
 
-	// ǎʂ̐ݒ
-	desc.fDecRadius = 0.8f;
+	// 半径の減衰量の設定
+	desc.fDecRadius = DEC_RADIUS;
 
-	// At@uh̐ݒtO
+	// アルファブレンドの設定フラグ
 	desc.bBlend = false;
 
-	// GtFNg̐ݒ
-	CEffect::Create(desc);
+	// パーティクル管理の配列に追加(テクスチャごとの配列は最初の1回だけ作られる)
+	return CParticleSystem::Emit(desc, CEffectBudget::CATEGORY_POPUP);
 }
@@ -1,49 +1,30 @@
 //=============================================================================
 //
-// ʉ|bvAbvGtFNg [SEpopupeffect.h]
+// 効果音ポップアップエフェクト処理 [SEpopupeffect.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _SE_POPUPEFFECT_H_// ̃}N`ĂȂ
-#define _SE_POPUPEFFECT_H_// 2dCN[hh~̃}N`
+#ifndef _SE_POPUPEFFECT_H_// このマクロ定義がされていなかったら
+#define _SE_POPUPEFFECT_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// 効果音ポップアップエフェクトクラス(オブジェクトは作らず、パーティクル管理の配列に1枚出す)
 //*****************************************************************************
-#include "effect.h"
-
-
-//*****************************************************************************
-// ʉ|bvAbvGtFNgNX
-//*****************************************************************************
-class CSEPopupEffect : public CEffect
+class CSEPopupEffect
 {
 public:
-	CSEPopupEffect();
-	~CSEPopupEffect();
-
-	static CSEPopupEffect* Create(const char* path, D3DXVECTOR3 pos, D3DXCOLOR col, int nLife);
-	HRESULT Init(void);
-	void Update(void);
-	void SetupParameter(void);
-	void SetLife(int nLife) { m_nLife = nLife; }
-	void SetPath(const char* path)
-	{ 
-		// nullptr
-		if (path == nullptr)
-		{
-			path = " ";
-		}
-
-		strcpy_s(m_szPath, MAX_PATH, path); 
-	}
-
-	int GetLife(void) { return m_nLife; }
+	static bool Create(const char* path, D3DXVECTOR3 pos, D3DXCOLOR col, int nLife);
 
 private:
-	char	m_szPath[MAX_PATH];	// t@CpX
-	int		m_nLife;			// 
-
+	static constexpr float SPAWN_RADIUS = 80.0f;	// 出す位置の半径
+	static constexpr float MIN_SPEED	= 0.2f;		// 広がる速さの最小値
+	static constexpr float MAX_SPEED	= 1.5f;		// 広がる速さの最大値
+	static constexpr float MIN_RISE		= 0.05f;	// 上がる速さの最小値
+	static constexpr float MAX_RISE		= 3.05f;	// 上がる速さの最大値
+	static constexpr float MIN_SIZE		= 35.0f;	// 半径の最小値
+	static constexpr float MAX_SIZE		= 65.0f;	// 半径の最大値
+	static constexpr float GRAVITY		= -0.001f;	// 重力
+	static constexpr float DEC_RADIUS	= 0.8f;		// 半径の減衰量
 };
 
 #endif
@@ -0,0 +1,1174 @@
+//=============================================================================
+//
+// アセット読み込み処理 [assetloader.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "assetloader.h"
+#include "meshcooker.h"
+#include "texturecooker.h"
+#include "algorithm"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::unordered_map<std::string, CAssetLoader::Entry> CAssetLoader::m_entries;
+std::deque<std::string> CAssetLoader::m_queue;
+std::vector<std::thread> CAssetLoader::m_workers;
+std::mutex CAssetLoader::m_mutex;
+std::condition_variable CAssetLoader::m_cvWork;
+std::condition_variable CAssetLoader::m_cvDone;
+bool CAssetLoader::m_bQuit = false;
+CAssetLoader::Report CAssetLoader::m_report = {};
+std::unordered_map<std::string, std::pair<D3DXVECTOR3, D3DXVECTOR3>> CAssetLoader::m_bounds;
+LPD3DXMESH CAssetLoader::m_pPlaceholder = nullptr;
+double CAssetLoader::m_fUploadMs = 0.0;
+int CAssetLoader::m_nNumUpload = 0;
+
+//=============================================================================
+// 初期化処理(ワーカースレッドの起動)
+//=============================================================================
+void CAssetLoader::Init(int nNumWorker)
+{
+	// 起動済みなら何もしない
+	if (IsRunning())
+	{
+		return;
+	}
+
+	m_bQuit = false;
+
+	for (int nCnt = 0; nCnt < nNumWorker; nCnt++)
+	{
+		m_workers.push_back(std::thread(WorkerMain));
+	}
+}
+//=============================================================================
+// 終了処理(ワーカースレッドを止めて読み込んだ中身を破棄する)
+//=============================================================================
+void CAssetLoader::Uninit(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bQuit = true;
+		m_queue.clear();
+	}
+
+	m_cvWork.notify_all();
+
+	for (auto& worker : m_workers)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+
+	m_workers.clear();
+	m_entries.clear();
+	m_bounds.clear();
+
+	// 仮表示の箱の破棄
+	if (m_pPlaceholder != nullptr)
+	{
+		m_pPlaceholder->Release();
+		m_pPlaceholder = nullptr;
+	}
+}
+//=============================================================================
+// 先読みの依頼処理(読み込み済み・依頼済みなら何もしない)
+//=============================================================================
+void CAssetLoader::Request(const char* pFilename)
+{
+	if (pFilename == nullptr || pFilename[0] == '\0' || !IsRunning())
+	{// ワーカーがいなければ使う時に読み込む
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_entries.find(pFilename) != m_entries.end())
+		{
+			return;
+		}
+
+		Entry& entry = m_entries[pFilename];
+		entry.state = STATE_QUEUED;
+		entry.bImage = false;
+		entry.fReadMs = 0.0;
+		ZeroMemory(&entry.imageInfo, sizeof(entry.imageInfo));
+
+		m_queue.push_back(pFilename);
+		m_report.nNumRequest++;
+	}
+
+	m_cvWork.notify_one();
+}
+//=============================================================================
+// 読み込みが終わったかの判定処理(失敗した場合も終わった扱い)
+//=============================================================================
+bool CAssetLoader::IsReady(const char* pFilename)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(pFilename);
+
+	if (it == m_entries.end())
+	{
+		return false;
+	}
+
+	return it->second.state == STATE_READY || it->second.state == STATE_FAILED;
+}
+//=============================================================================
+// ファイルの中身の取得処理(読み込み前ならここで待つか読み込む。失敗時はnullptr)
+//=============================================================================
+CAssetLoader::FileData CAssetLoader::GetFile(const char* pFilename)
+{
+	if (pFilename == nullptr || pFilename[0] == '\0')
+	{
+		return nullptr;
+	}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(pFilename);
+
+	if (it != m_entries.end() && it->second.state == STATE_QUEUED)
+	{// まだ順番待ちなら列から外してこのスレッドで読み込む
+		m_queue.erase(std::remove(m_queue.begin(), m_queue.end(), std::string(pFilename)), m_queue.end());
+		m_entries.erase(it);
+		it = m_entries.end();
+	}
+
+	if (it == m_entries.end())
+	{// 先読みされていないのでここで読み込む
+		lock.unlock();
+
+		// メインスレッドではWICを使わず、展開はリソースを作る時にD3DXで行う
+		Entry entry;
+		double fStart = GetTimeMs();
+		LoadEntry(pFilename, &entry, nullptr);
+		double fMs = GetTimeMs() - fStart;
+
+		lock.lock();
+
+		m_report.nNumSync++;
+		m_report.fSyncMs += fMs;
+
+		if (entry.pData)
+		{
+			m_report.nBytes += entry.pData->size();
+		}
+
+		Entry& stored = m_entries[pFilename];
+		stored = entry;
+
+		return stored.pData;
+	}
+
+	if (it->second.state == STATE_LOADING)
+	{// ワーカーが読み込み中なら終わるまで待つ
+		double fStart = GetTimeMs();
+
+		std::string path = pFilename;
+		m_cvDone.wait(lock, [&path]()
+		{
+			auto found = m_entries.find(path);
+			return found == m_entries.end() || found->second.state != STATE_LOADING;
+		});
+
+		m_report.nNumWait++;
+		m_report.fWaitMs += GetTimeMs() - fStart;
+
+		it = m_entries.find(pFilename);
+
+		if (it == m_entries.end())
+		{
+			return nullptr;
+		}
+	}
+	else
+	{
+		m_report.nNumHit++;
+	}
+
+	return it->second.pData;
+}
+//=============================================================================
+// 展開した画像の取得処理(読み込みが終わっていない・展開できない形式ならnullptr。待たない)
+//=============================================================================
+CAssetLoader::ImageData CAssetLoader::GetImage(const char* pFilename)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(pFilename);
+
+	if (it == m_entries.end() || it->second.state != STATE_READY)
+	{
+		return nullptr;
+	}
+
+	return it->second.pImage;
+}
+//=============================================================================
+// 解析したメッシュの取得処理(読み込みが終わっていない・.xmbでなければnullptr。待たない)
+//=============================================================================
+CAssetLoader::MeshData CAssetLoader::GetMeshData(const char* pFilename)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(pFilename);
+
+	if (it == m_entries.end() || it->second.state != STATE_READY)
+	{
+		return nullptr;
+	}
+
+	return it->second.pMesh;
+}
+//=============================================================================
+// 画像の情報の取得処理(ワーカーでヘッダーを解析できていた場合だけ)
+//=============================================================================
+bool CAssetLoader::GetImageInfo(const char* pFilename, D3DXIMAGE_INFO* pInfo)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(pFilename);
+
+	if (it == m_entries.end() || it->second.state != STATE_READY || !it->second.bImage)
+	{
+		return false;
+	}
+
+	*pInfo = it->second.imageInfo;
+
+	return true;
+}
+//=============================================================================
+// 読み込んだ中身の破棄処理(リソースを作り終えたファイル用)
+//=============================================================================
+void CAssetLoader::Discard(const char* pFilename)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(pFilename);
+
+	if (it != m_entries.end() && (it->second.state == STATE_READY || it->second.state == STATE_FAILED))
+	{
+		m_entries.erase(it);
+	}
+}
+//=============================================================================
+// シーンで読み込んだ中身をまとめて破棄する処理(読み込み中の物は残す)
+//=============================================================================
+void CAssetLoader::ReleaseScene(void)
+{
+	// 変換し直した.xmbを次のシーンで拾えるように調べ直す
+	CMeshCooker::ClearCache();
+	m_bounds.clear();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	for (auto it = m_entries.begin(); it != m_entries.end();)
+	{
+		if (it->second.state == STATE_READY || it->second.state == STATE_FAILED)
+		{
+			it = m_entries.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+//=============================================================================
+// Xファイルの読み込み処理(同じファイルを使うインスタンスはディスクを読み直さない)
+//=============================================================================
+HRESULT CAssetLoader::LoadMesh(const char* pFilename, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+	LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax)
+{
+	// 変換済みの.xmbがあればそちらを読む
+	const std::string& path = CMeshCooker::ResolvePath(pFilename);
+	FileData pData = GetFile(path.c_str());
+
+	// メッシュの作成はデバイスを使うのでメインスレッドで行う(.xmbの解析は読み込み時に済んでいる)
+	double fStart = GetTimeMs();
+
+	if (pData && path != pFilename)
+	{
+		MeshData pMesh = GetMeshData(path.c_str());
+		HRESULT hr = pMesh ? CMeshCooker::Create(*pMesh, pDevice, options, ppMat, pNumMat, ppMesh) : E_FAIL;
+
+		EndUpload(GetTimeMs() - fStart);
+
+		if (SUCCEEDED(hr))
+		{
+			if (pMin != nullptr && pMax != nullptr)
+			{
+				*pMin = pMesh->vMin;
+				*pMax = pMesh->vMax;
+			}
+
+			return hr;
+		}
+
+		// 形式が古いなどで読めなければ元の.xを読む
+		pData = GetFile(pFilename);
+		fStart = GetTimeMs();
+	}
+
+	if (!pData)
+	{
+		return E_FAIL;
+	}
+
+	HRESULT hr = D3DXLoadMeshFromXInMemory(pData->data(), (DWORD)pData->size(),
+		options, pDevice, NULL, ppMat, NULL, pNumMat, ppMesh);
+
+	// 境界は頂点を走査して求める
+	if (SUCCEEDED(hr) && pMin != nullptr && pMax != nullptr)
+	{
+		LPD3DXMESH pMesh = *ppMesh;
+		DWORD sizeFVF = D3DXGetFVFVertexSize(pMesh->GetFVF());
+		BYTE* pVtxBuff = nullptr;
+
+		*pMin = D3DXVECTOR3(FLT_MAX, FLT_MAX, FLT_MAX);
+		*pMax = D3DXVECTOR3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+		if (SUCCEEDED(pMesh->LockVertexBuffer(D3DLOCK_READONLY, (void**)&pVtxBuff)))
+		{
+			for (DWORD nCnt = 0; nCnt < pMesh->GetNumVertices(); nCnt++)
+			{
+				const D3DXVECTOR3* pPos = (const D3DXVECTOR3*)(pVtxBuff + sizeFVF * nCnt);
+				D3DXVec3Minimize(pMin, pMin, pPos);
+				D3DXVec3Maximize(pMax, pMax, pPos);
+			}
+
+			pMesh->UnlockVertexBuffer();
+		}
+	}
+
+	EndUpload(GetTimeMs() - fStart);
+
+	return hr;
+}
+//=============================================================================
+// 先読みしたメッシュの作成処理(届いていない・今回のフレームの上限を超えた時はE_PENDINGを返す。
+// 境界はGetMeshBoundsで取る。変換済みの.xmbが無い物は元の.xをこの場で読む)
+//=============================================================================
+HRESULT CAssetLoader::CreateMesh(const char* pFilename, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+	LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax)
+{
+	const std::string& path = CMeshCooker::ResolvePath(pFilename);
+
+	// .xの解析はデバイスが要るのでワーカーでは行えない
+	if (!IsRunning() || !CMeshCooker::IsCookedPath(path))
+	{
+		return LoadMesh(pFilename, pDevice, options, ppMat, pNumMat, ppMesh, pMin, pMax);
+	}
+
+	Request(path.c_str());
+
+	MeshData pMesh = GetMeshData(path.c_str());
+
+	if (!pMesh && IsReady(path.c_str()))
+	{// 読めなかった・形式が古い時は元の.xを読む
+		return LoadMesh(pFilename, pDevice, options, ppMat, pNumMat, ppMesh, pMin, pMax);
+	}
+
+	if (!pMesh || !CanUpload())
+	{// 毎フレーム呼ばれるのでここではファイルを読まない
+		return E_PENDING;
+	}
+
+	double fStart = GetTimeMs();
+
+	HRESULT hr = CMeshCooker::Create(*pMesh, pDevice, options, ppMat, pNumMat, ppMesh);
+
+	if (SUCCEEDED(hr) && pMin != nullptr && pMax != nullptr)
+	{
+		*pMin = pMesh->vMin;
+		*pMax = pMesh->vMax;
+	}
+
+	EndUpload(GetTimeMs() - fStart);
+
+	return hr;
+}
+//=============================================================================
+// 読み込み中のメッシュの境界の取得処理(仮の箱の大きさ。同じパスは2回目からファイルを読まない)
+//=============================================================================
+void CAssetLoader::GetMeshBounds(const char* pFilename, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax)
+{
+	const std::string& path = CMeshCooker::ResolvePath(pFilename);
+
+	auto it = m_bounds.find(path);
+
+	if (it == m_bounds.end())
+	{
+		D3DXVECTOR3 vMin(-0.5f, -0.5f, -0.5f);
+		D3DXVECTOR3 vMax(0.5f, 0.5f, 0.5f);
+
+		// 解析済みならその値、まだならヘッダーだけ読む
+		MeshData pMesh = GetMeshData(path.c_str());
+
+		if (pMesh)
+		{
+			vMin = pMesh->vMin;
+			vMax = pMesh->vMax;
+		}
+		else if (!CMeshCooker::ReadBounds(path.c_str(), &vMin, &vMax))
+		{
+			vMin = D3DXVECTOR3(-0.5f, -0.5f, -0.5f);
+			vMax = D3DXVECTOR3(0.5f, 0.5f, 0.5f);
+		}
+
+		it = m_bounds.emplace(path, std::make_pair(vMin, vMax)).first;
+	}
+
+	*pMin = it->second.first;
+	*pMax = it->second.second;
+}
+//=============================================================================
+// 仮表示の箱の取得処理(1x1x1の箱を全員で使い回す)
+//=============================================================================
+LPD3DXMESH CAssetLoader::GetPlaceholderMesh(LPDIRECT3DDEVICE9 pDevice)
+{
+	if (m_pPlaceholder == nullptr)
+	{
+		D3DXCreateBox(pDevice, 1.0f, 1.0f, 1.0f, &m_pPlaceholder, nullptr);
+	}
+
+	return m_pPlaceholder;
+}
+//=============================================================================
+// フレームの始めの処理(リソース作成の時間をリセットする)
+//=============================================================================
+void CAssetLoader::BeginFrame(void)
+{
+	m_fUploadMs = 0.0;
+	m_nNumUpload = 0;
+}
+//=============================================================================
+// リソースを作って良いかの判定処理(最低1つは作る)
+//=============================================================================
+bool CAssetLoader::CanUpload(void)
+{
+	return m_nNumUpload == 0 || m_fUploadMs < UPLOAD_BUDGET_MS;
+}
+//=============================================================================
+// リソースを作った後の処理(今回のフレームの時間に加える)
+//=============================================================================
+void CAssetLoader::EndUpload(double fMs)
+{
+	m_fUploadMs += fMs;
+	m_nNumUpload++;
+
+	AddCreateTime(fMs);
+}
+//=============================================================================
+// 読み込み待ちが無いかの判定処理
+//=============================================================================
+bool CAssetLoader::IsIdle(void)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (!m_queue.empty())
+	{
+		return false;
+	}
+
+	for (const auto& pair : m_entries)
+	{
+		if (pair.second.state == STATE_LOADING)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+//=============================================================================
+// 集計のリセット処理
+//=============================================================================
+void CAssetLoader::ResetReport(void)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_report = {};
+}
+//=============================================================================
+// リソース作成時間の加算処理
+//=============================================================================
+void CAssetLoader::AddCreateTime(double fMs)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_report.fCreateMs += fMs;
+	m_report.nNumCreate++;
+}
+//=============================================================================
+// 読み込み時間の書き出し処理(1シーン1行で追記する)
+//=============================================================================
+bool CAssetLoader::WriteReport(const char* filename, const char* pLabel, double fInitMs)
+{
+	Report report;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		report = m_report;
+	}
+
+	// 初回だけ見出しを書く
+	FILE* pCheck = fopen(filename, "r");
+	bool bHeader = (pCheck == nullptr);
+
+	if (pCheck != nullptr)
+	{
+		fclose(pCheck);
+	}
+
+	FILE* pFile = fopen(filename, "a");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	if (bHeader)
+	{
+		fprintf(pFile, "scene,init_ms,request,hit,wait,sync,create,read_ms,wait_ms,sync_ms,create_ms,bytes,decode\n");
+	}
+
+	fprintf(pFile, "%s,%.2f,%d,%d,%d,%d,%d,%.2f,%.2f,%.2f,%.2f,%llu,%d\n",
+		pLabel, fInitMs,
+		report.nNumRequest, report.nNumHit, report.nNumWait, report.nNumSync, report.nNumCreate,
+		report.fReadMs, report.fWaitMs, report.fSyncMs, report.fCreateMs,
+		(unsigned long long)report.nBytes, report.nNumDecode);
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return true;
+}
+//=============================================================================
+// 読み込み処理の確認(ウィンドウもデバイスも作らずに、同期読み込みと結果を比べる)
+//=============================================================================
+bool CAssetLoader::RunSelfTest(const char* filename)
+{
+	// 対象のファイルを集める
+	const char* apDir[] = { "data/TEXTURE/", "data/MODELS/", CTextureCooker::COOKED_DIR };
+	std::vector<std::string> files;
+
+	for (const char* pDir : apDir)
+	{
+		WIN32_FIND_DATAA findData;
+		HANDLE hFind = FindFirstFileA((std::string(pDir) + "*").c_str(), &findData);
+
+		if (hFind == INVALID_HANDLE_VALUE)
+		{
+			continue;
+		}
+
+		do
+		{
+			if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+			{
+				files.push_back(std::string(pDir) + findData.cFileName);
+			}
+		} while (FindNextFileA(hFind, &findData));
+
+		FindClose(hFind);
+	}
+
+	// 同期で読み込む(比較の基準)
+	std::vector<std::vector<BYTE>> expected(files.size());
+	std::vector<bool> abImage(files.size(), false);
+	std::vector<D3DXIMAGE_INFO> aInfo(files.size());
+
+	double fStart = GetTimeMs();
+
+	for (size_t nCnt = 0; nCnt < files.size(); nCnt++)
+	{
+		ReadFileData(files[nCnt].c_str(), &expected[nCnt]);
+
+		if (IsImageFile(files[nCnt]) && !expected[nCnt].empty())
+		{
+			abImage[nCnt] = SUCCEEDED(D3DXGetImageInfoFromFileInMemory(
+				expected[nCnt].data(), (UINT)expected[nCnt].size(), &aInfo[nCnt]));
+		}
+	}
+
+	double fSyncMs = GetTimeMs() - fStart;
+
+	// ワーカーで読み込む
+	bool bStarted = !IsRunning();
+	Init();
+	ResetReport();
+
+	fStart = GetTimeMs();
+
+	for (const auto& file : files)
+	{
+		Request(file.c_str());
+	}
+
+	int nNumMismatch = 0;
+	int nNumImage = 0;
+	int nNumMesh = 0;
+
+	for (size_t nCnt = 0; nCnt < files.size(); nCnt++)
+	{
+		FileData pData = GetFile(files[nCnt].c_str());
+
+		if (!pData || *pData != expected[nCnt])
+		{
+			nNumMismatch++;
+			continue;
+		}
+
+		D3DXIMAGE_INFO info;
+		bool bImage = GetImageInfo(files[nCnt].c_str(), &info);
+
+		if (bImage != abImage[nCnt] ||
+			(bImage && (info.Width != aInfo[nCnt].Width || info.Height != aInfo[nCnt].Height || info.Format != aInfo[nCnt].Format)))
+		{
+			nNumMismatch++;
+			continue;
+		}
+
+		// ワーカーで展開した画像はヘッダーと同じ大きさで、全ての段が埋まっていること
+		ImageData pImage = GetImage(files[nCnt].c_str());
+
+		if (pImage)
+		{
+			nNumImage++;
+
+			const ImageLevel& top = pImage->levels[0];
+			bool bValid = (top.nWidth == aInfo[nCnt].Width && top.nHeight == aInfo[nCnt].Height);
+
+			for (const auto& level : pImage->levels)
+			{
+				bValid = bValid && (level.data.size() == (size_t)level.nPitch * level.nRows);
+			}
+
+			if (!bValid)
+			{
+				nNumMismatch++;
+			}
+		}
+
+		// 解析したメッシュは同期で解析した物と同じであること
+		MeshData pMesh = GetMeshData(files[nCnt].c_str());
+
+		if (pMesh)
+		{
+			nNumMesh++;
+
+			CMeshCooker::MeshData expectedMesh;
+
+			if (!CMeshCooker::Parse(expected[nCnt].data(), expected[nCnt].size(), &expectedMesh) ||
+				expectedMesh.vertices != pMesh->vertices || expectedMesh.indices != pMesh->indices ||
+				expectedMesh.attributes != pMesh->attributes || expectedMesh.textures != pMesh->textures)
+			{
+				nNumMismatch++;
+			}
+		}
+	}
+
+	double fAsyncMs = GetTimeMs() - fStart;
+
+	Report report;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		report = m_report;
+	}
+
+	ReleaseScene();
+
+	if (bStarted)
+	{
+		Uninit();
+	}
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "files            : %d\n", (int)files.size());
+	fprintf(pFile, "workers          : %d\n", NUM_WORKER);
+	fprintf(pFile, "sync (ms)        : %.2f\n", fSyncMs);
+	fprintf(pFile, "async (ms)       : %.2f\n", fAsyncMs);
+	fprintf(pFile, "hit / wait / sync: %d / %d / %d\n", report.nNumHit, report.nNumWait, report.nNumSync);
+	fprintf(pFile, "bytes            : %llu\n", (unsigned long long)report.nBytes);
+	fprintf(pFile, "decoded image    : %d\n", nNumImage);
+	fprintf(pFile, "decoded mesh     : %d\n", nNumMesh);
+	fprintf(pFile, "mismatch         : %d\n", nNumMismatch);
+	fprintf(pFile, "result match     : %s\n", (nNumMismatch == 0) ? "yes" : "no");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return nNumMismatch == 0;
+}
+//=============================================================================
+// 現在時刻の取得処理(ミリ秒)
+//=============================================================================
+double CAssetLoader::GetTimeMs(void)
+{
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return (double)now.QuadPart * 1000.0 / freq.QuadPart;
+}
+//=============================================================================
+// ワーカースレッドの処理
+//=============================================================================
+void CAssetLoader::WorkerMain(void)
+{
+	// 画像の展開用(スレッドごとに作る)
+	IWICImagingFactory* pFactory = nullptr;
+	HRESULT hrCom = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+	if (FAILED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&pFactory))))
+	{// 展開できない時はリソースを作る時にD3DXで展開する
+		pFactory = nullptr;
+	}
+
+	while (true)
+	{
+		std::string path;
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_cvWork.wait(lock, []() { return m_bQuit || !m_queue.empty(); });
+
+			if (m_bQuit)
+			{
+				break;
+			}
+
+			path = m_queue.front();
+			m_queue.pop_front();
+
+			auto it = m_entries.find(path);
+
+			if (it == m_entries.end() || it->second.state != STATE_QUEUED)
+			{
+				continue;
+			}
+
+			it->second.state = STATE_LOADING;
+		}
+
+		// 読み込みと展開・解析はロックの外で行う
+		Entry entry;
+		LoadEntry(path, &entry, pFactory);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			auto it = m_entries.find(path);
+
+			if (it != m_entries.end())
+			{
+				it->second = entry;
+			}
+
+			m_report.fReadMs += entry.fReadMs;
+
+			if (entry.pData)
+			{
+				m_report.nBytes += entry.pData->size();
+			}
+
+			if (entry.pImage || entry.pMesh)
+			{
+				m_report.nNumDecode++;
+			}
+		}
+
+		m_cvDone.notify_all();
+	}
+
+	if (pFactory != nullptr)
+	{
+		pFactory->Release();
+	}
+
+	if (SUCCEEDED(hrCom))
+	{
+		CoUninitialize();
+	}
+}
+//=============================================================================
+// 1ファイルの読み込み処理(画像は画素まで展開し、.xmbはメッシュを解析しておく)
+//=============================================================================
+void CAssetLoader::LoadEntry(const std::string& path, Entry* pEntry, IWICImagingFactory* pFactory)
+{
+	double fStart = GetTimeMs();
+
+	pEntry->bImage = false;
+	pEntry->pImage = nullptr;
+	pEntry->pMesh = nullptr;
+	ZeroMemory(&pEntry->imageInfo, sizeof(pEntry->imageInfo));
+
+	auto pData = std::make_shared<std::vector<BYTE>>();
+
+	if (!ReadFileData(path.c_str(), pData.get()))
+	{
+		pEntry->state = STATE_FAILED;
+		pEntry->pData = nullptr;
+		pEntry->fReadMs = GetTimeMs() - fStart;
+		return;
+	}
+
+	// デバイスを使わない展開・解析はここで行う
+	if (IsImageFile(path))
+	{
+		pEntry->bImage = SUCCEEDED(D3DXGetImageInfoFromFileInMemory(
+			pData->data(), (UINT)pData->size(), &pEntry->imageInfo));
+
+		auto pImage = std::make_shared<Image>();
+		bool bDecode = IsDDSFile(path) ? DecodeDDS(*pData, pImage.get()) : DecodeWIC(pFactory, *pData, pImage.get());
+
+		if (bDecode)
+		{
+			pEntry->pImage = pImage;
+		}
+	}
+	else if (CMeshCooker::IsCookedPath(path))
+	{
+		auto pMesh = std::make_shared<CMeshCooker::MeshData>();
+
+		if (CMeshCooker::Parse(pData->data(), pData->size(), pMesh.get()))
+		{
+			pEntry->pMesh = pMesh;
+		}
+	}
+
+	pEntry->state = STATE_READY;
+	pEntry->pData = pData;
+	pEntry->fReadMs = GetTimeMs() - fStart;
+}
+//=============================================================================
+// ファイルを丸ごと読み込む処理
+//=============================================================================
+bool CAssetLoader::ReadFileData(const char* pFilename, std::vector<BYTE>* pOut)
+{
+	pOut->clear();
+
+	FILE* pFile = fopen(pFilename, "rb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fseek(pFile, 0, SEEK_END);
+	long nSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+
+	if (nSize <= 0)
+	{
+		fclose(pFile);
+		return false;
+	}
+
+	pOut->resize((size_t)nSize);
+	size_t nRead = fread(pOut->data(), 1, (size_t)nSize, pFile);
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return nRead == (size_t)nSize;
+}
+//=============================================================================
+// 画像ファイルかの判定処理(拡張子で見る)
+//=============================================================================
+bool CAssetLoader::IsImageFile(const std::string& path)
+{
+	size_t nDot = path.find_last_of('.');
+
+	if (nDot == std::string::npos)
+	{
+		return false;
+	}
+
+	std::string ext = path.substr(nDot + 1);
+
+	for (auto& c : ext)
+	{
+		c = (char)tolower((unsigned char)c);
+	}
+
+	return ext == "png" || ext == "jpg" || ext == "jpeg" || ext == "dds" || ext == "tga" || ext == "bmp";
+}
+//=============================================================================
+// DDSファイルかの判定処理(拡張子で見る)
+//=============================================================================
+bool CAssetLoader::IsDDSFile(const std::string& path)
+{
+	return path.size() > 4 && _stricmp(path.c_str() + path.size() - 4, ".dds") == 0;
+}
+//=============================================================================
+// DDSの展開処理(中身はそのままテクスチャに写せる形なので、段ごとに切り分けるだけ)
+//=============================================================================
+bool CAssetLoader::DecodeDDS(const std::vector<BYTE>& data, Image* pOut)
+{
+	// DDSの先頭(ファイルの形式通り)
+	typedef struct
+	{
+		DWORD	dwSize;
+		DWORD	dwFlags;
+		DWORD	dwHeight;
+		DWORD	dwWidth;
+		DWORD	dwPitchOrLinearSize;
+		DWORD	dwDepth;
+		DWORD	dwMipMapCount;
+		DWORD	dwReserved1[11];
+		DWORD	dwPfSize;
+		DWORD	dwPfFlags;
+		DWORD	dwFourCC;
+		DWORD	dwRGBBitCount;
+		DWORD	dwRBitMask;
+		DWORD	dwGBitMask;
+		DWORD	dwBBitMask;
+		DWORD	dwABitMask;
+		DWORD	dwCaps;
+		DWORD	dwCaps2;
+		DWORD	dwCaps3;
+		DWORD	dwCaps4;
+		DWORD	dwReserved2;
+	}DDSHeader;
+
+	static constexpr DWORD DDSD_MIPMAPCOUNT		= 0x00020000;
+	static constexpr DWORD DDPF_ALPHAPIXELS		= 0x00000001;
+	static constexpr DWORD DDPF_FOURCC			= 0x00000004;
+	static constexpr DWORD DDPF_RGB				= 0x00000040;
+	static constexpr DWORD DDSCAPS2_CUBEMAP		= 0x00000200;
+	static constexpr DWORD DDSCAPS2_VOLUME		= 0x00200000;
+
+	if (data.size() < sizeof(DWORD) + sizeof(DDSHeader) || memcmp(data.data(), "DDS ", 4) != 0)
+	{
+		return false;
+	}
+
+	DDSHeader header;
+	memcpy(&header, data.data() + sizeof(DWORD), sizeof(DDSHeader));
+
+	// キューブマップ・ボリュームはD3DXに任せる
+	if (header.dwSize != sizeof(DDSHeader) || (header.dwCaps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)) ||
+		header.dwWidth == 0 || header.dwHeight == 0)
+	{
+		return false;
+	}
+
+	// 形式の判定(ブロック圧縮か1画素のバイト数)
+	UINT nBlockBytes = 0;
+	UINT nPixelBytes = 0;
+
+	if (header.dwPfFlags & DDPF_FOURCC)
+	{
+		if (header.dwFourCC == D3DFMT_DXT1)
+		{
+			nBlockBytes = 8;
+		}
+		else if (header.dwFourCC == D3DFMT_DXT3 || header.dwFourCC == D3DFMT_DXT5)
+		{
+			nBlockBytes = 16;
+		}
+		else
+		{
+			return false;
+		}
+
+		pOut->format = (D3DFORMAT)header.dwFourCC;
+	}
+	else if ((header.dwPfFlags & DDPF_RGB) && header.dwRGBBitCount == 32 &&
+		header.dwRBitMask == 0x00ff0000 && header.dwGBitMask == 0x0000ff00 && header.dwBBitMask == 0x000000ff)
+	{
+		nPixelBytes = 4;
+		pOut->format = ((header.dwPfFlags & DDPF_ALPHAPIXELS) && header.dwABitMask == 0xff000000) ? D3DFMT_A8R8G8B8 : D3DFMT_X8R8G8B8;
+	}
+	else if ((header.dwPfFlags & DDPF_RGB) && header.dwRGBBitCount == 16 &&
+		header.dwRBitMask == 0x0f00 && header.dwGBitMask == 0x00f0 && header.dwBBitMask == 0x000f && header.dwABitMask == 0xf000)
+	{
+		nPixelBytes = 2;
+		pOut->format = D3DFMT_A4R4G4B4;
+	}
+	else
+	{
+		return false;
+	}
+
+	UINT nNumLevel = ((header.dwFlags & DDSD_MIPMAPCOUNT) && header.dwMipMapCount > 0) ? header.dwMipMapCount : 1;
+	size_t nOffset = sizeof(DWORD) + sizeof(DDSHeader);
+	UINT nWidth = header.dwWidth;
+	UINT nHeight = header.dwHeight;
+
+	pOut->levels.resize(nNumLevel);
+
+	for (UINT nCnt = 0; nCnt < nNumLevel; nCnt++)
+	{
+		ImageLevel& level = pOut->levels[nCnt];
+
+		level.nWidth = nWidth;
+		level.nHeight = nHeight;
+
+		if (nBlockBytes > 0)
+		{
+			level.nPitch = std::max(1u, (nWidth + 3) / 4) * nBlockBytes;
+			level.nRows = std::max(1u, (nHeight + 3) / 4);
+		}
+		else
+		{
+			level.nPitch = nWidth * nPixelBytes;
+			level.nRows = nHeight;
+		}
+
+		size_t nBytes = (size_t)level.nPitch * level.nRows;
+
+		if (data.size() - nOffset < nBytes)
+		{
+			return false;
+		}
+
+		level.data.assign(data.begin() + nOffset, data.begin() + nOffset + nBytes);
+		nOffset += nBytes;
+
+		nWidth = std::max(1u, nWidth / 2);
+		nHeight = std::max(1u, nHeight / 2);
+	}
+
+	return true;
+}
+//=============================================================================
+// PNG・JPG・BMPの展開処理(WICで32bitに展開し、ミップマップも作る)
+//=============================================================================
+bool CAssetLoader::DecodeWIC(IWICImagingFactory* pFactory, const std::vector<BYTE>& data, Image* pOut)
+{
+	if (pFactory == nullptr)
+	{
+		return false;
+	}
+
+	IWICStream* pStream = nullptr;
+	IWICBitmapDecoder* pDecoder = nullptr;
+	IWICBitmapFrameDecode* pFrame = nullptr;
+	IWICFormatConverter* pConverter = nullptr;
+	bool bResult = false;
+
+	// WICは読むだけなので中身は書き換えられない
+	if (SUCCEEDED(pFactory->CreateStream(&pStream)) &&
+		SUCCEEDED(pStream->InitializeFromMemory(const_cast<BYTE*>(data.data()), (DWORD)data.size())) &&
+		SUCCEEDED(pFactory->CreateDecoderFromStream(pStream, nullptr, WICDecodeMetadataCacheOnDemand, &pDecoder)) &&
+		SUCCEEDED(pDecoder->GetFrame(0, &pFrame)) &&
+		SUCCEEDED(pFactory->CreateFormatConverter(&pConverter)) &&
+		SUCCEEDED(pConverter->Initialize(pFrame, GUID_WICPixelFormat32bppBGRA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom)))
+	{
+		UINT nWidth = 0;
+		UINT nHeight = 0;
+
+		if (SUCCEEDED(pConverter->GetSize(&nWidth, &nHeight)) && nWidth > 0 && nHeight > 0)
+		{
+			// BGRAの並びはA8R8G8B8と同じ
+			pOut->format = D3DFMT_A8R8G8B8;
+			pOut->levels.resize(1);
+
+			ImageLevel& level = pOut->levels[0];
+			level.nWidth = nWidth;
+			level.nHeight = nHeight;
+			level.nPitch = nWidth * 4;
+			level.nRows = nHeight;
+			level.data.resize((size_t)level.nPitch * level.nRows);
+
+			bResult = SUCCEEDED(pConverter->CopyPixels(nullptr, level.nPitch, (UINT)level.data.size(), level.data.data()));
+		}
+	}
+
+	if (pConverter != nullptr)
+	{
+		pConverter->Release();
+	}
+
+	if (pFrame != nullptr)
+	{
+		pFrame->Release();
+	}
+
+	if (pDecoder != nullptr)
+	{
+		pDecoder->Release();
+	}
+
+	if (pStream != nullptr)
+	{
+		pStream->Release();
+	}
+
+	if (bResult)
+	{
+		BuildMipmap(pOut);
+	}
+
+	return bResult;
+}
+//=============================================================================
+// ミップマップの作成処理(D3DXの既定と同じく2x2の平均で1x1まで縮める。A8R8G8B8だけ)
+//=============================================================================
+void CAssetLoader::BuildMipmap(Image* pImage)
+{
+	while (true)
+	{
+		const ImageLevel& src = pImage->levels.back();
+
+		if (src.nWidth == 1 && src.nHeight == 1)
+		{
+			break;
+		}
+
+		ImageLevel dst;
+		dst.nWidth = std::max(1u, src.nWidth / 2);
+		dst.nHeight = std::max(1u, src.nHeight / 2);
+		dst.nPitch = dst.nWidth * 4;
+		dst.nRows = dst.nHeight;
+		dst.data.resize((size_t)dst.nPitch * dst.nRows);
+
+		for (UINT y = 0; y < dst.nHeight; y++)
+		{
+			// 1が残る辺は同じ画素を2回使う
+			UINT y0 = std::min(y * 2, src.nHeight - 1);
+			UINT y1 = std::min(y * 2 + 1, src.nHeight - 1);
+
+			for (UINT x = 0; x < dst.nWidth; x++)
+			{
+				UINT x0 = std::min(x * 2, src.nWidth - 1);
+				UINT x1 = std::min(x * 2 + 1, src.nWidth - 1);
+
+				const BYTE* p00 = &src.data[(size_t)y0 * src.nPitch + x0 * 4];
+				const BYTE* p01 = &src.data[(size_t)y0 * src.nPitch + x1 * 4];
+				const BYTE* p10 = &src.data[(size_t)y1 * src.nPitch + x0 * 4];
+				const BYTE* p11 = &src.data[(size_t)y1 * src.nPitch + x1 * 4];
+				BYTE* pDst = &dst.data[(size_t)y * dst.nPitch + x * 4];
+
+				for (int nCh = 0; nCh < 4; nCh++)
+				{
+					pDst[nCh] = (BYTE)((p00[nCh] + p01[nCh] + p10[nCh] + p11[nCh] + 2) / 4);
+				}
+			}
+		}
+
+		pImage->levels.push_back(std::move(dst));
+	}
+}
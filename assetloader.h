@@ -0,0 +1,152 @@
+//=============================================================================
+//
+// アセット読み込み処理 [assetloader.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _ASSETLOADER_H_// このマクロ定義がされていなかったら
+#define _ASSETLOADER_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "unordered_map"
+#include "memory"
+#include "deque"
+#include "thread"
+#include "mutex"
+#include "condition_variable"
+#include "meshcooker.h"
+
+//*****************************************************************************
+// アセット読み込みクラス(ファイルの読み込みと、画像の展開・メッシュの解析をワーカースレッドで行い、
+// メインスレッドは1フレームの時間の上限までリソースを作って写すだけにする)
+//*****************************************************************************
+class CAssetLoader
+{
+public:
+	// 展開した画像の1段分
+	typedef struct
+	{
+		UINT				nWidth;		// 幅
+		UINT				nHeight;	// 高さ
+		UINT				nPitch;		// 1行のバイト数(圧縮形式は4x4ブロック1行分)
+		UINT				nRows;		// 行数(圧縮形式はブロックの行数)
+		std::vector<BYTE>	data;		// 画素
+	}ImageLevel;
+
+	// 展開した画像(ミップマップの全段を持つ)
+	typedef struct
+	{
+		D3DFORMAT				format;	// 形式
+		std::vector<ImageLevel>	levels;	// 各段
+	}Image;
+
+	// 読み込んだファイルの中身(読み込み中のスレッドとも共有するので変更しない)
+	typedef std::shared_ptr<const std::vector<BYTE>> FileData;
+	typedef std::shared_ptr<const Image> ImageData;
+	typedef std::shared_ptr<const CMeshCooker::MeshData> MeshData;
+
+	static void Init(int nNumWorker = NUM_WORKER);
+	static void Uninit(void);
+	static void Request(const char* pFilename);
+	static bool IsReady(const char* pFilename);
+	static FileData GetFile(const char* pFilename);
+	static ImageData GetImage(const char* pFilename);
+	static MeshData GetMeshData(const char* pFilename);
+	static bool GetImageInfo(const char* pFilename, D3DXIMAGE_INFO* pInfo);
+	static void Discard(const char* pFilename);
+	static void ReleaseScene(void);
+	static HRESULT LoadMesh(const char* pFilename, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+		LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh,
+		D3DXVECTOR3* pMin = nullptr, D3DXVECTOR3* pMax = nullptr);
+	static HRESULT CreateMesh(const char* pFilename, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+		LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh,
+		D3DXVECTOR3* pMin = nullptr, D3DXVECTOR3* pMax = nullptr);
+	static LPD3DXMESH GetPlaceholderMesh(LPDIRECT3DDEVICE9 pDevice);
+	static void GetMeshBounds(const char* pFilename, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax);
+
+	// メインスレッドでのリソース作成の時間管理(1フレームの上限を超えたら次のフレームに回す)
+	static void BeginFrame(void);
+	static bool CanUpload(void);
+	static void EndUpload(double fMs);
+
+	// 読み込み時間の集計
+	static void ResetReport(void);
+	static void AddCreateTime(double fMs);
+	static bool WriteReport(const char* filename, const char* pLabel, double fInitMs);
+	static bool RunSelfTest(const char* filename);
+	static double GetTimeMs(void);
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	static bool IsRunning(void) { return !m_workers.empty(); }
+	static bool IsIdle(void);
+
+private:
+	static constexpr int	NUM_WORKER			= 2;	// ワーカースレッドの数
+	static constexpr double	UPLOAD_BUDGET_MS	= 2.0;	// 1フレームでリソースを作る時間の上限
+
+	// 読み込みの状態
+	typedef enum
+	{
+		STATE_QUEUED = 0,	// 順番待ち
+		STATE_LOADING,		// ワーカーが読み込み中
+		STATE_READY,		// 読み込み完了
+		STATE_FAILED,		// 読み込み失敗
+		STATE_MAX
+	}STATE;
+
+	// ファイルごとの情報
+	typedef struct
+	{
+		STATE			state;		// 状態
+		FileData		pData;		// ファイルの中身
+		ImageData		pImage;		// 展開した画像(展開できない形式はnullptr)
+		MeshData		pMesh;		// 解析したメッシュ(変換済みの.xmbだけ)
+		bool			bImage;		// 画像として解析できたか
+		D3DXIMAGE_INFO	imageInfo;	// 画像の情報
+		double			fReadMs;	// 読み込みにかかった時間
+	}Entry;
+
+	// 集計結果
+	typedef struct
+	{
+		int		nNumRequest;	// 先読みを頼んだ数
+		int		nNumHit;		// 使う時には読み込み済みだった数
+		int		nNumWait;		// 使う時に読み込み待ちをした数
+		int		nNumSync;		// 先読みされずにメインスレッドで読み込んだ数
+		int		nNumCreate;		// メインスレッドでリソースを作った数
+		int		nNumDecode;		// ワーカーで展開・解析まで済ませた数
+		double	fReadMs;		// ワーカーでの読み込み時間の合計
+		double	fWaitMs;		// メインスレッドで待った時間の合計
+		double	fSyncMs;		// メインスレッドで読み込んだ時間の合計
+		double	fCreateMs;		// メインスレッドでリソースを作った時間の合計
+		size_t	nBytes;			// 読み込んだバイト数
+	}Report;
+
+	static void WorkerMain(void);
+	static void LoadEntry(const std::string& path, Entry* pEntry, IWICImagingFactory* pFactory);
+	static bool ReadFileData(const char* pFilename, std::vector<BYTE>* pOut);
+	static bool IsImageFile(const std::string& path);
+	static bool IsDDSFile(const std::string& path);
+	static bool DecodeDDS(const std::vector<BYTE>& data, Image* pOut);
+	static bool DecodeWIC(IWICImagingFactory* pFactory, const std::vector<BYTE>& data, Image* pOut);
+	static void BuildMipmap(Image* pImage);
+
+	static std::unordered_map<std::string, Entry>	m_entries;		// パスごとの情報
+	static std::deque<std::string>					m_queue;		// 読み込み待ちのパス
+	static std::vector<std::thread>					m_workers;		// ワーカースレッド
+	static std::mutex								m_mutex;		// 上の全てを守る
+	static std::condition_variable					m_cvWork;		// 仕事が積まれた通知
+	static std::condition_variable					m_cvDone;		// 読み込みが終わった通知
+	static bool										m_bQuit;		// ワーカーの終了要求
+	static Report									m_report;		// 集計結果
+	static std::unordered_map<std::string, std::pair<D3DXVECTOR3, D3DXVECTOR3>>	m_bounds;	// 読み込み中のメッシュの境界(メインスレッドだけで使う)
+	static LPD3DXMESH								m_pPlaceholder;	// 読み込み中に代わりに描く箱(メインスレッドだけで使う)
+	static double									m_fUploadMs;	// 今回のフレームでリソースを作った時間(メインスレッドだけで使う)
+	static int										m_nNumUpload;	// 今回のフレームでリソースを作った数(メインスレッドだけで使う)
+};
+
+#endif
@@ -1,40 +1,40 @@
 //=============================================================================
 //
-// wi [background.cpp]
+// 背景処理 [background.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "background.h"
 #include "manager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CBackground::CBackground()
 {
-	// l̃NA
-	m_nIdxTexture = 0;						// eNX`CfbNX
-	memset(m_szPath, 0, sizeof(m_szPath));	// t@CpX
+	// 値のクリア
+	m_nIdxTexture = -1;						// テクスチャインデックス
+	memset(m_szPath, 0, sizeof(m_szPath));	// ファイルパス
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CBackground::~CBackground()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CBackground* CBackground::Create(const char* path, float anchorX, float anchorY, float widthRate, float heightRate)
 {
 	CBackground* pBackground = new CBackground();
 
-	// nullptr
+	// nullptrだったら
 	if (pBackground == nullptr)
 	{
 		return nullptr;
@@ -45,7 +45,7 @@ CBackground* CBackground::Create(const char* path, float anchorX, float anchorY,
 	pBackground->SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f));
 	pBackground->SetSizeRate(widthRate, heightRate);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pBackground->Init()))
 	{
 		return nullptr;
@@ -54,32 +54,36 @@ CBackground* CBackground::Create(const char* path, float anchorX, float anchorY,
 	return pBackground;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CBackground::Init(void)
 {
-	// eNX`̎擾
+	// テクスチャの取得
 	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic(m_szPath);
 
-	// 2DIuWFNg̏
+	// 2Dオブジェクトの初期化処理
 	CObject2D::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CBackground::Uninit(void)
 {
-	// 2DIuWFNg̏I
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
+
+	// 2Dオブジェクトの終了処理
 	CObject2D::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CBackground::Update(void)
 {
-	// obNobt@TCY̎擾
+	// バックバッファサイズの取得
 	float sw = (float)CManager::GetRenderer()->GetBackBufferWidth();
 	float sh = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
@@ -89,26 +93,23 @@ void CBackground::Update(void)
 	float x = sw * m_layout.anchorX - w * 0.5f;
 	float y = sh * m_layout.anchorY - h * 0.5f;
 
-	// TCY̍XV
+	// サイズの更新
 	SetSize(w, h);
 
-	// ʒu̍XV
+	// 位置の更新
 	SetPos({ x, y, 0.0f });
 
-	// 2DIuWFNg̍XV
+	// 2Dオブジェクトの更新処理
 	CObject2D::Update();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CBackground::Draw(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, CManager::GetTexture()->GetAddress(m_nIdxTexture));
+	// テクスチャの設定
+	SetIdxTexture(m_nIdxTexture);
 
-	// 2DIuWFNg̕`揈
+	// 2Dオブジェクトの描画処理
 	CObject2D::Draw();
 }
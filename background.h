@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// wi [background.h]
+// 背景処理 [background.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _BACKGROUND_H_// ̃}N`ĂȂ
-#define _BACKGROUND_H_// 2dCN[hh~̃}N`
+#ifndef _BACKGROUND_H_// このマクロ定義がされていなかったら
+#define _BACKGROUND_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object2D.h"
 
 //*****************************************************************************
-// wiNX
+// 背景クラス
 //*****************************************************************************
 class CBackground : public CObject2D
 {
@@ -21,12 +21,12 @@ public:
 	CBackground();
 	~CBackground();
 
-	// UICAEg\
+	// UIレイアウト構造体
 	struct UILayout
 	{
-		float anchorX;   // 0.0`1.0
-		float anchorY;   // 0.0`1.0
-		float widthRate; // ʔ䗦
+		float anchorX;   // 0.0～1.0
+		float anchorY;   // 0.0～1.0
+		float widthRate; // 画面比率
 		float heightRate;
 	};
 
@@ -52,9 +52,9 @@ public:
 	void SetSizeRate(float width, float height) { m_layout.widthRate = width; m_layout.heightRate = height; }
 
 private:
-	int			m_nIdxTexture;		// eNX`CfbNX
-	char		m_szPath[MAX_PATH];	// t@CpX
-	UILayout    m_layout;           // CAEg\̕ϐ
+	int			m_nIdxTexture;		// テクスチャインデックス
+	char		m_szPath[MAX_PATH];	// ファイルパス
+	UILayout    m_layout;           // レイアウト構造体変数
 
 };
 
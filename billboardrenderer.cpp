@@ -0,0 +1,548 @@
+//=============================================================================
+//
+// ビルボードまとめ描画処理 [billboardrenderer.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "billboardrenderer.h"
+#include "renderer.h"
+#include "manager.h"
+#include "random.h"
+#include "algorithm"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::vector<CBillboardRenderer::Sprite> CBillboardRenderer::m_sprites;
+std::vector<unsigned long long> CBillboardRenderer::m_order;
+LPDIRECT3DVERTEXBUFFER9 CBillboardRenderer::m_pVtxBuff = nullptr;
+LPDIRECT3DINDEXBUFFER9 CBillboardRenderer::m_pIdxBuff = nullptr;
+int CBillboardRenderer::m_nVtxCursor = 0;
+int CBillboardRenderer::m_nFrameSprite = 0;
+int CBillboardRenderer::m_nFrameDrawCall = 0;
+int CBillboardRenderer::m_nNumSprite = 0;
+int CBillboardRenderer::m_nNumDrawCall = 0;
+
+//=============================================================================
+// 初期化処理
+//=============================================================================
+HRESULT CBillboardRenderer::Init(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	// インデックスバッファの生成(中身は変わらないので最初に作っておく)
+	if (FAILED(pDevice->CreateIndexBuffer(sizeof(WORD) * 6 * BATCH_QUAD,
+		D3DUSAGE_WRITEONLY,
+		D3DFMT_INDEX16,
+		D3DPOOL_MANAGED,
+		&m_pIdxBuff,
+		NULL)))
+	{
+		return E_FAIL;
+	}
+
+	WORD* pIdx = nullptr;
+
+	if (SUCCEEDED(m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0)))
+	{
+		for (int nCnt = 0; nCnt < BATCH_QUAD; nCnt++)
+		{
+			WORD nTop = (WORD)(nCnt * 4);
+
+			// 左上・右上・左下 / 左下・右上・右下
+			pIdx[0] = nTop + 0;
+			pIdx[1] = nTop + 1;
+			pIdx[2] = nTop + 2;
+			pIdx[3] = nTop + 2;
+			pIdx[4] = nTop + 1;
+			pIdx[5] = nTop + 3;
+			pIdx += 6;
+		}
+
+		m_pIdxBuff->Unlock();
+	}
+
+	// 毎フレーム確保し直さないように先に広げておく
+	m_sprites.reserve(RESERVE_SPRITE);
+	m_order.reserve(RESERVE_SPRITE);
+
+	// 頂点バッファの生成
+	RestoreDevice();
+
+	return S_OK;
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CBillboardRenderer::Uninit(void)
+{
+	Clear();
+
+	// 頂点バッファの破棄
+	InvalidateDevice();
+
+	// インデックスバッファの破棄
+	if (m_pIdxBuff != nullptr)
+	{
+		m_pIdxBuff->Release();
+		m_pIdxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット前の破棄処理(動的頂点バッファはD3DPOOL_DEFAULTなので作り直す)
+//=============================================================================
+void CBillboardRenderer::InvalidateDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		m_pVtxBuff->Release();
+		m_pVtxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット後の生成処理
+//=============================================================================
+void CBillboardRenderer::RestoreDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		return;
+	}
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4 * BUFFER_QUAD,
+		D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY,
+		FVF_VERTEX_3D,
+		D3DPOOL_DEFAULT,
+		&m_pVtxBuff,
+		NULL);
+
+	// 次の書き込みで捨てさせる
+	m_nVtxCursor = BUFFER_QUAD;
+}
+//=============================================================================
+// フレームの開始処理(前回の描画数を確定する)
+//=============================================================================
+void CBillboardRenderer::BeginFrame(void)
+{
+	m_nNumSprite = m_nFrameSprite;
+	m_nNumDrawCall = m_nFrameDrawCall;
+
+	m_nFrameSprite = 0;
+	m_nFrameDrawCall = 0;
+}
+//=============================================================================
+// 積んだ四角形の描画処理(テクスチャとブレンドが同じものを1回で描く)
+//=============================================================================
+void CBillboardRenderer::Flush(void)
+{
+	if (m_sprites.empty())
+	{
+		return;
+	}
+
+	if (m_pVtxBuff == nullptr || m_pIdxBuff == nullptr)
+	{
+		m_sprites.clear();
+		return;
+	}
+
+	// テクスチャとブレンドごとに並べる
+	Sort();
+
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
+
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// カメラの右と上(頂点はワールド座標でカメラに向けて作る)
+	D3DXMATRIX mtxView;
+	pDevice->GetTransform(D3DTS_VIEW, &mtxView);
+
+	D3DXVECTOR3 right(mtxView._11, mtxView._21, mtxView._31);
+	D3DXVECTOR3 up(mtxView._12, mtxView._22, mtxView._32);
+
+	// ワールドマトリックスは単位行列
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixIdentity(&mtxWorld);
+	pDevice->SetTransform(D3DTS_WORLD, &mtxWorld);
+
+	// ライトを無効にする
+	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);
+
+	// Zテスト
+	pDevice->SetRenderState(D3DRS_ZFUNC, D3DCMP_LESSEQUAL);	// Zの比較方法
+	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, FALSE);		// Zバッファに書き込まない
+
+	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
+	pDevice->SetIndices(m_pIdxBuff);
+	pDevice->SetFVF(FVF_VERTEX_3D);
+
+	int nNum = (int)m_order.size();
+	int nStart = 0;
+
+	while (nStart < nNum)
+	{
+		// 同じテクスチャとブレンドの範囲
+		unsigned int key = (unsigned int)(m_order[nStart] >> 32);
+		int nEnd = nStart + 1;
+
+		while (nEnd < nNum && (unsigned int)(m_order[nEnd] >> 32) == key)
+		{
+			nEnd++;
+		}
+
+		const Sprite& first = m_sprites[(unsigned int)m_order[nStart]];
+
+		SetBlendState(pDevice, first.blend);
+
+		// テクスチャの設定
+		pDevice->SetTexture(0, pTexture->GetAddress(first.nIdxTexture));
+
+		while (nStart < nEnd)
+		{
+			int nNumQuad = std::min(nEnd - nStart, BATCH_QUAD);
+
+			// 残りに入りきらなければ捨てて先頭から使う(描画中の所は上書きしない)
+			DWORD flags = D3DLOCK_NOOVERWRITE;
+
+			if (m_nVtxCursor + nNumQuad > BUFFER_QUAD)
+			{
+				flags = D3DLOCK_DISCARD;
+				m_nVtxCursor = 0;
+			}
+
+			VERTEX_3D* pVtx = nullptr;
+
+			if (FAILED(pDevice->LockVertexBuffer(m_pVtxBuff, sizeof(VERTEX_3D) * 4 * m_nVtxCursor,
+				sizeof(VERTEX_3D) * 4 * nNumQuad, (void**)&pVtx, flags)))
+			{
+				nStart = nNum;
+				break;
+			}
+
+			Expand(m_sprites.data(), &m_order[nStart], nNumQuad, right, up, pVtx);
+
+			pDevice->UnlockVertexBuffer(m_pVtxBuff);
+
+			pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, m_nVtxCursor * 4, 0, nNumQuad * 4, 0, nNumQuad * 2);
+
+			m_nVtxCursor += nNumQuad;
+			nStart += nNumQuad;
+			m_nFrameDrawCall++;
+		}
+
+		ResetBlendState(pDevice, first.blend);
+	}
+
+	// 元に戻す
+	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);	// Zバッファに書き込む
+
+	// ライトを有効にする
+	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);
+
+	m_nFrameSprite += nNum;
+	m_sprites.clear();
+}
+//=============================================================================
+// 並べ替え処理(同じキーの中では積んだ順を保つ)
+//=============================================================================
+void CBillboardRenderer::Sort(void)
+{
+	int nNum = (int)m_sprites.size();
+
+	m_order.resize(nNum);
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		m_order[nCnt] = ((unsigned long long)GetKey(m_sprites[nCnt]) << 32) | (unsigned int)nCnt;
+	}
+
+	std::sort(m_order.begin(), m_order.end());
+}
+//=============================================================================
+// 頂点の書き込み処理(四角形をカメラに向けてワールド座標で広げる)
+//=============================================================================
+void CBillboardRenderer::Expand(const Sprite* pSprite, const unsigned long long* pOrder, int nNum,
+	const D3DXVECTOR3& right, const D3DXVECTOR3& up, VERTEX_3D* pVtx)
+{
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		const Sprite& sprite = pSprite[(unsigned int)pOrder[nCnt]];
+
+		// 右と上を画面内の回転分だけ回す
+		D3DXVECTOR3 axisX = right;
+		D3DXVECTOR3 axisY = up;
+
+		if (sprite.fRot != 0.0f)
+		{
+			float c = cosf(sprite.fRot);
+			float s = sinf(sprite.fRot);
+
+			axisX = right * c + up * s;
+			axisY = up * c - right * s;
+		}
+
+		D3DXVECTOR3 left = axisX * sprite.fLeft;
+		D3DXVECTOR3 rightEdge = axisX * sprite.fRight;
+		D3DXVECTOR3 top = axisY * sprite.fTop;
+		D3DXVECTOR3 bottom = axisY * sprite.fBottom;
+
+		// 左上・右上・左下・右下
+		pVtx[0].pos = sprite.pos + left + top;
+		pVtx[1].pos = sprite.pos + rightEdge + top;
+		pVtx[2].pos = sprite.pos + left + bottom;
+		pVtx[3].pos = sprite.pos + rightEdge + bottom;
+
+		pVtx[0].tex = sprite.uvMin;
+		pVtx[1].tex = D3DXVECTOR2(sprite.uvMax.x, sprite.uvMin.y);
+		pVtx[2].tex = D3DXVECTOR2(sprite.uvMin.x, sprite.uvMax.y);
+		pVtx[3].tex = sprite.uvMax;
+
+		for (int nCntVtx = 0; nCntVtx < 4; nCntVtx++)
+		{
+			pVtx[nCntVtx].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
+			pVtx[nCntVtx].col = sprite.col;
+		}
+
+		pVtx += 4;
+	}
+}
+//=============================================================================
+// ブレンドの設定処理
+//=============================================================================
+void CBillboardRenderer::SetBlendState(CRenderDevice* pDevice, BLEND blend)
+{
+	if (blend != BLEND_ADD)
+	{
+		return;
+	}
+
+	// αブレンディングを加算合成に設定
+	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE);
+
+	// αテストを有効
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);
+	pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
+	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);// 0より大きかったら描画
+}
+//=============================================================================
+// ブレンドを元に戻す処理
+//=============================================================================
+void CBillboardRenderer::ResetBlendState(CRenderDevice* pDevice, BLEND blend)
+{
+	if (blend != BLEND_ADD)
+	{
+		return;
+	}
+
+	// αテストを無効に戻す
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);
+
+	// αブレンディングを元に戻す
+	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+}
+//=============================================================================
+// ベンチマーク処理(1つずつ描いていた頃の計算と、並べ替えと書き込みを比べる)
+//=============================================================================
+bool CBillboardRenderer::RunBenchmark(const char* filename)
+{
+	LARGE_INTEGER freq, start, end;
+	QueryPerformanceFrequency(&freq);
+
+	auto toMs = [&](void) { return (double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)freq.QuadPart / BENCH_FRAME; };
+
+	// カメラ
+	D3DXMATRIX mtxView;
+	D3DXVECTOR3 eye(300.0f, 400.0f, -900.0f), at(0.0f, 100.0f, 0.0f), vecUp(0.0f, 1.0f, 0.0f);
+	D3DXMatrixLookAtLH(&mtxView, &eye, &at, &vecUp);
+
+	D3DXVECTOR3 right(mtxView._11, mtxView._21, mtxView._31);
+	D3DXVECTOR3 up(mtxView._12, mtxView._22, mtxView._32);
+
+	// 四角形を積む(テクスチャとブレンドは混ぜて積む)
+	CRandom random(4);
+	std::vector<Sprite> sprites(BENCH_NUM);
+
+	for (auto& sprite : sprites)
+	{
+		float fSize = random.Range(5.0f, 60.0f);
+		float fHeight = (random.Int(4) == 0) ? random.Range(0.0f, 10.0f) : 0.0f;
+
+		sprite.pos = D3DXVECTOR3(random.Range(-1000.0f, 1000.0f), random.Range(0.0f, 400.0f), random.Range(-1000.0f, 1000.0f));
+		sprite.fLeft = -fSize;
+		sprite.fRight = fSize;
+		sprite.fTop = fSize + fHeight;
+		sprite.fBottom = -fSize - fHeight;
+		sprite.fRot = (random.Int(2) == 0) ? random.Angle() : 0.0f;
+		sprite.col = D3DXCOLOR(random.Float(), random.Float(), random.Float(), 1.0f);
+		sprite.uvMin = D3DXVECTOR2(0.0f, 0.0f);
+		sprite.uvMax = D3DXVECTOR2(1.0f, 1.0f);
+		sprite.nIdxTexture = random.Int(BENCH_TEXTURE);
+		sprite.blend = (BLEND)random.Int(BLEND_MAX);
+		sprite.nLayer = 0;
+	}
+
+	// --------------------------
+	// 1つずつの時の計算(頂点を回して書き、逆ビュー行列と平行移動を掛ける)
+	// --------------------------
+	std::vector<VERTEX_3D> local((size_t)BENCH_NUM * 4);
+	std::vector<D3DXMATRIX> world(BENCH_NUM);
+
+	auto legacyFrame = [&](void)
+	{
+		for (int nCnt = 0; nCnt < BENCH_NUM; nCnt++)
+		{
+			const Sprite& sprite = sprites[nCnt];
+			VERTEX_3D* pVtx = &local[(size_t)nCnt * 4];
+
+			// Update・UpdateTurnの頂点の書き込み
+			pVtx[0].pos = D3DXVECTOR3(sprite.fLeft, sprite.fTop, 0.0f);
+			pVtx[1].pos = D3DXVECTOR3(sprite.fRight, sprite.fTop, 0.0f);
+			pVtx[2].pos = D3DXVECTOR3(sprite.fLeft, sprite.fBottom, 0.0f);
+			pVtx[3].pos = D3DXVECTOR3(sprite.fRight, sprite.fBottom, 0.0f);
+
+			float c = cosf(sprite.fRot);
+			float s = sinf(sprite.fRot);
+
+			for (int nCntVtx = 0; nCntVtx < 4; nCntVtx++)
+			{
+				float x = pVtx[nCntVtx].pos.x;
+				float y = pVtx[nCntVtx].pos.y;
+
+				pVtx[nCntVtx].pos.x = x * c - y * s;
+				pVtx[nCntVtx].pos.y = x * s + y * c;
+				pVtx[nCntVtx].col = sprite.col;
+			}
+
+			// Drawのワールドマトリックス
+			D3DXMATRIX mtxWorld, mtxTrans;
+			D3DXMatrixIdentity(&mtxWorld);
+
+			mtxWorld._11 = mtxView._11;
+			mtxWorld._12 = mtxView._21;
+			mtxWorld._13 = mtxView._31;
+			mtxWorld._21 = mtxView._12;
+			mtxWorld._22 = mtxView._22;
+			mtxWorld._23 = mtxView._32;
+			mtxWorld._31 = mtxView._13;
+			mtxWorld._32 = mtxView._23;
+			mtxWorld._33 = mtxView._33;
+
+			D3DXMatrixTranslation(&mtxTrans, sprite.pos.x, sprite.pos.y, sprite.pos.z);
+			D3DXMatrixMultiply(&world[nCnt], &mtxWorld, &mtxTrans);
+		}
+	};
+
+	legacyFrame();
+
+	QueryPerformanceCounter(&start);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		legacyFrame();
+	}
+
+	QueryPerformanceCounter(&end);
+	double fLegacyMs = toMs();
+
+	// --------------------------
+	// まとめ描画(並べ替えと頂点の書き込み)
+	// --------------------------
+	std::vector<VERTEX_3D> vtx((size_t)BENCH_NUM * 4);
+	int nNumGroup = 0;
+	double fSortMs = 0.0, fExpandMs = 0.0;
+
+	m_sprites.reserve(BENCH_NUM);
+	m_order.reserve(BENCH_NUM);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		m_sprites.assign(sprites.begin(), sprites.end());
+
+		QueryPerformanceCounter(&start);
+		Sort();
+		QueryPerformanceCounter(&end);
+		fSortMs += toMs();
+
+		QueryPerformanceCounter(&start);
+		Expand(m_sprites.data(), m_order.data(), BENCH_NUM, right, up, vtx.data());
+		QueryPerformanceCounter(&end);
+		fExpandMs += toMs();
+	}
+
+	// グループの数(=描画回数と状態の設定回数)
+	for (int nCnt = 0; nCnt < BENCH_NUM; nCnt++)
+	{
+		if (nCnt == 0 || (m_order[nCnt] >> 32) != (m_order[nCnt - 1] >> 32))
+		{
+			nNumGroup++;
+		}
+	}
+
+	// --------------------------
+	// 結果が同じか(1つずつの頂点をワールドマトリックスで変換したものと比べる)
+	// --------------------------
+	bool bMatch = true;
+	float fMaxError = 0.0f;
+
+	for (int nCnt = 0; nCnt < BENCH_NUM; nCnt++)
+	{
+		int nIdx = (int)(unsigned int)m_order[nCnt];
+
+		for (int nCntVtx = 0; nCntVtx < 4; nCntVtx++)
+		{
+			D3DXVECTOR3 pos;
+			D3DXVec3TransformCoord(&pos, &local[(size_t)nIdx * 4 + nCntVtx].pos, &world[nIdx]);
+
+			D3DXVECTOR3 diff = pos - vtx[(size_t)nCnt * 4 + nCntVtx].pos;
+			fMaxError = std::max(fMaxError, D3DXVec3Length(&diff));
+		}
+
+		// 同じキーの中で積んだ順が保たれているか
+		if (nCnt > 0 && (m_order[nCnt] >> 32) == (m_order[nCnt - 1] >> 32) &&
+			(unsigned int)m_order[nCnt] < (unsigned int)m_order[nCnt - 1])
+		{
+			bMatch = false;
+		}
+	}
+
+	bMatch = bMatch && fMaxError < 0.01f;
+
+	m_sprites.clear();
+	m_order.clear();
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "billboards             : %d (%d textures x %d blends)\n", BENCH_NUM, BENCH_TEXTURE, (int)BLEND_MAX);
+	fprintf(pFile, "frames                 : %d\n", BENCH_FRAME);
+	fprintf(pFile, "result match           : %s (max error %.5f)\n\n", bMatch ? "yes" : "no", fMaxError);
+	fprintf(pFile, "per object       ms/f  : %.3f (%d vb locks, %d draws per frame)\n", fLegacyMs, BENCH_NUM, BENCH_NUM);
+	fprintf(pFile, "batch sort       ms/f  : %.3f\n", fSortMs);
+	fprintf(pFile, "batch expand     ms/f  : %.3f\n", fExpandMs);
+	fprintf(pFile, "batch total      ms/f  : %.3f (%d groups, %d draws per frame)\n", fSortMs + fExpandMs, nNumGroup,
+		nNumGroup + (BENCH_NUM - 1) / BATCH_QUAD);
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bMatch;
+}
@@ -0,0 +1,91 @@
+//=============================================================================
+//
+// ビルボードまとめ描画処理 [billboardrenderer.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _BILLBOARDRENDERER_H_// このマクロ定義がされていなかったら
+#define _BILLBOARDRENDERER_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// 前方宣言
+//*****************************************************************************
+class CRenderDevice;
+
+//*****************************************************************************
+// ビルボードまとめ描画クラス(1フレーム分の四角形を集め、テクスチャとブレンドごとに1回で描く)
+//*****************************************************************************
+class CBillboardRenderer
+{
+public:
+	// ブレンドの種類
+	typedef enum
+	{
+		BLEND_NORMAL = 0,	// 半透明
+		BLEND_ADD,			// 加算合成(αテストあり)
+		BLEND_MAX
+	}BLEND;
+
+	// 描く四角形(大きさは中心からの上下左右の広がりで持つ)
+	typedef struct
+	{
+		D3DXVECTOR3	pos;			// 中心
+		float		fLeft;			// 左端(カメラから見て右が+)
+		float		fRight;			// 右端
+		float		fTop;			// 上端(上が+)
+		float		fBottom;		// 下端
+		float		fRot;			// 画面内の回転
+		D3DCOLOR	col;			// 色
+		D3DXVECTOR2	uvMin;			// 左上のテクスチャ座標
+		D3DXVECTOR2	uvMax;			// 右下のテクスチャ座標
+		int			nIdxTexture;	// テクスチャインデックス
+		BLEND		blend;			// ブレンドの種類
+		int			nLayer;			// 重ね順(大きいほど後に描く。0～15)
+	}Sprite;
+
+	static HRESULT Init(void);
+	static void Uninit(void);
+	static void InvalidateDevice(void);
+	static void RestoreDevice(void);
+	static void Submit(const Sprite& sprite) { m_sprites.push_back(sprite); }
+	static void Flush(void);
+	static void BeginFrame(void);
+	static void Clear(void) { m_sprites.clear(); }
+	static bool RunBenchmark(const char* filename);
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static int GetNumSprite(void) { return m_nNumSprite; }
+	static int GetNumDrawCall(void) { return m_nNumDrawCall; }
+
+private:
+	static constexpr int	BATCH_QUAD		= 4096;				// 1回の描画で描く最大の四角形数(16bitインデックスに収める)
+	static constexpr int	BUFFER_QUAD		= BATCH_QUAD * 2;	// 頂点バッファに入る四角形数(使い切ったら捨てて先頭から使う)
+	static constexpr int	RESERVE_SPRITE	= 1024;				// 最初に確保しておく四角形の数
+	static constexpr int	BENCH_NUM		= 20000;			// ベンチマークの四角形の数
+	static constexpr int	BENCH_FRAME		= 120;				// ベンチマークのフレーム数
+	static constexpr int	BENCH_TEXTURE	= 8;				// ベンチマークのテクスチャの種類
+
+	static void Sort(void);
+	static unsigned int GetKey(const Sprite& sprite)
+	{
+		return ((unsigned int)sprite.nLayer << 28) | ((unsigned int)sprite.blend << 24) | ((unsigned int)(sprite.nIdxTexture + 1) & 0xFFFFFF);
+	}
+	static void Expand(const Sprite* pSprite, const unsigned long long* pOrder, int nNum,
+		const D3DXVECTOR3& right, const D3DXVECTOR3& up, VERTEX_3D* pVtx);
+	static void SetBlendState(CRenderDevice* pDevice, BLEND blend);
+	static void ResetBlendState(CRenderDevice* pDevice, BLEND blend);
+
+	static std::vector<Sprite>				m_sprites;		// 今回描く四角形
+	static std::vector<unsigned long long>	m_order;		// 並べ替えた順番(上位 : 重ね順とブレンドとテクスチャ、下位 : 積んだ順)
+	static LPDIRECT3DVERTEXBUFFER9			m_pVtxBuff;		// 共通の動的頂点バッファ
+	static LPDIRECT3DINDEXBUFFER9			m_pIdxBuff;		// 四角形のインデックスバッファ
+	static int								m_nVtxCursor;	// 頂点バッファの次に書き込む四角形の位置
+	static int								m_nFrameSprite;		// 今回描いた四角形の数
+	static int								m_nFrameDrawCall;	// 今回の描画回数
+	static int								m_nNumSprite;		// 前回のフレームで描いた四角形の数
+	static int								m_nNumDrawCall;		// 前回のフレームの描画回数
+};
+
+#endif
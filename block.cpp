@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// ubN [block.cpp]
+// ブロック処理 [block.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "block.h"
 #include "manager.h"
@@ -15,36 +15,39 @@
 #include "result.h"
 #include "blocklist.h"
 #include "grass.h"
+#include "blockmanager.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 std::unordered_map<CBlock::TYPE, BlockCreateFunc> CBlock::m_BlockFactoryMap = {};
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CBlock::CBlock(int nPriority) : CObjectX(nPriority)
 {
-	// l̃NA
-	m_col			 = INIT_XCOL;				// F
-	m_baseCol		 = INIT_XCOL;				// x[X̐F
-	m_bSelected		 = false;					// ItO
-	m_pDebug3D		 = nullptr;					// 3DfobO\ւ̃|C^
-	m_prevSize		 = INIT_VEC3;				// ÕTCY
-	m_colliderSize	 = INIT_VEC3;				// RC_[TCY
-	m_colliderOffset = INIT_VEC3;				// RC_[̃ItZbg
-	m_isEditMode	 = false;					// ҏWǂ
-	m_isDead		 = false;					// 폜\tO
+	// 値のクリア
+	m_col			 = INIT_XCOL;				// 色
+	m_baseCol		 = INIT_XCOL;				// ベースの色
+	m_bSelected		 = false;					// 選択フラグ
+	m_pDebug3D		 = nullptr;					// 3Dデバッグ表示へのポインタ
+	m_prevSize		 = INIT_VEC3;				// 前回のサイズ
+	m_colliderSize	 = INIT_VEC3;				// コライダーサイズ
+	m_colliderOffset = INIT_VEC3;				// コライダーのオフセット
+	m_isEditMode	 = false;					// 編集中かどうか
+	m_isDead		 = false;					// 削除予約フラグ
+	m_isInstanced	 = false;					// インスタンス描画でまとめて描画されるか
+	m_isMovable		 = false;					// 実行中に動いたブロックか
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CBlock* CBlock::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot, D3DXVECTOR3 size, TYPE type)
 {
 	if (m_BlockFactoryMap.empty())
 	{
-		// t@Ng[
+		// ファクトリー
 		InitFactory();
 	}
 
@@ -57,7 +60,7 @@ CBlock* CBlock::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot,
 	}
 	else
 	{
-		pBlock = new CBlock(); // ftHgNX
+		pBlock = new CBlock(); // デフォルト基底クラス
 	}
 
 	if (!pBlock)
@@ -71,23 +74,23 @@ CBlock* CBlock::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot,
 	pBlock->SetType(type);
 	pBlock->SetPath(pFilepath);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pBlock->Init()))
 	{
 		return nullptr;
 	}
 
-	// 蔻̐
+	// 当たり判定の生成
 	pBlock->CreatePhysicsFromScale(size);
 
 	return pBlock;
 }
 //=============================================================================
-// t@Ng[
+// ファクトリー
 //=============================================================================
 void CBlock::InitFactory(void)
 {
-	// Xgɂ
+	// リストを空にする
 	m_BlockFactoryMap.clear();
 
 	m_BlockFactoryMap[CBlock::TYPE_WALL_01]			= []() -> CBlock* { return new CWallBlock(); };
@@ -104,35 +107,35 @@ void CBlock::InitFactory(void)
 	m_BlockFactoryMap[CBlock::TYPE_GEAR]			= []() -> CBlock* { return new CGearBlock(); };
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CBlock::Init(void)
 {
-	// IuWFNgX̏
+	// オブジェクトXの初期化処理
 	CObjectX::Init();
 
-	// }eAFubN̐Fɐݒ
+	// マテリアル色をブロックの色に設定
 	m_col = GetMaterialColor();
-	m_col = m_baseCol;              // ݂̐FɂxĂ
+	m_col = m_baseCol;              // 現在の色にも一度入れておく
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CBlock::Uninit(void)
 {
 	ReleasePhysics();
 
-	// IuWFNgX̏I
+	// オブジェクトXの終了処理
 	CObjectX::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CBlock::Update(void)
 {
-	// ÓIubN Transform 蓮ōXV
+	// 静的ブロックは Transform を手動で更新
 	if (!IsDynamicBlock() || IsEditMode())
 	{
 		D3DXVECTOR3 Pos = GetPos() + m_colliderOffset;
@@ -148,7 +151,7 @@ void CBlock::Update(void)
 		D3DXQuaternionRotationMatrix(&dq, &matRot);
 
 		btQuaternion q(dq.x, dq.y, dq.z, dq.w);
-		q.normalize();// K
+		q.normalize();// 正規化
 
 		trans.setOrigin(btVector3(Pos.x, Pos.y, Pos.z));
 		trans.setRotation(q);
@@ -161,7 +164,7 @@ void CBlock::Update(void)
 	}
 	else
 	{
-		// IubN͕̕ϊ擾Ĕf
+		// 動的ブロックは物理の変換を取得して反映
 
 		if (!m_pRigidBody || !m_pRigidBody->getMotionState())
 		{
@@ -174,29 +177,29 @@ void CBlock::Update(void)
 
 		btVector3 pos = trans.getOrigin();
 
-		// ʒuZbgiItZbgj
+		// 位置セット（オフセット差し引き）
 		D3DXVECTOR3 newPos(pos.x(), pos.y(), pos.z());
 		SetPos(newPos - m_colliderOffset);
 
 		btQuaternion rot = m_pRigidBody->getOrientation();
 		rot.normalize();
 
-		// Z]ōWn␳
+		// Z軸反転で座標系補正
 		D3DXQUATERNION dq(rot.x(), rot.y(), rot.z(), rot.w());
 
-		// ]sɕϊ
+		// 回転行列に変換
 		D3DXMATRIX matRot;
 		D3DXMatrixRotationQuaternion(&matRot, &dq);
 
-		// s -> IC[piXYZj
+		// 行列 -> オイラー角（XYZ順）
 		D3DXVECTOR3 euler;
-		float sy = -matRot._32; // EW
+		float sy = -matRot._32; // 右手座標
 
-		// Clamp͈͂ɂĈُp
+		// Clamp範囲を厳密にして異常角回避
 		sy = std::max(-1.0f, std::min(1.0f, sy));
 		euler.x = asinf(sy);  // pitch (X)
 
-		// cos(pitch) 0ɋ߂ƃWobNȂ̂ŁẢ
+		// cos(pitch) が0に近いとジンバルロックなので、その回避処理
 		if (fabsf(cosf(euler.x)) > 1e-4f)
 		{
 			euler.y = atan2f(matRot._31, matRot._33);  // yaw (Y)
@@ -205,10 +208,10 @@ void CBlock::Update(void)
 		else
 		{
 			euler.y = 0.0f;
-			euler.z = atan2f(-matRot._21, matRot._11); // ֒liRolloj
+			euler.z = atan2f(-matRot._21, matRot._11); // 代替値（Rollだけ抽出）
 		}
 
-		// A␳
+		// 連続補正
 		static D3DXVECTOR3 prevEuler(0, 0, 0);
 		auto FixAngleJump = [](float prev, float current) -> float
 
@@ -238,12 +241,12 @@ void CBlock::Update(void)
 
 		prevEuler = euler;
 
-		// Zbg
+		// セット
 		SetRot(euler);
 	}
 }
 //=============================================================================
-// RC_[̍XV
+// コライダーの更新処理
 //=============================================================================
 void CBlock::UpdateCollider(void)
 {
@@ -252,63 +255,78 @@ void CBlock::UpdateCollider(void)
 		return;
 	}
 
-	// ʒu̎擾
+	// 位置の取得
 	D3DXVECTOR3 Pos = GetPos();
 
-	// 폜čĐ
+	// 削除して再生成
 	ReleasePhysics();
 	CreatePhysics(Pos, m_colliderSize);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CBlock::Draw(void)
 {
-	// IuWFNgX̕`揈
+	// インスタンス描画でまとめて描画済み
+	if (m_isInstanced)
+	{
+		return;
+	}
+
+	// 画面外のブロックは描画しない
+	if (!IsInView())
+	{
+		return;
+	}
+
+	// 描画したブロック数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_BLOCK_DRAW);
+
+	// オブジェクトXの描画処理
 	CObjectX::Draw();
 }
 //=============================================================================
-// 蔻`揈
+// 当たり判定描画処理
 //=============================================================================
 void CBlock::DrawCollider(void)
 {
 	if (m_pRigidBody)
 	{
-		// RC_[̕`
-		m_pDebug3D->DrawBlockCollider(m_pRigidBody, D3DXCOLOR(0.0f, 1.0f, 0.3f, 1.0f));
+		// コライダーの描画
+		CDebugProc3D::DrawBlockCollider(m_pRigidBody, D3DXCOLOR(0.0f, 1.0f, 0.3f, 1.0f), CDebugProc3D::CATEGORY_BLOCK);
 	}
 }
 //=============================================================================
-// F̎擾
+// 色の取得
 //=============================================================================
 D3DXCOLOR CBlock::GetCol(void) const
 {
 	if (m_bSelected)
-	{// Ԃ
+	{// 赤くする
 		return D3DXCOLOR(1.0f, 0.0f, 0.0f, 0.6f);
 	}
 	else
-	{// ␳
+	{// 無補正
 		return D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f); 
 	}
 }
 //=============================================================================
-// 蔻̐
+// 当たり判定の生成処理
 //=============================================================================
 void CBlock::CreatePhysics(const D3DXVECTOR3& pos, const D3DXVECTOR3& size)
 {
-	// Physics̔j
+	// Physicsの破棄
 	ReleasePhysics();
 
 	m_colliderSize = size;
-	m_pShape = CreateCollisionShape(size);// RC_[̐
+	m_pShape = CreateCollisionShape(size);// コライダーの生成
 
 	btTransform transform;
 	transform.setIdentity();
 	btVector3 origin(pos.x + m_colliderOffset.x, pos.y + m_colliderOffset.y, pos.z + m_colliderOffset.z);
 	transform.setOrigin(origin);
 
-	// ]𔽉f
+	// 回転を反映
 	D3DXVECTOR3 euler = GetRot();
 	D3DXMATRIX matRot;
 	D3DXMatrixRotationYawPitchRoll(&matRot, euler.y, euler.x, euler.z);
@@ -318,7 +336,7 @@ void CBlock::CreatePhysics(const D3DXVECTOR3& pos, const D3DXVECTOR3& size)
 	btQuaternion quat(dq.x, dq.y, dq.z, dq.w);
 	transform.setRotation(quat);
 
-	// ҏW͋IɐÓI
+	// 編集中は強制的に静的
 	btScalar mass = m_isEditMode ? GetMass() : (!IsDynamicBlock() ? 0.0f : GetMass());
 	btVector3 inertia(0, 0, 0);
 
@@ -330,25 +348,25 @@ void CBlock::CreatePhysics(const D3DXVECTOR3& pos, const D3DXVECTOR3& size)
 	btDefaultMotionState* motionState = new btDefaultMotionState(transform);
 	btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, motionState, m_pShape, inertia);
 
-	// Wbh{fB̐
+	// リジッドボディの生成
 	m_pRigidBody = new btRigidBody(rbInfo);
 	m_pRigidBody->setUserPointer(this);
 
 	int flags = m_pRigidBody->getCollisionFlags();
 	flags |= GetCollisionFlags();
 
-	// hNX̓ꏈ
+	// 派生クラス側の特殊処理
 	OnPhysicsCreated();
 
-	m_pRigidBody->setActivationState(DISABLE_DEACTIVATION);	// X[vԂɂȂ
-	m_pRigidBody->setCollisionFlags(flags);					// RWtO
-	m_pRigidBody->setLinearFactor(GetLinearFactor());		// 
-	m_pRigidBody->setAngularFactor(GetAngularFactor());		// ]
-	m_pRigidBody->setFriction(GetFriction());				// C
-	m_pRigidBody->setRollingFriction(GetRollingFriction());	// ]薀C
-	m_pRigidBody->setDamping(0.1f, 0.5f);					// (R)linearDamping, angularDamping
+	m_pRigidBody->setActivationState(DISABLE_DEACTIVATION);	// スリープ状態にしない
+	m_pRigidBody->setCollisionFlags(flags);					// コリジョンフラグ
+	m_pRigidBody->setLinearFactor(GetLinearFactor());		// 動く方向
+	m_pRigidBody->setAngularFactor(GetAngularFactor());		// 回転する方向
+	m_pRigidBody->setFriction(GetFriction());				// 摩擦
+	m_pRigidBody->setRollingFriction(GetRollingFriction());	// 転がり摩擦
+	m_pRigidBody->setDamping(0.1f, 0.5f);					// 減衰(抵抗)linearDamping, angularDamping
 
-	// [h̎擾
+	// 物理ワールドの取得
 	btDiscreteDynamicsWorld* pWorld = CManager::GetPhysicsWorld();
 
 	if (pWorld != nullptr)
@@ -357,11 +375,11 @@ void CBlock::CreatePhysics(const D3DXVECTOR3& pos, const D3DXVECTOR3& size)
 	}
 }
 //=============================================================================
-// XP[ɂRC_[̐
+// スケールによるコライダーの生成処理
 //=============================================================================
 void CBlock::CreatePhysicsFromScale(const D3DXVECTOR3& scale)
 {
-	// f̌TCY̎擾
+	// モデルの元サイズの取得
 	D3DXVECTOR3 modelSize = GetModelSize();
 
 	D3DXVECTOR3 newColliderSize =
@@ -371,30 +389,30 @@ void CBlock::CreatePhysicsFromScale(const D3DXVECTOR3& scale)
 		modelSize.z * scale.z
 	};
 
-	CreatePhysics(GetPos(), newColliderSize); // Đ
+	CreatePhysics(GetPos(), newColliderSize); // 再生成
 }
 //=============================================================================
-// 蔻̎蓮ݒp
+// 当たり判定の手動設定用
 //=============================================================================
 void CBlock::SetColliderManual(const D3DXVECTOR3& newSize)
 {
 	m_colliderSize = newSize;
 
-	ReleasePhysics();							// ȑO̍̂폜
+	ReleasePhysics();							// 以前の剛体を削除
 
-	CreatePhysics(GetPos(), m_colliderSize);	// Đ
+	CreatePhysics(GetPos(), m_colliderSize);	// 再生成
 }
 //=============================================================================
-// Physics̔j
+// Physicsの破棄
 //=============================================================================
 void CBlock::ReleasePhysics(void)
 {
 	auto world = CManager::GetPhysicsWorld();
 
-	// ̂VFCvOɔhNXp̓ꏈjĂ
+	// 剛体やシェイプを消す前に派生クラス用の特殊処理破棄を呼ぶ
 	OnPhysicsReleased();
 
-	// Wbh{fB̔j
+	// リジッドボディの破棄
 	if (m_pRigidBody)
 	{
 		if (world)
@@ -407,7 +425,7 @@ void CBlock::ReleasePhysics(void)
 		m_pRigidBody = nullptr;
 	}
 
-	// VFCv̔j
+	// シェイプの破棄
 	if (m_pShape)
 	{
 		delete m_pShape;
@@ -415,10 +433,16 @@ void CBlock::ReleasePhysics(void)
 	}
 }
 //=============================================================================
-// GfB^[ǂŃLl}eBbNɂ邩肷鏈
+// エディター中かどうかでキネマティックにするか判定する処理
 //=============================================================================
 void CBlock::SetEditMode(bool enable)
 {
+	// 編集中はまとめ描画の対象外なのでまとめ直す
+	if (m_isEditMode != enable)
+	{
+		CBlockManager::MarkInstancesDirty();
+	}
+
 	m_isEditMode = enable;
 
 	if (!m_pRigidBody)
@@ -428,75 +452,109 @@ void CBlock::SetEditMode(bool enable)
 
 	if (enable)
 	{
-		// Ll}eBbNɂ
+		// キネマティックにする
 		m_pRigidBody->setCollisionFlags(m_pRigidBody->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
 		m_pRigidBody->setActivationState(DISABLE_DEACTIVATION);
 	}
 	else
 	{
-		// Ll}eBbN
+		// キネマティック解除
 		m_pRigidBody->setCollisionFlags(m_pRigidBody->getCollisionFlags() & ~btCollisionObject::CF_KINEMATIC_OBJECT);
 		m_pRigidBody->setActivationState(ACTIVE_TAG);
 	}
 }
 //=============================================================================
-// [h}gbNX̎擾
+// 選択中のフラグの設定(選択中は色が変わりまとめ描画の対象外なのでまとめ直す)
+//=============================================================================
+void CBlock::SetSelected(bool flag)
+{
+	if (m_bSelected != flag)
+	{
+		CBlockManager::MarkInstancesDirty();
+	}
+
+	m_bSelected = flag;
+}
+//=============================================================================
+// 位置・向き・大きさが変わった時の処理(まとめて描いているブロックならまとめ直す)
+//=============================================================================
+void CBlock::OnTransformChanged(void)
+{
+	if (!m_isInstanced)
+	{
+		return;
+	}
+
+	// 実行中に動いたブロックは以後まとめない
+	m_isMovable = true;
+
+	CBlockManager::MarkInstancesDirty();
+}
+//=============================================================================
+// 先読み中のメッシュが届いた時の処理(まとめ描画の対象になるのでまとめ直す)
+//=============================================================================
+void CBlock::OnMeshLoaded(void)
+{
+	CBlockManager::MarkInstancesDirty();
+}
+//=============================================================================
+// ワールドマトリックスの取得
 //=============================================================================
 D3DXMATRIX CBlock::GetWorldMatrix(void)
 {
 	D3DXMATRIX matScale, matRot, matTrans;
 
-	// XP[s
-	D3DXVECTOR3 scale = GetSize(); // g嗦
+	// スケール行列
+	D3DXVECTOR3 scale = GetSize(); // 拡大率
 	D3DXMatrixScaling(&matScale, scale.x, scale.y, scale.z);
 
-	// ]s
-	D3DXVECTOR3 rot = GetRot(); // WAp
+	// 回転行列
+	D3DXVECTOR3 rot = GetRot(); // ラジアン角
 	D3DXMatrixRotationYawPitchRoll(&matRot, rot.y, rot.x, rot.z);
 
-	// sړs
+	// 平行移動行列
 	D3DXVECTOR3 pos = GetPos();
 	D3DXMatrixTranslation(&matTrans, pos.x, pos.y, pos.z);
 
-	// FS * R * T
+	// 合成：S * R * T
 	D3DXMATRIX world = matScale * matRot * matTrans;
 
 	return world;
 }
 //=============================================================================
-// X|[
+// リスポーン処理
 //=============================================================================
 void CBlock::Respawn(D3DXVECTOR3 resPos)
 {
-	// ߂ɃLl}eBbNɂ
+	// 動かすためにキネマティックにする
 	SetEditMode(true);
 
-	// X|[ʒuɐݒ
+	// リスポーン位置に設定
 	SetPos(resPos);
 	SetRot(D3DXVECTOR3(0, 0, 0));
 
-	// RC_[̍XV
+	// コライダーの更新
 	UpdateCollider();
 
-	// Iɖ߂
+	// 動的に戻す
 	SetEditMode(false);
 }
 //=============================================================================
-// ȈՂ̓蔻菈(Cxgp)
+// 簡易の当たり判定処理(イベント用)
 //=============================================================================
 bool CBlock::IsHitOBBvsAABB(const OBB& obb, const D3DXVECTOR3& aabbMin, const D3DXVECTOR3& aabbMax)
 {
-	// ܂AABB̒SƔa߂
+	// まずAABBの中心と半径を求める
 	D3DXVECTOR3 aabbCenter = (aabbMin + aabbMax) * 0.5f;
 	D3DXVECTOR3 aabbHalf = (aabbMax - aabbMin) * 0.5f;
 
-	// OBBAABBWɕϊs߂
+	// OBB→AABB座標に変換する行列を求める
 	D3DXVECTOR3 diff = aabbCenter - obb.center;
 
-	// 藝iSATj
+	// 分離軸定理（SAT）
 	for (int nCnt = 0; nCnt < 3; nCnt++)
 	{
-		// OBB̎ɑ΂铊e
+		// OBBの軸に対する投影距離
 		float proj = fabs(D3DXVec3Dot(&diff, &obb.axis[nCnt]));
 		float rA = obb.halfSize[nCnt];
 		float rB;
@@ -513,11 +571,11 @@ bool CBlock::IsHitOBBvsAABB(const OBB& obb, const D3DXVECTOR3& aabbMin, const D3
 
 		if (proj > rA + rB)
 		{
-			return false; // ŕł  Փ
+			return false; // 軸で分離できた → 非衝突
 		}
 	}
 
-	// AABB3ł`FbN
+	// AABBの3軸でもチェック
 	const D3DXVECTOR3 aabbAxes[3] =
 	{
 		{1, 0, 0},
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// ubN [block.h]
+// ブロック処理 [block.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,7 +8,7 @@
 #define _BLOCK_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "objectX.h"
 #include "debugproc3D.h"
@@ -17,19 +17,19 @@
 #include "json.hpp"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CBlock;
 
 //*****************************************************************************
-// ^`
+// 型定義
 //*****************************************************************************
 using BlockCreateFunc = std::function<CBlock* ()>;
 using json = nlohmann::json;
 
 
 //*****************************************************************************
-// ubNNX
+// ブロッククラス
 //*****************************************************************************
 class CBlock : public CObjectX
 {
@@ -38,7 +38,7 @@ public:
 	virtual ~CBlock() = default;
 
 	//*****************************************************************************
-	// ubN̎
+	// ブロックの種類
 	//*****************************************************************************
 	typedef enum
 	{
@@ -61,36 +61,38 @@ public:
 		TYPE_MAX
 	}TYPE;
 
-	// OBB\
+	// OBB情報構造体
 	struct OBB
 	{
 		D3DXVECTOR3 center;
-		D3DXVECTOR3 axis[3];  // x,y,z̕xNg
+		D3DXVECTOR3 axis[3];  // x,y,z軸の方向ベクトル
 		D3DXVECTOR3 halfSize;
 	};
 
-	static CBlock* Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot,D3DXVECTOR3 size, TYPE type);	// ubN̐
+	static CBlock* Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot,D3DXVECTOR3 size, TYPE type);	// ブロックの生成
 	virtual btCollisionShape* CreateCollisionShape(const D3DXVECTOR3& size)
 	{ 
-		return new btBoxShape(btVector3(size.x * 0.5f, size.y * 0.5f, size.z * 0.5f));	// ftHg̓{bNX hNXœ̂Shapeݒ
+		return new btBoxShape(btVector3(size.x * 0.5f, size.y * 0.5f, size.z * 0.5f));	// デフォルトはボックス 派生クラスで同じのを作ってShapeを設定
 	}
-	void CreatePhysics(const D3DXVECTOR3& pos, const D3DXVECTOR3& size);				// RC_[̐
-	void CreatePhysicsFromScale(const D3DXVECTOR3& scale);								// ubNXP[ɂRC_[̐
-	virtual void OnPhysicsCreated(void) {}												// ubN̓ꏈ
-	virtual void OnPhysicsReleased(void) {}												// ubN̓ꏈ̔j
+	void CreatePhysics(const D3DXVECTOR3& pos, const D3DXVECTOR3& size);				// コライダーの生成
+	void CreatePhysicsFromScale(const D3DXVECTOR3& scale);								// ブロックスケールによるコライダーの生成
+	virtual void OnPhysicsCreated(void) {}												// ブロックの特殊処理
+	virtual void OnPhysicsReleased(void) {}												// ブロックの特殊処理の破棄
 	static void InitFactory(void);
 	HRESULT Init(void);
-	void Kill(void) { m_isDead = true; }												// ubN폜
+	void Kill(void) { m_isDead = true; }												// ブロック削除
 	void Uninit(void);
 	void Update(void);
 	void UpdateCollider(void);
 	void Draw(void);
 	void DrawCollider(void);
-	void ReleasePhysics(void);															// Physicsjp
+	void ReleasePhysics(void);															// Physics破棄用
 	virtual void Respawn(D3DXVECTOR3 resPos);
-	virtual void DrawCustomUI(void) {}													// hNXGUIꏈp
+	virtual void DrawCustomUI(void) {}													// 派生クラスのGUI特殊処理用
 	bool IsHitOBBvsAABB(const OBB& obb, const D3DXVECTOR3& aabbMin, const D3DXVECTOR3& aabbMax);
-	virtual void UpdateLight(void) {}
+	virtual bool IsLightEmitter(void) const { return false; }							// ライトを出すブロックか
+	virtual void UpdateLight(float fProgress) { (void)fProgress; }						// ライトの更新(時間の割合を受け取る)
+	virtual void ReleaseLight(void) {}													// ライトの登録解除
 
 	virtual void SaveToJson(json& b)
 	{
@@ -124,77 +126,87 @@ public:
 	}
 
 	//*****************************************************************************
-	// flagment֐
+	// flagment関数
 	//*****************************************************************************
-	bool IsSelected(void) const { return m_bSelected; }										// ubNI𒆂̃tOԂ
-	bool IsEditMode(void) const { return m_isEditMode; }									// GfBbgǂ
-	virtual bool IsDynamicBlock(void) const { return false; }								// IubN̔
+	bool IsSelected(void) const { return m_bSelected; }										// ブロックが選択中のフラグを返す
+	bool IsEditMode(void) const { return m_isEditMode; }									// エディット中かどうか
+	bool IsInstanced(void) const { return m_isInstanced; }									// インスタンス描画でまとめて描画されるか
+	bool IsMovable(void) const { return m_isMovable; }										// 実行中に動いたブロックか
+	virtual bool IsDynamicBlock(void) const { return false; }								// 動的ブロックの判別
 	virtual bool IsEnd(void) { return false; }
 	virtual bool IsGet(void) { return false; }
 	virtual bool IsSwitchOn(void) { return false; }
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
-	void SetType(TYPE type) { m_Type = type; }												// ^Cv̐ݒ
-	void SetSelected(bool flag) { m_bSelected = flag; }										// I𒆂̃tOԂ
-	void SetColliderSize(const D3DXVECTOR3& size) { m_colliderSize = size; }				// RC_[TCY̐ݒ
-	void SetColliderManual(const D3DXVECTOR3& newSize);										// RC_[TCY̎蓮ݒp
-	void SetColliderOffset(const D3DXVECTOR3& offset) { m_colliderOffset = offset; }		// RC_[̃ItZbg̐ݒ
+	void SetType(TYPE type) { m_Type = type; }												// タイプの設定
+	void SetSelected(bool flag);																// 選択中のフラグの設定
+	void SetColliderSize(const D3DXVECTOR3& size) { m_colliderSize = size; }				// コライダーサイズの設定
+	void SetColliderManual(const D3DXVECTOR3& newSize);										// コライダーサイズの手動設定用
+	void SetColliderOffset(const D3DXVECTOR3& offset) { m_colliderOffset = offset; }		// コライダーのオフセットの設定
 	void SetEditMode(bool enable);
+	void SetInstanced(bool flag) { m_isInstanced = flag; }									// インスタンス描画フラグの設定
+	void SetMovable(bool flag) { m_isMovable = flag; }										// 実行中に動いたフラグの設定
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
-	virtual D3DXCOLOR GetCol(void) const override;											// J[̎擾
-	TYPE GetType(void) const { return m_Type; }												// ^Cv̎擾
-	btRigidBody* GetRigidBody(void) const { return m_pRigidBody; }							// RigidBody̎擾
-	D3DXVECTOR3 GetColliderSize(void) const { return m_colliderSize; }						// RC_[TCY̎擾
-	D3DXVECTOR3 GetColliderOffset(void) const { return m_colliderOffset; }					// RC_[̃ItZbg̎擾
-	virtual btScalar GetMass(void) const { return DEFAULT_MASS; }							// ʂ̎擾
-	bool IsDead(void) const { return m_isDead; }											// 폜\̎擾
-	D3DXMATRIX GetWorldMatrix(void);														// }gbNX擾
+	virtual D3DXCOLOR GetCol(void) const override;											// カラーの取得
+	TYPE GetType(void) const { return m_Type; }												// タイプの取得
+	btRigidBody* GetRigidBody(void) const { return m_pRigidBody; }							// RigidBodyの取得
+	D3DXVECTOR3 GetColliderSize(void) const { return m_colliderSize; }						// コライダーサイズの取得
+	D3DXVECTOR3 GetColliderOffset(void) const { return m_colliderOffset; }					// コライダーのオフセットの取得
+	virtual btScalar GetMass(void) const { return DEFAULT_MASS; }							// 質量の取得
+	bool IsDead(void) const { return m_isDead; }											// 削除予約の取得
+	D3DXMATRIX GetWorldMatrix(void);														// マトリックス取得
 
-	virtual int GetCollisionFlags(void) const { return 0; }									// ftHg̓tOȂ
+	virtual int GetCollisionFlags(void) const { return 0; }									// デフォルトはフラグなし
 	virtual btVector3 GetLinearFactor(void) const { return btVector3(1.0f, 1.0f, 1.0f); }
 	virtual btVector3 GetAngularFactor(void) const { return btVector3(1.0f, 1.0f, 1.0f); }
 	virtual btScalar GetRollingFriction(void) const { return DEFAULT_ROLLING_FRICTION; }
 	virtual btScalar GetFriction(void) const { return DEFAULT_FRICTION; }
 
+protected:
+	void OnTransformChanged(void) override;
+	void OnMeshLoaded(void) override;
+
 private:
-	static constexpr float DEFAULT_MASS				= 2.0f;				// ftHg
-	static constexpr float DEFAULT_ROLLING_FRICTION = 0.7f;				// ftHg]C
-	static constexpr float DEFAULT_FRICTION			= 1.0f;				// ftHgC
+	static constexpr float DEFAULT_MASS				= 2.0f;				// デフォルト質量
+	static constexpr float DEFAULT_ROLLING_FRICTION = 0.7f;				// デフォルト回転摩擦
+	static constexpr float DEFAULT_FRICTION			= 1.0f;				// デフォルト摩擦
 
 	//*****************************************************************************
-	// {
+	// 基本情報
 	//*****************************************************************************
-	TYPE				m_Type;											// 
-	D3DXCOLOR			m_col;											// At@l
-	D3DXCOLOR			m_baseCol;										// x[X̃At@l
-	bool				m_bSelected;									// ItO
-	bool				m_isEditMode;									// ҏWǂ
-	bool				m_isDead;										// 폜\tO
+	TYPE				m_Type;											// 種類
+	D3DXCOLOR			m_col;											// アルファ値
+	D3DXCOLOR			m_baseCol;										// ベースのアルファ値
+	bool				m_bSelected;									// 選択フラグ
+	bool				m_isEditMode;									// 編集中かどうか
+	bool				m_isDead;										// 削除予約フラグ
+	bool				m_isInstanced;									// インスタンス描画でまとめて描画されるか
+	bool				m_isMovable;									// 実行中に動いたブロックか(まとめない)
 
 	//*****************************************************************************
 	// Physics
 	//*****************************************************************************
-	btRigidBody*		m_pRigidBody;									// ̂ւ̃|C^
-	btCollisionShape*	m_pShape;										// 蔻̌`ւ̃|C^
+	btRigidBody*		m_pRigidBody;									// 剛体へのポインタ
+	btCollisionShape*	m_pShape;										// 当たり判定の形へのポインタ
 
-	D3DXVECTOR3			m_prevSize;										// ÕTCY
-	D3DXVECTOR3			m_colliderSize;									// RC_[TCY
-	D3DXVECTOR3			m_colliderOffset;								// RC_[̈ʒu
+	D3DXVECTOR3			m_prevSize;										// 前回のサイズ
+	D3DXVECTOR3			m_colliderSize;									// コライダーサイズ
+	D3DXVECTOR3			m_colliderOffset;								// コライダーの位置
 
 	//*****************************************************************************
 	// Debug
 	//*****************************************************************************
-	CDebugProc3D*		m_pDebug3D;										// 3DfobO\ւ̃|C^
+	CDebugProc3D*		m_pDebug3D;										// 3Dデバッグ表示へのポインタ
 
 	//*****************************************************************************
 	// Factory
 	//*****************************************************************************
-	static std::unordered_map<TYPE, BlockCreateFunc> m_BlockFactoryMap;	// ubNt@Ng[
+	static std::unordered_map<TYPE, BlockCreateFunc> m_BlockFactoryMap;	// ブロックファクトリー
 };
 
 #endif
\ No newline at end of file
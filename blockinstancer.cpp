@@ -0,0 +1,675 @@
+//=============================================================================
+//
+// ブロックのインスタンス描画処理 [blockinstancer.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "blockinstancer.h"
+#include "blockmanager.h"
+#include "manager.h"
+#include "light.h"
+
+//*****************************************************************************
+// 定数定義
+//*****************************************************************************
+namespace
+{
+	// 複製するメッシュの頂点フォーマット(シェーダーの入力と合わせる)
+	const DWORD FVF_INSTANCE_MESH = D3DFVF_XYZ | D3DFVF_NORMAL | D3DFVF_TEX1;
+
+	// 頂点宣言(ストリーム0 : メッシュ、ストリーム1 : ワールドマトリックス)
+	const D3DVERTEXELEMENT9 INSTANCE_DECL[] =
+	{
+		{ 0,  0, D3DDECLTYPE_FLOAT3, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_POSITION, 0 },
+		{ 0, 12, D3DDECLTYPE_FLOAT3, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_NORMAL,   0 },
+		{ 0, 24, D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 0 },
+		{ 1,  0, D3DDECLTYPE_FLOAT4, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 1 },
+		{ 1, 16, D3DDECLTYPE_FLOAT4, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 2 },
+		{ 1, 32, D3DDECLTYPE_FLOAT4, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 3 },
+		{ 1, 48, D3DDECLTYPE_FLOAT4, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 4 },
+		D3DDECL_END()
+	};
+
+	// シェーダーに渡すライトの種類
+	const float LIGHT_TYPE_NONE			= 0.0f;
+	const float LIGHT_TYPE_POINT		= 1.0f;
+	const float LIGHT_TYPE_SPOT			= 2.0f;
+	const float LIGHT_TYPE_DIRECTIONAL	= 3.0f;
+
+	// デバイスで探すライト番号の上限
+	const int MAX_DEVICE_LIGHT = 32;
+}
+
+//=============================================================================
+// コンストラクタ
+//=============================================================================
+CBlockInstancer::CBlockInstancer()
+{
+	// 値のクリア
+	m_pVS			= nullptr;	// 頂点シェーダー
+	m_pPS			= nullptr;	// ピクセルシェーダー
+	m_pVSConsts		= nullptr;	// 頂点シェーダーの定数テーブル
+	m_pPSConsts		= nullptr;	// ピクセルシェーダーの定数テーブル
+	m_pDecl			= nullptr;	// 頂点宣言
+	m_bEnable		= false;	// インスタンス描画を使うか
+	m_bDirty		= true;		// まとめ直しが必要か
+	m_nNumInstance	= 0;		// まとめたブロック数
+	m_nNumDrawCall	= 0;		// 前回の描画回数
+	m_nNumRebuild	= 0;		// まとめ直した回数
+}
+//=============================================================================
+// デストラクタ
+//=============================================================================
+CBlockInstancer::~CBlockInstancer()
+{
+	// なし
+}
+//=============================================================================
+// 初期化処理
+//=============================================================================
+HRESULT CBlockInstancer::Init(void)
+{
+	// 作成済みなら何もしない
+	if (IsSupported())
+	{
+		m_bDirty = true;
+		return S_OK;
+	}
+
+	CRenderer* pRenderer = CManager::GetRenderer();
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = pRenderer->GetDevice();
+
+	// インスタンシングは頂点シェーダー3.0とハードウェア頂点処理が必要
+	D3DCAPS9 caps;
+	pDevice->GetDeviceCaps(&caps);
+
+	D3DDEVICE_CREATION_PARAMETERS param;
+	pDevice->GetCreationParameters(&param);
+
+	if (caps.VertexShaderVersion < D3DVS_VERSION(3, 0) ||
+		caps.PixelShaderVersion < D3DPS_VERSION(3, 0) ||
+		(param.BehaviorFlags & D3DCREATE_SOFTWARE_VERTEXPROCESSING))
+	{
+		// 使えない環境では今まで通り1つずつ描画する
+		m_bEnable = false;
+		return E_FAIL;
+	}
+
+	// シェーダーのコンパイル
+	if (FAILED(pRenderer->CompileVertexShader("data/Shader/InstanceVS.hlsl", "VSMain", &m_pVS, &m_pVSConsts)) ||
+		FAILED(pRenderer->CompilePixelShader("data/Shader/InstancePS.hlsl", "PSMain", &m_pPS, &m_pPSConsts)))
+	{
+		Uninit();
+		return E_FAIL;
+	}
+
+	// 頂点宣言の生成
+	if (FAILED(pDevice->CreateVertexDeclaration(INSTANCE_DECL, &m_pDecl)))
+	{
+		Uninit();
+		return E_FAIL;
+	}
+
+	// 起動引数で指定されていたら使わない(比較用)
+	m_bEnable = (strstr(GetCommandLineA(), "-noinstancing") == nullptr);
+	m_bDirty = true;
+
+	return S_OK;
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CBlockInstancer::Uninit(void)
+{
+	// まとまりの破棄
+	ReleaseBatches();
+
+	// シェーダーの破棄
+	if (m_pVS != nullptr)
+	{
+		m_pVS->Release();
+		m_pVS = nullptr;
+	}
+
+	if (m_pPS != nullptr)
+	{
+		m_pPS->Release();
+		m_pPS = nullptr;
+	}
+
+	if (m_pVSConsts != nullptr)
+	{
+		m_pVSConsts->Release();
+		m_pVSConsts = nullptr;
+	}
+
+	if (m_pPSConsts != nullptr)
+	{
+		m_pPSConsts->Release();
+		m_pPSConsts = nullptr;
+	}
+
+	// 頂点宣言の破棄
+	if (m_pDecl != nullptr)
+	{
+		m_pDecl->Release();
+		m_pDecl = nullptr;
+	}
+
+	m_bEnable = false;
+	m_bDirty = true;
+}
+//=============================================================================
+// 使用の切り替え処理
+//=============================================================================
+void CBlockInstancer::SetEnable(bool enable)
+{
+	m_bEnable = enable && IsSupported();
+
+	// 切り替えたらまとめ直す
+	m_bDirty = true;
+}
+//=============================================================================
+// まとまりの破棄処理
+//=============================================================================
+void CBlockInstancer::ReleaseBatches(void)
+{
+	for (auto& batch : m_batches)
+	{
+		if (batch.pInstanceBuff != nullptr)
+		{
+			batch.pInstanceBuff->Release();
+			batch.pInstanceBuff = nullptr;
+		}
+	}
+
+	for (auto& model : m_models)
+	{
+		if (model.pVtxBuff != nullptr)
+		{
+			model.pVtxBuff->Release();
+			model.pVtxBuff = nullptr;
+		}
+
+		if (model.pIdxBuff != nullptr)
+		{
+			model.pIdxBuff->Release();
+			model.pIdxBuff = nullptr;
+		}
+
+		if (model.pMesh != nullptr)
+		{
+			model.pMesh->Release();
+			model.pMesh = nullptr;
+		}
+	}
+
+	m_batches.clear();
+	m_batchIndex.clear();
+	m_models.clear();
+	m_modelIndex.clear();
+	m_nNumInstance = 0;
+	m_nNumDrawCall = 0;
+}
+//=============================================================================
+// まとめられるブロックかどうか
+//=============================================================================
+bool CBlockInstancer::IsInstanceable(CBlock* pBlock) const
+{
+	if (pBlock == nullptr || pBlock->IsDead())
+	{
+		return false;
+	}
+
+	// 物理で動くもの・実行中に動いたもの・編集中のものは対象外
+	if (pBlock->IsDynamicBlock() || pBlock->IsMovable() || pBlock->IsSelected() || pBlock->IsEditMode())
+	{
+		return false;
+	}
+
+	// 不透明パス以外(草など)と透明なものは対象外
+	if (pBlock->IsGhostObject() || pBlock->GetRenderPass() != CRenderQueue::PASS_OPAQUE)
+	{
+		return false;
+	}
+
+	if (pBlock->GetMesh() == nullptr || pBlock->GetBuffMat() == nullptr || pBlock->GetNumMat() == 0)
+	{
+		return false;
+	}
+
+	// 色の補正があるものは対象外
+	D3DXCOLOR col = pBlock->GetCol();
+
+	if (col.r < 1.0f || col.g < 1.0f || col.b < 1.0f || col.a < 1.0f)
+	{
+		return false;
+	}
+
+	// 半透明のマテリアルを持つものは対象外
+	D3DXMATERIAL* pMat = (D3DXMATERIAL*)pBlock->GetBuffMat()->GetBufferPointer();
+
+	for (int nCntMat = 0; nCntMat < (int)pBlock->GetNumMat(); nCntMat++)
+	{
+		if (pMat[nCntMat].MatD3D.Diffuse.a < 1.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+//=============================================================================
+// まとめるモデルの生成処理
+//=============================================================================
+bool CBlockInstancer::CreateModel(Model& model, CBlock* pBlock)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	LPD3DXMESH pSrc = pBlock->GetMesh();
+
+	// シェーダーの入力に合わせた頂点フォーマットで複製する
+	DWORD options = D3DXMESH_MANAGED | (pSrc->GetOptions() & D3DXMESH_32BIT);
+
+	if (FAILED(pSrc->CloneMeshFVF(options, FVF_INSTANCE_MESH, pDevice, &model.pMesh)))
+	{
+		return false;
+	}
+
+	// サブセットごとに面を並べて範囲で描画できるようにする
+	std::vector<DWORD> adjacency(model.pMesh->GetNumFaces() * 3);
+	model.pMesh->GenerateAdjacency(0.0f, adjacency.data());
+	model.pMesh->OptimizeInplace(D3DXMESHOPT_ATTRSORT, adjacency.data(), nullptr, nullptr, nullptr);
+
+	DWORD dwNumAttrib = 0;
+	model.pMesh->GetAttributeTable(nullptr, &dwNumAttrib);
+	model.attrib.resize(dwNumAttrib);
+	model.pMesh->GetAttributeTable(model.attrib.data(), &dwNumAttrib);
+
+	model.pMesh->GetVertexBuffer(&model.pVtxBuff);
+	model.pMesh->GetIndexBuffer(&model.pIdxBuff);
+
+	// マテリアルとテクスチャの保存
+	D3DXMATERIAL* pMat = (D3DXMATERIAL*)pBlock->GetBuffMat()->GetBufferPointer();
+
+	for (int nCntMat = 0; nCntMat < (int)pBlock->GetNumMat(); nCntMat++)
+	{
+		model.material.push_back(pMat[nCntMat].MatD3D);
+		model.idxTexture.push_back(pBlock->GetIdxTexture(nCntMat));
+	}
+
+	// 小物は描画距離を短くする
+	model.cullType = pBlock->GetCullType();
+
+	return true;
+}
+//=============================================================================
+// モデルの番号の取得処理(無ければ生成する)
+//=============================================================================
+int CBlockInstancer::FindModel(CBlock* pBlock)
+{
+	std::string path = pBlock->GetPath();
+	auto it = m_modelIndex.find(path);
+
+	if (it != m_modelIndex.end())
+	{
+		return it->second;
+	}
+
+	Model model = {};
+	model.path = path;
+
+	int nIdx = -1;
+
+	if (CreateModel(model, pBlock))
+	{
+		nIdx = (int)m_models.size();
+		m_models.push_back(model);
+	}
+	else if (model.pMesh != nullptr)
+	{
+		// 複製できないモデルは以後も通常描画にする
+		model.pMesh->Release();
+	}
+
+	m_modelIndex[path] = nIdx;
+
+	return nIdx;
+}
+//=============================================================================
+// まとめ直し処理
+//=============================================================================
+void CBlockInstancer::Rebuild(const std::vector<CBlock*>& blocks)
+{
+	m_bDirty = false;
+	m_nNumRebuild++;
+	m_nNumInstance = 0;
+
+	// 前回のまとまりを空にする(メッシュと頂点バッファは使い回す)
+	for (auto& batch : m_batches)
+	{
+		batch.blocks.clear();
+	}
+
+	for (CBlock* pBlock : blocks)
+	{
+		if (pBlock == nullptr)
+		{
+			continue;
+		}
+
+		pBlock->SetInstanced(false);
+
+		if (!m_bEnable || !IsInstanceable(pBlock))
+		{
+			continue;
+		}
+
+		// モデルごとにまとめる
+		int nModel = FindModel(pBlock);
+
+		if (nModel < 0)
+		{
+			continue;
+		}
+
+		// さらに空間分割のマスごとに分けて、マス単位でカリングできるようにする
+		D3DXVECTOR3 center;
+		float fRadius = 0.0f;
+		pBlock->GetWorldBounds(&center, &fRadius);
+
+		long long key = ((long long)nModel << 32) | (unsigned int)CCulling::GetCellKey(center);
+		auto it = m_batchIndex.find(key);
+		int nIdx = 0;
+
+		if (it != m_batchIndex.end())
+		{
+			nIdx = it->second;
+		}
+		else
+		{
+			Batch batch = {};
+			batch.nModel = nModel;
+
+			nIdx = (int)m_batches.size();
+			m_batches.push_back(batch);
+			m_batchIndex[key] = nIdx;
+		}
+
+		Batch& batch = m_batches[nIdx];
+
+		// まとまりを包むAABBを広げる
+		D3DXVECTOR3 extent(fRadius, fRadius, fRadius);
+		D3DXVECTOR3 vMin = center - extent;
+		D3DXVECTOR3 vMax = center + extent;
+
+		if (batch.blocks.empty())
+		{
+			batch.vMin = vMin;
+			batch.vMax = vMax;
+		}
+		else
+		{
+			D3DXVec3Minimize(&batch.vMin, &batch.vMin, &vMin);
+			D3DXVec3Maximize(&batch.vMax, &batch.vMax, &vMax);
+		}
+
+		batch.blocks.push_back(pBlock);
+	}
+
+	// 描画デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	for (auto& batch : m_batches)
+	{
+		int nNum = (int)batch.blocks.size();
+
+		// 少なすぎるものはまとめない
+		if (nNum < MIN_INSTANCE)
+		{
+			batch.blocks.clear();
+			continue;
+		}
+
+		// インスタンスの頂点バッファの確保(足りない時だけ作り直す)
+		if (batch.nCapacity < nNum)
+		{
+			if (batch.pInstanceBuff != nullptr)
+			{
+				batch.pInstanceBuff->Release();
+				batch.pInstanceBuff = nullptr;
+			}
+
+			batch.nCapacity = std::max(nNum, batch.nCapacity * 2);
+
+			if (FAILED(pDevice->CreateVertexBuffer(INSTANCE_STRIDE * batch.nCapacity,
+				D3DUSAGE_WRITEONLY, 0, D3DPOOL_MANAGED, &batch.pInstanceBuff, nullptr)))
+			{
+				batch.nCapacity = 0;
+				batch.blocks.clear();
+				continue;
+			}
+		}
+
+		// ワールドマトリックスの書き込み
+		D3DXMATRIX* pMtx = nullptr;
+
+		if (FAILED(pDevice->LockVertexBuffer(batch.pInstanceBuff, 0, INSTANCE_STRIDE * nNum, (void**)&pMtx, 0)))
+		{
+			batch.blocks.clear();
+			continue;
+		}
+
+
+		for (int nCnt = 0; nCnt < nNum; nCnt++)
+		{
+			pMtx[nCnt] = batch.blocks[nCnt]->GetWorldMatrix();
+
+			// 個別の描画を止める
+			batch.blocks[nCnt]->SetInstanced(true);
+		}
+
+		pDevice->UnlockVertexBuffer(batch.pInstanceBuff);
+
+		m_nNumInstance += nNum;
+	}
+}
+//=============================================================================
+// ライトの定数設定処理(固定機能と同じライトをシェーダーに渡す)
+//=============================================================================
+void CBlockInstancer::SetLightConstants(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	D3DXVECTOR4 aDiffuse[MAX_LIGHT] = {};	// 色(w : 未使用)
+	D3DXVECTOR4 aPos[MAX_LIGHT] = {};		// 位置(w : 種類)
+	D3DXVECTOR4 aDir[MAX_LIGHT] = {};		// 向き
+	D3DXVECTOR4 aAtten[MAX_LIGHT] = {};		// 減衰(x,y,z : 係数、w : 範囲)
+	D3DXVECTOR4 aSpot[MAX_LIGHT] = {};		// スポット(x : 内側cos、y : 外側cos、z : フォールオフ)
+
+	int nNumLight = 0;
+
+	for (int nCnt = 0; nCnt < MAX_DEVICE_LIGHT && nNumLight < MAX_LIGHT; nCnt++)
+	{
+		BOOL bEnable = FALSE;
+
+		if (FAILED(pDevice->GetLightEnable(nCnt, &bEnable)) || !bEnable)
+		{
+			continue;
+		}
+
+		D3DLIGHT9 light;
+
+		if (FAILED(pDevice->GetLight(nCnt, &light)))
+		{
+			continue;
+		}
+
+		float fType = LIGHT_TYPE_NONE;
+
+		switch (light.Type)
+		{
+		case D3DLIGHT_POINT:		fType = LIGHT_TYPE_POINT;		break;
+		case D3DLIGHT_SPOT:			fType = LIGHT_TYPE_SPOT;		break;
+		case D3DLIGHT_DIRECTIONAL:	fType = LIGHT_TYPE_DIRECTIONAL;	break;
+		default:					break;
+		}
+
+		aDiffuse[nNumLight]	= D3DXVECTOR4(light.Diffuse.r, light.Diffuse.g, light.Diffuse.b, 0.0f);
+		aPos[nNumLight]		= D3DXVECTOR4(light.Position.x, light.Position.y, light.Position.z, fType);
+		aDir[nNumLight]		= D3DXVECTOR4(light.Direction.x, light.Direction.y, light.Direction.z, 0.0f);
+		aAtten[nNumLight]	= D3DXVECTOR4(light.Attenuation0, light.Attenuation1, light.Attenuation2, light.Range);
+		aSpot[nNumLight]	= D3DXVECTOR4(cosf(light.Theta * 0.5f), cosf(light.Phi * 0.5f), light.Falloff, 0.0f);
+
+		nNumLight++;
+	}
+
+	// 環境光
+	DWORD dwAmbient = 0;
+	pDevice->GetRenderState(D3DRS_AMBIENT, &dwAmbient);
+	D3DXCOLOR ambient(dwAmbient);
+
+	m_pVSConsts->SetVector(pDevice, "g_GlobalAmbient", (D3DXVECTOR4*)&ambient);
+	m_pVSConsts->SetVectorArray(pDevice, "g_LightDiffuse", aDiffuse, MAX_LIGHT);
+	m_pVSConsts->SetVectorArray(pDevice, "g_LightPos", aPos, MAX_LIGHT);
+	m_pVSConsts->SetVectorArray(pDevice, "g_LightDir", aDir, MAX_LIGHT);
+	m_pVSConsts->SetVectorArray(pDevice, "g_LightAtten", aAtten, MAX_LIGHT);
+	m_pVSConsts->SetVectorArray(pDevice, "g_LightSpot", aSpot, MAX_LIGHT);
+}
+//=============================================================================
+// 描画処理
+//=============================================================================
+void CBlockInstancer::Draw(const std::vector<CBlock*>& blocks)
+{
+	m_nNumDrawCall = 0;
+
+	// 移動・選択・編集の切り替え時にMarkDirtyされた時だけまとめ直す
+	if (m_bDirty)
+	{
+		Rebuild(blocks);
+	}
+
+	if (!m_bEnable || m_nNumInstance == 0)
+	{
+		return;
+	}
+
+	CRenderer* pRenderer = CManager::GetRenderer();
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pD3DDevice = pRenderer->GetDevice();
+	CRenderDevice* pDevice = pRenderer->GetBackend();
+
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
+
+	// ビュー・プロジェクションマトリックス
+	D3DXMATRIX mtxView, mtxProj, mtxViewProj;
+	pDevice->GetTransform(D3DTS_VIEW, &mtxView);
+	pDevice->GetTransform(D3DTS_PROJECTION, &mtxProj);
+	mtxViewProj = mtxView * mtxProj;
+
+	m_pVSConsts->SetMatrix(pD3DDevice, "g_mViewProj", &mtxViewProj);
+
+	// ライトの設定
+	SetLightConstants();
+
+	pDevice->SetVertexDeclaration(m_pDecl);
+	pDevice->SetVertexShader(m_pVS);
+	pDevice->SetPixelShader(m_pPS);
+
+	UINT meshStride = D3DXGetFVFVertexSize(FVF_INSTANCE_MESH);
+
+	for (auto& batch : m_batches)
+	{
+		UINT nNum = (UINT)batch.blocks.size();
+
+		if (nNum == 0)
+		{
+			continue;
+		}
+
+		const Model& model = m_models[batch.nModel];
+
+		// 画面外のマスは丸ごと省く
+		if (!CCulling::IsVisibleAABB(batch.vMin, batch.vMax, model.cullType, (int)nNum))
+		{
+			continue;
+		}
+
+		// マスを包む球に届くライトを選び、変わった時だけ定数を送り直す
+		D3DXVECTOR3 extent = (batch.vMax - batch.vMin) * 0.5f;
+
+		if (CLight::Apply((batch.vMax + batch.vMin) * 0.5f, D3DXVec3Length(&extent)))
+		{
+			SetLightConstants();
+		}
+
+		// ストリーム0 : メッシュを個数分繰り返す
+		pDevice->SetStreamSource(0, model.pVtxBuff, 0, meshStride);
+		pDevice->SetStreamSourceFreq(0, D3DSTREAMSOURCE_INDEXEDDATA | nNum);
+
+		// ストリーム1 : 1インスタンスごとにワールドマトリックスを進める
+		pDevice->SetStreamSource(1, batch.pInstanceBuff, 0, INSTANCE_STRIDE);
+		pDevice->SetStreamSourceFreq(1, D3DSTREAMSOURCE_INSTANCEDATA | 1u);
+
+		pDevice->SetIndices(model.pIdxBuff);
+
+		for (const auto& attrib : model.attrib)
+		{
+			if (attrib.AttribId >= model.material.size() || attrib.FaceCount == 0)
+			{
+				continue;
+			}
+
+			// マテリアルの設定
+			const D3DMATERIAL9& mat = model.material[attrib.AttribId];
+
+			m_pVSConsts->SetVector(pD3DDevice, "g_MatDiffuse", (const D3DXVECTOR4*)&mat.Diffuse);
+			m_pVSConsts->SetVector(pD3DDevice, "g_MatAmbient", (const D3DXVECTOR4*)&mat.Ambient);
+			m_pVSConsts->SetVector(pD3DDevice, "g_MatEmissive", (const D3DXVECTOR4*)&mat.Emissive);
+
+			// テクスチャの設定
+			int nIdxTexture = model.idxTexture[attrib.AttribId];
+
+			if (nIdxTexture == -1)
+			{
+				pDevice->SetTexture(0, nullptr);
+				m_pPSConsts->SetFloat(pD3DDevice, "g_fUseTexture", 0.0f);
+			}
+			else
+			{
+				pDevice->SetTexture(0, pTexture->GetAddress(nIdxTexture));
+				m_pPSConsts->SetFloat(pD3DDevice, "g_fUseTexture", 1.0f);
+			}
+
+			// まとめて描画
+			pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, attrib.VertexStart, attrib.VertexCount,
+				attrib.FaceStart * 3, attrib.FaceCount);
+
+			m_nNumDrawCall++;
+		}
+
+		// 描画したブロック数の計測
+		CTelemetry::Add(CTelemetry::COUNTER_BLOCK_DRAW, (int)nNum);
+	}
+
+	// 設定を戻す
+	pDevice->SetStreamSourceFreq(0, 1);
+	pDevice->SetStreamSourceFreq(1, 1);
+	pDevice->SetStreamSource(1, nullptr, 0, 0);
+	pDevice->SetVertexShader(nullptr);
+	pDevice->SetPixelShader(nullptr);
+	pDevice->SetTexture(0, nullptr);
+
+	// 注視点の周りのライトに戻す
+	CLight::RestoreView();
+}
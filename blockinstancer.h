@@ -0,0 +1,110 @@
+//=============================================================================
+//
+// ブロックのインスタンス描画処理 [blockinstancer.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _BLOCKINSTANCER_H_// このマクロ定義がされていなかったら
+#define _BLOCKINSTANCER_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "unordered_map"
+#include "culling.h"
+
+//*****************************************************************************
+// 前方宣言
+//*****************************************************************************
+class CBlock;
+class CRenderDevice;
+
+//*****************************************************************************
+// ブロックのインスタンス描画クラス(同じモデルの静的ブロックを1回の描画にまとめる)
+//*****************************************************************************
+class CBlockInstancer
+{
+public:
+	CBlockInstancer();
+	~CBlockInstancer();
+
+	HRESULT Init(void);
+	void Uninit(void);
+	void Draw(const std::vector<CBlock*>& blocks);
+	void MarkDirty(void) { m_bDirty = true; }
+
+	//*****************************************************************************
+	// setter関数
+	//*****************************************************************************
+	void SetEnable(bool enable);
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	bool IsEnable(void) const { return m_bEnable; }
+	bool IsSupported(void) const { return m_pVS != nullptr && m_pPS != nullptr && m_pDecl != nullptr; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	int GetNumBatch(void) const { return (int)m_batches.size(); }
+	int GetNumInstance(void) const { return m_nNumInstance; }
+	int GetNumDrawCall(void) const { return m_nNumDrawCall; }
+	int GetNumRebuild(void) const { return m_nNumRebuild; }
+
+private:
+	static constexpr int MAX_LIGHT		= 8;		// シェーダーで扱うライトの数
+	static constexpr int MIN_INSTANCE	= 2;		// まとめる最小の個数(1個なら通常描画)
+
+	// インスタンスの頂点(ワールドマトリックスの4行)
+	static constexpr DWORD INSTANCE_STRIDE = sizeof(D3DXMATRIX);
+
+	// まとめるモデル(マスをまたいで共有する)
+	struct Model
+	{
+		std::string							path;			// モデルのパス
+		LPD3DXMESH							pMesh;			// インスタンス描画用に複製したメッシュ
+		LPDIRECT3DVERTEXBUFFER9				pVtxBuff;		// メッシュの頂点バッファ
+		LPDIRECT3DINDEXBUFFER9				pIdxBuff;		// メッシュのインデックスバッファ
+		std::vector<D3DXATTRIBUTERANGE>		attrib;			// サブセットの範囲
+		std::vector<D3DMATERIAL9>			material;		// マテリアル
+		std::vector<int>					idxTexture;		// テクスチャインデックス
+		CCulling::TYPE						cullType;		// カリングの種類
+	};
+
+	// 同じマスにある同じモデルのまとまり(マスごとに視錐台で判定する)
+	struct Batch
+	{
+		int									nModel;			// モデルの番号
+		LPDIRECT3DVERTEXBUFFER9				pInstanceBuff;	// インスタンスの頂点バッファ
+		int									nCapacity;		// インスタンスの頂点バッファの容量
+		std::vector<CBlock*>				blocks;			// まとめたブロック
+		D3DXVECTOR3							vMin;			// まとめたブロックを包むAABBの最小値
+		D3DXVECTOR3							vMax;			// まとめたブロックを包むAABBの最大値
+	};
+
+	bool IsInstanceable(CBlock* pBlock) const;
+	bool CreateModel(Model& model, CBlock* pBlock);
+	int FindModel(CBlock* pBlock);
+	void Rebuild(const std::vector<CBlock*>& blocks);
+	void ClearInstances(void);
+	void ReleaseBatches(void);
+	void SetLightConstants(void);
+
+	std::vector<Model>						m_models;		// モデルの一覧
+	std::unordered_map<std::string, int>	m_modelIndex;	// パスからモデルの番号
+	std::vector<Batch>						m_batches;		// まとまりの一覧
+	std::unordered_map<long long, int>		m_batchIndex;	// モデルとマスからまとまりの番号
+	LPDIRECT3DVERTEXSHADER9					m_pVS;			// 頂点シェーダー
+	LPDIRECT3DPIXELSHADER9					m_pPS;			// ピクセルシェーダー
+	LPD3DXCONSTANTTABLE						m_pVSConsts;	// 頂点シェーダーの定数テーブル
+	LPD3DXCONSTANTTABLE						m_pPSConsts;	// ピクセルシェーダーの定数テーブル
+	LPDIRECT3DVERTEXDECLARATION9			m_pDecl;		// 頂点宣言
+	bool									m_bEnable;		// インスタンス描画を使うか
+	bool									m_bDirty;		// まとめ直しが必要か
+	int										m_nNumInstance;	// まとめたブロック数
+	int										m_nNumDrawCall;	// 前回の描画回数
+	int										m_nNumRebuild;	// まとめ直した回数
+};
+
+#endif
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// ubNXg [blocklist.cpp]
+// ブロックリスト処理 [blocklist.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "blocklist.h"
 #include "player.h"
@@ -14,7 +14,6 @@
 #include "manager.h"
 #include "particle.h"
 #include "algorithm"
-#include "meshcylinder.h"
 #include "collisionUtils.h"
 #include "motion.h"
 #include "time.h"
@@ -26,26 +25,26 @@
 
 
 //=============================================================================
-// ǃubÑRXgN^
+// 壁ブロックのコンストラクタ
 //=============================================================================
 CWallBlock::CWallBlock()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// ǃubÑfXgN^
+// 壁ブロックのデストラクタ
 //=============================================================================
 CWallBlock::~CWallBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ǃubN̍XV
+// 壁ブロックの更新処理
 //=============================================================================
 void CWallBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
 	if (CManager::GetMode() != CScene::MODE_RESULT)
@@ -53,44 +52,44 @@ void CWallBlock::Update(void)
 		return;
 	}
 
-	// ʒu擾
+	// 位置取得
 	D3DXVECTOR3 pos = GetPos();
 
-	// (Z-)ֈړ
+	// 奥(Z-方向)へ移動
 	pos.z -= moveSpeed;
 
-	// ̉s𒴂(Ȃ)Oɖ߂
+	// 一定の奥行きを超えたら(小さくなったら)手前に戻す
 	if (pos.z <= resetDepth)
 	{
 		pos.z = bottomPosZ;
 	}
 
-	// ʒuf
+	// 位置反映
 	SetPos(pos);
 }
 
 
 //=============================================================================
-// nʃubÑRXgN^
+// 草地面ブロックのコンストラクタ
 //=============================================================================
 CGrassFloorBlock::CGrassFloorBlock()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// nʃubÑfXgN^
+// 草地面ブロックのデストラクタ
 //=============================================================================
 CGrassFloorBlock::~CGrassFloorBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// nʃubN̍XV
+// 草地面ブロックの更新処理
 //=============================================================================
 void CGrassFloorBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
 	if (CManager::GetMode() != CScene::MODE_RESULT)
@@ -98,46 +97,63 @@ void CGrassFloorBlock::Update(void)
 		return;
 	}
 
-	// ʒu擾
+	// 位置取得
 	D3DXVECTOR3 pos = GetPos();
 
-	// (Z-)ֈړ
+	// 奥(Z-方向)へ移動
 	pos.z -= moveSpeed;
 
-	// ̉s𒴂(Ȃ)Oɖ߂
+	// 一定の奥行きを超えたら(小さくなったら)手前に戻す
 	if (pos.z <= resetDepth)
 	{
 		pos.z = bottomPosZ;
 	}
 
-	// ʒuf
+	// 位置反映
 	SetPos(pos);
 }
 
 
 //=============================================================================
-// ăubÑRXgN^
+// 灯籠ブロックのコンストラクタ
 //=============================================================================
 CTorchBlock::CTorchBlock()
 {
-	// l̃NA
+	// 値のクリア
+	m_nLightIdx			= -1;			// 登録したライトの番号
+	m_nLightGeneration	= 0;			// 登録した時のライトの世代
+	m_bLightFull		= false;		// 登録できる数を超えていたか
+	m_fIntensity		= 0.0f;			// 反映済みの明るさ
+	m_lightPos			= INIT_VEC3;	// 反映済みのライトの位置
 }
 //=============================================================================
-// ăubÑfXgN^
+// 灯籠ブロックのデストラクタ
 //=============================================================================
 CTorchBlock::~CTorchBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ăubN̍XV
+// 灯籠ブロックの更新処理
 //=============================================================================
 void CTorchBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
-	// vC[̎擾
+	// エディターで動かされたらライトも動かす
+	if (m_nLightIdx >= 0 && m_nLightGeneration == CLight::GetGeneration())
+	{
+		D3DXVECTOR3 lightPos = GetLightPos();
+
+		if (lightPos != m_lightPos)
+		{
+			m_lightPos = lightPos;
+			CLight::SetLightPosition(m_nLightIdx, m_lightPos);
+		}
+	}
+
+	// プレイヤーの取得
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 	if (!pPlayer)
@@ -145,98 +161,143 @@ void CTorchBlock::Update(void)
 		return;
 	}
 
-	// ΏۂƂ̋߂邽߂ɃvC[̈ʒu擾
+	// 対象との距離を求めるためにプレイヤーの位置を取得
 	D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-	// ΏۂƂ̋߂
+	// 対象との距離を求める
 	D3DXVECTOR3 disPos = playerPos - GetPos();
 	float distance = D3DXVec3Length(&disPos);
 
-	// ͈͓ɓ
+	// 範囲内に入ったら
 	if (distance < m_distMax)
 	{
 		pPlayer->SetInTorch(true);
 	}
 }
 //=============================================================================
-// ăubÑCgXV
+// 灯籠の明るさの計算処理(夕方にフェードイン、夜中は最大、明け方にフェードアウト)
 //=============================================================================
-void CTorchBlock::UpdateLight(void)
+float CTorchBlock::CalcIntensity(float fProgress)
 {
-	float progress = 0.0f;
-
-	if (CManager::GetMode() == CScene::MODE_TUTORIAL)
-	{
-		// Ԃ̊擾
-		progress = CTutorial::GetTime()->GetProgress(); // 0.0`0.1
-	}
-	else if (CManager::GetMode() == CScene::MODE_GAME)
-	{
-		// Ԃ̊擾
-		progress = CGame::GetTime()->GetProgress(); // 0.0`0.1
-	}
-
-	// ======== ̃tF[h ========
-	float torchIntensity = 0.0f;
-
-	// ɂȂOi[jŃtF[hC
-	if (progress >= 0.25f && progress < CTime::NIGHT_START_RATE)
+	// 夜になる手前（夕方）でフェードイン
+	if (fProgress >= 0.25f && fProgress < CTime::NIGHT_START_RATE)
 	{
-		torchIntensity = (progress - 0.25f) / (CTime::NIGHT_START_RATE - 0.25f);
+		return (fProgress - 0.25f) / (CTime::NIGHT_START_RATE - 0.25f);
 	}
-	// 钆͍ő
-	else if (progress >= CTime::NIGHT_START_RATE && progress < CTime::NIGHT_END_RATE)
+	// 夜中は最大
+	else if (fProgress >= CTime::NIGHT_START_RATE && fProgress < CTime::NIGHT_END_RATE)
 	{
-		torchIntensity = 1.0f;
+		return 1.0f;
 	}
-	// ŃtF[hAEg
-	else if (progress >= CTime::NIGHT_END_RATE && progress < 1.0f)
+	// 明け方でフェードアウト
+	else if (fProgress >= CTime::NIGHT_END_RATE && fProgress < 1.0f)
 	{
-		torchIntensity = 1.0f - (progress - CTime::NIGHT_END_RATE) / (1.0f - CTime::NIGHT_END_RATE); // 10
+		return 1.0f - (fProgress - CTime::NIGHT_END_RATE) / (1.0f - CTime::NIGHT_END_RATE); // 1→0
 	}
-	// ȊO͏
-	else
+
+	// それ以外は消灯
+	return 0.0f;
+}
+//=============================================================================
+// 灯籠ブロックのライト更新処理(登録は1回だけ行い、明るさが変わった時だけ書き換える)
+//=============================================================================
+void CTorchBlock::UpdateLight(float fProgress)
+{
+	// 刻みに丸めて、細かい変化では書き換えない
+	float torchIntensity = floorf(CalcIntensity(fProgress) / INTENSITY_STEP + 0.5f) * INTENSITY_STEP;
+
+	// ライトが作り直されていたら登録し直す
+	if (m_nLightGeneration != CLight::GetGeneration())
 	{
-		torchIntensity = 0.0f;
+		m_nLightIdx = -1;
+		m_bLightFull = false;
 	}
 
-	// ======== ăCg ========
-	if (torchIntensity > 0.0f)
+	if (m_nLightIdx < 0)
 	{
-		D3DXCOLOR torchColor(1.0f, 0.7f, 0.3f, 0.8f);
-		torchColor *= torchIntensity; // tF[hxf
+		// 同じ世代で一度あふれていたら、世代が変わるまで登録しない
+		if (m_bLightFull)
+		{
+			return;
+		}
 
-		CLight::AddLight(
+		m_lightPos = GetLightPos();
+
+		m_nLightIdx = CLight::AddLight(
 			D3DLIGHT_POINT,
-			torchColor,
+			D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.0f),
 			D3DXVECTOR3(0.0f, -1.0f, 0.0f),
-			D3DXVECTOR3(GetPos().x, GetPos().y + 20.0f, GetPos().z)
+			m_lightPos
 		);
+
+		m_nLightGeneration = CLight::GetGeneration();
+
+		if (m_nLightIdx < 0)
+		{// 登録できる数を超えた(世代ごとに1回だけ知らせる)
+			m_bLightFull = true;
+
+			char aStr[256];
+			sprintf_s(aStr, "CTorchBlock::UpdateLight : ライトの登録数を超えたため(%.1f, %.1f, %.1f)の灯籠は点灯しません\n", m_lightPos.x, m_lightPos.y, m_lightPos.z);
+			OutputDebugStringA(aStr);
+
+			return;
+		}
+
+		// 消灯から始める
+		CLight::SetLightEnable(m_nLightIdx, false);
+		m_fIntensity = 0.0f;
+	}
+
+	if (torchIntensity == m_fIntensity)
+	{
+		return;
 	}
+
+	m_fIntensity = torchIntensity;
+
+	// ======== 灯籠ライト ========
+	D3DXCOLOR torchColor(1.0f, 0.7f, 0.3f, 0.8f);
+	torchColor *= torchIntensity; // フェード強度反映
+
+	CLight::SetLightDiffuse(m_nLightIdx, torchColor);
+	CLight::SetLightEnable(m_nLightIdx, torchIntensity > 0.0f);
+}
+//=============================================================================
+// 灯籠ブロックのライトの登録解除処理
+//=============================================================================
+void CTorchBlock::ReleaseLight(void)
+{
+	if (m_nLightIdx >= 0 && m_nLightGeneration == CLight::GetGeneration())
+	{
+		CLight::DeleteLight(m_nLightIdx);
+	}
+
+	m_nLightIdx = -1;
+	m_bLightFull = false;
 }
 
 
 //=============================================================================
-// ̖؃ubÑRXgN^
+// 桜の木ブロックのコンストラクタ
 //=============================================================================
 CBlossomTreeBlock::CBlossomTreeBlock()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// ̖؃ubÑfXgN^
+// 桜の木ブロックのデストラクタ
 //=============================================================================
 CBlossomTreeBlock::~CBlossomTreeBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ̖؃ubN̍XV
+// 桜の木ブロックの更新処理
 //=============================================================================
 void CBlossomTreeBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
 	if (CManager::GetMode() != CScene::MODE_RESULT)
@@ -244,77 +305,77 @@ void CBlossomTreeBlock::Update(void)
 		return;
 	}
 
-	// ʒu擾
+	// 位置取得
 	D3DXVECTOR3 pos = GetPos();
 
-	// (Z-)ֈړ
+	// 奥(Z-方向)へ移動
 	pos.z -= moveSpeed;
 
-	// ̉s𒴂(Ȃ)Oɖ߂
+	// 一定の奥行きを超えたら(小さくなったら)手前に戻す
 	if (pos.z <= resetDepth)
 	{
 		pos.z = bottomPosZ;
 	}
 
-	// ʒuf
+	// 位置反映
 	SetPos(pos);
 }
 
 
 //*****************************************************************************
-// ubN̐ÓIoϐ錾
+// 埋蔵金ブロックの静的メンバ変数宣言
 //*****************************************************************************
 int CBuriedTreasureBlock::m_getCount = 0;
 
 //=============================================================================
-// ubÑRXgN^
+// 埋蔵金ブロックのコンストラクタ
 //=============================================================================
 CBuriedTreasureBlock::CBuriedTreasureBlock()
 {
-	// l̃NA
-	m_effectTimer			= 0;		// GtFNg^C}[
-	m_guageRate				= 0.0f;		// Q[W̍ő
-	m_guageDecreaseSpeed	= 0.0f;		// Q[W̌
-	m_bUiActive				= false;	// UI\Ă邩
-	m_isFinished			= false;	// 擾I
+	// 値のクリア
+	m_effectTimer			= 0;		// エフェクト生成タイマー
+	m_guageRate				= 0.0f;		// ゲージの最大量
+	m_guageDecreaseSpeed	= 0.0f;		// ゲージの減る量
+	m_bUiActive				= false;	// UIが表示されているか
+	m_isFinished			= false;	// 取得し終えたか
 }
 //=============================================================================
-// ubÑfXgN^
+// 埋蔵金ブロックのデストラクタ
 //=============================================================================
 CBuriedTreasureBlock::~CBuriedTreasureBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ubN̏
+// 埋蔵金ブロックの初期化処理
 //=============================================================================
 HRESULT CBuriedTreasureBlock::Init(void)
 {
-	// ubN̏
+	// ブロックの初期化処理
 	CBlock::Init();
 
-	// Q[WiCӃTCYEFj
+	// ゲージ生成（任意サイズ・色）
 	m_pFrame = C3DGuage::Create(C3DGuage::TYPE_FRAME, D3DXVECTOR3(0.0f, 110.0f, 0.0f), 70.0f, 4.0f);
 	m_pGuage = C3DGuage::Create(C3DGuage::TYPE_GUAGE, D3DXVECTOR3(0.0f, 110.0f, 0.0f), 70.0f, 4.0f);
 
-	// ŏ͔\
+	// 最初は非表示
 	m_pFrame->SetActive(false);
 	m_pGuage->SetActive(false);
 
 	m_guageRate = GUAGE_RATE;
-	m_guageDecreaseSpeed = GUAGE_DECREASE_SPEED; // 1t[Ō銄
+	m_guageDecreaseSpeed = GUAGE_DECREASE_SPEED; // 1フレームで減る割合
 
-	// ZbgĂ
+	// リセットしておく
 	m_getCount = 0;
 
 	return S_OK;
 }
 //=============================================================================
-// ubN̍XV
+// 埋蔵金ブロックの更新処理
 //=============================================================================
 void CBuriedTreasureBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
 	m_effectTimer++;
@@ -323,14 +384,14 @@ void CBuriedTreasureBlock::Update(void)
 	{
 		m_effectTimer = 0;
 
-		// GtFNg̐
+		// お宝エフェクトの生成
 		CParticle::Create<CTreasureParticle>(INIT_VEC3, GetPos(), D3DXCOLOR(0.6f, 0.6f, 0.0f, 0.3f), 50, 10);
 	}
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// vC[̎擾
+	// プレイヤーの取得
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 	if (!pPlayer)
@@ -338,17 +399,17 @@ void CBuriedTreasureBlock::Update(void)
 		return;
 	}
 
-	// ΏۂƂ̋߂邽߂ɃvC[̈ʒu擾
+	// 対象との距離を求めるためにプレイヤーの位置を取得
 	D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-	// ΏۂƂ̋߂
+	// 対象との距離を求める
 	D3DXVECTOR3 disPos = playerPos - GetPos();
 	float distance = D3DXVec3Length(&disPos);
 
-	// ͈͓ɓ
+	// 範囲内に入ったら
 	if (distance < TRIGGER_DISTANCE)
 	{
-		// Q[W\
+		// ゲージを表示
 		if (!m_bUiActive)
 		{
 			if (m_pFrame && m_pGuage)
@@ -357,14 +418,14 @@ void CBuriedTreasureBlock::Update(void)
 				m_pGuage->SetActive(true);
 			}
 
-			m_bUiActive = true; // \tO
+			m_bUiActive = true; // 表示中フラグ
 		}
 
-		// _[WԒ܂͈ړ͂Ƃ̓Q[W𗭂߂Ȃ悤ɂ
+		// ダメージ状態中または移動入力があるときはゲージを溜めれないようにする
 		bool isDamage = pPlayer->GetMotion()->IsCurrentMotion(CPlayer::DAMAGE);
 		bool isMoving = pPlayer->GetIsMoving();
 
-		// Q[W炷
+		// ゲージを減らす
 		if (!isDamage && !isMoving && pPlayer->GetControlFlag())
 		{
 			m_guageRate -= m_guageDecreaseSpeed;
@@ -377,7 +438,7 @@ void CBuriedTreasureBlock::Update(void)
 	}
 	else
 	{
-		// Q[W\
+		// ゲージを非表示
 		if (m_bUiActive)
 		{
 			if (m_pFrame && m_pGuage)
@@ -386,11 +447,11 @@ void CBuriedTreasureBlock::Update(void)
 				m_pGuage->SetActive(false);
 			}
 
-			m_bUiActive = false; // \ɂ
+			m_bUiActive = false; // 非表示にする
 		}
 	}
 
-	// Q[W̕\XV
+	// ゲージの表示更新
 	if (m_pGuage)
 	{
 		D3DXVECTOR3 guagePos = GetPos() + D3DXVECTOR3(0, 80.0f, 0);
@@ -399,14 +460,14 @@ void CBuriedTreasureBlock::Update(void)
 
 		m_pGuage->UpdateGuageVtx(m_guageRate / 100.0f);
 
-		// t[XV
+		// フレームも更新
 		m_pFrame->UpdateFrame();
 	}
 
-	// Q[W[ɂȂubN폜
+	// ゲージがゼロになったらブロック削除
 	if (m_guageRate <= 0.0f)
 	{
-		// ACe擾SE̍Đ
+		// アイテム取得SEの再生
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_ITEMGET);
@@ -416,57 +477,57 @@ void CBuriedTreasureBlock::Update(void)
 		{
 			m_isFinished = true;
 
-			// 擾JEg𑝂₷
+			// 取得カウントを増やす
 			m_getCount++;
 		}
 
-		// [_[G̎擾
+		// リーダー敵の取得
 		CEnemyLeader* pEnemyLeader = CCharacterManager::GetInstance().GetCharacter<CEnemyLeader>();
 
 		if (pEnemyLeader)
 		{
-			// ꂽƂʒmāAXgʒu폜
+			// 埋蔵金が取られたことを通知して、リストから位置を削除する
 			CGenerateMap::GetInstance()->OnTreasureCollected(GetPos());
 		}
 
-		// Q[W폜
+		// ゲージも削除する
 		m_pGuage->Uninit();
 		m_pFrame->Uninit();
 
-		// 폜\
+		// 削除予約
 		Kill();
 		return;
 	}
 }
 
 //*****************************************************************************
-// ubN̐ÓIoϐ錾
+// 扉ブロックの静的メンバ変数宣言
 //*****************************************************************************
 bool CDoorBlock::m_isOpen = false;
 
 //=============================================================================
-// ubÑRXgN^
+// 扉ブロックのコンストラクタ
 //=============================================================================
 CDoorBlock::CDoorBlock()
 {
-	// l̃NA
-	m_baseRotY	= 0.0f;		// ̊px
-	m_rotY		= 0.0f;		// Ypx
-	m_prevOpen	= false;	// OɊJ
+	// 値のクリア
+	m_baseRotY	= 0.0f;		// 基準の角度
+	m_rotY		= 0.0f;		// Y角度
+	m_prevOpen	= false;	// 直前に開いたか
 }
 //=============================================================================
-// ubÑfXgN^
+// 扉ブロックのデストラクタ
 //=============================================================================
 CDoorBlock::~CDoorBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ubN̍XV
+// 扉ブロックの更新処理
 //=============================================================================
 void CDoorBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
 	if (!DoorOpen())
@@ -476,15 +537,15 @@ void CDoorBlock::Update(void)
 
 	m_isOpen = true;
 
-	// 񂾂ʂ
+	// 一回だけ通す
 	bool n = m_isOpen;
 
 	if (n && !m_prevOpen)
 	{
-		// ̎擾
+		// 音の取得
 		CSound* pSound = CManager::GetSound();
 
-		// JSE
+		// 開門SE
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_GATE_OPEN);
@@ -493,10 +554,10 @@ void CDoorBlock::Update(void)
 
 	m_prevOpen = n;
 
-	// pxȂ -90]AȂ +90]
+	// 初期角度が正なら -90°回転、負なら +90°回転
 	float targetRotY = m_baseRotY + ((m_baseRotY >= 0.0f) ? -ROT_LIMIT : +ROT_LIMIT);
 
-	// ԏ
+	// 補間処理
 	if (m_rotY < targetRotY)
 	{
 		m_rotY += ROT_SPEED;
@@ -516,7 +577,7 @@ void CDoorBlock::Update(void)
 		}
 	}
 
-	// ]Kp
+	// 回転を適用
 	D3DXVECTOR3 rot = GetRot();
 	rot.y = D3DXToRadian(m_rotY);
 	SetRot(rot);
@@ -524,33 +585,33 @@ void CDoorBlock::Update(void)
 
 
 //=============================================================================
-// oubÑRXgN^
+// 出口判定ブロックのコンストラクタ
 //=============================================================================
 CExitBlock::CExitBlock(int nPriority) : CBlock(nPriority)
 {
-	// S[XgIuWFNg
+	// ゴーストオブジェクト化
 	SetGhostObject(true);
 
-	// l̃NA
-	m_isEscape	= false;	// Eo
-	m_isIn		= false;	// ͈͓
+	// 値のクリア
+	m_isEscape	= false;	// 脱出したか
+	m_isIn		= false;	// 範囲内か
 }
 //=============================================================================
-// oubÑfXgN^
+// 出口判定ブロックのデストラクタ
 //=============================================================================
 CExitBlock::~CExitBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// oubN̍XV
+// 出口判定ブロックの更新処理
 //=============================================================================
 void CExitBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
-	// vC[̎擾
+	// プレイヤーの取得
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 	if (!pPlayer)
@@ -558,26 +619,26 @@ void CExitBlock::Update(void)
 		return;
 	}
 
-	// Eo\
+	// 脱出可能だったら
 	if (AvailableExit())
 	{
 		CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
 		CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-		// ΏۂƂ̋߂邽߂ɃvC[̈ʒu擾
+		// 対象との距離を求めるためにプレイヤーの位置を取得
 		D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-		// ΏۂƂ̋߂
+		// 対象との距離を求める
 		D3DXVECTOR3 disPos = playerPos - GetPos();
 		float distance = D3DXVec3Length(&disPos);
 
-		// ͈͓
+		// 範囲内だったら
 		if (distance < TRIGGER_DISTACE)
 		{
-			// ͈͓tOtrue
+			// 範囲内フラグtrue
 			m_isIn = true;
 
-			// Cӂ̃{^
+			// 任意のボタンを押したら
 			if (pKeyboard->GetTrigger(DIK_F) || pJoypad->GetTrigger(CInputJoypad::JOYKEY_A))
 			{
 				m_isEscape = true;
@@ -590,12 +651,12 @@ void CExitBlock::Update(void)
 	}
 }
 //=============================================================================
-// ڐG菈
+// 接触判定処理
 //=============================================================================
 bool CExitBlock::IsHitPlayer(CPlayer* pPlayer)
 {
 	//=====================================================================
-	// ubNiOBBj
+	// ブロック側（OBB）
 	//=====================================================================
 	OBB obb;
 	obb.center = GetPos();
@@ -605,13 +666,13 @@ bool CExitBlock::IsHitPlayer(CPlayer* pPlayer)
 	obb.axis[1] = D3DXVECTOR3(world._21, world._22, world._23);
 	obb.axis[2] = D3DXVECTOR3(world._31, world._32, world._33);
 
-	// ͔ÔߐK
+	// 軸は念のため正規化
 	for (int nCnt = 0; nCnt < 3; nCnt++)
 	{
 		D3DXVec3Normalize(&obb.axis[nCnt], &obb.axis[nCnt]);
 	}
 
-	// fTCYƃXP[Kp
+	// モデルサイズとスケール適用
 	D3DXVECTOR3 modelSize = GetModelSize();
 	D3DXVECTOR3 scale = GetSize();
 	obb.halfSize.x = (modelSize.x * scale.x) * 0.5f;
@@ -619,81 +680,81 @@ bool CExitBlock::IsHitPlayer(CPlayer* pPlayer)
 	obb.halfSize.z = (modelSize.z * scale.z) * 0.5f;
 
 	//=========================================================================
-	// vC[iAABBj
+	// プレイヤー側（AABB）
 	//=========================================================================
 
-	// JvZRC_[̃TCYAABBTCYvZ
+	// カプセルコライダーのサイズからAABBサイズを計算
 	D3DXVECTOR3 pSize;
 	pSize.x = pPlayer->GetRadius() * 2.0f;
 	pSize.z = pPlayer->GetRadius() * 2.0f;
 	pSize.y = pPlayer->GetHeight() + pPlayer->GetRadius() * 2.0f;
 
-	// ŏlƍől߂
+	// 最小値と最大値を求める
 	D3DXVECTOR3 playerMin = pPlayer->GetColliderPos() - pSize * 0.5f;
 	D3DXVECTOR3 playerMax = pPlayer->GetColliderPos() + pSize * 0.5f;
 
 	//=========================================================================
-	// `FbN
+	// 交差チェック
 	//=========================================================================
 	return IsHitOBBvsAABB(obb, playerMin, playerMax);
 }
 
 
 //=============================================================================
-// ubÑRXgN^
+// 門ブロックのコンストラクタ
 //=============================================================================
 CGateBlock::CGateBlock()
 {
-	// l̃NA
-	m_baseRotY		= 0.0f;			// ̊px
-	m_movieTime		= DELAY_TIME;	// x
-	m_prevStep		= 0;			// O̒iK
-	m_bClosing		= false;		// Ă邩
-	m_closeTimer	= 0.0f;			// ^C}[
-	m_fromX			= 0.0f;			// ړJnʒu
-	m_toX			= 0.0f;			// ړBʒu
+	// 値のクリア
+	m_baseRotY		= 0.0f;			// 基準の角度
+	m_movieTime		= DELAY_TIME;	// 遅延時間
+	m_prevStep		= 0;			// 直前の段階数
+	m_bClosing		= false;		// 閉じているか
+	m_closeTimer	= 0.0f;			// タイマー
+	m_fromX			= 0.0f;			// 移動開始位置
+	m_toX			= 0.0f;			// 移動到達位置
 }
 //=============================================================================
-// ubÑfXgN^
+// 門ブロックのデストラクタ
 //=============================================================================
 CGateBlock::~CGateBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ubN̍XV
+// 門ブロックの更新処理
 //=============================================================================
 void CGateBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
-	// Q[V[
+	// ゲームシーンだったら
 	if (CManager::GetMode() == CScene::MODE_GAME)
 	{
 		GameGateUpdate();
 	}
-	// [r[V[
+	// ムービーシーンだったら
 	else if (CManager::GetMode() == CScene::MODE_MOVIE)
 	{
 		MovieGateUpdate();
 	}
 }
 //=============================================================================
-// Q[V[ubN̕鏈
+// ゲームシーン門ブロックの閉じる処理
 //=============================================================================
 void CGateBlock::GameGateUpdate(void)
 {
-	// Ԃ̊擾
-	float progress = CGame::GetTime()->GetProgress(); // 0.0`1.0
+	// 時間の割合を取得
+	float progress = CGame::GetTime()->GetProgress(); // 0.0～1.0
 
-	// Ԃ̊ɉĒiKŖ
+	// 時間の割合に応じて段階で門を閉じる
 	int step = 0;
 	bool bShaking = false;
 
 	if (progress >= 0.99f)
 	{
-		step = MAX_STEP; // ؂
+		step = MAX_STEP; // 閉じ切る
 	}
 	else
 	{
@@ -702,7 +763,7 @@ void CGateBlock::GameGateUpdate(void)
 	}
 
 	// =================================
-	// \hꔻ
+	// 予兆揺れ判定
 	// =================================
 	float shakeX = 0.0f;
 
@@ -713,24 +774,24 @@ void CGateBlock::GameGateUpdate(void)
 	{
 		bShaking = true;
 
-		// \h
+		// 予兆揺れ
 		shakeX = sinf(progress * 500.0f * SHAKE_SPEED) * SHAKE_POWER;
 
-		// ʒuɐ
+		// 少し下げた位置に生成
 		D3DXVECTOR3 spawnBase = GetPos();
 		spawnBase.y -= SPAWN_OFFPOS;
 
-		// S
+		// 中心
 		D3DXVECTOR3 spawnCenter = spawnBase;
 
-		// S獶E
+		// 中心から左右
 		D3DXVECTOR3 spawnLeft = spawnBase;
 		spawnLeft.x -= SIDE_OFFSET;
 
 		D3DXVECTOR3 spawnRight = spawnBase;
 		spawnRight.x += SIDE_OFFSET;
 
-		// p[eBN
+		// 埃パーティクル生成
 		CParticle::Create<CDustParticle>(INIT_VEC3, spawnCenter,
 			D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.3f), 90, 1);
 
@@ -742,7 +803,7 @@ void CGateBlock::GameGateUpdate(void)
 	}
 
 	// =================================
-	// JngK[
+	// 閉じ開始トリガー
 	// =================================
 	if (step != m_prevStep)
 	{
@@ -754,7 +815,7 @@ void CGateBlock::GameGateUpdate(void)
 	}
 
 	// =================================
-	// Aj[ViC[WOj
+	// 閉じアニメーション（イージング）
 	// =================================
 	float moveX = step * MOVE_UNIT;
 
@@ -775,22 +836,22 @@ void CGateBlock::GameGateUpdate(void)
 
 	m_prevStep = step;
 
-	// WCpbh̎擾
+	// ジョイパッドの取得
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
 	// =================================
-	// U
+	// 振動制御
 	// =================================
 	if (bShaking && pJoypad)
 	{
-		// U
+		// 振動させる
 		pJoypad->SetVibration(20000, 20000, 60);
 	}
 
-	// ʒu擾Ĕf
+	// 位置を取得して反映する
 	D3DXVECTOR3 pos = GetPos();
 
-	// h𔽉fʒuɂ
+	// 揺れを反映した位置にする
 	if (m_baseRotY == 0.0f)
 	{
 		pos.x = m_startPosX + moveX + shakeX;
@@ -800,32 +861,32 @@ void CGateBlock::GameGateUpdate(void)
 		pos.x = m_startPosX - moveX + shakeX;
 	}
 
-	// ʒuݒ肷
+	// 位置を設定する
 	SetPos(pos);
 }
 //=============================================================================
-// [r[V[ubN̍XV
+// ムービーシーン門ブロックの更新処理
 //=============================================================================
 void CGateBlock::MovieGateUpdate(void)
 {
 	float shakeX = 0.0f;
 	bool bShaking = false;
 
-	// JEg_E
+	// カウントダウン
 	m_movieTime--;
 
 	if (m_movieTime <= 0.0f)
 	{
-		float t = -m_movieTime; // hJňoߎ
+		float t = -m_movieTime; // 揺れ開始からの経過時間
 
-		// hĂԂ
+		// 揺れている間だけ
 		if (t <= SHAKE_DURATION)
 		{
 			bShaking = true;
 
 			shakeX = sinf(t * SHAKE_SPEED) * SHAKE_POWER;
 
-			// ʒuɐ
+			// 少し下げた位置に生成
 			D3DXVECTOR3 spawnBase = GetPos();
 			spawnBase.y -= SPAWN_OFFPOS;
 
@@ -837,7 +898,7 @@ void CGateBlock::MovieGateUpdate(void)
 			D3DXVECTOR3 spawnRight = spawnBase;
 			spawnRight.x += SIDE_OFFSET;
 
-			// p[eBN
+			// 埃パーティクル生成
 			CParticle::Create<CDustParticle>(INIT_VEC3, spawnCenter,
 				D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.3f), 90, 1);
 
@@ -849,28 +910,28 @@ void CGateBlock::MovieGateUpdate(void)
 		}
 		else
 		{
-			shakeX = 0.0f; // S~
+			shakeX = 0.0f; // 完全停止
 		}
 	}
 
-	// WCpbh̎擾
+	// ジョイパッドの取得
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
 	// =========================
-	// U
+	// 振動制御
 	// =========================
 	if (bShaking && pJoypad)
 	{
-		// U
+		// 振動させる
 		pJoypad->SetVibration(20000, 20000);
 	}
 	else
 	{
-		// U~
+		// 振動停止
 		pJoypad->StopVibration();
 	}
 
-	// ʒu擾Ĕf
+	// 位置を取得して反映する
 	D3DXVECTOR3 pos = GetPos();
 	pos.x = m_startPosX + shakeX;
 
@@ -879,52 +940,52 @@ void CGateBlock::MovieGateUpdate(void)
 
 
 //=============================================================================
-// MAubÑRXgN^
+// ギアブロックのコンストラクタ
 //=============================================================================
 CGearBlock::CGearBlock()
 {
-	// l̃NA
-	m_turnTimer		= DELAY_TIME;	// ]܂ł̒x
-	m_prevTimeEnd	= false;		// ^C}[0ɂȂ
+	// 値のクリア
+	m_turnTimer		= DELAY_TIME;	// 回転までの遅延時間
+	m_prevTimeEnd	= false;		// タイマーが0になったか
 }
 //=============================================================================
-// MAubÑfXgN^
+// ギアブロックのデストラクタ
 //=============================================================================
 CGearBlock::~CGearBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// MAubN̍XV
+// ギアブロックの更新処理
 //=============================================================================
 void CGearBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
-	// Q[V[
+	// ゲームシーンだったら
 	if (CManager::GetMode() == CScene::MODE_GAME)
 	{
 		GameGearUpdate();
 	}
-	// [r[V[
+	// ムービーシーンだったら
 	else if (CManager::GetMode() == CScene::MODE_MOVIE)
 	{
 		MovieGearUpdate();
 	}
 }
 //=============================================================================
-// MAubN̍XV
+// ギアブロックの更新処理
 //=============================================================================
 void CGearBlock::GameGearUpdate(void)
 {
-	// xʂ
+	// 一度だけ通す
 	if (!m_prevTimeEnd)
 	{
-		// ̎擾
+		// 音の取得
 		CSound* pSound = CManager::GetSound();
 
-		// MASE̍Đ
+		// ギアSEの再生
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_GEAR);
@@ -933,36 +994,36 @@ void CGearBlock::GameGearUpdate(void)
 		m_prevTimeEnd = true;
 	}
 
-	// 擾āA]
+	// 向きを取得して、回転させる
 	D3DXVECTOR3 rot = GetRot();
 
 	rot.z += ROT_SPEED;
 
-	// ݒ肷
+	// 向きを設定する
 	SetRot(rot);
 }
 //=============================================================================
-// MAubN̍XV
+// ギアブロックの更新処理
 //=============================================================================
 void CGearBlock::MovieGearUpdate(void)
 {
 	m_turnTimer--;
 
-	// ^C}[0ɂȂ܂ŉ]Ȃ
+	// タイマーが0になるまで回転しない
 	if (m_turnTimer >= 0)
 	{
 		return;
 	}
 
-	// ^C}[0ɂȂ񂾂Đ
+	// タイマーが0になったら一回だけ再生する
 	bool isTimeEnd = m_turnTimer <= 0;
 
 	if (isTimeEnd && !m_prevTimeEnd)
 	{
-		// ̎擾
+		// 音の取得
 		CSound* pSound = CManager::GetSound();
 
-		// MASE̍Đ
+		// ギアSEの再生
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_GEAR);
@@ -971,14 +1032,14 @@ void CGearBlock::MovieGearUpdate(void)
 
 	m_prevTimeEnd = isTimeEnd;
 
-	// 0ɂĂ
+	// 0にしておく
 	m_turnTimer = 0;
 
-	// 擾āA]
+	// 向きを取得して、回転させる
 	D3DXVECTOR3 rot = GetRot();
 
 	rot.z += ROT_SPEED;
 
-	// ݒ肷
+	// 向きを設定する
 	SetRot(rot);
 }
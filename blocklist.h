@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// ubNXg [blocklist.h]
+// ブロックリスト処理 [blocklist.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,20 +8,20 @@
 #define _BLOCKLIST_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "guage.h"
 #include "blockmanager.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CPlayer;
 class CBlock;
 
 
 //*****************************************************************************
-// ǃubNNX
+// 壁ブロッククラス
 //*****************************************************************************
 class CWallBlock : public CBlock
 {
@@ -34,14 +34,14 @@ public:
 	void Update(void);
 
 private:
-	static constexpr float resetDepth	= -810.0f;	// ʒuZbgZʒu
-	static constexpr float bottomPosZ	= 540.0f;	// Zbgʒu
-	static constexpr float moveSpeed	= 3.0f;		// ړXs[h
+	static constexpr float resetDepth	= -810.0f;	// 位置リセットするZ位置
+	static constexpr float bottomPosZ	= 540.0f;	// リセット位置
+	static constexpr float moveSpeed	= 3.0f;		// 移動スピード
 
 };
 
 //*****************************************************************************
-// nʃubNNX
+// 草地面ブロッククラス
 //*****************************************************************************
 class CGrassFloorBlock : public CBlock
 {
@@ -54,14 +54,14 @@ public:
 	void Update(void);
 
 private:
-	static constexpr float resetDepth	= -720.0f;	// ʒuZbgZʒu
-	static constexpr float bottomPosZ	= 480.0f;	// Zbgʒu
-	static constexpr float moveSpeed	= 3.0f;		// ړXs[h
+	static constexpr float resetDepth	= -720.0f;	// 位置リセットするZ位置
+	static constexpr float bottomPosZ	= 480.0f;	// リセット位置
+	static constexpr float moveSpeed	= 3.0f;		// 移動スピード
 
 };
 
 //*****************************************************************************
-// ăubNNX
+// 灯籠ブロッククラス
 //*****************************************************************************
 class CTorchBlock : public CBlock
 {
@@ -72,16 +72,29 @@ public:
 	static TYPE GetStaticType(void) { return TYPE_TORCH_01; }
 
 	void Update(void);
-	void UpdateLight(void) override;
+	bool IsLightEmitter(void) const override { return true; }
+	void UpdateLight(float fProgress) override;
+	void ReleaseLight(void) override;
+	static float CalcIntensity(float fProgress);
 	float GetDistMax(void) { return m_distMax; }
 
 private:
-	static constexpr float m_distMax = 110.0f;	// 苗
+	static constexpr float m_distMax		= 110.0f;	// 判定距離
+	static constexpr float LIGHT_OFFSET_Y	= 20.0f;	// ライトを置く高さ
+	static constexpr float INTENSITY_STEP	= 1.0f / 64.0f;	// 明るさを更新する刻み
+
+	D3DXVECTOR3 GetLightPos(void) { return D3DXVECTOR3(GetPos().x, GetPos().y + LIGHT_OFFSET_Y, GetPos().z); }
+
+	int				m_nLightIdx;		// 登録したライトの番号
+	unsigned int	m_nLightGeneration;	// 登録した時のライトの世代
+	bool			m_bLightFull;		// この世代では登録できる数を超えていたか(世代が変わるまで登録し直さない)
+	float			m_fIntensity;		// 反映済みの明るさ
+	D3DXVECTOR3		m_lightPos;			// 反映済みのライトの位置
 
 };
 
 //*****************************************************************************
-// ubNNX
+// 岩ブロッククラス
 //*****************************************************************************
 class CRockBlock : public CBlock
 {
@@ -95,7 +108,7 @@ private:
 };
 
 //*****************************************************************************
-// ̖؃ubNNX
+// 桜の木ブロッククラス
 //*****************************************************************************
 class CBlossomTreeBlock : public CBlock
 {
@@ -108,14 +121,14 @@ public:
 	void Update(void);
 
 private:
-	static constexpr float resetDepth	= -1110.0f;	// ʒuZbgZʒu
-	static constexpr float bottomPosZ	= 740.0f;	// Zbgʒu
-	static constexpr float moveSpeed	= 3.0f;		// ړXs[h
+	static constexpr float resetDepth	= -1110.0f;	// 位置リセットするZ位置
+	static constexpr float bottomPosZ	= 740.0f;	// リセット位置
+	static constexpr float moveSpeed	= 3.0f;		// 移動スピード
 
 };
 
 //*****************************************************************************
-// ubNNX
+// 埋蔵金ブロッククラス
 //*****************************************************************************
 class CBuriedTreasureBlock : public CBlock
 {
@@ -129,7 +142,7 @@ public:
 	void Update(void);
 	bool IsGet(void)
 	{
-		// 萔ɓꂽ
+		// 一定数手に入れたら
 		if (m_getCount >= GET_THRESHOLD)
 		{
 			return true;
@@ -144,24 +157,24 @@ public:
 	int GetCollisionFlags(void) const override { return btCollisionObject::CF_NO_CONTACT_RESPONSE; }
 
 private:
-	static constexpr float	TRIGGER_DISTANCE		= 40.0f;	// 苗
-	static constexpr int	SPAWN_TIME				= 180;		// ܂ł̎
-	static constexpr int	GET_THRESHOLD			= 3;		// 擾臒l
-	static constexpr float	GUAGE_RATE				= 100.0f;	// Q[W̍ő
-	static constexpr float	GUAGE_DECREASE_SPEED	= 0.22f;	// Q[W̌
-
-	int			m_effectTimer;									// GtFNg^C}[
-	C3DGuage*	m_pFrame;										// g
-	C3DGuage*	m_pGuage;										// CQ[W
-	float		m_guageRate;									// Q[W̍ő
-	float		m_guageDecreaseSpeed;							// Q[W̌
-	bool		m_bUiActive;									// UI̕\E\tO
-	static int	m_getCount;										// 擾
-	bool		m_isFinished;									// 擾I(P)
+	static constexpr float	TRIGGER_DISTANCE		= 40.0f;	// 判定距離
+	static constexpr int	SPAWN_TIME				= 180;		// 生成までの時間
+	static constexpr int	GET_THRESHOLD			= 3;		// 取得数閾値
+	static constexpr float	GUAGE_RATE				= 100.0f;	// ゲージの最大量
+	static constexpr float	GUAGE_DECREASE_SPEED	= 0.22f;	// ゲージの減る量
+
+	int			m_effectTimer;									// エフェクト生成タイマー
+	C3DGuage*	m_pFrame;										// 枠
+	C3DGuage*	m_pGuage;										// メインゲージ
+	float		m_guageRate;									// ゲージの最大量
+	float		m_guageDecreaseSpeed;							// ゲージの減る量
+	bool		m_bUiActive;									// UIの表示・非表示フラグ
+	static int	m_getCount;										// 取得数
+	bool		m_isFinished;									// 取得し終えたか(単体)
 };
 
 //*****************************************************************************
-// ubNNX
+// 扉ブロッククラス
 //*****************************************************************************
 class CDoorBlock : public CBlock
 {
@@ -177,19 +190,19 @@ public:
 	{
 		CBlock::LoadFromJson(b);
 
-		// px m_rotY ɓxŕۑ
-		D3DXVECTOR3 rot = GetRot();             // WA
-		m_baseRotY = D3DXToDegree(rot.y);       // xɕϊĊpx
-		m_rotY = m_baseRotY;                    // ݊px
+		// 初期角度を m_rotY に度数で保存
+		D3DXVECTOR3 rot = GetRot();             // ラジアン
+		m_baseRotY = D3DXToDegree(rot.y);       // 度に変換して基準角度
+		m_rotY = m_baseRotY;                    // 現在角度も同じ
 	}
 
 	void Update(void);
 	bool DoorOpen(void)
 	{
-		// --- ubN萔擾ꂽmF ---
+		// --- 埋蔵金ブロックが一定数取得されたか確認 ---
 		auto buriedTreasureBlocks = CBlockManager::GetBlocksOfType<CBuriedTreasureBlock>();
 
-		// ݂ȂtrueԂ
+		// 埋蔵金が存在しなかったらtrueを返す
 		if (buriedTreasureBlocks.empty())
 		{
 			return true;
@@ -197,7 +210,7 @@ public:
 
 		for (CBuriedTreasureBlock* treasure : buriedTreasureBlocks)
 		{
-			// 擾
+			// 埋蔵金を取得したか
 			if (treasure->IsGet())
 			{
 				return true;
@@ -210,17 +223,17 @@ public:
 	bool IsOpen(void) { return m_isOpen; }
 
 private:
-	static constexpr float ROT_LIMIT = 90.0f;	// ]px
-	static constexpr float ROT_SPEED = 0.5f;	// ]Xs[h
+	static constexpr float ROT_LIMIT = 90.0f;	// 回転角度
+	static constexpr float ROT_SPEED = 0.5f;	// 回転スピード
 
-	float		m_baseRotY;						// ̊px
-	float		m_rotY;							// Ypx
-	static bool m_isOpen;						// Jǂ
-	bool		m_prevOpen;						// OɊJ
+	float		m_baseRotY;						// 基準の角度
+	float		m_rotY;							// Y角度
+	static bool m_isOpen;						// 開いたかどうか
+	bool		m_prevOpen;						// 直前に開いたか
 };
 
 //*****************************************************************************
-// oubNNX
+// 出口判定ブロッククラス
 //*****************************************************************************
 class CExitBlock : public CBlock
 {
@@ -237,10 +250,10 @@ public:
 	bool IsIn(void) { return m_isIn; }
 	bool AvailableExit(void)
 	{
-		// --- ubN萔擾ꂽmF ---
+		// --- 埋蔵金ブロックが一定数取得されたか確認 ---
 		auto buriedTreasureBlocks = CBlockManager::GetBlocksOfType<CBuriedTreasureBlock>();
 
-		// ݂ȂtrueԂ
+		// 埋蔵金が存在しなかったらtrueを返す
 		if (buriedTreasureBlocks.empty())
 		{
 			return true;
@@ -248,7 +261,7 @@ public:
 
 		for (CBuriedTreasureBlock* treasure : buriedTreasureBlocks)
 		{
-			// 擾
+			// 埋蔵金を取得したか
 			if (treasure->IsGet())
 			{
 				return true;
@@ -259,14 +272,14 @@ public:
 	}
 
 private:
-	static constexpr float TRIGGER_DISTACE = 120.0f;	// 苗
+	static constexpr float TRIGGER_DISTACE = 120.0f;	// 判定距離
 
-	bool m_isEscape;									// Eoǂ
-	bool m_isIn;										// ͈͓tO
+	bool m_isEscape;									// 脱出したかどうか
+	bool m_isIn;										// 範囲内フラグ
 };
 
 //*****************************************************************************
-// ubNNX
+// 門ブロッククラス
 //*****************************************************************************
 class CGateBlock : public CBlock
 {
@@ -280,11 +293,11 @@ public:
 	{
 		CBlock::LoadFromJson(b);
 
-		// px m_rotY ɓxŕۑ
-		D3DXVECTOR3 rot = GetRot();             // WA
-		m_baseRotY = D3DXToDegree(rot.y);       // xɕϊĊpx
+		// 初期角度を m_rotY に度数で保存
+		D3DXVECTOR3 rot = GetRot();             // ラジアン
+		m_baseRotY = D3DXToDegree(rot.y);       // 度に変換して基準角度
 
-		// Jnʒuۑ
+		// 開始位置を保存
 		m_startPosX = GetPos().x;
 	}
 
@@ -293,30 +306,30 @@ public:
 	void MovieGateUpdate(void);
 
 private:
-	static constexpr int   MAX_STEP				= 6;		// ړiK
-	static constexpr float MOVE_UNIT			= 44.0f;	// ړ
-	static constexpr float DELAY_TIME			= 780.0f;	// x
-	static constexpr float SHAKE_POWER			= 1.5f;		// hꕝ
-	static constexpr float SHAKE_SPEED			= 20.0f;	// hׂ̍
-	static constexpr float SHAKE_DURATION		= 120.0f;	// h鎞
-	static constexpr float PRE_SHAKE_RANGE		= 0.02f;	// \hꋫE(`%Oh炷)
-	static constexpr float SIDE_OFFSET			= 30.0f;	// p[eBNʒuItZbg
-	static constexpr float CLOSE_DURATION		= 20.0f;	// t[
-	static constexpr float SPAWN_OFFPOS			= 60.0f;	// ItZbgʒu
-
-	float m_baseRotY;										// ̊px
-	float m_startPosX;										// Jnʒu
-	float m_movieTime;										// ړ
-	int   m_prevStep ;										// O̒iK
-	bool  m_bClosing;										// Ă邩
-	float m_closeTimer;										// ^C}[
-	float m_fromX;											// ړJnʒu
-	float m_toX;											// ړBʒu
+	static constexpr int   MAX_STEP				= 6;		// 移動する段階数
+	static constexpr float MOVE_UNIT			= 44.0f;	// 移動距離
+	static constexpr float DELAY_TIME			= 780.0f;	// 遅延時間
+	static constexpr float SHAKE_POWER			= 1.5f;		// 揺れ幅
+	static constexpr float SHAKE_SPEED			= 20.0f;	// 揺れの細かさ
+	static constexpr float SHAKE_DURATION		= 120.0f;	// 揺れる時間
+	static constexpr float PRE_SHAKE_RANGE		= 0.02f;	// 予兆揺れ境界(～%手前から揺らす)
+	static constexpr float SIDE_OFFSET			= 30.0f;	// 埃パーティクル生成位置オフセット
+	static constexpr float CLOSE_DURATION		= 20.0f;	// 閉じるフレーム数
+	static constexpr float SPAWN_OFFPOS			= 60.0f;	// 生成オフセット位置
+
+	float m_baseRotY;										// 基準の角度
+	float m_startPosX;										// 開始位置
+	float m_movieTime;										// 移動時間
+	int   m_prevStep ;										// 直前の段階数
+	bool  m_bClosing;										// 閉じているか
+	float m_closeTimer;										// タイマー
+	float m_fromX;											// 移動開始位置
+	float m_toX;											// 移動到達位置
 
 };
 
 //*****************************************************************************
-// MAubNNX
+// ギアブロッククラス
 //*****************************************************************************
 class CGearBlock : public CBlock
 {
@@ -331,11 +344,11 @@ public:
 	void MovieGearUpdate(void);
 
 private:
-	static constexpr float ROT_SPEED	= 0.05f;	// ]Xs[h
-	static constexpr int DELAY_TIME		= 660;		// ]܂ł̒x
+	static constexpr float ROT_SPEED	= 0.05f;	// 回転スピード
+	static constexpr int DELAY_TIME		= 660;		// 回転までの遅延時間
 
-	int	 m_turnTimer;								// ]܂ł̎ԃJE^[
-	bool m_prevTimeEnd;								// ^C}[0ɂȂ
+	int	 m_turnTimer;								// 回転までの時間カウンター
+	bool m_prevTimeEnd;								// タイマーが0になったか
 };
 
 #endif
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// ubN}l[W[ [blockmanager.cpp]
+// ブロックマネージャー処理 [blockmanager.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "blockmanager.h"
 #include "json.hpp"
@@ -19,43 +19,60 @@
 #include "grass.h"
 #include "player.h"
 #include "tutorial.h"
+#include "assetloader.h"
+#include "meshcooker.h"
 
-// JSON̎gp
+// JSONの使用
 using json = nlohmann::json;
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-std::vector<CBlock*> CBlockManager::m_blocks = {};	// ubN̏
+std::vector<CBlock*> CBlockManager::m_blocks = {};	// ブロックの情報
 std::unordered_map<CBlock::TYPE, std::vector<CBlock*>> CBlockManager::m_blocksByType;
-int CBlockManager::m_selectedIdx = 0;				// I𒆂̃CfbNX
-CBlock* CBlockManager::m_draggingBlock = {};		// hbÕubN
+std::vector<CBlock*> CBlockManager::m_emitters = {};	// ライトを出すブロック
+unsigned int CBlockManager::m_nLightGeneration = 0;		// ライトを更新した時のライトの世代
+float CBlockManager::m_fLightProgress = -1.0f;			// ライトを更新した時の時間の割合
+bool CBlockManager::m_bEmittersDirty = false;			// ライトを出すブロックが増減したか
+int CBlockManager::m_selectedIdx = 0;				// 選択中のインデックス
+CBlock* CBlockManager::m_draggingBlock = {};		// ドラッグ中のブロック
 std::unordered_map<CBlock::TYPE, std::string> CBlockManager::s_FilePathMap; 
-CBlock* CBlockManager::m_selectedBlock = {};// IubN
+CBlock* CBlockManager::m_selectedBlock = {};// 選択したブロック
+CBlockInstancer CBlockManager::m_instancer;	// 静的ブロックのインスタンス描画
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CBlockManager::CBlockManager()
 {
-	// l̃NA
-	m_selectedBlock				= nullptr;		// I𒆂̃ubN
-	m_prevSelectedIdx			= -1;			// ȎI𒆂̃CfbNX
-	m_pDebug3D					= nullptr;		// 3DfobO\ւ̃|C^
-	m_autoUpdateColliderSize	= true;			// RC_[XVtO
-	m_isDragging				= false;		// hbOǂ
-	m_thumbWidth				= THUMB_WIDTH;	// TlC̕
-	m_thumbHeight				= THUMB_HEIGHT;	// TlC̍
+	// 値のクリア
+	m_selectedBlock				= nullptr;		// 選択中のブロック
+	m_prevSelectedIdx			= -1;			// 前回の選択中のインデックス
+	m_pDebug3D					= nullptr;		// 3Dデバッグ表示へのポインタ
+	m_autoUpdateColliderSize	= true;			// コライダー自動更新フラグ
+	m_isDragging				= false;		// ドラッグ中かどうか
+	m_thumbWidth				= THUMB_WIDTH;	// サムネイルの幅
+	m_thumbHeight				= THUMB_HEIGHT;	// サムネイルの高さ
+
+	// サムネイルの描き方(キャッシュの鍵にも使う)
+	m_thumbParam.nWidth		= (int)THUMB_WIDTH;							// 幅
+	m_thumbParam.nHeight	= (int)THUMB_HEIGHT;						// 高さ
+	m_thumbParam.eye		= D3DXVECTOR3(-120.0f, 100.0f, -120.0f);	// 視点
+	m_thumbParam.at			= D3DXVECTOR3(0.0f, 0.0f, 0.0f);			// 注視点
+	m_thumbParam.fFov		= 60.0f;									// 視野角
+	m_thumbParam.fNear		= 1.0f;										// 近クリップ面
+	m_thumbParam.fFar		= 1000.0f;									// 遠クリップ面
+	m_thumbParam.clearCol	= D3DCOLOR_XRGB(50, 50, 50);				// 背景色
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CBlockManager::~CBlockManager()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CBlock* CBlockManager::CreateBlock(CBlock::TYPE type, D3DXVECTOR3 pos)
 {
@@ -65,36 +82,51 @@ CBlock* CBlockManager::CreateBlock(CBlock::TYPE type, D3DXVECTOR3 pos)
 
 	if (newBlock)
 	{
-		// Ŝ̃Xgɒǉ
+		// 全体のリストに追加
 		m_blocks.push_back(newBlock);
 
-		// ^CvʃLbVɂǉ
+		// タイプ別キャッシュにも追加
 		m_blocksByType[type].push_back(newBlock);
+
+		// ライトを出すブロックは別に持っておく
+		if (newBlock->IsLightEmitter())
+		{
+			m_emitters.push_back(newBlock);
+			m_bEmittersDirty = true;
+		}
+
+		// インスタンス描画のまとめ直し
+		m_instancer.MarkDirty();
 	}
 
 	return newBlock;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 void CBlockManager::Init(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
 	InitThumbnailRenderTarget(pDevice);
 
+	// インスタンス描画の初期化(使えない環境では通常描画になる)
+	m_instancer.Init();
+
 	LoadConfig("data/model_list.json");
 
-	// TlCLbV쐬
+	// サムネイルキャッシュ作成
 	GenerateThumbnailsForResources();
 
-	// Izɂ (TCY0ɂ)
+	// 動的配列を空にする (サイズを0にする)
 	m_blocks.clear();
 	m_blocksByType.clear();
+	m_emitters.clear();
+	m_bEmittersDirty = true;
 }
 //=============================================================================
-// TlC̃_[^[Qbg̏
+// サムネイルのレンダーターゲットの初期化
 //=============================================================================
 HRESULT CBlockManager::InitThumbnailRenderTarget(LPDIRECT3DDEVICE9 device)
 {
@@ -103,7 +135,7 @@ HRESULT CBlockManager::InitThumbnailRenderTarget(LPDIRECT3DDEVICE9 device)
 		return E_FAIL;
 	}
 
-	// TlCp_[^[QbgeNX`̍쐬
+	// サムネイル用レンダーターゲットテクスチャの作成
 	if (FAILED(device->CreateTexture(
 		(UINT)m_thumbWidth, (UINT)m_thumbHeight,
 		1, D3DUSAGE_RENDERTARGET,
@@ -114,7 +146,7 @@ HRESULT CBlockManager::InitThumbnailRenderTarget(LPDIRECT3DDEVICE9 device)
 		return E_FAIL;
 	}
 
-	// TlCp[xXeVT[tFX̍쐬
+	// サムネイル用深度ステンシルサーフェスの作成
 	if (FAILED(device->CreateDepthStencilSurface(
 		(UINT)m_thumbWidth, (UINT)m_thumbHeight,
 		D3DFMT_D24S8,
@@ -127,7 +159,7 @@ HRESULT CBlockManager::InitThumbnailRenderTarget(LPDIRECT3DDEVICE9 device)
 	return S_OK;
 }
 //=============================================================================
-// TlC̃_[^[Qbg̐ݒ
+// サムネイルのレンダーターゲットの設定
 //=============================================================================
 IDirect3DTexture9* CBlockManager::RenderThumbnail(CBlock* pBlock)
 {
@@ -136,7 +168,7 @@ IDirect3DTexture9* CBlockManager::RenderThumbnail(CBlock* pBlock)
 		return nullptr;
 	}
 
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
 	if (!pDevice)
@@ -144,7 +176,7 @@ IDirect3DTexture9* CBlockManager::RenderThumbnail(CBlock* pBlock)
 		return nullptr;
 	}
 
-	// TlC`p̐VKeNX`쐬
+	// サムネイル描画用の新規テクスチャ作成
 	IDirect3DTexture9* pTex = nullptr;
 	if (FAILED(pDevice->CreateTexture(
 		(UINT)m_thumbWidth, (UINT)m_thumbHeight, 1,
@@ -154,7 +186,7 @@ IDirect3DTexture9* CBlockManager::RenderThumbnail(CBlock* pBlock)
 		return nullptr;
 	}
 
-	// ݂̃_[^[QbgƐ[xobt@ۑ
+	// 現在のレンダーターゲットと深度バッファを保存
 	LPDIRECT3DSURFACE9 pOldRT = nullptr;
 	LPDIRECT3DSURFACE9 pOldZ = nullptr;
 	LPDIRECT3DSURFACE9 pNewRT = nullptr;
@@ -163,57 +195,58 @@ IDirect3DTexture9* CBlockManager::RenderThumbnail(CBlock* pBlock)
 	pDevice->GetDepthStencilSurface(&pOldZ);
 	pTex->GetSurfaceLevel(0, &pNewRT);
 
-	// TlCp̃_[^[Qbgɐ؂ւ
+	// サムネイル用のレンダーターゲットに切り替え
 	pDevice->SetRenderTarget(0, pNewRT);
 	pDevice->SetDepthStencilSurface(m_pThumbnailZ);
 
-	// NA
-	pDevice->Clear(0, nullptr, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER, D3DCOLOR_XRGB(50, 50, 50), 1.0f, 0);
+	// クリア
+	pDevice->Clear(0, nullptr, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER, m_thumbParam.clearCol, 1.0f, 0);
 	pDevice->BeginScene();
 
-	// ŒJ
-	D3DXVECTOR3 eye(-120.0f, 100.0f, -120.0f), at(0.0f, 0.0f, 0.0f), up(0.0f, 1.0f, 0.0f);
+	// 固定カメラ
+	D3DXVECTOR3 up(0.0f, 1.0f, 0.0f);
 	D3DXMATRIX matView, matProj;
-	D3DXMatrixLookAtLH(&matView, &eye, &at, &up);
+	D3DXMatrixLookAtLH(&matView, &m_thumbParam.eye, &m_thumbParam.at, &up);
 
-	// vWFNV}gbNX̍쐬
+	// プロジェクションマトリックスの作成
 	D3DXMatrixPerspectiveFovLH(&matProj,
-		D3DXToRadian(60.0f),						// p
-		m_thumbWidth / m_thumbHeight,				// AXyNg
-		1.0f,										// ߃Nbv
-		1000.0f);									// Nbv
+		D3DXToRadian(m_thumbParam.fFov),			// 視野角
+		m_thumbWidth / m_thumbHeight,				// アスペクト比
+		m_thumbParam.fNear,							// 近クリップ面
+		m_thumbParam.fFar);							// 遠クリップ面
 
 	pDevice->SetTransform(D3DTS_VIEW, &matView);
 	pDevice->SetTransform(D3DTS_PROJECTION, &matProj);
 
-	// --- Cg̃obNAbv ---
+	// --- ライトのバックアップ ---
 	auto backup = CLight::GetCurrentLights();
 
-	// ̃Cg𖳌
+	// 既存のライトを無効化
 	CLight::Uninit();
 
-	// Cg̏ݒ菈
+	// ライトの初期設定処理
 	CLight::AddLight(D3DLIGHT_DIRECTIONAL, D3DXCOLOR(0.9f, 0.9f, 0.9f, 1.0f), D3DXVECTOR3(0.0f, -1.0f, 0.0f), D3DXVECTOR3(0.0f, 300.0f, 0.0f));
 	CLight::AddLight(D3DLIGHT_DIRECTIONAL, D3DXCOLOR(0.3f, 0.3f, 0.3f, 1.0f), D3DXVECTOR3(0.0f, 1.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 	CLight::AddLight(D3DLIGHT_DIRECTIONAL, D3DXCOLOR(0.7f, 0.7f, 0.7f, 1.0f), D3DXVECTOR3(1.0f, 0.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 	CLight::AddLight(D3DLIGHT_DIRECTIONAL, D3DXCOLOR(0.7f, 0.7f, 0.7f, 1.0f), D3DXVECTOR3(-1.0f, 0.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 	CLight::AddLight(D3DLIGHT_DIRECTIONAL, D3DXCOLOR(0.7f, 0.7f, 0.7f, 1.0f), D3DXVECTOR3(0.0f, 0.0f, 1.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 	CLight::AddLight(D3DLIGHT_DIRECTIONAL, D3DXCOLOR(0.7f, 0.7f, 0.7f, 1.0f), D3DXVECTOR3(0.0f, 0.0f, -1.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+	CLight::Apply(INIT_VEC3);
 
-	// TlCpf`
-	pBlock->Draw();
+	// サムネイル用モデル描画(別のレンダーターゲットなのでキューを通さない)
+	pBlock->DrawImmediate();
 
-	// --- ̃Cg𕜌 ---
+	// --- 元のライトを復元 ---
 	CLight::RestoreLights(backup);
 
-	// `I
+	// 描画終了
 	pDevice->EndScene();
 
-	// ̃_[^[QbgƐ[xobt@ɖ߂
+	// 元のレンダーターゲットと深度バッファに戻す
 	pDevice->SetRenderTarget(0, pOldRT);
 	pDevice->SetDepthStencilSurface(pOldZ);
 
-	// j
+	// 破棄
 	if (pOldRT) pOldRT->Release();
 	if (pOldZ)  pOldZ->Release();
 	if (pNewRT) pNewRT->Release();
@@ -221,11 +254,11 @@ IDirect3DTexture9* CBlockManager::RenderThumbnail(CBlock* pBlock)
 	return pTex;
 }
 //=============================================================================
-// TlCp̃f
+// サムネイル用のモデル生成処理(キャッシュが使えるものは読み込み、残りはUpdateThumbnailsで1つずつ作る)
 //=============================================================================
 void CBlockManager::GenerateThumbnailsForResources(void)
 {
-	// TlC
+	// 既存サムネイルを解放
 	for (auto tex : m_thumbnailTextures)
 	{
 		if (tex)
@@ -237,28 +270,80 @@ void CBlockManager::GenerateThumbnailsForResources(void)
 	m_thumbnailTextures.clear();
 	m_thumbnailTextures.resize((size_t)CBlock::TYPE_MAX, nullptr);
 
-	for (size_t nCnt = 0; nCnt < (int)CBlock::TYPE_MAX; ++nCnt)
+	m_thumbnailKeys.assign((size_t)CBlock::TYPE_MAX, CThumbnailCache::Key());
+	m_thumbnailKeyValid.assign((size_t)CBlock::TYPE_MAX, false);
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	for (int nCnt = 0; nCnt < (int)CBlock::TYPE_MAX; nCnt++)
 	{
-		// ꎞubNiʒu͌_j
-		CBlock::TYPE payloadType = static_cast<CBlock::TYPE>(nCnt);
-		CBlock* pTemp = CreateBlock(payloadType, D3DXVECTOR3(0, 0, 0));
-		if (!pTemp)
+		const char* path = GetFilePathFromType(static_cast<CBlock::TYPE>(nCnt));
+
+		// モデルファイルのハッシュと描き方を鍵にする
+		if (!CThumbnailCache::MakeKey(path, m_thumbParam, &m_thumbnailKeys[nCnt]))
 		{
 			continue;
 		}
 
-		if (!m_thumbnailTextures[nCnt])
+		m_thumbnailKeyValid[nCnt] = true;
+
+		// 変わっていなければ描かずにキャッシュを使う
+		m_thumbnailTextures[nCnt] = CThumbnailCache::Load(pDevice, path, m_thumbnailKeys[nCnt]);
+	}
+
+	m_nNextThumbnail = 0;
+}
+//=============================================================================
+// サムネイルの作成処理(最初のフレームを止めないよう1フレームに1つだけ作る)
+//=============================================================================
+void CBlockManager::UpdateThumbnails(void)
+{
+	// キャッシュから読めたものは飛ばす
+	while (m_nNextThumbnail < (int)m_thumbnailTextures.size() && m_thumbnailTextures[m_nNextThumbnail])
+	{
+		m_nNextThumbnail++;
+	}
+
+	if (m_nNextThumbnail >= (int)m_thumbnailTextures.size())
+	{
+		return;
+	}
+
+	int nCnt = m_nNextThumbnail++;
+
+	// サムネイルはすぐに描くので、テクスチャは待ってでもその場で作る
+	CManager::GetTexture()->SetAsync(false);
+
+	// 一時ブロック生成（位置は原点）
+	CBlock::TYPE payloadType = static_cast<CBlock::TYPE>(nCnt);
+	CBlock* pTemp = CreateBlock(payloadType, D3DXVECTOR3(0, 0, 0));
+
+	CManager::GetTexture()->SetAsync(true);
+
+	if (!pTemp)
+	{
+		return;
+	}
+
+	if (!m_thumbnailTextures[nCnt])
+	{
+		// サムネイル作成
+		m_thumbnailTextures[nCnt] = RenderThumbnail(pTemp);
+
+		// 次の起動からは描かずに済むようにキャッシュへ書き出す
+		if (m_thumbnailTextures[nCnt] && m_thumbnailKeyValid[nCnt])
 		{
-			// TlC쐬
-			m_thumbnailTextures[nCnt] = RenderThumbnail(pTemp);
+			CThumbnailCache::Save(CManager::GetRenderer()->GetDevice(), m_thumbnailTextures[nCnt],
+				GetFilePathFromType(payloadType), m_thumbnailKeys[nCnt]);
 		}
-
-		pTemp->Kill();                 // 폜tO𗧂Ă
-		CleanupDeadBlocks();           // z񂩂菜A
 	}
+
+	pTemp->Kill();                 // 削除フラグを立てる
+	CleanupDeadBlocks();           // 配列から取り除き、メモリ解放
 }
 //=============================================================================
-// TlCeNX`̎擾
+// サムネイルテクスチャの取得
 //=============================================================================
 IDirect3DTexture9* CBlockManager::GetThumbnailTexture(size_t index)
 {
@@ -266,11 +351,11 @@ IDirect3DTexture9* CBlockManager::GetThumbnailTexture(size_t index)
 	return m_thumbnailTextures[index];
 }
 //=============================================================================
-// TlC̔j
+// サムネイルの破棄
 //=============================================================================
 void CBlockManager::ReleaseThumbnailRenderTarget(void)
 {
-	// _[^[Qbg̔j
+	// レンダーターゲットの破棄
 	if (m_pThumbnailRT)
 	{
 		m_pThumbnailRT->Release();
@@ -283,7 +368,7 @@ void CBlockManager::ReleaseThumbnailRenderTarget(void)
 		m_pThumbnailZ = nullptr;
 	}
 
-	// TlCLbVĂ
+	// サムネイルキャッシュも解放しておく
 	for (auto& tex : m_thumbnailTextures)
 	{
 		if (tex)
@@ -296,19 +381,88 @@ void CBlockManager::ReleaseThumbnailRenderTarget(void)
 	m_thumbnailsGenerated = false;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CBlockManager::Uninit(void)
 {
-	// TlC̔j
+	// サムネイルの破棄
 	ReleaseThumbnailRenderTarget();
 
-	// Izɂ (TCY0ɂ)
+	// インスタンス描画の終了処理
+	m_instancer.Uninit();
+
+	// ライトの登録解除
+	ClearEmitters();
+
+	// 動的配列を空にする (サイズを0にする)
 	m_blocks.clear();
 	m_blocksByType.clear();
 }
 //=============================================================================
-// 폜\񂪂ubN̍폜
+// ライトの更新処理(ライトを出すブロックだけを、時間が進んだ時だけ回す)
+//=============================================================================
+void CBlockManager::UpdateLight(void)
+{
+	// 時間の割合はここで1回だけ求める
+	float fProgress = 0.0f;
+
+	if (CManager::GetMode() == CScene::MODE_TUTORIAL)
+	{
+		fProgress = CTutorial::GetTime()->GetProgress();
+	}
+	else if (CManager::GetMode() == CScene::MODE_GAME)
+	{
+		fProgress = CGame::GetTime()->GetProgress();
+	}
+
+	// ライトが作り直されず、ブロックも増減せず、時間もほぼ進んでいなければ何もしない
+	if (!m_bEmittersDirty &&
+		m_nLightGeneration == CLight::GetGeneration() &&
+		fabsf(fProgress - m_fLightProgress) < LIGHT_PROGRESS_STEP)
+	{
+		return;
+	}
+
+	for (CBlock* pBlock : m_emitters)
+	{
+		pBlock->UpdateLight(fProgress);
+	}
+
+	m_nLightGeneration = CLight::GetGeneration();
+	m_fLightProgress = fProgress;
+	m_bEmittersDirty = false;
+}
+//=============================================================================
+// ライトを出すブロックの削除処理
+//=============================================================================
+void CBlockManager::RemoveEmitter(CBlock* pBlock)
+{
+	auto it = std::find(m_emitters.begin(), m_emitters.end(), pBlock);
+
+	if (it == m_emitters.end())
+	{
+		return;
+	}
+
+	(*it)->ReleaseLight();
+	m_emitters.erase(it);
+	m_bEmittersDirty = true;
+}
+//=============================================================================
+// ライトを出すブロックを全て削除する処理
+//=============================================================================
+void CBlockManager::ClearEmitters(void)
+{
+	for (CBlock* pBlock : m_emitters)
+	{
+		pBlock->ReleaseLight();
+	}
+
+	m_emitters.clear();
+	m_bEmittersDirty = true;
+}
+//=============================================================================
+// 削除予約があるブロックの削除処理
 //=============================================================================
 void CBlockManager::CleanupDeadBlocks(void)
 {
@@ -318,128 +472,147 @@ void CBlockManager::CleanupDeadBlocks(void)
 
 		if (m_blocks[nCnt]->IsDead())
 		{
-			// m_blocksByType폜
+			// m_blocksByTypeからも削除
 			auto& list = m_blocksByType[pBlock->GetType()];
 			list.erase(std::remove(list.begin(), list.end(), pBlock), list.end());
 
-			// ubN̏I
+			// ライトを出すブロックからも削除
+			RemoveEmitter(pBlock);
+
+			// ブロックの終了処理
 			m_blocks[nCnt]->Uninit();
 			m_blocks.erase(m_blocks.begin() + nCnt);
+
+			// インスタンス描画のまとめ直し
+			m_instancer.MarkDirty();
 		}
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CBlockManager::Update(void)
 {
 
 #ifdef _DEBUG
 
-	// ̍XV
+	// サムネイルの作成
+	UpdateThumbnails();
+
+	// 情報の更新
 	UpdateInfo();
 
 #endif
-	// ubN폜
+	// ブロック削除処理
 	CleanupDeadBlocks();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CBlockManager::Draw(void)
 {
 #ifdef _DEBUG
-	//// I𒆂̃ubNRC_[`
-	//CBlock* pSelectBlock = GetSelectedBlock();
-	//if (pSelectBlock != nullptr)
-	//{
-	//	pSelectBlock->DrawCollider();
-	//}
+	// 線は積むだけなので全ブロックのコライダーを描いても重くならない
+	if (CDebugProc3D::IsVisible(CDebugProc3D::CATEGORY_BLOCK))
+	{
+		for (CBlock* pBlock : m_blocks)
+		{
+			pBlock->DrawCollider();
+		}
+	}
 #endif
 }
 //=============================================================================
-// ̍XV
+// インスタンス描画処理
+//=============================================================================
+void CBlockManager::DrawInstances(void)
+{
+	// 同じモデルの静的ブロックをまとめて描画
+	m_instancer.Draw(m_blocks);
+}
+//=============================================================================
+// 情報の更新処理
 //=============================================================================
 void CBlockManager::UpdateInfo(void)
 {
-	// GUIX^C̎擾
+	// GUIスタイルの取得
 	ImGuiStyle& style = ImGui::GetStyle();
 
-	style.GrabRounding		= 10.0f;		// XC_[̂܂݂ۂ
-	style.ScrollbarRounding = 10.0f;		// XN[o[̊p
-	style.ChildRounding		= 10.0f;		// qEBhE̊p
-	style.WindowRounding	= 10.0f;		// EBhEŜ̊p
+	style.GrabRounding		= 10.0f;		// スライダーのつまみを丸く
+	style.ScrollbarRounding = 10.0f;		// スクロールバーの角
+	style.ChildRounding		= 10.0f;		// 子ウィンドウの角
+	style.WindowRounding	= 10.0f;		// ウィンドウ全体の角
 
-	// ꏊ
+	// 場所
 	CImGuiManager::Instance().SetPosImgui(ImVec2(1900.0f, 20.0f));
 
-	// TCY
+	// サイズ
 	CImGuiManager::Instance().SetSizeImgui(ImVec2(420.0f, 500.0f));
 
-	// ŏGUI
+	// 最初のGUI
 	CImGuiManager::Instance().StartImgui(u8"BlockInfo", CImGuiManager::IMGUITYPE_DEFOULT);
 
-	// ubNȂꍇ
+	// ブロックがない場合
 	if (m_blocks.empty())
 	{
 		ImGui::Text("No blocks placed yet.");
 	}
 	else
 	{
-		// ubN̑
+		// ブロックの総数
 		ImGui::Text("Block Num %d", (int)m_blocks.size());
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// CfbNXI
+		// インデックス選択
 		ImGui::SliderInt("Block Index", &m_selectedIdx, 0, (int)m_blocks.size() - 1);
 
-		// ͈͊O΍
+		// 範囲外対策
 		if (m_selectedIdx >= (int)m_blocks.size())
 		{
 			m_selectedIdx = (int)m_blocks.size() - 1;
 		}
 
-		// OIłubN
+		// 前回選んでたブロックを解除
 		if (m_prevSelectedIdx != -1 && m_prevSelectedIdx != m_selectedIdx)
 		{
 			m_blocks[m_prevSelectedIdx]->SetSelected(false);
 		}
 
-		// ΏۃubN̎擾
+		// 対象ブロックの取得
 		m_selectedBlock = m_blocks[m_selectedIdx];
 
-		// ubN̒
+		// ブロック情報の調整処理
 		UpdateTransform(m_selectedBlock);
 
 		if (GetUpdateCollider() == false)
 		{
-			// RC_[̒
+			// コライダーの調整処理
 			UpdateCollider(m_selectedBlock);
 		}
 		else
 		{
-			ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+			ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 			ImGui::Text("Auto Update Collider Size is Active");
 		}
 	}
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-	// ubN^Cvꗗ
+	// ブロックタイプ一覧
 	if (ImGui::TreeNode("Block Types"))
 	{
-		ImGui::BeginChild("BlockTypeList", ImVec2(0, 500), true); // XN[̈
+		ImGui::BeginChild("BlockTypeList", ImVec2(0, 500), true); // スクロール領域
 
 		int numTypes = (int)CBlock::TYPE_MAX;
 
 		for (int nCnt = 0; nCnt < numTypes; nCnt++)
 		{
-			IDirect3DTexture9* pThumb = GetThumbnailTexture(nCnt); // TlC擾
+			IDirect3DTexture9* pThumb = GetThumbnailTexture(nCnt); // サムネイル取得
 
 			if (!pThumb)
 			{
-				continue; // nullptr ̓XLbv
+				continue; // nullptr はスキップ
 			}
 
 			ImGui::PushID(nCnt);
@@ -447,7 +620,7 @@ void CBlockManager::UpdateInfo(void)
 
 			if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_SourceAllowNullID))
 			{
-				m_isDragging = true;// hbO
+				m_isDragging = true;// ドラッグ中
 				CBlock::TYPE payloadType = static_cast<CBlock::TYPE>(nCnt);
 				ImGui::SetDragDropPayload("BLOCK_TYPE", &payloadType, sizeof(payloadType));
 				ImGui::Text("Block Type %d", nCnt);
@@ -455,17 +628,17 @@ void CBlockManager::UpdateInfo(void)
 				ImGui::EndDragDropSource();
 			}
 
-			// }EX̎擾
+			// マウスの取得
 			CInputMouse* pMouse = CManager::GetInputMouse();
 
 			if (ImGui::IsMouseReleased(ImGuiMouseButton_Left) && m_isDragging)
 			{
-				// ݂ImGui̓ԁiReLXgjւ̃|C^[擾
+				// 現在のImGuiの内部状態（コンテキスト）へのポインターを取得
 				ImGuiContext* ctx = ImGui::GetCurrentContext();
 
 				if (ctx->DragDropPayload.IsDataType("BLOCK_TYPE"))
 				{
-					// hbO
+					// ドラッグ中を解除
 					m_isDragging = false;
 
 					CBlock::TYPE draggedType = *(CBlock::TYPE*)ctx->DragDropPayload.Data;
@@ -473,30 +646,30 @@ void CBlockManager::UpdateInfo(void)
 					D3DXVECTOR3 pos = pMouse->GetGroundHitPosition();
 					pos.y = 30.0f;
 
-					// ubN̐
+					// ブロックの生成
 					m_draggingBlock = CreateBlock(draggedType, pos);
 				}
 			}
 
 			ImGui::PopID();
 
-			ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 摜Ԃ̗]
+			ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 画像間の余白
 		}
 
 		ImGui::EndChild();
 		ImGui::TreePop();
 	}
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 	if (ImGui::Button("Save"))
 	{
-		// _CAOJăt@Cɕۑ
+		// ダイアログを開いてファイルに保存
 		std::string path = OpenWindowsSaveFileDialog();
 
 		if (!path.empty())
 		{
-			// f[^̕ۑ
+			// データの保存
 			CBlockManager::SaveToJson(path.c_str());
 		}
 	}
@@ -505,12 +678,12 @@ void CBlockManager::UpdateInfo(void)
 
 	if (ImGui::Button("Load"))
 	{
-		// _CAOJăt@CJ
+		// ダイアログを開いてファイルを開く
 		std::string path = OpenWindowsOpenFileDialog();
 
 		if (!path.empty())
 		{
-			// f[^̓ǂݍ
+			// データの読み込み
 			CBlockManager::LoadFromJson(path.c_str());
 		}
 	}
@@ -522,25 +695,25 @@ void CBlockManager::UpdateInfo(void)
 		return;
 	}
 
-	// }EXI
+	// マウス選択処理
 	PickBlockFromMouseClick();
 }
 //=============================================================================
-// ubN̒
+// ブロック情報の調整処理
 //=============================================================================
 void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 {
 	if (selectedBlock)
 	{
-		// I𒆂̃ubN̐Fς
+		// 選択中のブロックの色を変える
 		selectedBlock->SetSelected(true);
 
-		D3DXVECTOR3 pos = selectedBlock->GetPos();	// I𒆂̃ubN̈ʒu̎擾
-		D3DXVECTOR3 rot = selectedBlock->GetRot();	// I𒆂̃ubŇ̎擾
-		D3DXVECTOR3 size = selectedBlock->GetSize();// I𒆂̃ubÑTCY̎擾
-		btScalar mass = selectedBlock->GetMass();	// I𒆂̃ubN̎ʂ̎擾
+		D3DXVECTOR3 pos = selectedBlock->GetPos();	// 選択中のブロックの位置の取得
+		D3DXVECTOR3 rot = selectedBlock->GetRot();	// 選択中のブロックの向きの取得
+		D3DXVECTOR3 size = selectedBlock->GetSize();// 選択中のブロックのサイズの取得
+		btScalar mass = selectedBlock->GetMass();	// 選択中のブロックの質量の取得
 
-		// WApxɈꎞϊiÓIϐŕێ쒆̂ݍXVj
+		// ラジアン→角度に一時変換（静的変数で保持し操作中のみ更新）
 		static D3DXVECTOR3 degRot = D3DXToDegree(rot);
 		static bool m_initializedDegRot = false;
 
@@ -556,21 +729,21 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 
 		if (isEditMode)
 		{
-			selectedBlock->SetEditMode(true);  // `FbNKinematic
+			selectedBlock->SetEditMode(true);  // チェックでKinematic化
 		}
 		else
 		{
-			selectedBlock->SetEditMode(false); // ʏɖ߂
+			selectedBlock->SetEditMode(false); // 通常に戻す
 		}
 
 		//*********************************************************************
-		// POS ̒
+		// POS の調整
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// x
-		ImGui::Text("POS"); ImGui::SameLine(60); // ẍʒuƒ
+		// ラベル
+		ImGui::Text("POS"); ImGui::SameLine(60); // ラベルの位置ちょっと調整
 
 		// X
 		ImGui::Text("X:"); ImGui::SameLine();
@@ -590,7 +763,7 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 		ImGui::DragFloat("##Block_pos_z", &pos.z, 1.0f, -9000.0f, 9000.0f, "%.1f");
 
 		//*********************************************************************
-		// ROT ̒
+		// ROT の調整
 		//*********************************************************************
 
 		ImGui::Dummy(ImVec2(0.0f, 10.0f));
@@ -614,13 +787,13 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 		bool isRotChanged = changedX || changedY || changedZ;
 		
 		//*********************************************************************
-		// SIZE ̒
+		// SIZE の調整
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// x
-		ImGui::Text("SIZE"); ImGui::SameLine(60); // ẍʒuƒ
+		// ラベル
+		ImGui::Text("SIZE"); ImGui::SameLine(60); // ラベルの位置ちょっと調整
 
 		// X
 		ImGui::Text("X:"); ImGui::SameLine();
@@ -639,57 +812,57 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 		ImGui::SetNextItemWidth(80);
 		ImGui::DragFloat("##Block_size_z", &size.z, 0.1f, -100.0f, 100.0f, "%.1f");
 
-		// `FbN{bNXFg嗦ɉĎXV邩
+		// チェックボックス：拡大率に応じて自動更新するか
 		ImGui::Checkbox("Auto Update Collider Size", &m_autoUpdateColliderSize);
 
-		// ÕTCYێ
+		// 前回のサイズを保持
 		static D3DXVECTOR3 prevSize = selectedBlock->GetSize();
 
-		// TCYύX`FbN
+		// サイズ変更チェック
 		bool isSizeChanged = (size != prevSize);
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// ubN̓ꏈ
+		// ブロックの特殊処理
 		selectedBlock->DrawCustomUI();
 
 		//*********************************************************************
-		//  ̒
+		// 質量 の調整
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// x
-		ImGui::Text("MASS"); ImGui::SameLine(60); // ẍʒuƒ
+		// ラベル
+		ImGui::Text("MASS"); ImGui::SameLine(60); // ラベルの位置ちょっと調整
 
-		// XC_[i͈: 0.0f ` 80.0fj
+		// スライダー（範囲: 0.0f ～ 80.0f）
 		ImGui::SliderFloat("##MassSlider", &mass, 0.0f, 80.0f, "%.2f");
 
 
-		// pxWAɖ߂
+		// 角度→ラジアンに戻す
 		D3DXVECTOR3 rotRad = D3DXToRadian(degRot);
 
-		// ʒu̐ݒ
+		// 位置の設定
 		selectedBlock->SetPos(pos);
 
-		// TCY̐ݒ
+		// サイズの設定
 		selectedBlock->SetSize(size);
 
-		// TCY(g嗦)ςƂĂ
+		// サイズ(拡大率)が変わったときだけ呼ぶ
 		if (m_autoUpdateColliderSize == true && isSizeChanged)
 		{
-			// ubNTCYɂRC_[̐
+			// ブロックサイズによるコライダーの生成
 			selectedBlock->CreatePhysicsFromScale(size);
 
-			prevSize = size; // XV
+			prevSize = size; // 更新
 		}
 
 		if (isRotChanged)
 		{
-			// ]ςZbg
+			// 回転が変わった時だけセット
 			selectedBlock->SetRot(rotRad);
 
-			// ҏW[hȂ瑦TransformXVē
+			// 編集モードなら即物理Transformも更新して同期
 			if (isEditMode)
 			{
 				btTransform transform;
@@ -719,12 +892,12 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 		}
 		else
 		{
-			// ҏWĂȂdegRotselectedBlock̒lɓĂ
+			// 編集していない時はdegRotをselectedBlockの値に同期しておく
 			degRot = D3DXToDegree(selectedBlock->GetRot());
 		}
 
 		//*********************************************************************
-		// ubN̍폜
+		// ブロックの削除
 		//*********************************************************************
 
 		ImGui::Dummy(ImVec2(0.0f, 10.0f));
@@ -739,13 +912,16 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 			{
 				if (m_blocks[m_selectedIdx])
 				{
-					// I𒆂̃ubN폜
+					// ライトを出すブロックからも削除
+					RemoveEmitter(m_blocks[m_selectedIdx]);
+
+					// 選択中のブロックを削除
 					m_blocks[m_selectedIdx]->Uninit();
 				}
 
 				m_blocks.erase(m_blocks.begin() + m_selectedIdx);
 
-				// ICfbNX𒲐
+				// 選択インデックスを調整
 				if (m_selectedIdx >= (int)m_blocks.size())
 				{
 					m_selectedIdx = (int)m_blocks.size() - 1;
@@ -754,7 +930,7 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 				m_prevSelectedIdx = -1;
 			}
 			else
-			{// m_autoUpdateColliderSizefalse͉̎Ȃ
+			{// m_autoUpdateColliderSizeがfalseの時は何もしない
 				
 			}
 		}
@@ -762,27 +938,27 @@ void CBlockManager::UpdateTransform(CBlock* selectedBlock)
 		ImGui::PopStyleColor(3);
 	}
 
-	// Ōɕۑ
+	// 最後に保存
 	m_prevSelectedIdx = m_selectedIdx;
 }
 //=============================================================================
-// ubNI
+// ブロック選択処理
 //=============================================================================
 void CBlockManager::PickBlockFromMouseClick(void)
 {
-	// ImGui}EXgĂȂILZ
+	// ImGuiがマウスを使ってるなら選択処理をキャンセル
 	if (ImGui::GetIO().WantCaptureMouse)
 	{
 		return;
 	}
 
-	// NbN̂
+	// 左クリックのみ
 	if (!CManager::GetInputMouse()->GetTrigger(0))
 	{
 		return;
 	}
 
-	// C擾iCRayCastgpj
+	// レイ取得（CRayCastを使用）
 	D3DXVECTOR3 rayOrigin, rayDir;
 	CRayCast::GetMouseRay(rayOrigin, rayDir);
 
@@ -793,7 +969,7 @@ void CBlockManager::PickBlockFromMouseClick(void)
 	{
 		CBlock* block = m_blocks[nCnt];
 
-		// [hs̎擾iʒuE]Eg܂ށj
+		// ワールド行列の取得（位置・回転・拡大を含む）
 		D3DXMATRIX world = block->GetWorldMatrix();
 
 		D3DXVECTOR3 modelSize = block->GetModelSize();
@@ -815,27 +991,27 @@ void CBlockManager::PickBlockFromMouseClick(void)
 		}
 	}
 
-	// IԂ𔽉f
+	// 選択状態を反映
 	if (hitIndex >= 0)
 	{
-		// ȑOI΂ĂubNI
+		// 以前選ばれていたブロックを非選択に
 		if (m_prevSelectedIdx != -1 && m_prevSelectedIdx != hitIndex)
 		{
 			m_blocks[m_prevSelectedIdx]->SetSelected(false);
 		}
 
-		// VI
+		// 新しく選択
 		m_selectedIdx = hitIndex;
 		m_blocks[m_selectedIdx]->SetSelected(true);
 		m_prevSelectedIdx = hitIndex;
 	}
 }
 //=============================================================================
-// RC_[̒
+// コライダーの調整処理
 //=============================================================================
 void CBlockManager::UpdateCollider(CBlock* selectedBlock)
 {
-	// PRC_[p
+	// 単一コライダー用
 	D3DXVECTOR3 colliderSize = selectedBlock->GetColliderSize();
 	static D3DXVECTOR3 prevSize = colliderSize;
 
@@ -902,7 +1078,7 @@ void CBlockManager::UpdateCollider(CBlock* selectedBlock)
 	}
 }
 //=============================================================================
-// Xt@CpX̓ǂݍ
+// Xファイルパスの読み込み
 //=============================================================================
 void CBlockManager::LoadConfig(const std::string& filename)
 {
@@ -915,17 +1091,20 @@ void CBlockManager::LoadConfig(const std::string& filename)
 	json j;
 	ifs >> j;
 
-	// j ͔zɂȂĂ̂Ń[v
+	// j は配列になってるのでループする
 	for (auto& block : j)
 	{
 		int typeInt = block["type"];
 		std::string filepath = block["filepath"];
 
 		s_FilePathMap[(CBlock::TYPE)typeInt] = filepath;
+
+		// 使う前にワーカーで読み込んでおく
+		CAssetLoader::Request(CMeshCooker::ResolvePath(filepath.c_str()).c_str());
 	}
 }
 //=============================================================================
-// ^CvXt@CpX擾
+// タイプからXファイルパスを取得
 //=============================================================================
 const char* CBlockManager::GetFilePathFromType(CBlock::TYPE type)
 {
@@ -933,73 +1112,76 @@ const char* CBlockManager::GetFilePathFromType(CBlock::TYPE type)
 	return (it != s_FilePathMap.end()) ? it->second.c_str() : "";
 }
 //=============================================================================
-// ubN̕ۑ
+// ブロック情報の保存処理
 //=============================================================================
 void CBlockManager::SaveToJson(const char* filename)
 {
-	// JSONIuWFNg
+	// JSONオブジェクト
 	json j;
 
-	// 1ÂJSON
+	// 1つづつJSON化
 	for (const auto& block : m_blocks)
 	{
 		json b;
 		block->SaveToJson(b);
 
-		// ǉ
+		// 追加
 		j.push_back(b);
 	}
 
-	// o̓t@CXg[
+	// 出力ファイルストリーム
 	std::ofstream file(filename);
 
 	if (file.is_open())
 	{
 		file << std::setw(4) << j;
 
-		// t@C
+		// ファイルを閉じる
 		file.close();
 	}
 }
 //=============================================================================
-// ubN̓ǂݍݏ
+// ブロック情報の読み込み処理
 //=============================================================================
 void CBlockManager::LoadFromJson(const char* filename)
 {
 	std::ifstream file(filename);
 
 	if (!file.is_open())
-	{// JȂ
+	{// 開けなかった
 		return;
 	}
 
 	json j;
 	file >> j;
 
-	// t@C
+	// ファイルを閉じる
 	file.close();
 
-	// ̃ubN
+	// ライトの登録解除
+	ClearEmitters();
+
+	// 既存のブロックを消す
 	for (auto block : m_blocks)
 	{
 		if (block != nullptr)
 		{
-			// ubN̏I
+			// ブロックの終了処理
 			block->Uninit();
 		}
 	}
 
-	// Izɂ (TCY0ɂ)
+	// 動的配列を空にする (サイズを0にする)
 	m_blocks.clear();
 	m_blocksByType.clear();
 
-	// Vɐ
+	// 新たに生成
 	for (const auto& b : j)
 	{
 		CBlock::TYPE type = b["type"];
 		D3DXVECTOR3 pos(b["pos"][0], b["pos"][1], b["pos"][2]);
 
-		// ubN̐
+		// ブロックの生成
 		CBlock* block = CreateBlock(type, pos);
 
 		if (!block)
@@ -1009,9 +1191,12 @@ void CBlockManager::LoadFromJson(const char* filename)
 
 		block->LoadFromJson(b);
 	}
+
+	// 前のマップだけで使っていたテクスチャを破棄
+	CManager::GetTexture()->ReleaseUnused();
 }
 //=============================================================================
-// vC[ǂ̑ubNɂĂ邩
+// プレイヤーがどの草ブロックにも入っているか判定
 //=============================================================================
 bool CBlockManager::IsPlayerInGrass(void)
 {
@@ -1034,15 +1219,15 @@ bool CBlockManager::IsPlayerInGrass(void)
 
 		if (dist < distMax)
 		{
-			// ǂꂩ1ł͈͓Ȃ true
+			// どれか1つでも範囲内なら true
 			return true;
 		}
 	}
 
-	return false; // ǂ̑ubNɂĂȂ
+	return false; // どの草ブロックにも入っていない
 }
 //=============================================================================
-// vC[ǂ̓ăubNɂĂ邩
+// プレイヤーがどの灯籠ブロックにも入っているか判定
 //=============================================================================
 bool CBlockManager::IsPlayerInTorch(void)
 {
@@ -1067,10 +1252,10 @@ bool CBlockManager::IsPlayerInTorch(void)
 
 		if (dist < distMax)
 		{
-			// ǂꂩ1ł͈͓Ȃ true
+			// どれか1つでも範囲内なら true
 			return true;
 		}
 	}
 
-	return false; // ǂ̓ăubNɂĂȂ
+	return false; // どの灯籠ブロックにも入っていない
 }
\ No newline at end of file
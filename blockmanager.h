@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// ubN}l[W[ [blockmanager.h]
+// ブロックマネージャー処理 [blockmanager.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,13 +8,16 @@
 #define _BLOCKMANAGER_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "block.h"
+#include "blockinstancer.h"
+#include "memorymanager.h"
+#include "thumbnailcache.h"
 #include "cassert"
 
 //*****************************************************************************
-// ubN}l[W[NX
+// ブロックマネージャークラス
 //*****************************************************************************
 class CBlockManager
 {
@@ -24,41 +27,38 @@ public:
 
     static CBlock* CreateBlock(CBlock::TYPE type, D3DXVECTOR3 pos);
     void Init(void);
-    void Uninit(void);// I
-    void CleanupDeadBlocks(void);// 폜\񂪂ubN̍폜
+    void Uninit(void);// 終了処理
+    void CleanupDeadBlocks(void);// 削除予約があるブロックの削除
     void Update(void);
     void Draw(void);
-    void UpdateInfo(void); // ImGuił̑֐ŌĂԗp
+    static void DrawInstances(void);
+    static void MarkInstancesDirty(void) { m_instancer.MarkDirty(); }
+    void UpdateInfo(void); // ImGuiでの操作関数をここで呼ぶ用
     void SaveToJson(const char* filename);
     void LoadFromJson(const char* filename);
     void LoadConfig(const std::string& filename);
 
-    void UpdateLight(void) 
-    {
-        for (const auto& block : m_blocks)
-        {
-            block->UpdateLight();
-        }
-    }
+    void UpdateLight(void);
 
     //*****************************************************************************
-    // ImGuiTlC`p֐
+    // ImGuiサムネイル描画用関数
     //*****************************************************************************
     void ReleaseThumbnailRenderTarget(void);
     HRESULT InitThumbnailRenderTarget(LPDIRECT3DDEVICE9 device);
     IDirect3DTexture9* RenderThumbnail(CBlock* pBlock);
     void GenerateThumbnailsForResources(void);
+    void UpdateThumbnails(void);
     IDirect3DTexture9* GetThumbnailTexture(size_t index);
 
     //*****************************************************************************
-    // ImGuił̑֐
+    // ImGuiでの操作関数
     //*****************************************************************************
     void UpdateTransform(CBlock* selectedBlock);
     void PickBlockFromMouseClick(void);
     void UpdateCollider(CBlock* selectedBlock);
 
     //*****************************************************************************
-    // getter֐
+    // getter関数
     //*****************************************************************************
     bool GetUpdateCollider(void) { return m_autoUpdateColliderSize; }
     static const char* GetFilePathFromType(CBlock::TYPE type);
@@ -66,22 +66,26 @@ public:
     int GetSelectedIdx(void) { return m_selectedIdx; }
     int GetPrevSelectedIdx(void) { return m_prevSelectedIdx; }
     static CBlock* GetSelectedBlock(void) { return m_selectedBlock; }
+    static CBlockInstancer& GetInstancer(void) { return m_instancer; }
     bool IsPlayerInGrass(void);
     bool IsPlayerInTorch(void);
 
-    // ̃^CṽubN擾
+    // 特定のタイプのブロックを取得
     static const std::vector<CBlock*>& GetBlocksByType(CBlock::TYPE type)
     {
-        return m_blocksByType[type]; // ݂Ȃꍇ͋vectorԂ
+        return m_blocksByType[type]; // 存在しない場合は空vectorが返る
     }
 
-    // --- ̌^܂Ƃ߂Ď擾ev[g֐ ---
+    // --- 特定の型をまとめて取得するテンプレート関数 ---
     template<typename T>
-    static std::vector<T*> GetBlocksOfType(void)
+    static FrameVector<T*> GetBlocksOfType(void)
     {
-        std::vector<T*> result;
+        FrameVector<T*> result;
         CBlock::TYPE type = T::GetStaticType();
 
+        // 毎フレーム呼ばれるので結果はフレームアロケーターに置く
+        result.reserve(m_blocksByType[type].size());
+
         for (CBlock* block : m_blocksByType[type])
         {
             if (!block)
@@ -89,7 +93,7 @@ public:
                 continue;
             }
 
-            // ^CvŔʂ
+            // タイプで判別する
             if (block->GetType() != type)
             {
                 continue;
@@ -104,16 +108,25 @@ public:
     }
 
 private:
-    static constexpr float THUMB_WIDTH  = 100.0f;// TlC̍
-    static constexpr float THUMB_HEIGHT = 100.0f;// TlC̍
+    static constexpr float THUMB_WIDTH  = 100.0f;// サムネイルの高さ
+    static constexpr float THUMB_HEIGHT = 100.0f;// サムネイルの高さ
 
     //*****************************************************************************
-    // ubNǗ
+    // ブロック管理
     //*****************************************************************************
     static std::vector<CBlock*> m_blocks;
     static std::unordered_map<CBlock::TYPE, std::vector<CBlock*>> m_blocksByType;
+    static std::vector<CBlock*> m_emitters;             // ライトを出すブロック
+    static unsigned int m_nLightGeneration;             // ライトを更新した時のライトの世代
+    static float m_fLightProgress;                      // ライトを更新した時の時間の割合
+    static bool m_bEmittersDirty;                       // ライトを出すブロックが増減したか
+    static constexpr float LIGHT_PROGRESS_STEP = 1.0f / 256.0f;// ライトを更新する時間の刻み
+
+    static void RemoveEmitter(CBlock* pBlock);
+    static void ClearEmitters(void);
 
     static CBlock* m_selectedBlock;
+    static CBlockInstancer m_instancer;                 // 静的ブロックのインスタンス描画
     static CBlock* m_draggingBlock;
 
     static int  m_selectedIdx;
@@ -124,22 +137,26 @@ private:
     bool m_autoUpdateColliderSize = true;
 
     //*****************************************************************************
-    // fobO
+    // デバッグ
     //*****************************************************************************
     CDebugProc3D* m_pDebug3D = nullptr;
 
     //*****************************************************************************
-    // t@CpXǗ
+    // ファイルパス管理
     //*****************************************************************************
     static std::unordered_map<CBlock::TYPE, std::string> s_FilePathMap;
 
     //*****************************************************************************
-    // TlCp\[X
+    // サムネイル用リソース
     //*****************************************************************************
     LPDIRECT3DTEXTURE9          m_pThumbnailRT;
     LPDIRECT3DSURFACE9          m_pThumbnailZ;
     std::vector<IDirect3DTexture9*> m_thumbnailTextures;
-    bool m_thumbnailsGenerated = false;                 // xtO
+    std::vector<CThumbnailCache::Key> m_thumbnailKeys;  // タイプごとのキャッシュの鍵
+    std::vector<bool> m_thumbnailKeyValid;              // 鍵を作れたか(モデルが読めたか)
+    CThumbnailCache::Param m_thumbParam;                // サムネイルの描き方
+    bool m_thumbnailsGenerated = false;                 // 一度だけ作るフラグ
+    int m_nNextThumbnail = 0;                           // 次にサムネイルを作るタイプ
     float m_thumbWidth;
     float m_thumbHeight;
 };
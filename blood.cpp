@@ -1,12 +1,12 @@
 //=============================================================================
 //
-//  [blood.cpp]
+// 血痕処理 [blood.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "blood.h"
 #include "texture.h"
@@ -14,28 +14,28 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CBlood::CBlood(int nPriority) : CObject3D(nPriority)
 {
-	// l̃NA
-	m_nIdxTexture = 0;		// eNX`CfbNX
+	// 値のクリア
+	m_nIdxTexture = -1;		// テクスチャインデックス
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CBlood::~CBlood()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CBlood* CBlood::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot, D3DXCOLOR col, float width, float height)
 {
 	CBlood* pBlood = new CBlood;
 
-	// nullptr
+	// nullptrだったら
 	if (pBlood == nullptr)
 	{
 		return nullptr;
@@ -47,7 +47,7 @@ CBlood* CBlood::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot, D3DXCOLOR col, float wi
 	pBlood->SetWidth(width);
 	pBlood->SetHeight(height);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pBlood->Init()))
 	{
 		return nullptr;
@@ -56,73 +56,77 @@ CBlood* CBlood::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot, D3DXCOLOR col, float wi
 	return pBlood;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CBlood::Init(void)
 {
-	// eNX`̎擾
+	// テクスチャの取得
 	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/blood.png");
 
-	// 3DIuWFNg̏
+	// 3Dオブジェクトの初期化処理
 	CObject3D::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CBlood::Uninit(void)
 {
-	// 3DIuWFNg̏I
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
+
+	// 3Dオブジェクトの終了処理
 	CObject3D::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CBlood::Update(void)
 {
-	// 3DIuWFNg̍XV
+	// 3Dオブジェクトの更新処理
 	CObject3D::Update();
 
 	D3DXCOLOR col = GetCol();
 
-	col.a -= DEC_ALPHA;// At@lXɉ
+	col.a -= DEC_ALPHA;// アルファ値を徐々に下げる
 
-	// F̐ݒ
+	// 色の設定
 	SetCol(col);
 
 	if (col.a <= 0.0f)
 	{
-		// I
+		// 終了処理
 		Uninit();
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CBlood::Draw(void)
 {
-	// eNX`̎擾
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // Cg𖳌ɂ
+	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // ライトを無効にする
 
-	// eXgL
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);// ftHgfalse
+	// αテストを有効
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);// デフォルトはfalse
 	pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
-	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);// 0傫`
+	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);// 0より大きかったら描画
 
-	// eNX`̐ݒ
+	// テクスチャの設定
 	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
 
-	// 3DIuWFNg̕`揈
+	// 3Dオブジェクトの描画処理
 	CObject3D::Draw();
 
-	// eXg𖳌ɖ߂
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);// ftHgfalse
+	// αテストを無効に戻す
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);// デフォルトはfalse
 
-	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // CgLɂ
+	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // ライトを有効にする
 }
@@ -1,20 +1,20 @@
 //=============================================================================
 //
-//  [blood.h]
+// 血痕処理 [blood.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _BLOOD_H_// ̃}N`ĂȂ
-#define _BLOOD_H_// 2dCN[hh~̃}N`
+#ifndef _BLOOD_H_// このマクロ定義がされていなかったら
+#define _BLOOD_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object3D.h"
 
 
 //*****************************************************************************
-// NX
+// 血痕クラス
 //*****************************************************************************
 class CBlood : public CObject3D
 {
@@ -29,9 +29,9 @@ public:
 	void Draw(void);
 
 private:
-	static constexpr float DEC_ALPHA = 0.004f;	// At@l
+	static constexpr float DEC_ALPHA = 0.004f;	// アルファ値減少量
 
-	int		m_nIdxTexture;						// eNX`CfbNX
+	int		m_nIdxTexture;						// テクスチャインデックス
 };
 
 #endif
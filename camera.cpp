@@ -1,71 +1,72 @@
 //=============================================================================
 //
-// J [camera.cpp]
+// カメラ処理 [camera.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "camera.h"
 #include "renderer.h"
 #include "manager.h"
 #include "game.h"
 #include "player.h"
+#include "culling.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CCamera::CCamera()
 {
-	// l̃NA
-	m_posV					= INIT_VEC3;// _
-	m_posVDest				= INIT_VEC3;// ړI̎_
-	m_posR					= INIT_VEC3;// _
-	m_posRDest				= INIT_VEC3;// ړI̒_
-	m_vecU					= INIT_VEC3;// xNg
-	m_mtxProjection			= {};		// vWFNV}gbNX
-	m_mtxView				= {};		// r[}gbNX
-	m_rot					= INIT_VEC3;// 
-	m_targetPos				= INIT_VEC3;// JUp̑Ώۈʒu
-	m_shakeOffset			= INIT_VEC3;// ŏIIɉItZbg
-	m_eventShakeTime		= 0.0f;     // c̃CxgVFCN
-	m_eventShakePower		= 0.0f;     // CxgVFCN̍ő勭
-	m_eventShakeDuration	= 0.0f;		// VFCŇ
-	m_fDistance				= 0.0f;		// _璍_̋
-	m_nDirectionCamTimer	= 0;		// oJ
-	m_nTimer				= 0;		// ^C}[
-	m_isDirection			= false;	// oJǂ
-	m_isCameraShakeOn		= false;	// JVFCNON/OFF
-	m_currentKey			= 0;		// [r[J݂̌̃L[
-	m_directionFrame		= 0;		// [r[J̃JE^
-	m_delayFrame			= 0;		// x
+	// 値のクリア
+	m_posV					= INIT_VEC3;// 視点
+	m_posVDest				= INIT_VEC3;// 目的の視点
+	m_posR					= INIT_VEC3;// 注視点
+	m_posRDest				= INIT_VEC3;// 目的の注視点
+	m_vecU					= INIT_VEC3;// 上方向ベクトル
+	m_mtxProjection			= {};		// プロジェクションマトリックス
+	m_mtxView				= {};		// ビューマトリックス
+	m_rot					= INIT_VEC3;// 向き
+	m_targetPos				= INIT_VEC3;// カメラ振動用の対象位置
+	m_shakeOffset			= INIT_VEC3;// 最終的に加えるオフセット
+	m_eventShakeTime		= 0.0f;     // 残りのイベントシェイク時間
+	m_eventShakePower		= 0.0f;     // イベントシェイクの最大強さ
+	m_eventShakeDuration	= 0.0f;		// シェイクの減衰
+	m_fDistance				= 0.0f;		// 視点から注視点の距離
+	m_nDirectionCamTimer	= 0;		// 演出カメラ時間
+	m_nTimer				= 0;		// タイマー
+	m_isDirection			= false;	// 演出カメラかどうか
+	m_isCameraShakeOn		= false;	// カメラシェイクのON/OFF
+	m_currentKey			= 0;		// ムービーカメラの現在のキー
+	m_directionFrame		= 0;		// ムービーカメラのカウンタ
+	m_delayFrame			= 0;		// 遅延
 #ifdef _DEBUG
-	m_Mode = MODE_EDIT;					// J̃[h
+	m_Mode = MODE_EDIT;					// カメラのモード
 #else
 	m_Mode = MODE_GAME;
 #endif
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CCamera::~CCamera()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CCamera::Init(void)
 {	
 	m_posV = D3DXVECTOR3(0.0f, 80.0f, -540.0f);
 	m_posR = D3DXVECTOR3(0.0f, 80.0f, 0.0f);
-	m_vecU = D3DXVECTOR3(0.0f, 1.0f, 0.0f);// Œł
+	m_vecU = D3DXVECTOR3(0.0f, 1.0f, 0.0f);// 固定でいい
 	m_rot = D3DXVECTOR3(0.0f, D3DX_PI, 0.0f);
 	
 #ifdef _DEBUG
-	m_Mode = MODE_EDIT;									// J̃[h
+	m_Mode = MODE_EDIT;									// カメラのモード
 
 	m_fDistance = sqrtf(
 		((m_posV.x - m_posR.x) * (m_posV.x - m_posR.x)) +
@@ -82,32 +83,32 @@ HRESULT CCamera::Init(void)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CCamera::Uninit(void)
 {
 
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CCamera::Update(void)
 {
-	// Xi[̈ʒu̍XV
+	// リスナーの位置の更新
 	CManager::GetSound()->UpdateListener(m_posV);
 
 #ifdef _DEBUG
-	// L[{[h̎擾
+	// キーボードの取得
 	CInputKeyboard* pInputKeyboard = CManager::GetInputKeyboard();
 
 	if (m_Mode == MODE_EDIT && pInputKeyboard->GetTrigger(DIK_C) == true)
 	{
-		// Q[J
+		// ゲームカメラ
 		m_Mode = MODE_GAME;
 	}
 	else if (m_Mode == MODE_GAME && pInputKeyboard->GetTrigger(DIK_C) == true)
 	{
-		// GfB^[J
+		// エディターカメラ
 		m_Mode = MODE_EDIT;
 	}
 #endif
@@ -121,93 +122,96 @@ void CCamera::Update(void)
 		//	return;
 		//}
 
-		// GfB^[J̏
+		// エディターカメラの処理
 		EditCamera();
 #endif
 		break;
 	case MODE_GAME:
-		// Q[̃J
+		// ゲームのカメラ処理
 		GameCamera();
 		break;
 
 	case MODE_DIRECTION:
-		// oJ̏
+		// 演出カメラの処理
 		DirectionCamera(m_nTimer);
 		break;
 
 	case MODE_MOVIE:
-		// [r[J̏
+		// ムービーカメラの処理
 		MovieCamera();
 		break;
 	}
 
-	CameraShake();// JVFCN
+	CameraShake();// カメラシェイク処理
 
 }
 //=============================================================================
-// J̐ݒ菈
+// カメラの設定処理
 //=============================================================================
 void CCamera::SetCamera(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// r[}gbNX̏
+	// ビューマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxView);
 
-	// r[}gbNX̍쐬
+	// ビューマトリックスの作成
 	D3DXMatrixLookAtLH(&m_mtxView,
 		&m_posV,
 		&m_posR,
 		&m_vecU);
 
-	// r[}gbNX̐ݒ
+	// ビューマトリックスの設定
 	pDevice->SetTransform(D3DTS_VIEW, &m_mtxView);
 
-	// vWFNV}gbNX̏
+	// プロジェクションマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxProjection);
 
-	// vWFNV}gbNX̍쐬
+	// プロジェクションマトリックスの作成
 	D3DXMatrixPerspectiveFovLH(&m_mtxProjection,
-		D3DXToRadian(80.0f),						// p
-		(float)SCREEN_WIDTH / (float)SCREEN_HEIGHT, // AXyNg
-		1.0f,										// ߃Nbv
-		3500.0f);									// Nbv
+		D3DXToRadian(80.0f),						// 視野角
+		(float)SCREEN_WIDTH / (float)SCREEN_HEIGHT, // アスペクト比
+		1.0f,										// 近クリップ面
+		3500.0f);									// 遠クリップ面
 
-	// vWFNV}gbNX̐ݒ
+	// プロジェクションマトリックスの設定
 	pDevice->SetTransform(D3DTS_PROJECTION, &m_mtxProjection);
+
+	// カリング用の視錐台を更新
+	CCulling::SetCamera(m_mtxView, m_mtxProjection, m_posV);
 }
 //=============================================================================
-// GfB^[J̏
+// エディターカメラの処理
 //=============================================================================
 void CCamera::EditCamera(void)
 {
-	// L[{[h̎擾
+	// キーボードの取得
 	CInputKeyboard* pInputKeyboard = CManager::GetInputKeyboard();
 
-	// }EX̎擾
+	// マウスの取得
 	CInputMouse* pInputMouse = CManager::GetInputMouse();
 
-	// }EXJ[\\
+	// マウスカーソルを表示する
 	pInputMouse->SetCursorVisibility(true);
 
-	// ݂̃J[\ʒu擾
+	// 現在のカーソル位置を取得
 	POINT cursorPos;
 	GetCursorPos(&cursorPos);
 
-	// Ot[̃}EXړʂ擾
+	// 前フレームからのマウス移動量を取得
 	static POINT prevCursorPos = { cursorPos.x, cursorPos.y };
 	float deltaX = (float)(cursorPos.x - prevCursorPos.x);
 	float deltaY = (float)(cursorPos.y - prevCursorPos.y);
 
-	// ݂̃J[\ʒuۑĩt[ł̔rpj
+	// 現在のカーソル位置を保存（次のフレームでの比較用）
 	prevCursorPos = cursorPos;
 
 	deltaX *= MOUSE_SENSITIVITY;
 	deltaY *= MOUSE_SENSITIVITY;
 
 	//====================================
-	// }EXzC[ŃY[CEAEg
+	// マウスホイールでズームイン・アウト
 	//====================================
 	int wheel = pInputMouse->GetWheel();
 	const float zoomSpeed = 15.0f;
@@ -216,7 +220,7 @@ void CCamera::EditCamera(void)
 	{
 		m_fDistance -= wheel * zoomSpeed;
 
-		// J
+		// カメラ距離制限
 		if (m_fDistance < 100.0f)
 		{
 			m_fDistance = 100.0f;
@@ -227,15 +231,15 @@ void CCamera::EditCamera(void)
 		}
 	}
 
-	if (pInputKeyboard->GetPress(DIK_LALT) && pInputMouse->GetPress(0)) // NbNȂ}EXړ  _]
+	if (pInputKeyboard->GetPress(DIK_LALT) && pInputMouse->GetPress(0)) // 左クリック押しながらマウス移動 → 視点回転
 	{
-		m_rot.y += deltaX; // ]
-		m_rot.x += deltaY; // ]
+		m_rot.y += deltaX; // 水平回転
+		m_rot.x += deltaY; // 垂直回転
 
-		//px̐K
+		//角度の正規化
 		NormalizeRotY();
 
-		// ]̐
+		// 垂直回転の制限
 		if (m_rot.x > PI_HALF)
 		{
 			m_rot.x = PI_HALF;
@@ -246,21 +250,21 @@ void CCamera::EditCamera(void)
 			m_rot.x = -PI_HALF;
 		}
 
-		// _̍XViJ̕Kpj
+		// 視点の更新（カメラの方向を適用）
 		m_posV.x = m_posR.x + sinf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 		m_posV.y = m_posR.y + sinf(m_rot.x) * m_fDistance;
 		m_posV.z = m_posR.z + cosf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 
 	}
-	else if (pInputMouse->GetPress(1)) // ENbNȂ}EXړ  _]
+	else if (pInputMouse->GetPress(1)) // 右クリック押しながらマウス移動 → 注視点回転
 	{
-		m_rot.y += deltaX; // ]
-		m_rot.x += deltaY; // ]
+		m_rot.y += deltaX; // 水平回転
+		m_rot.x += deltaY; // 垂直回転
 
-		//px̐K
+		//角度の正規化
 		NormalizeRotY();
 
-		// ]̐
+		// 垂直回転の制限
 		if (m_rot.x > PI_HALF)
 		{
 			m_rot.x = PI_HALF;
@@ -270,26 +274,26 @@ void CCamera::EditCamera(void)
 			m_rot.x = -PI_HALF;
 		}
 
-		// _̍XV
+		// 注視点の更新
 		m_posR.x = m_posV.x - sinf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 		m_posR.y = m_posV.y - sinf(m_rot.x) * m_fDistance;
 		m_posR.z = m_posV.z - cosf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 	}
 	else
 	{
-		// ͂ȂꍇłY[f̂߂Ɏ_XV
+		// 入力がない場合でもズーム反映のために視点を更新
 		m_posV.x = m_posR.x + sinf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 		m_posV.y = m_posR.y + sinf(m_rot.x) * m_fDistance;
 		m_posV.z = m_posR.z + cosf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 	}
 
-	// _̍XV
+	// 注視点の更新
 	m_posR.x = m_posV.x - sinf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 	m_posR.y = m_posV.y - sinf(m_rot.x) * m_fDistance;
 	m_posR.z = m_posV.z - cosf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 }
 //=============================================================================
-// Q[J̏
+// ゲームカメラの処理
 //=============================================================================
 void CCamera::GameCamera(void)
 {
@@ -301,29 +305,29 @@ void CCamera::GameCamera(void)
 
 	m_posR = D3DXVECTOR3(0.0f, -55.8f, -30.0f);
 
-	// 낵ppxi΂߁j
+	// 見下ろし用角度（少し斜め）
 	m_rot.x = 0.89f;
 	m_rot.y = D3DX_PI;
 
-	// ݒ
+	// 距離設定
 	m_fDistance = GAMECAM_DISTANCE;
 
-	// JʒuvZ
+	// カメラ位置計算
 	m_posV.x = m_posR.x + sinf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 	m_posV.y = m_posR.y + sinf(m_rot.x) * m_fDistance;
 	m_posV.z = m_posR.z + cosf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 }
 //=============================================================================
-// J̈ʒu␳(ǊђʂȂ)
+// カメラの位置補正(壁貫通をなくす)処理
 //=============================================================================
 void CCamera::AdjustCameraPosition(const D3DXVECTOR3& playerPos)
 {
-	// vC[̓ʒu𒍎_Ƃ
+	// プレイヤーの頭位置を注視点とする
 	D3DXVECTOR3 playerEye = playerPos;
-	playerEye.y += 60.0f; // vC[̓̍
+	playerEye.y += 60.0f; // プレイヤーの頭の高さ
 	m_posR = playerEye;
 
-	// J̗zʒu
+	// カメラの理想位置
 	D3DXVECTOR3 offsetFromPlayer;
 	offsetFromPlayer.x = sinf(m_rot.y) * cosf(m_rot.x) * m_fDistance;
 	offsetFromPlayer.y = sinf(m_rot.x) * m_fDistance + 20.0f;
@@ -331,7 +335,7 @@ void CCamera::AdjustCameraPosition(const D3DXVECTOR3& playerPos)
 
 	D3DXVECTOR3 idealCamPos = playerEye + offsetFromPlayer;
 
-	// Bullet Physics ŃCLXg
+	// Bullet Physics でレイキャスト
 	btVector3 from(playerEye.x, playerEye.y, playerEye.z);
 	btVector3 to(idealCamPos.x, idealCamPos.y, idealCamPos.z);
 
@@ -340,13 +344,13 @@ void CCamera::AdjustCameraPosition(const D3DXVECTOR3& playerPos)
 
 	if (rayCallback.hasHit())
 	{
-		// ՓˑΏۂ̃[U[|C^ubN
+		// 衝突対象のユーザーポインタからブロックを特定
 		const btCollisionObject* hitObj = rayCallback.m_collisionObject;
 		void* userPtr = hitObj->getUserPointer();
 
 		if (userPtr != nullptr)
 		{
-			// Փ˓_̏OɃJzu
+			// 衝突点の少し手前にカメラを配置
 			btVector3 hitPoint = rayCallback.m_hitPointWorld;
 			btVector3 camDir = (from - hitPoint).normalized();
 			hitPoint += camDir * 10.0f;
@@ -354,9 +358,9 @@ void CCamera::AdjustCameraPosition(const D3DXVECTOR3& playerPos)
 			m_posV = D3DXVECTOR3(hitPoint.x(), hitPoint.y(), hitPoint.z());
 		}
 		else
-		{// [U[|C^ null ̏ꍇ
+		{// ユーザーポインタが null の場合
 
-			// ␳Ă
+			// 補正しておく
 			btVector3 hitPoint = rayCallback.m_hitPointWorld;
 			btVector3 camDir = (from - hitPoint).normalized();
 			hitPoint += camDir * 10.0f;
@@ -365,16 +369,16 @@ void CCamera::AdjustCameraPosition(const D3DXVECTOR3& playerPos)
 		}
 	}
 	else
-	{// Փ˂Ȃ
-		// zʒû܂
+	{// 衝突なし
+		// 理想位置そのまま
 		m_posV = idealCamPos;
 	}
 
-	// _̓vC[̓
+	// 注視点はプレイヤーの頭
 	m_posR = playerEye;
 }
 //=============================================================================
-// J̃p[^ݒ菈
+// カメラのパラメータ設定処理
 //=============================================================================
 void CCamera::SetCamParameter(D3DXVECTOR3 posV, D3DXVECTOR3 posR, D3DXVECTOR3 rot, float fDistance)
 {
@@ -395,7 +399,7 @@ void CCamera::SetCamParameter(D3DXVECTOR3 posV, D3DXVECTOR3 posR, D3DXVECTOR3 ro
 	}
 }
 //=============================================================================
-// [r[pJ̐ݒ菈
+// ムービー用カメラの設定処理
 //=============================================================================
 void CCamera::SetMovieCamera(const std::vector<CameraKeyFrame>& keys)
 {
@@ -404,7 +408,7 @@ void CCamera::SetMovieCamera(const std::vector<CameraKeyFrame>& keys)
 	m_directionFrame = 0;
 	m_Mode = MODE_MOVIE;
 
-	// Ԃ1L[ڂ
+	// 初期状態を1キー目に
 	m_posV = keys[0].posV;
 	m_posR = keys[0].posR;
 	m_rot = keys[0].rot;
@@ -422,18 +426,18 @@ void CCamera::SetMovieCamera(const std::vector<CameraKeyFrame>& keys)
 	}
 }
 //=============================================================================
-// oJ̐ݒ菈
+// 演出カメラの設定処理
 //=============================================================================
 void CCamera::SetCamDirection(int nTimer,D3DXVECTOR3 posV, D3DXVECTOR3 posR, D3DXVECTOR3 rot)
 {
 	m_Mode = MODE_DIRECTION;
 
-	// ^C}[̐ݒ
+	// タイマーの設定
 	SetTimer(nTimer);
 
 	m_posV = posV;
 	m_posR = posR;
-	m_vecU = D3DXVECTOR3(0.0f, 1.0f, 0.0f);// Œł
+	m_vecU = D3DXVECTOR3(0.0f, 1.0f, 0.0f);// 固定でいい
 	m_rot = rot;
 	m_fDistance = sqrtf(
 		((m_posV.x - m_posR.x) * (m_posV.x - m_posR.x)) +
@@ -441,7 +445,7 @@ void CCamera::SetCamDirection(int nTimer,D3DXVECTOR3 posV, D3DXVECTOR3 posR, D3D
 		((m_posV.z - m_posR.z) * (m_posV.z - m_posR.z)));
 }
 //=============================================================================
-// oJ̏
+// 演出カメラの処理
 //=============================================================================
 void CCamera::DirectionCamera(int nTimer)
 {
@@ -450,24 +454,24 @@ void CCamera::DirectionCamera(int nTimer)
 	if (m_nDirectionCamTimer >= nTimer)
 	{
 		m_isDirection = false;
-		// JE^[Zbg
+		// カウンターリセット
 		m_nDirectionCamTimer = 0;
 
 		m_fDistance = 220.0f;
 
-		// Q[Jɖ߂
+		// ゲームカメラに戻す
 		m_Mode = MODE_GAME;
 	}
 }
 //=============================================================================
-// [r[J̏
+// ムービーカメラの処理
 //=============================================================================
 void CCamera::MovieCamera(void)
 {
-	// SL[I
+	// 全キー終了
 	if (m_currentKey >= (int)m_camKeys.size() - 1)
 	{
-		// xt[Zbg
+		// 遅延フレームリセット
 		m_delayFrame = 0;
 
 		return;
@@ -477,20 +481,20 @@ void CCamera::MovieCamera(void)
 	CameraKeyFrame& to = m_camKeys[m_currentKey + 1];
 
 	//==========================
-	// x
+	// 遅延処理
 	//==========================
 	if (m_delayFrame < from.delay)
 	{
 		m_delayFrame++;
-		return; // ܂Ȃ
+		return; // まだ動かさない
 	}
 
-	int duration = std::max(1, to.duration); // 0h~
+	int duration = std::max(1, to.duration); // ★0防止
 
 	float t = (float)m_directionFrame / (float)duration;
 	t = std::max(0.0f, std::min(1.0f, t));
 
-	// 
+	// 補間
 	m_posV = from.posV + (to.posV - from.posV) * t;
 	m_posR = from.posR + (to.posR - from.posR) * t;
 	m_rot = from.rot + (to.rot - from.rot) * t;
@@ -505,22 +509,22 @@ void CCamera::MovieCamera(void)
 	}
 }
 //=============================================================================
-// J̑OxNg擾
+// カメラの前方ベクトル取得
 //=============================================================================
 D3DXVECTOR3 CCamera::GetForward(void) const
 {
-	// J̉]pxiYjOxNgvZ
+	// カメラの回転角度（Y軸）から前方ベクトルを計算
 	float yaw = m_rot.y;
 
 	D3DXVECTOR3 forward(-sinf(yaw), 0.0f, -cosf(yaw));
 
-	// K
+	// 正規化する
 	D3DXVec3Normalize(&forward, &forward);
 
 	return forward;
 }
 //=============================================================================
-// px̐K X
+// 角度の正規化 X軸
 //=============================================================================
 void CCamera::NormalizeRotX(void)
 {
@@ -534,7 +538,7 @@ void CCamera::NormalizeRotX(void)
 	}
 }
 //=============================================================================
-// px̐K Y
+// 角度の正規化 Y軸
 //=============================================================================
 void CCamera::NormalizeRotY(void)
 {
@@ -548,12 +552,12 @@ void CCamera::NormalizeRotY(void)
 	}
 }
 //=============================================================================
-// JVFCN
+// カメラシェイク処理
 //=============================================================================
 void CCamera::CameraShake(void)
 {
 	// --------------------------
-	// ˑ̏펞U
+	// 距離依存の常時振動
 	// --------------------------
 	if (m_isCameraShakeOn)
 	{
@@ -561,7 +565,7 @@ void CCamera::CameraShake(void)
 
 		float dist = D3DXVec3Length(&targetpos);
 
-		float maxDist = SHAKE_DISTANCE;// U鋗
+		float maxDist = SHAKE_DISTANCE;// 振動する距離
 		float ambientIntensity = 1.0f - (dist / maxDist);
 		ambientIntensity = std::max(0.0f, std::min(1.0f, ambientIntensity));
 
@@ -576,30 +580,31 @@ void CCamera::CameraShake(void)
 	}
 
 	// --------------------------
-	// Cxgˑ̐U
+	// イベント依存の振動
 	// --------------------------
 	if (m_eventShakeTime > 0.0f)
 	{
-		float power = m_eventShakePower * (m_eventShakeTime / m_eventShakeDuration); // 
-		m_shakeOffset.x += ((rand() % 2000 - 1000) / 1000.0f) * power;
-		m_shakeOffset.y += ((rand() % 2000 - 1000) / 1000.0f) * power;
-		m_shakeOffset.z += ((rand() % 2000 - 1000) / 1000.0f) * power;
+		float power = m_eventShakePower * (m_eventShakeTime / m_eventShakeDuration); // 減衰
+		CRandom& random = CRandom::Get(CRandom::STREAM_EFFECT);
+		m_shakeOffset.x += random.Range(-1.0f, 1.0f) * power;
+		m_shakeOffset.y += random.Range(-1.0f, 1.0f) * power;
+		m_shakeOffset.z += random.Range(-1.0f, 1.0f) * power;
 
-		m_eventShakeTime--; // oߎԂŌ
+		m_eventShakeTime--; // 経過時間で減衰
 	}
 
 	if (m_Mode == MODE_DIRECTION || m_Mode == MODE_EDIT)
-	{// oJ
+	{// 演出カメラだったら
 		return;
 	}
 
 	// --------------------------
-	// Jʒuɔf
+	// カメラ位置に反映
 	// --------------------------
 	m_posV += m_shakeOffset;
 }
 //=============================================================================
-// Cxg̃JVFCN̐ݒ
+// イベント時のカメラシェイクの設定
 //=============================================================================
 void CCamera::TriggerEventShake(float power, float duration)
 {
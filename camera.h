@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// J [camera.h]
+// カメラ処理 [camera.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _CAMERA_H_// ̃}N`ĂȂ
-#define _CAMERA_H_// 2dCN[hh~̃}N`
+#ifndef _CAMERA_H_// このマクロ定義がされていなかったら
+#define _CAMERA_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// JNX
+// カメラクラス
 //*****************************************************************************
 class CCamera
 {
@@ -16,24 +16,24 @@ public:
 	CCamera();
 	~CCamera();
 
-	// [r[J\
+	// ムービーカメラ構造体
 	struct CameraKeyFrame
 	{
 		D3DXVECTOR3 posV;
 		D3DXVECTOR3 posR;
 		D3DXVECTOR3 rot;
 		float       distance;
-		int         duration;	// ̃L[ֈړ܂ł̃t[
-		int			delay;		// ̃L[ő҂t[iJnpj
+		int         duration;	// このキーへ移動するまでのフレーム数
+		int			delay;		// このキーで待つフレーム（開始用）
 	};
 
-	// J̎
+	// カメラの種類
 	typedef enum
 	{
-		MODE_EDIT = 0,	// GfB^[J
-		MODE_GAME,		// Q[J
-		MODE_DIRECTION,	// oJ
-		MODE_MOVIE,		// [r[J
+		MODE_EDIT = 0,	// エディターカメラ
+		MODE_GAME,		// ゲームカメラ
+		MODE_DIRECTION,	// 演出カメラ
+		MODE_MOVIE,		// ムービーカメラ
 		MODE_MAX
 	}MODE;
 
@@ -50,12 +50,12 @@ public:
 	void TriggerEventShake(float power, float duration);
 
 	//*****************************************************************************
-	// flagment֐
+	// flagment関数
 	//*****************************************************************************
 	void IsDirection(bool flag) { m_isDirection = flag; }
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
 	void SetPosV(D3DXVECTOR3 posV) { m_posV = posV; }
 	void SetPosR(D3DXVECTOR3 posR) { m_posR = posR; }
@@ -70,9 +70,9 @@ public:
 	void SetCameraShake(bool flag) { m_isCameraShakeOn = flag; }
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
-	D3DXVECTOR3 GetRot(void) { return m_rot; }			// J̊px̎擾
+	D3DXVECTOR3 GetRot(void) { return m_rot; }			// カメラの角度の取得
 	MODE GetMode(void) { return m_Mode; }
 	D3DXVECTOR3 GetForward(void) const;
 	D3DXVECTOR3 GetPosV(void) { return m_posV; }
@@ -80,38 +80,38 @@ public:
 	bool GetDirection(void) { return m_isDirection; }
 
 private:
-	void NormalizeRotX(void);// px̐K X
-	void NormalizeRotY(void);// px̐K Y
+	void NormalizeRotX(void);// 角度の正規化 X軸
+	void NormalizeRotY(void);// 角度の正規化 Y軸
 
 private:
-	static constexpr float SHAKE_DISTANCE		= 1300.0f;	// U鋗
-	static constexpr float MOUSE_SENSITIVITY	= 0.004f;	// }EXx
-	static constexpr float GAMECAM_DISTANCE		= 580.0f;	// Q[J̋
-	static constexpr float PI_HALF				= 1.57f;	// ~̔
+	static constexpr float SHAKE_DISTANCE		= 1300.0f;	// 振動する距離
+	static constexpr float MOUSE_SENSITIVITY	= 0.004f;	// マウス感度
+	static constexpr float GAMECAM_DISTANCE		= 580.0f;	// ゲームカメラ時の距離
+	static constexpr float PI_HALF				= 1.57f;	// 円周率の半分
 
-	D3DXVECTOR3 m_posV;					// _
-	D3DXVECTOR3 m_posVDest;				// ړI̎_
-	D3DXVECTOR3 m_posR;					// _
-	D3DXVECTOR3 m_posRDest;				// ړI̒_
-	D3DXVECTOR3 m_vecU;					// xNg
-	D3DXMATRIX	m_mtxProjection;		// vWFNV}gbNX
-	D3DXMATRIX	m_mtxView;				// r[}gbNX
-	D3DXVECTOR3 m_rot;					// 
-	D3DXVECTOR3 m_targetPos;			// Ώۂ̈ʒu(JUp)
-	D3DXVECTOR3 m_shakeOffset;			// ŏIIɉItZbg
-	float		m_eventShakeTime;		// c̃CxgVFCN
-	float		m_eventShakePower;		// CxgVFCN̍ő勭
-	float		m_eventShakeDuration;	// VFCŇ
-	float		m_fDistance;			// _璍_̋
-	MODE		m_Mode;					// J̃[h
-	int			m_nDirectionCamTimer;	// oJւ̈ڍs
-	int			m_nTimer;				// ^C}[
-	bool		m_isDirection;			// oJǂ
-	bool		m_isCameraShakeOn;		// JVFCNON/OFF
+	D3DXVECTOR3 m_posV;					// 視点
+	D3DXVECTOR3 m_posVDest;				// 目的の視点
+	D3DXVECTOR3 m_posR;					// 注視点
+	D3DXVECTOR3 m_posRDest;				// 目的の注視点
+	D3DXVECTOR3 m_vecU;					// 上方向ベクトル
+	D3DXMATRIX	m_mtxProjection;		// プロジェクションマトリックス
+	D3DXMATRIX	m_mtxView;				// ビューマトリックス
+	D3DXVECTOR3 m_rot;					// 向き
+	D3DXVECTOR3 m_targetPos;			// 対象の位置(カメラ振動用)
+	D3DXVECTOR3 m_shakeOffset;			// 最終的に加えるオフセット
+	float		m_eventShakeTime;		// 残りのイベントシェイク時間
+	float		m_eventShakePower;		// イベントシェイクの最大強さ
+	float		m_eventShakeDuration;	// シェイクの減衰
+	float		m_fDistance;			// 視点から注視点の距離
+	MODE		m_Mode;					// カメラのモード
+	int			m_nDirectionCamTimer;	// 演出カメラへの移行時間
+	int			m_nTimer;				// タイマー
+	bool		m_isDirection;			// 演出カメラかどうか
+	bool		m_isCameraShakeOn;		// カメラシェイクのON/OFF
 
-	int			m_currentKey;			// [r[J݂̌̃L[
-	int			m_directionFrame;		// [r[J̃JE^
-	int			m_delayFrame;			// x
+	int			m_currentKey;			// ムービーカメラの現在のキー
+	int			m_directionFrame;		// ムービーカメラのカウンタ
+	int			m_delayFrame;			// 遅延
 	std::vector<CameraKeyFrame> m_camKeys;
 };
 
@@ -1,71 +1,72 @@
 //=============================================================================
 //
-// LN^[}l[W[ [charactermanager.cpp]
+// キャラクターマネージャー処理 [charactermanager.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "charactermanager.h"
 #include "manager.h"
 #include "guage.h"
+#include "culling.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CCharacter::CCharacter(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
+	// 値のクリア
 	m_fHp           = 0.0f;                         // HP
-	m_fMaxHp        = 0.0f;                         // HPő
-	m_pHpGuage      = nullptr;		                // ΃Q[W
-	m_pBackGuage    = nullptr;		                // ԃQ[WixĒǏ]j
-	m_pFrame        = nullptr;			            // g
-	m_pos           = INIT_VEC3;					// ʒu
-	m_rot           = INIT_VEC3;					// 
-	m_rotDest       = INIT_VEC3;					// 
-	m_size          = D3DXVECTOR3(1.0f, 1.0f, 1.0f);// TCY
-    m_move          = INIT_VEC3;					// ړ
-	m_pRigidBody    = nullptr;						// ̂ւ̃|C^
-	m_pShape        = nullptr;						// 蔻̌`ւ̃|C^
-	m_radius        = 0.0f;							// JvZRC_[̔a
-	m_height        = 0.0f;							// JvZRC_[̍
-	m_colliderPos   = INIT_VEC3;					// RC_[̈ʒu
+	m_fMaxHp        = 0.0f;                         // HP最大量
+	m_pHpGuage      = nullptr;		                // 緑ゲージ
+	m_pBackGuage    = nullptr;		                // 赤ゲージ（遅れて追従）
+	m_pFrame        = nullptr;			            // 枠
+	m_pos           = INIT_VEC3;					// 位置
+	m_rot           = INIT_VEC3;					// 向き
+	m_rotDest       = INIT_VEC3;					// 向き
+	m_size          = D3DXVECTOR3(1.0f, 1.0f, 1.0f);// サイズ
+    m_move          = INIT_VEC3;					// 移動量
+	m_pRigidBody    = nullptr;						// 剛体へのポインタ
+	m_pShape        = nullptr;						// 当たり判定の形へのポインタ
+	m_radius        = 0.0f;							// カプセルコライダーの半径
+	m_height        = 0.0f;							// カプセルコライダーの高さ
+	m_colliderPos   = INIT_VEC3;					// コライダーの位置
 
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CCharacter::~CCharacter()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 蔻̐
+// 当たり判定の生成処理
 //=============================================================================
 void CCharacter::CreatePhysics(float radius, float height, btScalar mass)
 {
     //*********************************************************************
-    // Bullet Physics JvZRC_[̐ݒ
+    // Bullet Physics カプセルコライダーの設定
     //*********************************************************************
 
     m_radius = radius;
     m_height = height;
 
-    // RC_[𐶐(JvZ)
+    // コライダーを生成(カプセル)
     m_pShape = new btCapsuleShape(m_radius, m_height);
 
-    // RC_[S =  + ItZbg
+    // コライダー中心 = 足元 + オフセット
     m_colliderPos = GetPos() + D3DXVECTOR3(0, 20.0f, 0);
 
     btTransform transform;
     transform.setIdentity();
     transform.setOrigin(btVector3(m_colliderPos.x, m_colliderPos.y, m_colliderPos.z));
 
-    // ʂݒ
-    btVector3 inertia(0, 0, 0);  // 
+    // 質量を設定
+    btVector3 inertia(0, 0, 0);  // 慣性
 
     m_pShape->calculateLocalInertia(mass, inertia);
 
@@ -77,15 +78,15 @@ void CCharacter::CreatePhysics(float radius, float height, btScalar mass)
     int flags = m_pRigidBody->getCollisionFlags();
     flags |= GetCollisionFlags();
 
-    m_pRigidBody->setCollisionFlags(flags);					// RWtO
-    m_pRigidBody->setAngularFactor(btVector3(0, 0, 0));     // ړ
-    m_pRigidBody->setFriction(0.0f);                        // C
-    m_pRigidBody->setRollingFriction(0.0f);                 // ]薀C
+    m_pRigidBody->setCollisionFlags(flags);					// コリジョンフラグ
+    m_pRigidBody->setAngularFactor(btVector3(0, 0, 0));     // 移動方向
+    m_pRigidBody->setFriction(0.0f);                        // 摩擦
+    m_pRigidBody->setRollingFriction(0.0f);                 // 転がり摩擦
 
     m_pRigidBody->setUserPointer(this);
-    m_pRigidBody->setActivationState(DISABLE_DEACTIVATION);// X[vԂɂȂ
+    m_pRigidBody->setActivationState(DISABLE_DEACTIVATION);// スリープ状態にしない
 
-    // [hɒǉ
+    // 物理ワールドに追加
     btDiscreteDynamicsWorld* pWorld = CManager::GetPhysicsWorld();
 
     if (pWorld != nullptr)
@@ -94,27 +95,27 @@ void CCharacter::CreatePhysics(float radius, float height, btScalar mass)
     }
 }
 //=============================================================================
-// Physics̔j
+// Physicsの破棄
 //=============================================================================
 void CCharacter::ReleasePhysics(void)
 {
-    // ̂̍폜
+    // 剛体の削除
     if (m_pRigidBody)
     {
-        // ܂A[h폜
+        // まず、物理ワールドから削除
         btDiscreteDynamicsWorld* pWorld = CManager::GetPhysicsWorld();
         if (pWorld)
         {
             pWorld->removeRigidBody(m_pRigidBody);
         }
 
-        // ̂̔j
+        // 剛体の破棄
         delete m_pRigidBody->getMotionState();
         delete m_pRigidBody;
         m_pRigidBody = nullptr;
     }
 
-    // RC_[̔j
+    // コライダーの破棄
     if (m_pShape)
     {
         delete m_pShape;
@@ -122,23 +123,23 @@ void CCharacter::ReleasePhysics(void)
     }
 }
 //=============================================================================
-// 蔻̈ʒuXV
+// 当たり判定の位置更新
 //=============================================================================
 void CCharacter::UpdateCollider(D3DXVECTOR3 offset)
 {
-    // ݈ʒu𕨗[h擾 m_pos ɔf
+    // 現在位置を物理ワールドから取得して m_pos に反映
     btTransform trans;
     m_pRigidBody->getMotionState()->getWorldTransform(trans);
     btVector3 pos = trans.getOrigin();
     m_colliderPos = D3DXVECTOR3(pos.getX(), pos.getY(), pos.getZ());
-    m_pos = m_colliderPos - offset; // ւ̃ItZbg
+    m_pos = m_colliderPos - offset; // 足元へのオフセット
 }
 //=============================================================================
-// ԏ
+// 向き補間処理
 //=============================================================================
 void CCharacter::UpdateRotation(float fInterpolationSpeed)
 {
-    // Y̍180x𒴂ꍇ͕␳
+    // Y軸の差分が180度を超える場合は補正
     if (m_rotDest.y - m_rot.y > D3DX_PI)
     {
         m_rot.y += D3DX_PI * 2.0f;
@@ -148,24 +149,44 @@ void CCharacter::UpdateRotation(float fInterpolationSpeed)
         m_rot.y -= D3DX_PI * 2.0f;
     }
 
-    // ԂĊ炩ɉ]
+    // 補間して滑らかに回転
     m_rot.y += (m_rotDest.y - m_rot.y) * fInterpolationSpeed;
 }
 //=============================================================================
-// HPQ[W̐ݒ菈
+// HPゲージの設定処理
 //=============================================================================
 void CCharacter::SetGuages(D3DXVECTOR3 pos, D3DXCOLOR colHP, D3DXCOLOR colBack, float fWidth, float fHeight)
 {
-    m_pFrame = CGuage::Create(CGuage::TYPE_FRAME, pos, fWidth, fHeight);// g
-    m_pBackGuage = CGuage::Create(CGuage::TYPE_BACKGUAGE, pos, fWidth, fHeight);// obNQ[W
-    m_pHpGuage = CGuage::Create(CGuage::TYPE_GUAGE, pos, fWidth, fHeight);// HPQ[W
+    m_pFrame = CGuage::Create(CGuage::TYPE_FRAME, pos, fWidth, fHeight);// 枠
+    m_pBackGuage = CGuage::Create(CGuage::TYPE_BACKGUAGE, pos, fWidth, fHeight);// バックゲージ
+    m_pHpGuage = CGuage::Create(CGuage::TYPE_GUAGE, pos, fWidth, fHeight);// HPゲージ
 
-    // HPʊǗ邽߂ɃQ[W̃^[Qbgݒ
+    // HPを個別管理するためにゲージのターゲットを設定
     m_pFrame->SetTargetCharacter(this);
     m_pBackGuage->SetTargetCharacter(this);
     m_pHpGuage->SetTargetCharacter(this);
 
-    // F̐ݒ
+    // 色の設定
     m_pHpGuage->SetCol(colHP);
     m_pBackGuage->SetCol(colBack);
 }
+//=============================================================================
+// 画面内かどうかの判定処理(足元の位置からカプセルを包む球で判定する)
+//=============================================================================
+bool CCharacter::IsInView(void)
+{
+    float fHalfHeight = (float)m_height * 0.5f + (float)m_radius;
+    float fRadius = std::max(fHalfHeight * CULL_RADIUS_RATE, CULL_MIN_RADIUS);
+
+    D3DXVECTOR3 center = m_pos;
+    center.y += fHalfHeight;
+
+    return CCulling::IsVisibleSphere(center, fRadius, CCulling::TYPE_CHARACTER);
+}
+//=============================================================================
+// 描画キューに積むかどうかの判定処理(アウトラインを全キャラクター分まとめるため)
+//=============================================================================
+bool CCharacter::IsRenderQueued(void) const
+{
+    return CManager::GetRenderer()->GetRenderQueue()->IsEnable();
+}
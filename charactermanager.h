@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// LN^[}l[W[ [charactermanager.h]
+// キャラクターマネージャー処理 [charactermanager.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,17 +8,18 @@
 #define _CHARACTERMANAGER_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
+#include "memorymanager.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CGuage;
 
 //*****************************************************************************
-// LN^[NX
+// キャラクタークラス
 //*****************************************************************************
 class CCharacter : public CObject
 {
@@ -31,39 +32,45 @@ public:
     virtual void Update(void) = 0;
     virtual void Draw(void) = 0;
 
-    // 蔻̐
+    // 当たり判定の生成
     void CreatePhysics(float radius, float height, btScalar mass);
 
-    // Physics̔j
+    // Physicsの破棄
     void ReleasePhysics(void);
 
-    // 蔻̈ʒuXV
+    // 当たり判定の位置更新
     void UpdateCollider(D3DXVECTOR3 offset);
 
-    // ԏ
+    // 向き補間処理
     void UpdateRotation(float fInterpolationSpeed);
 
-    // HPQ[W̐ݒ菈
+    // HPゲージの設定処理
     void SetGuages(D3DXVECTOR3 pos, D3DXCOLOR colHP, D3DXCOLOR colBack, float fWidth, float fHeight);
 
-    // _[W
+    // 画面内かどうかの判定処理
+    bool IsInView(void);
+
+    // パーツは描画キューに積むので、続くキャラクターとまとめて描く
+    bool IsRenderQueued(void) const override;
+
+    // ダメージ処理
     virtual void Damage(float fDamage)
     {
         if (m_isDead)
         {
-            return; // łɎłΏȂ
+            return; // すでに死んでいれば処理しない
         }
 
         m_fHp -= fDamage;
 
         if (m_fHp <= 0.0f)
         {
-            m_isDead = true;// 
+            m_isDead = true;// 死んだ
             m_fHp = 0.0f;
         }
     }
 
-    // 񕜏
+    // 回復処理
     void Heal(float fHealAmount)
     {
         m_fHp += fHealAmount;
@@ -75,12 +82,12 @@ public:
     }
 
     //*****************************************************************************
-    // flagment֐
+    // flagment関数
     //*****************************************************************************
     bool IsDead(void) { return m_isDead; }
 
     //*****************************************************************************
-    // setter֐
+    // setter関数
     //*****************************************************************************
     void SetHp(float fHp) { m_fHp = fHp; m_fMaxHp = m_fHp; }
     void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
@@ -91,7 +98,7 @@ public:
     {
         m_move = move; 
 
-        // Wbh{fBɔf
+        // リジッドボディに反映
         btVector3 velocity = GetRigidBody()->getLinearVelocity();
         velocity.setX(move.x);
         //velocity.setY(0.0f);
@@ -100,7 +107,7 @@ public:
     }
 
     //*****************************************************************************
-    // getter֐
+    // getter関数
     //*****************************************************************************
     D3DXVECTOR3 GetPos(void) { return m_pos; }
     D3DXVECTOR3 GetRot(void) { return m_rot; };
@@ -111,52 +118,55 @@ public:
     float GetMaxHp(void) const { return m_fMaxHp; }
     btScalar GetRadius(void) const { return m_radius; }
     btScalar GetHeight(void) const { return m_height; }
-    btRigidBody* GetRigidBody(void) const { return m_pRigidBody; }						// RigidBody̎擾
+    btRigidBody* GetRigidBody(void) const { return m_pRigidBody; }						// RigidBodyの取得
     btCollisionShape* GetCollisionShape(void) { return m_pShape; }
     D3DXVECTOR3 GetColliderPos(void) const { return m_colliderPos; }
-    virtual int GetCollisionFlags(void) const { return 0; }// ftHg̓tOȂ
+    virtual int GetCollisionFlags(void) const { return 0; }// デフォルトはフラグなし
 
 private:
+    static constexpr float CULL_RADIUS_RATE = 2.0f;    // カリング用の半径の倍率(モーションや武器ではみ出す分)
+    static constexpr float CULL_MIN_RADIUS  = 50.0f;   // カリング用の半径の最小値
+
 	float               m_fHp;          // HP
-	float               m_fMaxHp;       // HPő
-    bool                m_isDead;       // 񂾂ǂ
-	CGuage*             m_pHpGuage;		// ΃Q[W
-	CGuage*             m_pBackGuage;	// ԃQ[WixĒǏ]j
-	CGuage*             m_pFrame;		// g
-    D3DXVECTOR3         m_pos;			// ʒu
-    D3DXVECTOR3         m_rot;			// 
-    D3DXVECTOR3         m_rotDest;		// 
-    D3DXVECTOR3         m_size;			// TCY
-    D3DXVECTOR3         m_move;			// ړ
-    btRigidBody*        m_pRigidBody;	// ̂ւ̃|C^
-    btCollisionShape*   m_pShape;	    // 蔻̌`ւ̃|C^
-    btScalar            m_radius;		// JvZRC_[̔a
-    btScalar            m_height;		// JvZRC_[̍
-    D3DXVECTOR3         m_colliderPos;	// JvZRC_[̈ʒu
+	float               m_fMaxHp;       // HP最大量
+    bool                m_isDead;       // 死んだかどうか
+	CGuage*             m_pHpGuage;		// 緑ゲージ
+	CGuage*             m_pBackGuage;	// 赤ゲージ（遅れて追従）
+	CGuage*             m_pFrame;		// 枠
+    D3DXVECTOR3         m_pos;			// 位置
+    D3DXVECTOR3         m_rot;			// 向き
+    D3DXVECTOR3         m_rotDest;		// 向き
+    D3DXVECTOR3         m_size;			// サイズ
+    D3DXVECTOR3         m_move;			// 移動量
+    btRigidBody*        m_pRigidBody;	// 剛体へのポインタ
+    btCollisionShape*   m_pShape;	    // 当たり判定の形へのポインタ
+    btScalar            m_radius;		// カプセルコライダーの半径
+    btScalar            m_height;		// カプセルコライダーの高さ
+    D3DXVECTOR3         m_colliderPos;	// カプセルコライダーの位置
 
 };
 
 //*****************************************************************************
-// LN^[}l[W[NX
+// キャラクターマネージャークラス
 //*****************************************************************************
 class CCharacterManager
 {
 public:
-    // CX^X̎擾
+    // インスタンスの取得
     static CCharacterManager& GetInstance(void)
     {
         static CCharacterManager instance;
         return instance;
     }
 
-    // LN^[ǉ
+    // キャラクター追加処理
     void AddCharacter(CCharacter* pChar)
     {
-        // Xgɒǉ
+        // リストに追加する
         m_characters.push_back(pChar);
     }
 
-    // P̃LN^[̎擾
+    // 単体キャラクターの取得処理
     template <class characterType>
     characterType* GetCharacter(void)
     {
@@ -170,11 +180,14 @@ public:
         return nullptr;
     }
 
-    // ̃LN^[̎擾
+    // 複数体キャラクターの取得処理
     template <class characterType>
-    std::vector<characterType*> GetCharacters(void)
+    FrameVector<characterType*> GetCharacters(void)
     {
-        std::vector<characterType*> result;
+        // 毎フレーム呼ばれるので結果はフレームアロケーターに置く
+        FrameVector<characterType*> result;
+        result.reserve(m_characters.size());
+
         for (auto* c : m_characters)
         {
             if (auto* casted = dynamic_cast<characterType*>(c))
@@ -189,14 +202,14 @@ public:
     {
         for (auto chara : m_characters)
         {
-            // LN^[̏
+            // キャラクターの初期化処理
             chara->Init();
         }
     }
 
     void Destroy(void)
     {
-        // Xg̃NA(ɂ)
+        // リストのクリア(空にする)
         m_characters.clear();
     }
 
@@ -204,7 +217,7 @@ public:
     {
         for (auto chara : m_characters)
         {
-            // LN^[̍XV
+            // キャラクターの更新処理
             chara->Update();
         }
     }
@@ -213,7 +226,7 @@ public:
     {
         for (auto chara : m_characters)
         {
-            // LN^[̕`揈
+            // キャラクターの描画処理
             chara->Draw();
         }
     }
@@ -225,7 +238,7 @@ private:
     CCharacterManager(const CCharacterManager&) = delete;
     CCharacterManager& operator=(const CCharacterManager&) = delete;
 
-    std::vector<CCharacter*> m_characters;// LN^[̃Xg
+    std::vector<CCharacter*> m_characters;// キャラクターのリスト
 };
 
 #endif
@@ -1,28 +1,28 @@
 //=============================================================================
 //
-// 蔻菈 [collisionUtils.cpp]
+// 当たり判定処理 [collisionUtils.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "collisionUtils.h"
 
 
 //=============================================================================
-// V_[AABB̓蔻(̋Ԃ)
+// シリンダーとAABBの当たり判定(その距離を返す)
 //=============================================================================
 bool CCollision::CheckCylinderAABBCollisionWithHitDistance(
 	const D3DXVECTOR3& cylinderCenter, float cylinderRadius, float cylinderHeight, const D3DXVECTOR3& cylinderDir,
 	const D3DXVECTOR3& aabbMin, const D3DXVECTOR3& aabbMax,
 	float* outHitDistance)
 {
-	// V_[̃xNg
+	// シリンダー軸方向のベクトル
 	D3DXVECTOR3 axis = cylinderDir;
 
-	// AABB8_擾
+	// AABBの8頂点を取得
 	D3DXVECTOR3 verts[8] =
 	{
 		{aabbMin.x, aabbMin.y, aabbMin.z},
@@ -35,7 +35,7 @@ bool CCollision::CheckCylinderAABBCollisionWithHitDistance(
 		{aabbMax.x, aabbMax.y, aabbMax.z},
 	};
 
-	// _QɎˉečŏő߂i͈̔́j
+	// 頂点群を軸方向に射影して最小最大を求める（軸方向の範囲）
 	float minProj = FLT_MAX;
 	float maxProj = -FLT_MAX;
 	for (int nCnt = 0; nCnt < 8; nCnt++)
@@ -46,24 +46,24 @@ bool CCollision::CheckCylinderAABBCollisionWithHitDistance(
 		if (proj > maxProj) maxProj = proj;
 	}
 
-	// ̋
+	// 軸方向の距離判定
 	float halfHeight = cylinderHeight * 0.5f;
 
 	if (maxProj < -halfHeight || minProj > halfHeight)
 	{
-		// ŏdȂȂ
+		// 軸方向で重なりなし
 		return false;
 	}
 
-	// ɔĂ镔̋clampĔ莲̓_擾
+	// 軸方向に被っている部分の距離をclampして判定軸上の点を取得
 	float clampProj = std::max(-halfHeight, std::min(0.5f * (minProj + maxProj), halfHeight));
 	D3DXVECTOR3 closestPointOnAxis = cylinderCenter + axis * clampProj;
 
-	// ɐ2̃xNgvZiV_[ɐj
+	// 軸に垂直な2つのベクトルを計算（シリンダー軸に垂直）
 	D3DXVECTOR3 up = axis;
 	D3DXVECTOR3 right, forward;
 
-	// axisɒxNg1߂
+	// axisに直交するベクトルを1つ決める
 	if (fabs(up.x) < 0.9f)
 	{
 		right = D3DXVECTOR3(1, 0, 0);
@@ -79,7 +79,7 @@ bool CCollision::CheckCylinderAABBCollisionWithHitDistance(
 	D3DXVec3Cross(&forward, &up, &right);
 	D3DXVec3Normalize(&forward, &forward);
 
-	// AABB̒_fʍWnɕϊāAŏő߂i2D`̋Ej
+	// AABBの頂点を断面座標系に変換して、最小最大を求める（2D長方形の境界）
 	float minX = FLT_MAX, maxX = -FLT_MAX;
 	float minY = FLT_MAX, maxY = -FLT_MAX;
 	for (int nCnt = 0; nCnt < 8; nCnt++)
@@ -93,11 +93,11 @@ bool CCollision::CheckCylinderAABBCollisionWithHitDistance(
 		if (y > maxY) maxY = y;
 	}
 
-	// `̍ŋߐړ_~̒SɓeiNvj
+	// 矩形の最近接点を円の中心に投影（クランプ）
 	float closestX = std::max(minX, std::min(0.0f, maxX));
 	float closestY = std::max(minY, std::min(0.0f, maxY));
 
-	// S̋
+	// 中心からの距離
 	float distX = closestX;
 	float distY = closestY;
 
@@ -107,21 +107,21 @@ bool CCollision::CheckCylinderAABBCollisionWithHitDistance(
 	{
 		if (outHitDistance)
 		{
-			// ˈʒu狁߂
-			D3DXVECTOR3 startPos = cylinderCenter + axis * halfHeight;	// [
-			D3DXVECTOR3 hitPos = cylinderCenter + axis * clampProj;		// ʒu
+			// 発射位置から求める
+			D3DXVECTOR3 startPos = cylinderCenter + axis * halfHeight;	// 後端
+			D3DXVECTOR3 hitPos = cylinderCenter + axis * clampProj;		// 当たった位置
 			D3DXVECTOR3 disPos = hitPos - startPos;
 			*outHitDistance = D3DXVec3Length(&disPos);
 		}
 
-		// 蔻肠
+		// 当たり判定あり
 		return true;
 	}
 
 	return false;
 }
 //=============================================================================
-// V_[ƃJvZ̓蔻
+// シリンダーとカプセルの当たり判定
 //=============================================================================
 bool CCollision::CheckCapsuleCylinderCollision_Dir(
 	const D3DXVECTOR3& capsuleCenter, float capsuleRadius, float capsuleHeight,
@@ -132,12 +132,12 @@ bool CCollision::CheckCapsuleCylinderCollision_Dir(
 	float collisionCylinderRadius;
 	float collisionCapsuleRadius;
 
-	// flag͎gȂfalseł
+	// flagは使わなければfalseでいい
 	if (flag)
 	{
-		// ==== ak ====
-		collisionCylinderRadius = cylinderRadius * 0.40f; // ~50%
-		collisionCapsuleRadius = capsuleRadius * 0.85f;   // JvZ90%
+		// ==== 半径を縮小 ====
+		collisionCylinderRadius = cylinderRadius * 0.40f; // 円柱は50%
+		collisionCapsuleRadius = capsuleRadius * 0.85f;   // カプセルは90%
 	}
 	else
 	{
@@ -145,13 +145,13 @@ bool CCollision::CheckCapsuleCylinderCollision_Dir(
 		collisionCapsuleRadius = capsuleRadius;
 	}
 
-	// xNg
+	// ベクトル差
 	D3DXVECTOR3 delta = capsuleCenter - cylinderCenter;
 
-	// Ɏˉe
+	// 軸方向に射影
 	float proj = D3DXVec3Dot(&delta, &cylinderDir);
 
-	// ㋗
+	// 軸上距離判定
 	float halfHeightSum = (capsuleHeight * 0.5f) + (cylinderHeight * 0.5f);
 	float axisDist = 0.0f;
 
@@ -165,15 +165,15 @@ bool CCollision::CheckCapsuleCylinderCollision_Dir(
 	}
 	else
 	{
-		axisDist = 0.0f; // ͏dȂĂ
+		axisDist = 0.0f; // 軸上は重なっている
 	}
 
-	// ʂ̋
+	// 軸直交面の距離
 	D3DXVECTOR3 closestPointOnAxis = cylinderCenter + cylinderDir * proj;
 	D3DXVECTOR3 diff = capsuleCenter - closestPointOnAxis;
 	float radialDist = D3DXVec3Length(&diff);
 
-	// ====  ====
+	// ==== 判定 ====
 	if (axisDist <= collisionCapsuleRadius + collisionCylinderRadius &&
 		radialDist <= collisionCapsuleRadius + collisionCylinderRadius)
 	{
@@ -183,51 +183,51 @@ bool CCollision::CheckCapsuleCylinderCollision_Dir(
 	return false;
 }
 //=============================================================================
-// AABBm̓蔻
+// AABB同士の当たり判定
 //=============================================================================
 bool CCollision::CheckCollisionAABB(D3DXVECTOR3 pos1, D3DXVECTOR3 modelSize1, D3DXVECTOR3 scale1, 
 	D3DXVECTOR3 pos2, D3DXVECTOR3 modelSize2, D3DXVECTOR3 scale2)
 {
 	//=========================================================================
-	// ubN1̏
+	// ブロック1の情報
 	//=========================================================================
 
-	// AABB擾
-	D3DXVECTOR3 Pos_1 = pos1;				// ubN̈ʒu
-	D3DXVECTOR3 ModelSize_1 = modelSize1;	// ubŇ̃TCYiS_j
-	D3DXVECTOR3 Scale_1 = scale1;			// ubN̊g嗦
+	// AABBを取得
+	D3DXVECTOR3 Pos_1 = pos1;				// ブロックの位置
+	D3DXVECTOR3 ModelSize_1 = modelSize1;	// ブロックの元のサイズ（中心原点）
+	D3DXVECTOR3 Scale_1 = scale1;			// ブロックの拡大率
 
-	// TCYɊg嗦Kp
+	// 元サイズに拡大率を適用する
 	D3DXVECTOR3 Size_1;
 	Size_1.x = ModelSize_1.x * Scale_1.x;
 	Size_1.y = ModelSize_1.y * Scale_1.y;
 	Size_1.z = ModelSize_1.z * Scale_1.z;
 
-	// ŏlƍől߂
+	// 最小値と最大値を求める
 	D3DXVECTOR3 Min_1 = Pos_1 - Size_1 * 0.5f;
 	D3DXVECTOR3 Max_1 = Pos_1 + Size_1 * 0.5f;
 
 	//=========================================================================
-	// ubN2̏
+	// ブロック2の情報
 	//=========================================================================
 
-	// AABB擾
-	D3DXVECTOR3 Pos_2 = pos2;				// ubN̈ʒu
-	D3DXVECTOR3 ModelSize_2 = modelSize2;	// ubŇ̃TCYiS_j
-	D3DXVECTOR3 Scale_2 = scale2;			// ubN̊g嗦
+	// AABBを取得
+	D3DXVECTOR3 Pos_2 = pos2;				// ブロックの位置
+	D3DXVECTOR3 ModelSize_2 = modelSize2;	// ブロックの元のサイズ（中心原点）
+	D3DXVECTOR3 Scale_2 = scale2;			// ブロックの拡大率
 
-	// TCYɊg嗦Kp
+	// 元サイズに拡大率を適用する
 	D3DXVECTOR3 Size_2;
 	Size_2.x = ModelSize_2.x * Scale_2.x;
 	Size_2.y = ModelSize_2.y * Scale_2.y;
 	Size_2.z = ModelSize_2.z * Scale_2.z;
 
-	// ŏlƍől߂
+	// 最小値と最大値を求める
 	D3DXVECTOR3 Min_2 = Pos_2 - Size_2 * 0.5f;
 	D3DXVECTOR3 Max_2 = Pos_2 + Size_2 * 0.5f;
 
 	//=========================================================================
-	// AABBm̌`FbN
+	// AABB同士の交差チェック
 	//=========================================================================
 	bool isOverlap =
 		Min_1.x <= Max_2.x && Max_1.x >= Min_2.x &&
@@ -235,28 +235,28 @@ bool CCollision::CheckCollisionAABB(D3DXVECTOR3 pos1, D3DXVECTOR3 modelSize1, D3
 		Min_1.z <= Max_2.z && Max_1.z >= Min_2.z;
 
 	if (isOverlap)
-	{// Ă
+	{// 交差している
 		return true;
 	}
 
 	return false;
 }
 //=============================================================================
-// AABBƃJvZ̓蔻(JvZAABBϊ)
+// AABBとカプセルの当たり判定(カプセルをAABB変換)
 //=============================================================================
 bool CCollision::CheckCapsuleAABBCollision(D3DXVECTOR3 pos, D3DXVECTOR3 modelSize, D3DXVECTOR3 scale, 
 	D3DXVECTOR3 capsulePos, float Radius, float Height)
 {
 	//=========================================================================
-	// ubN1̏
+	// ブロック1の情報
 	//=========================================================================
 
-	// AABB 擾
-	D3DXVECTOR3 Pos = pos;				// ubN̈ʒu
-	D3DXVECTOR3 ModelSize = modelSize;	// ubŇ̃TCYiS_j
-	D3DXVECTOR3 Scale = scale;			// ubN̊g嗦
+	// AABB を取得
+	D3DXVECTOR3 Pos = pos;				// ブロックの位置
+	D3DXVECTOR3 ModelSize = modelSize;	// ブロックの元のサイズ（中心原点）
+	D3DXVECTOR3 Scale = scale;			// ブロックの拡大率
 
-	// TCYɊg嗦Kp
+	// 元サイズに拡大率を適用する
 	D3DXVECTOR3 Size;
 	Size.x = modelSize.x * scale.x;
 	Size.y = modelSize.y * scale.y;
@@ -266,21 +266,21 @@ bool CCollision::CheckCapsuleAABBCollision(D3DXVECTOR3 pos, D3DXVECTOR3 modelSiz
 	D3DXVECTOR3 Max = Pos + Size * 0.5f;
 
 	//=========================================================================
-	// JvZRC_[̏
+	// カプセルコライダーの情報
 	//=========================================================================
 
-	// JvZRC_[̃TCYAABBTCYvZ
+	// カプセルコライダーのサイズからAABBサイズを計算
 	D3DXVECTOR3 pSize;
 	pSize.x = Radius * 2.0f;
 	pSize.z = Radius * 2.0f;
 	pSize.y = Height + Radius * 2.0f;
 
-	// ŏlƍől߂
+	// 最小値と最大値を求める
 	D3DXVECTOR3 pMin = capsulePos - pSize * 0.5f;
 	D3DXVECTOR3 pMax = capsulePos + pSize * 0.5f;
 
 	//=========================================================================
-	// `FbN
+	// 交差チェック
 	//=========================================================================
 	bool isOverlap =
 		Min.x <= pMax.x && Max.x >= pMin.x &&
@@ -288,36 +288,36 @@ bool CCollision::CheckCapsuleAABBCollision(D3DXVECTOR3 pos, D3DXVECTOR3 modelSiz
 		Min.z <= pMax.z && Max.z >= pMin.z;
 
 	if (isOverlap)
-	{// Ă
+	{// 交差している
 		return true;
 	}
 
 	return false;
 }
 //=============================================================================
-// OBBm̓蔻
+// OBB同士の当たり判定
 //=============================================================================
 bool CCollision::CheckCollisionOBB(const CBoxCollider* obb1, const CBoxCollider* obb2)
 {
-	// eOBB̉]s
+	// 各OBBの回転行列
 	const D3DXMATRIX& R1 = obb1->GetRotation();
 	const D3DXMATRIX& R2 = obb2->GetRotation();
 
 	D3DXVECTOR3 Axis1[3] =
 	{
-		{R1._11,R1._12,R1._13},// X
-		{R1._21,R1._22,R1._23},// Y
-		{R1._31,R1._32,R1._33},// Z
+		{R1._11,R1._12,R1._13},// X軸
+		{R1._21,R1._22,R1._23},// Y軸
+		{R1._31,R1._32,R1._33},// Z軸
 	};
 
 	D3DXVECTOR3 Axis2[3] =
 	{
-		{R2._11,R2._12,R2._13},// X
-		{R2._21,R2._22,R2._23},// Y
-		{R2._31,R2._32,R2._33},// Z
+		{R2._11,R2._12,R2._13},// X軸
+		{R2._21,R2._22,R2._23},// Y軸
+		{R2._31,R2._32,R2._33},// Z軸
 	};
 
-	// 15̎Ń`FbN (3+3+9)
+	// 15個の軸でチェック (3+3+9)
 	for (int nCnt = 0; nCnt < 3; nCnt++)
 	{
 		if (!OverlapOnAxis(obb1, obb2, Axis1[nCnt])) return false;
@@ -330,7 +330,7 @@ bool CCollision::CheckCollisionOBB(const CBoxCollider* obb1, const CBoxCollider*
 		{
 			D3DXVECTOR3 axis;
 			D3DXVec3Cross(&axis, &Axis1[nCnt], &Axis2[nCnt2]);
-			if (D3DXVec3LengthSq(&axis) > 1e-6f) // قڃ[xNg͏O
+			if (D3DXVec3LengthSq(&axis) > 1e-6f) // ほぼゼロベクトルは除外
 			{
 				if (!OverlapOnAxis(obb1, obb2, axis))
 				{
@@ -340,23 +340,23 @@ bool CCollision::CheckCollisionOBB(const CBoxCollider* obb1, const CBoxCollider*
 		}
 	}
 
-	return true; // SďdȂĂ
+	return true; // 全て重なっている
 }
 //=============================================================================
-// OBBƃJvZ̓蔻
+// OBBとカプセルの当たり判定
 //=============================================================================
 bool CCollision::CheckCapsuleOBBCollision(const CCapsuleCollider* capsule, const CBoxCollider* obb)
 {
-	// JvZS̒[_i[hWj
+	// カプセル中心線の端点（ワールド座標）
 	D3DXVECTOR3 capCenter = capsule->GetPosition();
 	float h = capsule->GetHeight() * 0.5f;
 
 	D3DXVECTOR3 capA = capCenter + D3DXVECTOR3(0, h, 0);
 	D3DXVECTOR3 capB = capCenter - D3DXVECTOR3(0, h, 0);
 
-	// OBB̃[JԂ֕ϊ
+	// OBBのローカル空間へ変換
 	D3DXMATRIX invRot;
-	D3DXMatrixTranspose(&invRot, &obb->GetRotation()); // ]s̋t = ]u
+	D3DXMatrixTranspose(&invRot, &obb->GetRotation()); // 回転行列の逆 = 転置
 	D3DXVECTOR3 obbCenter = obb->GetPosition();
 	D3DXVECTOR3 halfSize = obb->GetSize() * 0.5f;
 
@@ -365,16 +365,16 @@ bool CCollision::CheckCapsuleOBBCollision(const CCapsuleCollider* capsule, const
 	D3DXVec3TransformNormal(&localA, &localA, &invRot);
 	D3DXVec3TransformNormal(&localB, &localB, &invRot);
 
-	// JvZAABB̍ŋߐړ_߂
+	// カプセル線分とAABBの最近接点を求める
 	D3DXVECTOR3 closest = ClosestPointSegmentAABB(localA, localB, -halfSize, halfSize);
 
-	// ŋߐړ_ƃJvZ̋
+	// 最近接点とカプセル線分の距離
 	float distSq = DistanceSqPointSegment(closest, localA, localB);
 
 	return distSq <= (capsule->GetRadius() * capsule->GetRadius());
 }
 //=============================================================================
-// ƃJvZ̓蔻
+// 線分とカプセルの当たり判定
 //=============================================================================
 bool CCollision::IntersectSegmentCapsule(
 	const D3DXVECTOR3& segA,
@@ -383,7 +383,7 @@ bool CCollision::IntersectSegmentCapsule(
 	const D3DXVECTOR3& capsuleTop,
 	float radius)
 {
-	// ŒZ2_vZ
+	// 最短距離の2点を計算
 	D3DXVECTOR3 p1, p2;
 	float distSqr = DistanceSqSegmentSegment(segA, segB, capsuleBottom, capsuleTop, &p1, &p2);
 
@@ -391,7 +391,7 @@ bool CCollision::IntersectSegmentCapsule(
 }
 
 //=============================================================================
-// _Ɛ̍ŋߐڋԂ֐
+// 点と線分の最近接距離を返す関数
 //=============================================================================
 float CCollision::DistanceSqPointSegment(const D3DXVECTOR3& p, const D3DXVECTOR3& a, const D3DXVECTOR3& b)
 {
@@ -404,12 +404,12 @@ float CCollision::DistanceSqPointSegment(const D3DXVECTOR3& p, const D3DXVECTOR3
 	return D3DXVec3LengthSq(&dis);
 }
 //=============================================================================
-// AABB̍ŋߐړ_
+// 線分とAABBの最近接点
 //=============================================================================
 D3DXVECTOR3 CCollision::ClosestPointSegmentAABB(const D3DXVECTOR3& a, const D3DXVECTOR3& b,
 	const D3DXVECTOR3& minVal, const D3DXVECTOR3& maxVal)
 {
-	// ̒_āAAABBɃNv(Ȉ)
+	// 線分の中点を取って、AABBにクランプする(簡易)
 	D3DXVECTOR3 mid = (a + b) * 0.5f;
 	D3DXVECTOR3 result = mid;
 	result.x = std::max(minVal.x, std::min(result.x, maxVal.x));
@@ -418,32 +418,32 @@ D3DXVECTOR3 CCollision::ClosestPointSegmentAABB(const D3DXVECTOR3& a, const D3DX
 	return result;
 }
 //=============================================================================
-// OBB  axis ɓe min/max Ԃ֐
+// OBB を axis に投影して min/max を返す関数
 //=============================================================================
 void CCollision::ProjectOBB(const CBoxCollider* obb, const D3DXVECTOR3& axis,
 	float& outMin, float& outMax)
 {
-	// K
+	// 正規化
 	D3DXVECTOR3 nAxis;
 	D3DXVec3Normalize(&nAxis, &axis);
 
-	// OBB
+	// OBB情報
 	D3DXVECTOR3 center = obb->GetPosition();
 	D3DXVECTOR3 half = obb->GetSize() * 0.5f;
 	const D3DXMATRIX& R = obb->GetRotation();
 
-	// [Jo
+	// ローカル軸を取り出す
 	D3DXVECTOR3 obbAxis[3] =
 	{
-		{ R._11, R._12, R._13 },// X
-		{ R._21, R._22, R._23 },// Y
-		{ R._31, R._32, R._33 }	// Z
+		{ R._11, R._12, R._13 },// X軸
+		{ R._21, R._22, R._23 },// Y軸
+		{ R._31, R._32, R._33 }	// Z軸
 	};
 
-	// S𓊉e
+	// 中心を投影
 	float centerProj = D3DXVec3Dot(&center, &nAxis);
 
-	// e̊^ = (a * cos)
+	// 各軸方向の寄与 = (半径 * cosθ)
 	float r = 0.0f;
 	for (int nCnt = 0; nCnt < 3; nCnt++)
 	{
@@ -456,7 +456,7 @@ void CCollision::ProjectOBB(const CBoxCollider* obb, const D3DXVECTOR3& axis,
 }
 
 //=============================================================================
-// 2OBBw莲ŏdȂ邩肷֐
+// 2つのOBBが指定軸上で重なるか判定する関数
 //=============================================================================
 bool CCollision::OverlapOnAxis(const CBoxCollider* obb1, const CBoxCollider* obb2,
 	const D3DXVECTOR3& axis)
@@ -470,31 +470,31 @@ bool CCollision::OverlapOnAxis(const CBoxCollider* obb1, const CBoxCollider* obb
 	return !(max1 < min2 || max2 < min1);
 }
 //=============================================================================
-// 2̐ (p1-q1, p2-q2) Ԃ̍ŒZ̓vZ鏈
-// outClosestPoint1, outClosestPoint2 ͍ŋߐړ_Ԃ
+// 2つの線分 (p1-q1, p2-q2) 間の最短距離の二乗を計算する処理
+// outClosestPoint1, outClosestPoint2 は最近接点を返す
 //=============================================================================
 float CCollision::DistanceSqSegmentSegment(
-	const D3DXVECTOR3& p1, const D3DXVECTOR3& q1,// 1̒[_
-	const D3DXVECTOR3& p2, const D3DXVECTOR3& q2,// 2̒[_
+	const D3DXVECTOR3& p1, const D3DXVECTOR3& q1,// 線分1の端点
+	const D3DXVECTOR3& p2, const D3DXVECTOR3& q2,// 線分2の端点
 	D3DXVECTOR3* outClosestPoint1,
 	D3DXVECTOR3* outClosestPoint2)
 {
-	D3DXVECTOR3 d1 = q1 - p1;	// 1̃xNg
-	D3DXVECTOR3 d2 = q2 - p2;	// 2̃xNg
-	D3DXVECTOR3 r = p1 - p2;	// 1̎n_Ɛ2̎n_̍
+	D3DXVECTOR3 d1 = q1 - p1;	// 線分1のベクトル
+	D3DXVECTOR3 d2 = q2 - p2;	// 線分2のベクトル
+	D3DXVECTOR3 r = p1 - p2;	// 線分1の始点と線分2の始点の差
 
-	float a = D3DXVec3Dot(&d1, &d1);	// 1̒2
-	float e = D3DXVec3Dot(&d2, &d2);	// 2̒2
-	float f = D3DXVec3Dot(&d2, &r);		// 2Ɛ1n_̍̓
+	float a = D3DXVec3Dot(&d1, &d1);	// 線分1の長さの2乗
+	float e = D3DXVec3Dot(&d2, &d2);	// 線分2の長さの2乗
+	float f = D3DXVec3Dot(&d2, &r);		// 線分2と線分1始点の差の内積
 
 	float s, t;
 
-	const float EPS = 1e-6f;// liقړ_̏ꍇ̔pj
+	const float EPS = 1e-6f;// 小さい値（線分がほぼ点の場合の判定用）
 
-	// ̐قړ_̏ꍇ
+	// 両方の線分がほぼ点の場合
 	if (a <= EPS && e <= EPS)
 	{
-		// ̐_
+		// 両方の線分が点
 		s = t = 0.0f;
 		if (outClosestPoint1)
 		{
@@ -506,31 +506,31 @@ float CCollision::DistanceSqSegmentSegment(
 		}
 
 		D3DXVECTOR3 distance = p1 - p2;
-		return D3DXVec3LengthSq(&distance);// 2_Ԃ̋2Ԃ
+		return D3DXVec3LengthSq(&distance);// その2点間の距離の2乗を返す
 	}
 
-	// 1قړ_̏ꍇ
+	// 線分1がほぼ点の場合
 	if (a <= EPS)
 	{
 		s = 0.0f;
-		t = f / e;// 2Ő1_ɍł߂_̃p[^
-		t = std::max(0.0f, std::min(1.0f, t));// ͈͂ɃNv
+		t = f / e;// 線分2上で線分1点に最も近い点のパラメータ
+		t = std::max(0.0f, std::min(1.0f, t));// 線分範囲にクランプ
 	}
 	else
 	{
-		float c = D3DXVec3Dot(&d1, &r);// 1Ɛ1n_2̓
+		float c = D3DXVec3Dot(&d1, &r);// 線分1と線分1始点→線分2差の内積
 
-		// 2قړ_̏ꍇ
+		// 線分2がほぼ点の場合
 		if (e <= EPS)
 		{
 			t = 0.0f;
-			s = -c / a;// 1Ő2_ɍł߂_̃p[^
-			s = std::max(0.0f, std::min(1.0f, s));// ͈͂ɃNv
+			s = -c / a;// 線分1上で線分2点に最も近い点のパラメータ
+			s = std::max(0.0f, std::min(1.0f, s));// 線分範囲にクランプ
 		}
 		else
 		{
-			// 
-			float b = D3DXVec3Dot(&d1, &d2);// Ԃ̕xNg̓
+			// 両方線分
+			float b = D3DXVec3Dot(&d1, &d2);// 線分間の方向ベクトルの内積
 			float denom = a * e - b * b;
 
 			if (denom != 0.0f)
@@ -539,14 +539,14 @@ float CCollision::DistanceSqSegmentSegment(
 			}
 			else
 			{
-				s = 0.0f; // sȏꍇ0Œ
+				s = 0.0f; // 平行な場合は0固定
 			}
 
-			s = std::max(0.0f, std::min(1.0f, s));// ͈͂ɃNv
+			s = std::max(0.0f, std::min(1.0f, s));// 線分範囲にクランプ
 
 			t = (b * s + f) / e;
 
-			// 2͈̔͊OȂĒ
+			// 線分2の範囲外なら再調整
 			if (t < 0.0f)
 			{
 				t = 0.0f;
@@ -560,20 +560,20 @@ float CCollision::DistanceSqSegmentSegment(
 		}
 	}
 
-	// ŋߐړ_vZ
+	// 最近接点を計算
 	D3DXVECTOR3 c1 = p1 + d1 * s;
 	D3DXVECTOR3 c2 = p2 + d2 * t;
 
 	if (outClosestPoint1)
 	{
-		*outClosestPoint1 = c1;// 1̍ŋߐړ_
+		*outClosestPoint1 = c1;// 線分1の最近接点
 	}
 	if (outClosestPoint2)
 	{
-		*outClosestPoint2 = c2;// 2̍ŋߐړ_
+		*outClosestPoint2 = c2;// 線分2の最近接点
 	}
 
-	// ŋߐړ_Ԃ̋2Ԃ
+	// 最近接点間の距離の2乗を返す
 	D3DXVECTOR3 diff = c1 - c2;
 	return D3DXVec3LengthSq(&diff);
 }
\ No newline at end of file
@@ -1,53 +1,53 @@
 //=============================================================================
 //
-// 蔻菈 [collisionUtils.h]
+// 当たり判定処理 [collisionUtils.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _COLLISIONUTILS_H_// ̃}N`ĂȂ
-#define _COLLISIONUTILS_H_// 2dCN[hh~̃}N`
+#ifndef _COLLISIONUTILS_H_// このマクロ定義がされていなかったら
+#define _COLLISIONUTILS_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CBoxCollider;
 class CCapsuleCollider;
 class CCylinderCollider;
 
 //*****************************************************************************
-// 蔻NX
+// 当たり判定クラス
 //*****************************************************************************
 class CCollision
 {
 public:
 
-	// V_[AABB̓蔻(̋Ԃ)
+	// シリンダーとAABBの当たり判定(その距離を返す)
 	static bool CheckCylinderAABBCollisionWithHitDistance(
 		const D3DXVECTOR3& cylinderCenter, float cylinderRadius, float cylinderHeight, const D3DXVECTOR3& cylinderDir,
 		const D3DXVECTOR3& aabbMin, const D3DXVECTOR3& aabbMax,
 		float* outHitDistance);
 
-	// V_[ƃJvZ̓蔻
+	// シリンダーとカプセルの当たり判定
 	static bool CheckCapsuleCylinderCollision_Dir(
 		const D3DXVECTOR3& capsuleCenter, float capsuleRadius, float capsuleHeight,
 		const D3DXVECTOR3& cylinderCenter, float cylinderRadius, float cylinderHeight,
 		const D3DXVECTOR3& cylinderDir, bool flag);
 
-	// AABBm̓蔻
+	// AABB同士の当たり判定
 	static bool CheckCollisionAABB(D3DXVECTOR3 pos1, D3DXVECTOR3 modelSize1, D3DXVECTOR3 scale1,
 		D3DXVECTOR3 pos2, D3DXVECTOR3 modelSize2, D3DXVECTOR3 scale2);
 
-	// AABBƃJvZ̓蔻(JvZAABBϊ)
+	// AABBとカプセルの当たり判定(カプセルをAABB変換)
 	static bool CheckCapsuleAABBCollision(D3DXVECTOR3 pos, D3DXVECTOR3 modelSize, D3DXVECTOR3 scale,
 		D3DXVECTOR3 capsulePos, float Radius, float Height);
 
-	// OBBm̓蔻
+	// OBB同士の当たり判定
 	static bool CheckCollisionOBB(const CBoxCollider* obb1, const CBoxCollider* obb2);
 
-	// JvZOBB̓蔻
+	// カプセルとOBBの当たり判定
 	static bool CheckCapsuleOBBCollision(const CCapsuleCollider* capsule, const CBoxCollider* obb);
 
-	// ƃJvZ̓蔻
+	// 線分とカプセルの当たり判定
 	static bool IntersectSegmentCapsule(
 		const D3DXVECTOR3& segA,
 		const D3DXVECTOR3& segB,
@@ -57,14 +57,14 @@ public:
 
 private:
 	//*************************************************************************
-	// ⏕֐
+	// 補助関数
 	//*************************************************************************
 
-	// OBB  axis ɓe min/max Ԃ֐
+	// OBB を axis に投影して min/max を返す関数
 	static void ProjectOBB(const CBoxCollider* obb, const D3DXVECTOR3& axis,
 		float& outMin, float& outMax);
 
-	// 2OBBw莲ŏdȂ邩肷֐
+	// 2つのOBBが指定軸上で重なるか判定する関数
 	static bool OverlapOnAxis(const CBoxCollider* obb1, const CBoxCollider* obb2,
 		const D3DXVECTOR3& axis);
 
@@ -73,8 +73,8 @@ private:
 	static D3DXVECTOR3 ClosestPointSegmentAABB(const D3DXVECTOR3& a, const D3DXVECTOR3& b,
 		const D3DXVECTOR3& minVal, const D3DXVECTOR3& maxVal);
 
-	// 2̐ (p1-q1, p2-q2) Ԃ̍ŒZ̓vZ鏈
-	// outClosestPoint1, outClosestPoint2 ͍ŋߐړ_Ԃ
+	// 2つの線分 (p1-q1, p2-q2) 間の最短距離の二乗を計算する処理
+	// outClosestPoint1, outClosestPoint2 は最近接点を返す
 	static float DistanceSqSegmentSegment(
 		const D3DXVECTOR3& p1, const D3DXVECTOR3& q1,
 		const D3DXVECTOR3& p2, const D3DXVECTOR3& q2,
@@ -84,16 +84,16 @@ private:
 
 
 //*****************************************************************************
-// RC_[NX
+// コライダークラス
 //*****************************************************************************
 class CCollider
 {
 public:
 	enum TYPE
 	{
-		TYPE_BOX,		// {bNXRC_[
-		TYPE_CAPSULE,	// JvZRC_[
-		TYPE_CYLINDER,	// V_[RC_[
+		TYPE_BOX,		// ボックスコライダー
+		TYPE_CAPSULE,	// カプセルコライダー
+		TYPE_CYLINDER,	// シリンダーコライダー
 	};
 
 	CCollider(TYPE type) : m_Type(type) {}
@@ -101,7 +101,7 @@ public:
 
 	TYPE GetType(void) const { return m_Type; }
 
-	// [hʒuXV
+	// ワールド位置を更新する
 	virtual void SetPosition(const D3DXVECTOR3& pos) { m_Position = pos; }
 	virtual const D3DXVECTOR3& GetPosition(void) const { return m_Position; }
 
@@ -111,26 +111,26 @@ protected:
 };
 
 //*****************************************************************************
-// {bNXRC_[(OBB)NX
+// ボックスコライダー(OBB)クラス
 //*****************************************************************************
 class CBoxCollider : public CCollider
 {
 public:
-	CBoxCollider(const D3DXVECTOR3& size)// size : TCY
+	CBoxCollider(const D3DXVECTOR3& size)// size : 元サイズ
 	: CCollider(TYPE_BOX), m_Size(size) {}
 
-	// ʒuƉ]̔f
+	// 位置と回転の反映
 	void UpdateTransform(const D3DXVECTOR3& pos, const D3DXVECTOR3& rotRad, const D3DXVECTOR3& scale)
 	{
-		// TCY = fTCY ~ XP[
+		// 実サイズ = モデル元サイズ × スケール
 		m_ScaledSize.x = m_Size.x * scale.x;
 		m_ScaledSize.y = m_Size.y * scale.y;
 		m_ScaledSize.z = m_Size.z * scale.z;
 
-		// ʒu
+		// 位置
 		m_Position = pos;
 
-		// ]s
+		// 回転行列
 		D3DXMatrixRotationYawPitchRoll(&m_Rotation, rotRad.y, rotRad.x, rotRad.z);
 	}
 
@@ -138,13 +138,13 @@ public:
 	const D3DXMATRIX& GetRotation(void) const { return m_Rotation; }
 
 private:
-	D3DXVECTOR3 m_Size;			// EEs
-	D3DXVECTOR3 m_ScaledSize;	// g嗦fTCY
-	D3DXMATRIX  m_Rotation;		// OBBp̉]s
+	D3DXVECTOR3 m_Size;			// 幅・高さ・奥行き
+	D3DXVECTOR3 m_ScaledSize;	// 拡大率反映後サイズ
+	D3DXMATRIX  m_Rotation;		// OBB用の回転行列
 };
 
 //*****************************************************************************
-// JvZRC_[NX
+// カプセルコライダークラス
 //*****************************************************************************
 class CCapsuleCollider : public CCollider
 {
@@ -161,7 +161,7 @@ private:
 };
 
 //*****************************************************************************
-// V_[RC_[NX
+// シリンダーコライダークラス
 //*****************************************************************************
 class CCylinderCollider : public CCollider
 {
@@ -176,7 +176,7 @@ public:
 private:
 	float m_fRadius;
 	float m_fHeight;
-	D3DXVECTOR3 m_Dir;  // 
+	D3DXVECTOR3 m_Dir;  // 軸方向
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,446 @@
+//=============================================================================
+//
+// 視錐台カリング処理 [culling.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "culling.h"
+#include "telemetry.h"
+#include "random"
+#include "unordered_map"
+
+//*****************************************************************************
+// 定数定義
+//*****************************************************************************
+namespace
+{
+	// ベンチマークの設定
+	const int	BENCH_NUM_SIDE		= 200;		// 1辺に並べるオブジェクト数
+	const float	BENCH_SPACING		= 40.0f;	// オブジェクトの間隔
+	const float	BENCH_MIN_RADIUS	= 10.0f;	// 半径の最小値
+	const float	BENCH_MAX_RADIUS	= 60.0f;	// 半径の最大値
+	const int	BENCH_NUM_VIEW		= 64;		// 計測するカメラの向きの数
+	const int	BENCH_NUM_LOOP		= 8;		// 1つの向きで繰り返す回数
+	const float	BENCH_CAMERA_HEIGHT	= 300.0f;	// カメラの高さ
+	const float	BENCH_FOV			= 80.0f;	// 視野角(CCameraと合わせる)
+	const float	BENCH_NEAR			= 1.0f;		// 近クリップ面
+	const float	BENCH_FAR			= 3500.0f;	// 遠クリップ面
+}
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+CFrustum CCulling::m_frustum;
+D3DXVECTOR3 CCulling::m_posV = INIT_VEC3;
+float CCulling::m_fProjScale = 1.0f;
+float CCulling::m_afFarDistance[CCulling::TYPE_MAX] =
+{
+	0.0f,		// ブロック(遠クリップ面まで)
+	1800.0f,	// 小物
+	3000.0f,	// キャラクター
+	1500.0f,	// エフェクト
+	0.0f,		// 地形の区画(遠クリップ面まで)
+};
+unsigned int CCulling::m_nFrame = 0;
+bool CCulling::m_bValid = false;
+bool CCulling::m_bEnable = true;
+
+//=============================================================================
+// 視錐台のコンストラクタ
+//=============================================================================
+CFrustum::CFrustum()
+{
+	// 値のクリア
+	memset(m_aPlane, 0, sizeof(m_aPlane));	// 視錐台の平面
+}
+//=============================================================================
+// 視錐台のデストラクタ
+//=============================================================================
+CFrustum::~CFrustum()
+{
+	// なし
+}
+//=============================================================================
+// 平面の作成処理
+//=============================================================================
+void CFrustum::Build(const D3DXMATRIX& m)
+{
+	// 左
+	m_aPlane[0] = D3DXPLANE(m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41);
+
+	// 右
+	m_aPlane[1] = D3DXPLANE(m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41);
+
+	// 下
+	m_aPlane[2] = D3DXPLANE(m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42);
+
+	// 上
+	m_aPlane[3] = D3DXPLANE(m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42);
+
+	// 近(DirectXはZが0～1なので3列目そのまま)
+	m_aPlane[4] = D3DXPLANE(m._13, m._23, m._33, m._43);
+
+	// 遠
+	m_aPlane[5] = D3DXPLANE(m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43);
+
+	// 距離で比較できるように正規化する
+	for (int nCnt = 0; nCnt < NUM_PLANE; nCnt++)
+	{
+		D3DXPlaneNormalize(&m_aPlane[nCnt], &m_aPlane[nCnt]);
+	}
+}
+//=============================================================================
+// 球との判定処理
+//=============================================================================
+bool CFrustum::TestSphere(const D3DXVECTOR3& center, float fRadius) const
+{
+	for (int nCnt = 0; nCnt < NUM_PLANE; nCnt++)
+	{
+		// どれか1枚でも完全に裏側なら見えない
+		if (D3DXPlaneDotCoord(&m_aPlane[nCnt], &center) < -fRadius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+//=============================================================================
+// AABBとの判定処理
+//=============================================================================
+CFrustum::RESULT CFrustum::TestAABB(const D3DXVECTOR3& vMin, const D3DXVECTOR3& vMax) const
+{
+	RESULT result = RESULT_INSIDE;
+
+	for (int nCnt = 0; nCnt < NUM_PLANE; nCnt++)
+	{
+		const D3DXPLANE& plane = m_aPlane[nCnt];
+
+		// 法線方向に一番遠い頂点と一番近い頂点
+		D3DXVECTOR3 posFar(plane.a >= 0.0f ? vMax.x : vMin.x,
+			plane.b >= 0.0f ? vMax.y : vMin.y,
+			plane.c >= 0.0f ? vMax.z : vMin.z);
+
+		D3DXVECTOR3 posNear(plane.a >= 0.0f ? vMin.x : vMax.x,
+			plane.b >= 0.0f ? vMin.y : vMax.y,
+			plane.c >= 0.0f ? vMin.z : vMax.z);
+
+		// 一番遠い頂点が裏側なら完全に外側
+		if (D3DXPlaneDotCoord(&plane, &posFar) < 0.0f)
+		{
+			return RESULT_OUTSIDE;
+		}
+
+		// 一番近い頂点が裏側なら平面をまたいでいる
+		if (D3DXPlaneDotCoord(&plane, &posNear) < 0.0f)
+		{
+			result = RESULT_INTERSECT;
+		}
+	}
+
+	return result;
+}
+//=============================================================================
+// カメラの設定処理(毎フレームの描画前に呼ぶ)
+//=============================================================================
+void CCulling::SetCamera(const D3DXMATRIX& mtxView, const D3DXMATRIX& mtxProj, const D3DXVECTOR3& posV)
+{
+	D3DXMATRIX mtxViewProj = mtxView * mtxProj;
+
+	m_frustum.Build(mtxViewProj);
+	m_posV = posV;
+	m_fProjScale = mtxProj._22;
+	m_bValid = true;
+	m_nFrame++;
+}
+//=============================================================================
+// 描画距離内かどうかの判定処理
+//=============================================================================
+bool CCulling::IsInDistance(float fDistSq, float fRadius, TYPE type)
+{
+	float fFar = m_afFarDistance[type];
+
+	// 0なら遠クリップ面に任せる
+	if (fFar <= 0.0f)
+	{
+		return true;
+	}
+
+	float fLimit = fFar + fRadius;
+
+	return fDistSq <= fLimit * fLimit;
+}
+//=============================================================================
+// 計測カウンターへの加算処理
+//=============================================================================
+void CCulling::Count(TYPE type, int nCount, bool bVisible)
+{
+	// カウンターは種類ごとに総数・描画数の順で並んでいる
+	int nTotal = CTelemetry::COUNTER_CULL_BLOCK_TOTAL + type * 2;
+
+	CTelemetry::Add((CTelemetry::COUNTER)nTotal, nCount);
+
+	if (bVisible)
+	{
+		CTelemetry::Add((CTelemetry::COUNTER)(nTotal + 1), nCount);
+	}
+}
+//=============================================================================
+// 球が見えるかどうかの判定処理
+//=============================================================================
+bool CCulling::IsVisibleSphere(const D3DXVECTOR3& center, float fRadius, TYPE type)
+{
+	bool bVisible = true;
+
+	// カメラが未設定の時(起動直後など)は全て描画する
+	if (m_bEnable && m_bValid)
+	{
+		D3DXVECTOR3 diff = center - m_posV;
+
+		bVisible = IsInDistance(D3DXVec3LengthSq(&diff), fRadius, type) && m_frustum.TestSphere(center, fRadius);
+	}
+
+	// 計測
+	Count(type, 1, bVisible);
+
+	return bVisible;
+}
+//=============================================================================
+// AABBが見えるかどうかの判定処理(nCountは中に含まれる数)
+//=============================================================================
+bool CCulling::IsVisibleAABB(const D3DXVECTOR3& vMin, const D3DXVECTOR3& vMax, TYPE type, int nCount)
+{
+	bool bVisible = true;
+
+	if (m_bEnable && m_bValid)
+	{
+		// 視点に一番近い点までの距離
+		D3DXVECTOR3 closest(std::max(vMin.x, std::min(m_posV.x, vMax.x)),
+			std::max(vMin.y, std::min(m_posV.y, vMax.y)),
+			std::max(vMin.z, std::min(m_posV.z, vMax.z)));
+
+		D3DXVECTOR3 diff = closest - m_posV;
+
+		bVisible = IsInDistance(D3DXVec3LengthSq(&diff), 0.0f, type) &&
+			m_frustum.TestAABB(vMin, vMax) != CFrustum::RESULT_OUTSIDE;
+	}
+
+	// 計測
+	Count(type, nCount, bVisible);
+
+	return bVisible;
+}
+//=============================================================================
+// 空間分割のマス番号の取得処理(XZ平面を等間隔に区切る)
+//=============================================================================
+int CCulling::GetCellKey(const D3DXVECTOR3& pos)
+{
+	int nX = (int)floorf(pos.x / CELL_SIZE) + CELL_BIAS;
+	int nZ = (int)floorf(pos.z / CELL_SIZE) + CELL_BIAS;
+
+	return ((nX & 0xffff) << 16) | (nZ & 0xffff);
+}
+//=============================================================================
+// ベンチマーク処理(描画デバイスを使わずに全件判定と空間分割の判定を比べる)
+//=============================================================================
+bool CCulling::RunBenchmark(const char* filename)
+{
+	// 判定対象の球
+	struct Sphere
+	{
+		D3DXVECTOR3 center;
+		float fRadius;
+	};
+
+	// 空間分割の1マス
+	struct Cell
+	{
+		D3DXVECTOR3 vMin;
+		D3DXVECTOR3 vMax;
+		std::vector<int> items;
+	};
+
+	// 乱数は毎回同じ結果になるように固定する
+	std::mt19937 rng(12345);
+	std::uniform_real_distribution<float> randRadius(BENCH_MIN_RADIUS, BENCH_MAX_RADIUS);
+	std::uniform_real_distribution<float> randOffset(-BENCH_SPACING * 0.5f, BENCH_SPACING * 0.5f);
+
+	std::vector<Sphere> spheres;
+	spheres.reserve(BENCH_NUM_SIDE * BENCH_NUM_SIDE);
+
+	float fHalf = BENCH_NUM_SIDE * BENCH_SPACING * 0.5f;
+
+	for (int nZ = 0; nZ < BENCH_NUM_SIDE; nZ++)
+	{
+		for (int nX = 0; nX < BENCH_NUM_SIDE; nX++)
+		{
+			Sphere sphere;
+			sphere.center = D3DXVECTOR3(nX * BENCH_SPACING - fHalf + randOffset(rng), randOffset(rng),
+				nZ * BENCH_SPACING - fHalf + randOffset(rng));
+			sphere.fRadius = randRadius(rng);
+
+			spheres.push_back(sphere);
+		}
+	}
+
+	// 空間分割の作成
+	std::unordered_map<int, Cell> cells;
+
+	for (int nCnt = 0; nCnt < (int)spheres.size(); nCnt++)
+	{
+		const Sphere& sphere = spheres[nCnt];
+		D3DXVECTOR3 extent(sphere.fRadius, sphere.fRadius, sphere.fRadius);
+		D3DXVECTOR3 vMin = sphere.center - extent;
+		D3DXVECTOR3 vMax = sphere.center + extent;
+
+		auto result = cells.emplace(GetCellKey(sphere.center), Cell());
+		Cell& cell = result.first->second;
+
+		if (result.second)
+		{
+			cell.vMin = vMin;
+			cell.vMax = vMax;
+		}
+		else
+		{
+			D3DXVec3Minimize(&cell.vMin, &cell.vMin, &vMin);
+			D3DXVec3Maximize(&cell.vMax, &cell.vMax, &vMax);
+		}
+
+		cell.items.push_back(nCnt);
+	}
+
+	// カメラと同じプロジェクション
+	D3DXMATRIX mtxProj;
+	D3DXMatrixPerspectiveFovLH(&mtxProj, D3DXToRadian(BENCH_FOV),
+		(float)SCREEN_WIDTH / (float)SCREEN_HEIGHT, BENCH_NEAR, BENCH_FAR);
+
+	LARGE_INTEGER freq, start, end;
+	QueryPerformanceFrequency(&freq);
+
+	double dBruteMs = 0.0, dGridMs = 0.0;
+	long long nBruteVisible = 0, nGridVisible = 0;
+	long long nGridTest = 0;
+	bool bMatch = true;
+
+	CFrustum frustum;
+
+	for (int nView = 0; nView < BENCH_NUM_VIEW; nView++)
+	{
+		// 中心から少し離れた位置で周りを見回す
+		float fAngle = D3DX_PI * 2.0f * nView / BENCH_NUM_VIEW;
+		D3DXVECTOR3 posV(sinf(fAngle) * fHalf * 0.25f, BENCH_CAMERA_HEIGHT, cosf(fAngle) * fHalf * 0.25f);
+		D3DXVECTOR3 posR(posV.x + sinf(fAngle) * 1000.0f, 0.0f, posV.z + cosf(fAngle) * 1000.0f);
+		D3DXVECTOR3 vecU(0.0f, 1.0f, 0.0f);
+
+		D3DXMATRIX mtxView;
+		D3DXMatrixLookAtLH(&mtxView, &posV, &posR, &vecU);
+
+		D3DXMATRIX mtxViewProj = mtxView * mtxProj;
+		frustum.Build(mtxViewProj);
+
+		int nBrute = 0, nGrid = 0;
+
+		// 全件判定
+		QueryPerformanceCounter(&start);
+
+		for (int nLoop = 0; nLoop < BENCH_NUM_LOOP; nLoop++)
+		{
+			nBrute = 0;
+
+			for (const Sphere& sphere : spheres)
+			{
+				if (frustum.TestSphere(sphere.center, sphere.fRadius))
+				{
+					nBrute++;
+				}
+			}
+		}
+
+		QueryPerformanceCounter(&end);
+		dBruteMs += (double)(end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart;
+
+		// 空間分割で判定(またいでいるマスだけ1つずつ判定する)
+		QueryPerformanceCounter(&start);
+
+		for (int nLoop = 0; nLoop < BENCH_NUM_LOOP; nLoop++)
+		{
+			nGrid = 0;
+
+			for (const auto& pair : cells)
+			{
+				const Cell& cell = pair.second;
+				CFrustum::RESULT result = frustum.TestAABB(cell.vMin, cell.vMax);
+
+				if (nLoop == 0)
+				{
+					nGridTest++;
+				}
+
+				if (result == CFrustum::RESULT_OUTSIDE)
+				{
+					continue;
+				}
+
+				if (result == CFrustum::RESULT_INSIDE)
+				{
+					nGrid += (int)cell.items.size();
+					continue;
+				}
+
+				for (int nIdx : cell.items)
+				{
+					if (nLoop == 0)
+					{
+						nGridTest++;
+					}
+
+					if (frustum.TestSphere(spheres[nIdx].center, spheres[nIdx].fRadius))
+					{
+						nGrid++;
+					}
+				}
+			}
+		}
+
+		QueryPerformanceCounter(&end);
+		dGridMs += (double)(end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart;
+
+		nBruteVisible += nBrute;
+		nGridVisible += nGrid;
+
+		if (nBrute != nGrid)
+		{
+			bMatch = false;
+		}
+	}
+
+	int nNumRun = BENCH_NUM_VIEW * BENCH_NUM_LOOP;
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "objects          : %d\n", (int)spheres.size());
+	fprintf(pFile, "cells            : %d\n", (int)cells.size());
+	fprintf(pFile, "views            : %d x %d\n", BENCH_NUM_VIEW, BENCH_NUM_LOOP);
+	fprintf(pFile, "visible (avg)    : %.1f\n", (double)nBruteVisible / BENCH_NUM_VIEW);
+	fprintf(pFile, "grid tests (avg) : %.1f\n", (double)nGridTest / BENCH_NUM_VIEW);
+	fprintf(pFile, "brute force (ms) : %.4f\n", dBruteMs / nNumRun);
+	fprintf(pFile, "grid (ms)        : %.4f\n", dGridMs / nNumRun);
+	fprintf(pFile, "speedup          : %.2f\n", (dGridMs > 0.0) ? dBruteMs / dGridMs : 0.0);
+	fprintf(pFile, "result match     : %s\n", (bMatch && nBruteVisible == nGridVisible) ? "yes" : "no");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bMatch;
+}
@@ -0,0 +1,100 @@
+//=============================================================================
+//
+// 視錐台カリング処理 [culling.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _CULLING_H_// このマクロ定義がされていなかったら
+#define _CULLING_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// 視錐台クラス(ビュー・プロジェクションマトリックスから6平面を取り出す)
+//*****************************************************************************
+class CFrustum
+{
+public:
+	CFrustum();
+	~CFrustum();
+
+	// AABBの判定結果
+	typedef enum
+	{
+		RESULT_OUTSIDE = 0,	// 完全に外側
+		RESULT_INTERSECT,	// 一部が内側
+		RESULT_INSIDE,		// 完全に内側
+		RESULT_MAX
+	}RESULT;
+
+	void Build(const D3DXMATRIX& mtxViewProj);
+	bool TestSphere(const D3DXVECTOR3& center, float fRadius) const;
+	RESULT TestAABB(const D3DXVECTOR3& vMin, const D3DXVECTOR3& vMax) const;
+
+private:
+	static constexpr int NUM_PLANE = 6;	// 平面の数
+
+	D3DXPLANE m_aPlane[NUM_PLANE];		// 視錐台の平面(法線は内側向き)
+};
+
+//*****************************************************************************
+// カリングクラス(カメラごとの視錐台と種類ごとの描画距離で描画するかを決める)
+//*****************************************************************************
+class CCulling
+{
+public:
+	// カリングの種類(種類ごとに描画距離を変える)
+	typedef enum
+	{
+		TYPE_BLOCK = 0,	// ブロック
+		TYPE_PROP,		// 小物
+		TYPE_CHARACTER,	// キャラクター
+		TYPE_EFFECT,	// エフェクト
+		TYPE_TERRAIN,	// 地形の区画
+		TYPE_MAX
+	}TYPE;
+
+	static void SetCamera(const D3DXMATRIX& mtxView, const D3DXMATRIX& mtxProj, const D3DXVECTOR3& posV);
+	static bool IsVisibleSphere(const D3DXVECTOR3& center, float fRadius, TYPE type);
+	static bool IsVisibleAABB(const D3DXVECTOR3& vMin, const D3DXVECTOR3& vMax, TYPE type, int nCount = 1);
+	static int GetCellKey(const D3DXVECTOR3& pos);
+	static bool RunBenchmark(const char* filename);
+
+	//*****************************************************************************
+	// setter関数
+	//*****************************************************************************
+	static void SetEnable(bool enable) { m_bEnable = enable; }
+	static void SetFarDistance(TYPE type, float fDistance) { m_afFarDistance[type] = fDistance; }
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	static bool IsEnable(void) { return m_bEnable; }
+	static bool IsValid(void) { return m_bValid; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static float GetFarDistance(TYPE type) { return m_afFarDistance[type]; }
+	static TYPE GetPropType(float fRadius) { return (fRadius < SMALL_PROP_RADIUS) ? TYPE_PROP : TYPE_BLOCK; }
+	static unsigned int GetFrame(void) { return m_nFrame; }
+	static const CFrustum& GetFrustum(void) { return m_frustum; }
+	static const D3DXVECTOR3& GetCameraPos(void) { return m_posV; }
+	static float GetProjScale(void) { return m_fProjScale; }
+
+private:
+	static constexpr float SMALL_PROP_RADIUS	= 40.0f;	// 小物として扱う半径
+	static constexpr float CELL_SIZE			= 640.0f;	// 空間分割の1マスの大きさ
+	static constexpr int   CELL_BIAS			= 0x8000;	// マス番号を正の値にするための補正
+
+	static bool IsInDistance(float fDistSq, float fRadius, TYPE type);
+	static void Count(TYPE type, int nCount, bool bVisible);
+
+	static CFrustum		m_frustum;						// 現在のカメラの視錐台
+	static D3DXVECTOR3	m_posV;							// 現在のカメラの視点
+	static float		m_fProjScale;					// 縦の視野角から求めた拡大率(1/tan(fov/2))
+	static float		m_afFarDistance[TYPE_MAX];		// 種類ごとの描画距離(0なら遠クリップ面まで)
+	static unsigned int	m_nFrame;						// カメラを設定した回数
+	static bool			m_bValid;						// カメラが設定済みか
+	static bool			m_bEnable;						// カリングを使うか
+};
+
+#endif
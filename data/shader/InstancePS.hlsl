@@ -0,0 +1,31 @@
+//=============================================================================
+//
+// CX^X`sNZVF[_ [InstancePS.hlsl]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//=============================================================================
+// 萔obt@
+//=============================================================================
+float    g_fUseTexture;	// eNX`g(0 : gȂA1 : g)
+sampler  g_Sampler : register(s0);
+
+//=============================================================================
+// sNZVF[_
+//=============================================================================
+struct PS_INPUT
+{
+    float4 Diffuse : COLOR0;
+    float2 Tex     : TEXCOORD0;
+};
+
+//=============================================================================
+// sNZVF[_{
+//=============================================================================
+float4 PSMain(PS_INPUT In) : COLOR
+{
+    float4 texCol = tex2D(g_Sampler, In.Tex);
+
+    return In.Diffuse * lerp(float4(1.0f, 1.0f, 1.0f, 1.0f), texCol, g_fUseTexture);
+}
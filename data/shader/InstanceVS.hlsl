@@ -0,0 +1,112 @@
+//=============================================================================
+//
+// CX^X`撸_VF[_ [InstanceVS.hlsl]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//=============================================================================
+// 萔
+//=============================================================================
+#define MAX_LIGHT				(8)		// Cg̍ő吔
+#define LIGHT_TYPE_POINT		(1.0f)	// |CgCg
+#define LIGHT_TYPE_SPOT			(2.0f)	// X|bgCg
+#define LIGHT_TYPE_DIRECTIONAL	(3.0f)	// fBNViCg
+
+//=============================================================================
+// 萔obt@
+//=============================================================================
+float4x4 g_mViewProj;					// r[ ~ vWFNV
+float4   g_GlobalAmbient;				// 
+float4   g_MatDiffuse;					// }eÅgU
+float4   g_MatAmbient;					// }eÅ
+float4   g_MatEmissive;					// }eA̎Ȕ
+float4   g_LightDiffuse[MAX_LIGHT];		// Cg̐F
+float4   g_LightPos[MAX_LIGHT];			// Cg̈ʒu(w : )
+float4   g_LightDir[MAX_LIGHT];			// Cǧ
+float4   g_LightAtten[MAX_LIGHT];		// Cǧ(x,y,z : WAw : ͈)
+float4   g_LightSpot[MAX_LIGHT];		// X|bgCg(x : cosAy : OcosAz : tH[It)
+
+//=============================================================================
+// _VF[_
+//=============================================================================
+struct VS_INPUT
+{
+    float3 Pos    : POSITION;
+    float3 Normal : NORMAL;
+    float2 Tex    : TEXCOORD0;
+    float4 World0 : TEXCOORD1;	// [h}gbNX(CX^X)
+    float4 World1 : TEXCOORD2;
+    float4 World2 : TEXCOORD3;
+    float4 World3 : TEXCOORD4;
+};
+
+//=============================================================================
+// _VF[_o
+//=============================================================================
+struct VS_OUTPUT
+{
+    float4 Pos     : POSITION;
+    float4 Diffuse : COLOR0;
+    float2 Tex     : TEXCOORD0;
+};
+
+//=============================================================================
+// _VF[_{(Œ@\̃CeBOƓvZ)
+//=============================================================================
+VS_OUTPUT VSMain(VS_INPUT In)
+{
+    VS_OUTPUT Out;
+
+    float4x4 mWorld = float4x4(In.World0, In.World1, In.World2, In.World3);
+
+    // [hWƖ@
+    float4 posW = mul(float4(In.Pos, 1.0f), mWorld);
+    float3 normal = normalize(mul(In.Normal, (float3x3)mWorld));
+
+    float3 color = g_MatEmissive.rgb + g_MatAmbient.rgb * g_GlobalAmbient.rgb;
+
+    for (int nCnt = 0; nCnt < MAX_LIGHT; nCnt++)
+    {
+        float type = g_LightPos[nCnt].w;
+        float3 toLight;
+        float atten = 1.0f;
+
+        if (type == LIGHT_TYPE_DIRECTIONAL)
+        {
+            toLight = -normalize(g_LightDir[nCnt].xyz);
+        }
+        else
+        {
+            float3 diff = g_LightPos[nCnt].xyz - posW.xyz;
+            float dist = length(diff);
+
+            toLight = diff / max(dist, 0.0001f);
+
+            // ɂ錸(͈͊O0)
+            float4 coef = g_LightAtten[nCnt];
+            atten = (dist <= coef.w) ? 1.0f / max(coef.x + coef.y * dist + coef.z * dist * dist, 0.0001f) : 0.0f;
+
+            // X|bgCg͈̔
+            if (type == LIGHT_TYPE_SPOT)
+            {
+                float rho = dot(-toLight, normalize(g_LightDir[nCnt].xyz));
+                float4 spot = g_LightSpot[nCnt];
+                float rate = saturate((rho - spot.y) / max(spot.x - spot.y, 0.0001f));
+
+                atten *= pow(rate, spot.z);
+            }
+        }
+
+        // ނ0͖̂̂gp
+        atten *= (type > 0.0f) ? 1.0f : 0.0f;
+
+        color += g_MatDiffuse.rgb * g_LightDiffuse[nCnt].rgb * max(dot(normal, toLight), 0.0f) * atten;
+    }
+
+    Out.Pos = mul(posW, g_mViewProj);
+    Out.Diffuse = float4(saturate(color), g_MatDiffuse.a);
+    Out.Tex = In.Tex;
+
+    return Out;
+}
@@ -8,7 +8,7 @@
 //=============================================================================
 // 萔obt@
 //=============================================================================
-float4 g_OutlineColor; // ֊s̐F
+float4 g_OutlineColor : register(c0); // ֊s̐F
 
 //=============================================================================
 // sNZVF[_{
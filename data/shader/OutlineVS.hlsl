@@ -8,8 +8,9 @@
 //=============================================================================
 // 萔obt@
 //=============================================================================
-float4x4 g_mWorldViewProj; // [h ~ r[ ~ vWFNV
-float    g_OutlineWidth;   // ֊s̑
+// `L[܂Ƃ߂đ悤ɃWX^Œ肷(c0`c41Őݒ)
+float4x4 g_mWorldViewProj : register(c0); // [h ~ r[ ~ vWFNV
+float    g_OutlineWidth   : register(c4); // ֊s̑
 
 //=============================================================================
 // _VF[_
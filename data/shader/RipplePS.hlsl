@@ -0,0 +1,22 @@
+//=============================================================================
+//
+// gsNZVF[_ [RipplePS.hlsl]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//=============================================================================
+// sNZVF[_
+//=============================================================================
+struct PS_INPUT
+{
+    float4 Diffuse : COLOR0;
+};
+
+//=============================================================================
+// sNZVF[_{
+//=============================================================================
+float4 PSMain(PS_INPUT In) : COLOR
+{
+    return In.Diffuse;
+}
@@ -0,0 +1,60 @@
+//=============================================================================
+//
+// g䒸_VF[_ [RippleVS.hlsl]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//=============================================================================
+// 萔
+//=============================================================================
+#define BATCH_RIPPLE	(64)	// 1̕`ŕ`g̐(CRippleSystemƍ킹)
+
+//=============================================================================
+// 萔obt@
+//=============================================================================
+// g̊Ǘ܂Ƃ߂đ悤ɃWX^Œ肷(c0`c3 : VPAc4` : g䂲Ƃ3)
+float4x4 g_mViewProj					: register(c0);	// r[ ~ vWFNV
+float4   g_Ripple[BATCH_RIPPLE * 3]		: register(c4);	// SƊOa / a / F
+
+//=============================================================================
+// _VF[_
+//=============================================================================
+struct VS_INPUT
+{
+    float4 Pos : POSITION;	// x,y : ~̌ z : Ȃ1 w : ob`̔ԍ
+};
+
+//=============================================================================
+// _VF[_o
+//=============================================================================
+struct VS_OUTPUT
+{
+    float4 Pos     : POSITION;
+    float4 Diffuse : COLOR0;
+};
+
+//=============================================================================
+// _VF[_{
+//=============================================================================
+VS_OUTPUT VSMain(VS_INPUT In)
+{
+    VS_OUTPUT Out;
+
+    int nIdx = (int)In.Pos.w * 3;
+
+    float4 center = g_Ripple[nIdx];
+    float  fInner = g_Ripple[nIdx + 1].x;
+    float4 col    = g_Ripple[nIdx + 2];
+
+    // OƓŔa؂ւčL
+    float fRadius = lerp(center.w, fInner, In.Pos.z);
+    float3 pos = center.xyz + float3(In.Pos.x * fRadius, 0.0f, In.Pos.y * fRadius);
+
+    Out.Pos = mul(float4(pos, 1.0f), g_mViewProj);
+
+    // Ɍēɂ
+    Out.Diffuse = float4(col.rgb, col.a * (1.0f - In.Pos.z));
+
+    return Out;
+}
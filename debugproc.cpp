@@ -1,61 +1,61 @@
 //=============================================================================
 //
-// fobO\ [debugproc.cpp]
+// デバッグ表示処理 [debugproc.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "debugproc.h"
 #include "renderer.h"
 #include "manager.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 LPD3DXFONT CDebugProc::m_pFont = nullptr;
 char CDebugProc::m_aStr[1024] = {};
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CDebugProc::CDebugProc()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CDebugProc::~CDebugProc()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 void CDebugProc::Init(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// fobO\ptHg̐
+	// デバッグ表示用フォントの生成
 	D3DXCreateFont(pDevice, 18, 0, 0, 0,
 		FALSE, SHIFTJIS_CHARSET,
 		OUT_DEFAULT_PRECIS, DEFAULT_QUALITY, DEFAULT_PITCH,
 		"Terminal", &m_pFont);
 
-	// obt@̃NA
+	// バッファのクリア
 	memset(m_aStr, 0, sizeof(m_aStr));
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CDebugProc::Uninit(void)
 {
-	// fobO\ptHg̔j
+	// デバッグ表示用フォントの破棄
 	if (m_pFont != nullptr)
 	{
 		m_pFont->Release();
@@ -64,7 +64,7 @@ void CDebugProc::Uninit(void)
 	}
 }
 //=============================================================================
-// ̍XV
+// 情報の更新処理
 //=============================================================================
 void CDebugProc::UpdateInfo(void)
 {
@@ -73,7 +73,7 @@ void CDebugProc::UpdateInfo(void)
 
 }
 //=============================================================================
-// \
+// 表示処理
 //=============================================================================
 void CDebugProc::Print(const char* fmt, ...)
 {
@@ -86,15 +86,15 @@ void CDebugProc::Print(const char* fmt, ...)
 	va_end(args);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CDebugProc::Draw(D3DXCOLOR col, int posX, int posY)
 {
 	RECT rect = { posX,posY, SCREEN_WIDTH, SCREEN_HEIGHT };
 
-	//eLXg̕`
+	//テキストの描画
 	m_pFont->DrawTextA(NULL, &m_aStr[0], -1, &rect, DT_LEFT, col);
 
-	// obt@̃NA
+	// バッファのクリア
 	memset(m_aStr, 0, sizeof(m_aStr));
 }
@@ -1,18 +1,18 @@
 //=============================================================================
 //
-// fobO\ [debugproc.h]
+// デバッグ表示処理 [debugproc.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _DEBUGPROC_H_// ̃}N`ĂȂ
-#define _DEBUGPROC_H_// 2dCN[hh~̃}N`
+#ifndef _DEBUGPROC_H_// このマクロ定義がされていなかったら
+#define _DEBUGPROC_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 //*****************************************************************************
-// fobONX
+// デバッグクラス
 //*****************************************************************************
 class CDebugProc
 {
@@ -27,10 +27,10 @@ public:
 	static void Draw(D3DXCOLOR col,int posX,int posY);
 
 private:
-	static constexpr int MAX_WORD = 1024;	// ő啶
+	static constexpr int MAX_WORD = 1024;	// 最大文字数
 
-	static LPD3DXFONT	m_pFont;			// tHgւ̃|C^
-	static char			m_aStr[MAX_WORD];	// i[obt@
+	static LPD3DXFONT	m_pFont;			// フォントへのポインタ
+	static char			m_aStr[MAX_WORD];	// 文字列を格納するバッファ
 
 };
 #endif
\ No newline at end of file
@@ -1,439 +1,438 @@
 //=============================================================================
 //
-// 3DfobO\ [debugproc3D.cpp]
+// 3Dデバッグ表示処理 [debugproc3D.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 #include "debugproc3D.h"
 #include "renderer.h"
 #include "manager.h"
+#include "algorithm"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-LPD3DXLINE CDebugProc3D::m_pLine = nullptr;
+std::vector<CDebugProc3D::Vertex> CDebugProc3D::m_aVtx[DEPTH_MAX];
+bool CDebugProc3D::m_bEnable = true;
+unsigned int CDebugProc3D::m_visibleMask = (1u << CATEGORY_CHARACTER) | (1u << CATEGORY_WEAPON) | (1u << CATEGORY_OTHER);
+unsigned int CDebugProc3D::m_overlayMask = 0;
+int CDebugProc3D::m_nFrameLine = 0;
+int CDebugProc3D::m_nFrameDrawCall = 0;
+int CDebugProc3D::m_nNumLine = 0;
+int CDebugProc3D::m_nNumDrawCall = 0;
+int CDebugProc3D::m_nBatchLine = CDebugProc3D::BATCH_LINE;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CDebugProc3D::CDebugProc3D()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CDebugProc3D::~CDebugProc3D()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 void CDebugProc3D::Init(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	// 毎フレーム確保し直さないように先に確保しておく
+	for (int nCnt = 0; nCnt < DEPTH_MAX; nCnt++)
+	{
+		m_aVtx[nCnt].reserve(RESERVE_VERTEX);
+	}
+
+	// 1回に描ける数はデバイスの上限を超えられない
+	D3DCAPS9 caps;
+	m_nBatchLine = BATCH_LINE;
 
-	if (pDevice != nullptr)
+	if (SUCCEEDED(CManager::GetRenderer()->GetDevice()->GetDeviceCaps(&caps)) && caps.MaxPrimitiveCount > 0)
 	{
-		D3DXCreateLine(pDevice, &m_pLine);
+		m_nBatchLine = (int)std::min<DWORD>(caps.MaxPrimitiveCount, BATCH_LINE);
 	}
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CDebugProc3D::Uninit(void)
 {
-	// C\̔j
-	if (m_pLine != nullptr)
+	// 積んだ線の破棄
+	Clear();
+}
+//=============================================================================
+// 積んだ線の破棄
+//=============================================================================
+void CDebugProc3D::Clear(void)
+{
+	for (int nCnt = 0; nCnt < DEPTH_MAX; nCnt++)
+	{
+		m_aVtx[nCnt].clear();
+	}
+}
+//=============================================================================
+// フレーム開始処理(前回の描画数を確定する)
+//=============================================================================
+void CDebugProc3D::BeginFrame(void)
+{
+	m_nNumLine = m_nFrameLine;
+	m_nNumDrawCall = m_nFrameDrawCall;
+
+	m_nFrameLine = 0;
+	m_nFrameDrawCall = 0;
+}
+//=============================================================================
+// まとめ描画処理
+//=============================================================================
+void CDebugProc3D::Flush(void)
+{
+	if (m_aVtx[DEPTH_TEST].empty() && m_aVtx[DEPTH_OVERLAY].empty())
+	{
+		return;
+	}
+
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// 頂点はワールド座標で積んでいるのでワールドマトリックスは単位行列
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixIdentity(&mtxWorld);
+	pDevice->SetTransform(D3DTS_WORLD, &mtxWorld);
+
+	pDevice->SetTexture(0, nullptr);
+	pDevice->SetFVF(FVF_LINE);
+
+	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // ライトを無効にする
+	pDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE); // αブレンドを無効にする
+
+	for (int nDepth = 0; nDepth < DEPTH_MAX; nDepth++)
+	{
+		std::vector<Vertex>& list = m_aVtx[nDepth];
+
+		if (list.empty())
+		{
+			continue;
+		}
+
+		// 手前表示はZテストをしない
+		pDevice->SetRenderState(D3DRS_ZENABLE, nDepth == DEPTH_OVERLAY ? FALSE : TRUE);
+
+		int nNumLine = (int)list.size() / 2;
+		int nStart = 0;
+
+		while (nStart < nNumLine)
+		{
+			int nNum = std::min(nNumLine - nStart, m_nBatchLine);
+
+			// ライン描画
+			pDevice->DrawPrimitiveUP(D3DPT_LINELIST, nNum, &list[nStart * 2], sizeof(Vertex));
+
+			nStart += nNum;
+			m_nFrameDrawCall++;
+		}
+
+		m_nFrameLine += nNumLine;
+		list.clear();
+	}
+
+	pDevice->SetRenderState(D3DRS_ZENABLE, TRUE);           // Zテストを有効にする
+	pDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE);  // αブレンドを有効にする
+	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // ライトを有効にする
+}
+//=============================================================================
+// 線を積む処理
+//=============================================================================
+void CDebugProc3D::AddLine(std::vector<Vertex>& list, const D3DXVECTOR3& start, const D3DXVECTOR3& end, D3DCOLOR col)
+{
+	Vertex vtx;
+
+	vtx.col = col;
+
+	vtx.pos = start;
+	list.push_back(vtx);
+
+	vtx.pos = end;
+	list.push_back(vtx);
+}
+//=============================================================================
+// ライン描画処理
+//=============================================================================
+void CDebugProc3D::DrawLine3D(const D3DXVECTOR3& start, const D3DXVECTOR3& end, D3DXCOLOR color, CATEGORY category)
+{
+	if (!IsVisible(category))
 	{
-		m_pLine->Release();
-		m_pLine = nullptr;
+		return;
 	}
+
+	AddLine(GetList(category), start, end, color);
 }
 //=============================================================================
-// C`揈
+// 軸に沿った箱の描画処理
 //=============================================================================
-void CDebugProc3D::DrawLine3D(const D3DXVECTOR3& start, const D3DXVECTOR3& end, D3DXCOLOR color)
+void CDebugProc3D::DrawBox(const D3DXVECTOR3& min, const D3DXVECTOR3& max, D3DXCOLOR color, CATEGORY category)
 {
-    // foCX̎擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixTranslation(&mtxWorld, (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
 
-	struct VERTEX
+	DrawOBB(mtxWorld, (max - min) * 0.5f, color, category);
+}
+//=============================================================================
+// 向きのある箱の描画処理
+//=============================================================================
+void CDebugProc3D::DrawOBB(const D3DXMATRIX& mtxWorld, const D3DXVECTOR3& half, D3DXCOLOR color, CATEGORY category)
+{
+	if (!IsVisible(category))
 	{
-		D3DXVECTOR3 pos;
-		D3DCOLOR color;
+		return;
+	}
+
+	D3DXVECTOR3 v[8] =
+	{
+		{ -half.x, -half.y, -half.z },
+		{ +half.x, -half.y, -half.z },
+		{ +half.x, +half.y, -half.z },
+		{ -half.x, +half.y, -half.z },
+		{ -half.x, -half.y, +half.z },
+		{ +half.x, -half.y, +half.z },
+		{ +half.x, +half.y, +half.z },
+		{ -half.x, +half.y, +half.z },
 	};
 
-	VERTEX v[2] =
-    {
-		{ start, color },
-		{ end,   color }
+	// ローカル → ワールド
+	for (int nCnt = 0; nCnt < 8; nCnt++)
+	{
+		D3DXVec3TransformCoord(&v[nCnt], &v[nCnt], &mtxWorld);
+	}
+
+	static const int indices[][2] =
+	{
+		{0,1},{1,2},{2,3},{3,0},
+		{4,5},{5,6},{6,7},{7,4},
+		{0,4},{1,5},{2,6},{3,7}
+	};
+
+	std::vector<Vertex>& list = GetList(category);
+	D3DCOLOR col = color;
+
+	for (int nCnt = 0; nCnt < 12; nCnt++)
+	{
+		AddLine(list, v[indices[nCnt][0]], v[indices[nCnt][1]], col);
+	}
+}
+//=============================================================================
+// 球の描画処理
+//=============================================================================
+void CDebugProc3D::DrawSphere(const D3DXVECTOR3& center, float radius, D3DXCOLOR color, CATEGORY category)
+{
+	if (!IsVisible(category))
+	{
+		return;
+	}
+
+	std::vector<Vertex>& list = GetList(category);
+	D3DCOLOR col = color;
+
+	for (int nCnt = 0; nCnt < SPHERE_SEGMENT; nCnt++)
+	{
+		float t1 = (2.0f * D3DX_PI * nCnt) / SPHERE_SEGMENT;
+		float t2 = (2.0f * D3DX_PI * (nCnt + 1)) / SPHERE_SEGMENT;
+
+		// XY
+		AddLine(list, center + D3DXVECTOR3(cosf(t1), sinf(t1), 0) * radius,
+			center + D3DXVECTOR3(cosf(t2), sinf(t2), 0) * radius, col);
+
+		// YZ
+		AddLine(list, center + D3DXVECTOR3(0, cosf(t1), sinf(t1)) * radius,
+			center + D3DXVECTOR3(0, cosf(t2), sinf(t2)) * radius, col);
+
+		// XZ
+		AddLine(list, center + D3DXVECTOR3(cosf(t1), 0, sinf(t1)) * radius,
+			center + D3DXVECTOR3(cosf(t2), 0, sinf(t2)) * radius, col);
+	}
+}
+//=============================================================================
+// カプセルの描画処理(start～endの線分を芯にする)
+//=============================================================================
+void CDebugProc3D::DrawCapsule(const D3DXVECTOR3& start, const D3DXVECTOR3& end, float radius, D3DXCOLOR color, CATEGORY category)
+{
+	if (!IsVisible(category))
+	{
+		return;
+	}
+
+	// 芯の向き(長さが無ければ上向き)
+	D3DXVECTOR3 axis = end - start;
+
+	if (D3DXVec3LengthSq(&axis) < 1e-8f)
+	{
+		axis = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
+	}
+
+	D3DXVec3Normalize(&axis, &axis);
+
+	// 芯に直交する2軸
+	D3DXVECTOR3 helper = (fabsf(axis.y) < 0.99f) ? D3DXVECTOR3(0.0f, 1.0f, 0.0f) : D3DXVECTOR3(1.0f, 0.0f, 0.0f);
+	D3DXVECTOR3 side1, side2;
+
+	D3DXVec3Cross(&side1, &helper, &axis);
+	D3DXVec3Normalize(&side1, &side1);
+	D3DXVec3Cross(&side2, &axis, &side1);
+
+	std::vector<Vertex>& list = GetList(category);
+	D3DCOLOR col = color;
+
+	// 半球上の点(theta : 芯からの角度、phi : 周りの角度)
+	auto point = [&](const D3DXVECTOR3& center, float sign, float theta, float phi)
+	{
+		return center + axis * (sign * cosf(theta) * radius)
+			+ (side1 * cosf(phi) + side2 * sinf(phi)) * (sinf(theta) * radius);
 	};
 
-	// _tH[}bgݒ
-	pDevice->SetFVF(D3DFVF_XYZ | D3DFVF_DIFFUSE);
+	const float halfPi = D3DX_PI * 0.5f;
+
+	for (int seg = 0; seg < CAPSULE_SEGMENT; seg++)
+	{
+		float phi1 = (2.0f * D3DX_PI * seg) / CAPSULE_SEGMENT;
+		float phi2 = (2.0f * D3DX_PI * (seg + 1)) / CAPSULE_SEGMENT;
+
+		// 側面の線
+		AddLine(list, point(end, 1.0f, halfPi, phi1), point(start, -1.0f, halfPi, phi1), col);
+
+		for (int ring = 0; ring < CAPSULE_RING; ring++)
+		{
+			float theta1 = halfPi * (ring / (float)CAPSULE_RING);		// 0 ～ π/2
+			float theta2 = halfPi * ((ring + 1) / (float)CAPSULE_RING);
+
+			// 上半球(縦の線と横の輪)
+			AddLine(list, point(end, 1.0f, theta1, phi1), point(end, 1.0f, theta2, phi1), col);
+			AddLine(list, point(end, 1.0f, theta2, phi1), point(end, 1.0f, theta2, phi2), col);
+
+			// 下半球
+			AddLine(list, point(start, -1.0f, theta1, phi1), point(start, -1.0f, theta2, phi1), col);
+			AddLine(list, point(start, -1.0f, theta2, phi1), point(start, -1.0f, theta2, phi2), col);
+		}
+	}
+}
+//=============================================================================
+// カプセルコライダー描画処理
+//=============================================================================
+void CDebugProc3D::DrawCapsuleCollider(btCapsuleShape* capsule, const btTransform& transform, D3DXCOLOR color, CATEGORY category)
+{
+	if (!capsule || !IsVisible(category))
+	{
+		return;
+	}
+
+	AddShape(capsule, transform, color, category);
+}
+//=============================================================================
+// ブロックのコライダー描画処理
+//=============================================================================
+void CDebugProc3D::DrawBlockCollider(btRigidBody* rigidBody, D3DXCOLOR color, CATEGORY category)
+{
+	if (!rigidBody || !IsVisible(category))
+	{
+		return;
+	}
 
-    pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // Cg𖳌ɂ
-    pDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE); // eXg𖳌ɂ
+	// ワールド変換取得
+	btTransform transform;
 
-	// C`
-	pDevice->DrawPrimitiveUP(D3DPT_LINELIST, 1, v, sizeof(VERTEX));
+	rigidBody->getMotionState()->getWorldTransform(transform);
 
-    pDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE);  // eXgLɂ
-    pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // CgLɂ
+	AddShape(rigidBody->getCollisionShape(), transform, color, category);
 }
 //=============================================================================
-// JvZRC_[`揈
+// 当たり判定の形を積む処理(複合形状は子ごとに再帰する)
 //=============================================================================
-void CDebugProc3D::DrawCapsuleCollider(btCapsuleShape* capsule, const btTransform& transform, D3DXCOLOR color)
+void CDebugProc3D::AddShape(const btCollisionShape* pShape, const btTransform& transform, D3DCOLOR col, CATEGORY category)
 {
-    if (!capsule || !m_pLine)
-    {
-        return;
-    }
-
-    // foCX̎擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-    const int kNumSegments = 12;  // 
-    const int kNumRings = 4;      // c
-
-    float radius = capsule->getRadius();
-    float halfHeight = capsule->getHalfHeight();
-
-    // Capsule ̒Sʒu
-    btVector3 base = transform.getOrigin();
-
-    // btTransform̉]D3DXMATRIX֕ϊ
-    btQuaternion q = transform.getRotation();
-
-    D3DXMATRIX matRot;
-    D3DXQUATERNION dq(q.x(), q.y(), q.z(), q.w());
-    D3DXMatrixRotationQuaternion(&matRot, &dq);
-
-    // sړs
-    D3DXMATRIX matTrans;
-    D3DXMatrixTranslation(&matTrans, base.x(), base.y(), base.z());
-
-    // [hs = ] ~ sړ
-    D3DXMATRIX matWorld = matRot * matTrans;
-
-    // foCXɃ[hsݒ
-    pDevice->SetTransform(D3DTS_WORLD, &matWorld);
-
-    // JvZYŒ
-    btVector3 up(0, 1, 0);
-    btVector3 side1(1, 0, 0);
-    btVector3 side2(0, 0, 1);
-
-    btVector3 top = up * halfHeight;
-    btVector3 bottom = -up * halfHeight;
-
-    for (int nCnt = 0; nCnt < kNumSegments; nCnt++)
-    {
-        float theta1 = (2.0f * D3DX_PI * nCnt) / kNumSegments;
-        float theta2 = (2.0f * D3DX_PI * (nCnt + 1)) / kNumSegments;
-
-        btVector3 dir1 = cosf(theta1) * side1 + sinf(theta1) * side2;
-        btVector3 dir2 = cosf(theta2) * side1 + sinf(theta2) * side2;
-
-        dir1 *= radius;
-        dir2 *= radius;
-
-        // ʂ̐
-        DrawLine3D(D3DXVECTOR3((top + dir1).x(), (top + dir1).y(), (top + dir1).z()),
-            D3DXVECTOR3((bottom + dir1).x(), (bottom + dir1).y(), (bottom + dir1).z()), color);
-    }
-
-    // --- 㔼` ---
-    for (int ring = 0; ring < kNumRings; ring++)
-    {
-        float theta1 = (D3DX_PI / 2) * (ring / (float)kNumRings);       // 0 ` /2
-        float theta2 = (D3DX_PI / 2) * ((ring + 1) / (float)kNumRings);
-
-        for (int seg = 0; seg < kNumSegments; seg++)
-        {
-            float phi1 = (2 * D3DX_PI * seg) / kNumSegments;
-            float phi2 = (2 * D3DX_PI * (seg + 1)) / kNumSegments;
-
-            // ʍW  3Dʒu (a1̒Pʋx[X)
-            btVector3 p1 = btVector3(
-                cosf(phi1) * sinf(theta1),
-                cosf(theta1),
-                sinf(phi1) * sinf(theta1)
-            );
-            btVector3 p2 = btVector3(
-                cosf(phi2) * sinf(theta1),
-                cosf(theta1),
-                sinf(phi2) * sinf(theta1)
-            );
-            btVector3 p3 = btVector3(
-                cosf(phi2) * sinf(theta2),
-                cosf(theta2),
-                sinf(phi2) * sinf(theta2)
-            );
-            btVector3 p4 = btVector3(
-                cosf(phi1) * sinf(theta2),
-                cosf(theta2),
-                sinf(phi1) * sinf(theta2)
-            );
-
-            // Ȃ̂ŁAYup  topɃItZbgAaXP[
-            p1 = top + p1 * radius;
-            p2 = top + p2 * radius;
-            p3 = top + p3 * radius;
-            p4 = top + p4 * radius;
-
-            // 4_Ŏlp`  2{̐ŃC[t[
-            DrawLine3D(D3DXVECTOR3(p1.x(), p1.y(), p1.z()), D3DXVECTOR3(p2.x(), p2.y(), p2.z()), color);
-            DrawLine3D(D3DXVECTOR3(p2.x(), p2.y(), p2.z()), D3DXVECTOR3(p3.x(), p3.y(), p3.z()), color);
-            DrawLine3D(D3DXVECTOR3(p3.x(), p3.y(), p3.z()), D3DXVECTOR3(p4.x(), p4.y(), p4.z()), color);
-            DrawLine3D(D3DXVECTOR3(p4.x(), p4.y(), p4.z()), D3DXVECTOR3(p1.x(), p1.y(), p1.z()), color);
-        }
-    }
-
-    // --- ` ---
-    for (int ring = 0; ring < kNumRings; ring++)
-    {
-        float theta1 = (D3DX_PI / 2) * (ring / (float)kNumRings);
-        float theta2 = (D3DX_PI / 2) * ((ring + 1) / (float)kNumRings);
-
-        for (int seg = 0; seg < kNumSegments; seg++)
-        {
-            float phi1 = (2 * D3DX_PI * seg) / kNumSegments;
-            float phi2 = (2 * D3DX_PI * (seg + 1)) / kNumSegments;
-
-            btVector3 p1 = btVector3(
-                cosf(phi1) * sinf(theta1),
-                -cosf(theta1),  // Y]
-                sinf(phi1) * sinf(theta1)
-            );
-            btVector3 p2 = btVector3(
-                cosf(phi2) * sinf(theta1),
-                -cosf(theta1),
-                sinf(phi2) * sinf(theta1)
-            );
-            btVector3 p3 = btVector3(
-                cosf(phi2) * sinf(theta2),
-                -cosf(theta2),
-                sinf(phi2) * sinf(theta2)
-            );
-            btVector3 p4 = btVector3(
-                cosf(phi1) * sinf(theta2),
-                -cosf(theta2),
-                sinf(phi1) * sinf(theta2)
-            );
-
-            p1 = bottom + p1 * radius;
-            p2 = bottom + p2 * radius;
-            p3 = bottom + p3 * radius;
-            p4 = bottom + p4 * radius;
-
-            DrawLine3D(D3DXVECTOR3(p1.x(), p1.y(), p1.z()), D3DXVECTOR3(p2.x(), p2.y(), p2.z()), color);
-            DrawLine3D(D3DXVECTOR3(p2.x(), p2.y(), p2.z()), D3DXVECTOR3(p3.x(), p3.y(), p3.z()), color);
-            DrawLine3D(D3DXVECTOR3(p3.x(), p3.y(), p3.z()), D3DXVECTOR3(p4.x(), p4.y(), p4.z()), color);
-            DrawLine3D(D3DXVECTOR3(p4.x(), p4.y(), p4.z()), D3DXVECTOR3(p1.x(), p1.y(), p1.z()), color);
-        }
-    }
+	if (pShape == nullptr)
+	{
+		return;
+	}
+
+	btVector3 pos = transform.getOrigin();
+
+	switch (pShape->getShapeType())
+	{
+	case BOX_SHAPE_PROXYTYPE:
+	{
+		const btBoxShape* box = static_cast<const btBoxShape*>(pShape);
+		btVector3 half = box->getHalfExtentsWithMargin();
+		btQuaternion rot = transform.getRotation();
+
+		// ワールド行列(回転 → 平行移動)
+		D3DXQUATERNION dq(rot.x(), rot.y(), rot.z(), rot.w());
+		D3DXMATRIX matRot, matTrans;
+
+		D3DXMatrixRotationQuaternion(&matRot, &dq);
+		D3DXMatrixTranslation(&matTrans, pos.x(), pos.y(), pos.z());
+
+		DrawOBB(matRot * matTrans, D3DXVECTOR3(half.x(), half.y(), half.z()), col, category);
+		break;
+	}
+	case SPHERE_SHAPE_PROXYTYPE:
+	{
+		const btSphereShape* sphere = static_cast<const btSphereShape*>(pShape);
+
+		DrawSphere(D3DXVECTOR3(pos.x(), pos.y(), pos.z()), sphere->getRadius(), col, category);
+		break;
+	}
+	case CAPSULE_SHAPE_PROXYTYPE:
+	{
+		const btCapsuleShape* capsule = static_cast<const btCapsuleShape*>(pShape);
+
+		// 芯の両端をワールドへ
+		btVector3 half(0, 0, 0);
+		half[capsule->getUpAxis()] = capsule->getHalfHeight();
+
+		btVector3 top = transform * half;
+		btVector3 bottom = transform * -half;
+
+		DrawCapsule(D3DXVECTOR3(bottom.x(), bottom.y(), bottom.z()), D3DXVECTOR3(top.x(), top.y(), top.z()),
+			capsule->getRadius(), col, category);
+		break;
+	}
+	case COMPOUND_SHAPE_PROXYTYPE:
+	{
+		const btCompoundShape* compound = static_cast<const btCompoundShape*>(pShape);
+		int numChildren = compound->getNumChildShapes();
+
+		for (int nCnt = 0; nCnt < numChildren; nCnt++)
+		{
+			// 子のローカル → ワールド変換
+			AddShape(compound->getChildShape(nCnt), transform * compound->getChildTransform(nCnt), col, category);
+		}
+		break;
+	}
+	default:
+		// 未対応の形(無視)
+		break;
+	}
 }
 //=============================================================================
-// ubÑRC_[`揈
+// 種類の名前の取得
 //=============================================================================
-void CDebugProc3D::DrawBlockCollider(btRigidBody* rigidBody, D3DXCOLOR color)
+const char* CDebugProc3D::GetCategoryName(CATEGORY category)
 {
-    if (!rigidBody || !m_pLine)
-    {
-        return;
-    }
-
-    // [hϊ擾
-    btTransform transform;
-
-    rigidBody->getMotionState()->getWorldTransform(transform);
-
-    btVector3 pos = transform.getOrigin();
-    btQuaternion rot = transform.getRotation();
-
-    // D3DXp̍s쐬i]j
-    D3DXQUATERNION dq(rot.x(), rot.y(), rot.z(), rot.w());
-
-    D3DXMATRIX matRot, matTrans, matWorld;
-
-    D3DXMatrixRotationQuaternion(&matRot, &dq);
-    D3DXMatrixTranslation(&matTrans, pos.x(), pos.y(), pos.z());
-
-    // [hsi]  sړj
-    matWorld = matRot * matTrans;
-
-    // foCX擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-    // sZbg
-    pDevice->SetTransform(D3DTS_WORLD, &matWorld);
-
-    btCollisionShape* shape = rigidBody->getCollisionShape();
-
-    switch (shape->getShapeType())
-    {
-    case BOX_SHAPE_PROXYTYPE:
-    {
-        const btBoxShape* box = static_cast<const btBoxShape*>(shape);
-        btVector3 half = box->getHalfExtentsWithMargin();
-
-        D3DXVECTOR3 v[8] =
-        {
-            { -half.x(), -half.y(), -half.z() },
-            { +half.x(), -half.y(), -half.z() },
-            { +half.x(), +half.y(), -half.z() },
-            { -half.x(), +half.y(), -half.z() },
-            { -half.x(), -half.y(), +half.z() },
-            { +half.x(), -half.y(), +half.z() },
-            { +half.x(), +half.y(), +half.z() },
-            { -half.x(), +half.y(), +half.z() },
-        };
-
-        int indices[][2] =
-        {
-            {0,1},{1,2},{2,3},{3,0},
-            {4,5},{5,6},{6,7},{7,4},
-            {0,4},{1,5},{2,6},{3,7}
-        };
-
-        for (int nCnt = 0; nCnt < 12; nCnt++)
-        {
-            DrawLine3D(v[indices[nCnt][0]], v[indices[nCnt][1]], color);
-        }
-        break;
-    }
-    case SPHERE_SHAPE_PROXYTYPE:
-    {
-        const btSphereShape* sphere = static_cast<const btSphereShape*>(shape);
-        float radius = sphere->getRadius();
-        const int kSegments = 16;
-        D3DXVECTOR3 center(0, 0, 0);
-
-        for (int nCnt = 0; nCnt < kSegments; nCnt++)
-        {
-            float t1 = (2.0f * D3DX_PI * nCnt) / kSegments;
-            float t2 = (2.0f * D3DX_PI * (nCnt + 1)) / kSegments;
-
-            // XY
-            D3DXVECTOR3 p1 = center + D3DXVECTOR3(cosf(t1), sinf(t1), 0) * radius;
-            D3DXVECTOR3 p2 = center + D3DXVECTOR3(cosf(t2), sinf(t2), 0) * radius;
-            DrawLine3D(p1, p2, color);
-
-            // YZ
-            p1 = center + D3DXVECTOR3(0, cosf(t1), sinf(t1)) * radius;
-            p2 = center + D3DXVECTOR3(0, cosf(t2), sinf(t2)) * radius;
-            DrawLine3D(p1, p2, color);
-
-            // XZ
-            p1 = center + D3DXVECTOR3(cosf(t1), 0, sinf(t1)) * radius;
-            p2 = center + D3DXVECTOR3(cosf(t2), 0, sinf(t2)) * radius;
-            DrawLine3D(p1, p2, color);
-        }
-        break;
-    }
-    case COMPOUND_SHAPE_PROXYTYPE:
-    {
-        const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
-        int numChildren = compound->getNumChildShapes();
-
-        for (int nCnt = 0; nCnt < numChildren; nCnt++)
-        {
-            const btCollisionShape* childShape = compound->getChildShape(nCnt);
-            const btTransform& childTrans = compound->getChildTransform(nCnt);
-
-            // q̃[J  [hϊ
-            btTransform worldTrans = transform * childTrans;
-
-            // q̈ʒuƉ]擾
-            btVector3 childPos = worldTrans.getOrigin();
-            btQuaternion childRot = worldTrans.getRotation();
-
-            // s쐬
-            D3DXMatrixRotationQuaternion(&matRot, &dq);
-            D3DXMatrixTranslation(&matTrans, childPos.x(), childPos.y(), childPos.z());
-            matWorld = matRot * matTrans;
-
-            // [hsZbg
-            pDevice->SetTransform(D3DTS_WORLD, &matWorld);
-
-            // qRC_[`iċAIɏj
-            int childType = childShape->getShapeType();
-
-            switch (childType)
-            {
-            case BOX_SHAPE_PROXYTYPE:
-            {
-                const btBoxShape* box = static_cast<const btBoxShape*>(childShape);
-                btVector3 half = box->getHalfExtentsWithMargin();
-
-                D3DXVECTOR3 v[8] =
-                {
-                    { -half.x(), -half.y(), -half.z() },
-                    { +half.x(), -half.y(), -half.z() },
-                    { +half.x(), +half.y(), -half.z() },
-                    { -half.x(), +half.y(), -half.z() },
-                    { -half.x(), -half.y(), +half.z() },
-                    { +half.x(), -half.y(), +half.z() },
-                    { +half.x(), +half.y(), +half.z() },
-                    { -half.x(), +half.y(), +half.z() },
-                };
-
-                int indices[][2] =
-                {
-                    {0,1},{1,2},{2,3},{3,0},
-                    {4,5},{5,6},{6,7},{7,4},
-                    {0,4},{1,5},{2,6},{3,7}
-                };
-
-                for (int nCnt2 = 0; nCnt2 < 12; nCnt2++)
-                {
-                    DrawLine3D(v[indices[nCnt2][0]], v[indices[nCnt2][1]], color);
-                }
-                break;
-            }
-            case SPHERE_SHAPE_PROXYTYPE:
-            {
-                const btSphereShape* sphere = static_cast<const btSphereShape*>(childShape);
-                float radius = sphere->getRadius();
-                const int kSegments = 16;
-                D3DXVECTOR3 center(0, 0, 0);
-
-                for (int nCnt2 = 0; nCnt2 < kSegments; nCnt2++)
-                {
-                    float t1 = (2.0f * D3DX_PI * nCnt2) / kSegments;
-                    float t2 = (2.0f * D3DX_PI * (nCnt2 + 1)) / kSegments;
-
-                    // XY
-                    D3DXVECTOR3 p1 = center + D3DXVECTOR3(cosf(t1), sinf(t1), 0) * radius;
-                    D3DXVECTOR3 p2 = center + D3DXVECTOR3(cosf(t2), sinf(t2), 0) * radius;
-                    DrawLine3D(p1, p2, color);
-
-                    // YZ
-                    p1 = center + D3DXVECTOR3(0, cosf(t1), sinf(t1)) * radius;
-                    p2 = center + D3DXVECTOR3(0, cosf(t2), sinf(t2)) * radius;
-                    DrawLine3D(p1, p2, color);
-
-                    // XZ
-                    p1 = center + D3DXVECTOR3(cosf(t1), 0, sinf(t1)) * radius;
-                    p2 = center + D3DXVECTOR3(cosf(t2), 0, sinf(t2)) * radius;
-                    DrawLine3D(p1, p2, color);
-                }
-                break;
-            }
-
-            default:
-                // Ή̎q^Cvij
-                break;
-            }
-        }
-    }
-    default:
-        break;
-    }
-}
\ No newline at end of file
+	static const char* apName[CATEGORY_MAX] =
+	{
+		"Block",
+		"Character",
+		"Weapon",
+		"Other",
+	};
+
+	if (category < 0 || category >= CATEGORY_MAX)
+	{
+		return "";
+	}
+
+	return apName[category];
+}
@@ -1,38 +1,122 @@
 //=============================================================================
 //
-// 3DfobO\ [debugproc3D.h]
+// 3Dデバッグ表示処理 [debugproc3D.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _DEBUGPROC3D_H_// ̃}N`ĂȂ
-#define _DEBUGPROC3D_H_// 2dCN[hh~̃}N`
+#ifndef _DEBUGPROC3D_H_// このマクロ定義がされていなかったら
+#define _DEBUGPROC3D_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 //*****************************************************************************
-// 3DfobONX
+// 3Dデバッグクラス(1フレーム分の線をワールド座標で集め、Zテストの有無ごとに1回で描く)
 //*****************************************************************************
 class CDebugProc3D
 {
 public:
+	// 表示の種類(種類ごとに表示・手前表示を切り替える)
+	typedef enum
+	{
+		CATEGORY_BLOCK = 0,		// ブロック
+		CATEGORY_CHARACTER,		// キャラクター
+		CATEGORY_WEAPON,		// 武器
+		CATEGORY_OTHER,			// その他
+		CATEGORY_MAX
+	}CATEGORY;
+
+	static constexpr int PRIORITY = 5;	// 描画の優先順位(この優先順位の最後にまとめて描く)
+
 	CDebugProc3D();
 	~CDebugProc3D();
 
-	void Init(void);
-	void Uninit(void);
+	static void Init(void);
+	static void Uninit(void);
+	static void Flush(void);
+	static void BeginFrame(void);
+	static void Clear(void);
+
+	//*****************************************************************************
+	// line描画関数(積むだけで、描画はFlushでまとめて行う)
+	//*****************************************************************************
+	static void DrawLine3D(const D3DXVECTOR3& start, const D3DXVECTOR3& end, D3DXCOLOR color, CATEGORY category = CATEGORY_OTHER);
+	static void DrawBox(const D3DXVECTOR3& min, const D3DXVECTOR3& max, D3DXCOLOR color, CATEGORY category = CATEGORY_OTHER);
+	static void DrawOBB(const D3DXMATRIX& mtxWorld, const D3DXVECTOR3& half, D3DXCOLOR color, CATEGORY category = CATEGORY_OTHER);
+	static void DrawSphere(const D3DXVECTOR3& center, float radius, D3DXCOLOR color, CATEGORY category = CATEGORY_OTHER);
+	static void DrawCapsule(const D3DXVECTOR3& start, const D3DXVECTOR3& end, float radius, D3DXCOLOR color, CATEGORY category = CATEGORY_OTHER);
+	static void DrawCapsuleCollider(btCapsuleShape* capsule, const btTransform& transform, D3DXCOLOR color, CATEGORY category = CATEGORY_CHARACTER);
+	static void DrawBlockCollider(btRigidBody* rigidBody, D3DXCOLOR color, CATEGORY category = CATEGORY_BLOCK);
 
 	//*****************************************************************************
-	// line`֐
+	// setter関数
 	//*****************************************************************************
-	static void DrawLine3D(const D3DXVECTOR3& start, const D3DXVECTOR3& end, D3DXCOLOR color);
-	static void DrawCapsuleCollider(btCapsuleShape* capsule, const btTransform& transform, D3DXCOLOR color);
-	static void DrawBlockCollider(btRigidBody* rigidBody, D3DXCOLOR color);
+	static void SetEnable(bool bEnable) { m_bEnable = bEnable; }
+	static void SetCategoryEnable(CATEGORY category, bool bEnable) { SetFlag(m_visibleMask, category, bEnable); }
+	static void SetCategoryOverlay(CATEGORY category, bool bOverlay) { SetFlag(m_overlayMask, category, bOverlay); }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static bool IsEnable(void) { return m_bEnable; }
+	static bool IsCategoryEnable(CATEGORY category) { return (m_visibleMask & (1u << category)) != 0; }
+	static bool IsVisible(CATEGORY category) { return m_bEnable && IsCategoryEnable(category); }
+	static bool IsCategoryOverlay(CATEGORY category) { return (m_overlayMask & (1u << category)) != 0; }
+	static const char* GetCategoryName(CATEGORY category);
+	static int GetNumLine(void) { return m_nNumLine; }
+	static int GetNumDrawCall(void) { return m_nNumDrawCall; }
 
 private:
-	static LPD3DXLINE m_pLine;   // C`pIuWFNg
+	static constexpr int	BATCH_LINE		= 65535;	// 1回の描画で描く最大の線の数(デバイスの上限が小さければそちらに合わせる)
+	static constexpr int	RESERVE_VERTEX	= 8192;		// 最初に確保しておく頂点の数
+	static constexpr int	SPHERE_SEGMENT	= 16;		// 球の円の分割数
+	static constexpr int	CAPSULE_SEGMENT	= 12;		// カプセルの円の分割数
+	static constexpr int	CAPSULE_RING	= 4;		// カプセルの半球の縦分割数
+	static constexpr DWORD	FVF_LINE		= D3DFVF_XYZ | D3DFVF_DIFFUSE;// 線の頂点フォーマット
+
+	// Zテストの有無
+	typedef enum
+	{
+		DEPTH_TEST = 0,		// 奥行きで隠れる
+		DEPTH_OVERLAY,		// 常に手前に出す
+		DEPTH_MAX
+	}DEPTH;
+
+	// 線の頂点(ワールド座標)
+	typedef struct
+	{
+		D3DXVECTOR3	pos;	// 位置
+		D3DCOLOR	col;	// 色
+	}Vertex;
+
+	static void SetFlag(unsigned int& mask, CATEGORY category, bool bOn)
+	{
+		if (bOn)
+		{
+			mask |= (1u << category);
+		}
+		else
+		{
+			mask &= ~(1u << category);
+		}
+	}
+	static std::vector<Vertex>& GetList(CATEGORY category)
+	{
+		return m_aVtx[IsCategoryOverlay(category) ? DEPTH_OVERLAY : DEPTH_TEST];
+	}
+	static void AddLine(std::vector<Vertex>& list, const D3DXVECTOR3& start, const D3DXVECTOR3& end, D3DCOLOR col);
+	static void AddShape(const btCollisionShape* pShape, const btTransform& transform, D3DCOLOR col, CATEGORY category);
 
+	static std::vector<Vertex>	m_aVtx[DEPTH_MAX];	// Zテストの有無ごとの今回描く線
+	static bool					m_bEnable;			// 表示するか
+	static unsigned int			m_visibleMask;		// 種類ごとの表示フラグ
+	static unsigned int			m_overlayMask;		// 種類ごとの手前表示フラグ
+	static int					m_nFrameLine;		// 今回描いた線の数
+	static int					m_nFrameDrawCall;	// 今回の描画回数
+	static int					m_nNumLine;			// 前回のフレームで描いた線の数
+	static int					m_nNumDrawCall;		// 前回のフレームの描画回数
+	static int					m_nBatchLine;		// 1回の描画で描く線の数
 };
 
-#endif
\ No newline at end of file
+#endif
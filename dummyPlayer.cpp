@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// _~[vC[ [dummyPlayer.cpp]
+// ダミープレイヤー処理 [dummyPlayer.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "dummyPlayer.h"
 #include "manager.h"
@@ -15,37 +15,37 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CDummyPlayer::CDummyPlayer(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_apModel, 0, sizeof(m_apModel));	// f(p[c)ւ̃|C^
-	m_pos		= INIT_VEC3;					// ʒu
-	m_rot		= INIT_VEC3;					// 
-	m_size		= D3DXVECTOR3(1.2f, 1.2f, 1.2f);// TCY
-	m_move		= INIT_VEC3;					// ړ
-	m_mtxWorld	= {};							// [h}gbNX
-	m_nNumModel = 0;							// f(p[c)̑
-	m_pShadowS	= nullptr;						// XeVVhEւ̃|C^
-	m_pMotion	= nullptr;						// [Vւ̃|C^
-	m_isVisible = true;							// tO(ftHgtrue)
+	// 値のクリア
+	memset(m_apModel, 0, sizeof(m_apModel));	// モデル(パーツ)へのポインタ
+	m_pos		= INIT_VEC3;					// 位置
+	m_rot		= INIT_VEC3;					// 向き
+	m_size		= D3DXVECTOR3(1.2f, 1.2f, 1.2f);// サイズ
+	m_move		= INIT_VEC3;					// 移動量
+	m_mtxWorld	= {};							// ワールドマトリックス
+	m_nNumModel = 0;							// モデル(パーツ)の総数
+	m_pShadowS	= nullptr;						// ステンシルシャドウへのポインタ
+	m_pMotion	= nullptr;						// モーションへのポインタ
+	m_isVisible = true;							// 可視フラグ(デフォルトはtrue)
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CDummyPlayer::~CDummyPlayer()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CDummyPlayer* CDummyPlayer::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot, int motionType)
 {
 	CDummyPlayer* pDummyPlayer = new CDummyPlayer;
 
-	// nullptr
+	// nullptrだったら
 	if (pDummyPlayer == nullptr)
 	{
 		return nullptr;
@@ -55,7 +55,7 @@ CDummyPlayer* CDummyPlayer::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot, int motionT
 	pDummyPlayer->SetRot(D3DXToRadian(rot));
 	pDummyPlayer->SetMotionType(motionType);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pDummyPlayer->Init()))
 	{
 		return nullptr;
@@ -64,39 +64,38 @@ CDummyPlayer* CDummyPlayer::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot, int motionT
 	return pDummyPlayer;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CDummyPlayer::Init(void)
 {
 	CModel* pModels[MAX_PARTS];
 	int nNumModels = 0;
 
-	// p[c̓ǂݍ
+	// パーツの読み込み
 	m_pMotion = CMotion::Load("data/dummy_motion.txt", pModels, nNumModels, MAX);
 
 	for (int nCnt = 0; nCnt < nNumModels && nCnt < MAX_PARTS; nCnt++)
 	{
 		m_apModel[nCnt] = pModels[nCnt];
 
-		// ItZbgl
+		// オフセット考慮
 		m_apModel[nCnt]->SetOffsetPos(m_apModel[nCnt]->GetPos());
 		m_apModel[nCnt]->SetOffsetRot(m_apModel[nCnt]->GetRot());
 	}
 
-	// p[c
+	// パーツ数を代入
 	m_nNumModel = nNumModels;
 
-	// XeVVhE̐
+	// ステンシルシャドウの生成
 	m_pShadowS = CShadowS::Create("data/MODELS/stencilshadow.x", D3DXVECTOR3(1.0f, 1.0f, 1.0f));
-	m_pShadowS->SetStencilRef(1);// ʂ̃XeVobt@̎Qƒlݒ
 
-	// [Vݒ
+	// モーションを設定
 	m_pMotion->SetMotion(m_motionType);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CDummyPlayer::Uninit(void)
 {
@@ -116,15 +115,15 @@ void CDummyPlayer::Uninit(void)
 		m_pMotion = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CDummyPlayer::Update(void)
 {
-	// tOOFF͉̎ẽTCY0ɂČȂ
+	// 可視フラグがOFFの時は影のサイズを0にして見えなくする
 	if (!m_isVisible)
 	{
 		m_pShadowS->SetSize(D3DXVECTOR3(0.0f, 0.0f, 0.0f));
@@ -136,46 +135,46 @@ void CDummyPlayer::Update(void)
 
 	if (m_pShadowS != nullptr)
 	{
-		// XeVVhËʒuݒ
+		// ステンシルシャドウの位置設定
 		m_pShadowS->SetPosition(m_pos);
 	}
 
-	// ړʂ̍XV
+	// 移動量の更新
 	m_pos += m_move;
 
-	// [V̍XV
+	// モーションの更新処理
 	m_pMotion->Update(m_apModel, m_nNumModel);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CDummyPlayer::Draw(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// vZp}gbNX
+	// 計算用マトリックス
 	D3DXMATRIX mtxRot, mtxTrans, mtxSize;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// TCY𔽉f
+	// サイズを反映
 	D3DXMatrixScaling(&mtxSize, m_size.x, m_size.y, m_size.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxSize);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNXݒ
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// tOfalse͕̎`悵Ȃ
+	// 可視フラグがfalseの時は描画しない
 	if (!m_isVisible)
 	{
 		return;
@@ -183,7 +182,7 @@ void CDummyPlayer::Draw(void)
 
 	for (int nCntMat = 0; nCntMat < m_nNumModel; nCntMat++)
 	{
-		// f(p[c)̕`
+		// モデル(パーツ)の描画
 		if (m_apModel[nCntMat])
 		{
 			m_apModel[nCntMat]->Draw();
@@ -191,13 +190,13 @@ void CDummyPlayer::Draw(void)
 	}
 }
 //=============================================================================
-// OxNg擾
+// 前方ベクトル取得
 //=============================================================================
 D3DXVECTOR3 CDummyPlayer::GetForward(void)
 {
 	D3DXVECTOR3 forward(-m_mtxWorld._31, m_mtxWorld._32, -m_mtxWorld._33);
 
-	// K
+	// 正規化する
 	D3DXVec3Normalize(&forward, &forward);
 
 	return forward;
@@ -1,27 +1,27 @@
 //=============================================================================
 //
-// _~[vC[ [dummyPlayer.h]
+// ダミープレイヤー処理 [dummyPlayer.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _DUMMYPLAYER_H_// ̃}N`ĂȂ
-#define _DUMMYPLAYER_H_// 2dCN[hh~̃}N`
+#ifndef _DUMMYPLAYER_H_// このマクロ定義がされていなかったら
+#define _DUMMYPLAYER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "motion.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CShadowS;
 class CModel;
 
 
 //*****************************************************************************
-// _~[vC[NX
+// ダミープレイヤークラス
 //*****************************************************************************
 class CDummyPlayer : public CObject
 {
@@ -29,12 +29,12 @@ public:
 	CDummyPlayer(int nPriority = 2);
 	~CDummyPlayer();
 
-	// _~[vC[[V̎
+	// ダミープレイヤーモーションの種類
 	enum DUMMY_MOTION
 	{
-		NEUTRAL = 0,		// ҋ@
-		DUSH,				// _bV
-		APPEARANCE,			// o
+		NEUTRAL = 0,		// 待機
+		DUSH,				// ダッシュ
+		APPEARANCE,			// 出現
 		MAX
 	};
 
@@ -45,7 +45,7 @@ public:
 	void Draw(void);
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
 	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
 	void SetRot(D3DXVECTOR3 rot) { m_rot = rot; }
@@ -54,7 +54,7 @@ public:
 	void SetMove(D3DXVECTOR3 move) { m_move = move; }
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
 	D3DXVECTOR3 GetRot(void) { return m_rot; }
@@ -64,19 +64,19 @@ public:
 	bool IsVisible(void) { return m_isVisible; }
 
 private:
-	static constexpr int MAX_PARTS = 32;// őp[c
+	static constexpr int MAX_PARTS = 32;// 最大パーツ数
 
-	D3DXVECTOR3 m_pos;					// ʒu
-	D3DXVECTOR3 m_rot;					// 
-	D3DXVECTOR3 m_size;					// TCY
-	D3DXVECTOR3 m_move;					// ړ
-	D3DXMATRIX	m_mtxWorld;				// [h}gbNX
-	CModel*		m_apModel[MAX_PARTS];	// f(p[c)ւ̃|C^
-	CShadowS*	m_pShadowS;				// XeVVhEւ̃|C^
-	CMotion*	m_pMotion;				// [Vւ̃|C^
-	int			m_nNumModel;			// f(p[c)̑
-	int			m_motionType;			// [Ṽ^Cv
-	bool		m_isVisible;			// tO
+	D3DXVECTOR3 m_pos;					// 位置
+	D3DXVECTOR3 m_rot;					// 向き
+	D3DXVECTOR3 m_size;					// サイズ
+	D3DXVECTOR3 m_move;					// 移動量
+	D3DXMATRIX	m_mtxWorld;				// ワールドマトリックス
+	CModel*		m_apModel[MAX_PARTS];	// モデル(パーツ)へのポインタ
+	CShadowS*	m_pShadowS;				// ステンシルシャドウへのポインタ
+	CMotion*	m_pMotion;				// モーションへのポインタ
+	int			m_nNumModel;			// モデル(パーツ)の総数
+	int			m_motionType;			// モーションのタイプ
+	bool		m_isVisible;			// 可視フラグ
 
 };
 
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// C[WO [easing.h]
+// イージング処理 [easing.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,16 +8,16 @@
 #define _EASING_H_
 
 //*****************************************************************************
-// C[WONX
+// イージングクラス
 //*****************************************************************************
 class CEasing
 {
 public:
-    // t : 0.0f ` 1.0f ̊
-    // ߂l : Ԍ̒l (0.0f`1.0f)
+    // t : 0.0f ～ 1.0f の割合
+    // 戻り値 : 補間後の値 (0.0f～1.0f)
 
     //=========================================================================
-    // {C[WO
+    // 基本イージング
     //=========================================================================
     static float Linear(float t) { return t; }
 
@@ -172,7 +172,7 @@ public:
     }
 
     //=========================================================================
-    // l̕Ԋ֐
+    // 値の補間関数
     //=========================================================================
     static float Lerp(float a, float b, float t)
     {
@@ -180,9 +180,9 @@ public:
     }
 
     //=========================================================================
-    // C[WOĂяo֐
+    // イージング呼び出し関数
     //=========================================================================
-    // easingType : gC[WO̎
+    // easingType : 使いたいイージングの種類
     template <typename EaseType>
     static float Ease(float a, float b, float t, EaseType easingType)
     {
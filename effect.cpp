@@ -1,48 +1,48 @@
 //=============================================================================
 //
-// GtFNg [effect.cpp]
+// エフェクト処理 [effect.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "effect.h"
 #include "renderer.h"
 #include "manager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CEffect::CEffect(int nPriority) : CObjectBillboard(nPriority)
 {
-	// l̃NA
-	m_move			= INIT_VEC3;// ʒu
-	m_fRadius		= 0.0f;		// a
-	m_nLife			= 0;		// 
-	m_nIdxTexture	= 0;		// eNX`CfbNX
-	m_fGravity		= 0.0f;		// d
-	m_bBlend		= true;		// At@uh邩ǂ
-	m_bTurn			= false;	// ]邩
-	m_turnSpeed		= 0.0f;		// ]Xs[h
+	// 値のクリア
+	m_move			= INIT_VEC3;// 位置
+	m_fRadius		= 0.0f;		// 半径
+	m_nLife			= 0;		// 寿命
+	m_nIdxTexture	= 0;		// テクスチャインデックス
+	m_fGravity		= 0.0f;		// 重力
+	m_bBlend		= true;		// アルファブレンドするかどうが
+	m_bTurn			= false;	// 回転するか
+	m_turnSpeed		= 0.0f;		// 回転スピード
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CEffect::~CEffect()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CEffect* CEffect::Create(const EffectDesc& desc)
 {
-	// GtFNgIuWFNg̐
+	// エフェクトオブジェクトの生成
 	CEffect* pEffect = new CEffect;
 
-	// nullptr
+	// nullptrだったら
 	if (pEffect == nullptr)
 	{
 		return nullptr;
@@ -50,7 +50,7 @@ CEffect* CEffect::Create(const EffectDesc& desc)
 
 	pEffect->SetPath(desc.path);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pEffect->Init()))
 	{
 		return nullptr;
@@ -70,55 +70,58 @@ CEffect* CEffect::Create(const EffectDesc& desc)
 	return pEffect;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CEffect::Init(void)
 {
-	// r{[hIuWFNg̏
+	// ビルボードオブジェクトの初期化処理
 	CObjectBillboard::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CEffect::Uninit(void)
 {
-	// r{[hIuWFNg̏I
+	// ビルボードオブジェクトの終了処理
 	CObjectBillboard::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CEffect::Update(void)
 {
-	// r{[hIuWFNg̍XV
+	// 更新したエフェクト数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_EFFECT);
+
+	// ビルボードオブジェクトの更新処理
 	CObjectBillboard::Update();
 
-	if (m_bTurn)// ]
+	if (m_bTurn)// 回転あり
 	{
-		// ̎擾
+		// 向きの取得
 		D3DXVECTOR3 rot = GetRot();
 
-		// ]
+		// 回転させる
 		rot.z += m_turnSpeed;
 
-		// ̐ݒ
+		// 向きの設定
 		SetRot(rot);
 
-		// r{[hIuWFNg̍XV(])
+		// ビルボードオブジェクトの更新処理(回転)
 		CObjectBillboard::UpdateTurn();
 	}
 
-	m_move.y += m_fGravity; // d͉x
+	m_move.y += m_fGravity; // 重力加速度
 
-	// ʒu̎擾
+	// 位置の取得
 	D3DXVECTOR3 Pos = GetPos();
 
-	// ʒuXV
+	// 位置を更新
 	Pos += m_move;
 
-	// ʒu̐ݒ
+	// 位置の設定
 	SetPos(Pos);
 	SetSize(m_fRadius);
 
@@ -133,85 +136,55 @@ void CEffect::Update(void)
 
 	if (m_nLife <= 0 || m_fRadius <= 0.0f)
 	{
-		// GtFNg̏I
+		// エフェクトの終了
 		Uninit();
 		return;
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CEffect::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	if (m_bBlend)
+	// 画面外や遠くのエフェクトは描画しない
+	if (!CCulling::IsVisibleSphere(GetPos(), m_fRadius, CCulling::TYPE_EFFECT))
 	{
-		pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // Cg𖳌ɂ
-
-		// ufBOZɐݒ
-		pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
-		pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
-		pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE);
-
-		// eXgL
-		pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);//ftHgfalse
-		pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
-		pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);//0傫`
+		return;
 	}
 
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
+	// 加算合成かどうか(状態の設定はCBillboardRendererがまとめて行う)
+	SetBlendMode(m_bBlend ? CBillboardRenderer::BLEND_ADD : CBillboardRenderer::BLEND_NORMAL);
 
-	// r{[hIuWFNg̕`揈
+	// ビルボードオブジェクトの描画処理
 	CObjectBillboard::Draw();
-
-	if (m_bBlend)
-	{
-		// eXg𖳌ɖ߂
-		pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);//ftHgfalse
-
-		// ufBOɖ߂
-		pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
-		pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
-		pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
-
-		pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // CgLɂ
-	}
 }
-
-
 //=============================================================================
-// fGtFNg̃RXgN^
+// モデルエフェクトのコンストラクタ
 //=============================================================================
 CModelEffect::CModelEffect()
 {
-	// l̃NA
-	m_nLife		= 0;			// ibj
-	m_fGravity	= 0.0f;			// d͉x
-	m_scaleDec	= 0.0f;			// TCY
-	m_velocity	= INIT_VEC3;	// x
+	// 値のクリア
+	m_nLife		= 0;			// 寿命（秒）
+	m_fGravity	= 0.0f;			// 重力加速度
+	m_scaleDec	= 0.0f;			// サイズ減衰率
+	m_velocity	= INIT_VEC3;	// 速度
 }
 //=============================================================================
-// fGtFNg̃fXgN^
+// モデルエフェクトのデストラクタ
 //=============================================================================
 CModelEffect::~CModelEffect()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// fGtFNg̐
+// モデルエフェクトの生成処理
 //=============================================================================
 CModelEffect* CModelEffect::Create(const char* path, D3DXVECTOR3 pos, D3DXVECTOR3 rot, D3DXVECTOR3 velocity, D3DXVECTOR3 size, 
 	int nLife, float fGravity, float scaleDec)
 {
 	CModelEffect* pEffect = new CModelEffect;
 
-	// nullptr
+	// nullptrだったら
 	if (pEffect == nullptr)
 	{
 		return nullptr;
@@ -219,7 +192,7 @@ CModelEffect* CModelEffect::Create(const char* path, D3DXVECTOR3 pos, D3DXVECTOR
 
 	pEffect->SetPath(path);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pEffect->Init()))
 	{
 		return nullptr;
@@ -236,57 +209,57 @@ CModelEffect* CModelEffect::Create(const char* path, D3DXVECTOR3 pos, D3DXVECTOR
 	return pEffect;
 }
 //=============================================================================
-// fGtFNg̏
+// モデルエフェクトの初期化処理
 //=============================================================================
 HRESULT CModelEffect::Init(void)
 {
-	// Xt@CIuWFNg̏
+	// Xファイルオブジェクトの初期化処理
 	CObjectX::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// fGtFNg̏I
+// モデルエフェクトの終了処理
 //=============================================================================
 void CModelEffect::Uninit(void)
 {
-	// Xt@CIuWFNg̏I
+	// Xファイルオブジェクトの終了処理
 	CObjectX::Uninit();
 }
 //=============================================================================
-// fGtFNg̍XV
+// モデルエフェクトの更新処理
 //=============================================================================
 void CModelEffect::Update(void)
 {
-	D3DXVECTOR3 Pos = GetPos();		// ʒu̎擾
-	D3DXVECTOR3 Rot = GetRot();		// ̎擾
-	D3DXVECTOR3 Size = GetSize();	// TCY̎擾
+	D3DXVECTOR3 Pos = GetPos();		// 位置の取得
+	D3DXVECTOR3 Rot = GetRot();		// 向きの取得
+	D3DXVECTOR3 Size = GetSize();	// サイズの取得
 
 	if (m_nLife <= 0 || Size.x <= 0 || Size.y <= 0 || Size.z <= 0)
 	{
-		// I
+		// 終了処理
 		Uninit();
 		return;
 	}
 
-	// 炷
+	// 寿命を減らす
 	m_nLife--;
 
-	// TCY̌
+	// サイズの減衰
 	Size.x -= m_scaleDec;
 	Size.y -= m_scaleDec;
 	Size.z -= m_scaleDec;
 
-	// d͂Z
+	// 重力を加算
 	m_velocity.y += m_fGravity;
 
-	// ʒuXV
+	// 位置を更新
 	Pos += m_velocity;
 
 	SetPos(Pos);
 	SetRot(Rot);
 	SetSize(Size);
 
-	// Xt@CIuWFNg̍XV
+	// Xファイルオブジェクトの更新処理
 	CObjectX::Update();
 }
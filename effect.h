@@ -1,19 +1,20 @@
 //=============================================================================
 //
-// GtFNg [effect.h]
+// エフェクト処理 [effect.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _EFFECT_H_// ̃}N`ĂȂ
-#define _EFFECT_H_// 2dCN[hh~̃}N`
+#ifndef _EFFECT_H_// このマクロ定義がされていなかったら
+#define _EFFECT_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "objectbillboard.h"
 #include "block.h"
+#include "memorymanager.h"
 
-// GtFNg\
+// エフェクト構造体
 struct EffectDesc
 {
 	const char*	  path			= nullptr;
@@ -30,7 +31,7 @@ struct EffectDesc
 };
 
 //*****************************************************************************
-// GtFNgNX
+// エフェクトクラス
 //*****************************************************************************
 class CEffect : public CObjectBillboard
 {
@@ -39,6 +40,11 @@ public:
 	~CEffect();
 
 	static CEffect* Create(const EffectDesc& desc);
+
+	// 大量に生成と破棄を繰り返すのでシーンアリーナから確保する
+	static void* operator new(size_t size) { return CMemoryManager::GetSceneArena().Alloc(size); }
+	static void operator delete(void* p, size_t size) { CMemoryManager::GetSceneArena().Free(p, size); }
+
 	HRESULT Init(void);
 	void Uninit(void);
 	void Update(void);
@@ -57,19 +63,19 @@ public:
 	float GetGravity(void) { return m_fGravity; }
 
 private:
-	D3DXVECTOR3 m_move;			// ړ
-	float		m_fRadius;		// a
-	int			m_nLife;		// 
-	int			m_nIdxTexture;	// eNX`CfbNX
-	float		m_fGravity;		// d
-	float		m_fDecRadius;	// ǎ
-	bool		m_bBlend;		// At@uh邩ǂ
-	bool		m_bTurn;		// ]邩
-	float		m_turnSpeed;	// ]Xs[h
+	D3DXVECTOR3 m_move;			// 移動量
+	float		m_fRadius;		// 半径
+	int			m_nLife;		// 寿命
+	int			m_nIdxTexture;	// テクスチャインデックス
+	float		m_fGravity;		// 重力
+	float		m_fDecRadius;	// 半径の減衰量
+	bool		m_bBlend;		// アルファブレンドするかどうが
+	bool		m_bTurn;		// 回転するか
+	float		m_turnSpeed;	// 回転スピード
 };
 
 //*****************************************************************************
-// fGtFNgNX
+// モデルエフェクトクラス
 //*****************************************************************************
 class CModelEffect : public CObjectX
 {
@@ -88,11 +94,13 @@ public:
 	void SetScaleDec(float fDec) { m_scaleDec = fDec; }
 	void SetLife(int nLife) { m_nLife = nLife; }
 
+	CCulling::TYPE GetCullType(void) override { return CCulling::TYPE_EFFECT; }
+
 private:
-	int			m_nLife;	// 
-	float		m_fGravity;	// d͉x
-	float		m_scaleDec;	// TCY
-	D3DXVECTOR3 m_velocity; // x
+	int			m_nLife;	// 寿命
+	float		m_fGravity;	// 重力加速度
+	float		m_scaleDec;	// サイズ減衰率
+	D3DXVECTOR3 m_velocity; // 速度
 };
 
 #endif
\ No newline at end of file
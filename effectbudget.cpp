@@ -0,0 +1,371 @@
+//=============================================================================
+//
+// エフェクト予算処理 [effectbudget.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "effectbudget.h"
+#include "culling.h"
+#include "particle.h"
+#include "random.h"
+#include "algorithm"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+const CEffectBudget::Info CEffectBudget::m_aInfo[CEffectBudget::CATEGORY_MAX] =
+{
+	// 優先度			上限数		大きさ		広がり		距離
+	{ PRIORITY_MIDDLE,	1500,		14.0f,		60.0f,		2500.0f },	// 炎
+	{ PRIORITY_LOW,		1200,		55.0f,		80.0f,		2000.0f },	// 埋蔵金のきらめき
+	{ PRIORITY_HIGH,	800,		14.0f,		40.0f,		3000.0f },	// 鬼火
+	{ PRIORITY_MIDDLE,	1500,		25.0f,		150.0f,		2000.0f },	// 扉・歯車の砂埃
+	{ PRIORITY_HIGH,	600,		9.0f,		80.0f,		1500.0f },	// 水しぶき
+	{ PRIORITY_MIDDLE,	1000,		43.0f,		100.0f,		2500.0f },	// 煙
+	{ PRIORITY_LOW,		1000,		12.0f,		700.0f,		0.0f },		// 桜吹雪(カメラの周りに出すので距離では減らさない)
+	{ PRIORITY_HIGH,	400,		22.0f,		60.0f,		0.0f },		// ダッシュの砂煙(プレイヤーの足元)
+	{ PRIORITY_HIGH,	400,		10.0f,		60.0f,		1500.0f },	// 血しぶき
+	{ PRIORITY_LOW,		800,		20.0f,		80.0f,		2000.0f },	// 浮遊する粒
+	{ PRIORITY_HIGH,	100,		50.0f,		150.0f,		0.0f },		// 効果音のポップアップ(敵に聞こえた音の表示なので減らさない)
+	{ PRIORITY_MIDDLE,	MAX_ALIVE,	10.0f,		100.0f,		0.0f },		// その他
+};
+const float CEffectBudget::m_afPriorityRate[CEffectBudget::PRIORITY_MAX] =
+{
+	0.6f,	// 低い(全体の6割まで)
+	0.85f,	// 普通(全体の8割5分まで)
+	1.0f,	// 高い(全体の上限まで)
+};
+int CEffectBudget::m_anAlive[CEffectBudget::CATEGORY_MAX] = {};
+int CEffectBudget::m_nNumAlive = 0;
+int CEffectBudget::m_nNumSuppressed = 0;
+int CEffectBudget::m_nNumCulled = 0;
+bool CEffectBudget::m_bEnable = true;
+
+//=============================================================================
+// 出してよい粒子の数を求める処理
+//=============================================================================
+int CEffectBudget::Request(CATEGORY category, const D3DXVECTOR3& pos, int nWanted)
+{
+	if (nWanted <= 0)
+	{
+		return 0;
+	}
+
+	if (!m_bEnable)
+	{
+		return nWanted;
+	}
+
+	const Info& info = m_aInfo[category];
+	float fRate = 1.0f;
+
+	// カメラが未設定の時(起動直後など)は距離で減らさない
+	if (CCulling::IsValid())
+	{
+		// 粒子が広がる範囲ごと画面外なら出さない
+		if (!CCulling::GetFrustum().TestSphere(pos, info.fBound))
+		{
+			m_nNumCulled += nWanted;
+			return 0;
+		}
+
+		if (info.fDistance > 0.0f)
+		{
+			D3DXVECTOR3 diff = pos - CCulling::GetCameraPos();
+			float fDistance = D3DXVec3Length(&diff);
+
+			if (fDistance > info.fDistance)
+			{
+				m_nNumCulled += nWanted;
+				return 0;
+			}
+
+			// 画面上の粒子の大きさ(ピクセル)が小さいほど減らす
+			float fPixel = info.fRadius * CCulling::GetProjScale() * (SCREEN_HEIGHT * 0.5f) / std::max(fDistance, 1.0f);
+			fRate = std::clamp(fPixel / FULL_PIXEL, MIN_RATE, 1.0f);
+		}
+	}
+
+	// 端数は確率で切り上げる(1粒ずつ出すものも遠くで時々は出るように)
+	float fNum = nWanted * fRate;
+	int nNum = (int)fNum;
+
+	if (CRandom::Get(CRandom::STREAM_EFFECT).Float() < fNum - (float)nNum)
+	{
+		nNum++;
+	}
+
+	// 全体と種類ごとの空きに収める
+	nNum = std::min(nNum, Limit(category));
+
+	m_nNumSuppressed += nWanted - nNum;
+
+	return nNum;
+}
+//=============================================================================
+// 1粒出せるかどうかの判定処理
+//=============================================================================
+bool CEffectBudget::CanSpawn(CATEGORY category)
+{
+	return !m_bEnable || Limit(category) > 0;
+}
+//=============================================================================
+// 空きの数を求める処理(優先度が低いほど全体の上限を早く打ち切る)
+//=============================================================================
+int CEffectBudget::Limit(CATEGORY category)
+{
+	const Info& info = m_aInfo[category];
+
+	int nGlobal = (int)(MAX_ALIVE * m_afPriorityRate[info.priority]) - m_nNumAlive;
+	int nQuota = info.nQuota - m_anAlive[category];
+
+	return std::max(std::min(nGlobal, nQuota), 0);
+}
+//=============================================================================
+// 数のリセット処理(粒子を全て破棄した時)
+//=============================================================================
+void CEffectBudget::Reset(void)
+{
+	for (int nCnt = 0; nCnt < CATEGORY_MAX; nCnt++)
+	{
+		m_anAlive[nCnt] = 0;
+	}
+
+	m_nNumAlive = 0;
+	m_nNumSuppressed = 0;
+	m_nNumCulled = 0;
+}
+//=============================================================================
+// 確認処理(描画デバイスを使わずに大量に出し続け、上限が守られるかを調べる)
+//=============================================================================
+bool CEffectBudget::RunTest(const char* filename)
+{
+	const float	TEST_FOV		= 80.0f;	// 視野角(CCameraと合わせる)
+	const float	TEST_NEAR		= 1.0f;		// 近クリップ面
+	const float	TEST_FAR		= 3500.0f;	// 遠クリップ面
+	const float	TEST_FIELD		= 3000.0f;	// 発生源を置く範囲(原点からの距離)
+	const int	TEST_LOD_NUM	= 2000;		// 距離による減り方を調べる回数
+
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	bool bAllPass = true;
+
+	auto report = [&](const char* pName, bool bPass, const char* pDetail)
+	{
+		fprintf(pFile, "%-28s : %s  %s\n", pName, bPass ? "pass" : "FAIL", pDetail);
+
+		if (!bPass)
+		{
+			bAllPass = false;
+		}
+	};
+
+	char szDetail[256];
+
+	// 原点から奥(+Z)を見るカメラ
+	D3DXVECTOR3 posV(0.0f, 200.0f, 0.0f);
+	D3DXVECTOR3 posR(0.0f, 200.0f, 1000.0f);
+	D3DXVECTOR3 vecU(0.0f, 1.0f, 0.0f);
+
+	D3DXMATRIX mtxView, mtxProj;
+	D3DXMatrixLookAtLH(&mtxView, &posV, &posR, &vecU);
+	D3DXMatrixPerspectiveFovLH(&mtxProj, D3DXToRadian(TEST_FOV),
+		(float)SCREEN_WIDTH / (float)SCREEN_HEIGHT, TEST_NEAR, TEST_FAR);
+
+	CCulling::SetCamera(mtxView, mtxProj, posV);
+
+	CParticleSystem::Clear();
+	m_bEnable = true;
+
+	// --------------------------
+	// 距離と画面外による減り方
+	// --------------------------
+	int nBehind = Request(CATEGORY_ONIBI, D3DXVECTOR3(0.0f, 200.0f, -1000.0f), 10);
+	sprintf_s(szDetail, "%d / 10", nBehind);
+	report("behind camera", nBehind == 0, szDetail);
+
+	int nNear = Request(CATEGORY_ONIBI, D3DXVECTOR3(0.0f, 200.0f, 300.0f), 10);
+	sprintf_s(szDetail, "%d / 10", nNear);
+	report("near", nNear == 10, szDetail);
+
+	int nBeyond = Request(CATEGORY_ONIBI, D3DXVECTOR3(0.0f, 200.0f, 3200.0f), 10);
+	sprintf_s(szDetail, "%d / 10", nBeyond);
+	report("beyond distance", nBeyond == 0, szDetail);
+
+	int nMiddleSum = 0, nFarSum = 0;
+
+	for (int nCnt = 0; nCnt < TEST_LOD_NUM; nCnt++)
+	{
+		nMiddleSum += Request(CATEGORY_ONIBI, D3DXVECTOR3(0.0f, 200.0f, 1500.0f), 1);
+		nFarSum += Request(CATEGORY_ONIBI, D3DXVECTOR3(0.0f, 200.0f, 2800.0f), 1);
+	}
+
+	float fMiddleRate = (float)nMiddleSum / TEST_LOD_NUM;
+	float fFarRate = (float)nFarSum / TEST_LOD_NUM;
+	sprintf_s(szDetail, "rate 1500: %.2f  rate 2800: %.2f", fMiddleRate, fFarRate);
+	report("rate falls with distance", fFarRate > 0.0f && fFarRate < fMiddleRate && fMiddleRate < 1.0f, szDetail);
+
+	// --------------------------
+	// 大量に出し続ける
+	// --------------------------
+	// 発生源(ゲーム中と同じ引数で出す)
+	typedef struct
+	{
+		CATEGORY	category;
+		D3DXVECTOR3	pos;
+	}Emitter;
+
+	CRandom random(7);
+	std::vector<Emitter> emitters(TEST_EMITTER);
+
+	const CATEGORY aCategory[] =
+	{
+		CATEGORY_FIRE, CATEGORY_TREASURE, CATEGORY_ONIBI, CATEGORY_DUST, CATEGORY_WATER, CATEGORY_SMOKE, CATEGORY_DUSH
+	};
+	const int nNumCategory = sizeof(aCategory) / sizeof(aCategory[0]);
+
+	for (int nCnt = 0; nCnt < TEST_EMITTER; nCnt++)
+	{
+		emitters[nCnt].category = aCategory[nCnt % nNumCategory];
+
+		if (nCnt % 2 == 0)
+		{
+			// 半分はカメラの前に置いて上限に当たるようにする
+			float fDepth = random.Range(200.0f, 2500.0f);
+			emitters[nCnt].pos = D3DXVECTOR3(random.Range(-fDepth, fDepth) * 0.6f, random.Range(0.0f, 100.0f), fDepth);
+		}
+		else
+		{
+			// 残りはマップ全体(後ろや遠くは出さない)
+			emitters[nCnt].pos = D3DXVECTOR3(random.Range(-TEST_FIELD, TEST_FIELD), random.Range(0.0f, 100.0f),
+				random.Range(-TEST_FIELD, TEST_FIELD));
+		}
+	}
+
+	auto emit = [](const Emitter& emitter)
+	{
+		switch (emitter.category)
+		{
+		case CATEGORY_FIRE:
+			CParticle::Create<CFireParticle>(INIT_VEC3, emitter.pos, D3DXCOLOR(1.0f, 0.5f, 0.1f, 0.8f), 40, 4);
+			break;
+		case CATEGORY_TREASURE:
+			CParticle::Create<CTreasureParticle>(INIT_VEC3, emitter.pos, D3DXCOLOR(0.6f, 0.6f, 0.0f, 0.3f), 50, 10);
+			break;
+		case CATEGORY_ONIBI:
+			CParticle::Create<COnibiParticle>(INIT_VEC3, emitter.pos, D3DXCOLOR(0.8f, 0.6f, 1.0f, 0.8f), 40, 1);
+			break;
+		case CATEGORY_DUST:
+			CParticle::Create<CDustParticle>(INIT_VEC3, emitter.pos, D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.3f), 90, 1);
+			break;
+		case CATEGORY_WATER:
+			CParticle::Create<CWaterParticle>(INIT_VEC3, emitter.pos, D3DXCOLOR(0.3f, 0.6f, 1.0f, 0.8f), 120, 10);
+			break;
+		case CATEGORY_SMOKE:
+			CParticle::Create<CSmokeParticle>(INIT_VEC3, emitter.pos, INIT_XCOL_WHITE, 120, 8);
+			break;
+		case CATEGORY_DUSH:
+			CParticle::Create<CDushParticle>(INIT_VEC3, emitter.pos, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 90, 3);
+			break;
+		default:
+			break;
+		}
+	};
+
+	LARGE_INTEGER freq, start, end;
+	QueryPerformanceFrequency(&freq);
+
+	// 予算あり・なしの両方で回して比べる
+	int anPeak[2] = {};
+	double adMs[2] = {};
+
+	for (int nRun = 0; nRun < 2; nRun++)
+	{
+		m_bEnable = (nRun == 0);
+
+		CParticleSystem::Clear();
+
+		bool bCount = true, bGlobal = true, bQuota = true, bPriority = true;
+
+		QueryPerformanceCounter(&start);
+
+		for (int nFrame = 0; nFrame < TEST_FRAME; nFrame++)
+		{
+			for (const Emitter& emitter : emitters)
+			{
+				emit(emitter);
+			}
+
+			CParticleSystem::Update();
+
+			anPeak[nRun] = std::max(anPeak[nRun], m_nNumAlive);
+
+			if (!m_bEnable)
+			{
+				continue;
+			}
+
+			// 数え間違いがないか
+			bCount = bCount && (m_nNumAlive == CParticleSystem::GetNumAlive());
+
+			// 全体の上限
+			bGlobal = bGlobal && (m_nNumAlive <= MAX_ALIVE);
+
+			// 種類ごとの上限と優先度ごとの上限
+			int anPriority[PRIORITY_MAX] = {};
+
+			for (int nCnt = 0; nCnt < CATEGORY_MAX; nCnt++)
+			{
+				bQuota = bQuota && (m_anAlive[nCnt] <= m_aInfo[nCnt].nQuota);
+				anPriority[m_aInfo[nCnt].priority] += m_anAlive[nCnt];
+			}
+
+			bPriority = bPriority && (anPriority[PRIORITY_LOW] <= (int)(MAX_ALIVE * m_afPriorityRate[PRIORITY_LOW]));
+		}
+
+		QueryPerformanceCounter(&end);
+		adMs[nRun] = (double)(end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart / TEST_FRAME;
+
+		if (nRun == 0)
+		{
+			sprintf_s(szDetail, "%d emitters x %d frames", TEST_EMITTER, TEST_FRAME);
+			report("count matches particles", bCount, szDetail);
+
+			sprintf_s(szDetail, "peak %d / %d", anPeak[0], MAX_ALIVE);
+			report("global cap", bGlobal, szDetail);
+
+			report("category quota", bQuota, "");
+			report("low priority share", bPriority, "");
+
+			fprintf(pFile, "  suppressed %d  culled %d\n", m_nNumSuppressed, m_nNumCulled);
+
+			for (int nCnt = 0; nCnt < CATEGORY_MAX; nCnt++)
+			{
+				fprintf(pFile, "  category %-2d alive %5d / %d\n", nCnt, m_anAlive[nCnt], m_aInfo[nCnt].nQuota);
+			}
+		}
+	}
+
+	fprintf(pFile, "\nwith budget    : peak %5d  %.3f ms/frame\n", anPeak[0], adMs[0]);
+	fprintf(pFile, "without budget : peak %5d  %.3f ms/frame\n", anPeak[1], adMs[1]);
+
+	// 元に戻す
+	m_bEnable = true;
+	CParticleSystem::Clear();
+
+	fprintf(pFile, "\nresult : %s\n", bAllPass ? "pass" : "FAIL");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bAllPass;
+}
@@ -0,0 +1,98 @@
+//=============================================================================
+//
+// エフェクト予算処理 [effectbudget.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _EFFECTBUDGET_H_// このマクロ定義がされていなかったら
+#define _EFFECTBUDGET_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// エフェクト予算クラス(全体と種類ごとの粒子数の上限を持ち、距離と画面上の大きさで出す数を減らす)
+//*****************************************************************************
+class CEffectBudget
+{
+public:
+	// 粒子の種類
+	typedef enum
+	{
+		CATEGORY_FIRE = 0,	// 炎
+		CATEGORY_TREASURE,	// 埋蔵金のきらめき
+		CATEGORY_ONIBI,		// 鬼火(敵の状態表示)
+		CATEGORY_DUST,		// 扉・歯車の砂埃
+		CATEGORY_WATER,		// 水しぶき
+		CATEGORY_SMOKE,		// 煙
+		CATEGORY_BLOSSOM,	// 桜吹雪
+		CATEGORY_DUSH,		// ダッシュの砂煙
+		CATEGORY_BLOOD,		// 血しぶき
+		CATEGORY_FLOATING,	// 浮遊する粒
+		CATEGORY_POPUP,		// 効果音のポップアップ
+		CATEGORY_OTHER,		// その他
+		CATEGORY_MAX
+	}CATEGORY;
+
+	// 優先度(全体が混んできたら低いものから出さなくなる)
+	typedef enum
+	{
+		PRIORITY_LOW = 0,	// 雰囲気だけのもの
+		PRIORITY_MIDDLE,	// 仕掛けの動きなど
+		PRIORITY_HIGH,		// プレイヤーの操作や敵の状態に関わるもの
+		PRIORITY_MAX
+	}PRIORITY;
+
+	static int Request(CATEGORY category, const D3DXVECTOR3& pos, int nWanted);
+	static bool CanSpawn(CATEGORY category);
+	static void OnSpawn(CATEGORY category) { m_anAlive[category]++; m_nNumAlive++; }
+	static void OnDeath(CATEGORY category) { m_anAlive[category]--; m_nNumAlive--; }
+	static void Reset(void);
+	static bool RunTest(const char* filename);
+
+	//*****************************************************************************
+	// setter関数
+	//*****************************************************************************
+	static void SetEnable(bool enable) { m_bEnable = enable; }
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	static bool IsEnable(void) { return m_bEnable; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static int GetNumAlive(void) { return m_nNumAlive; }
+	static int GetNumAlive(CATEGORY category) { return m_anAlive[category]; }
+	static int GetQuota(CATEGORY category) { return m_aInfo[category].nQuota; }
+	static int GetNumSuppressed(void) { return m_nNumSuppressed; }
+	static int GetNumCulled(void) { return m_nNumCulled; }
+
+	static constexpr int MAX_ALIVE = 6000;	// 全体で生きていられる粒子の数
+
+private:
+	static constexpr float	FULL_PIXEL		= 6.0f;		// 粒子がこの大きさ(ピクセル)以上に見える時は全部出す
+	static constexpr float	MIN_RATE		= 0.1f;		// 遠くても出す割合の下限(描画距離の内側なら)
+	static constexpr int	TEST_FRAME		= 600;		// 確認処理のフレーム数
+	static constexpr int	TEST_EMITTER	= 400;		// 確認処理の発生源の数
+
+	// 種類ごとの設定
+	typedef struct
+	{
+		PRIORITY	priority;	// 優先度
+		int			nQuota;		// 生きていられる粒子の数
+		float		fRadius;	// 粒子の大きさの目安(画面上の大きさの計算に使う)
+		float		fBound;		// 発生源から粒子が広がる範囲(画面外の判定に使う)
+		float		fDistance;	// これより遠ければ出さない(0なら距離で減らさない)
+	}Info;
+
+	static int Limit(CATEGORY category);
+
+	static const Info	m_aInfo[CATEGORY_MAX];				// 種類ごとの設定
+	static const float	m_afPriorityRate[PRIORITY_MAX];		// 優先度ごとに全体の上限のどこまで使えるか
+	static int			m_anAlive[CATEGORY_MAX];			// 種類ごとの生きている粒子の数
+	static int			m_nNumAlive;						// 生きている粒子の数
+	static int			m_nNumSuppressed;					// 予算と距離で減らした粒子の数
+	static int			m_nNumCulled;						// 画面外で出さなかった粒子の数
+	static bool			m_bEnable;							// 予算を使うか
+};
+
+#endif
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// G̏ [enemy.cpp]
+// 敵の処理 [enemy.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "enemy.h"
 #include "guage.h"
@@ -22,41 +22,41 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CEnemy::CEnemy()
 {
-	// l̃NA
-	memset(m_apModel, 0, sizeof(m_apModel));			// f(p[c)ւ̃|C^
-	m_mtxWorld			= {};							// [h}gbNX
-	m_nNumModel			= 0;							// f(p[c)̑
-	m_pDebug3D			= nullptr;						// 3DfobO\ւ̃|C^
-	m_requestedAction	= ACTION_NONE;					// AI̍sNGXg
-	m_sightRange		= 255.0f;						// E
-	m_sightAngle		= D3DXToRadian(110.0f);			// E͈
-	m_lastHeardSoundPos = INIT_VEC3;					// Ōɕ̍W
-	m_hasHeardSound		= false;						// 𕷂ǂ
-	m_returnToPatrol	= false;						// Ŋ̏|Cgɖ߂tO
-	m_canControl		= false;						// tO
-	m_makeSoundCount	= 0;							// 
-	m_insightCount		= 0;							// ꂽ
+	// 値のクリア
+	memset(m_apModel, 0, sizeof(m_apModel));			// モデル(パーツ)へのポインタ
+	m_mtxWorld			= {};							// ワールドマトリックス
+	m_nNumModel			= 0;							// モデル(パーツ)の総数
+	m_pDebug3D			= nullptr;						// 3Dデバッグ表示へのポインタ
+	m_requestedAction	= ACTION_NONE;					// AIの行動リクエスト
+	m_sightRange		= 255.0f;						// 視界距離
+	m_sightAngle		= D3DXToRadian(110.0f);			// 視界範囲
+	m_lastHeardSoundPos = INIT_VEC3;					// 最後に聞いた音の座標
+	m_hasHeardSound		= false;						// 音を聞いたかどうか
+	m_returnToPatrol	= false;						// 最寄りの巡回ポイントに戻るフラグ
+	m_canControl		= false;						// 操作フラグ
+	m_makeSoundCount	= 0;							// 音発生数
+	m_insightCount		= 0;							// 発見された回数
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CEnemy::~CEnemy()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CEnemy::Init(void)
 {
-	// ŏ̌
+	// 最初の向き
 	SetRot(D3DXVECTOR3(0.0f, -D3DX_PI, 0.0f));
 
-	// G̏|Cg̐ݒ邽߁A}bvWFl[^[ʒu炤
+	// 敵の巡回ポイントの設定をするため、マップジェネレーターから位置をもらう
 	auto& patrolPoints = CGenerateMap::GetInstance()->GetPatrolPoints();
 
 	if (!patrolPoints.empty())
@@ -64,20 +64,20 @@ HRESULT CEnemy::Init(void)
 		SetPatrolPoints(patrolPoints);
 	}
 
-	// ŏ̏|Cg߂Ă
+	// 最初の巡回ポイントを決めておく
 	ReturnToPatrol();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CEnemy::Uninit(void)
 {
-	// 蔻̔j
+	// 当たり判定の破棄
 	ReleasePhysics();
 
-	// f̔j
+	// モデルの破棄
 	for (int nCnt = 0; nCnt < MAX_PARTS; nCnt++)
 	{
 		if (m_apModel[nCnt] != nullptr)
@@ -88,114 +88,134 @@ void CEnemy::Uninit(void)
 		}
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CEnemy::Update(void)
 {
-	// ԋ߂̏ꏊݒ
+	// 一番近い埋蔵金の場所を設定
 	SetNearestTreasurePosition();
 
-	// ̍XV
+	// 向きの更新処理
 	UpdateRotation(0.09f);
 
-	// RC_[̈ʒuXV(ItZbgݒ)
-	UpdateCollider(D3DXVECTOR3(0, DEFAULT_COLLIDER_OFFSET, 0));// ɍ킹
+	// コライダーの位置更新(オフセットを設定)
+	UpdateCollider(D3DXVECTOR3(0, DEFAULT_COLLIDER_OFFSET, 0));// 足元に合わせる
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CEnemy::Draw(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// vZp}gbNX
+	// 計算用マトリックス
 	D3DXMATRIX mtxRot, mtxTrans, mtxSize;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// TCY𔽉f
+	// サイズを反映
 	D3DXMatrixScaling(&mtxSize, GetSize().x, GetSize().y, GetSize().z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxSize);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, GetRot().y, GetRot().x, GetRot().z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, GetPos().x, GetPos().y, GetPos().z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNXݒ
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
+	// 画面外ならパーツの位置だけ更新する(武器の当たり判定がパーツの位置を使うため)
+	bool bInView = IsInView();
+
 	for (int nCntMat = 0; nCntMat < m_nNumModel; nCntMat++)
 	{
-		// f(p[c)̕`
-		if (m_apModel[nCntMat])
+		if (m_apModel[nCntMat] == nullptr)
+		{
+			continue;
+		}
+
+		if (bInView)
 		{
+			// モデル(パーツ)の描画
 			m_apModel[nCntMat]->Draw();
 		}
+		else
+		{
+			// モデル(パーツ)のワールドマトリックスの計算
+			m_apModel[nCntMat]->UpdateWorldMatrix();
+		}
 	}
 
 #ifdef _DEBUG
 
-	//btRigidBody* pRigid = GetRigidBody();
-	//btCollisionShape* pShape = GetCollisionShape();
+	btRigidBody* pRigid = GetRigidBody();
+	btCollisionShape* pShape = GetCollisionShape();
 
-	//// JvZRC_[̕`
-	//if (pRigid && pShape)
-	//{
-	//	btTransform transform;
-	//	pRigid->getMotionState()->getWorldTransform(transform);
+	// カプセルコライダーの描画
+	if (pRigid && pShape)
+	{
+		btTransform transform;
+		pRigid->getMotionState()->getWorldTransform(transform);
 
-	//	m_pDebug3D->DrawCapsuleCollider((btCapsuleShape*)pShape, transform, D3DXCOLOR(1, 1, 1, 1));
-	//}
+		CDebugProc3D::DrawCapsuleCollider((btCapsuleShape*)pShape, transform, D3DXCOLOR(1, 1, 1, 1), CDebugProc3D::CATEGORY_CHARACTER);
+	}
+
+	// 武器の当たり判定の描画(判定中のみ)
+	if (m_pWeaponCollider && m_pWeaponCollider->IsActive())
+	{
+		CDebugProc3D::DrawCapsule(m_pWeaponCollider->GetCurrentBasePos(), m_pWeaponCollider->GetCurrentTipPos(),
+			m_pWeaponCollider->GetRadius(), D3DXCOLOR(1.0f, 0.2f, 0.2f, 1.0f), CDebugProc3D::CATEGORY_WEAPON);
+	}
 
 #endif
 
 }
 //=============================================================================
-// OxNg擾
+// 前方ベクトル取得
 //=============================================================================
 D3DXVECTOR3 CEnemy::GetForward(void)
 {
 	D3DXVECTOR3 forward(-m_mtxWorld._31, m_mtxWorld._32, -m_mtxWorld._33);
 
-	// K
+	// 正規化する
 	D3DXVec3Normalize(&forward, &forward);
 
 	return forward;
 }
 //=============================================================================
-// E
+// 視界内判定
 //=============================================================================
 bool CEnemy::IsPlayerInSight(CPlayer* pPlayer)
 {
-	// G̐ʃxNg擾
+	// 敵の正面ベクトルを取得
 	D3DXVECTOR3 enemyFront = GetForward();
 
-	// vC[Ƃ̕xNg
+	// プレイヤーとの方向ベクトル
 	D3DXVECTOR3 toPlayer = pPlayer->GetPos() - GetPos();
 
-	// vC[xNg𐳋K
+	// プレイヤー方向ベクトルを正規化
 	D3DXVec3Normalize(&toPlayer, &toPlayer);
 
-	// G̐ʃxNgK
+	// 敵の正面ベクトルも正規化
 	D3DXVec3Normalize(&enemyFront, &enemyFront);
 
-	// xNg̓ςvZ
+	// ベクトルの内積を計算
 	float dotProduct = D3DXVec3Dot(&enemyFront, &toPlayer);
 
-	// ς王
-	if (dotProduct > cosf(m_sightAngle * 0.5f)) // p̔Ŕ
+	// 内積から視野内か判定
+	if (dotProduct > cosf(m_sightAngle * 0.5f)) // 視野角の半分で判定
 	{
-		// vC[Ƃ̋vZ
+		// プレイヤーとの距離を計算
 		float distanceSquared =
 			(GetPos().x - pPlayer->GetPos().x) * (GetPos().x - pPlayer->GetPos().x) +
 			(GetPos().y - pPlayer->GetPos().y) * (GetPos().y - pPlayer->GetPos().y) +
@@ -203,14 +223,14 @@ bool CEnemy::IsPlayerInSight(CPlayer* pPlayer)
 
 		if (distanceSquared <= m_sightRange * m_sightRange)
 		{
-			return true; // vC[͎E
+			return true; // プレイヤーは視界内
 		}
 	}
 
-	return false; // EO
+	return false; // 視界外
 }
 //=============================================================================
-// TuG̃ANV
+// サブ敵のアクション判定
 //=============================================================================
 bool CEnemy::IsSubAction(EEnemyAction type)
 {
@@ -220,7 +240,7 @@ bool CEnemy::IsSubAction(EEnemyAction type)
 	{
 		if (sub->GetRequestedAction() == type)
 		{
-			// ̂łNGXgĂ
+			// 一体でもリクエストされていたら
 			return true;
 		}
 	}
@@ -228,16 +248,16 @@ bool CEnemy::IsSubAction(EEnemyAction type)
 	return false;
 }
 //=============================================================================
-// [_[G̃ANV
+// リーダー敵のアクション判定
 //=============================================================================
 bool CEnemy::IsLeaderAction(EEnemyAction type)
 {
-	// [_[G̎擾
+	// リーダー敵の取得
 	CEnemyLeader* pEnemyLeader = CCharacterManager::GetInstance().GetCharacter<CEnemyLeader>();
 
 	if (pEnemyLeader)
 	{
-		// w肵svĂ
+		// 指定した行動を要求されていたら
 		if (pEnemyLeader->GetRequestedAction() == type)
 		{
 			return true;
@@ -247,13 +267,13 @@ bool CEnemy::IsLeaderAction(EEnemyAction type)
 	return false;
 }
 //=============================================================================
-// ԋ߂|Cg̐ݒ菈
+// 一番近い埋蔵金ポイントの設定処理
 //=============================================================================
 void CEnemy::SetNearestTreasurePosition(void)
 {
 	auto& list = CGenerateMap::GetInstance()->GetTreasurePositions();
 
-	// XgɂȂ
+	// リストが空になったら
 	if (list.empty())
 	{
 		return;
@@ -266,7 +286,7 @@ void CEnemy::SetNearestTreasurePosition(void)
 	{
 		D3DXVECTOR3 dis = list[nCnt] - GetPos();
 
-		// ԋ߂|Cgɐݒ肷
+		// 一番近い埋蔵金ポイントに設定する
 		float dist = D3DXVec3Length(&dis);
 		if (dist < minDist)
 		{
@@ -278,7 +298,7 @@ void CEnemy::SetNearestTreasurePosition(void)
 	m_nearestTreasurePosition = list[closestIndex];
 }
 //=============================================================================
-// bV̐ڒn
+// メッシュの接地判定
 //=============================================================================
 bool CEnemy::OnGroundMesh(const CMeshField* field, float footOffset)
 {
@@ -306,41 +326,41 @@ bool CEnemy::OnGroundMesh(const CMeshField* field, float footOffset)
 
 
 //=============================================================================
-// [_[G̃RXgN^
+// リーダー敵のコンストラクタ
 //=============================================================================
 CEnemyLeader::CEnemyLeader()
 {
-	// wKAI̐
+	// 学習AIの生成
 	SetAI(std::make_unique<CEnemyAI_Leader>());
 
-	// l̃NA
-	m_pMotion			= nullptr;	// [Vւ̃|C^
-	m_pShadowS			= nullptr;	// XeVVhEւ̃|C^
-	m_pTipModel			= nullptr;	// RC_[pf
-	m_pBaseModel		= nullptr;	// RC_[pf
-	m_pWeaponCollider	= nullptr;	// ̓蔻ւ̃|C^
-	m_Cooldown			= 0.0f;     // N[_Ec莞
-	m_bOnGround			= false;	// ڒnĂ邩
+	// 値のクリア
+	m_pMotion			= nullptr;	// モーションへのポインタ
+	m_pShadowS			= nullptr;	// ステンシルシャドウへのポインタ
+	m_pTipModel			= nullptr;	// 武器コライダー用モデル
+	m_pBaseModel		= nullptr;	// 武器コライダー用モデル
+	m_pWeaponCollider	= nullptr;	// 武器の当たり判定へのポインタ
+	m_Cooldown			= 0.0f;     // クールダウン残り時間
+	m_bOnGround			= false;	// 接地しているか
 }
 //=============================================================================
-// [_[G̃fXgN^
+// リーダー敵のデストラクタ
 //=============================================================================
 CEnemyLeader::~CEnemyLeader()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// [_[G̏
+// リーダー敵の初期化処理
 //=============================================================================
 HRESULT CEnemyLeader::Init(void)
 {
-	// G̏
+	// 敵の初期化処理
 	CEnemy::Init();
 
 	CModel* pModels[MAX_PARTS];
 	int nNumModels = 0;
 
-	// Leader p[V
+	// Leader 用モーション
 	m_pMotion = CMotion::Load(
 		"data/motion_enemy.txt",
 		pModels,
@@ -352,76 +372,75 @@ HRESULT CEnemyLeader::Init(void)
 
 	if (GetWeapon())
 	{
-		// RC_[̐
+		// 武器コライダーの生成
 		m_pWeaponCollider = std::make_unique<CWeaponCollider>();
 
 #ifdef _DEBUG
-		//// RC_[f̐
+		//// 武器コライダーモデルの生成
 		//m_pTipModel = CObjectX::Create("data/MODELS/weapon_collider.x", m_pWeaponCollider->GetCurrentTipPos(), INIT_VEC3, D3DXVECTOR3(1.0f, 1.0f, 1.0f));
 		//m_pBaseModel = CObjectX::Create("data/MODELS/weapon_collider.x", m_pWeaponCollider->GetCurrentBasePos(), INIT_VEC3, D3DXVECTOR3(1.0f, 1.0f, 1.0f));
 #endif
 	}
 
-	// JvZRC_[̐ݒ
+	// カプセルコライダーの設定
 	CreatePhysics(CAPSULE_RADIUS, CAPSULE_HEIGHT, 5.0f);
 
-	// XeVVhE̐
+	// ステンシルシャドウの生成
 	m_pShadowS = CShadowS::Create("data/MODELS/stencilshadow.x", D3DXVECTOR3(1.0f, 1.0f, 1.0f));
-	m_pShadowS->SetStencilRef(2);// ʂ̃XeVobt@̎Qƒlݒ
 
-	// CX^X̃|C^n
+	// インスタンスのポインタを渡す
 	m_stateMachine.Start(this);
 
-	// Ԃ̃Xe[gZbg
+	// 初期状態のステートをセット
 	m_stateMachine.ChangeState<CEnemyLeader_StandState>();
 
 	return S_OK;
 }
 //=============================================================================
-// [_[G̏I
+// リーダー敵の終了処理
 //=============================================================================
 void CEnemyLeader::Uninit(void)
 {
-	// [V̔j
+	// モーションの破棄
 	if (m_pMotion != nullptr)
 	{
 		delete m_pMotion;
 		m_pMotion = nullptr;
 	}
 
-	// G̏I
+	// 敵の終了処理
 	CEnemy::Uninit();
 }
 //=============================================================================
-// [_[G̍XV
+// リーダー敵の更新処理
 //=============================================================================
 void CEnemyLeader::Update(void)
 {
-	CEnemy::Update();  // ʏ
+	CEnemy::Update();  // 共通処理
 
 	if (m_pWeaponCollider != nullptr)
 	{
-		// RC_[̍XV
+		// 武器コライダーの更新
 		m_pWeaponCollider->Update(GetWeapon(), 50.0f, 10.0f);
 	}
 
 #ifdef _DEBUG
 	//if (m_pWeaponCollider != nullptr)
 	//{
-	//	// RC_[pf̈ʒuXV
+	//	// 武器コライダー用モデルの位置更新
 	//	m_pTipModel->SetPos(m_pWeaponCollider->GetCurrentTipPos());
 	//	m_pBaseModel->SetPos(m_pWeaponCollider->GetCurrentBasePos());
 	//}
 #endif
 	if (m_pShadowS != nullptr)
 	{
-		// XeVVhËʒuݒ
+		// ステンシルシャドウの位置設定
 		m_pShadowS->SetPosition(GetPos());
 	}
 
 	if (m_Cooldown > 0.0f)
 	{
-		m_Cooldown--;// N[_E炷
+		m_Cooldown--;// クールダウンを減らす
 
 		if (m_Cooldown < 0.0f)
 		{
@@ -429,24 +448,24 @@ void CEnemyLeader::Update(void)
 		}
 	}
 
-	// vC[̎擾
+	// プレイヤーの取得
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-	// AIXVi݂̍s̃NGXgj
+	// AIを更新（現在の行動のリクエスト）
 	if (GetAI() && pPlayer)
 	{
 		GetAI()->Update(this, pPlayer);
 	}
 
-	// Xe[g}VXV
+	// ステートマシン更新
 	m_stateMachine.Update();
 
 	int n = GetNumModels();
 
-	// [V̍XV
+	// モーションの更新処理
 	m_pMotion->Update(GetModels(), n);
 
-	// bVtB[h̎擾
+	// メッシュフィールドの取得
 	CMeshField* pMeshField = CGenerateMap::GetInstance()->GetMeshField();
 
 	if (!pMeshField)
@@ -454,10 +473,10 @@ void CEnemyLeader::Update(void)
 		return;
 	}
 
-	// ڒn
+	// 接地判定
 	m_bOnGround = OnGroundMesh(pMeshField, COLLIDER_OFFSET);
 
-	// Bullet݈ʒu擾
+	// Bullet現在位置取得
 	btTransform trans;
 	btRigidBody* pRigidBody = GetRigidBody();
 	pRigidBody->getMotionState()->getWorldTransform(trans);
@@ -466,25 +485,25 @@ void CEnemyLeader::Update(void)
 	D3DXVECTOR3 RigidPos;
 	btVector3 vel = pRigidBody->getLinearVelocity();
 
-	if (m_bOnGround)	// ڒn
+	if (m_bOnGround)	// 接地中
 	{
-		// ڈʒun`ɋz
+		// 見た目位置を地形に吸着
 		float groundY = pMeshField->GetHeight(btPos.getX(), btPos.getZ());
 		float targetY = groundY + COLLIDER_OFFSET;
 
 		float dy = targetY - btPos.getY();
 
-		// olIɒnʂɋziɂɂj
+		// バネ的に地面に吸着（上にも下にも動ける）
 		vel.setY(dy * GRAVITY_RATE);
 
 		pRigidBody->setLinearVelocity(vel);
 
-		// 
+		// 見た目
 		SetPos(D3DXVECTOR3(btPos.getX(), groundY, btPos.getZ()));
 	}
-	else// 
+	else// 空中
 	{
-		// Bullet哱ŌڂXV
+		// Bullet主導で見た目を更新
 		RigidPos.x = btPos.getX();
 		RigidPos.y = btPos.getY() - COLLIDER_OFFSET;
 		RigidPos.z = btPos.getZ();
@@ -495,26 +514,26 @@ void CEnemyLeader::Update(void)
 
 
 //=============================================================================
-// TuG̃RXgN^
+// サブ敵のコンストラクタ
 //=============================================================================
 CEnemySub::CEnemySub()
 {
-	// wKAI̐
+	// 学習AIの生成
 	SetAI(std::make_unique<CEnemyAI_Sub>());
 
-	// l̃NA
-	m_pMotion	= nullptr;	// [Vւ̃|C^
-	m_bOnGround = false;	// ڒn
+	// 値のクリア
+	m_pMotion	= nullptr;	// モーションへのポインタ
+	m_bOnGround = false;	// 接地判定
 }
 //=============================================================================
-// TuG̃fXgN^
+// サブ敵のデストラクタ
 //=============================================================================
 CEnemySub::~CEnemySub()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// TuG̏
+// サブ敵の初期化処理
 //=============================================================================
 HRESULT CEnemySub::Init(void)
 {
@@ -523,7 +542,7 @@ HRESULT CEnemySub::Init(void)
 	CModel* pModels[MAX_PARTS];
 	int nNumModels = 0;
 
-	// sub p[V
+	// sub 用モーション
 	m_pMotion = CMotion::Load(
 		"data/motion_subenemy.txt",
 		pModels,
@@ -533,19 +552,19 @@ HRESULT CEnemySub::Init(void)
 
 	SetupModels(pModels, nNumModels);
 
-	// JvZRC_[̐ݒ
+	// カプセルコライダーの設定
 	CreatePhysics(CAPSULE_RADIUS, CAPSULE_HEIGHT, 0.1f);
 
-	// CX^X̃|C^n
+	// インスタンスのポインタを渡す
 	m_stateMachine.Start(this);
 
-	// Ԃ̃Xe[gZbg
+	// 初期状態のステートをセット
 	m_stateMachine.ChangeState<CEnemySub_FollowState>();
 
 	return S_OK;
 }
 //=============================================================================
-// TuG̏I
+// サブ敵の終了処理
 //=============================================================================
 void CEnemySub::Uninit(void)
 {
@@ -555,34 +574,34 @@ void CEnemySub::Uninit(void)
 		m_pMotion = nullptr;
 	}
 
-	// G̏I
+	// 敵の終了処理
 	CEnemy::Uninit();
 }
 //=============================================================================
-// TuG̍XV
+// サブ敵の更新処理
 //=============================================================================
 void CEnemySub::Update(void)
 {
-	CEnemy::Update();  // ʏ
+	CEnemy::Update();  // 共通処理
 
-	// vC[̎擾
+	// プレイヤーの取得
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-	// AIXVi݂̍s̃NGXgj
+	// AIを更新（現在の行動のリクエスト）
 	if (GetAI() && pPlayer)
 	{
 		GetAI()->Update(this, pPlayer);
 	}
 
-	// Xe[g}VXV
+	// ステートマシン更新
 	m_stateMachine.Update();
 
 	int n = GetNumModels();
 
-	// [V̍XV
+	// モーションの更新処理
 	m_pMotion->Update(GetModels(), n);
 
-	// bVtB[h̎擾
+	// メッシュフィールドの取得
 	CMeshField* pMeshField = CGenerateMap::GetInstance()->GetMeshField();
 
 	if (!pMeshField)
@@ -590,10 +609,10 @@ void CEnemySub::Update(void)
 		return;
 	}
 
-	// ڒn
+	// 接地判定
 	m_bOnGround = OnGroundMesh(pMeshField, COLLIDER_OFFSET);
 
-	// Bullet݈ʒu擾
+	// Bullet現在位置取得
 	btTransform trans;
 	btRigidBody* pRigidBody = GetRigidBody();
 	pRigidBody->getMotionState()->getWorldTransform(trans);
@@ -602,25 +621,25 @@ void CEnemySub::Update(void)
 	D3DXVECTOR3 RigidPos;
 	btVector3 vel = pRigidBody->getLinearVelocity();
 
-	if (m_bOnGround)	// ڒn
+	if (m_bOnGround)	// 接地中
 	{
-		// ڈʒun`ɋz
+		// 見た目位置を地形に吸着
 		float groundY = pMeshField->GetHeight(btPos.getX(), btPos.getZ());
 		float targetY = groundY + COLLIDER_OFFSET;
 
 		float dy = targetY - btPos.getY();
 
-		// olIɒnʂɋziɂɂj
+		// バネ的に地面に吸着（上にも下にも動ける）
 		vel.setY(dy * GRAVITY_RATE);
 
 		pRigidBody->setLinearVelocity(vel);
 
-		// 
+		// 見た目
 		SetPos(D3DXVECTOR3(btPos.getX(), groundY, btPos.getZ()));
 	}
-	else// 
+	else// 空中
 	{
-		// Bullet哱ŌڂXV
+		// Bullet主導で見た目を更新
 		RigidPos.x = btPos.getX();
 		RigidPos.y = btPos.getY() - COLLIDER_OFFSET;
 		RigidPos.z = btPos.getZ();
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// G̏ [enemy.h]
+// 敵の処理 [enemy.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,7 +8,7 @@
 #define _ENEMY_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "model.h"
 #include "motion.h"
@@ -18,16 +18,17 @@
 #include "game.h"
 #include "enemyAI.h"
 #include "player.h"
+#include "random.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CEnemyLeader;
 class CEnemySub;
 class CWeaponCollider;
 
 //*****************************************************************************
-// GNX
+// 敵クラス
 //*****************************************************************************
 class CEnemy : public CCharacter
 {
@@ -35,28 +36,28 @@ public:
 	CEnemy();
 	~CEnemy();
 
-	// AIvs^Cv
+	// AIが要求する行動タイプ
 	typedef enum
 	{
 		ACTION_NONE,
 
-		// 
-		AI_NEUTRAL,				// ҋ@
-		AI_MOVE,				// ړ
-		AI_SOUND_INVESTIGATE,	// ̒
-		AI_CAUTION,				// x
-		AI_CHASE,				// vC[ǐ
+		// 共通
+		AI_NEUTRAL,				// 待機
+		AI_MOVE,				// 移動
+		AI_SOUND_INVESTIGATE,	// 音源の調査
+		AI_CAUTION,				// 警戒
+		AI_CHASE,				// プレイヤー追跡
 
-		// [_[
-		AI_TREASURE_INVESTIGATE,// ̒
-		AI_CLOSE_ATTACK_01,		// ߋU1
-		AI_CLOSE_ATTACK_02,		// ߋU2
-		AI_DOUBT,				// ^
-		AI_ORDER,				// 
-		AI_DISCOVER,			// 
+		// リーダー
+		AI_TREASURE_INVESTIGATE,// 埋蔵金の調査
+		AI_CLOSE_ATTACK_01,		// 近距離攻撃1
+		AI_CLOSE_ATTACK_02,		// 近距離攻撃2
+		AI_DOUBT,				// 疑い
+		AI_ORDER,				// 命令
+		AI_DISCOVER,			// 発見
 
-		// Tu
-		AI_FOLLOW,				// [_[Ǐ]
+		// サブ
+		AI_FOLLOW,				// リーダー追従
 
 		AI_MAX
 	}EEnemyAction;
@@ -68,7 +69,7 @@ public:
 
 		T* pEnemy = new T();
 
-		// nullptr
+		// nullptrだったら
 		if (pEnemy == nullptr)
 		{
 			return nullptr;
@@ -78,7 +79,7 @@ public:
 		pEnemy->SetRot(rot);
 		pEnemy->SetSize(D3DXVECTOR3(1.1f, 1.1f, 1.1f));
 
-		// s
+		// 初期化失敗時
 		if (FAILED(pEnemy->Init()))
 		{
 			return nullptr;
@@ -97,14 +98,14 @@ public:
 		m_hasHeardSound = true;
 	}
 
-	void ChooseNextPatrolPoint(void)  // אڂ|Cg烉_Ɏ̃|CgI
+	void ChooseNextPatrolPoint(void)  // 隣接するポイントからランダムに次のポイント選択
 	{
 		if (m_patrolPoints.empty())
 		{
 			return;
 		}
 
-		// ݂̃|Cg̃CfbNX߂
+		// 現在のポイントのインデックスを求める
 		int currentIndex = -1;
 		for (size_t nCnt = 0; nCnt < m_patrolPoints.size(); ++nCnt)
 		{
@@ -120,11 +121,11 @@ public:
 			return;
 		}
 
-		// 3x3Ȃ̂ x,z vZ
+		// 3x3なので x,z を計算
 		int x = currentIndex % 3;
 		int z = currentIndex / 3;
 
-		// אڃ|Cǧ
+		// 隣接ポイントの候補を作る
 		std::vector<int> candidates;
 		for (int dz = -1; dz <= 1; ++dz)
 		{
@@ -133,13 +134,13 @@ public:
 				int nx = x + dx;
 				int nz = z + dz;
 
-				// g͏O
+				// 自分自身は除外
 				if (dx == 0 && dz == 0)
 				{
 					continue;
 				}
 
-				// 3x3͈͓`FbN
+				// 3x3範囲内かチェック
 				if (nx < 0 || nx >= 3 || nz < 0 || nz >= 3)
 				{
 					continue;
@@ -150,11 +151,11 @@ public:
 			}
 		}
 
-		int r = rand() % m_patrolPoints.size();
+		int r = CRandom::Get(CRandom::STREAM_GAMEPLAY).Int((int)m_patrolPoints.size());
 		m_currentPatrolTarget = m_patrolPoints[r];
 	}
 
-	// ԋ߂|Cgɖ߂
+	// 一番近い巡回ポイントに戻す処理
 	void ReturnToPatrol(void)
 	{
 		float minDist = FLT_MAX;
@@ -164,7 +165,7 @@ public:
 		{
 			D3DXVECTOR3 dis = m_patrolPoints[nCnt] - GetPos();
 
-			// ԋ߂|Cgɐݒ肷
+			// 一番近い巡回ポイントに設定する
 			float dist = D3DXVec3Length(&dis);
 			if (dist < minDist)
 			{
@@ -174,35 +175,35 @@ public:
 		}
 
 		m_currentPatrolTarget = m_patrolPoints[closestIndex];
-		m_returnToPatrol = false;  // ĊJ
-		m_hasHeardSound = false;   // I
+		m_returnToPatrol = false;  // 巡回再開準備完了
+		m_hasHeardSound = false;   // 音源処理終了
 	}
 
-	// ԋ߂|Cg̐ݒ菈
+	// 一番近い埋蔵金ポイントの設定処理
 	void SetNearestTreasurePosition(void);
 
-	// |CgɓB
-	bool HasReachedTarget(void) // B
+	// 巡回ポイントに到達したか
+	bool HasReachedTarget(void) // 到達判定
 	{
 		D3DXVECTOR3 pos = GetPos();
 		D3DXVECTOR3 dis = m_currentPatrolTarget - pos;
-		return D3DXVec3Length(&dis) < 60.0f; // B
+		return D3DXVec3Length(&dis) < 60.0f; // 到達距離
 	}
 
-	// ̈ʒuɓB
+	// 埋蔵金の位置に到達したか
 	bool HasReachedTreasure(void)
 	{
 		D3DXVECTOR3 pos = GetPos();
 		D3DXVECTOR3 dis = m_nearestTreasurePosition - pos;
-		return D3DXVec3Length(&dis) < 60.0f; // B
+		return D3DXVec3Length(&dis) < 60.0f; // 到達距離
 	}
 
-	// ̈ʒuɓB
-	bool HasReachedSoundTarget(void) // B
+	// 音源の位置に到達したか
+	bool HasReachedSoundTarget(void) // 到達判定
 	{
 		D3DXVECTOR3 pos = GetPos();
 		D3DXVECTOR3 dis = m_lastHeardSoundPos - pos;
-		return D3DXVec3Length(&dis) < 60.0f; // B
+		return D3DXVec3Length(&dis) < 60.0f; // 到達距離
 	}
 
 	bool IsPlayerInSight(CPlayer* pPlayer);
@@ -211,7 +212,7 @@ public:
 	bool OnGroundMesh(const CMeshField* field, float footOffset);
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
 	void SetRequestedAction(EEnemyAction action) { m_requestedAction = action; }
 	void SetPatrolPoints(const std::vector<D3DXVECTOR3>& points)
@@ -243,7 +244,7 @@ public:
 	void SetInsightCount(int nCount) { m_insightCount = nCount; }
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
 	CModel* GetWeapon(void) { return m_pSwordModel; }
 	D3DXVECTOR3 GetForward(void);
@@ -261,34 +262,34 @@ public:
 	int GetInsightCount(void) { return m_insightCount; }
 
 private:
-	static constexpr int	MAX_PARTS				= 32;		// őp[c
-	static constexpr float	CAPSULE_RADIUS			= 14.0f;	// JvZRC_[̔a
-	static constexpr float	CAPSULE_HEIGHT			= 60.0f;	// JvZRC_[̍
-	static constexpr float	DEFAULT_COLLIDER_OFFSET = 45.0f;	// RC_[̃ItZbgʒu
-
-	D3DXMATRIX					m_mtxWorld;						// [h}gbNX
-	CModel*						m_apModel[MAX_PARTS];			// f(p[c)ւ̃|C^
-	CDebugProc3D*				m_pDebug3D;						// 3DfobO\ւ̃|C^
-	int							m_nNumModel;					// f(p[c)̑
-	CModel*						m_pSwordModel;					// 탂f̃|C^
-	float						m_sightRange;					// E
-	float						m_sightAngle;					// E͈
-	EEnemyAction				m_requestedAction;				// AĨNGXg
-	std::vector<D3DXVECTOR3>	m_patrolPoints;					// |Cg
-	D3DXVECTOR3					m_currentPatrolTarget;			// ݂̏|Cg
-	D3DXVECTOR3					m_nearestTreasurePosition;		// ԋ߂|Cg
-	D3DXVECTOR3					m_lastHeardSoundPos;			// Ōɕ̍W
-	bool						m_hasHeardSound;				// 𕷂ǂ
-	bool						m_returnToPatrol;				// Ŋ̏|Cgɖ߂tO
-	bool						m_canControl;					// tO
-	int							m_makeSoundCount;				// 
-	int							m_insightCount;					// ꂽ
-	std::unique_ptr<IEnemyAI>	m_pAI;							// AIւ̃|C^
+	static constexpr int	MAX_PARTS				= 32;		// 最大パーツ数
+	static constexpr float	CAPSULE_RADIUS			= 14.0f;	// カプセルコライダーの半径
+	static constexpr float	CAPSULE_HEIGHT			= 60.0f;	// カプセルコライダーの高さ
+	static constexpr float	DEFAULT_COLLIDER_OFFSET = 45.0f;	// コライダーのオフセット位置
+
+	D3DXMATRIX					m_mtxWorld;						// ワールドマトリックス
+	CModel*						m_apModel[MAX_PARTS];			// モデル(パーツ)へのポインタ
+	CDebugProc3D*				m_pDebug3D;						// 3Dデバッグ表示へのポインタ
+	int							m_nNumModel;					// モデル(パーツ)の総数
+	CModel*						m_pSwordModel;					// 武器モデルのポインタ
+	float						m_sightRange;					// 視界距離
+	float						m_sightAngle;					// 視界範囲
+	EEnemyAction				m_requestedAction;				// AIのリクエスト
+	std::vector<D3DXVECTOR3>	m_patrolPoints;					// 巡回ポイント
+	D3DXVECTOR3					m_currentPatrolTarget;			// 現在の巡回ポイント
+	D3DXVECTOR3					m_nearestTreasurePosition;		// 一番近い埋蔵金ポイント
+	D3DXVECTOR3					m_lastHeardSoundPos;			// 最後に聞いた音の座標
+	bool						m_hasHeardSound;				// 音を聞いたかどうか
+	bool						m_returnToPatrol;				// 最寄りの巡回ポイントに戻るフラグ
+	bool						m_canControl;					// 操作フラグ
+	int							m_makeSoundCount;				// 音発生数
+	int							m_insightCount;					// 発見された回数
+	std::unique_ptr<IEnemyAI>	m_pAI;							// AIへのポインタ
 };
 
 
 //*****************************************************************************
-// [_[GNX
+// リーダー敵クラス
 //*****************************************************************************
 class CEnemyLeader : public CEnemy
 {
@@ -296,26 +297,26 @@ public:
 	CEnemyLeader();
 	~CEnemyLeader();
 
-	static constexpr float SPEED				= 7.0f;		// ړXs[h
-	static constexpr float INVESTIGATE_SPEED	= 13.0f;	// ̈ړXs[h
-	static constexpr float CHASE_SPEED			= 17.0f;	// ǐՎ̈ړXs[h
-	static constexpr float DECELERATION_RATE	= 0.85f;	// 
-	static constexpr float ACCEL_RATE			= 0.15f;	// ԗ
+	static constexpr float SPEED				= 7.0f;		// 移動スピード
+	static constexpr float INVESTIGATE_SPEED	= 13.0f;	// 調査時の移動スピード
+	static constexpr float CHASE_SPEED			= 17.0f;	// 追跡時の移動スピード
+	static constexpr float DECELERATION_RATE	= 0.85f;	// 減速率
+	static constexpr float ACCEL_RATE			= 0.15f;	// 補間率
 
-	// [_[G[V̎
+	// リーダー敵モーションの種類
 	typedef enum
 	{
-		NEUTRAL = 0,			// ҋ@
-		MOVE,					// ړ
-		CLOSE_ATTACK_01,		// ߋU1
-		CLOSE_ATTACK_02,		// ߋU2
-		DOUBT,					// ^
-		SOUND_INVESTIGATE,		// ̒
-		TREASURE_INVESTIGATE,	// ̒
-		CAUTION,				// x
-		ORDER,					// 
-		CHASE,					// ǐ
-		DISCOVER,				// 
+		NEUTRAL = 0,			// 待機
+		MOVE,					// 移動
+		CLOSE_ATTACK_01,		// 近距離攻撃1
+		CLOSE_ATTACK_02,		// 近距離攻撃2
+		DOUBT,					// 疑い
+		SOUND_INVESTIGATE,		// 音源の調査
+		TREASURE_INVESTIGATE,	// 埋蔵金の調査
+		CAUTION,				// 警戒
+		ORDER,					// 命令
+		CHASE,					// 追跡
+		DISCOVER,				// 発見
 		MAX
 	}ENEMY_MOTION;
 
@@ -326,17 +327,17 @@ public:
 	{
 		D3DXVECTOR3 move = GetMove();
 
-		// 
+		// 減速させる
 		move *= DECELERATION_RATE;
 
 		if (fabsf(move.x) < 0.01f) move.x = 0;
 		if (fabsf(move.z) < 0.01f) move.z = 0;
 
-		// ړʂ̐ݒ
+		// 移動量の設定
 		SetMove(move);
 	}
 
-	// N[_Eݒ
+	// クールダウン設定
 	void SetCooldown(float time) { m_Cooldown = time * 60.0f; }
 
 	bool IsCooldown(void) const { return m_Cooldown > 0.0f; }
@@ -346,27 +347,27 @@ public:
 	StateMachine<CEnemyLeader> GetStateMachine(void) { return m_stateMachine; }
 
 private:
-	static constexpr int	MAX_PARTS		= 32;			// őp[c
-	static constexpr float	CAPSULE_RADIUS	= 14.0f;		// JvZRC_[̔a
-	static constexpr float	CAPSULE_HEIGHT	= 60.0f;		// JvZRC_[̍
-	static constexpr float	COLLIDER_OFFSET = 45.0f;		// RC_[̃ItZbgʒu
-	static constexpr float	GRAVITY_RATE	= 5.0f;			// d͂̊
-
-	CMotion*							m_pMotion;			// [Vւ̃|C^
-	CShadowS*							m_pShadowS;			// XeVVhEւ̃|C^
-	CObjectX*							m_pTipModel;		// RC_[pf
-	CObjectX*							m_pBaseModel;		// RC_[pf
-	std::unique_ptr<CWeaponCollider>	m_pWeaponCollider;	// ̓蔻ւ̃|C^
-	float								m_Cooldown;			// N[_Ec莞
-	bool								m_bOnGround;		// ڒnĂ邩
-
-	// Xe[gǗNX̃CX^X
+	static constexpr int	MAX_PARTS		= 32;			// 最大パーツ数
+	static constexpr float	CAPSULE_RADIUS	= 14.0f;		// カプセルコライダーの半径
+	static constexpr float	CAPSULE_HEIGHT	= 60.0f;		// カプセルコライダーの高さ
+	static constexpr float	COLLIDER_OFFSET = 45.0f;		// コライダーのオフセット位置
+	static constexpr float	GRAVITY_RATE	= 5.0f;			// 重力の割合
+
+	CMotion*							m_pMotion;			// モーションへのポインタ
+	CShadowS*							m_pShadowS;			// ステンシルシャドウへのポインタ
+	CObjectX*							m_pTipModel;		// 武器コライダー用モデル
+	CObjectX*							m_pBaseModel;		// 武器コライダー用モデル
+	std::unique_ptr<CWeaponCollider>	m_pWeaponCollider;	// 武器の当たり判定へのポインタ
+	float								m_Cooldown;			// クールダウン残り時間
+	bool								m_bOnGround;		// 接地しているか
+
+	// ステートを管理するクラスのインスタンス
 	StateMachine<CEnemyLeader> m_stateMachine;
 
 };
 
 //*****************************************************************************
-// TuGNX
+// サブ敵クラス
 //*****************************************************************************
 class CEnemySub : public CEnemy
 {
@@ -374,23 +375,23 @@ public:
 	CEnemySub();
 	~CEnemySub();
 
-	static constexpr float SPEED				= 5.0f;		// ړXs[h
-	static constexpr float INVESTIGATE_SPEED	= 10.0f;	// ̈ړXs[h
-	static constexpr float CHASE_SPEED			= 8.0f;		// ǐՎ̈ړXs[h
-	static constexpr float FOLLOW_SPEED			= 15.0f;	// Ǐ]̃Xs[h
-	static constexpr float CHASE_DISTANCE		= 150.0f;	// ǐՏԂɂȂ鋗
-	static constexpr float ACCEL_RATE			= 0.15f;	// ԗ
-	static constexpr float DECELERATION_RATE	= 0.9f;		// 
+	static constexpr float SPEED				= 5.0f;		// 移動スピード
+	static constexpr float INVESTIGATE_SPEED	= 10.0f;	// 調査時の移動スピード
+	static constexpr float CHASE_SPEED			= 8.0f;		// 追跡時の移動スピード
+	static constexpr float FOLLOW_SPEED			= 15.0f;	// 追従時のスピード
+	static constexpr float CHASE_DISTANCE		= 150.0f;	// 追跡状態になる距離
+	static constexpr float ACCEL_RATE			= 0.15f;	// 補間率
+	static constexpr float DECELERATION_RATE	= 0.9f;		// 減速率
 
-	// TuG[V̎
+	// サブ敵モーションの種類
 	typedef enum
 	{
-		NEUTRAL = 0,		// ҋ@
-		MOVE,				// ړ
-		CHASE,				// ǐ
-		INVESTIGATE,		// 
-		CAUTION,			// x
-		FOLLOW,				// [_[Ǐ]
+		NEUTRAL = 0,		// 待機
+		MOVE,				// 移動
+		CHASE,				// 追跡
+		INVESTIGATE,		// 調査
+		CAUTION,			// 警戒
+		FOLLOW,				// リーダー追従
 		MAX
 	}ENEMY_MOTION;
 
@@ -401,13 +402,13 @@ public:
 	{
 		D3DXVECTOR3 move = GetMove();
 
-		// 
+		// 減速させる
 		move *= DECELERATION_RATE;
 
 		if (fabsf(move.x) < 0.01f) move.x = 0;
 		if (fabsf(move.z) < 0.01f) move.z = 0;
 
-		// ړʂ̐ݒ
+		// 移動量の設定
 		SetMove(move);
 	}
 
@@ -415,16 +416,16 @@ public:
 	StateMachine<CEnemySub> GetStateMachine(void) { return m_stateMachine; }
 
 private:
-	static constexpr int	MAX_PARTS		= 10;		// őp[c
-	static constexpr float	CAPSULE_RADIUS	= 1.0f;		// JvZRC_[̔a
-	static constexpr float	CAPSULE_HEIGHT	= 65.0f;	// JvZRC_[̍
-	static constexpr float	COLLIDER_OFFSET = 45.0f;	// RC_[̃ItZbgʒu
-	static constexpr float	GRAVITY_RATE	= 5.0f;		// d͂̊
+	static constexpr int	MAX_PARTS		= 10;		// 最大パーツ数
+	static constexpr float	CAPSULE_RADIUS	= 1.0f;		// カプセルコライダーの半径
+	static constexpr float	CAPSULE_HEIGHT	= 65.0f;	// カプセルコライダーの高さ
+	static constexpr float	COLLIDER_OFFSET = 45.0f;	// コライダーのオフセット位置
+	static constexpr float	GRAVITY_RATE	= 5.0f;		// 重力の割合
 
-	CMotion*	m_pMotion;									// [Vւ̃|C^
-	bool		m_bOnGround;								// ڒnĂ邩
+	CMotion*	m_pMotion;									// モーションへのポインタ
+	bool		m_bOnGround;								// 接地しているか
 
-	// Xe[gǗNX̃CX^X
+	// ステートを管理するクラスのインスタンス
 	StateMachine<CEnemySub> m_stateMachine;
 
 };
@@ -1,17 +1,17 @@
 //=============================================================================
 //
-// G̊wKAI [enemyAI.cpp]
+// 敵の学習AI処理 [enemyAI.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "enemyAI.h"
 #include "player.h"
 #include "enemy.h"
-#include "meshcylinder.h"
+#include "ripplesystem.h"
 #include "time.h"
 #include "blockmanager.h"
 #include "SEpopupeffect.h"
@@ -21,25 +21,25 @@
 #include "specbase.h"
 
 //=============================================================================
-// [_[GAIRXgN^
+// リーダー敵AIコンストラクタ
 //=============================================================================
 CEnemyAI_Leader::CEnemyAI_Leader()
 {
-	// l̃NA
-    m_logTimer      = 0;            // L^^C}[
-    m_prevInSight   = false;		// OɎEɓ
-    m_soundTimer    = 0;            // TEh^C}[
-    m_soundCount    = 0;            // ̔
+	// 値のクリア
+    m_logTimer      = 0;            // 記録タイマー
+    m_prevInSight   = false;		// 直前に視界に入ったか
+    m_soundTimer    = 0;            // サウンドタイマー
+    m_soundCount    = 0;            // 音の発生数
 }
 //=============================================================================
-// [_[GAIfXgN^
+// リーダー敵AIデストラクタ
 //=============================================================================
 CEnemyAI_Leader::~CEnemyAI_Leader()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// [_[GAIXV
+// リーダー敵AI更新処理
 //=============================================================================
 void CEnemyAI_Leader::Update(CEnemy* pEnemy, CPlayer* pPlayer)
 {
@@ -48,87 +48,87 @@ void CEnemyAI_Leader::Update(CEnemy* pEnemy, CPlayer* pPlayer)
         return;
     }
 
-    // sL^
+    // 行動を記録
     RecordPlayerAction(pEnemy, pPlayer);
 
-    // vC[̈ʒu擾
+    // プレイヤーの位置を取得
     D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-    // ̃ubNɓ肷邽߁AubN}l[W[擾
+    // 特定のブロックに当たったか判定するため、ブロックマネージャーを取得する
     CBlockManager* pBlockManager = CGame::GetBlockManager();
 
-    // Ԃ̎擾
+    // 時間の取得
     CTime* pTime = CGame::GetTime();
 
     bool isNight = false;
 
     if (pTime)
     {
-        // 邩
+        // 夜か判定
         isNight = pTime->IsNight();
     }
 
-    // vC[Ƃ̋Zo
+    // プレイヤーとの距離を算出
     D3DXVECTOR3 diff = playerPos - pEnemy->GetPos();
     float distance = D3DXVec3Length(&diff);
 
-    // ̃ubNɓĂ邩肷
+    // 特定のブロックに当たっているか判定する
     bool playerInGrass = pBlockManager->IsPlayerInGrass();
     bool playerInTorch = pBlockManager->IsPlayerInTorch() && isNight;
     bool playerInWater = CGenerateMap::GetInstance()->GetWaterField()->IsInWater(playerPos);
 
-    // EƊpx
+    // 視界距離と角度
     float range = 265.0f;
     float angle = 115.0f;
 
-    if (playerInTorch)// Ă̋߂ɂƂ͎EL
+    if (playerInTorch)// 灯籠の近くにいるときは視界を広げる
     {
         range = 220.0f;
         angle = 100.0f;
     }
-    else if (playerInGrass)// vC[ɂƂ͎E߂
+    else if (playerInGrass)// プレイヤーが草にいるときは視界を狭める
     {
         range = 100.0f;
         angle = 100.0f;
     }
 
-    // EƊpx̐ݒ
+    // 視界距離と角度の設定
     pEnemy->SetSightRange(range);
     pEnemy->SetSightAngle(D3DXToRadian(angle));
 
-    // 𗧂Ă ܂ Eɓ񐔂ɉĖ(TuGɌ킹)mグ
+    // 音を立てた または 視界に入った回数に応じて命令(サブ敵をそこに向かわせる)確率を上げる
     float prob = CalcSoundProbability(m_log.makeSoundCount);
 
-    IsNotStealthSpec        notStealth;	// XeXȂ
-    IsMovingSpec            isMoving;	// ړ
-    IsNotDamageMotionSpec   notDamage;	// _[W[VȂ
+    IsNotStealthSpec        notStealth;	// ステルス中じゃない
+    IsMovingSpec            isMoving;	// 移動中
+    IsNotDamageMotionSpec   notDamage;	// ダメージモーションじゃない
 
-    AndSpecification<CPlayer> cond1(notStealth, isMoving);			// ̍(XeXȂ && ړ)
-    AndSpecification<CPlayer> playerConditionSpec(cond1, notDamage);// ̍(cond1 && _[W[VȂ)
+    AndSpecification<CPlayer> cond1(notStealth, isMoving);			// 条件の合成(ステルス中じゃない && 移動中)
+    AndSpecification<CPlayer> playerConditionSpec(cond1, notDamage);// 条件の合成(cond1 && ダメージモーションじゃない)
 
-    // vC[tO
+    // プレイヤー条件フラグ
     bool playerCondition = playerConditionSpec.IsSatisfiedBy(*pPlayer);
 
-    // ΏۂɉăeNX`pXς
+    // 当たった対象に応じてテクスチャパスを変える
     const char* path = "data/TEXTURE/popup_01.png";
 
-    if (playerInGrass)// 
+    if (playerInGrass)// 草
     {
         path = "data/TEXTURE/popup_grass.png";
     }
-    else if (playerInWater)// 
+    else if (playerInWater)// 水
     {
         path = "data/TEXTURE/popup_water.png";
     }
 
-    // ̃IuWFNgɐڐGEёȂ
+    // 特定のオブジェクトに接触かつ忍び足じゃなかったら
     if (playerCondition && (playerInGrass || playerInWater))
     {
         m_soundTimer++;
 
-        // vC[̈ʒu擾
+        // プレイヤーの位置を取得
         D3DXVECTOR3 pos = pPlayer->GetPos();
-        pos.y += OFFSET_POS;// グ
+        pos.y += OFFSET_POS;// 少し上げる
 
         if (m_soundTimer <= INTERVAL)
         {
@@ -138,71 +138,71 @@ void CEnemyAI_Leader::Update(CEnemy* pEnemy, CPlayer* pPlayer)
         m_soundTimer = 0;
         m_soundCount++;
 
-        // ̐ݒ
+        // 音発生数の設定
         pEnemy->SetSoundCount(m_soundCount);
 
-        // g̐
-        CMeshCylinder::Create(pos, D3DXCOLOR(1.0f, 0.0f, 0.0f, 1.0f), 12.0f, 8.0f, 0.8f, 120, 0.01f);
+        // 波紋の生成
+        CRippleSystem::Emit(pos, D3DXCOLOR(1.0f, 0.0f, 0.0f, 1.0f), 12.0f, 8.0f, 0.8f, 120, 0.01f);
 
-        // ʉ|bvAbvGtFNg̐
+        // 効果音ポップアップエフェクトの生成
         CSEPopupEffect::Create(path, pos, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 40);
 
-        // ̈ʒuݒ
+        // 音の位置を設定
         pEnemy->OnSoundHeard(pPlayer->GetPos());
 
         if (PROBABILITY_THRESHOLD <= prob)
         {
-            // ߏ
+            // 命令状態
             pEnemy->SetRequestedAction(CEnemy::AI_ORDER);
         }
         else
         {
-            // ^
+            // 疑い状態
             pEnemy->SetRequestedAction(CEnemy::AI_DOUBT);
         }
     }
     else
     {
-        // ړ
+        // 移動状態
         pEnemy->SetRequestedAction(CEnemy::AI_MOVE);
     }
 
-    // Eɓ܂͈苗߂Â
+    // 視界に入ったらまたは一定距離近づいたら
     if (pEnemy->IsPlayerInSight(pPlayer) || distance < TRIGGER_DISTANCE)
     {
-        // 
+        // 発見状態
         pEnemy->SetRequestedAction(CEnemy::AI_DISCOVER);
     }
 }
 //=============================================================================
-// [_[GAĨvC[̍sL^
+// リーダー敵AIのプレイヤーの行動記録処理
 //=============================================================================
 void CEnemyAI_Leader::RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer)
 {
-    // ̃ubNɓ肷邽߁AubN}l[W[擾
+    // 特定のブロックに当たったか判定するため、ブロックマネージャーを取得する
     CBlockManager* pBlockManager = CGame::GetBlockManager();
 
-    // vC[̈ʒu擾
+    // プレイヤーの位置取得
     D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-    // ̃ubNɓĂ邩肷
+    // 特定のブロックに当たっているか判定する
     bool playerInGrass = pBlockManager->IsPlayerInGrass();
     bool playerInWater = CGenerateMap::GetInstance()->GetWaterField()->IsInWater(playerPos);
 
-    // JEg̉Z
+    // 音カウントの加算
     {
-        // 𗧂ĂĂԊuŉJEg𑝂₷
+        // 音を立てていたら一定間隔で音カウントを増やす
         if (!pPlayer->IsStealth() && pPlayer->GetIsMoving() &&
             (playerInGrass || playerInWater))
         {
-            m_logTimer++;// t[Z
+            m_logTimer++;// フレーム加算
 
             if (m_logTimer <= LOG_TIME)
             {
                 return;
             }
 
-            // JEgZ
+            // 音カウントを加算
             m_log.makeSoundCount++;
 
             m_logTimer = 0;
@@ -213,17 +213,17 @@ void CEnemyAI_Leader::RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer)
         }
     }
 
-    // EJEg̉Z
+    // 視界カウントの加算
     {
-        // Eɓu(1)ʂ
+        // 視界に入った瞬間(1回)だけ通す
         bool n = pEnemy->IsPlayerInSight(pPlayer);
 
         if (n && !m_prevInSight)
         {
-            // EJEgZ
+            // 視界カウントを加算
             m_log.insightCount++;
 
-            // ꂽ񐔂̃JEg
+            // 発見された回数のカウント
             pEnemy->SetInsightCount(m_log.insightCount);
         }
 
@@ -233,23 +233,23 @@ void CEnemyAI_Leader::RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer)
 
 
 //=============================================================================
-// TuGAĨRXgN^
+// サブ敵AIのコンストラクタ
 //=============================================================================
 CEnemyAI_Sub::CEnemyAI_Sub()
 {
-    // l̃NA
-    m_logTimer      = 0;                // L^^C}[
-    m_prevInSight   = false;			// OɎEɓ
+    // 値のクリア
+    m_logTimer      = 0;                // 記録タイマー
+    m_prevInSight   = false;			// 直前に視界に入ったか
 }
 //=============================================================================
-// TuGAĨfXgN^
+// サブ敵AIのデストラクタ
 //=============================================================================
 CEnemyAI_Sub::~CEnemyAI_Sub()
 {
-    // Ȃ
+    // なし
 }
 //=============================================================================
-// TuGAI̍XV
+// サブ敵AIの更新処理
 //=============================================================================
 void CEnemyAI_Sub::Update(CEnemy* pEnemy, CPlayer* pPlayer)
 {
@@ -258,76 +258,76 @@ void CEnemyAI_Sub::Update(CEnemy* pEnemy, CPlayer* pPlayer)
         return;
     }
 
-    // sL^
+    // 行動を記録
     RecordPlayerAction(pEnemy, pPlayer);
 
-    // vC[Ƃ̋Zo
+    // プレイヤーとの距離を算出
     D3DXVECTOR3 diff = pPlayer->GetPos() - pEnemy->GetPos();
     float distance = D3DXVec3Length(&diff);
 
-    // 𗧂Ă񐔂ɉĖ(TuGɌ킹)mグĂ
+    // 音を立てた回数に応じて命令(サブ敵をそこに向かわせる)確率を上げていく
     float prob = CalcSoundProbability(m_log.makeSoundCount);
 
-    // Ǝsֈڍsm
+    // 独自行動へ移行する確率判定
     if (PROBABILITY_THRESHOLD <= prob)
     {
-        // ړ
+        // 移動状態
         pEnemy->SetRequestedAction(CEnemy::AI_MOVE);
         return;
     }
 
-    //  苗߂Â
+    //  一定距離近づいたら
     if (distance < CEnemySub::CHASE_DISTANCE)
     {
-        // ǐՏ
+        // 追跡状態
         pEnemy->SetRequestedAction(CEnemy::AI_CHASE);
         return;
     }
 
-    // [_[߂o
+    // リーダーが命令を出したら
     if (pEnemy->IsLeaderAction(CEnemy::AI_ORDER))
     {
-        // ̈ʒuݒ
+        // 音の位置を設定
         pEnemy->OnSoundHeard(pEnemy->GetLastHeardSoundPos());
 
-        // ̒
+        // 音源の調査状態
         pEnemy->SetRequestedAction(CEnemy::AI_SOUND_INVESTIGATE);
         return;
     }
     else
     {
-        // [_[Ǐ]
+        // リーダー追従状態
         pEnemy->SetRequestedAction(CEnemy::AI_FOLLOW);
     }
 }
 //=============================================================================
-// TuGAĨvC[̍sL^
+// サブ敵AIのプレイヤーの行動記録処理
 //=============================================================================
 void CEnemyAI_Sub::RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer)
 {
-    // ̃ubNɓ肷邽߁AubN}l[W[擾
+    // 特定のブロックに当たったか判定するため、ブロックマネージャーを取得する
     CBlockManager* pBlockManager = CGame::GetBlockManager();
 
-    // vC[̈ʒu擾
+    // プレイヤーの位置取得
     D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
     bool playerInGrass = pBlockManager->IsPlayerInGrass();
     bool playerInWater = CGenerateMap::GetInstance()->GetWaterField()->IsInWater(playerPos);
 
-    // JEg̉Z
+    // 音カウントの加算
     {
-        // 𗧂ĂĂԊuŉJEg𑝂₷
+        // 音を立てていたら一定間隔で音カウントを増やす
         if (!pPlayer->IsStealth() && pPlayer->GetIsMoving() &&
             (playerInGrass || playerInWater))
         {
-            m_logTimer++;// t[Z
+            m_logTimer++;// フレーム加算
 
             if (m_logTimer <= LOG_TIME)
             {
                 return;
             }
 
-            // JEgZ
+            // 音カウントを加算
             m_log.makeSoundCount++;
 
             m_logTimer = 0;
@@ -338,14 +338,14 @@ void CEnemyAI_Sub::RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer)
         }
     }
 
-    // EJEg̉Z
+    // 視界カウントの加算
     {
-        // Eɓu(1)ʂ
+        // 視界に入った瞬間(1回)だけ通す
         bool n = pEnemy->IsPlayerInSight(pPlayer);
 
         if (n && !m_prevInSight)
         {
-            // EJEgZ
+            // 視界カウントを加算
             m_log.insightCount++;
         }
 
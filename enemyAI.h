@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// G̊wKAI [enemyAI.h]
+// 敵の学習AI処理 [enemyAI.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,18 +8,18 @@
 #define _ENEMYAI_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CPlayer;
 class CEnemy;
 
 //*****************************************************************************
-// GwKAINX
+// 敵学習AI基底クラス
 //*****************************************************************************
 class IEnemyAI
 {
@@ -29,7 +29,7 @@ public:
 
 	virtual void Update(class CEnemy* enemy, CPlayer* player) = 0;
 	virtual void RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer) = 0;
-	virtual float CalcSoundProbability(int targetCount)// m擾(0.0`1.0)
+	virtual float CalcSoundProbability(int targetCount)// 確率取得処理(0.0～1.0)
 	{
 		float x = (float)targetCount;
 
@@ -39,7 +39,7 @@ public:
 };
 
 //*****************************************************************************
-// [_[̊wKAINX
+// リーダーの学習AIクラス
 //*****************************************************************************
 class CEnemyAI_Leader : public IEnemyAI
 {
@@ -47,32 +47,32 @@ public:
 	CEnemyAI_Leader();
 	~CEnemyAI_Leader();
 
-	// vC[̍sL^\
+	// プレイヤーの行動記録構造体
 	struct PlayerBehaviorLog
 	{
-		int makeSoundCount	= 0;	// 𗧂Ă
-		int insightCount	= 0;	// 
+		int makeSoundCount	= 0;	// 音を立てた回数
+		int insightCount	= 0;	// 見つかった回数
 	};
 
 	void Update(CEnemy* pEnemy, CPlayer* pPlayer) override;
 	void RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer) override;
 
 private:
-	static constexpr float	PROBABILITY_THRESHOLD	= 0.75f;	// 臒l
-	static constexpr float	TRIGGER_DISTANCE		= 100.0f;	// ʏ̋
-	static constexpr int	LOG_TIME				= 25;		// L^
-	static constexpr float	OFFSET_POS				= 40.0f;	// ItZbgʒu
-	static constexpr int	INTERVAL				= 15;		// C^[o
-
-	PlayerBehaviorLog	m_log;									// vC[s\̕ϐ
-	int					m_logTimer;								// L^^C}[
-	bool				m_prevInSight;							// OɎEɓ
-	int					m_soundTimer;							// g䐶^C}[
-	int					m_soundCount;							// z
+	static constexpr float	PROBABILITY_THRESHOLD	= 0.75f;	// 音の閾値
+	static constexpr float	TRIGGER_DISTANCE		= 100.0f;	// 通常の距離
+	static constexpr int	LOG_TIME				= 25;		// 記録時間
+	static constexpr float	OFFSET_POS				= 40.0f;	// 生成オフセット位置
+	static constexpr int	INTERVAL				= 15;		// インターバル
+
+	PlayerBehaviorLog	m_log;									// プレイヤー行動構造体変数
+	int					m_logTimer;								// 記録タイマー
+	bool				m_prevInSight;							// 直前に視界に入ったか
+	int					m_soundTimer;							// 波紋生成タイマー
+	int					m_soundCount;							// 音発生数z
 };
 
 //*****************************************************************************
-// TůwKAINX
+// サブの学習AIクラス
 //*****************************************************************************
 class CEnemyAI_Sub : public IEnemyAI
 {
@@ -80,24 +80,24 @@ public:
 	CEnemyAI_Sub();
 	~CEnemyAI_Sub();
 
-	// vC[̍sL^\
+	// プレイヤーの行動記録構造体
 	struct PlayerBehaviorLog
 	{
-		int makeSoundCount	= 0;	// 𗧂Ă
-		int insightCount	= 0;	// 
+		int makeSoundCount	= 0;	// 音を立てた回数
+		int insightCount	= 0;	// 見つかった回数
 	};
 
 	void Update(CEnemy* pEnemy, CPlayer* pPlayer) override;
 	void RecordPlayerAction(CEnemy* pEnemy, CPlayer* pPlayer) override;
 
 private:
-	static constexpr float	PROBABILITY_THRESHOLD	= 0.75f;	// 臒l
-	static constexpr float	DISTANCE_NORMAL			= 50.0f;	// ʏ̋
-	static constexpr int	LOG_TIME				= 25;		// L^
+	static constexpr float	PROBABILITY_THRESHOLD	= 0.75f;	// 音の閾値
+	static constexpr float	DISTANCE_NORMAL			= 50.0f;	// 通常の距離
+	static constexpr int	LOG_TIME				= 25;		// 記録時間
 
-	PlayerBehaviorLog	m_log;									// vC[s\̕ϐ
-	int					m_logTimer;								// L^^C}[
-	bool				m_prevInSight;							// OɎEɓ
+	PlayerBehaviorLog	m_log;									// プレイヤー行動構造体変数
+	int					m_logTimer;								// 記録タイマー
+	bool				m_prevInSight;							// 直前に視界に入ったか
 };
 
 #endif
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// [_[G̏ԏ [enemyleaderState.h]
+// リーダー敵の状態処理 [enemyleaderState.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,7 +8,7 @@
 #define _ENEMYLEADERSTATE_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "particle.h"
 #include "enemy.h"
@@ -20,7 +20,7 @@
 #include "meshOrbit.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CEnemyLeader_StandState;
 class CEnemyLeader_MoveState;
@@ -35,7 +35,7 @@ class CEnemyLeader_ChaseState;
 class CEnemyLeader_DiscoverState;
 
 //*****************************************************************************
-// [_[G̑ҋ@
+// リーダー敵の待機状態
 //*****************************************************************************
 class CEnemyLeader_StandState :public StateBase<CEnemyLeader>
 {
@@ -43,62 +43,62 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// ҋ@[V
+		// 待機モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::NEUTRAL, 20);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// Ê邽߁AvC[擾
+		// 視界内判定のするため、プレイヤーを取得する
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
-		// TuGǐՏԂ
+		// サブ敵が追跡状態だったら
 		if (pEnemy->IsSubAction(CEnemy::AI_CHASE) && !pEnemy->IsCooldown())
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
 			return;
 		}
 
-		// Eɓ
+		// 視界に入ったら
 		if (pPlayer && pEnemy->IsPlayerInSight(pPlayer) && !pEnemy->IsCooldown())
 		{
-			// 
+			// 発見状態
 			m_pMachine->ChangeState<CEnemyLeader_DiscoverState>();
 			return;
 		}
 
-		// AINGXgɉďԂύX
+		// AIリクエストに応じて状態を変更
 		switch (pEnemy->GetRequestedAction())
 		{
-		case CEnemy::EEnemyAction::AI_SOUND_INVESTIGATE:// ̒
+		case CEnemy::EEnemyAction::AI_SOUND_INVESTIGATE:// 音源の調査状態
 			m_pMachine->ChangeState<CEnemyLeader_SoundInvestigateState>();
 			break;
-		case CEnemy::EEnemyAction::AI_ORDER:// ߏ
+		case CEnemy::EEnemyAction::AI_ORDER:// 命令状態
 			m_pMachine->ChangeState<CEnemyLeader_OrderState>();
 			break;
-		case CEnemy::EEnemyAction::AI_DOUBT:// ^
+		case CEnemy::EEnemyAction::AI_DOUBT:// 疑い状態
 			m_pMachine->ChangeState<CEnemyLeader_DoubtState>();
 			break;
 		default:
-			break; // ̂܂ܑҋ@
+			break; // そのまま待機
 		}
 
-		// ҋ@[VIĂ
+		// 待機モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::NEUTRAL))
 		{
-			// tOfalse ܂ N[_Eݒ肳ĂƂ͑ҋ@Ԃɂ
+			// 操作フラグがfalse または クールダウンが設定されているときは待機状態にする
 			if (!pEnemy->GetControlFlag() || pEnemy->IsCooldown())
 			{
-				// ҋ@
+				// 待機状態
 				m_pMachine->ChangeState<CEnemyLeader_StandState>();
 				return;
 			}
 
-			// ړ
+			// 移動状態
 			m_pMachine->ChangeState<CEnemyLeader_MoveState>();
 		}
 	}
@@ -112,7 +112,7 @@ private:
 };
 
 //*****************************************************************************
-// [_[G̈ړ
+// リーダー敵の移動状態
 //*****************************************************************************
 class CEnemyLeader_MoveState :public StateBase<CEnemyLeader>
 {
@@ -121,16 +121,16 @@ public:
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
 
-		// ړ[V
+		// 移動モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::MOVE, 10);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// TuGǐՏԂ
+		// サブ敵が追跡状態だったら
 		if (pEnemy->IsSubAction(CEnemy::AI_CHASE))
 		{
-			// ^
+			// 疑い状態
 			m_pMachine->ChangeState<CEnemyLeader_DoubtState>();
 			return;
 		}
@@ -138,32 +138,32 @@ public:
 		switch (pEnemy->GetRequestedAction())
 		{
 		case CEnemyLeader::AI_DISCOVER:
-			// 
+			// 発見状態
 			m_pMachine->ChangeState<CEnemyLeader_DiscoverState>();
 			break;
 		case CEnemyLeader::AI_ORDER:
-			// ߏ
+			// 命令状態
 			m_pMachine->ChangeState<CEnemyLeader_OrderState>();
 			break;
 		case CEnemyLeader::AI_CHASE:
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
 			break;
 		case CEnemyLeader::AI_DOUBT:
-			// ^
+			// 疑い状態
 			m_pMachine->ChangeState<CEnemyLeader_DoubtState>();
 			break;
 		}
 
-		// |CgɌ
+		// 巡回ポイントに向かう
 		D3DXVECTOR3 toTarget = pEnemy->GetPatrolTarget() - pEnemy->GetPos();
 		toTarget.y = 0;
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
-		// [VXs[h𑁂
+		// モーションスピードを早くする
 		pEnemy->GetMotion()->SetMotionSpeedRate(MOTION_SPEED_RATE);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemyLeader::SPEED;
 		D3DXVECTOR3 targetMove = pEnemy->GetForward();
 
@@ -178,51 +178,51 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemyLeader::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemyLeader::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pEnemy->SetMove(currentMove);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
 		// ----------------------
-		// |CgB
+		// 巡回ポイント到達判定
 		// ----------------------
 		if (pEnemy->HasReachedTarget())
 		{
-			if ((rand() % 100) < PROBABILITY)
+			if (CRandom::Get(CRandom::STREAM_GAMEPLAY).Int(100) < PROBABILITY)
 			{
-				// B|Cg̓B肪ƒʂĂ܂߁Ȁ|Cgݒ肵Ă
+				// 今到達した巡回ポイントの到達判定がずっと通ってしまうため、次の巡回ポイントを設定しておく
 				pEnemy->ChooseNextPatrolPoint();
 
-				// ҋ@
+				// 待機状態
 				m_pMachine->ChangeState<CEnemyLeader_StandState>();
 			}
 			else
 			{
-				if ((rand() % 100) < PROBABILITY)
+				if (CRandom::Get(CRandom::STREAM_GAMEPLAY).Int(100) < PROBABILITY)
 				{
-					// ̒
+					// 埋蔵金の調査状態
 					m_pMachine->ChangeState<CEnemyLeader_TreasureInvestigateState>();
 				}
 				else
 				{
-					// ̏|CgɌ
+					// 次の巡回ポイントに向かう
 					pEnemy->ChooseNextPatrolPoint();
 				}
 			}
@@ -231,17 +231,17 @@ public:
 
 	void OnExit(CEnemyLeader* pEnemy)override
 	{
-		// [VXs[hʏɂ
+		// モーションスピードを通常にする
 		pEnemy->GetMotion()->SetMotionSpeedRate(1.0f);
 	}
 
 private:
-	static constexpr float	MOTION_SPEED_RATE	= 1.5f;	// [ṼXs[h[g
-	static constexpr int	PROBABILITY			= 55;	// m
+	static constexpr float	MOTION_SPEED_RATE	= 1.5f;	// モーションのスピードレート
+	static constexpr int	PROBABILITY			= 55;	// 確率
 };
 
 //*****************************************************************************
-// [_[G̋ߋU1
+// リーダー敵の近距離攻撃状態1
 //*****************************************************************************
 class CEnemyLeader_CloseAttackState1 :public StateBase<CEnemyLeader>
 {
@@ -249,86 +249,86 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// qbgtOZbg
+		// ヒットフラグをリセット
 		pEnemy->GetWeaponCollider()->ResetHit();
 
-		// ߋU[V
+		// 近距離攻撃モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::CLOSE_ATTACK_01, 10);
 
-		// ̎擾
+		// 音の取得
 		CSound* pSound = CManager::GetSound();
 
-		// aSE1̍Đ
+		// 斬撃SE1の再生
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_SLASH_1);
 		}
 
-		// vC[擾
+		// プレイヤー取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[ւ̕xNg
+		// プレイヤーへの方向ベクトル
 		D3DXVECTOR3 toPlayer = pPlayer->GetPos() - pEnemy->GetPos();
 
 		if (pPlayer)
 		{
-			toPlayer.y = 0.0f; // ̂
+			toPlayer.y = 0.0f; // 水平方向のみ
 			D3DXVec3Normalize(&toPlayer, &toPlayer);
 
-			// ڕW̊pxZo
+			// 目標の角度を算出
 			float targetYaw = atan2f(-toPlayer.x, -toPlayer.z);
 
-			// ړIpxݒiX,Z͂̂܂܁j
+			// 目的角度を設定（X,Zはそのまま）
 			D3DXVECTOR3 rotDest = pEnemy->GetRot();
 			rotDest.y = targetYaw;
 
-			// GɖړIpxݒ
+			// 敵に目的角度を設定
 			pEnemy->SetRotDest(rotDest);
 
-			// Ԃĉ]
+			// 補間して回転
 			pEnemy->UpdateRotation(0.5f);
 		}
 
-		// ĂɃXCh邽߁AvC[xNg擾
+		// 向いている方向にスライドさせるため、プレイヤー方向ベクトルを取得
 		D3DXVECTOR3 dir = toPlayer;
 
-		// K
+		// 正規化
 		D3DXVec3Normalize(&dir, &dir);
 
 		D3DXVECTOR3 move = dir * SLIDE_POWER;
 
-		// ݂̈ړʂɏ㏑
+		// 現在の移動量に上書き
 		pEnemy->SetMove(move);
 
-		// Jnʒu1߂
-		D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// ̐
+		// 生成開始位置1を決める
+		D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// 剣の先
 
-		// Jnʒu2߂
-		D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// ̍
+		// 生成開始位置2を決める
+		D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// 剣の根元
 
-		// bV̋OՂ̐
+		// メッシュの軌跡の生成
 		m_pOrbit = CMeshOrbit::Create(startPos1, startPos2, D3DXCOLOR(0.7f, 0.3f, 1.0f, 0.8f), 50);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// OՂ̈ʒuXV
+		// 軌跡の位置更新
 		if (m_pOrbit)
 		{
-			// Jnʒu1߂
-			D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// ̐
+			// 生成開始位置1を決める
+			D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// 剣の先
 
-			// Jnʒu2߂
-			D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// ̍
+			// 生成開始位置2を決める
+			D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// 剣の根元
 
 			m_pOrbit->SetStartPos(startPos1, startPos2);
 		}
 
-		// [V̐isx擾
-		float motionRate = pEnemy->GetMotion()->GetMotionRate(); // 0.0`1.0
+		// モーションの進行度を取得
+		float motionRate = pEnemy->GetMotion()->GetMotionRate(); // 0.0～1.0
 		D3DXVECTOR3 move = pEnemy->GetMove();
 
-		// [VOOړێ
+		// モーション前半だけ前方移動を維持
 		if (motionRate < MOTIONRATE_THRESHOLD)
 		{
 			D3DXVECTOR3 forwardDir = pEnemy->GetForward();
@@ -338,17 +338,17 @@ public:
 		}
 		else
 		{
-			move *= CEnemyLeader::DECELERATION_RATE; // 
+			move *= CEnemyLeader::DECELERATION_RATE; // 減速率
 			if (fabsf(move.x) < 0.01f) move.x = 0;
 			if (fabsf(move.z) < 0.01f) move.z = 0;
 		}
 
-		// ړʂݒ
+		// 移動量を設定
 		pEnemy->SetMove(move);
 
 		if (pEnemy->GetWeapon() && pEnemy->GetWeaponCollider())
 		{
-			// UL
+			// 攻撃中だけ有効化
 			if (pEnemy->GetMotion()->EventMotionRange(CEnemyLeader::CLOSE_ATTACK_01, 2, 4, 0, 15))
 			{
 				pEnemy->GetWeaponCollider()->SetActive(true);
@@ -359,20 +359,20 @@ public:
 				pEnemy->GetWeaponCollider()->SetActive(false);
 			}
 
-			// vC[̎擾
+			// プレイヤーの取得
 			CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 			if (pPlayer)
 			{
-				// vC[ɓ肷
+				// プレイヤーに当たったか判定する
 				pEnemy->GetWeaponCollider()->CheckHit(pPlayer, 2.5f, 25.0f);
 			}
 		}
 
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::CLOSE_ATTACK_01))
-		{// ߋU[VIĂ
+		{// 近距離攻撃モーションが終わっていたら
 
-			// ߋU2
+			// 近距離攻撃状態2
 			m_pMachine->ChangeState<CEnemyLeader_CloseAttackState2>();
 
 			return;
@@ -385,16 +385,16 @@ public:
 	}
 
 private:
-	static constexpr float SLIDE_POWER			= 45.0f;	// XChp[
-	static constexpr float MOTIONRATE_THRESHOLD = 0.2f;		// [V[g臒l
-	static constexpr float FORWARD_POWER		= 15.0f;	// 鑬x
+	static constexpr float SLIDE_POWER			= 45.0f;	// スライドパワー
+	static constexpr float MOTIONRATE_THRESHOLD = 0.2f;		// モーションレートの閾値
+	static constexpr float FORWARD_POWER		= 15.0f;	// 滑る速度
 
 	CMeshOrbit* m_pOrbit = nullptr;
 
 };
 
 //*****************************************************************************
-// [_[G̋ߋU2
+// リーダー敵の近距離攻撃状態2
 //*****************************************************************************
 class CEnemyLeader_CloseAttackState2 :public StateBase<CEnemyLeader>
 {
@@ -402,22 +402,22 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// qbgtOZbg
+		// ヒットフラグをリセット
 		pEnemy->GetWeaponCollider()->ResetHit();
 
-		// ߋU[V2
+		// 近距離攻撃モーション2
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::CLOSE_ATTACK_02, 10);
 
-		// ̎擾
+		// 音の取得
 		CSound* pSound = CManager::GetSound();
 
-		// aSE2̍Đ
+		// 斬撃SE2の再生
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_SLASH_2);
 		}
 
-		// vC[擾
+		// プレイヤー取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 		if (!pPlayer)
@@ -425,49 +425,49 @@ public:
 			return;
 		}
 
-		// vC[ւ̕xNg
+		// プレイヤーへの方向ベクトル
 		D3DXVECTOR3 toPlayer = pPlayer->GetPos() - pEnemy->GetPos();
 
-		// ĂɃXCh邽߁AvC[xNg擾
+		// 向いている方向にスライドさせるため、プレイヤー方向ベクトルを取得
 		D3DXVECTOR3 dir = toPlayer;
 
-		// K
+		// 正規化
 		D3DXVec3Normalize(&dir, &dir);
 
 		D3DXVECTOR3 move = dir * SLIDE_POWER;
 
-		// ݂̈ړʂɏ㏑
+		// 現在の移動量に上書き
 		pEnemy->SetMove(move);
 
-		// Jnʒu1߂
-		D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// ̐
+		// 生成開始位置1を決める
+		D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// 剣の先
 
-		// Jnʒu2߂
-		D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// ̍
+		// 生成開始位置2を決める
+		D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// 剣の根元
 
-		// bV̋OՂ̐
+		// メッシュの軌跡の生成
 		m_pOrbit = CMeshOrbit::Create(startPos1, startPos2, D3DXCOLOR(0.7f, 0.3f, 1.0f, 0.8f), 50);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// OՂ̈ʒuXV
+		// 軌跡の位置更新
 		if (m_pOrbit)
 		{
-			// Jnʒu1߂
-			D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// ̐
+			// 生成開始位置1を決める
+			D3DXVECTOR3 startPos1 = pEnemy->GetWeaponCollider()->GetCurrentTipPos();// 剣の先
 
-			// Jnʒu2߂
-			D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// ̍
+			// 生成開始位置2を決める
+			D3DXVECTOR3 startPos2 = pEnemy->GetWeaponCollider()->GetCurrentBasePos();// 剣の根元
 
 			m_pOrbit->SetStartPos(startPos1, startPos2);
 		}
 
-		// [V̐isx擾
-		float motionRate = pEnemy->GetMotion()->GetMotionRate(); // 0.0`1.0
+		// モーションの進行度を取得
+		float motionRate = pEnemy->GetMotion()->GetMotionRate(); // 0.0～1.0
 		D3DXVECTOR3 move = pEnemy->GetMove();
 
-		// [VOOړێ
+		// モーション前半だけ前方移動を維持
 		if (motionRate < MOTIONRATE_THRESHOLD)
 		{
 			D3DXVECTOR3 forwardDir = pEnemy->GetForward();
@@ -477,17 +477,17 @@ public:
 		}
 		else
 		{
-			move *= CEnemyLeader::DECELERATION_RATE; // 
+			move *= CEnemyLeader::DECELERATION_RATE; // 減速率
 			if (fabsf(move.x) < 0.01f) move.x = 0;
 			if (fabsf(move.z) < 0.01f) move.z = 0;
 		}
 
-		// ړʂݒ
+		// 移動量を設定
 		pEnemy->SetMove(move);
 
 		if (pEnemy->GetWeapon() && pEnemy->GetWeaponCollider())
 		{
-			// UL
+			// 攻撃中だけ有効化
 			if (pEnemy->GetMotion()->EventMotionRange(CEnemyLeader::CLOSE_ATTACK_02, 0, 2, 0, 15))
 			{
 				pEnemy->GetWeaponCollider()->SetActive(true);
@@ -498,39 +498,39 @@ public:
 				pEnemy->GetWeaponCollider()->SetActive(false);
 			}
 
-			// vC[̎擾
+			// プレイヤーの取得
 			CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 			if (pPlayer)
 			{
-				// vC[ɓ肷
+				// プレイヤーに当たったか判定する
 				pEnemy->GetWeaponCollider()->CheckHit(pPlayer, 2.5f, 30.0f);
 			}
 		}
 
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::CLOSE_ATTACK_02))
-		{// ߋU[VIĂ
-			// ҋ@
+		{// 近距離攻撃モーションが終わっていたら
+			// 待機状態
 			m_pMachine->ChangeState<CEnemyLeader_StandState>();
 		}
 	}
 
 	void OnExit(CEnemyLeader* pEnemy)override
 	{
-		// N[_E̐ݒ
+		// クールダウンの設定
 		pEnemy->SetCooldown(3.0f);
 	}
 
 private:
-	static constexpr float SLIDE_POWER			= 20.0f;	// XChp[
-	static constexpr float FORWARD_POWER		= 10.0f;	// 鑬x
-	static constexpr float MOTIONRATE_THRESHOLD = 0.2f;		// [V[g臒l
+	static constexpr float SLIDE_POWER			= 20.0f;	// スライドパワー
+	static constexpr float FORWARD_POWER		= 10.0f;	// 滑る速度
+	static constexpr float MOTIONRATE_THRESHOLD = 0.2f;		// モーションレートの閾値
 
 	CMeshOrbit* m_pOrbit = nullptr;
 };
 
 //*****************************************************************************
-// [_[G̋^
+// リーダー敵の疑い状態
 //*****************************************************************************
 class CEnemyLeader_DoubtState :public StateBase<CEnemyLeader>
 {
@@ -540,46 +540,46 @@ public:
 	{
 		m_timer = 0;
 
-		// ^[V
+		// 疑いモーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::DOUBT, 10);
 
-		// vC[擾
+		// プレイヤー取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[ւ̕xNg
+		// プレイヤーへの方向ベクトル
 		D3DXVECTOR3 toPlayer = pPlayer->GetPos() - pEnemy->GetPos();
 
 		if (pPlayer)
 		{
-			toPlayer.y = 0.0f; // ̂
+			toPlayer.y = 0.0f; // 水平方向のみ
 			D3DXVec3Normalize(&toPlayer, &toPlayer);
 
-			// ڕW̊pxZo
+			// 目標の角度を算出
 			float targetYaw = atan2f(-toPlayer.x, -toPlayer.z);
 
-			// ړIpxݒiX,Z͂̂܂܁j
+			// 目的角度を設定（X,Zはそのまま）
 			D3DXVECTOR3 rotDest = pEnemy->GetRot();
 			rotDest.y = targetYaw;
 
-			// GɖړIpxݒ
+			// 敵に目的角度を設定
 			pEnemy->SetRotDest(rotDest);
 
-			// Ԃĉ]
+			// 補間して回転
 			pEnemy->UpdateRotation(0.5f);
 		}
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// E邽߂ɃvC[擾
+		// 視界内判定をするためにプレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
-		// [_[G̈ʒu擾
+		// リーダー敵の位置を取得
 		D3DXVECTOR3 pos = pEnemy->GetPos();
-		pos.y += EFFECT_OFFSET;// グ
+		pos.y += EFFECT_OFFSET;// 少し上げる
 
 		m_timer++;
 
@@ -587,30 +587,30 @@ public:
 		{
 			m_timer = 0;
 
-			// ʉ|bvAbvGtFNg̐
+			// 効果音ポップアップエフェクトの生成
 			CSEPopupEffect::Create("data/TEXTURE/popup_question.png", pos, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 40);
 		}
 
-		// [VɃvC[Eɓ
+		// モーション中にプレイヤーが視界に入ったら
 		if (pEnemy->IsPlayerInSight(pPlayer))
 		{
-			// 
+			// 発見状態
 			m_pMachine->ChangeState<CEnemyLeader_DiscoverState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::DOUBT))
-		{// ^[VIĂ
+		{// 疑いモーションが終わっていたら
 
-			// TuGǐՏԂ
+			// サブ敵が追跡状態だったら
 			if (pEnemy->IsSubAction(CEnemy::AI_CHASE))
 			{
-				// ǐՏ
+				// 追跡状態
 				m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
 				return;
 			}
 
-			// ̒
+			// 音源の調査状態
 			m_pMachine->ChangeState<CEnemyLeader_SoundInvestigateState>();
 		}
 	}
@@ -621,14 +621,14 @@ public:
 	}
 
 private:
-	static constexpr float	EFFECT_OFFSET	= 40.0f;// GtFNgʒuItZbg
-	static constexpr int	EFFECT_INTERVAL = 15;	// GtFNgC^[o
+	static constexpr float	EFFECT_OFFSET	= 40.0f;// エフェクト生成位置オフセット
+	static constexpr int	EFFECT_INTERVAL = 15;	// エフェクト生成インターバル
 
-	int m_timer;// GtFNgp^C}[
+	int m_timer;// エフェクト用生成タイマー
 };
 
 //*****************************************************************************
-// [_[G̉̒
+// リーダー敵の音源の調査状態
 //*****************************************************************************
 class CEnemyLeader_SoundInvestigateState :public StateBase<CEnemyLeader>
 {
@@ -636,37 +636,37 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// ̒[V
+		// 音源の調査モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::SOUND_INVESTIGATE, 10);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// E邽߂ɃvC[擾
+		// 視界内判定をするためにプレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// [VɃvC[Eɓ
+		// モーション中にプレイヤーが視界に入ったら
 		if (pEnemy->IsPlayerInSight(pPlayer))
 		{
-			// 
+			// 発見状態
 			m_pMachine->ChangeState<CEnemyLeader_DiscoverState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// TuGǐՏԂ
+		// サブ敵が追跡状態だったら
 		if (pEnemy->IsSubAction(CEnemy::AI_CHASE))
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// ̃|CgɌ
+		// 音源のポイントに向かう
 		D3DXVECTOR3 toTarget = pEnemy->GetLastHeardSoundPos() - pEnemy->GetPos();
 		toTarget.y = 0;
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemyLeader::INVESTIGATE_SPEED;
 		D3DXVECTOR3 targetMove = pEnemy->GetForward();
 
@@ -681,32 +681,32 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemyLeader::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemyLeader::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pEnemy->SetMove(currentMove);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
-		// B玟̖ڕWɐ؂ւ
+		// 到達したら次の目標に切り替える
 		if (pEnemy->HasReachedSoundTarget())
 		{
-			// |CgɓBxԂɖ߂
+			// 巡回ポイントに到達したら警戒状態に戻す
 			if (!pEnemy->IsInvestigating())
 			{
 				m_pMachine->ChangeState<CEnemyLeader_CautionState>();
@@ -724,7 +724,7 @@ private:
 };
 
 //*****************************************************************************
-// [_[G̖̒
+// リーダー敵の埋蔵金の調査状態
 //*****************************************************************************
 class CEnemyLeader_TreasureInvestigateState :public StateBase<CEnemyLeader>
 {
@@ -732,37 +732,37 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// ̒[V
+		// 埋蔵金の調査モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::TREASURE_INVESTIGATE, 10);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// E邽߂ɃvC[擾
+		// 視界内判定をするためにプレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// [VɃvC[Eɓ
+		// モーション中にプレイヤーが視界に入ったら
 		if (pEnemy->IsPlayerInSight(pPlayer))
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// TuGǐՏԂ
+		// サブ敵が追跡状態だったら
 		if (pEnemy->IsSubAction(CEnemy::AI_CHASE))
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// ԋ߂̏ꏊɌ
+		// 一番近い埋蔵金の場所に向かう
 		D3DXVECTOR3 toTarget = pEnemy->GetNearestTreasurePos() - pEnemy->GetPos();
 		toTarget.y = 0;
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemyLeader::INVESTIGATE_SPEED;
 		D3DXVECTOR3 targetMove = pEnemy->GetForward();
 
@@ -777,38 +777,38 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemyLeader::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemyLeader::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pEnemy->SetMove(currentMove);
 
-		// GWɃZbg
+		// 物理エンジンにセット
 		btVector3 velocity = pEnemy->GetRigidBody()->getLinearVelocity();
 		velocity.setX(currentMove.x);
 		velocity.setZ(currentMove.z);
 		pEnemy->GetRigidBody()->setLinearVelocity(velocity);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
-		// B玟̖ڕWɐ؂ւ
+		// 到達したら次の目標に切り替える
 		if (pEnemy->HasReachedTreasure())
 		{
-			// x
+			// 警戒状態
 			m_pMachine->ChangeState<CEnemyLeader_CautionState>();
 		}
 	}
@@ -823,7 +823,7 @@ private:
 };
 
 //*****************************************************************************
-// [_[Ǧx
+// リーダー敵の警戒状態
 //*****************************************************************************
 class CEnemyLeader_CautionState :public StateBase<CEnemyLeader>
 {
@@ -831,54 +831,54 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// x[V
+		// 警戒モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::CAUTION, 20);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// E邽߂ɃvC[擾
+		// 視界内判定をするためにプレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// ̃ubNɓ肷邽߁AubN}l[W[擾
+		// 特定のブロックに当たったか判定するため、ブロックマネージャーを取得する
 		CBlockManager* pBlockManager = CGame::GetBlockManager();
 
-		// ނ̒
+		// 草むらの中か判定
 		bool playerInGrass = pBlockManager->IsPlayerInGrass();
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
-		// [VɃvC[Eɓ
+		// モーション中にプレイヤーが視界に入ったら
 		if (pEnemy->IsPlayerInSight(pPlayer) && !playerInGrass)
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// ^ԃNGXgĂ
+		// 疑い状態リクエストされていたら
 		if (pEnemy->GetRequestedAction() == CEnemy::AI_DOUBT)
 		{
 			m_pMachine->ChangeState<CEnemyLeader_DoubtState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// ߏԃNGXgĂ
+		// 命令状態リクエストされていたら
 		if (pEnemy->GetRequestedAction() == CEnemy::AI_ORDER)
 		{
-			// ߏ
+			// 命令状態
 			m_pMachine->ChangeState<CEnemyLeader_OrderState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// x[VIĂ
+		// 警戒モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::CAUTION))
 		{
-			// ԋ߂|Cgɖ߂
+			// 一番近い巡回ポイントに戻す
 			pEnemy->ReturnToPatrol();
 
-			// ړ
+			// 移動状態
 			m_pMachine->ChangeState<CEnemyLeader_MoveState>();
 		}
 	}
@@ -893,7 +893,7 @@ private:
 };
 
 //*****************************************************************************
-// [_[G̖ߏ
+// リーダー敵の命令状態
 //*****************************************************************************
 class CEnemyLeader_OrderState :public StateBase<CEnemyLeader>
 {
@@ -901,56 +901,56 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// ߃[V
+		// 命令モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::ORDER, 20);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// Ê߂ɃvC[擾
+		// 視界内判定のためにプレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
-		// ̃|CgɌ
+		// 音源のポイントに向く
 		D3DXVECTOR3 toTarget = pEnemy->GetLastHeardSoundPos() - pEnemy->GetPos();
 		toTarget.y = 0;
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
-		// Eɓ
+		// 視界に入ったら
 		if (pEnemy->IsPlayerInSight(pPlayer))
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
 			return;
 		}
 
-		// TuGǐՏԂ
+		// サブ敵が追跡状態だったら
 		if (pEnemy->IsSubAction(CEnemy::AI_CHASE))
 		{
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
 			return;
 		}
 
-		// ߃[VIĂ
+		// 命令モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::ORDER))
 		{
-			// x
+			// 警戒状態
 			m_pMachine->ChangeState<CEnemyLeader_CautionState>();
 		}
 	}
@@ -965,7 +965,7 @@ private:
 };
 
 //*****************************************************************************
-// [_[G̒ǐՏ
+// リーダー敵の追跡状態
 //*****************************************************************************
 class CEnemyLeader_ChaseState :public StateBase<CEnemyLeader>
 {
@@ -973,106 +973,106 @@ public:
 
 	void OnStart(CEnemyLeader* pEnemy)override
 	{
-		// ǐՃ[V
+		// 追跡モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::CHASE, 10);
 
-		// Jnʒu1߂
+		// 生成開始位置1を決める
 		D3DXVECTOR3 startPos1 = pEnemy->GetPos();
 		startPos1.y += ORBIT_OFFSET_TOP;
 
-		// Jnʒu2߂
+		// 生成開始位置2を決める
 		D3DXVECTOR3 startPos2 = pEnemy->GetPos();
 		startPos2.y += ORBIT_OFFSET_BOTTOM;
 
-		// bV̋OՂ̐
+		// メッシュの軌跡の生成
 		m_pOrbit = CMeshOrbit::Create(startPos1, startPos2, D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.8f), 50);
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// OՂ̈ʒuXV
+		// 軌跡の位置更新
 		if (m_pOrbit)
 		{
-			// Jnʒu1߂
+			// 生成開始位置1を決める
 			D3DXVECTOR3 startPos1 = pEnemy->GetPos();
 			startPos1.y += ORBIT_OFFSET_TOP;
 
-			// Jnʒu2߂
+			// 生成開始位置2を決める
 			D3DXVECTOR3 startPos2 = pEnemy->GetPos();
 			startPos2.y += ORBIT_OFFSET_BOTTOM;
 
 			m_pOrbit->SetStartPos(startPos1, startPos2);
 		}
 
-		// [VXs[h𑁂
+		// モーションスピードを早くする
 		pEnemy->GetMotion()->SetMotionSpeedRate(1.4f);
 
-		// vC[̎擾
+		// プレイヤーの取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[̕
+		// プレイヤーの方向
 		D3DXVECTOR3 toTarget = pPlayer->GetPos() - pEnemy->GetPos();
 		toTarget.y = 0;
 		float distance = D3DXVec3Length(&toTarget);
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
 		CModel** models = pEnemy->GetModels();
-		int num = pEnemy->GetNumModels();// f
+		int num = pEnemy->GetNumModels();// モデル数
 
 		for (int nCnt = 0; nCnt < num; nCnt++)
 		{
-			// AEgCԂɂ
+			// アウトラインを赤にする
 			models[nCnt]->SetOutlineColor(VEC4_RED);
 		}
 
-		// TuGǐՒȂ
+		// サブ敵が追跡中じゃなかったら
 		if (!pEnemy->IsSubAction(CEnemy::AI_CHASE))
 		{
-			// TuGǐՂĂȂāAꂽx
+			// サブ敵が追跡していなくて、距離が離れたら警戒へ
 			if (distance > CAUTION_DISTANCE)
 			{
-				// x
+				// 警戒状態
 				m_pMachine->ChangeState<CEnemyLeader_CautionState>();
 				return;
 			}
 		}
 
-		// ̃ubNɓ肷邽߁AubN}l[W[擾
+		// 特定のブロックに当たったか判定するため、ブロックマネージャーを取得する
 		CBlockManager* pBlockManager = CGame::GetBlockManager();
 
-		// ނ̒
+		// 草むらの中か判定
 		bool playerInGrass = pBlockManager->IsPlayerInGrass();
 
-		// XeX
+		// ステルス状態
 		IsStealthSpec stealth;
 
-		// vC[XeXɑނɐ񂾂
+		// プレイヤーがステルス中に草むらに潜んだら
 		if (playerInGrass && stealth.IsSatisfiedBy(*pPlayer) && 
 			!pEnemy->IsSubAction(CEnemy::AI_CHASE))
 		{
-			// xԂֈڍs
+			// 警戒状態へ移行
 			m_pMachine->ChangeState<CEnemyLeader_CautionState>();
 			return;
 		}
 
-		// 苗ɂȂ
+		// 一定距離になったら
 		if (distance < ATTACK_DISTANCE)
 		{
-			if (!pEnemy->IsCooldown()) // N[_EłȂ΍U
+			if (!pEnemy->IsCooldown()) // クールダウン中でなければ攻撃へ
 			{
-				// ߋU1
+				// 近距離攻撃状態1へ
 				m_pMachine->ChangeState<CEnemyLeader_CloseAttackState1>();
 				return;
 			}
 			else
 			{
-				// N[_E͍Uҋ@
+				// クールダウン中は攻撃せず待機状態
 				m_pMachine->ChangeState<CEnemyLeader_StandState>();
 				return;
 			}
 		}
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemyLeader::CHASE_SPEED;
 		D3DXVECTOR3 targetMove = pEnemy->GetForward();
 
@@ -1087,55 +1087,55 @@ public:
 			targetMove = INIT_VEC3;
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemyLeader::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemyLeader::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pEnemy->SetMove(currentMove);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 	}
 
 	void OnExit(CEnemyLeader* pEnemy)override
 	{
 		CModel** models = pEnemy->GetModels();
-		int num = pEnemy->GetNumModels();// f
+		int num = pEnemy->GetNumModels();// モデル数
 
 		for (int nCnt = 0; nCnt < num; nCnt++)
 		{
-			// AEgCʏ(F)ɖ߂
+			// アウトラインを通常(黒色)に戻す
 			models[nCnt]->SetOutlineColor(VEC4_BLACK);
 		}
 
-		// [VXs[hʏɖ߂
+		// モーションスピードを通常に戻す
 		pEnemy->GetMotion()->SetMotionSpeedRate(1.0f);
 	}
 
 private:
-	static constexpr float ATTACK_DISTANCE		= 130.0f;	// U[Vڍs
-	static constexpr float CAUTION_DISTANCE		= 280.0f;	// x[Vڍs
-	static constexpr float ORBIT_OFFSET_TOP		= 50.0f;	// OՂ̏̃ItZbgʒu
-	static constexpr float ORBIT_OFFSET_BOTTOM	= 20.0f;	// OՂ̉̃ItZbgʒu
+	static constexpr float ATTACK_DISTANCE		= 130.0f;	// 攻撃モーション移行距離
+	static constexpr float CAUTION_DISTANCE		= 280.0f;	// 警戒モーション移行距離
+	static constexpr float ORBIT_OFFSET_TOP		= 50.0f;	// 軌跡の上のオフセット位置
+	static constexpr float ORBIT_OFFSET_BOTTOM	= 20.0f;	// 軌跡の下のオフセット位置
 
 	CMeshOrbit* m_pOrbit = nullptr;
 };
 
 //*****************************************************************************
-// [_[G̔
+// リーダー敵の発見状態
 //*****************************************************************************
 class CEnemyLeader_DiscoverState :public StateBase<CEnemyLeader>
 {
@@ -1145,42 +1145,42 @@ public:
 	{
 		m_timer = 0;
 
-		// [V
+		// 発見モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemyLeader::DISCOVER, 10);
 
-		// vC[擾
+		// プレイヤー取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[ւ̕xNg
+		// プレイヤーへの方向ベクトル
 		D3DXVECTOR3 toPlayer = pPlayer->GetPos() - pEnemy->GetPos();
 
 		if (pPlayer)
 		{
-			toPlayer.y = 0.0f; // ̂
+			toPlayer.y = 0.0f; // 水平方向のみ
 			D3DXVec3Normalize(&toPlayer, &toPlayer);
 
-			// ڕW̊pxZo
+			// 目標の角度を算出
 			float targetYaw = atan2f(-toPlayer.x, -toPlayer.z);
 
-			// ړIpxݒiX,Z͂̂܂܁j
+			// 目的角度を設定（X,Zはそのまま）
 			D3DXVECTOR3 rotDest = pEnemy->GetRot();
 			rotDest.y = targetYaw;
 
-			// GɖړIpxݒ
+			// 敵に目的角度を設定
 			pEnemy->SetRotDest(rotDest);
 
-			// Ԃĉ]
+			// 補間して回転
 			pEnemy->UpdateRotation(0.5f);
 		}
 	}
 
 	void OnUpdate(CEnemyLeader* pEnemy)override
 	{
-		// [_[G̈ʒu擾
+		// リーダー敵の位置を取得
 		D3DXVECTOR3 pos = pEnemy->GetPos();
-		pos.y += EFFECT_OFFSET;// グ
+		pos.y += EFFECT_OFFSET;// 少し上げる
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
 		m_timer++;
@@ -1189,21 +1189,21 @@ public:
 		{
 			m_timer = 0;
 
-			// ʉ|bvAbvGtFNg̐
+			// 効果音ポップアップエフェクトの生成
 			CSEPopupEffect::Create("data/TEXTURE/popup_discover.png", pos, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 40);
 		}
 
-		// [VIĂ
+		// 発見モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemyLeader::DISCOVER))
 		{
 			if (!pEnemy->IsCooldown())
 			{
-				// ǐՏ
+				// 追跡状態
 				m_pMachine->ChangeState<CEnemyLeader_ChaseState>();
 			}
 			else
-			{// N[_E͑ҋ@
-				// ҋ@
+			{// クールダウン中は待機
+				// 待機状態
 				m_pMachine->ChangeState<CEnemyLeader_StandState>();
 			}
 		}
@@ -1215,10 +1215,10 @@ public:
 	}
 
 private:
-	static constexpr float	EFFECT_OFFSET	= 40.0f;	// GtFNgʒuItZbg
-	static constexpr int	EFFECT_INTERVAL = 10;		// GtFNgC^[o
+	static constexpr float	EFFECT_OFFSET	= 40.0f;	// エフェクト生成位置オフセット
+	static constexpr int	EFFECT_INTERVAL = 10;		// エフェクト生成インターバル
 
-	int m_timer;										// GtFNgp^C}[
+	int m_timer;										// エフェクト用タイマー
 };
 
 #endif
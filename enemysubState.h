@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// TuG̏ԏ [enemysubState.h]
+// サブ敵の状態処理 [enemysubState.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,13 +8,13 @@
 #define _ENEMYSUBSTATE_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "particle.h"
 #include "enemy.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CEnemySub_StandState;
 class CEnemySub_MoveState;
@@ -24,7 +24,7 @@ class CEnemySub_CautionState;
 class CEnemySub_FollowState;
 
 //*****************************************************************************
-// ҋ@
+// 待機状態
 //*****************************************************************************
 class CEnemySub_StandState :public StateBase<CEnemySub>
 {
@@ -34,23 +34,23 @@ public:
 	{
 		m_nParticleTimer = 0;
 
-		// ҋ@[V
+		// 待機モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemySub::NEUTRAL, 20);
 	}
 
 	void OnUpdate(CEnemySub* pEnemy)override
 	{
-		// E邽߂ɁAvC[擾
+		// 視界内判定をするために、プレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[Ƃ̋Zo
+		// プレイヤーとの距離を算出
 		D3DXVECTOR3 diff = pPlayer->GetPos() - pEnemy->GetPos();
 		float distance = D3DXVec3Length(&diff);
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
-		// p[eBNʒu
+		// パーティクル発生位置
 		D3DXVECTOR3 spawnPos = pEnemy->GetPos();
 		spawnPos.y += OFFSET_POS;
 
@@ -60,55 +60,55 @@ public:
 		{
 			m_nParticleTimer = 0;
 
-			// p[eBN
+			// パーティクル生成
 			CParticle::Create<COnibiParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(0.8f, 0.6f, 1.0f, 0.8f), 40, 1);
 		}
 
-		// [VɃvC[͈͋߂Â
+		// モーション中にプレイヤーが一定範囲近づいたら
 		if (distance < CEnemySub::CHASE_DISTANCE)
 		{
-			// ǐՏԃNGXg
+			// 追跡状態リクエスト
 			pEnemy->SetRequestedAction(CEnemy::AI_CHASE);
 
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// ԃNGXgĂ
+		// 調査状態リクエストされていたら
 		if (pEnemy->GetRequestedAction() == CEnemy::AI_SOUND_INVESTIGATE)
 		{
-			// 
+			// 調査状態
 			m_pMachine->ChangeState<CEnemySub_InvestigateState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// ǐՏԃNGXgĂ
+		// 追跡状態リクエストされていたら
 		if (pEnemy->GetRequestedAction() == CEnemy::AI_CHASE)
 		{
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// ҋ@[VIĂ
+		// 待機モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemySub::NEUTRAL))
 		{
 			switch (pEnemy->GetRequestedAction())
 			{
-			case CEnemy::EEnemyAction::AI_MOVE:// ړ
+			case CEnemy::EEnemyAction::AI_MOVE:// 移動状態
 				m_pMachine->ChangeState<CEnemySub_MoveState>();
 				break;
 
-			case CEnemy::EEnemyAction::AI_CAUTION:// x
+			case CEnemy::EEnemyAction::AI_CAUTION:// 警戒状態
 				m_pMachine->ChangeState<CEnemySub_CautionState>();
 				break;
 
-			case CEnemy::EEnemyAction::AI_FOLLOW:// [_[Ǐ]
+			case CEnemy::EEnemyAction::AI_FOLLOW:// リーダー追従状態
 				m_pMachine->ChangeState<CEnemySub_FollowState>();
 				break;
 
 			default:
-				break; // ̂܂ܑҋ@
+				break; // そのまま待機
 			}
 		}
 	}
@@ -119,14 +119,14 @@ public:
 	}
 
 private:
-	static constexpr int	PARTICLE_INTERVAL	= 6;		// p[eBNC^[o
-	static constexpr float	OFFSET_POS			= 50.0f;	// ItZbgʒu
+	static constexpr int	PARTICLE_INTERVAL	= 6;		// パーティクル生成インターバル
+	static constexpr float	OFFSET_POS			= 50.0f;	// オフセット位置
 
 	int m_nParticleTimer;
 };
 
 //*****************************************************************************
-// ړ
+// 移動状態
 //*****************************************************************************
 class CEnemySub_MoveState :public StateBase<CEnemySub>
 {
@@ -136,42 +136,42 @@ public:
 	{
 		m_nParticleTimer = 0;
 
-		// ړ[V
+		// 移動モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemySub::MOVE, 10);
 	}
 
 	void OnUpdate(CEnemySub* pEnemy)override
 	{
-		// ߂邽߂ɁAvC[擾
+		// 距離を求めるために、プレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[Ƃ̋Zo
+		// プレイヤーとの距離を算出
 		D3DXVECTOR3 diff = pPlayer->GetPos() - pEnemy->GetPos();
 		float distance = D3DXVec3Length(&diff);
 
-		// [VɃvC[͈͋߂Â
+		// モーション中にプレイヤーが一定範囲近づいたら
 		if (distance < CEnemySub::CHASE_DISTANCE)
 		{
-			// ǐՏԃNGXg
+			// 追跡状態リクエスト
 			pEnemy->SetRequestedAction(CEnemy::AI_CHASE);
 
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// [_[߂o
+		// リーダーが命令を出したら
 		if (pEnemy->IsLeaderAction(CEnemy::AI_ORDER))
 		{
-			// ̈ʒuݒ
+			// 音の位置を設定
 			pEnemy->OnSoundHeard(pEnemy->GetLastHeardSoundPos());
 
-			// 
+			// 調査状態
 			m_pMachine->ChangeState<CEnemySub_InvestigateState>();
 			return;
 		}
 
-		// p[eBNʒu
+		// パーティクル発生位置
 		D3DXVECTOR3 spawnPos = pEnemy->GetPos();
 		spawnPos.y += OFFSET_POS;
 
@@ -181,16 +181,16 @@ public:
 		{
 			m_nParticleTimer = 0;
 
-			// p[eBN
+			// パーティクル生成
 			CParticle::Create<COnibiParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(0.8f, 0.6f, 1.0f, 0.8f), 40, 1);
 		}
 
-		// |CgɌ
+		// 巡回ポイントに向かう
 		D3DXVECTOR3 toTarget = pEnemy->GetPatrolTarget() - pEnemy->GetPos();
 		toTarget.y = 0;
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemySub::SPEED;
 		D3DXVECTOR3 targetMove = pEnemy->GetForward();
 
@@ -205,55 +205,55 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemySub::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemySub::ACCEL_RATE;
 
-		// Ԍ̑xZbg
+		// 補間後の速度をセット
 		pEnemy->SetMove(currentMove);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
 		// ----------------------
-		// |CgB
+		// 巡回ポイント到達判定
 		// ----------------------
 		if (pEnemy->HasReachedTarget())
 		{
-			if ((rand() % 100) < PROBABILITY)
+			if (CRandom::Get(CRandom::STREAM_GAMEPLAY).Int(100) < PROBABILITY)
 			{
-				// B|Cg̓B肪ƒʂĂ܂߁Ȁ|Cgݒ肵Ă
+				// 今到達した巡回ポイントの到達判定がずっと通ってしまうため、次の巡回ポイントを設定しておく
 				pEnemy->ChooseNextPatrolPoint();
 
-				// ҋ@
+				// 待機状態
 				m_pMachine->ChangeState<CEnemySub_StandState>();
 			}
 			else
 			{
-				// mőO񗧂Ă̏ꏊɒɌ
-				if ((rand() % 100) < PROBABILITY)
+				// 確率で前回立てた音の場所に調査に向かう
+				if (CRandom::Get(CRandom::STREAM_GAMEPLAY).Int(100) < PROBABILITY)
 				{
-					// ̈ʒuݒ
+					// 音の位置を設定
 					pEnemy->OnSoundHeard(pEnemy->GetLastHeardSoundPos());
 
-					// 
+					// 調査状態
 					m_pMachine->ChangeState<CEnemySub_InvestigateState>();
 				}
 				else
 				{
-					// ̏|CgɌ
+					// 次の巡回ポイントに向かう
 					pEnemy->ChooseNextPatrolPoint();
 				}
 			}
@@ -266,15 +266,15 @@ public:
 	}
 
 private:
-	static constexpr int	PARTICLE_INTERVAL	= 6;		// p[eBNC^[o
-	static constexpr float	OFFSET_POS			= 50.0f;	// ItZbgʒu
-	static constexpr int	PROBABILITY			= 55;		// m
+	static constexpr int	PARTICLE_INTERVAL	= 6;		// パーティクル生成インターバル
+	static constexpr float	OFFSET_POS			= 50.0f;	// オフセット位置
+	static constexpr int	PROBABILITY			= 55;		// 確率
 	int m_nParticleTimer;
 
 };
 
 //*****************************************************************************
-// ǐՏ
+// 追跡状態
 //*****************************************************************************
 class CEnemySub_ChaseState :public StateBase<CEnemySub>
 {
@@ -284,16 +284,16 @@ public:
 	{
 		m_nParticleTimer = 0;
 
-		// ǐՃ[V
+		// 追跡モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemySub::CHASE, 10);
 	}
 
 	void OnUpdate(CEnemySub* pEnemy)override
 	{
-		// ǐՏ
+		// 追跡状態
 		pEnemy->SetRequestedAction(CEnemy::AI_CHASE);
 
-		// p[eBNʒu
+		// パーティクル発生位置
 		D3DXVECTOR3 spawnPos = pEnemy->GetPos();
 		spawnPos.y += OFFSET_POS;
 
@@ -303,54 +303,54 @@ public:
 		{
 			m_nParticleTimer = 0;
 
-			// p[eBN
+			// パーティクル生成
 			CParticle::Create<COnibiParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(1.0f, 0.2f, 0.4f, 0.6f), 40, 1);
 		}
 
-		// vC[̎擾
+		// プレイヤーの取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[Ɍ
+		// プレイヤーに向かう
 		D3DXVECTOR3 dir = pPlayer->GetPos() - pEnemy->GetPos();
 		float distance = D3DXVec3Length(&dir);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-dir.x, -dir.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
-		// 苗ꂽǐՏI
+		// 一定距離離れたら追跡終了
 		if (distance > CEnemySub::CHASE_DISTANCE)
 		{
-			// ŏ̏|Cg߂Ă
+			// 最初の巡回ポイントを決めておく
 			pEnemy->ReturnToPatrol();
 
-			// ҋ@
+			// 待機状態
 			m_pMachine->ChangeState<CEnemySub_StandState>();
 
 			return;
 		}
 
-		// 苗ɂȂ瑬x𗎂Ƃ
+		// 一定距離になったら速度を落とす
 		if (distance < DECELERATION_DISTANCE)
 		{
-			// 
+			// 減速処理
 			pEnemy->ApplyDeceleration();
 
-			return; // ߂~܂
+			return; // 近すぎたら止まる
 		}
 
 		D3DXVec3Normalize(&dir, &dir);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemySub::CHASE_SPEED;
 		D3DXVECTOR3 targetMove = dir * moveSpeed;
 
@@ -365,19 +365,19 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemySub::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemySub::ACCEL_RATE;
 
-		// Ԍ̑xZbg
+		// 補間後の速度をセット
 		pEnemy->SetMove(currentMove);
 
-		// ǐՃ[VIĂ
+		// 追跡モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemySub::CHASE))
 		{
-			// ҋ@
+			// 待機状態
 			m_pMachine->ChangeState<CEnemySub_StandState>();
 		}
 	}
@@ -388,15 +388,15 @@ public:
 	}
 
 private:
-	static constexpr int	PARTICLE_INTERVAL		= 6;		// p[eBNC^[o
-	static constexpr float	OFFSET_POS				= 50.0f;	// ItZbgʒu
-	static constexpr float	DECELERATION_DISTANCE	= 50.0f;	// Jn鋗
+	static constexpr int	PARTICLE_INTERVAL		= 6;		// パーティクル生成インターバル
+	static constexpr float	OFFSET_POS				= 50.0f;	// オフセット位置
+	static constexpr float	DECELERATION_DISTANCE	= 50.0f;	// 減速開始する距離
 
 	int m_nParticleTimer;
 };
 
 //*****************************************************************************
-// 
+// 調査状態
 //*****************************************************************************
 class CEnemySub_InvestigateState :public StateBase<CEnemySub>
 {
@@ -406,45 +406,45 @@ public:
 	{
 		m_nParticleTimer = 0;
 
-		// [V
+		// 調査モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemySub::INVESTIGATE, 10);
 	}
 
 	void OnUpdate(CEnemySub* pEnemy)override
 	{
-		// ߂邽߂ɁAvC[擾
+		// 距離を求めるために、プレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[Ƃ̋Zo
+		// プレイヤーとの距離を算出
 		D3DXVECTOR3 diff = pPlayer->GetPos() - pEnemy->GetPos();
 		float distance = D3DXVec3Length(&diff);
 
-		// [VɃvC[͈͋߂Â
+		// モーション中にプレイヤーが一定範囲近づいたら
 		if (distance < CHASE_DISTANCE)
 		{
-			// ǐՏԃNGXg
+			// 追跡状態リクエスト
 			pEnemy->SetRequestedAction(CEnemy::AI_CHASE);
 
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// [_[߂o
+		// リーダーが命令を出したら
 		if (pEnemy->IsLeaderAction(CEnemy::AI_ORDER))
 		{
-			// ̈ʒuݒ
+			// 音の位置を設定
 			pEnemy->OnSoundHeard(pPlayer->GetPos());
 		}
 
-		// ǐՏԃNGXgĂ
+		// 追跡状態リクエストされていたら
 		if (pEnemy->GetRequestedAction() == CEnemy::AI_CHASE)
 		{
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
-			return; // ɐ؂ւ
+			return; // すぐに切り替え
 		}
 
-		// p[eBNʒu
+		// パーティクル発生位置
 		D3DXVECTOR3 spawnPos = pEnemy->GetPos();
 		spawnPos.y += OFFSET_POS;
 
@@ -454,16 +454,16 @@ public:
 		{
 			m_nParticleTimer = 0;
 
-			// p[eBN
+			// パーティクル生成
 			CParticle::Create<COnibiParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(1.0f, 1.0f, 0.6f, 0.6f), 40, 1);
 		}
 
-		// ̃|CgɌ
+		// 音源のポイントに向かう
 		D3DXVECTOR3 toTarget = pEnemy->GetLastHeardSoundPos() - pEnemy->GetPos();
 		toTarget.y = 0;
 		D3DXVec3Normalize(&toTarget, &toTarget);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CEnemySub::INVESTIGATE_SPEED;
 		D3DXVECTOR3 targetMove = pEnemy->GetForward();
 
@@ -478,32 +478,32 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CEnemySub::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CEnemySub::ACCEL_RATE;
 
-		// Ԍ̑xZbg
+		// 補間後の速度をセット
 		pEnemy->SetMove(currentMove);
 
-		// ڕW̊pxZo
+		// 目標の角度を算出
 		float targetYaw = atan2f(-toTarget.x, -toTarget.z);
 
-		// ړIpxݒiX,Z͂̂܂܁j
+		// 目的角度を設定（X,Zはそのまま）
 		D3DXVECTOR3 rotDest = pEnemy->GetRot();
 		rotDest.y = targetYaw;
 
-		// GɖړIpxݒ
+		// 敵に目的角度を設定
 		pEnemy->SetRotDest(rotDest);
 
-		// Ԃĉ]
+		// 補間して回転
 		pEnemy->UpdateRotation(0.05f);
 
-		// B玟̖ڕWɐ؂ւ
+		// 到達したら次の目標に切り替える
 		if (pEnemy->HasReachedSoundTarget())
 		{
-			// |CgɓBx
+			// 巡回ポイントに到達したら警戒状態
 			if (!pEnemy->IsInvestigating())
 			{
 				m_pMachine->ChangeState<CEnemySub_CautionState>();
@@ -517,15 +517,15 @@ public:
 	}
 
 private:
-	static constexpr int	PARTICLE_INTERVAL	= 6;		// p[eBNC^[o
-	static constexpr float	OFFSET_POS			= 50.0f;	// ItZbgʒu
-	static constexpr float	CHASE_DISTANCE		= 150.0f;	// ǐՊJn
+	static constexpr int	PARTICLE_INTERVAL	= 6;		// パーティクル生成インターバル
+	static constexpr float	OFFSET_POS			= 50.0f;	// オフセット位置
+	static constexpr float	CHASE_DISTANCE		= 150.0f;	// 追跡開始距離
 
 	int m_nParticleTimer;
 };
 
 //*****************************************************************************
-// x
+// 警戒状態
 //*****************************************************************************
 class CEnemySub_CautionState :public StateBase<CEnemySub>
 {
@@ -535,23 +535,23 @@ public:
 	{
 		m_nParticleTimer = 0;
 
-		// x[V
+		// 警戒モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemySub::CAUTION, 20);
 	}
 
 	void OnUpdate(CEnemySub* pEnemy)override
 	{
-		// ߂邽߂ɁAvC[擾
+		// 距離を求めるために、プレイヤーを取得
 		CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-		// vC[Ƃ̋Zo
+		// プレイヤーとの距離を算出
 		D3DXVECTOR3 diff = pPlayer->GetPos() - pEnemy->GetPos();
 		float distance = D3DXVec3Length(&diff);
 
-		// 
+		// 減速処理
 		pEnemy->ApplyDeceleration();
 
-		// p[eBNʒu
+		// パーティクル発生位置
 		D3DXVECTOR3 spawnPos = pEnemy->GetPos();
 		spawnPos.y += OFFSET_POS;
 
@@ -561,42 +561,42 @@ public:
 		{
 			m_nParticleTimer = 0;
 
-			// p[eBN
+			// パーティクル生成
 			CParticle::Create<COnibiParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(0.8f, 0.6f, 1.0f, 0.8f), 40, 1);
 		}
 
-		// [VɃvC[͈͋߂Â
+		// モーション中にプレイヤーが一定範囲近づいたら
 		if (distance < CHASE_DISTANCE)
 		{
-			// ǐՏԃNGXg
+			// 追跡状態リクエスト
 			pEnemy->SetRequestedAction(CEnemy::AI_CHASE);
 
-			// ǐՏ
+			// 追跡状態
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
-			return;// ڍs
+			return;// 即移行
 		}
 
-		// [_[߂o
+		// リーダーが命令を出したら
 		if (pEnemy->IsLeaderAction(CEnemy::AI_ORDER))
 		{
-			// ̈ʒuݒ
+			// 音の位置を設定
 			pEnemy->OnSoundHeard(pPlayer->GetPos());
 
-			// 
+			// 調査状態
 			m_pMachine->ChangeState<CEnemySub_InvestigateState>();
 			return;
 		}
 
 		switch (pEnemy->GetRequestedAction())
 		{
-		case CEnemy::EEnemyAction::AI_SOUND_INVESTIGATE:// ̒
+		case CEnemy::EEnemyAction::AI_SOUND_INVESTIGATE:// 音源の調査状態
 			m_pMachine->ChangeState<CEnemySub_InvestigateState>();
 			break;
-		case CEnemy::EEnemyAction::AI_CHASE:// ǐՏ
+		case CEnemy::EEnemyAction::AI_CHASE:// 追跡状態
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
 			break;
-		case CEnemy::EEnemyAction::AI_MOVE:// ړ
-			// x[VIĂ
+		case CEnemy::EEnemyAction::AI_MOVE:// 移動状態
+			// 警戒モーションが終わっていたら
 			if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemySub::CAUTION))
 			{
 				pEnemy->ReturnToPatrol();
@@ -605,10 +605,10 @@ public:
 			break;
 		}
 
-		// x[VIĂ
+		// 警戒モーションが終わっていたら
 		if (pEnemy->GetMotion()->IsCurrentMotionEnd(CEnemySub::CAUTION))
 		{
-			// [_[Ǐ]
+			// リーダー追従状態
 			m_pMachine->ChangeState<CEnemySub_FollowState>();
 		}
 	}
@@ -619,15 +619,15 @@ public:
 	}
 
 private:
-	static constexpr int	PARTICLE_INTERVAL	= 6;		// p[eBN
-	static constexpr float	OFFSET_POS			= 50.0f;	// ItZbgʒu
-	static constexpr float	CHASE_DISTANCE		= 150.0f;	// ǐՊJn
+	static constexpr int	PARTICLE_INTERVAL	= 6;		// パーティクル生成
+	static constexpr float	OFFSET_POS			= 50.0f;	// オフセット位置
+	static constexpr float	CHASE_DISTANCE		= 150.0f;	// 追跡開始距離
 
 	int m_nParticleTimer;
 };
 
 //*****************************************************************************
-// Ǐ]
+// 追従状態
 //*****************************************************************************
 class CEnemySub_FollowState :public StateBase<CEnemySub>
 {
@@ -637,7 +637,7 @@ public:
 	{
 		m_nParticleTimer = 0;
 
-		// Ǐ][V
+		// 追従モーション
 		pEnemy->GetMotion()->StartBlendMotion(CEnemySub::FOLLOW, 10);
 	}
 
@@ -645,18 +645,18 @@ public:
 	{
 		switch (pEnemy->GetRequestedAction())
 		{
-		case CEnemy::EEnemyAction::AI_SOUND_INVESTIGATE:// 
+		case CEnemy::EEnemyAction::AI_SOUND_INVESTIGATE:// 調査状態
 			m_pMachine->ChangeState<CEnemySub_InvestigateState>();
 			break;
-		case CEnemy::EEnemyAction::AI_CHASE:// ǐՏ
+		case CEnemy::EEnemyAction::AI_CHASE:// 追跡状態
 			m_pMachine->ChangeState<CEnemySub_ChaseState>();
 			break;
-		case CEnemy::EEnemyAction::AI_MOVE:// ړ
+		case CEnemy::EEnemyAction::AI_MOVE:// 移動状態
 			m_pMachine->ChangeState<CEnemySub_MoveState>();
 			break;
 		}
 
-		// p[eBNʒu
+		// パーティクル発生位置
 		D3DXVECTOR3 spawnPos = pEnemy->GetPos();
 		spawnPos.y += OFFSET_POS;
 
@@ -666,7 +666,7 @@ public:
 		{
 			m_nParticleTimer = 0;
 
-			// p[eBN
+			// パーティクル生成
 			CParticle::Create<COnibiParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(0.7f, 0.6f, 1.0f, 0.5f), 40, 1);
 		}
 
@@ -674,35 +674,35 @@ public:
 
 		if (pEnemyLeader)
 		{
-			// [_[Ɍ
+			// リーダーに向かう
 			D3DXVECTOR3 dir = pEnemyLeader->GetPos() - pEnemy->GetPos();
 			float distance = D3DXVec3Length(&dir);
 
-			// ڕW̊pxZo
+			// 目標の角度を算出
 			float targetYaw = atan2f(-dir.x, -dir.z);
 
-			// ړIpxݒiX,Z͂̂܂܁j
+			// 目的角度を設定（X,Zはそのまま）
 			D3DXVECTOR3 rotDest = pEnemy->GetRot();
 			rotDest.y = targetYaw;
 
-			// GɖړIpxݒ
+			// 敵に目的角度を設定
 			pEnemy->SetRotDest(rotDest);
 
-			// Ԃĉ]
+			// 補間して回転
 			pEnemy->UpdateRotation(0.05f);
 
-			// 苗߂Â猸
+			// 一定距離近づいたら減速する
 			if (distance < DECELERATION_DISTANCE)
 			{
-				// 
+				// 減速処理
 				pEnemy->ApplyDeceleration();
 
-				return; // ߂~܂
+				return; // 近すぎたら止まる
 			}
 
 			D3DXVec3Normalize(&dir, &dir);
 
-			// ڕWxvZ
+			// 目標速度計算
 			float moveSpeed = CEnemySub::FOLLOW_SPEED;
 			D3DXVECTOR3 targetMove = dir * moveSpeed;
 
@@ -717,13 +717,13 @@ public:
 				targetMove = D3DXVECTOR3(0, 0, 0);
 			}
 
-			// ݑxƂ̕ԁiC[WOj
+			// 現在速度との補間（イージング）
 			D3DXVECTOR3 currentMove = pEnemy->GetMove();
 
 			currentMove.x += (targetMove.x - currentMove.x) * CEnemySub::ACCEL_RATE;
 			currentMove.z += (targetMove.z - currentMove.z) * CEnemySub::ACCEL_RATE;
 
-			// Ԍ̑xZbg
+			// 補間後の速度をセット
 			pEnemy->SetMove(currentMove);
 		}
 	}
@@ -734,9 +734,9 @@ public:
 	}
 
 private:
-	static constexpr int	PARTICLE_INTERVAL		= 6;		// p[eBN
-	static constexpr float	OFFSET_POS				= 50.0f;	// ItZbgʒu
-	static constexpr float	DECELERATION_DISTANCE	= 100.0f;	// Jn鋗
+	static constexpr int	PARTICLE_INTERVAL		= 6;		// パーティクル生成
+	static constexpr float	OFFSET_POS				= 50.0f;	// オフセット位置
+	static constexpr float	DECELERATION_DISTANCE	= 100.0f;	// 減速開始する距離
 
 	int m_nParticleTimer;
 };
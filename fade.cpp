@@ -1,51 +1,52 @@
 //=============================================================================
 //
-// tF[h [fade.cpp]
+// フェード処理 [fade.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "fade.h"
 #include "manager.h"
+#include "spritebatch.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CFade::CFade()
 {
-	// l̃NA
-	m_pVtxBuff	= nullptr;			// _obt@
-	m_pos		= INIT_VEC3;		// ʒu
-	m_fade		= FADE_NONE;		// tF[h̏
-	m_fadeCol	= INIT_XCOL;		// tF[hJ[
-	m_SceneNext = CScene::MODE_MAX;	// ̉
-	m_fWidth	= 0.0f;				// 
-	m_fHeight	= 0.0f;				// 
+	// 値のクリア
+	memset(m_aVtx, 0, sizeof(m_aVtx));// 頂点
+	m_pos		= INIT_VEC3;		// 位置
+	m_fade		= FADE_NONE;		// フェードの状態
+	m_fadeCol	= INIT_XCOL;		// フェードカラー
+	m_SceneNext = CScene::MODE_MAX;	// 次の画面
+	m_fWidth	= 0.0f;				// 幅
+	m_fHeight	= 0.0f;				// 高さ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CFade::~CFade()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CFade* CFade::Create(CScene::MODE mode)
 {
 	CFade* pFade = new CFade;
 
-	// nullptr
+	// nullptrだったら
 	if (pFade == nullptr)
 	{
 		return nullptr;
 	}
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pFade->Init(mode)))
 	{
 		return nullptr;
@@ -54,88 +55,43 @@ CFade* CFade::Create(CScene::MODE mode)
 	return pFade;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CFade::Init(CScene::MODE mode)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	// 
+	// 初期化
 	m_pos = D3DXVECTOR3(0.0f, 0.0f, 0.0f);
 	m_fWidth = FHD_WIDTH;
 	m_fHeight = FHD_HEIGHT;
 
 	m_fade = FADE_IN;
-	m_SceneNext = mode;	//̉
+	m_SceneNext = mode;	//次の画面
 	m_fadeCol = D3DXCOLOR(0.0f, 0.0f, 0.0f, 1.0f);
 
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(m_pos.x, m_pos.y, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(m_pos.x, m_pos.y + m_fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y + m_fHeight, 0.0f);
-
-	// rhw̐ݒ
-	pVtx[0].rhw = 1.0f;
-	pVtx[1].rhw = 1.0f;
-	pVtx[2].rhw = 1.0f;
-	pVtx[3].rhw = 1.0f;
-
-	// _J[̐ݒ
-	pVtx[0].col = D3DXCOLOR(m_fadeCol);
-	pVtx[1].col = D3DXCOLOR(m_fadeCol);
-	pVtx[2].col = D3DXCOLOR(m_fadeCol);
-	pVtx[3].col = D3DXCOLOR(m_fadeCol);
-
-	// eNX`W̐ݒ
-	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
-	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
-	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
-	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点の設定
+	CSpriteBatch::SetRect(m_aVtx, m_pos.x, m_pos.y, m_pos.x + m_fWidth, m_pos.y + m_fHeight);
+	CSpriteBatch::SetColor(m_aVtx, m_fadeCol);
+	CSpriteBatch::SetTexRect(m_aVtx, 0.0f, 0.0f, 1.0f, 1.0f);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CFade::Uninit(void)
 {
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
+	// 頂点はまとめ描画側で持つので破棄するものはなし
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CFade::Update(void)
 {
-	VERTEX_2D* pVtx;
-
 	if (m_fade != FADE_NONE)
 	{
 		if (m_fade == FADE_IN)
-		{//tF[hC
-			m_fadeCol.a -= 0.03f;//|S𓧖ɂĂ
+		{//フェードイン状態
+			m_fadeCol.a -= 0.03f;//ポリゴンを透明にしておく
 
 			if (m_fadeCol.a <= 0.0f)
 			{
@@ -152,51 +108,30 @@ void CFade::Update(void)
 				m_fadeCol.a = 1.0f;
 				m_fade = FADE_IN;
 
-				//[hݒ
+				//モード設定
 				CManager::SetMode(m_SceneNext);
 
 				return;
 			}
 		}
 
-		//_obt@bNA_ւ̃|C^擾
-		m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-		//_J[̐ݒ
-		pVtx[0].col = D3DXCOLOR(m_fadeCol);
-		pVtx[1].col = D3DXCOLOR(m_fadeCol);
-		pVtx[2].col = D3DXCOLOR(m_fadeCol);
-		pVtx[3].col = D3DXCOLOR(m_fadeCol);
-
-		//_obt@AbN
-		m_pVtxBuff->Unlock();
+		//頂点カラーの設定
+		CSpriteBatch::SetColor(m_aVtx, m_fadeCol);
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CFade::Draw(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_2D);
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, nullptr);
-
-	// |S̕`
-	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
+	// まとめ描画に積む(テクスチャ無し)
+	CSpriteBatch::Submit(m_aVtx, -1);
 }
 //=============================================================================
-// tF[h̐ݒ菈
+// フェードの設定処理
 //=============================================================================
 void CFade::SetFade(CScene::MODE modeNext)
 {
-	m_fade = FADE_OUT;		//tF[hAEgԂ
-	m_SceneNext = modeNext;	//̉ʂݒ
+	m_fade = FADE_OUT;		//フェードアウト状態に
+	m_SceneNext = modeNext;	//次の画面を設定
 }
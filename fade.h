@@ -1,30 +1,30 @@
 //=============================================================================
 //
-// tF[h [fade.h]
+// フェード処理 [fade.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _FADE_H_// ̃}N`ĂȂ
-#define _FADE_H_// 2dCN[hh~̃}N`
+#ifndef _FADE_H_// このマクロ定義がされていなかったら
+#define _FADE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object2D.h"
 #include "scene.h"
 
 //*****************************************************************************
-// tF[hNX
+// フェードクラス
 //*****************************************************************************
 class CFade
 {
 public:
-	// 
+	// 状態
 	typedef enum
 	{
-		FADE_NONE = 0,    // ĂȂ
-		FADE_IN,          // tF[hC
-		FADE_OUT,         // tF[hAEg
+		FADE_NONE = 0,    // 何もしていない状態
+		FADE_IN,          // フェードイン状態
+		FADE_OUT,         // フェードアウト状態
 		FADE_MAX
 	}FADE;
 
@@ -41,16 +41,16 @@ public:
 	FADE GetFade(void) { return m_fade; }
 
 private:
-	static constexpr float FHD_WIDTH	= 1920.0f;	// ʂ̕
-	static constexpr float FHD_HEIGHT	= 1080.0f;	// ʂ̍
-
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;				// _obt@ւ̃|C^
-	D3DXVECTOR3				m_pos;					// ʒu
-	FADE					m_fade;					// tF[h̏
-	D3DXCOLOR				m_fadeCol;				// tF[h̐F
-	CScene::MODE			m_SceneNext;			// ̉
-	float					m_fWidth;				// 
-	float					m_fHeight;				// 
+	static constexpr float FHD_WIDTH	= 1920.0f;	// 画面の幅
+	static constexpr float FHD_HEIGHT	= 1080.0f;	// 画面の高さ
+
+	VERTEX_2D				m_aVtx[4];				// 頂点
+	D3DXVECTOR3				m_pos;					// 位置
+	FADE					m_fade;					// フェードの状態
+	D3DXCOLOR				m_fadeCol;				// フェードの色
+	CScene::MODE			m_SceneNext;			// 次の画面
+	float					m_fWidth;				// 幅
+	float					m_fHeight;				// 高さ
 };
 
 #endif
\ No newline at end of file
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// Q[ [game.cpp]
+// ゲーム処理 [game.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "game.h"
 #include "manager.h"
@@ -21,77 +21,87 @@
 #include "resultcount.h"
 #include "grid.h"
 #include "generateMap.h"
+#include "random.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-CTime* CGame::m_pTime = nullptr;					// ^Cւ̃|C^
-CBlockManager* CGame::m_pBlockManager= nullptr;		// ubN}l[W[ւ̃|C^
-CPauseManager* CGame::m_pPauseManager = nullptr;	// |[Y}l[W[ւ̃|C^
-bool CGame::m_isPaused = false;						// trueȂ|[Y
-int CGame::m_nSeed = 0;								// }bṽV[hl
+CTime* CGame::m_pTime = nullptr;					// タイムへのポインタ
+CBlockManager* CGame::m_pBlockManager= nullptr;		// ブロックマネージャーへのポインタ
+CPauseManager* CGame::m_pPauseManager = nullptr;	// ポーズマネージャーへのポインタ
+bool CGame::m_isPaused = false;						// trueならポーズ中
+int CGame::m_nSeed = 0;								// マップのシード値
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CGame::CGame() : CScene(CScene::MODE_GAME)
 {
-	// l̃NA
-	m_pRankingManager	= nullptr;					// LO}l[W[ւ̃|C^
-	m_pLight			= nullptr;					// Cgւ̃|C^
-	m_timer				= 0;						// p[eBN^C}[
-	m_startState		= StartState::WaitStart;	// UȈ
-	m_stateTimer		= 0.0f;						// UIx^C}[
-	m_canControl		= false;					// \tO
+	// 値のクリア
+	m_pRankingManager	= nullptr;					// ランキングマネージャーへのポインタ
+	m_pLight			= nullptr;					// ライトへのポインタ
+	m_nLightGeneration	= 0;						// 登録した時のライトの世代
+	m_timer				= 0;						// パーティクル生成タイマー
+	m_startState		= StartState::WaitStart;	// UIの状態
+	m_stateTimer		= 0.0f;						// UI遅延タイマー
+	m_canControl		= false;					// 操作可能フラグ
+
+	for (int nCnt = 0; nCnt < LIGHT_MAX; nCnt++)
+	{
+		m_anLight[nCnt] = -1;						// 登録したライトの番号
+	}
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CGame::~CGame()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CGame::Init(void)
 {
 #ifdef _DEBUG
-	// Obh̐
+	// グリッドの生成
 	m_pGrid = CGrid::Create();
 
-	// Obh̏
+	// グリッドの初期化
 	m_pGrid->Init();
 #endif
 
-	// ubN}l[W[̐
+	// ブロックマネージャーの生成
 	m_pBlockManager = new CBlockManager;
 
-	// ubN}l[W[̏
+	// ブロックマネージャーの初期化
 	m_pBlockManager->Init();
 
-	// Cg̐
+	// ライトの生成
 	m_pLight = new CLight;
 
-	// Cg̏
+	// ライトの初期化
 	m_pLight->Init();
 
-	m_nSeed = (int)time(nullptr);  // V[hl_ݒ
+	m_nSeed = (int)time(nullptr);  // シード値をランダム設定
 
-	// ǂȂǂ̔zu̓ǂݍ
+	// ゲーム進行用の系列もシード値から決める(マップと同じ並びにならないように反転して使う)
+	CRandom::Get(CRandom::STREAM_GAMEPLAY).Seed(~(unsigned long long)m_nSeed);
+
+	// 壁などの配置情報の読み込み
 	m_pBlockManager->LoadFromJson("data/game_blockinfo.json");
 
-	// _}bv
+	// ランダムマップ生成
 	CGenerateMap::GetInstance()->GenerateRandomMap(m_nSeed);
 
-	// LN^[}l[W[̐
+	// キャラクターマネージャーの生成
 	auto& charaMgr = CCharacterManager::GetInstance();
 
-	// vC[̐
+	// プレイヤーの生成
 	m_pPlayer = CPlayer::Create(D3DXVECTOR3(0.0f, 30.0f, -320.0f), D3DXVECTOR3(0.0f, 180.0f, 0.0f));
 	charaMgr.AddCharacter(m_pPlayer);
 
-	// [_[G̐
+	// リーダー敵の生成
 	CEnemyLeader* pLeader =
 		CEnemy::CreateTyped<CEnemyLeader>(
 			D3DXVECTOR3(0.0f, 15.0f, 300.0f),
@@ -99,18 +109,19 @@ HRESULT CGame::Init(void)
 			);
 	m_pEnemy = pLeader;
 
-	// LN^[̒ǉ
+	// キャラクターの追加
 	charaMgr.AddCharacter(pLeader);
 
-	// TuG
+	// サブ敵生成
 	std::vector<CEnemy*> subEnemies;
 	for (int nCnt = 0; nCnt < NUM_SUB_ENEMIES; nCnt++)
 	{
-		// [_[̎͂ɔzu
+		// リーダーの周囲に配置
+		CRandom& random = CRandom::Get(CRandom::STREAM_GAMEPLAY);
 		D3DXVECTOR3 offset(
-			(float)(rand() % 200 - 100),  // -100`100
+			(float)random.Range(-100, 99),  // -100～100
 			40.0f,
-			(float)(rand() % 200 - 100)
+			(float)random.Range(-100, 99)
 		);
 
 		CEnemySub* pSub =
@@ -119,60 +130,60 @@ HRESULT CGame::Init(void)
 				D3DXVECTOR3(0.0f, 0.0f, 0.0f)
 				);
 
-		// LN^[̒ǉ
+		// キャラクターの追加
 		charaMgr.AddCharacter(pSub);
 		subEnemies.push_back(pSub);
 	}
 
-	// ^C̐
+	// タイムの生成
 	m_pTime = CTime::Create(3, 0, 760.0f, 10.0f, 42.0f, 58.0f, false);
 
-	// bVh[̐
+	// メッシュドームの生成
 	CMeshDome::Create(D3DXVECTOR3(0.0f, 0.0f, 0.0f), 1000);
 
-	// [UI
+	// ルールUI生成
 	auto rule = CUITexture::Create("data/TEXTURE/ui_rule.png", 0.57f, 0.57f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.0f), 0.15f, 0.12f);
 
-	// CsUI
+	// 任務失敗UI生成
 	auto mission_failure = CUITexture::Create("data/TEXTURE/ui_mission_failure.png", 0.57f, 0.57f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.0f), 0.15f, 0.12f);
 
-	// EoUI
+	// 脱出UI生成
 	auto escape_xinput = CUITexture::Create("data/TEXTURE/ui_escape_xinput.png", 0.57f, 0.85f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.0f), 0.1f, 0.06f);
 	auto escape_keyboard = CUITexture::Create("data/TEXTURE/ui_escape_keyboard.png", 0.57f, 0.85f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.0f), 0.1f, 0.06f);
 
-	// [UIo^
+	// ルールUI登録
 	CUIManager::GetInstance()->AddUI("Rule", rule);
 
-	// CsUIo^
+	// 任務失敗UI登録
 	CUIManager::GetInstance()->AddUI("MissionFailure", mission_failure);
 
-	// EoUIo^
+	// 脱出UI登録
 	CUIManager::GetInstance()->AddUI("Escape_XInput", escape_xinput);
 	CUIManager::GetInstance()->AddUI("Escape_Keyboard", escape_keyboard);
 
-	// ɊeUI̐ݒ
+	// 生成直後に各UIの設定をする
 	rule->Hide();
 	mission_failure->Hide();
 	escape_xinput->Hide();
 	escape_keyboard->Hide();
 
 	m_startState = StartState::WaitStart;
-	m_stateTimer = WAIT_TIME;   // Jn̏ҋ@
+	m_stateTimer = WAIT_TIME;   // 開始時の初期待機
 	m_canControl = false;
 
-	// |[Y}l[W[̐
+	// ポーズマネージャーの生成
 	m_pPauseManager = new CPauseManager();
 
-	// |[Y}l[W[̏
+	// ポーズマネージャーの初期化
 	m_pPauseManager->Init();
 
-	// LO}l[W[̃CX^X
+	// ランキングマネージャーのインスタンス生成
 	m_pRankingManager = std::make_unique<CRankingManager>();
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// Q[BGM̍Đ
+	// ゲームBGMの再生
 	if (pSound)
 	{
 		pSound->Play(CSound::SOUND_LABEL_GAMEBGM);
@@ -181,23 +192,23 @@ HRESULT CGame::Init(void)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CGame::Uninit(void)
 {
-	// LN^[}l[W[̔j
+	// キャラクターマネージャーの破棄
 	CCharacterManager::GetInstance().Destroy();
 
-	//}bvWFl[^[̃Xg̃NA
+	//マップジェネレーターのリストのクリア
 	CGenerateMap::GetInstance()->Uninit();
 
-	// WCpbh̎擾
+	// ジョイパッドの取得
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// U~
+	// 振動停止
 	pJoypad->StopVibration();
 
-	// ubN}l[W[̔j
+	// ブロックマネージャーの破棄
 	if (m_pBlockManager != nullptr)
 	{
 		m_pBlockManager->Uninit();
@@ -206,17 +217,17 @@ void CGame::Uninit(void)
 		m_pBlockManager = nullptr;
 	}
 
-	// Cg̔j
+	// ライトの破棄
 	if (m_pLight != nullptr)
 	{
 		delete m_pLight;
 		m_pLight = nullptr;
 	}
 
-	// |[Y}l[W[̔j
+	// ポーズマネージャーの破棄
 	if (m_pPauseManager != nullptr)
 	{
-		// |[Y}l[W[̏I
+		// ポーズマネージャーの終了処理
 		m_pPauseManager->Uninit();
 
 		delete m_pPauseManager;
@@ -224,27 +235,27 @@ void CGame::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CGame::Update(void)
 {
 	m_timer++;
 
-	if (m_timer >= BLOSSOM_INTERVAL)// ԊuŐ
-	{// ̐
-		// Zbg
+	if (m_timer >= BLOSSOM_INTERVAL)// 一定間隔で生成
+	{// 桜の生成
+		// リセット
 		m_timer = 0;
 
-		// vC[̈ʒuɐ
+		// プレイヤーの位置を基準に生成
 		D3DXVECTOR3 playerPos(0.0f,0.0f,0.0f);
 
 		if (m_pPlayer)
 		{
-			// vC[ʒu擾
+			// プレイヤー位置を取得
 			playerPos = m_pPlayer->GetPos();
 		}
 
-		// p[eBN
+		// パーティクル生成
 		CParticle::Create<CBlossomParticle>(INIT_VEC3, playerPos, D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.8f), 0, 1);
 	}
 
@@ -252,115 +263,115 @@ void CGame::Update(void)
 	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// Cg̍XV
+	// ライトの更新
 	UpdateLight();
 
-	// TABL[Ń|[YON/OFF
+	// TABキーでポーズON/OFF
 	if (pKeyboard->GetTrigger(DIK_TAB) || pJoypad->GetTrigger(CInputJoypad::JOYKEY_START))
 	{
-		// |[Y؂ւȌԂL^
+		// ポーズ切り替え前の状態を記録
 		bool wasPaused = m_isPaused;
 
 		m_isPaused = !m_isPaused;
 
-		// |[YԂɉĉ𐧌
+		// ポーズ状態に応じて音を制御
 		if (m_isPaused && !wasPaused)
 		{
-			// U~
+			// 振動停止
 			pJoypad->StopVibration();
 
-			// ꎞ~
+			// 一時停止する
 			CManager::GetSound()->PauseAll();
 		}
 		else if (!m_isPaused && wasPaused)
 		{
-			// ĊJ
+			// 再開する
 			CManager::GetSound()->ResumeAll();
 		}
 	}
 
-	// ubN}l[W[̍XV
+	// ブロックマネージャーの更新処理
 	m_pBlockManager->Update();
 
 	if (m_pPlayer)
 	{
-		// UI̍XV
+		// UIの更新
 		UIUpdate();
 	}
 
-	// EoUI̎擾
+	// 脱出UIの取得
 	auto escape_xinput = CUIManager::GetInstance()->GetUI("Escape_XInput");
 	auto escape_keyboard = CUIManager::GetInstance()->GetUI("Escape_Keyboard");
 
-	// 
+	// 音発生数
 	int count = 0;
 
-	// 
+	// 発見数
 	int insightCount = 0;
 
-	// --- EomF ---
+	// --- 脱出したか確認 ---
 	auto exitBlocks = CBlockManager::GetBlocksOfType<CExitBlock>();
 
 	for (CExitBlock* exit : exitBlocks)
 	{
 		if (pFade->GetFade() == CFade::FADE_NONE && exit->IsEscape())
 		{
-			// ̊l̎擾
+			// 宝の獲得数の取得
 			int treasureCount = CBuriedTreasureBlock::GetTreasureCount();
 
-			// LOɓo^
+			// ランキングに登録
 			//m_pRankingManager->AddRecordWithLimit(3, 0, m_pTime->GetMinutes(), m_pTime->GetnSeconds());
 			m_pRankingManager->AddItemRecord(treasureCount);
 
-			// ʂ̃CfbNX擾
+			// 順位のインデックスを取得
 			int rankIndex = m_pRankingManager->GetRankIdx();
 
-			// UgɃZbg
-			CResult::SetClearRank(rankIndex);// Aj[Vpɏʂ̃CfbNXn
+			// リザルトにセット
+			CResult::SetClearRank(rankIndex);// アニメーション用に順位のインデックスを渡す
 			//CResult::SetClearTime(m_pTime->GetMinutes(), m_pTime->GetnSeconds());
 
 			if (m_pEnemy)
 			{
-				// ̎擾
+				// 音発生数の取得
 				count = m_pEnemy->GetSoundCount();
 
-				// ̎擾
+				// 発見数の取得
 				insightCount = m_pEnemy->GetInsightCount();
 			}
 
-			// ̊l̐ݒ
+			// 宝の獲得数の設定
 			CResult::SetTreasureCount(treasureCount);
 
-			// ̐ݒ
+			// 音発生数の設定
 			CResult::SetSoundCount(count);
 
-			// ̐ݒ
+			// 発見数の設定
 			CResult::SetInsightCount(insightCount);
 
-			// UgʂɈڍs
+			// リザルト画面に移行
 			pFade->SetFade(MODE_RESULT);
 		}
 
-		// ͈͓̂Ƃ
+		// 範囲内のとき
 		if (exit->IsIn())
 		{
-			// ̓foCXɉUI؂ւ
+			// 入力デバイスに応じてUIを切り替える
 			if (pJoypad->GetAnyTrigger() || pJoypad->GetStick())
 			{
-				// \
+				// 表示
 				escape_keyboard->Hide();
 				escape_xinput->Show();
 			}
 			else if (pKeyboard->GetAnyKeyTrigger())
 			{
-				// \
+				// 表示
 				escape_xinput->Hide();
 				escape_keyboard->Show();
 			}
 		}
 		else
 		{
-			// \
+			// 非表示
 			escape_xinput->Hide();
 			escape_keyboard->Hide();
 		}
@@ -372,75 +383,75 @@ void CGame::Update(void)
 
 	if (pFade->GetFade() == CFade::FADE_NONE && pInputKeyboard->GetTrigger(DIK_RETURN))
 	{
-		// ̊l̎擾
+		// 宝の獲得数の取得
 		int treasureCount = CBuriedTreasureBlock::GetTreasureCount();
 
-		// LOɓo^
+		// ランキングに登録
 		//m_pRankingManager->AddRecordWithLimit(3, 0, m_pTime->GetMinutes(), m_pTime->GetnSeconds());
 		m_pRankingManager->AddItemRecord(treasureCount);
 
-		// ʂ̃CfbNX擾
+		// 順位のインデックスを取得
 		int rankIndex = m_pRankingManager->GetRankIdx();
 
-		// UgɃZbg
-		CResult::SetClearRank(rankIndex);// Aj[Vpɏʂ̃CfbNXn
+		// リザルトにセット
+		CResult::SetClearRank(rankIndex);// アニメーション用に順位のインデックスを渡す
 		//CResult::SetClearTime(m_pTime->GetMinutes(), m_pTime->GetnSeconds());
 
 		if (m_pEnemy)
 		{
-			// ̎擾
+			// 音発生数の取得
 			count = m_pEnemy->GetSoundCount();
 
-			// ̎擾
+			// 発見数の取得
 			insightCount = m_pEnemy->GetInsightCount();
 		}
 
-		// ̊l̐ݒ
+		// 宝の獲得数の設定
 		CResult::SetTreasureCount(treasureCount);
 
-		// ̐ݒ
+		// 音発生数の設定
 		CResult::SetSoundCount(count);
 
-		// ̐ݒ
+		// 発見数の設定
 		CResult::SetInsightCount(insightCount);
 
-		// UgʂɈڍs
+		// リザルト画面に移行
 		pFade->SetFade(MODE_RESULT);
 	}
 #endif
 }
 //=============================================================================
-// CgXV
+// ライト更新処理
 //=============================================================================
 void CGame::UpdateLight(void)
 {
-	float progress = m_pTime->GetProgress(); // 0.0`0.1
+	float progress = m_pTime->GetProgress(); // 0.0～0.1
 
-	// ======== eԑт̃CCgF ========
-	D3DXCOLOR evening(1.0f, 0.65f, 0.35f, 1.0f); // [
-	D3DXCOLOR night(0.15f, 0.18f, 0.35f, 1.0f);  // 
-	D3DXCOLOR morning(0.95f, 0.8f, 0.7f, 1.0f);  // 
+	// ======== 各時間帯のメインライト色 ========
+	D3DXCOLOR evening(1.0f, 0.65f, 0.35f, 1.0f); // 夕方
+	D3DXCOLOR night(0.15f, 0.18f, 0.35f, 1.0f);  // 夜
+	D3DXCOLOR morning(0.95f, 0.8f, 0.7f, 1.0f);  // 明け方
 
 	D3DXCOLOR mainColor;
 
-	// ======== ԑтƂɕ ========
+	// ======== 時間帯ごとに補間 ========
 	if (progress < CTime::NIGHT_START_RATE)
-	{// [
+	{// 夕方
 		float t = progress / CTime::NIGHT_START_RATE;
 		D3DXColorLerp(&mainColor, &evening, &night, t);
 	}
 	else if (progress < CTime::NIGHT_END_RATE)
-	{// 
+	{// 夜
 		float t = (progress - CTime::NIGHT_START_RATE) / (CTime::NIGHT_END_RATE - CTime::NIGHT_START_RATE);
 		D3DXColorLerp(&mainColor, &night, &morning, t);
 	}
 	else
-	{// 
+	{// 明け方
 		float t = (progress - CTime::NIGHT_END_RATE) / (1.0f - CTime::NIGHT_END_RATE);
 		D3DXColorLerp(&mainColor, &morning, &evening, t);
 	}
 
-	// ======== ̌ ========
+	// ======== 光の向き補間 ========
 	D3DXVECTOR3 dirEvening(0.5f, -1.0f, 0.3f);
 	D3DXVECTOR3 dirNight(0.0f, -1.0f, 0.0f);
 	D3DXVECTOR3 dirMorning(-0.3f, -1.0f, -0.2f);
@@ -458,20 +469,10 @@ void CGame::UpdateLight(void)
 	}
 	D3DXVec3Normalize(&mainDir, &mainDir);
 
-	// Đݒ
-	CLight::Uninit();
-
-	m_pBlockManager->UpdateLight();
-
-	// CCg
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		mainColor,
-		mainDir,
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
+	// メインライト
+	SetGameLight(LIGHT_MAIN, mainColor, mainDir, D3DXVECTOR3(0.0f, 300.0f, 0.0f));
 
-	// TuCg
+	// サブライト
 	D3DXCOLOR skyEvening(0.4f, 0.45f, 0.8f, 1.0f);
 	D3DXCOLOR skyNight(0.1f, 0.15f, 0.3f, 1.0f);
 	D3DXCOLOR skyMorning(0.6f, 0.7f, 1.0f, 1.0f);
@@ -486,49 +487,61 @@ void CGame::UpdateLight(void)
 		D3DXColorLerp(&skyColor, &skyNight, &skyMorning, (progress - 0.5f) / 0.5f);
 	}
 
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		skyColor,
-		D3DXVECTOR3(0.0f, -1.0f, 0.0f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
+	SetGameLight(LIGHT_SKY, skyColor, D3DXVECTOR3(0.0f, -1.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 
-	// ⏕
+	// 補助光
 	float warmFactor = 1.0f - fabs(progress - 0.5f) * 2.0f;
 	warmFactor = std::max(0.0f, warmFactor);
 
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.5f + 0.2f * warmFactor, 0.3f, 0.25f, 1.0f),
-		D3DXVECTOR3(-0.3f, 0.0f, -0.7f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
+	SetGameLight(LIGHT_FILL, D3DXCOLOR(0.5f + 0.2f * warmFactor, 0.3f, 0.25f, 1.0f),
+		D3DXVECTOR3(-0.3f, 0.0f, -0.7f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 登録した世代を覚えておく
+	m_nLightGeneration = CLight::GetGeneration();
+
+	// 灯籠などのライトの更新
+	m_pBlockManager->UpdateLight();
+}
+//=============================================================================
+// ゲームライトの設定処理(登録は1回だけ行い、以降は色と向きだけ書き換える)
+//=============================================================================
+void CGame::SetGameLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos)
+{
+	// ライトが作り直されていたら登録し直す
+	if (m_anLight[light] < 0 || m_nLightGeneration != CLight::GetGeneration())
+	{
+		m_anLight[light] = CLight::AddLight(D3DLIGHT_DIRECTIONAL, col, dir, pos);
+		return;
+	}
+
+	CLight::SetLightDiffuse(m_anLight[light], col);
+	CLight::SetLightDirection(m_anLight[light], dir);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CGame::Draw(void)
 {
 #ifdef _DEBUG
-	// Obh̕`
+	// グリッドの描画
 	m_pGrid->Draw();
 #endif
-	// |[Y
+	// ポーズ中だったら
 	if (m_isPaused)
 	{
-		// |[Y}l[W[̕`揈
+		// ポーズマネージャーの描画処理
 		m_pPauseManager->Draw();
 	}
 }
 //=============================================================================
-// UI̍XV
+// UIの更新処理
 //=============================================================================
 void CGame::UIUpdate(void)
 {
-	// tF[h̎擾
+	// フェードの取得
 	CFade* pFade = CManager::GetFade();
 
-	// UI̎擾
+	// UIの取得
 	auto rule = CUIManager::GetInstance()->GetUI("Rule");
 	auto mission_failure = CUIManager::GetInstance()->GetUI("MissionFailure");
 
@@ -539,20 +552,20 @@ void CGame::UIUpdate(void)
 
 		if (m_stateTimer <= 0.0f)
 		{
-			// ̎擾
+			// 音の取得
 			CSound* pSound = CManager::GetSound();
 
-			// JnSE̍Đ
+			// 開始SEの再生
 			if (pSound)
 			{
 				pSound->Play(CSound::SOUND_LABEL_START);
 			}
 
-			// UI\
+			// UI表示
 			rule->Show();
 
 			m_startState = StartState::Hidden;
-			m_stateTimer = 180;  // UI\
+			m_stateTimer = 180;  // UI表示時間
 		}
 		break;
 
@@ -561,14 +574,14 @@ void CGame::UIUpdate(void)
 
 		if (m_stateTimer <= 0.0f)
 		{
-			// UI\
+			// UI非表示
 			rule->FadeOut(60.0f);
 
-			// tOtrueɂ
+			// 操作フラグをtrueにする
 			m_pPlayer->SetControlFlag(true);
 			m_pEnemy->SetControlFlag(true);
 
-			// ^C}[Jn
+			// タイマーも開始
 			m_pTime->SetActiveFlag(true);
 
 			m_startState = StartState::Idle;
@@ -577,36 +590,36 @@ void CGame::UIUpdate(void)
 
 	case StartState::Idle:
 
-		// ^CAbv܂̓vC[񂾂
+		// タイムアップまたはプレイヤーが死んだら
 		if (m_pTime->IsTimeUp() || m_pPlayer->IsDead())
 		{
-			// ^CAbvɎSɂ
+			// タイムアップ時に死亡判定にする
 			m_pPlayer->SetIsDead(true);
 
 			m_stateTimer = 120;
 			m_startState = StartState::Failure;
 		}
 		break;
-	case StartState::Failure:// s
+	case StartState::Failure:// 失敗時
 		m_stateTimer--;
 
 		if (m_stateTimer <= 0.0f)
 		{
 			m_stateTimer = 180;
 
-			// UI\
+			// UI表示
 			mission_failure->FadeIn(120.0f);
 
 			m_startState = StartState::WaitEnd;
 		}
 
 		break;
-	case StartState::WaitEnd:// I܂ł̑ҋ@
+	case StartState::WaitEnd:// 終了までの待機時間
 		m_stateTimer--;
 
 		if (pFade->GetFade() == CFade::FADE_NONE && m_stateTimer <= 0.0f)
 		{
-			// ^CgʂɈڍs
+			// タイトル画面に移行
 			pFade->SetFade(MODE_TITLE);
 		}
 
@@ -614,15 +627,15 @@ void CGame::UIUpdate(void)
 	}
 }
 //=============================================================================
-// foCXZbgʒm
+// デバイスリセット通知
 //=============================================================================
 void CGame::OnDeviceReset(void)
 {
-	// Q[Cg̍XV
+	// ゲームライトの更新処理
 	UpdateLight();
 }
 //=============================================================================
-// |[Y̐ݒ
+// ポーズの設定
 //=============================================================================
 void CGame::SetEnablePause(bool bPause)
 {
@@ -630,27 +643,27 @@ void CGame::SetEnablePause(bool bPause)
 
 	if (bPause)
 	{
-		// ꎞ~
+		// 音を一時停止
 		CManager::GetSound()->PauseAll();
 	}
 	else
 	{
-		// ĊJ
+		// 音を再開
 		CManager::GetSound()->ResumeAll();
 	}
 }
 //=============================================================================
-// TlC[Xʒm
+// サムネイルリリース通知
 //=============================================================================
 void CGame::ReleaseThumbnail(void)
 {
 	m_pBlockManager->ReleaseThumbnailRenderTarget();
 }
 //=============================================================================
-// TlCZbgʒm
+// サムネイルリセット通知
 //=============================================================================
 void CGame::ResetThumbnail(void)
 {
 	m_pBlockManager->InitThumbnailRenderTarget(CManager::GetRenderer()->GetDevice());
-	m_pBlockManager->GenerateThumbnailsForResources(); // LbVč쐬
+	m_pBlockManager->GenerateThumbnailsForResources(); // キャッシュも再作成
 }
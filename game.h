@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// Q[ [game.h]
+// ゲーム処理 [game.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _GAME_H_// ̃}N`ĂȂ
-#define _GAME_H_// 2dCN[hh~̃}N`
+#ifndef _GAME_H_// このマクロ定義がされていなかったら
+#define _GAME_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 #include "blockmanager.h"
@@ -16,7 +16,7 @@
 #include "rankingmanager.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CPlayer;
 class CEnemy;
@@ -25,7 +25,7 @@ class CGrid;
 class CLight;
 
 //*****************************************************************************
-// Q[NX
+// ゲームクラス
 //*****************************************************************************
 class CGame : public CScene
 {
@@ -35,11 +35,11 @@ public:
 
 	enum StartState
 	{
-		WaitStart,      // ҂
-		Hidden,			// UI\
-		Idle,			// AChO
-		Failure,		// s
-		WaitEnd,		// I܂ł̑ҋ@
+		WaitStart,      // 少し待つ
+		Hidden,			// UI非表示
+		Idle,			// アイドリング
+		Failure,		// 失敗時
+		WaitEnd,		// 終了までの待機
 	};
 
 	HRESULT Init(void);
@@ -60,24 +60,37 @@ public:
 	static int GetSeed(void) { return m_nSeed; }
 
 private:
-	static constexpr int WAIT_TIME			= 190;			// ̑ҋ@
-	static constexpr int NUM_SUB_ENEMIES	= 30;			// TuG̐
-	static constexpr int BLOSSOM_INTERVAL	= 15;			// ̐C^[o
+	static constexpr int WAIT_TIME			= 190;			// 初回の待機時間
+	static constexpr int NUM_SUB_ENEMIES	= 30;			// サブ敵の生成数
+	static constexpr int BLOSSOM_INTERVAL	= 15;			// 桜の生成インターバル
 
-	std::unique_ptr<CRankingManager> m_pRankingManager;		// LOւ̃|C^
-	CPlayer*						 m_pPlayer;				// vC[ւ̃|C^
-	CEnemy*							 m_pEnemy;				// Gւ̃|C^
-	static CTime*					 m_pTime;				// ^Cւ̃|C^
-	static CBlockManager*			 m_pBlockManager;		// ubN}l[W[ւ̃|C^
-	static CPauseManager*			 m_pPauseManager;		// |[Y}l[W[ւ̃|C^
-	std::unique_ptr<CGrid>			 m_pGrid;				// Obhւ̃|C^
-	static bool						 m_isPaused;			// |[YtO
-	static int						 m_nSeed;				// }bṽV[hl
-	CLight*							 m_pLight;				// Cgւ̃|C^
-	int								 m_timer;				// p[eBN^C}[
-	StartState						 m_startState;			// UȈ
-	float							 m_stateTimer;			// UIx^C}[
-	bool							 m_canControl;			// \tO
+	// ゲーム中ずっと使うライト
+	typedef enum
+	{
+		LIGHT_MAIN = 0,	// メインライト
+		LIGHT_SKY,		// サブライト
+		LIGHT_FILL,		// 補助光
+		LIGHT_MAX
+	}LIGHT;
+
+	void SetGameLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos);
+
+	std::unique_ptr<CRankingManager> m_pRankingManager;		// ランキングへのポインタ
+	CPlayer*						 m_pPlayer;				// プレイヤーへのポインタ
+	CEnemy*							 m_pEnemy;				// 敵へのポインタ
+	static CTime*					 m_pTime;				// タイムへのポインタ
+	static CBlockManager*			 m_pBlockManager;		// ブロックマネージャーへのポインタ
+	static CPauseManager*			 m_pPauseManager;		// ポーズマネージャーへのポインタ
+	std::unique_ptr<CGrid>			 m_pGrid;				// グリッドへのポインタ
+	static bool						 m_isPaused;			// ポーズ中フラグ
+	static int						 m_nSeed;				// マップのシード値
+	CLight*							 m_pLight;				// ライトへのポインタ
+	int								 m_anLight[LIGHT_MAX];	// 登録したライトの番号
+	unsigned int					 m_nLightGeneration;	// 登録した時のライトの世代
+	int								 m_timer;				// パーティクル生成タイマー
+	StartState						 m_startState;			// UIの状態
+	float							 m_stateTimer;			// UI遅延タイマー
+	bool							 m_canControl;			// 操作可能フラグ
 };
 
 #endif
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// }bv [generateMap.h]
+// マップ生成処理 [generateMap.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,19 +8,19 @@
 #define _GENERATEMAP_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CBlock;
 class CMeshField;
 class CWaterField;
 
 //*****************************************************************************
-// }bvWFl[^[NX
+// マップジェネレータークラス
 //*****************************************************************************
 class CGenerateMap
 {
@@ -28,21 +28,21 @@ public:
     CGenerateMap() {}
     ~CGenerateMap() {}
 
-    // CX^X
+    // インスタンス生成
     static CGenerateMap* GetInstance(void);
 
-    // XgNA
+    // リストクリア処理
     void Uninit(void)
     {
-        // Xg̃NA
+        // リストのクリア
         m_patrolPoints.clear();
         m_treasurePositions.clear();
     }
 
-    // }bv_(W)
+    // マップランダム生成処理(集約)
     void GenerateRandomMap(int seed);
 
-    // n`_
+    // 地形ランダム生成
     void GenerateRandomTerrain(int seed);
 
     void GenerateClusters(int gridX, int gridZ, float areaSize,
@@ -60,10 +60,10 @@ public:
     void ApplyRandomGrassTransform(CBlock* block);
     void GenerateOuterGrassBelt(int gridX, int gridZ, float areaSize, float offsetX, float offsetZ);
     void GeneratePatrolPoints(
-        const D3DXVECTOR3& origin,   // S_
-        float gap,                   // |CgԂ̋
-        const std::vector<D3DXVECTOR3>& obstaclePositions, // ĂQ
-        float safeDistance,          // Q̍ŏ
+        const D3DXVECTOR3& origin,   // 中心点
+        float gap,                   // ポイント間の距離
+        const std::vector<D3DXVECTOR3>& obstaclePositions, // 灯籠や障害物
+        float safeDistance,          // 障害物からの最小距離
         std::vector<D3DXVECTOR3>& outPatrolPoints);
     void OnTreasureCollected(const D3DXVECTOR3& pos);
 
@@ -74,94 +74,94 @@ public:
     CWaterField* GetWaterField(void) { return m_pWater; }
     
 private:
-    // Obhp[^
-    static constexpr int   GRID_X               = 10;       // XTCY
-    static constexpr int   GRID_Z               = 10;       // ZTCY
-    static constexpr float AREA_SIZE            = 80.0f;    // 1GA̍L
-
-     // n`
-    static constexpr float MAP_SIZE_X           = 800.0f;   // TCYX
-    static constexpr float MAP_SIZE_Z           = 800.0f;   // TCYZ
-    static constexpr int   MAP_DIV_X            = 100;      // X
-    static constexpr int   MAP_DIV_Z            = 100;      // Z
-
-    // 
-    static constexpr float WATER_HEIGHT         = -4.0f;    // ʂ̍
-    static constexpr int   WATER_DIV_X          = 10;       // X
-    static constexpr int   WATER_DIV_Z          = 10;       // Z
-
-    // 
-    static constexpr int   MAX_TORCH            = 2;        // Ă̐ݒu
-    static constexpr float TORCH_OFFSET_HEIGHT  = 38.0f;    // Ă̍̃ItZbg
+    // グリッド生成パラメータ
+    static constexpr int   GRID_X               = 10;       // Xサイズ
+    static constexpr int   GRID_Z               = 10;       // Zサイズ
+    static constexpr float AREA_SIZE            = 80.0f;    // 1エリアの広さ
+
+     // 地形
+    static constexpr float MAP_SIZE_X           = 800.0f;   // サイズX
+    static constexpr float MAP_SIZE_Z           = 800.0f;   // サイズZ
+    static constexpr int   MAP_DIV_X            = 100;      // 分割数X
+    static constexpr int   MAP_DIV_Z            = 100;      // 分割数Z
+
+    // 水面
+    static constexpr float WATER_HEIGHT         = -4.0f;    // 水面の高さ
+    static constexpr int   WATER_DIV_X          = 10;       // 分割数X
+    static constexpr int   WATER_DIV_Z          = 10;       // 分割数Z
+
+    // 灯籠
+    static constexpr int   MAX_TORCH            = 2;        // 灯籠の設置数
+    static constexpr float TORCH_OFFSET_HEIGHT  = 38.0f;    // 灯籠の高さのオフセット
     static constexpr float TORCH_INWARD_RATE    = 0.5f;
     static constexpr float TORCH_VARIATION_RATE = 0.6f;
-    static constexpr float TORCH_FRONT_X_RATE   = 3.0f;     // ӂXS␳
-    static constexpr float TORCH_SIDE_Z_RATE    = 0.8f;     // EӂZS␳
+    static constexpr float TORCH_FRONT_X_RATE   = 3.0f;     // 下辺のX中心補正
+    static constexpr float TORCH_SIDE_Z_RATE    = 0.8f;     // 左右辺のZ中心補正
 
-    // Ă̔zuӂ̎
+    // 灯籠の配置する辺の種類
     enum TorchSide
     {
-        TORCH_BOTTOM    = 0,// 
-        TORCH_LEFT      = 1,// 
-        TORCH_RIGHT     = 2,// E
+        TORCH_BOTTOM    = 0,// 下
+        TORCH_LEFT      = 1,// 左
+        TORCH_RIGHT     = 2,// 右
     };
 
-    // ij
-    static constexpr float TREASURE_CLUSTER_MIN_DIST_RATE   = 0.4f;// Œ዗
-    static constexpr float TREASURE_NORMAL_MIN_DIST_RATE    = 2.0f;// Œ዗
+    // 埋蔵金（距離）
+    static constexpr float TREASURE_CLUSTER_MIN_DIST_RATE   = 0.4f;// 最低距離
+    static constexpr float TREASURE_NORMAL_MIN_DIST_RATE    = 2.0f;// 離す最低距離
 
-    // iNX^j
-    static constexpr int   TREASURE_CLUSTER_MIN             = 3;    // Œ̃NX^[
-    static constexpr int   TREASURE_CLUSTER_MAX             = 4;    // ő̃NX^[
-    static constexpr float TREASURE_CLUSTER_RADIUS_RATE     = 0.8f; // NX^[̔å
+    // 埋蔵金（クラスタ）
+    static constexpr int   TREASURE_CLUSTER_MIN             = 3;    // 最低のクラスター数
+    static constexpr int   TREASURE_CLUSTER_MAX             = 4;    // 最大のクラスター数
+    static constexpr float TREASURE_CLUSTER_RADIUS_RATE     = 0.8f; // クラスターの半径の割合
 
-    // 
-    static constexpr float GRASS_SCALE_X_MIN        = 1.5f;         // ̃XP[X̍Œl
-    static constexpr float GRASS_SCALE_X_VAR        = 0.8f;         // ̃XP[X̊
-    static constexpr float GRASS_SCALE_Y_MIN        = 1.3f;         // ̃XP[Y̍Œl
-    static constexpr float GRASS_SCALE_Y_VAR        = 0.3f;         // ̃XP[Y̊
-    static constexpr int   GRASS_SET_NUM            = 3;			// ̊{̐ݒu
-    static constexpr int   GRASS_SET_NUM_VAL        = 3;            // ̑ő吔
-    static constexpr float INWARD_OFFSET_RATE       = 0.2f;         // OǂꂾɊ񂹂邩
-    static constexpr int   MIN_CLUSTER_PER_CELL     = 2;            // 1Z̑NX^[
-    static constexpr int   CLUSTER_PER_CELL_RANGE   = 3;            // 1Z̑NX^[̑ő吔
+    // 草
+    static constexpr float GRASS_SCALE_X_MIN        = 1.5f;         // 草のスケールXの最低値
+    static constexpr float GRASS_SCALE_X_VAR        = 0.8f;         // 草のスケールXの割合
+    static constexpr float GRASS_SCALE_Y_MIN        = 1.3f;         // 草のスケールYの最低値
+    static constexpr float GRASS_SCALE_Y_VAR        = 0.3f;         // 草のスケールYの割合
+    static constexpr int   GRASS_SET_NUM            = 3;			// 草の基本の設置数
+    static constexpr int   GRASS_SET_NUM_VAL        = 3;            // 草の増える最大数
+    static constexpr float INWARD_OFFSET_RATE       = 0.2f;         // 外周からどれだけ内側に寄せるか
+    static constexpr int   MIN_CLUSTER_PER_CELL     = 2;            // 1セルあたりの草クラスター数
+    static constexpr int   CLUSTER_PER_CELL_RANGE   = 3;            // 1セルあたりの草クラスター数の増える最大数
 
 
-    // 𐶐ӂ̎
+    // 草を生成する辺の種類
     enum GrassSide
     {
-        GRASS_BOTTOM    = 0,   // 
-        GRASS_TOP       = 1,   // 
-        GRASS_LEFT      = 2,   // 
-        GRASS_RIGHT     = 3,   // E
+        GRASS_BOTTOM    = 0,   // 下
+        GRASS_TOP       = 1,   // 上
+        GRASS_LEFT      = 2,   // 左
+        GRASS_RIGHT     = 3,   // 右
         GRASS_MAX
     };
 
-    // |Cg
-    static constexpr float PATROL_GAP           = 210.0f;   // |CgԂ̊Ԋu
-    static constexpr float PATROL_SAFE_DISTANCE = 120.0f;   // zu\
-    static constexpr int   PATROL_POINT_X       = 3;        // |CgX̐
-    static constexpr int   PATROL_POINT_Z       = 3;        // |CgZ̐
+    // 巡回ポイント
+    static constexpr float PATROL_GAP           = 210.0f;   // ポイント間の間隔
+    static constexpr float PATROL_SAFE_DISTANCE = 120.0f;   // 配置可能距離
+    static constexpr int   PATROL_POINT_X       = 3;        // 巡回ポイントのX方向の数
+    static constexpr int   PATROL_POINT_Z       = 3;        // 巡回ポイントのZ方向の数
 
-    static constexpr int   MAX_ATTEMPTS         = 50;       // s
-    static constexpr int   MAX_TREASURE         = 8;        // ̐ݒu
-    static constexpr int   CLUSTER_COUNT        = 10;       // NX^[
+    static constexpr int   MAX_ATTEMPTS         = 50;       // 試行回数
+    static constexpr int   MAX_TREASURE         = 8;        // 埋蔵金の設置数
+    static constexpr int   CLUSTER_COUNT        = 10;       // クラスター数
 
-     // NX^
-    static constexpr float CLUSTER_RADIUS_MIN   = 50.0f;    // NX^[̍Œᔼa
-    static constexpr int   CLUSTER_RADIUS_VAR   = 80;       // NX^[̔å
-    static constexpr int   CLUSTER_ELEMENT_MIN  = 8;        // vf̍Œᐔ
-    static constexpr int   CLUSTER_ELEMENT_VAR  = 3;        // vf̒ǉ̍ő吔
+     // クラスタ生成
+    static constexpr float CLUSTER_RADIUS_MIN   = 50.0f;    // クラスターの最低半径
+    static constexpr int   CLUSTER_RADIUS_VAR   = 80;       // クラスターの半径の割合
+    static constexpr int   CLUSTER_ELEMENT_MIN  = 8;        // 要素の最低数
+    static constexpr int   CLUSTER_ELEMENT_VAR  = 3;        // 要素の追加の最大数
 
-    // }bvEESvZ
+    // マップ境界・中心計算
     static constexpr float HALF_RATE = 0.5f;
     static constexpr float OUTER_GRASS_THRESHOLD_RATE = 0.9f;
 
 private:
-    std::vector<D3DXVECTOR3> m_patrolPoints;                // |Cg
-    std::vector<D3DXVECTOR3> m_treasurePositions;           // ̐ݒu|Cg
-    CMeshField*              m_pMeshField;                  // bVtB[hւ̃|C^
-    CWaterField*             m_pWater;                      // tB[hւ̃|C^
+    std::vector<D3DXVECTOR3> m_patrolPoints;                // 巡回ポイント
+    std::vector<D3DXVECTOR3> m_treasurePositions;           // 埋蔵金の設置ポイント
+    CMeshField*              m_pMeshField;                  // メッシュフィールドへのポインタ
+    CWaterField*             m_pWater;                      // 水フィールドへのポインタ
 };
 
 #endif
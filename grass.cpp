@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// ubN [grass.cpp]
+// 草ブロック処理 [grass.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "grass.h"
 #include "manager.h"
@@ -15,55 +15,58 @@
 #include "enemy.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CGrassBlock::CGrassBlock(int nPriority) : CBlock(nPriority)
 {
-	// l̃NA
-	m_rotVel	= INIT_VEC3;	// X
-	m_distMax	= DIST_MAX;		// 苗
-	m_windTime	= 0.0f;			// ̗h^C}[
+	// 値のクリア
+	m_rotVel	= INIT_VEC3;	// 傾き
+	m_distMax	= DIST_MAX;		// 判定距離
+	m_windTime	= 0.0f;			// 草の揺れタイマー
+
+	// αテストあり・カリングなしで描画する
+	SetRenderPass(CRenderQueue::PASS_ALPHATEST_NOCULL);
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CGrassBlock::~CGrassBlock()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CGrassBlock::Update(void)
 {
-	// ubN̍XV
+	// ブロックの更新処理
 	CBlock::Update();
 
-	// ̈ʒu擾
+	// 草の位置を取得
 	D3DXVECTOR3 thisPos = GetPos();
-	float fMaxTilt = D3DXToRadian(MAX_ANG);// Xőpx
+	float fMaxTilt = D3DXToRadian(MAX_ANG);// 傾き最大角度
 
-	// Z
+	// 加算
 	m_windTime += WIND_SPEED;
 
 	float windX = sinf(m_windTime * WIND_FREQ) * WIND_AMP;
 	float windZ = cosf(m_windTime * WIND_FREQ * FREQ_RATE) * WIND_AMP;
 
 	//==================================
-	// ԋ߂L擾
+	// 一番近いキャラを取得
 	//==================================
 	float nearestDist = FLT_MAX;
 	D3DXVECTOR3 nearestDiff(0, 0, 0);
 
 	auto CheckNearest = [&](CCharacter* pChara)
 	{
-		// nullptȑꍇ͔΂
+		// nullptrの場合は飛ばす
 		if (!pChara)
 		{
 			return;
 		}
 
-		// ߂
+		// 距離を求める
 		D3DXVECTOR3 diff = pChara->GetPos() - thisPos;
 		float dist = D3DXVec3Length(&diff);
 
@@ -74,54 +77,54 @@ void CGrassBlock::Update(void)
 		}
 	};
 
-	// LN^[Ƃɋ`FbN
+	// キャラクターごとに距離をチェック
 	CheckNearest(CCharacterManager::GetInstance().GetCharacter<CPlayer>());
 	CheckNearest(CCharacterManager::GetInstance().GetCharacter<CEnemy>());
 
-	// ̌XvZ
+	// 草の傾き計算
 	D3DXVECTOR3 rot = GetRot();
 
 	if (nearestDist < m_distMax)
 	{
-		// K
+		// 正規化
 		D3DXVec3Normalize(&nearestDiff, &nearestDiff);
 		
-		// ɉ
+		// 距離に応じた割合
 		float t = 1.0f - (nearestDist / m_distMax);
 
-		// Xpx
+		// 傾き角度
 		float tilt = fMaxTilt * t;
 
 		rot.x = -nearestDiff.z * tilt;
 		rot.z = nearestDiff.x * tilt;
 	}
 
-	// ̗hZ
+	// 風の揺れを加算
 	rot.x += windX;
 	rot.z += windZ;
 
-	// ol
+	// バネ
 	m_rotVel.x += (-rot.x) * STIFFNESS;
 	m_rotVel.z += (-rot.z) * STIFFNESS;
 
-	// iRj
+	// 減衰（抵抗）
 	m_rotVel.x *= DAMPING;
 	m_rotVel.z *= DAMPING;
 
-	// ]ɔf
+	// 回転に反映
 	rot.x += m_rotVel.x;
 	rot.z += m_rotVel.z;
 
-	// ̐ݒ
+	// 向きの設定
 	SetRot(rot);
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// WCpbh̎擾
+	// ジョイパッドの取得
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// vC[̎擾
+	// プレイヤーの取得
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 	if (pPlayer)
@@ -129,30 +132,30 @@ void CGrassBlock::Update(void)
 		D3DXVECTOR3 diff = pPlayer->GetPos() - thisPos;
 		float dist = D3DXVec3Length(&diff);
 
-		// ɓ(苗߂Â)
+		// 草に入ったか(一定距離近づいたか)
 		const bool inGrass = (dist < m_distMax);
 		pPlayer->SetInGrass(dist < m_distMax);
 
-		// ĂȂ
+		// 入っていなかったら
 		if (!inGrass)
 		{
 			return;
 		}
 
-		// TEhnullptr
+		// サウンドがnullptrだったら
 		if (!pSound)
 		{
 			return;
 		}
 
-		// SE̍Đ
+		// 草SEの再生
 		if (pPlayer->GetMotion()->EventMotionRange(CPlayer::MOVE, 1, 9) ||
 			pPlayer->GetMotion()->EventMotionRange(CPlayer::INJURY, 1, 20))
 		{
 			pSound->StopByLabel(CSound::SOUND_LABEL_GRASS);
 			pSound->Play(CSound::SOUND_LABEL_GRASS);
 
-			// U
+			// 振動させる
 			pJoypad->SetVibration(10000, 10000, 10);
 		}
 		else if (pPlayer->GetMotion()->EventMotionRange(CPlayer::MOVE, 3, 9) ||
@@ -161,43 +164,8 @@ void CGrassBlock::Update(void)
 			pSound->StopByLabel(CSound::SOUND_LABEL_GRASS);
 			pSound->Play(CSound::SOUND_LABEL_GRASS);
 
-			// U
+			// 振動させる
 			pJoypad->SetVibration(10000, 10000, 10);
 		}
 	}
-}
-//=============================================================================
-// `揈
-//=============================================================================
-void CGrassBlock::Draw(void)
-{
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// ufBOZɐݒ
-	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
-	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
-	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
-
-	// eXgL
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);//ftHgfalse
-	pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
-	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);//0傫`
-
-	// JOݒ𖳌
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
-
-	// ubN̕`
-	CBlock::Draw();
-
-	// JOݒL
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
-
-	// eXg𖳌ɖ߂
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);//ftHgfalse
-
-	// ufBOɖ߂
-	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
-	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
-	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
 }
\ No newline at end of file
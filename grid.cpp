@@ -1,57 +1,57 @@
 //=============================================================================
 //
-// Obh [grid.cpp]
+// グリッド処理 [grid.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "grid.h"
 #include "manager.h"
 
-// Ostd̎gp
+// 名前空間stdの使用
 using namespace std;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CGrid::CGrid()
 {
-	// l̃NA
-    m_mtxWorld  = {};   // [h}gbNX
-    m_vertices  = {};   // _
-    m_size      = 0;    // a
-    m_spacing   = 0.0f; // }XԊu
+	// 値のクリア
+    m_mtxWorld  = {};   // ワールドマトリックス
+    m_vertices  = {};   // 頂点
+    m_size      = 0;    // 半径
+    m_spacing   = 0.0f; // マス間隔
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CGrid::~CGrid()
 {
-	// Xg̃NA
+	// リストのクリア
 	m_vertices.clear();
 }
 //=============================================================================
-// j[N|C^̐
+// ユニークポインタの生成
 //=============================================================================
 std::unique_ptr<CGrid> CGrid::Create(void)
 {
     return make_unique<CGrid>();
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CGrid::Init(void)
 {
 	m_size      = SIZE;
 	m_spacing   = SPACING;
 
-	// Xg̃NA
+	// リストのクリア
 	m_vertices.clear();
 
-    // X̐
+    // X軸方向の線
     for (int nCnt = -m_size; nCnt <= m_size; nCnt++)
     {
         AddLine(D3DXVECTOR3(-m_size * m_spacing, 0, nCnt * m_spacing), 
@@ -59,7 +59,7 @@ HRESULT CGrid::Init(void)
             D3DCOLOR_XRGB(128,128,128));
     }
 
-    // Z̐
+    // Z軸方向の線
     for (int nCnt = -m_size; nCnt <= m_size; nCnt++)
     {
         AddLine(D3DXVECTOR3(nCnt * m_spacing, 0, -m_size * m_spacing), 
@@ -67,42 +67,42 @@ HRESULT CGrid::Init(void)
             D3DCOLOR_XRGB(128,128,128));
     }
 
-    // }js[^̕`
-    AddLine(D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(150, 0, 0), D3DCOLOR_XRGB(255, 0, 0));// X
-    AddLine(D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(0, 150, 0), D3DCOLOR_XRGB(0, 255, 0));// Y
-    AddLine(D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(0, 0, 150), D3DCOLOR_XRGB(0, 0, 255));// Z
+    // マニピュレータの描画
+    AddLine(D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(150, 0, 0), D3DCOLOR_XRGB(255, 0, 0));// X軸
+    AddLine(D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(0, 150, 0), D3DCOLOR_XRGB(0, 255, 0));// Y軸
+    AddLine(D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(0, 0, 150), D3DCOLOR_XRGB(0, 0, 255));// Z軸
 
 	return S_OK;
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CGrid::Draw(void)
 {
-    // foCX̎擾
+    // デバイスの取得
     LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// [h}gbNXݒ
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-    pDevice->SetRenderState(D3DRS_LIGHTING, FALSE); // CeBO
+    pDevice->SetRenderState(D3DRS_LIGHTING, FALSE); // ライティング無効
 
-    // _tH[}bg̐ݒ
+    // 頂点フォーマットの設定
     pDevice->SetFVF(D3DFVF_XYZ | D3DFVF_DIFFUSE);
 
-    // eNX`̐ݒ
+    // テクスチャの設定
     pDevice->SetTexture(0, nullptr);
 
-    // `
+    // 描画
     pDevice->DrawPrimitiveUP(D3DPT_LINELIST, m_vertices.size() / 2, m_vertices.data(), sizeof(CUSTOMVERTEX));
 
-    pDevice->SetRenderState(D3DRS_LIGHTING, TRUE); // CeBO߂
+    pDevice->SetRenderState(D3DRS_LIGHTING, TRUE); // ライティングを戻す
 }
 //=============================================================================
-// Cǉ
+// ライン追加処理
 //=============================================================================
 void CGrid::AddLine(const D3DXVECTOR3& p1, const D3DXVECTOR3& p2, D3DCOLOR col)
 {
@@ -1,74 +1,74 @@
 //=============================================================================
 //
-// Q[W [guage.cpp]
+// ゲージ処理 [guage.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "guage.h"
 #include "manager.h"
 #include "charactermanager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CGuage::CGuage()
 {
-	// l̃NA
-	m_nIdxTexture	= 0;			// eNX`CfbNX
-	m_type			= TYPE_NONE;	// Q[W̎
-	m_targetRate	= 0.0f;			// ۂHP
-	m_currentRate	= 0.0f;			// \pQ[WiǏ]pj
-	m_speed			= 0.0f;			// Ǐ]x
-	m_delayTimer	= 0;			// x^C}[(obNQ[Wp)
-	m_pTargetChar	= nullptr;		// ̃Q[WǏ]LN^[
+	// 値のクリア
+	m_nIdxTexture	= -1;			// テクスチャインデックス
+	m_type			= TYPE_NONE;	// ゲージの種類
+	m_targetRate	= 0.0f;			// 実際のHP割合
+	m_currentRate	= 0.0f;			// 表示用ゲージ割合（追従用）
+	m_speed			= 0.0f;			// 追従速度
+	m_delayTimer	= 0;			// 遅延タイマー(バックゲージ用)
+	m_pTargetChar	= nullptr;		// このゲージが追従するキャラクター
 }
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CGuage::~CGuage()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CGuage* CGuage::Create(GUAGETYPE type, D3DXVECTOR3 pos, float fWidth, float fHeight)
 {
 	CGuage* pGuage = new CGuage;
 
-	// nullptr
+	// nullptrだったら
 	if (pGuage == nullptr)
 	{
 		return nullptr;
 	}
 
-	// ݒ
+	// 設定
 	pGuage->SetPos(pos);
 	pGuage->SetSize(fWidth, fHeight);
 	pGuage->m_type = type;
 
 	if (type == TYPE_GUAGE)
-	{// Q[W͗
+	{// ゲージは緑
 		pGuage->SetCol(D3DXCOLOR(0.0f, 1.0f, 0.0f, 1.0f));
 	}
 	else if (type == TYPE_BACKGUAGE)
-	{// obNQ[W͐
+	{// バックゲージは赤
 		pGuage->SetCol(D3DXCOLOR(1.0f, 0.0f, 0.0f, 1.0f));
 	}
 	else if (type == TYPE_FRAME)
-	{// t[̓eNX`̐FĝŔ
+	{// フレームはテクスチャの色を使うので白
 		pGuage->SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f));
 	}
 
 	pGuage->m_targetRate = 1.0f;
 	pGuage->m_currentRate = 1.0f;
-	pGuage->m_speed = 0.005f; // Ǐ]x
+	pGuage->m_speed = 0.005f; // 追従速度
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pGuage->Init()))
 	{
 		return nullptr;
@@ -77,31 +77,35 @@ CGuage* CGuage::Create(GUAGETYPE type, D3DXVECTOR3 pos, float fWidth, float fHei
 	return pGuage;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CGuage::Init(void)
 {
 	if (m_type == TYPE_FRAME)
 	{
-		// eNX`ݒ
+		// テクスチャ設定
 		m_nIdxTexture = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/HpFrame.png");
 	}
 
-	// 2DIuWFNg̏
+	// 2Dオブジェクトの初期化処理
 	CObject2D::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CGuage::Uninit(void)
 {
-	// 2DIuWFNg̏I
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
+
+	// 2Dオブジェクトの終了処理
 	CObject2D::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CGuage::Update(void)
 {
@@ -116,12 +120,12 @@ void CGuage::Update(void)
 
 	if (m_type == TYPE_GUAGE)
 	{
-		// _WXV
+		// 頂点座標を更新
 		UpdateGuageVtx(fRate);
 	}
 	else if (m_type == TYPE_BACKGUAGE)
 	{
-		// ԃobNQ[W͏xĒǏ]
+		// 赤バックゲージは少し遅れて追従
 		m_targetRate = fRate;
 
 		if (m_currentRate > m_targetRate)
@@ -143,82 +147,79 @@ void CGuage::Update(void)
 			}
 		}
 
-		// _WXV
+		// 頂点座標を更新
 		UpdateGuageVtx(m_currentRate);
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CGuage::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
 	if (m_type == TYPE_FRAME)
 	{
-		// eNX`̐ݒ
-		pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
+		// テクスチャの設定
+		SetIdxTexture(m_nIdxTexture);
 	}
 	else
-	{// Q[Ŵɂ͓KpȂ
-		// eNX`̐ݒ
-		pDevice->SetTexture(0, nullptr);
+	{// ゲージ自体には適用しない
+		// テクスチャの設定
+		SetIdxTexture(-1);
 	}
 
-	// 2DIuWFNg̕`揈
+	// 2Dオブジェクトの描画処理
 	CObject2D::Draw();
 }
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 C3DGuage::C3DGuage(int nPriority) : CObjectBillboard(nPriority)
 {
-	// l̃NA
-	m_type		= TYPE_NONE;			// Q[W̎
-	m_bVisible	= false;				// \ǂ
+	// 値のクリア
+	m_type		= TYPE_NONE;			// ゲージの種類
+	m_bVisible	= false;				// 表示中かどうか
 }
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 C3DGuage::~C3DGuage()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 C3DGuage* C3DGuage::Create(GUAGETYPE type, D3DXVECTOR3 pos, float fWidth, float fHeight)
 {
 	C3DGuage* pGuage = new C3DGuage;
 
-	// nullptr
+	// nullptrだったら
 	if (pGuage == nullptr)
 	{
 		return nullptr;
 	}
 
-	// ݒ
+	// 設定
 	pGuage->SetPos(pos);
 	pGuage->SetSize(fWidth, fHeight);
 	pGuage->m_type = type;
 
 	if (type == TYPE_GUAGE)
-	{// Q[W͉F
+	{// ゲージは黄色
 		pGuage->SetCol(D3DXCOLOR(1.0f, 1.0f, 0.0f, 1.0f));
+
+		// フレームより後に描く
+		pGuage->SetLayer(1);
 	}
 	else if (type == TYPE_FRAME)
-	{// t[̓eNX`̐FĝŔ
+	{// フレームはテクスチャの色を使うので白
 		pGuage->SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f));
 		pGuage->SetPath("data/TEXTURE/HpFrame.png");
 	}
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pGuage->Init()))
 	{
 		return nullptr;
@@ -227,35 +228,35 @@ C3DGuage* C3DGuage::Create(GUAGETYPE type, D3DXVECTOR3 pos, float fWidth, float
 	return pGuage;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT C3DGuage::Init(void)
 {
-	// r{[hIuWFNg̏
+	// ビルボードオブジェクトの初期化処理
 	CObjectBillboard::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void C3DGuage::Uninit(void)
 {
-	// r{[hIuWFNg̏I
+	// ビルボードオブジェクトの終了処理
 	CObjectBillboard::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void C3DGuage::Update(void)
 {
 
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void C3DGuage::Draw(void)
 {
-	// r{[hIuWFNg̕`揈
+	// ビルボードオブジェクトの描画処理
 	CObjectBillboard::Draw();
 }
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// Q[W [guage.h]
+// ゲージ処理 [guage.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,32 +8,32 @@
 #define _GUAGE_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object2D.h"
 #include "objectBillboard.h"
 
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CCharacter;
 class CBuriedTreasureBlock;
 
 
 //*****************************************************************************
-// Q[WNX
+// ゲージクラス
 //*****************************************************************************
 class CGuage : public CObject2D
 {
 public:
-	// 
+	// 種類
 	enum GUAGETYPE
 	{
-		TYPE_NONE = 0,	// ĂȂ
-		TYPE_GUAGE,		// ΃Q[W
-		TYPE_BACKGUAGE,	// obNQ[W()
-		TYPE_FRAME,		// g
+		TYPE_NONE = 0,	// 何もしていない状態
+		TYPE_GUAGE,		// 緑ゲージ
+		TYPE_BACKGUAGE,	// バックゲージ(赤)
+		TYPE_FRAME,		// 枠
 		TYPE_MAX
 	};
 
@@ -48,27 +48,27 @@ public:
 	void SetTargetCharacter(CCharacter* pChar) { m_pTargetChar = pChar; }
 
 private:
-	int			m_nIdxTexture;		// eNX`CfbNX
-	GUAGETYPE	m_type;				// Q[W̎
-	float		m_targetRate;		// ۂHP
-	float		m_currentRate;		// \pQ[WiǏ]pj
-	float		m_speed;			// Ǐ]x
-	float		m_delayTimer;		// x^C}[(obNQ[Wp)
-	CCharacter* m_pTargetChar;		// ̃Q[WǏ]LN^[
+	int			m_nIdxTexture;		// テクスチャインデックス
+	GUAGETYPE	m_type;				// ゲージの種類
+	float		m_targetRate;		// 実際のHP割合
+	float		m_currentRate;		// 表示用ゲージ割合（追従用）
+	float		m_speed;			// 追従速度
+	float		m_delayTimer;		// 遅延タイマー(バックゲージ用)
+	CCharacter* m_pTargetChar;		// このゲージが追従するキャラクター
 };
 
 //*****************************************************************************
-// 3DQ[WNX
+// 3Dゲージクラス
 //*****************************************************************************
 class C3DGuage : public CObjectBillboard
 {
 public:
-	// 
+	// 種類
 	enum GUAGETYPE
 	{
-		TYPE_NONE = 0,	// ĂȂ
-		TYPE_GUAGE,		// ΃Q[W
-		TYPE_FRAME,		// g
+		TYPE_NONE = 0,	// 何もしていない状態
+		TYPE_GUAGE,		// 緑ゲージ
+		TYPE_FRAME,		// 枠
 		TYPE_MAX
 	};
 
@@ -81,7 +81,7 @@ public:
 	void Update(void);
 	void Draw(void);
 
-	// \E\
+	// 表示・非表示
 	void SetActive(bool flag)
 	{
 		m_bVisible = flag;
@@ -100,8 +100,8 @@ public:
 	}
 
 private:
-	GUAGETYPE	m_type;			// Q[W̎
-	bool		m_bVisible;		// \tO
+	GUAGETYPE	m_type;			// ゲージの種類
+	bool		m_bVisible;		// 表示フラグ
 
 };
 
@@ -1,21 +1,22 @@
 //=============================================================================
 //
-// GUI\ [guiInfo.cpp]
+// GUI情報表示処理 [guiInfo.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "guiInfo.h"
 #include "imguimaneger.h"
 #include "player.h"
 #include "enemy.h"
 #include "manager.h"
+#include "memorymanager.h"
 
 //=============================================================================
-// vC[̃fobO̕\
+// プレイヤーのデバッグ情報の表示処理
 //=============================================================================
 void CGuiInfo::PlayerInfo(void)
 {
@@ -32,22 +33,22 @@ void CGuiInfo::PlayerInfo(void)
 
 	if (ImGui::TreeNode("Player Info"))
 	{
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 		// HP
 		ImGui::Text("HP : %.1f / %.1f", pPlayer->GetHp(), pPlayer->GetMaxHp());
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 		//*********************************************************************
-		// POS ̏
+		// POS の情報
 		//*********************************************************************
 
-		// ʒu
-		ImGui::Text("POS"); ImGui::SameLine(70); // xʒu
+		// 位置
+		ImGui::Text("POS"); ImGui::SameLine(70); // ラベル位置微調整
 
 		ImGui::Text("X:"); ImGui::SameLine();
-		ImGui::SetNextItemWidth(80); // 
+		ImGui::SetNextItemWidth(80); // 幅を狭く
 		ImGui::DragFloat("##Player_pos_x", &pos.x, 1.0f, -1000.0f, 1000.0f, "%.1f");
 
 		ImGui::SameLine();
@@ -61,16 +62,16 @@ void CGuiInfo::PlayerInfo(void)
 		ImGui::DragFloat("##Player_pos_z", &pos.z, 1.0f, -1000.0f, 1000.0f, "%.1f");
 
 		//*********************************************************************
-		// ROT ̏
+		// ROT の情報
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// 
-		ImGui::Text("ROT"); ImGui::SameLine(70); // xʒu
+		// 向き
+		ImGui::Text("ROT"); ImGui::SameLine(70); // ラベル位置微調整
 
 		ImGui::Text("X:"); ImGui::SameLine();
-		ImGui::SetNextItemWidth(80); // 
+		ImGui::SetNextItemWidth(80); // 幅を狭く
 		ImGui::DragFloat("##Player_rot_x", &rot.x, 0.1f, -D3DX_PI, D3DX_PI, "%.1f");
 
 		ImGui::SameLine();
@@ -84,13 +85,13 @@ void CGuiInfo::PlayerInfo(void)
 		ImGui::DragFloat("##Player_rot_z", &rot.z, 0.1f, -D3DX_PI, D3DX_PI, "%.1f");
 
 		//*********************************************************************
-		// SIZE ̏
+		// SIZE の情報
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// x
-		ImGui::Text("SIZE"); ImGui::SameLine(70); // ẍʒuƒ
+		// ラベル
+		ImGui::Text("SIZE"); ImGui::SameLine(70); // ラベルの位置ちょっと調整
 
 		// X
 		ImGui::Text("X:"); ImGui::SameLine();
@@ -109,11 +110,11 @@ void CGuiInfo::PlayerInfo(void)
 		ImGui::SetNextItemWidth(80);
 		ImGui::DragFloat("##Player_size_z", &size.z, 0.1f, -100.0f, 100.0f, "%.1f");
 
-		ImGui::TreePop(); // 
+		ImGui::TreePop(); // 閉じる
 	}
 }
 //=============================================================================
-// G̃fobO̕\
+// 敵のデバッグ情報の表示処理
 //=============================================================================
 void CGuiInfo::EnemyInfo(void)
 {
@@ -130,22 +131,22 @@ void CGuiInfo::EnemyInfo(void)
 
 	if (ImGui::TreeNode("Enemy Info"))
 	{
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 		// HP
 		ImGui::Text("HP : %.1f / %.1f", pEnemy->GetHp(), pEnemy->GetMaxHp());
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 		//*********************************************************************
-		// POS ̏
+		// POS の情報
 		//*********************************************************************
 
-		// ʒu
-		ImGui::Text("POS"); ImGui::SameLine(70); // xʒu
+		// 位置
+		ImGui::Text("POS"); ImGui::SameLine(70); // ラベル位置微調整
 
 		ImGui::Text("X:"); ImGui::SameLine();
-		ImGui::SetNextItemWidth(80); // 
+		ImGui::SetNextItemWidth(80); // 幅を狭く
 		ImGui::DragFloat("##Enemy_pos_x", &pos.x, 1.0f, -1000.0f, 1000.0f, "%.1f");
 
 		ImGui::SameLine();
@@ -159,16 +160,16 @@ void CGuiInfo::EnemyInfo(void)
 		ImGui::DragFloat("##Enemy_pos_z", &pos.z, 1.0f, -1000.0f, 1000.0f, "%.1f");
 
 		//*********************************************************************
-		// ROT ̏
+		// ROT の情報
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// 
-		ImGui::Text("ROT"); ImGui::SameLine(70); // xʒu
+		// 向き
+		ImGui::Text("ROT"); ImGui::SameLine(70); // ラベル位置微調整
 
 		ImGui::Text("X:"); ImGui::SameLine();
-		ImGui::SetNextItemWidth(80); // 
+		ImGui::SetNextItemWidth(80); // 幅を狭く
 		ImGui::DragFloat("##Enemy_rot_x", &rot.x, 0.1f, -D3DX_PI, D3DX_PI, "%.1f");
 
 		ImGui::SameLine();
@@ -182,13 +183,13 @@ void CGuiInfo::EnemyInfo(void)
 		ImGui::DragFloat("##Enemy_rot_z", &rot.z, 0.1f, -D3DX_PI, D3DX_PI, "%.1f");
 
 		//*********************************************************************
-		// SIZE ̏
+		// SIZE の情報
 		//*********************************************************************
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// x
-		ImGui::Text("SIZE"); ImGui::SameLine(70); // ẍʒuƒ
+		// ラベル
+		ImGui::Text("SIZE"); ImGui::SameLine(70); // ラベルの位置ちょっと調整
 
 		// X
 		ImGui::Text("X:"); ImGui::SameLine();
@@ -207,15 +208,15 @@ void CGuiInfo::EnemyInfo(void)
 		ImGui::SetNextItemWidth(80);
 		ImGui::DragFloat("##Enemy_size_z", &size.z, 0.1f, -100.0f, 100.0f, "%.1f");
 
-		ImGui::TreePop(); // 
+		ImGui::TreePop(); // 閉じる
 	}
 }
 //=============================================================================
-// wKAI̕\
+// 学習AI情報の表示処理
 //=============================================================================
 void CGuiInfo::AIInfo(void)
 {
-	CEnemy* pEnemy = CCharacterManager::GetInstance().GetCharacter<CEnemy>();// G̎擾
+	CEnemy* pEnemy = CCharacterManager::GetInstance().GetCharacter<CEnemy>();// 敵の取得
 
 	if (!pEnemy )
 	{
@@ -224,19 +225,19 @@ void CGuiInfo::AIInfo(void)
 
 	if (ImGui::TreeNode("AI Info"))
 	{
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 		// HP
 		ImGui::Text("HP : %.1f / %.1f", pEnemy->GetHp(), pEnemy->GetMaxHp());
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 
-		ImGui::TreePop(); // 
+		ImGui::TreePop(); // 閉じる
 	}
 }
 //=============================================================================
-// J̃fobO̕\
+// カメラのデバッグ情報の表示処理
 //=============================================================================
 void CGuiInfo::CameraInfo(void)
 {
@@ -255,23 +256,94 @@ void CGuiInfo::CameraInfo(void)
 	{
 		ImGui::Text("Change Camera Mode : [Press C]");
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 		ImGui::Text("PosV Move : [Press L ALT & MouseButton L]");
 		ImGui::Text("PosR Move : [Press MouseButton R]");
 		ImGui::Text("Zoom : [MouseWheel]");
 
-		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-		// _̈ʒu
+		// 視点の位置
 		ImGui::Text("PosV [X:%.1f Y:%.1f Z:%.1f]", posV.x, posV.y, posV.z);
 
-		// _̈ʒu
+		// 注視点の位置
 		ImGui::Text("PosR [X:%.1f Y:%.1f Z:%.1f]", posR.x, posR.y, posR.z);
 
-		// px
+		// 角度
 		ImGui::Text("Rot  [X:%.2f Y:%.2f Z:%.2f]", rot.x, rot.y, rot.z);
 
-		ImGui::TreePop(); // 
+		ImGui::TreePop(); // 閉じる
 	}
-}
\ No newline at end of file
+}
+//=============================================================================
+// メモリのデバッグ情報の表示処理
+//=============================================================================
+void CGuiInfo::MemoryInfo(void)
+{
+	const CMemoryManager::FrameStats& frame = CMemoryManager::GetLastFrameStats();
+	const CSceneArena& arena = CMemoryManager::GetSceneArena();
+
+	if (ImGui::TreeNode("Memory Info"))
+	{
+		// フレームアロケーター
+		ImGui::Text("Frame Alloc : %d (%.1f KB)", frame.nAllocCount, frame.allocBytes / 1024.0f);
+		ImGui::Text("Frame Peak  : %.1f KB", CMemoryManager::GetPeakFrameBytes() / 1024.0f);
+		ImGui::Text("Frame Heap  : %d", frame.nHeapAllocCount);
+
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+		// シーンアリーナ
+		ImGui::Text("Scene Live  : %d", arena.GetLiveCount());
+		ImGui::Text("Scene Reuse : %d", arena.GetReuseCount());
+		ImGui::Text("Scene Used  : %.1f / %.1f KB", arena.GetUsedBytes() / 1024.0f, arena.GetCapacity() / 1024.0f);
+
+		ImGui::TreePop(); // 閉じる
+	}
+}
+//=============================================================================
+// 計測カウンターの表示処理
+//=============================================================================
+void CGuiInfo::TelemetryInfo(void)
+{
+	if (ImGui::TreeNode("Telemetry Info"))
+	{
+		// CSV出力の切り替え
+		if (CTelemetry::IsRecording())
+		{
+			if (ImGui::Button("Stop CSV"))
+			{
+				CTelemetry::StopCsv();
+			}
+		}
+		else
+		{
+			if (ImGui::Button("Record CSV"))
+			{
+				CTelemetry::StartCsv("telemetry.csv");
+			}
+		}
+
+		ImGui::SameLine();
+
+		// 集計結果の書き出し
+		if (ImGui::Button("Save JSON"))
+		{
+			CTelemetry::SaveJson("telemetry.json");
+		}
+
+		ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+		ImGui::Text("Frame : %d", CTelemetry::GetFrame());
+
+		// 全カウンターの表示(前フレームの値 / 最大値)
+		for (int nCnt = 0; nCnt < CTelemetry::COUNTER_MAX; nCnt++)
+		{
+			CTelemetry::COUNTER counter = (CTelemetry::COUNTER)nCnt;
+
+			ImGui::Text("%-18s : %6d / %6d", CTelemetry::GetName(counter), CTelemetry::GetValue(counter), CTelemetry::GetPeak(counter));
+		}
+
+		ImGui::TreePop(); // 閉じる
+	}
+}
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// GUI\ [guiInfo.h]
+// GUI情報表示処理 [guiInfo.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,27 +8,33 @@
 #define _GUIINFO_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 //*****************************************************************************
-// GUI\NX
+// GUI情報表示クラス
 //*****************************************************************************
 class CGuiInfo
 {
 public:
 
-	// vC[̃fobO̕\
+	// プレイヤーのデバッグ情報の表示
 	static void PlayerInfo(void);
 
-	// G̃fobO̕\
+	// 敵のデバッグ情報の表示
 	static void EnemyInfo(void);
 
-	// wKAI̕\
+	// 学習AI情報の表示
 	static void AIInfo(void);
 
-	// J̃fobO̕\
+	// カメラのデバッグ情報の表示
 	static void CameraInfo(void);
+
+	// メモリのデバッグ情報の表示
+	static void MemoryInfo(void);
+
+	// 計測カウンターの表示
+	static void TelemetryInfo(void);
 };
 
 #endif
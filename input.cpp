@@ -1,43 +1,43 @@
 //=============================================================================
 //
-// ͏ [input.cpp]
+// 入力処理 [input.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "input.h"
 #include "manager.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-LPDIRECTINPUT8 CInput::m_pInput = nullptr;		// DirectInputIuWFNgւ̃|C^
+LPDIRECTINPUT8 CInput::m_pInput = nullptr;		// DirectInputオブジェクトへのポインタ
 DIMOUSESTATE CInputMouse::m_mouseState = {};
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CInput::CInput()
 {
-	// l̃NA
+	// 値のクリア
 	m_pDevice = nullptr;
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CInput::~CInput()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CInput::Init(HINSTANCE hInstance)
 {
-	// DirectInputIuWFNg̐
+	// DirectInputオブジェクトの生成
 	if (FAILED(DirectInput8Create(hInstance, DIRECTINPUT_VERSION,
 		IID_IDirectInput8, (void**)&m_pInput, NULL)))
 	{
@@ -47,19 +47,19 @@ HRESULT CInput::Init(HINSTANCE hInstance)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CInput::Uninit(void)
 {
-	// ̓foCX̔j
+	// 入力デバイスの破棄
 	if (m_pDevice != nullptr)
 	{
-		m_pDevice->Unacquire();// L[{[hւ̃ANZXj
+		m_pDevice->Unacquire();// キーボードへのアクセス権を破棄
 		m_pDevice->Release();
 		m_pDevice = nullptr;
 	}
 
-	// DirectInputIuWFNg̔j
+	// DirectInputオブジェクトの破棄
 	if (m_pInput != nullptr)
 	{
 		m_pInput->Release();
@@ -67,93 +67,93 @@ void CInput::Uninit(void)
 	}
 }
 //=============================================================================
-// L[{[h̃RXgN^
+// キーボードのコンストラクタ
 //=============================================================================
 CInputKeyboard::CInputKeyboard()
 {
-	// l̃NA
+	// 値のクリア
 	for (int nCnt = 0; nCnt < NUM_KEY_MAX; nCnt++)
 	{
-		m_aKeyState[nCnt] = {};				// L[{[h̃vX
-		m_aOldState[nCnt] = {};				// L[{[h̑ÕvX
+		m_aKeyState[nCnt] = {};				// キーボードのプレス情報
+		m_aOldState[nCnt] = {};				// キーボードの前回のプレス情報
 	}
 }
 //=============================================================================
-// L[{[h̃fXgN^
+// キーボードのデストラクタ
 //=============================================================================
 CInputKeyboard::~CInputKeyboard()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// L[{[h̏
+// キーボードの初期化処理
 //=============================================================================
 HRESULT CInputKeyboard::Init(HINSTANCE hInstance, HWND hWnd)
 {
-	// ͂̏
+	// 入力の初期化
 	CInput::Init(hInstance);
 
-	// ̓foCX(L[{[h)̐
+	// 入力デバイス(キーボード)の生成
 	if (FAILED(m_pInput->CreateDevice(GUID_SysKeyboard, &m_pDevice, NULL)))
 	{
 		return E_FAIL;
 	}
 
-	//f[^tH[}bgݒ
+	//データフォーマットを設定
 	if (FAILED(m_pDevice->SetDataFormat(&c_dfDIKeyboard)))
 	{
 		return E_FAIL;
 	}
 
-	//[hݒ
+	//協調モードを設定
 	if (FAILED(m_pDevice->SetCooperativeLevel(hWnd,
 		(DISCL_FOREGROUND | DISCL_NONEXCLUSIVE))))
 	{
 		return S_OK;
 	}
 
-	// L[{[hւ̃ANZX
+	// キーボードへのアクセス権
 	m_pDevice->Acquire();
 
 	return S_OK;
 }
 //=============================================================================
-// L[{[h̏I
+// キーボードの終了処理
 //=============================================================================
 void CInputKeyboard::Uninit(void)
 {
-	// ͂̏I
+	// 入力の終了処理
 	CInput::Uninit();
 }
 //=============================================================================
-// L[{[h̍XV
+// キーボードの更新処理
 //=============================================================================
 void CInputKeyboard::Update(void)
 {
-	BYTE aKeyState[NUM_KEY_MAX]; // ŐṼL[{[h
-	memcpy(m_aOldState, m_aKeyState, sizeof(m_aKeyState)); // Ԃۑ
+	BYTE aKeyState[NUM_KEY_MAX]; // 最新のキーボード状態
+	memcpy(m_aOldState, m_aKeyState, sizeof(m_aKeyState)); // 旧状態を保存
 
-	// L[{[ȟ݂̏Ԃ擾
+	// キーボードの現在の状態を取得
 	if (SUCCEEDED(m_pDevice->GetDeviceState(sizeof(aKeyState), &aKeyState[0])))
 	{
-		memcpy(m_aKeyState, aKeyState, sizeof(m_aKeyState)); // ŐV̏Ԃۑ
+		memcpy(m_aKeyState, aKeyState, sizeof(m_aKeyState)); // 最新の状態を保存
 	}
 	else
 	{
-		// ͎擾sAfoCXĎ擾
+		// 入力取得失敗時、デバイスを再取得
 		m_pDevice->Acquire();
-		memset(m_aKeyState, 0, sizeof(m_aKeyState)); // ׂẴL[𖢉ԂɃZbg
+		memset(m_aKeyState, 0, sizeof(m_aKeyState)); // すべてのキーを未押下状態にリセット
 	}
 }
 //=============================================================================
-// L[{[h̃vX擾
+// キーボードのプレス情報を取得
 //=============================================================================
 bool CInputKeyboard::GetPress(int nKey)
 {
 	return (m_aKeyState[nKey] & 0x80) ? true : false;
 }
 //=============================================================================
-// L[{[h̃gK[擾
+// キーボードのトリガー情報を取得
 //=============================================================================
 bool CInputKeyboard::GetTrigger(int nKey)
 {
@@ -165,7 +165,7 @@ bool CInputKeyboard::GetTrigger(int nKey)
 	return Trigger;
 }
 //=============================================================================
-// ̃L[Vꂽ`FbN
+// 何かしらのキーが新しく押されたかチェック
 //=============================================================================
 bool CInputKeyboard::GetAnyKeyTrigger(void)
 {
@@ -176,7 +176,7 @@ bool CInputKeyboard::GetAnyKeyTrigger(void)
 			continue;
 		}
 
-		if ((m_aKeyState[nCnt] & 0x80) && !(m_aOldState[nCnt] & 0x80)) // VꂽL[
+		if ((m_aKeyState[nCnt] & 0x80) && !(m_aOldState[nCnt] & 0x80)) // 新しく押されたキーがある
 		{
 			return true;
 		}
@@ -184,7 +184,7 @@ bool CInputKeyboard::GetAnyKeyTrigger(void)
 	return false;
 }
 //=============================================================================
-// L[{[h̃[X擾
+// キーボードのリリース情報を取得
 //=============================================================================
 bool CInputKeyboard::GetRelease(int nKey)
 {
@@ -196,7 +196,7 @@ bool CInputKeyboard::GetRelease(int nKey)
 	return Trigger;
 }
 //=============================================================================
-// L[{[h̃s[g擾
+// キーボードのリピート情報を取得
 //=============================================================================
 bool CInputKeyboard::GetRepeat(int nKey)
 {
@@ -210,17 +210,17 @@ bool CInputKeyboard::GetRepeat(int nKey)
 
 
 //=============================================================================
-// WCpbh̃RXgN^
+// ジョイパッドのコンストラクタ
 //=============================================================================
 CInputJoypad::CInputJoypad()
 {
-	// l̃NA
-	m_joyKeyState			= {};			// WCpbh̃vX
-	m_joyKeyStateTrigger	= {};			// WCpbh̃gK[
-	m_joyKeyStateRelease	= {};			// WCpbh̃[X
-	m_aOldJoyKeyState		= {};			// WCpbh̑Ȍ
-	m_bVibration			= false;		// UtO
-	m_VibrationTimer		= 0;			// U
+	// 値のクリア
+	m_joyKeyState			= {};			// ジョイパッドのプレス情報
+	m_joyKeyStateTrigger	= {};			// ジョイパッドのトリガー情報
+	m_joyKeyStateRelease	= {};			// ジョイパッドのリリース情報
+	m_aOldJoyKeyState		= {};			// ジョイパッドの前回の情報
+	m_bVibration			= false;		// 振動フラグ
+	m_VibrationTimer		= 0;			// 振動時間
 
 	for (int nCnt = 0; nCnt < JOYKEY_MAX; nCnt++)
 	{
@@ -228,47 +228,47 @@ CInputJoypad::CInputJoypad()
 	}
 }
 //=============================================================================
-// WCpbh̃fXgN^
+// ジョイパッドのデストラクタ
 //=============================================================================
 CInputJoypad::~CInputJoypad()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// WCpbh̏
+// ジョイパッドの初期化処理
 //=============================================================================
 HRESULT CInputJoypad::Init(void)
 {
-	//̃NA
+	//メモリのクリア
 	memset(&m_joyKeyState, 0, sizeof(XINPUT_STATE));
 
-	//̃NA
+	//メモリのクリア
 	memset(&m_joyKeyStateTrigger, 0, sizeof(XINPUT_STATE));
 
-	//̃NA
+	//メモリのクリア
 	memset(&m_aOldJoyKeyState, 0, sizeof(XINPUT_STATE));
 
-	//XInput̃Xe[gݒ(Lɂ)
+	//XInputのステートを設定(有効にする)
 	XInputEnable(true);
 
 	return S_OK;
 }
 //=============================================================================
-// WCpbh̏I
+// ジョイパッドの終了処理
 //=============================================================================
 void CInputJoypad::Uninit(void)
 {
-	// XInput̃Xe[gݒ(ɂ)
+	// XInputのステートを設定(無効にする)
 	XInputEnable(false);
 }
 //=============================================================================
-// WCpbh̍XV
+// ジョイパッドの更新処理
 //=============================================================================
 void CInputJoypad::Update(void)
 {
 	XINPUT_STATE joyKeyState;
 
-	// Ot[̏Ԃۑ
+	// 前フレームの状態を保存
 	m_aOldJoyKeyState = m_joyKeyState;
 
 	if (XInputGetState(0, &joyKeyState) == ERROR_SUCCESS)
@@ -276,11 +276,11 @@ void CInputJoypad::Update(void)
 		WORD Button = joyKeyState.Gamepad.wButtons;
 		WORD OldButton = m_joyKeyState.Gamepad.wButtons;
 
-		// Vꂽ{^̔
+		// 新しく押されたボタンの判定
 		m_joyKeyStateTrigger.Gamepad.wButtons = (Button & ~OldButton);
 		m_joyKeyStateRelease.Gamepad.wButtons = (OldButton & ~Button);
 
-		// L2ER2 ̃gK[
+		// L2・R2 のトリガー処理
 		m_joyKeyStateTrigger.Gamepad.bLeftTrigger =
 			(joyKeyState.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD) &&
 			!(m_aOldJoyKeyState.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD);
@@ -289,7 +289,7 @@ void CInputJoypad::Update(void)
 			(joyKeyState.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD) &&
 			!(m_aOldJoyKeyState.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD);
 
-		m_joyKeyState = joyKeyState; // ŐV̏Ԃۑ
+		m_joyKeyState = joyKeyState; // 最新の状態を保存
 	}
 	else
 	{
@@ -310,12 +310,12 @@ void CInputJoypad::Update(void)
 		m_bVibration = false;
 		m_VibrationTimer = 0;
 
-		// U~
+		// 振動停止
 		StopVibration();
 	}
 }
 //=============================================================================
-// WCpbh̃gK[
+// ジョイパッドのトリガー処理
 //=============================================================================
 bool CInputJoypad::GetTrigger(JOYKEY Key)
 {
@@ -327,14 +327,14 @@ bool CInputJoypad::GetTrigger(JOYKEY Key)
 	return joykey;
 }
 //=============================================================================
-// WCpbh̃vX
+// ジョイパッドのプレス
 //=============================================================================
 bool CInputJoypad::GetPress(JOYKEY Key)
 {
 	return (m_joyKeyState.Gamepad.wButtons & (0x01 << Key)) ? true : false;
 }
 //=============================================================================
-// L2gK[igK[j̃gK[
+// L2トリガー（左トリガー）のトリガー判定
 //=============================================================================
 bool CInputJoypad::GetTriggerL2(void)
 {
@@ -343,7 +343,7 @@ bool CInputJoypad::GetTriggerL2(void)
 }
 
 //=============================================================================
-// R2gK[iEgK[j̃gK[
+// R2トリガー（右トリガー）のトリガー判定
 //=============================================================================
 bool CInputJoypad::GetTriggerR2(void)
 {
@@ -351,28 +351,28 @@ bool CInputJoypad::GetTriggerR2(void)
 		!(m_aOldJoyKeyState.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD);
 }
 //=============================================================================
-// L2gK[igK[j̃vX
+// L2トリガー（左トリガー）のプレス判定
 //=============================================================================
 bool CInputJoypad::GetPressL2(void)
 {
 	return (m_joyKeyState.Gamepad.bLeftTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD);
 }
 //=============================================================================
-// R2gK[iEgK[j̃vX
+// R2トリガー（右トリガー）のプレス判定
 //=============================================================================
 bool CInputJoypad::GetPressR2(void)
 {
 	return (m_joyKeyState.Gamepad.bRightTrigger > XINPUT_GAMEPAD_TRIGGER_THRESHOLD);
 }
 //=============================================================================
-// ̃{^Ă邩ivXj
+// 何かしらのボタンが押されているか判定（プレス）
 //=============================================================================
 bool CInputJoypad::GetAnyPress(void)
 {
 	return m_joyKeyState.Gamepad.wButtons != 0;
 }
 //=============================================================================
-// ̃{^Ă邩igK[j
+// 何かしらのボタンが押されているか判定（トリガー）
 //=============================================================================
 bool CInputJoypad::GetAnyTrigger(void)
 {
@@ -385,12 +385,12 @@ bool CInputJoypad::GetAnyTrigger(void)
 	return false;
 }
 //=============================================================================
-// XeBbN
+// スティック処理
 //=============================================================================
 bool CInputJoypad::GetStick(void)
 {
 	bool joykey = false;
-	//^񒆂Ȃ
+	//真ん中じゃなかったら
 	if (m_joyKeyState.Gamepad.sThumbLX >= 100 ||
 		m_joyKeyState.Gamepad.sThumbLX <= -100 ||
 		m_joyKeyState.Gamepad.sThumbLY >= 100 ||
@@ -401,49 +401,49 @@ bool CInputJoypad::GetStick(void)
 	return joykey;
 }
 //=============================================================================
-// XeBbN̎擾
+// スティック情報の取得処理
 //=============================================================================
 XINPUT_STATE* CInputJoypad::GetStickAngle(void)
 {
 	return &m_joyKeyState;
 }
 //=============================================================================
-// WCpbhU(iI)
+// ジョイパッド振動(永続的)
 //=============================================================================
 void CInputJoypad::SetVibration(WORD left, WORD right)
 {
 	XINPUT_VIBRATION vibration = {};
-	vibration.wLeftMotorSpeed = left;   // 0`65535
-	vibration.wRightMotorSpeed = right;  // 0`65535
+	vibration.wLeftMotorSpeed = left;   // 0～65535
+	vibration.wRightMotorSpeed = right;  // 0～65535
 
 	XInputSetState(0, &vibration);
 }
 //=============================================================================
-// WCpbhU(莞)
+// ジョイパッド振動(一定時間)
 //=============================================================================
 void CInputJoypad::SetVibration(WORD left, WORD right, int nTimer)
 {
-	// łɐUȂ疳
+	// すでに振動中なら無視
 	if (m_bVibration && m_VibrationTimer > 0)
 	{
 		return;
 	}
 
 	XINPUT_VIBRATION vibration = {};
-	vibration.wLeftMotorSpeed = left;		// 0`65535
-	vibration.wRightMotorSpeed = right;		// 0`65535
+	vibration.wLeftMotorSpeed = left;		// 0～65535
+	vibration.wRightMotorSpeed = right;		// 0～65535
 
-	// UԂ̐ݒ
+	// 振動時間の設定
 	m_VibrationTimer = nTimer;
 
-	// UtOON
+	// 振動フラグをON
 	m_bVibration = true;
 
 	XInputSetState(0, &vibration);
 }
 
 //=============================================================================
-// U~
+// 振動停止
 //=============================================================================
 void CInputJoypad::StopVibration(void)
 {
@@ -452,63 +452,63 @@ void CInputJoypad::StopVibration(void)
 
 
 //=============================================================================
-// }EX̃RXgN^
+// マウスのコンストラクタ
 //=============================================================================
 CInputMouse::CInputMouse()
 {
-	// l̃NA
+	// 値のクリア
 	m_mouseState = {};
 }
 //=============================================================================
-// }EX̃fXgN^
+// マウスのデストラクタ
 //=============================================================================
 CInputMouse::~CInputMouse()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// }EX̏
+// マウスの初期化処理
 //=============================================================================
 HRESULT CInputMouse::Init(HINSTANCE hInstance, HWND hWnd)
 {
-	// ͂̏
+	// 入力の初期化処理
 	CInput::Init(hInstance);
 
-	// ̓foCX(L[{[h)̐
+	// 入力デバイス(キーボード)の生成
 	if (FAILED(m_pInput->CreateDevice(GUID_SysMouse, &m_pDevice, NULL)))
 	{
 		return E_FAIL;
 	}
 
-	//f[^tH[}bgݒ
+	//データフォーマットを設定
 	if (FAILED(m_pDevice->SetDataFormat(&c_dfDIMouse)))
 	{
 		return E_FAIL;
 	}
 
-	// EBhEANeBuł}EXgp\ɂ
+	// ウィンドウが非アクティブでもマウスを使用可能にする
 	if (FAILED(m_pDevice->SetCooperativeLevel(hWnd,
 		DISCL_BACKGROUND | DISCL_NONEXCLUSIVE)))
 	{
-		MessageBox(NULL, "SetCooperativeLevel Ɏs܂", "G[", MB_OK | MB_ICONERROR);
+		MessageBox(NULL, "SetCooperativeLevel に失敗しました", "エラー", MB_OK | MB_ICONERROR);
 		return E_FAIL;
 	}
 
-	// }EXւ̃ANZX
+	// マウスへのアクセス権
 	m_pDevice->Acquire();
 
-	return S_OK; // 
+	return S_OK; // 初期化成功
 }
 //=============================================================================
-// }EX̏I
+// マウスの終了処理
 //=============================================================================
 void CInputMouse::Uninit(void)
 {
-	// ͂̏I
+	// 入力の終了処理
 	CInput::Uninit();
 }
 //=============================================================================
-// }EX̍XV
+// マウスの更新処理
 //=============================================================================
 void CInputMouse::Update(void)
 {
@@ -525,14 +525,14 @@ void CInputMouse::Update(void)
 	}
 }
 //=============================================================================
-// }EX̃vX
+// マウスのプレス情報
 //=============================================================================
 bool CInputMouse::GetPress(int button)
 {
 	return (m_mouseState.rgbButtons[button] & 0x80) != 0;
 }
 //=============================================================================
-// }EX̃gK[
+// マウスのトリガー情報
 //=============================================================================
 bool CInputMouse::GetTrigger(int button)
 {
@@ -545,7 +545,7 @@ bool CInputMouse::GetTrigger(int button)
 	return trigger;
 }
 //=============================================================================
-// }EX̃[X
+// マウスのリリース情報
 //=============================================================================
 bool CInputMouse::GetRelease(int button)
 {
@@ -558,11 +558,11 @@ bool CInputMouse::GetRelease(int button)
 	return release;
 }
 //=============================================================================
-// }EX̏
+// マウスの状態
 //=============================================================================
 bool CInputMouse::GetMouseState(DIMOUSESTATE* mouseState)
 {
-	// }EXfoCX擾
+	// マウスデバイスを取得
 	LPDIRECTINPUTDEVICE8 pMouse = GetDevice();
 
 	if (pMouse == nullptr)
@@ -570,17 +570,17 @@ bool CInputMouse::GetMouseState(DIMOUSESTATE* mouseState)
 		return false;
 	}
 
-	// }EX̏Ԃ擾
+	// マウスの状態を取得
 	HRESULT hr = pMouse->GetDeviceState(sizeof(DIMOUSESTATE), (LPVOID)mouseState);
 
 	if (FAILED(hr))
 	{
-		// ̓foCXZbgĂꍇAĎ擾݂
+		// 入力デバイスがリセットされている場合、再取得を試みる
 		if (hr == DIERR_INPUTLOST || hr == DIERR_NOTACQUIRED)
 		{
 			pMouse->Acquire();
 
-			// Ď擾݂
+			// 再取得を試みる
 			hr = pMouse->GetDeviceState(sizeof(DIMOUSESTATE), (LPVOID)mouseState);
 			if (FAILED(hr))
 			{
@@ -589,32 +589,32 @@ bool CInputMouse::GetMouseState(DIMOUSESTATE* mouseState)
 		}
 		else
 		{
-			//G[̏ꍇ
+			//エラーの場合
 			return false;
 		}
 	}
 
-	return true; // Ɏ擾łꍇ
+	return true; // 正常に取得できた場合
 }
 //=============================================================================
-// }EXzC[̃XN[ʂ擾֐
+// マウスホイールのスクロール量を取得する関数
 //=============================================================================
 int CInputMouse::GetWheel(void)
 {
-	const int ScrollUnit = 120; // ʏ̃XN[P
+	const int ScrollUnit = 120; // 通常のスクロール単位
 
 	int wheelValue = m_mouseState.lZ;
 
-	// XN[PʂɊÂĐK
+	// スクロール単位に基づいて正規化
 	if (wheelValue != 0)
 	{
-		wheelValue /= ScrollUnit; // KꂽXN[ʂԂ
+		wheelValue /= ScrollUnit; // 正規化されたスクロール量を返す
 	}
 
-	return wheelValue; // iXN[jAiXN[jA0iXN[Ȃj
+	return wheelValue; // 正（上スクロール）、負（下スクロール）、0（スクロールなし）
 }
 //=============================================================================
-// }EXJ[\\
+// マウスカーソル表示処理
 //=============================================================================
 void CInputMouse::SetCursorVisibility(bool visible)
 {
@@ -622,7 +622,7 @@ void CInputMouse::SetCursorVisibility(bool visible)
 
 	if (visible)
 	{
-		// J[\\
+		// カーソルを表示
 		while (cursorCount < 0)
 		{
 			ShowCursor(TRUE);
@@ -631,7 +631,7 @@ void CInputMouse::SetCursorVisibility(bool visible)
 	}
 	else
 	{
-		// J[\\
+		// カーソルを非表示
 		while (cursorCount >= 0)
 		{
 			ShowCursor(FALSE);
@@ -640,11 +640,11 @@ void CInputMouse::SetCursorVisibility(bool visible)
 	}
 }
 //=============================================================================
-// n(Y = 0)Ƃ̌_擾鏈
+// 地面(Y = 0)との交差点を取得する処理
 //=============================================================================
 D3DXVECTOR3 CInputMouse::GetGroundHitPosition(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	CRenderer* renderer = CManager::GetRenderer();
 	LPDIRECT3DDEVICE9 pDevice = renderer->GetDevice();
 
@@ -653,7 +653,7 @@ D3DXVECTOR3 CInputMouse::GetGroundHitPosition(void)
 		return D3DXVECTOR3(0, 0, 0);
 	}
 
-	// r[|[gƍs擾
+	// ビューポートと行列取得
 	D3DVIEWPORT9 viewport;
 	D3DXMATRIX matProj, matView, matWorld;
 	pDevice->GetViewport(&viewport);
@@ -661,15 +661,15 @@ D3DXVECTOR3 CInputMouse::GetGroundHitPosition(void)
 	pDevice->GetTransform(D3DTS_VIEW, &matView);
 	D3DXMatrixIdentity(&matWorld);
 
-	// }EXW擾
+	// マウス座標取得
 	POINT mousePos;
 	GetCursorPos(&mousePos);
 
-	// EBhEnh擾
+	// ウィンドウハンドルを取得
 	HWND hwnd = GetActiveWindow();
 	ScreenToClient(hwnd, &mousePos);
 
-	// XN[W[hWϊ
+	// スクリーン座標→ワールド座標変換
 	D3DXVECTOR3 nearPoint((float)mousePos.x, (float)mousePos.y, 0.0f);
 	D3DXVECTOR3 farPoint((float)mousePos.x, (float)mousePos.y, 1.0f);
 	D3DXVECTOR3 rayOrigin, rayDir;
@@ -679,10 +679,10 @@ D3DXVECTOR3 CInputMouse::GetGroundHitPosition(void)
 	rayDir -= rayOrigin;
 	D3DXVec3Normalize(&rayDir, &rayDir);
 
-	// n(Y = 0)Ƃ̌_
+	// 地面(Y = 0)との交点
 	if (fabsf(rayDir.y) < 1e-5f)
 	{
-		return D3DXVECTOR3(0, 0, 0); // C΍
+		return D3DXVECTOR3(0, 0, 0); // 水平レイ対策
 	}
 
 	float t = -rayOrigin.y / rayDir.y;
@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// ͏ [input.h]
+// 入力処理 [input.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _INPUT_H_// ̃}N`ĂȂ
-#define _INPUT_H_// 2dCN[hh~̃}N`
+#ifndef _INPUT_H_// このマクロ定義がされていなかったら
+#define _INPUT_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 
 //*****************************************************************************
-// ̓NX
+// 入力クラス
 //*****************************************************************************
 class CInput
 {
@@ -21,7 +21,7 @@ public:
 	CInput();
 	virtual ~CInput();
 
-	static constexpr int NUM_KEY_MAX = 256;	// L[̍ő吔
+	static constexpr int NUM_KEY_MAX = 256;	// キーの最大数
 
 	virtual HRESULT Init(HINSTANCE hInstance);
 	virtual void Uninit(void);
@@ -29,14 +29,14 @@ public:
 	LPDIRECTINPUTDEVICE8 GetDevice(void) { return m_pDevice; }
 
 protected:
-	static LPDIRECTINPUT8	m_pInput;		// DirectInputIuWFNgւ̃|C^
-	LPDIRECTINPUTDEVICE8	m_pDevice;		// ̓foCXւ̃|C^
+	static LPDIRECTINPUT8	m_pInput;		// DirectInputオブジェクトへのポインタ
+	LPDIRECTINPUTDEVICE8	m_pDevice;		// 入力デバイスへのポインタ
 
 private:
 };
 
 //*****************************************************************************
-// L[{[hNX
+// キーボードクラス
 //*****************************************************************************
 class CInputKeyboard : public CInput
 {
@@ -53,12 +53,12 @@ public:
 	bool GetRelease(int nKey);
 	bool GetRepeat(int nKey);
 private:
-	BYTE m_aKeyState[NUM_KEY_MAX];				// L[{[h̃vX
-	BYTE m_aOldState[NUM_KEY_MAX];				// L[{[h̑ÕvX
+	BYTE m_aKeyState[NUM_KEY_MAX];				// キーボードのプレス情報
+	BYTE m_aOldState[NUM_KEY_MAX];				// キーボードの前回のプレス情報
 };
 
 //*****************************************************************************
-// WCpbhNX
+// ジョイパッドクラス
 //*****************************************************************************
 class CInputJoypad
 {
@@ -66,25 +66,25 @@ public:
 	CInputJoypad();
 	~CInputJoypad();
 
-	//L[̎
+	//キーの種類
 	typedef enum
 	{
-		JOYKEY_UP = 0,	// \L[
-		JOYKEY_DOWN,	// \L[
-		JOYKEY_LEFT,	// \L[
-		JOYKEY_RIGHT,	// \L[E
-		JOYKEY_START,	// X^[g{^
-		JOYKEY_BACK,	// obN{^
-		JOYKEY_LS,		// XeBbN
-		JOYKEY_RS,		// EXeBbN
-		JOYKEY_LB,		// {^
-		JOYKEY_RB,		// E{^
-		JOYKEY_LT,		// gK[
-		JOYKEY_RT,		// EgK[
-		JOYKEY_A,		// A{^
-		JOYKEY_B,		// B{^
-		JOYKEY_X,		// X{^
-		JOYKEY_Y,		// Y{^
+		JOYKEY_UP = 0,	// 十字キー上
+		JOYKEY_DOWN,	// 十字キー下
+		JOYKEY_LEFT,	// 十字キー左
+		JOYKEY_RIGHT,	// 十字キー右
+		JOYKEY_START,	// スタートボタン
+		JOYKEY_BACK,	// バックボタン
+		JOYKEY_LS,		// 左スティック押し込み
+		JOYKEY_RS,		// 右スティック押し込み
+		JOYKEY_LB,		// 左ボタン
+		JOYKEY_RB,		// 右ボタン
+		JOYKEY_LT,		// 左トリガー
+		JOYKEY_RT,		// 右トリガー
+		JOYKEY_A,		// Aボタン
+		JOYKEY_B,		// Bボタン
+		JOYKEY_X,		// Xボタン
+		JOYKEY_Y,		// Yボタン
 		JOYKEY_MAX
 	}JOYKEY;
 
@@ -107,17 +107,17 @@ public:
 	void StopVibration(void);
 
 private:
-	XINPUT_STATE m_joyKeyState;					// WCpbh̃vX
-	XINPUT_STATE m_joyKeyStateTrigger;			// WCpbh̃gK[
-	XINPUT_STATE m_joyKeyStateRelease;			// WCpbh̃[X
-	XINPUT_STATE m_aOldJoyKeyState;				// WCpbh̑Ȍ
-	bool		 m_joyKeyFlag[JOYKEY_MAX];		// WCpbh̃tO
-	bool		 m_bVibration;					// UtO
-	int			 m_VibrationTimer;				// U
+	XINPUT_STATE m_joyKeyState;					// ジョイパッドのプレス情報
+	XINPUT_STATE m_joyKeyStateTrigger;			// ジョイパッドのトリガー情報
+	XINPUT_STATE m_joyKeyStateRelease;			// ジョイパッドのリリース情報
+	XINPUT_STATE m_aOldJoyKeyState;				// ジョイパッドの前回の情報
+	bool		 m_joyKeyFlag[JOYKEY_MAX];		// ジョイパッドのフラグ
+	bool		 m_bVibration;					// 振動フラグ
+	int			 m_VibrationTimer;				// 振動時間
 };
 
 //*****************************************************************************
-// }EXNX
+// マウスクラス
 //*****************************************************************************
 class CInputMouse : public CInput
 {
@@ -134,10 +134,10 @@ public:
 	bool GetMouseState(DIMOUSESTATE* mouseState);
 	static int GetWheel(void);
 	static void SetCursorVisibility(bool visible);
-	D3DXVECTOR3 GetGroundHitPosition(void); // nY=0Ƃ̌_擾
+	D3DXVECTOR3 GetGroundHitPosition(void); // 地面Y=0との交差点を取得
 
 private:
-	static DIMOUSESTATE m_mouseState;			// }EX̏
+	static DIMOUSESTATE m_mouseState;			// マウスの状態
 };
 
 #endif
\ No newline at end of file
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// ڏ [item.cpp]
+// 項目処理 [item.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "item.h"
 #include "renderer.h"
@@ -15,24 +15,24 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CItem::CItem(int nPriority) : CObject2D(nPriority)
 {
-	// l̃NA
-	memset(m_szPath, 0, sizeof(m_szPath));	// t@CpX
-	m_nIdxTexture	= 0;					// eNX`CfbNX
-	m_isSelected	= false;				// I
+	// 値のクリア
+	memset(m_szPath, 0, sizeof(m_szPath));	// ファイルパス
+	m_nIdxTexture	= -1;					// テクスチャインデックス
+	m_isSelected	= false;				// 選択したか
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CItem::~CItem()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CItem* CItem::Create(ITEM type, D3DXVECTOR3 pos, float fWidth, float fHeight)
 {
@@ -53,7 +53,7 @@ CItem* CItem::Create(ITEM type, D3DXVECTOR3 pos, float fWidth, float fHeight)
 		break;
 	}
 
-	// nullptr
+	// nullptrだったら
 	if (pItem == nullptr)
 	{
 		return nullptr;
@@ -63,7 +63,7 @@ CItem* CItem::Create(ITEM type, D3DXVECTOR3 pos, float fWidth, float fHeight)
 	pItem->SetSize(fWidth, fHeight);
 	pItem->SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f));
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pItem->Init()))
 	{
 		return nullptr;
@@ -72,32 +72,36 @@ CItem* CItem::Create(ITEM type, D3DXVECTOR3 pos, float fWidth, float fHeight)
 	return pItem;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CItem::Init(void)
 {
-	// eNX`̓o^
+	// テクスチャの登録
 	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic(m_szPath);
 
-	// 2DIuWFNg̏
+	// 2Dオブジェクトの初期化処理
 	CObject2D::Init();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CItem::Uninit(void)
 {
-	// 2DIuWFNg̏I
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
+
+	// 2Dオブジェクトの終了処理
 	CObject2D::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CItem::Update(void)
 {
-	// Iڂ̐F̐؂ւ
+	// 選択項目の色の切り替え
 	if (IsMouseOver() || m_isSelected)
 	{
 		SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f));
@@ -107,42 +111,36 @@ void CItem::Update(void)
 		SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.5f));
 	}
 
-	// 2DIuWFNg̍XV
+	// 2Dオブジェクトの更新処理
 	CObject2D::Update();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CItem::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
+	// テクスチャの設定
+	SetIdxTexture(m_nIdxTexture);
 
-	// 2DIuWFNg̕`揈
+	// 2Dオブジェクトの描画処理
 	CObject2D::Draw();
 }
 //=============================================================================
-// }EXJ[\̔菈
+// マウスカーソルの判定処理
 //=============================================================================
 bool CItem::IsMouseOver(void)
 {
-	// }EXJ[\̈ʒu擾
+	// マウスカーソルの位置を取得
 	POINT cursorPos;
 	GetCursorPos(&cursorPos);
 
-	// EBhEnh擾
+	// ウィンドウハンドルを取得
 	HWND hwnd = GetActiveWindow();
 
-	// XN[WNCAgWɕϊ
+	// スクリーン座標をクライアント座標に変換
 	ScreenToClient(hwnd, &cursorPos);
 
-	// NCAgTCY擾
+	// クライアントサイズを取得
 	RECT clientRect;
 	GetClientRect(hwnd, &clientRect);
 
@@ -155,62 +153,62 @@ bool CItem::IsMouseOver(void)
 		cursorPos.y >= top && cursorPos.y <= bottom);
 }
 //=============================================================================
-// Xe[WIDԂ
+// ステージIDを返す処理
 //=============================================================================
 CItem::ITEM CItem::GetItemId(void) const
 {
 	if (dynamic_cast<const CPlay*>(this)) return ITEM_ID_PLAY;
 	if (dynamic_cast<const CExit*>(this)) return ITEM_ID_EXIT;
 
-	return ITEM_MAX; // zO
+	return ITEM_MAX; // 想定外
 }
 
 
 //=============================================================================
-// vCڂ̃RXgN^
+// プレイ項目のコンストラクタ
 //=============================================================================
 CPlay::CPlay()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// vCڂ̃fXgN^
+// プレイ項目のデストラクタ
 //=============================================================================
 CPlay::~CPlay()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// Ȉ
+// 選択時の処理
 //=============================================================================
 void CPlay::Execute(void)
 {
-	// Q[ʂɈڍs
+	// ゲーム画面に移行
 	CManager::GetFade()->SetFade(CScene::MODE_TUTORIAL);
 }
 
 
 //=============================================================================
-// ߂鍀ڂ̃RXgN^
+// やめる項目のコンストラクタ
 //=============================================================================
 CExit::CExit()
 {
-	// l̃NA
+	// 値のクリア
 
 }
 //=============================================================================
-// ߂鍀ڂ̃fXgN^
+// やめる項目のデストラクタ
 //=============================================================================
 CExit::~CExit()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// Ȉ
+// 選択時の処理
 //=============================================================================
 void CExit::Execute(void)
 {
-	//EBhEj
+	//ウィンドウを破棄する
 	PostQuitMessage(0);
 }
@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// ڏ [item.h]
+// 項目処理 [item.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _ITEM_H_// ̃}N`ĂȂ
-#define _ITEM_H_// 2dCN[hh~̃}N`
+#ifndef _ITEM_H_// このマクロ定義がされていなかったら
+#define _ITEM_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object2D.h"
 
 //*****************************************************************************
-// ڃNX
+// 項目クラス
 //*****************************************************************************
 class CItem : public CObject2D
 {
@@ -21,7 +21,7 @@ public:
 	CItem(int nPriority = 7);
 	~CItem();
 
-	// Iڂ̎
+	// 選択項目の種類
 	typedef enum
 	{
 		ITEM_ID_PLAY = 0,
@@ -47,20 +47,20 @@ public:
 		strcpy_s(m_szPath, MAX_PATH, path); 
 	}
 
-	// IԐݒE擾
+	// 選択状態設定・取得
 	void SetSelected(bool selected) { m_isSelected = selected; }
 	bool IsSelected(void) const { return m_isSelected; }
 	ITEM GetItemId(void) const;
 
 private:
-	int		m_nIdxTexture;				// eNX`CfbNX
-	char	m_szPath[MAX_PATH];			// t@CpX
-	bool	m_isSelected;				// I
+	int		m_nIdxTexture;				// テクスチャインデックス
+	char	m_szPath[MAX_PATH];			// ファイルパス
+	bool	m_isSelected;				// 選択したか
 
 };
 
 //*****************************************************************************
-// vCڃNX
+// プレイ項目クラス
 //*****************************************************************************
 class CPlay : public CItem
 {
@@ -75,7 +75,7 @@ private:
 };
 
 //*****************************************************************************
-// ߂鍀ڃNX
+// やめる項目クラス
 //*****************************************************************************
 class CExit : public CItem
 {
@@ -1,46 +1,46 @@
 //=============================================================================
 //
-// ڑI [itemselect.cpp]
+// 項目選択処理 [itemselect.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "itemselect.h"
 #include "manager.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 int CItemSelect::m_SelectedIndex = 0;
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CItemSelect::CItemSelect()
 {
-    // l̃NA
+    // 値のクリア
     m_inputLock = false;
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CItemSelect::~CItemSelect()
 {
-    // Ȃ
+    // なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 void CItemSelect::Init(void)
 {
-    // ɂ
+    // 空にする
     m_Item.clear();
 
-    // ̏ʒuiUpdateŏ㏑j
+    // 仮の初期位置（Updateで上書き）
     for (int nCnt = 0; nCnt < ITEM_NUM; nCnt++)
     {
         CItem* item = nullptr;
@@ -65,31 +65,31 @@ void CItemSelect::Init(void)
     m_inputLock = false;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CItemSelect::Uninit(void)
 {
-    // ɂ
+    // 空にする
     m_Item.clear();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CItemSelect::Update(void)
 {
-    // obNobt@TCY̎擾
+    // バックバッファサイズの取得
     float screenW = (float)CManager::GetRenderer()->GetBackBufferWidth();
     float screenH = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
-    // ɂ炷
+    // 横にずらす
     float baseX = screenW * ANCHOR_X;
     float startY = screenH * ANCHOR_Y;
 
-    // TCYʃTCYɔĒ
+    // サイズも画面サイズに伴って調整
     float itemW = screenW * ITEM_WRATE;
     float itemH = screenH * ITEM_HRATE;
 
-    // ڂ̈ʒuXV
+    // 項目の位置更新
     for (int nCnt = 0; nCnt < (int)m_Item.size(); nCnt++)
     {
         m_Item[nCnt]->SetSize(itemW, itemH);
@@ -105,22 +105,22 @@ void CItemSelect::Update(void)
 
     int mouseOver = GetMouseOverIndex();
 
-    // }EXI[o[̑IύXSE
+    // マウスオーバー時の選択変更＆SE
     if (mouseOver != -1 && mouseOver != m_SelectedIndex && CManager::GetFade()->GetFade() == CFade::FADE_NONE)
     {
         m_SelectedIndex = mouseOver;
 
-        // ISE
+        // 選択SE
         CManager::GetSound()->Play(CSound::SOUND_LABEL_SELECT);
     }
 
-    // Q[pbhł̏㉺ړ
+    // ゲームパッドでの上下移動
     bool up = CManager::GetInputJoypad()->GetTrigger(CInputJoypad::JOYKEY_UP);
     bool down = CManager::GetInputJoypad()->GetTrigger(CInputJoypad::JOYKEY_DOWN);
 
     if ((up || down) && !m_inputLock && CManager::GetFade()->GetFade() == CFade::FADE_NONE)
     {
-        // ISE
+        // 選択SE
         CManager::GetSound()->Play(CSound::SOUND_LABEL_SELECT);
 
         if (up)
@@ -149,18 +149,18 @@ void CItemSelect::Update(void)
         m_inputLock = false;
     }
 
-    // NbN܂̓Q[pbh{^Ŏs
+    // クリックまたはゲームパッドボタンで実行
     if (CManager::GetFade()->GetFade() == CFade::FADE_NONE)
     {
         bool confirm = false;
 
-        // }EXNbN
+        // マウスクリック
         if (mouseOver != -1 && CManager::GetInputMouse()->GetTrigger(0))
         {
             confirm = true;
         }
 
-        // Q[pbh
+        // ゲームパッド
         if (CManager::GetInputJoypad()->GetTrigger(CInputJoypad::JOYKEY_A))
         {
             confirm = true;
@@ -168,28 +168,28 @@ void CItemSelect::Update(void)
 
         if (confirm)
         {
-            // SE
+            // 決定SE
             CManager::GetSound()->Play(CSound::SOUND_LABEL_ENTER);
 
-            // I΂ꂽXe[WIDۑ
+            // 選ばれたステージIDを保存
             SetSelectedItem(m_Item[m_SelectedIndex]->GetItemId());
 
-            // eڂ̑I
+            // 各項目の選択時処理
             m_Item[m_SelectedIndex]->Execute();
         }
     }
 
-    // IԍXV
+    // 選択状態更新
     for (size_t nCnt = 0; nCnt < m_Item.size(); nCnt++)
     {
         m_Item[nCnt]->SetSelected(nCnt == static_cast<size_t>(m_SelectedIndex));
 
-        // Xe[W̍XV
+        // ステージの更新処理
         m_Item[nCnt]->Update();
     }
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CItemSelect::Draw(void)
 {
@@ -202,7 +202,7 @@ void CItemSelect::Draw(void)
     }
 }
 //=============================================================================
-// }EXI
+// マウス選択処理
 //=============================================================================
 int CItemSelect::GetMouseOverIndex(void) const
 {
@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// ڑI [itemselect.h]
+// 項目選択処理 [itemselect.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _ITEMSELECT_H_// ̃}N`ĂȂ
-#define _ITEMSELECT_H_// 2dCN[hh~̃}N`
+#ifndef _ITEMSELECT_H_// このマクロ定義がされていなかったら
+#define _ITEMSELECT_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "item.h"
 
 //*****************************************************************************
-// ڑINX
+// 項目選択クラス
 //*****************************************************************************
 class CItemSelect
 {
@@ -21,10 +21,10 @@ public:
     CItemSelect();
     ~CItemSelect();
 
-    void Init(void);                    // 
+    void Init(void);                    // 初期化
     void Uninit(void);
-    void Update(void);                  // XVi͏j
-    void Draw(void);                    // `
+    void Update(void);                  // 更新（入力処理）
+    void Draw(void);                    // 描画
 
     static void SetSelectedItem(int id) { m_SelectedIndex = id; }
     static int GetSelectedItem(void) { return m_SelectedIndex; }
@@ -33,19 +33,19 @@ private:
     int GetMouseOverIndex(void) const;
 
 private:
-    static constexpr float ITEM_NUM         = 2;        // ڐ
-    static constexpr float ITEM_W           = 150.0f;   // ڂ̕
-    static constexpr float ITEM_H           = 60.0f;    // ڂ̍
-    static constexpr float SPACING_Y        = 140.0f;   // ڂ̊Ԋu
-    static constexpr float ANCHOR_X         = 0.3f;     // ʒui%j
-    static constexpr float ANCHOR_Y         = 0.6f;     // cʒui%j
-    static constexpr float ITEM_WRATE       = 0.09f;    // ʕ̂ɑ΂Ă̍ڕ
-    static constexpr float ITEM_HRATE       = 0.06f;    // ʍɑ΂Ă̍ڍ
-
-
-    std::vector<CItem*> m_Item;                         // 
-    static int          m_SelectedIndex;                // ICfbNX
-    bool                m_inputLock;                    // ͐tO
+    static constexpr float ITEM_NUM         = 2;        // 項目数
+    static constexpr float ITEM_W           = 150.0f;   // 項目の幅
+    static constexpr float ITEM_H           = 60.0f;    // 項目の高さ
+    static constexpr float SPACING_Y        = 140.0f;   // 項目の間隔
+    static constexpr float ANCHOR_X         = 0.3f;     // 横位置（%）
+    static constexpr float ANCHOR_Y         = 0.6f;     // 縦位置（%）
+    static constexpr float ITEM_WRATE       = 0.09f;    // 画面幅のに対しての項目幅率
+    static constexpr float ITEM_HRATE       = 0.06f;    // 画面高さに対しての項目高さ率
+
+
+    std::vector<CItem*> m_Item;                         // 項目
+    static int          m_SelectedIndex;                // 選択したインデックス
+    bool                m_inputLock;                    // 入力制限フラグ
 
 };
 
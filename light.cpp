@@ -1,91 +1,114 @@
 //=============================================================================
 //
-// Cg [light.cpp]
+// ライト処理 [light.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "light.h"
 #include "renderer.h"
 #include "manager.h"
 #include "objectBillboard.h"
+#include "algorithm"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
+std::vector<CLight::LightInfo> CLight::m_lights;
 int CLight::m_lightCount = 0;
-CLight::LightInfo CLight::m_lights[MAX_LIGHTS] = {};
 CObjectX* CLight::m_pObjectX = nullptr;
+std::unordered_map<int, std::vector<int>> CLight::m_grid;
+float CLight::m_fMaxRange = 0.0f;
+bool CLight::m_bGridDirty = true;
+D3DLIGHT9 CLight::m_aDeviceLight[MAX_DEVICE_LIGHT] = {};
+int CLight::m_anDeviceIndex[MAX_DEVICE_LIGHT] = {};
+bool CLight::m_abDeviceEnable[MAX_DEVICE_LIGHT] = {};
+bool CLight::m_bDeviceValid = false;
+D3DXVECTOR3 CLight::m_regionCenter = INIT_VEC3;
+float CLight::m_fRegionRadius = REGION_RADIUS;
+D3DXVECTOR3 CLight::m_viewCenter = INIT_VEC3;
+bool CLight::m_bSelectDirty = true;
+int CLight::m_nActiveNum = 0;
+std::vector<std::pair<float, int>> CLight::m_candidates;
+std::vector<int> CLight::m_freeList;
+unsigned int CLight::m_nGeneration = 0;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CLight::CLight()
 {
-	// l̃NA
+	// 値のクリア
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CLight::~CLight()
 {
-	// Cg̏I
+	// ライトの終了処理
 	Uninit();
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CLight::Init(void)
 {
+	m_lights.clear();
+	m_freeList.clear();
 	m_lightCount = 0;
-
-	for (int nCnt = 0; nCnt < MAX_LIGHTS; nCnt++)
-	{
-		m_lights[nCnt].enabled = false;
-	}
+	m_bGridDirty = true;
+	m_bSelectDirty = true;
+	m_nGeneration++;
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理(登録を全て消す。デバイスは次のApplyで無効にする)
 //=============================================================================
 void CLight::Uninit(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	for (int nCnt = 0; nCnt < MAX_LIGHTS; nCnt++)
-	{
-		if (m_lights[nCnt].enabled)
-		{
-			pDevice->LightEnable(nCnt, FALSE);
-			m_lights[nCnt].enabled = false;
-		}
-	}
-
+	m_lights.clear();
+	m_freeList.clear();
 	m_lightCount = 0;
+	m_bGridDirty = true;
+	m_bSelectDirty = true;
+
+	// 以前に受け取った番号を無効にする
+	m_nGeneration++;
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CLight::Update(void)
 {
-    // Ȃ
+    // なし
 }
 //=============================================================================
-// Cg̒ǉ
+// ライトの追加処理
 //=============================================================================
 int CLight::AddLight(D3DLIGHTTYPE type, const D3DXCOLOR& diffuse, const D3DXVECTOR3& direction, const D3DXVECTOR3& position)
 {
-    if (m_lightCount >= MAX_LIGHTS)
+    int index = -1;
+
+    if (!m_freeList.empty())
+    {// 削除して空いた番号を使い回す
+        index = m_freeList.back();
+        m_freeList.pop_back();
+    }
+    else
     {
-        return -1;
+        if ((int)m_lights.size() >= MAX_LIGHTS)
+        {
+            return -1;
+        }
+
+        index = (int)m_lights.size();
+        m_lights.push_back(LightInfo());
     }
 
-    int index = m_lightCount;
     LightInfo& lightInfo = m_lights[index];
 
     ZeroMemory(&lightInfo.light, sizeof(D3DLIGHT9));
@@ -97,7 +120,7 @@ int CLight::AddLight(D3DLIGHTTYPE type, const D3DXCOLOR& diffuse, const D3DXVECT
     D3DXVECTOR3 dir = direction;
     if (D3DXVec3Length(&dir) == 0.0f)
     {
-        dir = D3DXVECTOR3(0, -1, 0); // ftHg
+        dir = D3DXVECTOR3(0, -1, 0); // デフォルト下向き
     }
 
     D3DXVec3Normalize(&lightInfo.direction, &dir);
@@ -105,12 +128,12 @@ int CLight::AddLight(D3DLIGHTTYPE type, const D3DXCOLOR& diffuse, const D3DXVECT
 
 //#ifdef _DEBUG
 //
-//    // Cgpf̐
+//    // ライト用モデルの生成
 //    m_pObjectX = CObjectX::Create("data/MODELS/light.x", position, lightInfo.light.Direction, D3DXVECTOR3(1.0f, 1.0f, 1.0f));
 //
 //#endif // DEBUG
 
-    // Cg̎ނɉݒ
+    // ライトの種類に応じた設定
     if (type == D3DLIGHT_POINT)
     {
         lightInfo.light.Attenuation0 = 0.0f;
@@ -121,81 +144,376 @@ int CLight::AddLight(D3DLIGHTTYPE type, const D3DXCOLOR& diffuse, const D3DXVECT
     else if (type == D3DLIGHT_SPOT)
     {
         lightInfo.light.Range = 100.0f;
-        lightInfo.light.Theta = D3DXToRadian(70.0f);  // 邭Ƃ炷͈́iSj
-        lightInfo.light.Phi = D3DXToRadian(95.0f);  // ĂO        
+        lightInfo.light.Theta = D3DXToRadian(70.0f);  // 明るく照らす範囲（中心）
+        lightInfo.light.Phi = D3DXToRadian(95.0f);  // 減衰していく外側        
         lightInfo.light.Falloff = 1.0f;
         lightInfo.light.Attenuation0 = 1.0f;
-        lightInfo.light.Attenuation1 = 0.003f;    // ɂ₩Ȍ
+        lightInfo.light.Attenuation1 = 0.003f;    // 緩やかな減衰
         lightInfo.light.Attenuation2 = 0.0f;
     }
 
-    // foCX̎擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-    pDevice->SetLight(index, &lightInfo.light);
-    pDevice->LightEnable(index, TRUE);
-
+    // デバイスへの設定はApplyで選ばれた時だけ行う
     lightInfo.enabled = true;
+    lightInfo.used = true;
+    m_bGridDirty = true;
+    m_bSelectDirty = true;
 
-    // Cg̃JEg𑝂₷
+    // ライトのカウントを増やす
     m_lightCount++;
 
     return index;
 }
 //=============================================================================
-// Cg̍폜
+// ライトの削除処理
 //=============================================================================
 void CLight::DeleteLight(int index)
 {
-    if (index >= 0 && index < MAX_LIGHTS && m_lights[index].enabled)
+    if (index < 0 || index >= (int)m_lights.size() || !m_lights[index].used)
     {
-        // foCX̎擾
-        LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+        return;
+    }
 
-        // CgItɂ
-        pDevice->LightEnable(index, FALSE);
+    if (m_lights[index].enabled)
+    {
+        // ライトをオフにする(デバイスは次のApplyで無効にする)
         m_lights[index].enabled = false;
+        m_bGridDirty = true;
+        m_bSelectDirty = true;
 
-        // Cg̃JEg炷
+        // ライトのカウントを減らす
         m_lightCount--;
     }
+
+    // 番号を空きに戻す
+    m_lights[index].used = false;
+    m_freeList.push_back(index);
+}
+//=============================================================================
+// ライトの色の変更処理(登録したまま値だけ書き換える)
+//=============================================================================
+void CLight::SetLightDiffuse(int index, const D3DXCOLOR& diffuse)
+{
+    if (index < 0 || index >= (int)m_lights.size() || !m_lights[index].used)
+    {
+        return;
+    }
+
+    m_lights[index].light.Diffuse = diffuse;
+    m_bSelectDirty = true;
 }
 //=============================================================================
-// ݂̃Cg擾鏈
+// ライトの向きの変更処理
 //=============================================================================
-std::vector<CLight::LightInfo> CLight::GetCurrentLights(void)
+void CLight::SetLightDirection(int index, const D3DXVECTOR3& direction)
 {
-    std::vector<LightInfo> backup;
+    if (index < 0 || index >= (int)m_lights.size() || !m_lights[index].used)
+    {
+        return;
+    }
 
-    for (int nCnt = 0; nCnt < m_lightCount; nCnt++)
+    D3DXVECTOR3 dir = direction;
+    if (D3DXVec3Length(&dir) == 0.0f)
     {
-        if (m_lights[nCnt].enabled)
+        dir = D3DXVECTOR3(0, -1, 0); // デフォルト下向き
+    }
+
+    D3DXVec3Normalize(&m_lights[index].direction, &dir);
+    m_lights[index].light.Direction = m_lights[index].direction;
+    m_bSelectDirty = true;
+}
+//=============================================================================
+// ライトの位置の変更処理(マスが変わるので空間分割を作り直す)
+//=============================================================================
+void CLight::SetLightPosition(int index, const D3DXVECTOR3& position)
+{
+    if (index < 0 || index >= (int)m_lights.size() || !m_lights[index].used)
+    {
+        return;
+    }
+
+    m_lights[index].position = position;
+    m_lights[index].light.Position = position;
+    m_bGridDirty = true;
+    m_bSelectDirty = true;
+}
+//=============================================================================
+// ライトの有効・無効の切り替え処理(番号は残したまま選ばれなくする)
+//=============================================================================
+void CLight::SetLightEnable(int index, bool enable)
+{
+    if (index < 0 || index >= (int)m_lights.size() || !m_lights[index].used || m_lights[index].enabled == enable)
+    {
+        return;
+    }
+
+    m_lights[index].enabled = enable;
+    m_lightCount += enable ? 1 : -1;
+    m_bGridDirty = true;
+    m_bSelectDirty = true;
+}
+//=============================================================================
+// 空間分割の作り直し処理(点・スポットライトを位置のマスに入れる)
+//=============================================================================
+void CLight::BuildGrid(void)
+{
+    m_grid.clear();
+    m_fMaxRange = 0.0f;
+
+    for (int nCnt = 0; nCnt < (int)m_lights.size(); nCnt++)
+    {
+        const LightInfo& info = m_lights[nCnt];
+
+        if (!info.enabled || info.light.Type == D3DLIGHT_DIRECTIONAL)
+        {
+            continue;
+        }
+
+        int key = MakeCellKey(GetCellIndex(info.position.x), GetCellIndex(info.position.z));
+        m_grid[key].push_back(nCnt);
+
+        m_fMaxRange = std::max(m_fMaxRange, info.light.Range);
+    }
+
+    m_bGridDirty = false;
+}
+//=============================================================================
+// ライトの選択処理(平行光源を優先し、残りは領域の中心に近い順。戻り値は選んだ数)
+//=============================================================================
+int CLight::SelectLights(const D3DXVECTOR3& center, float fRadius, int* pOut)
+{
+    int nNum = 0;
+
+    // 平行光源はどこにでも届くので先に入れる
+    for (int nCnt = 0; nCnt < (int)m_lights.size() && nNum < MAX_DEVICE_LIGHT; nCnt++)
+    {
+        if (m_lights[nCnt].enabled && m_lights[nCnt].light.Type == D3DLIGHT_DIRECTIONAL)
+        {
+            pOut[nNum++] = nCnt;
+        }
+    }
+
+    if (nNum >= MAX_DEVICE_LIGHT || m_grid.empty())
+    {
+        return nNum;
+    }
+
+    // 領域に届く可能性があるマスだけ調べる
+    float fReach = fRadius + m_fMaxRange;
+
+    int nMinX = GetCellIndex(center.x - fReach);
+    int nMaxX = GetCellIndex(center.x + fReach);
+    int nMinZ = GetCellIndex(center.z - fReach);
+    int nMaxZ = GetCellIndex(center.z + fReach);
+
+    m_candidates.clear();
+
+    for (int nZ = nMinZ; nZ <= nMaxZ; nZ++)
+    {
+        for (int nX = nMinX; nX <= nMaxX; nX++)
+        {
+            auto it = m_grid.find(MakeCellKey(nX, nZ));
+
+            if (it == m_grid.end())
+            {
+                continue;
+            }
+
+            for (int index : it->second)
+            {
+                const LightInfo& info = m_lights[index];
+
+                D3DXVECTOR3 diff = info.position - center;
+                float fDist = D3DXVec3Length(&diff);
+
+                // 光の届く範囲が領域に掛からなければ選ばない
+                if (fDist - info.light.Range > fRadius)
+                {
+                    continue;
+                }
+
+                m_candidates.push_back(std::make_pair(fDist, index));
+            }
+        }
+    }
+
+    // 近い順に空いている数だけ選ぶ
+    int nRest = std::min(MAX_DEVICE_LIGHT - nNum, (int)m_candidates.size());
+
+    std::partial_sort(m_candidates.begin(), m_candidates.begin() + nRest, m_candidates.end());
+
+    for (int nCnt = 0; nCnt < nRest; nCnt++)
+    {
+        pOut[nNum++] = m_candidates[nCnt].second;
+    }
+
+    return nNum;
+}
+//=============================================================================
+// デバイスへの反映処理(描画する物の境界球に届くライトを選び、前回と違うものだけ設定する。
+// 続けて選ばれたライトは同じ番号に残すので、近くの物を続けて描く時はほとんど設定し直さない。
+// 戻り値はデバイスのライトを変えたか)
+//=============================================================================
+bool CLight::Apply(const D3DXVECTOR3& center, float fRadius, CRenderDevice* pDevice)
+{
+    // 同じ領域を続けて選ぶ時は何もしない
+    if (m_bDeviceValid && !m_bSelectDirty && center == m_regionCenter && fRadius == m_fRegionRadius)
+    {
+        return false;
+    }
+
+    if (m_bGridDirty)
+    {
+        BuildGrid();
+    }
+
+    m_regionCenter = center;
+    m_fRegionRadius = fRadius;
+    m_bSelectDirty = false;
+
+    int aSelect[MAX_DEVICE_LIGHT];
+    int nNum = SelectLights(center, fRadius, aSelect);
+
+    // 前回と同じライトは同じ番号に残し、新しいものは空いた番号に入れる
+    int aSlot[MAX_DEVICE_LIGHT];
+    bool abPlaced[MAX_DEVICE_LIGHT] = {};
+
+    for (int nSlot = 0; nSlot < MAX_DEVICE_LIGHT; nSlot++)
+    {
+        aSlot[nSlot] = -1;
+
+        for (int nCnt = 0; m_bDeviceValid && nCnt < nNum; nCnt++)
+        {
+            if (!abPlaced[nCnt] && aSelect[nCnt] == m_anDeviceIndex[nSlot])
+            {
+                aSlot[nSlot] = aSelect[nCnt];
+                abPlaced[nCnt] = true;
+                break;
+            }
+        }
+    }
+
+    int nFree = 0;
+
+    for (int nCnt = 0; nCnt < nNum; nCnt++)
+    {
+        if (abPlaced[nCnt])
+        {
+            continue;
+        }
+
+        while (aSlot[nFree] != -1)
+        {
+            nFree++;
+        }
+
+        aSlot[nFree] = aSelect[nCnt];
+    }
+
+    // 描画デバイスの取得(記録中なら記録にも残る)
+    if (pDevice == nullptr)
+    {
+        pDevice = CManager::GetRenderer()->GetBackend();
+    }
+
+    bool bChanged = false;
+
+    for (int nSlot = 0; nSlot < MAX_DEVICE_LIGHT; nSlot++)
+    {
+        if (aSlot[nSlot] != -1)
+        {
+            const D3DLIGHT9& light = m_lights[aSlot[nSlot]].light;
+
+            if (!m_bDeviceValid || memcmp(&m_aDeviceLight[nSlot], &light, sizeof(D3DLIGHT9)) != 0)
+            {
+                pDevice->SetLight(nSlot, &light);
+                m_aDeviceLight[nSlot] = light;
+                bChanged = true;
+                CTelemetry::Add(CTelemetry::COUNTER_LIGHT_UPLOAD);// ライト設定回数の計測
+            }
+
+            if (!m_bDeviceValid || !m_abDeviceEnable[nSlot])
+            {
+                pDevice->LightEnable(nSlot, TRUE);
+                m_abDeviceEnable[nSlot] = true;
+                bChanged = true;
+                CTelemetry::Add(CTelemetry::COUNTER_LIGHT_UPLOAD);// ライト設定回数の計測
+            }
+        }
+        else if (!m_bDeviceValid || m_abDeviceEnable[nSlot])
         {
-            LightInfo b;
-            b.light = m_lights[nCnt].light;
-            b.direction = m_lights[nCnt].direction;
-            b.position = m_lights[nCnt].position;
-            b.enabled = m_lights[nCnt].enabled;
-            backup.push_back(b);
+            pDevice->LightEnable(nSlot, FALSE);
+            m_abDeviceEnable[nSlot] = false;
+            bChanged = true;
+            CTelemetry::Add(CTelemetry::COUNTER_LIGHT_UPLOAD);// ライト設定回数の計測
         }
+
+        m_anDeviceIndex[nSlot] = aSlot[nSlot];
     }
+
+    m_bDeviceValid = true;
+    m_nActiveNum = nNum;
+
+    return bChanged;
+}
+//=============================================================================
+// 注視点の周りのライトの反映処理(毎フレームの初めに呼ぶ。物ごとに選ばない描画はこの選択で描く)
+//=============================================================================
+void CLight::ApplyView(const D3DXVECTOR3& center)
+{
+    m_viewCenter = center;
+    Apply(center, REGION_RADIUS);
+}
+//=============================================================================
+// 注視点の周りのライトに戻す処理(物ごとに選び直した描画の後に呼ぶ)
+//=============================================================================
+void CLight::RestoreView(CRenderDevice* pDevice)
+{
+    Apply(m_viewCenter, REGION_RADIUS, pDevice);
+}
+//=============================================================================
+// デバイスの設定を忘れる処理(デバイスリセット後に全て設定し直す)
+//=============================================================================
+void CLight::InvalidateDevice(void)
+{
+    m_bDeviceValid = false;
+}
+//=============================================================================
+// 現在のライトを取得する処理
+//=============================================================================
+CLight::Backup CLight::GetCurrentLights(void)
+{
+    Backup backup;
+    backup.lights = m_lights;
+    backup.nGeneration = m_nGeneration;
+
     return backup;
 }
 //=============================================================================
-// ꎞIɃCgޔ鏈
+// 一時的にライトを退避する処理(番号と世代も元に戻すので、持ち主は登録し直さなくてよい)
 //=============================================================================
-void CLight::RestoreLights(const std::vector<LightInfo>& backup)
+void CLight::RestoreLights(const Backup& backup)
 {
-    Uninit(); // xS폜Ă
+    m_lights = backup.lights;
+    m_nGeneration = backup.nGeneration;
+    m_bGridDirty = true;
+    m_bSelectDirty = true;
+
+    m_lightCount = 0;
+    m_freeList.clear();
 
-    for (const auto& b : backup)
+    for (int nCnt = 0; nCnt < (int)m_lights.size(); nCnt++)
     {
-        int index = AddLight(b.light.Type,
-            D3DXCOLOR(b.light.Diffuse),
-            b.direction,
-            b.position);
-        // D3DLIGHT9\̂㏑ĊS
-        m_lights[index].light = b.light;
-        m_lights[index].enabled = b.enabled;
+        if (m_lights[nCnt].enabled)
+        {
+            m_lightCount++;
+        }
+
+        if (!m_lights[nCnt].used)
+        {
+            m_freeList.push_back(nCnt);
+        }
     }
+
+    // 退避前と同じ領域で選び直してすぐに戻す
+    Apply(m_regionCenter, m_fRegionRadius);
 }
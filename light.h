@@ -1,19 +1,20 @@
 //=============================================================================
 //
-// Cg [light.h]
+// ライト処理 [light.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _LIGHT_H_// ̃}N`ĂȂ
-#define _LIGHT_H_// 2dCN[hh~̃}N`
+#ifndef _LIGHT_H_// このマクロ定義がされていなかったら
+#define _LIGHT_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "objectX.h"
+#include "unordered_map"
 
 //*****************************************************************************
-// CgNX
+// ライトクラス(登録したライトから、描画する物の境界球ごとに影響の大きい8個だけをデバイスに設定する)
 //*****************************************************************************
 class CLight
 {
@@ -24,8 +25,16 @@ private:
         D3DXVECTOR3 direction;
         D3DXVECTOR3 position;
         bool        enabled;
+        bool        used;       // 番号が使われているか(削除した番号は次の追加で使い回す)
     }LightInfo;
 
+    // 退避したライト(番号を保ったまま戻すため無効なものも含めて丸ごと持つ)
+    typedef struct
+    {
+        std::vector<LightInfo> lights;
+        unsigned int           nGeneration;
+    }Backup;
+
 public:
 	CLight();
 	~CLight();
@@ -34,17 +43,51 @@ public:
 	static void Uninit(void);
 	void Update(void);
 	static int AddLight(D3DLIGHTTYPE type, const D3DXCOLOR& diffuse, const D3DXVECTOR3& direction, const D3DXVECTOR3& position);
-	void DeleteLight(int index); // Cg폜
-    static std::vector<LightInfo> GetCurrentLights(void);
-    static void RestoreLights(const std::vector<LightInfo>& backup);
+	static void DeleteLight(int index); // ライト削除
+    static void SetLightDiffuse(int index, const D3DXCOLOR& diffuse);
+    static void SetLightDirection(int index, const D3DXVECTOR3& direction);
+    static void SetLightPosition(int index, const D3DXVECTOR3& position);
+    static void SetLightEnable(int index, bool enable);
+    static bool Apply(const D3DXVECTOR3& center, float fRadius = REGION_RADIUS, CRenderDevice* pDevice = nullptr);
+    static void ApplyView(const D3DXVECTOR3& center);
+    static void RestoreView(CRenderDevice* pDevice = nullptr);
+    static void InvalidateDevice(void);
+    static Backup GetCurrentLights(void);
+    static void RestoreLights(const Backup& backup);
     static int GetLightNum(void) { return m_lightCount; }
+    static int GetActiveNum(void) { return m_nActiveNum; }
+    static unsigned int GetGeneration(void) { return m_nGeneration; }
 
 private:
-    static constexpr int MAX_LIGHTS = 32;       // Cg̍ő吔
+    static constexpr int   MAX_LIGHTS       = 256;      // 登録できるライトの最大数
+    static constexpr int   MAX_DEVICE_LIGHT = 8;        // 固定機能で有効にできるライトの数
+    static constexpr float CELL_SIZE        = 512.0f;   // 空間分割の1マスの大きさ
+    static constexpr int   CELL_BIAS        = 0x8000;   // マス番号を正の値にするための補正
+    static constexpr float REGION_RADIUS    = 1000.0f;  // ライトを選ぶ領域の半径の初期値
+
+    static void BuildGrid(void);
+    static int SelectLights(const D3DXVECTOR3& center, float fRadius, int* pOut);
+    static int GetCellIndex(float fPos) { return (int)floorf(fPos / CELL_SIZE); }
+    static int MakeCellKey(int nX, int nZ) { return ((nX + CELL_BIAS) & 0xffff) | (((nZ + CELL_BIAS) & 0xffff) << 16); }
 
-    static LightInfo    m_lights[MAX_LIGHTS];   // Cg
-    static int          m_lightCount;           // CgJEg
-    static CObjectX*    m_pObjectX;             // Xt@CIuWFNgւ̃|C^
+    static std::vector<LightInfo>                   m_lights;                               // ライト情報
+    static int                                      m_lightCount;                           // ライトカウント
+    static CObjectX*                                m_pObjectX;                             // Xファイルオブジェクトへのポインタ
+    static std::unordered_map<int, std::vector<int>> m_grid;                                // マスごとの点・スポットライトの番号
+    static float                                    m_fMaxRange;                            // 点・スポットライトの最大の範囲
+    static bool                                     m_bGridDirty;                           // 空間分割の作り直しが必要か
+    static D3DLIGHT9                                m_aDeviceLight[MAX_DEVICE_LIGHT];       // デバイスに設定済みのライト
+    static int                                      m_anDeviceIndex[MAX_DEVICE_LIGHT];      // デバイスの各番号に入れたライトの番号(-1 : 空き)
+    static bool                                     m_abDeviceEnable[MAX_DEVICE_LIGHT];     // デバイスで有効にしているか
+    static bool                                     m_bDeviceValid;                         // デバイスの設定を覚えているか
+    static D3DXVECTOR3                              m_regionCenter;                         // 前回選んだ領域の中心
+    static float                                    m_fRegionRadius;                        // 前回選んだ領域の半径
+    static D3DXVECTOR3                              m_viewCenter;                           // 物ごとに選ばない描画に使う注視点
+    static bool                                     m_bSelectDirty;                         // 登録内容が変わって選び直しが必要か
+    static int                                      m_nActiveNum;                           // 有効にしたライトの数
+    static std::vector<std::pair<float, int>>       m_candidates;                           // 選ぶ途中の候補(距離と番号)
+    static std::vector<int>                         m_freeList;                             // 削除して空いた番号
+    static unsigned int                             m_nGeneration;                          // 登録を全て消した回数(保持している番号が有効かの判定用)
 };
 
 #endif
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// C [main.cpp]
+// メイン処理 [main.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "main.h"
 #include "renderer.h"
@@ -18,182 +18,279 @@
 #include "tchar.h"
 #include "stdio.h"
 #include "imguimaneger.h"
+#include "culling.h"
+#include "assetloader.h"
+#include "texturecooker.h"
+#include "meshcooker.h"
+#include "particlesystem.h"
+#include "random.h"
+#include "meshOrbit.h"
+#include "billboardrenderer.h"
+#include "spritebatch.h"
+#include "thumbnailcache.h"
+#include "renderqueue.h"
+#include "memorymanager.h"
+#include "terrainlod.h"
 
 //*****************************************************************************
-// vg^Cv錾
+// プロトタイプ宣言
 //*****************************************************************************
 LRESULT CALLBACK WindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
 //=============================================================================
-// C֐
+// メイン関数
 //=============================================================================
 int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE /*hInstancePrev*/, _In_ LPSTR /*lpCmdLine*/, _In_ int /*nCmdShow*/)
 {
-	// [Nm
+	// メモリリーク検知
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF | _CRTDBG_CHECK_ALWAYS_DF);
-	//_CrtSetBreakAlloc(12455);// [Ň̃CX^XɋIɃu[N|Cg𔭐
+	//_CrtSetBreakAlloc(12455);// リークの原因のインスタンス生成に強制的にブレークポイントを発生させる
 
-	int nCountFPS = 0;// FPSJE^[
+	// カリングのベンチマーク(ウィンドウもデバイスも作らずに計測して終了する)
+	if (strstr(GetCommandLineA(), "-cullbench") != nullptr)
+	{
+		return CCulling::RunBenchmark("cullbench.txt") ? 0 : -1;
+	}
+
+	// パーティクルのベンチマーク(5万粒子の更新と頂点の書き込みを計測して終了する)
+	if (strstr(GetCommandLineA(), "-particlebench") != nullptr)
+	{
+		return CParticleSystem::RunBenchmark("particlebench.txt") ? 0 : -1;
+	}
+
+	// エフェクト予算の確認(大量に出し続けて全体と種類ごとの上限が守られるかを調べて終了する)
+	if (strstr(GetCommandLineA(), "-budgettest") != nullptr)
+	{
+		return CEffectBudget::RunTest("budgettest.txt") ? 0 : -1;
+	}
+
+	// 軌跡のベンチマーク(頂点をずらす方法とリングの結果・ロック回数・曲線の滑らかさを比べて終了する)
+	if (strstr(GetCommandLineA(), "-orbitbench") != nullptr)
+	{
+		return CMeshOrbit::RunBenchmark("orbitbench.txt") ? 0 : -1;
+	}
+
+	// ビルボードのベンチマーク(1つずつ描く時の計算と、並べ替えて1つの頂点バッファへ書く時の結果と速さを比べて終了する)
+	if (strstr(GetCommandLineA(), "-billboardbench") != nullptr)
+	{
+		return CBillboardRenderer::RunBenchmark("billboardbench.txt") ? 0 : -1;
+	}
+
+	// 2Dスプライトの確認(HUDを1つずつ描く時とまとめた時の描画回数を比べ、重なりの順番が守られるかを調べて終了する)
+	if (strstr(GetCommandLineA(), "-spritetest") != nullptr)
+	{
+		return CSpriteBatch::RunTest("spritetest.txt") ? 0 : -1;
+	}
+
+	// 乱数の確認(偏りと系列ごとの再現性を調べ、rand()との速さを比べて終了する)
+	if (strstr(GetCommandLineA(), "-randtest") != nullptr)
+	{
+		return CRandom::RunTest("randtest.txt") ? 0 : -1;
+	}
+
+	// テクスチャの事前変換(変わった画像だけDDSにして終了する)
+	if (strstr(GetCommandLineA(), "-cooktex") != nullptr)
+	{
+		return CTextureCooker::Run("cooktex.txt") ? 0 : -1;
+	}
+
+	// メッシュの事前変換(全ての.xを.xmbにし、読み戻しの確認と読み込み時間の比較をして終了する)
+	if (strstr(GetCommandLineA(), "-cookmesh") != nullptr)
+	{
+		return CMeshCooker::Run("cookmesh.txt") ? 0 : -1;
+	}
+
+	// 読み込み処理の確認(ワーカーでの読み込み結果を同期読み込みと比べて終了する)
+	if (strstr(GetCommandLineA(), "-loadtest") != nullptr)
+	{
+		return CAssetLoader::RunSelfTest("loadtest.txt") ? 0 : -1;
+	}
+
+	// サムネイルキャッシュの確認(デバイスを作らずにファイル形式と有効判定を確かめて終了する)
+	if (strstr(GetCommandLineA(), "-thumbtest") != nullptr)
+	{
+		return CThumbnailCache::RunTest("thumbtest.txt") ? 0 : -1;
+	}
+
+	// 描画キューの計測(デバイスを作らずにキュー無しとキュー有りの描画を記録デバイスへ流し、ステート変更とシェーダー切り替えの回数を比べて終了する)
+	if (strstr(GetCommandLineA(), "-queuebench") != nullptr)
+	{
+		return CRenderQueue::RunBenchmark("queuebench.txt") ? 0 : -1;
+	}
+
+	// 地形LODの確認(LODの境目・半端なチャンクの最大LOD・辺の間隔の全組み合わせで隙間や潰れた三角形が無いかを調べて終了する)
+	if (strstr(GetCommandLineA(), "-lodtest") != nullptr)
+	{
+		return CTerrainLod::RunTest("lodtest.txt") ? 0 : -1;
+	}
+
+	// 汎用ヒープ確保の検査(毎フレームの一時データの扱いを回し、定常状態で汎用ヒープから確保したら失敗にして終了する)
+	if (strstr(GetCommandLineA(), "-heapcheck") != nullptr)
+	{
+		return CMemoryManager::RunHeapCheck("heapcheck.txt") ? 0 : -1;
+	}
+
+	int nCountFPS = 0;// FPSカウンター
 
 	CManager* pManager = nullptr;
 
-	// }l[W[̐
+	// マネージャーの生成
 	pManager = new CManager;
 
 	pManager->GetFPS(nCountFPS);
 
-	DWORD dwCurrentTime;// ݎ
-	DWORD dwExecLastTime;// Ōɏ
+	DWORD dwCurrentTime;// 現在時刻
+	DWORD dwExecLastTime;// 最後に処理した時刻
 
 	WNDCLASSEX wcex =
 	{
-		sizeof(WNDCLASSEX),             // WNDCLASSEX̃TCY
-		CS_CLASSDC,                     // EBhẼX^C
-		WindowProc,                     // EBhEvV[W
-		0,                              // 0ɂ(ʏ͎gpȂ)
-		0,                              // 0ɂ
-		hInstance,                      // CX^Xnh
-		LoadIcon(NULL,IDI_APPLICATION), // ^XNo[̃ACR
-		LoadCursor(NULL,IDC_ARROW),     // }EXJ[\
-		(HBRUSH)(COLOR_WINDOW + 1),     // NCAg̈̔wiF
-		NULL,                           // j[o[
-		CLASS_NAME,                     // EBhENX̖O
-		LoadIcon(NULL,IDI_APPLICATION)  // t@C̃ACR
+		sizeof(WNDCLASSEX),             // WNDCLASSEXのメモリサイズ
+		CS_CLASSDC,                     // ウィンドウのスタイル
+		WindowProc,                     // ウィンドウプロシージャ
+		0,                              // 0にする(通常は使用しない)
+		0,                              // 0にする
+		hInstance,                      // インスタンスハンドル
+		LoadIcon(NULL,IDI_APPLICATION), // タスクバーのアイコン
+		LoadCursor(NULL,IDC_ARROW),     // マウスカーソル
+		(HBRUSH)(COLOR_WINDOW + 1),     // クライアント領域の背景色
+		NULL,                           // メニューバー
+		CLASS_NAME,                     // ウィンドウクラスの名前
+		LoadIcon(NULL,IDI_APPLICATION)  // ファイルのアイコン
 	};
 
 
-	HWND hWnd;   // EBhEnh
-	MSG msg;     // bZ[Wi[ϐ
+	HWND hWnd;   // ウィンドウハンドル
+	MSG msg;     // メッセージを格納する変数
 
 	RECT rect = { 0,0,SCREEN_WIDTH,SCREEN_HEIGHT };
 
-	// EBhENX̓o^
+	// ウィンドウクラスの登録
 	RegisterClassEx(&wcex);
 
-	// NCAg̈w̃TCYɒ
+	// クライアント領域を指定のサイズに調整
 	AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, FALSE);
 
-	// EBhE𐶐
-	hWnd = CreateWindowEx(0,    // gEBhEX^C
-		CLASS_NAME,             // EBhENX̖O
-		WINDOW_NAME,            // EBhE̖O
-		WS_OVERLAPPEDWINDOW,    // EBhEX^C
-		CW_USEDEFAULT,          // EBhE̍xW
-		CW_USEDEFAULT,          // EBhE̍yW
+	// ウィンドウを生成
+	hWnd = CreateWindowEx(0,    // 拡張ウィンドウスタイル
+		CLASS_NAME,             // ウィンドウクラスの名前
+		WINDOW_NAME,            // ウィンドウの名前
+		WS_OVERLAPPEDWINDOW,    // ウィンドウスタイル
+		CW_USEDEFAULT,          // ウィンドウの左上x座標
+		CW_USEDEFAULT,          // ウィンドウの左上y座標
 
-        (rect.right-rect.left), // 
-		(rect.bottom-rect.top), // 
+        (rect.right-rect.left), // 幅
+		(rect.bottom-rect.top), // 高さ
 
-		NULL,                   // eEBhẼnh
-		NULL,                   // j[nh܂͎qEBhEID
-		hInstance,              // CX^Xnh
-		NULL);                  // EBhE쐬f[^
+		NULL,                   // 親ウィンドウのハンドル
+		NULL,                   // メニューハンドルまたは子ウィンドウID
+		hInstance,              // インスタンスハンドル
+		NULL);                  // ウィンドウ作成データ
 
 
-	// }l[W[̏
+	// マネージャーの初期化処理
 	if (FAILED(pManager->Init(hInstance, hWnd)))
 	{
 		return -1;
 	}
 
-	// \ݒ
+	// 分解能を設定
 	timeBeginPeriod(1);
-	dwCurrentTime = 0;					// 
-	dwExecLastTime = timeGetTime();		// ݎ擾iۑj
+	dwCurrentTime = 0;					// 初期化する
+	dwExecLastTime = timeGetTime();		// 現在時刻を取得（保存）
 
-	// EBhE̕\
+	// ウィンドウの表示
 	ShowWindow(hWnd, SW_MAXIMIZE);
 	UpdateWindow(hWnd);
 
-	DWORD dwFrameCount;					// t[JEg
-	DWORD dwFPSLastTime;				// ŌFPSv
+	DWORD dwFrameCount;					// フレームカウント
+	DWORD dwFPSLastTime;				// 最後にFPSを計測した時刻
 
 	dwFrameCount = 0;
 	dwFPSLastTime = timeGetTime();
 
-	// _[̎擾
+	// レンダラーの取得
 	CRenderer* pRenderer = CManager::GetRenderer();
 
-	// ImGuĩCX^X
+	// ImGuiのインスタンス生成
 	CImGuiManager::Instance().Init(hWnd,pRenderer->GetDevice());
 
-	//bZ[W[v
+	//メッセージループ
 	while (1)
 	{
 		if (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE) != 0)
-		{// windows̏
+		{// windowsの処理
 			if (msg.message == WM_QUIT)
-			{// WM_QUITbZ[W󂯎烁bZ[W[v𔲂
+			{// WM_QUITメッセージを受け取ったらメッセージループを抜ける
 				break;
 			}
 			else
 			{
-				//bZ[W̐ݒ
-				TranslateMessage(&msg);   // zbZ[W𕶎bZ[W֕ϊ
-				DispatchMessage(&msg);    // EBhE
+				//メッセージの設定
+				TranslateMessage(&msg);   // 仮想メッセージを文字メッセージへ変換
+				DispatchMessage(&msg);    // ウィンドウ
 			}
 		}
 		else
-		{// DirectX̏
+		{// DirectXの処理
 
-			dwCurrentTime = timeGetTime();// ݎ擾
+			dwCurrentTime = timeGetTime();// 現在時刻を取得
 
 			if ((dwCurrentTime - dwFPSLastTime) >= 500)
-			{// 0.5bo
+			{// 0.5秒経過
 
-				// FPSv
+				// FPSを計測
 				nCountFPS = (dwFrameCount * 1000) / (dwCurrentTime - dwFPSLastTime);
 
 				pManager->GetFPS(nCountFPS);
 
-				dwFPSLastTime = dwCurrentTime;// FPSvۑ
+				dwFPSLastTime = dwCurrentTime;// FPSを計測した時刻を保存
 
-				dwFrameCount = 0;// t[JEgNA
+				dwFrameCount = 0;// フレームカウントをクリア
 			}
 
 			if ((dwCurrentTime - dwExecLastTime) >= (1000 / 60))
-			{// 601bo
+			{// 60分の1秒経過
 
-				dwExecLastTime = dwCurrentTime;// Jn̎[ݎ]ۑ
+				dwExecLastTime = dwCurrentTime;// 処理開始の時刻[現在時刻]を保存
 
-				dwCurrentTime = timeGetTime();// ݎ擾
+				dwCurrentTime = timeGetTime();// 現在時刻を取得
 
-				dwFrameCount++;// t[JEgZ
+				dwFrameCount++;// フレームカウントを加算
 
 				if (pRenderer->NeedsReset())
 				{
-					// foCX̃Zbg
+					// デバイスのリセット
 					pRenderer->ResetDevice();
 				}
 
-				// t[Jn
+				// フレーム開始
 				CImGuiManager::Instance().NewFlameImgui();
 
-				// }l[W[̍XV
+				// マネージャーの更新処理
 				pManager->Update();
 
 				ImGui::EndFrame();
 
-				//}l[W[̕`揈
+				//マネージャーの描画処理
 				pManager->Draw();
 			}
 		}
 	}
 
-	// }l[W[̔j
+	// マネージャーの破棄
 	if (pManager != nullptr)
 	{
-		// }l[W[̏I
+		// マネージャーの終了処理
 		pManager->Uninit();
 
 		delete pManager;
 		pManager = nullptr;
 	}
 
-	// \߂
+	// 分解能を戻す
 	timeEndPeriod(1);
 
-	// EBhENX̓o^
+	// ウィンドウクラスの登録を解除
 	UnregisterClass(CLASS_NAME, wcex.hInstance);
 
 	return (int)msg.wParam;
@@ -203,11 +300,11 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE /*hInstancePrev*
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 //=============================================================================
-// EBhEvV[W
+// ウィンドウプロシージャ
 //=============================================================================
 LRESULT CALLBACK WindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 {
-	//HDC hDC;//foCXReLXg(GDIIuWFNg)̃nh
+	//HDC hDC;//デバイスコンテキスト(GDIオブジェクト)のハンドル
 
 	if (ImGui_ImplWin32_WndProcHandler(hWnd, uMsg, wParam, lParam))
 		return true;
@@ -216,16 +313,16 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 
 	int nID;
 
-	// _[̎擾
+	// レンダラーの取得
 	CRenderer* pRenderer = CManager::GetRenderer();
 
-	// CvZXϐ
+	// メインプロセス変数
 	CMainProc pProc = {};
 
 	switch (uMsg)
 	{
-	case WM_DESTROY:  //EBhEj̃bZ[W
-		//WM_QUITbZ[W𑗂
+	case WM_DESTROY:  //ウィンドウ破棄のメッセージ
+		//WM_QUITメッセージを送る
 		PostQuitMessage(0);
 
 		break;
@@ -240,64 +337,64 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 
 		return 0;
 
-	case WM_KEYDOWN://L[̃bZ[W
+	case WM_KEYDOWN://キー押下のメッセージ
 		switch (wParam)
 		{
-		case VK_ESCAPE://[ESC]L[ꂽ
+		case VK_ESCAPE://[ESC]キーが押された
 
-			//EBhEj
-			nID = MessageBox(hWnd, "I܂?", "IbZ[W", MB_YESNO);
+			//ウィンドウを破棄する
+			nID = MessageBox(hWnd, "終了しますか?", "終了メッセージ", MB_YESNO);
 			if (nID == IDYES)
 			{
-				DestroyWindow(hWnd);//EChEjbZ[W
+				DestroyWindow(hWnd);//ウインドウ破棄メッセージ
 			}
 			else
 			{
-				return 0;            //Ԃ
+				return 0;            //返す
 			}
 
 			break;
 
 		case VK_F11:
 
-			// tXN[
+			// フルスクリーン
 			pProc.ToggleFullScreen(hWnd);
 
 			break;
 		}
 		break;
 	}
-	return DefWindowProc(hWnd, uMsg, wParam, lParam);//̏JԂ
+	return DefWindowProc(hWnd, uMsg, wParam, lParam);//既定の処理を繰り返す
 }
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMainProc::CMainProc()
 {
-	// l̃NA
+	// 値のクリア
 	m_Windowrect = {};
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMainProc::~CMainProc()
 {
-	// 
+	// 無し
 }
 //=============================================================================
-// EBhEtXN[
+// ウィンドウフルスクリーン
 //=============================================================================
 void CMainProc::ToggleFullScreen(HWND hWnd)
 { 
-	// ؂ւtO錾
+	// 切り替えフラグを宣言
 	static bool isFullscreen = false;
 
-	// ݂̃EBhEX^C擾
+	// 現在のウィンドウスタイルを取得
 	DWORD dwStyle = GetWindowLong(hWnd, GWL_STYLE);
 
 	if (isFullscreen)
 	{
-		// EBhE[hɐ؂ւ
+		// ウィンドウモードに切り替え
 		SetWindowLong(hWnd, GWL_STYLE, dwStyle | WS_OVERLAPPEDWINDOW);
 		SetWindowPos(hWnd, HWND_TOP, m_Windowrect.left, m_Windowrect.top,
 			m_Windowrect.right - m_Windowrect.left, m_Windowrect.bottom - m_Windowrect.top,
@@ -306,7 +403,7 @@ void CMainProc::ToggleFullScreen(HWND hWnd)
 	}
 	else
 	{
-		// tXN[[hɐ؂ւ
+		// フルスクリーンモードに切り替え
 		GetWindowRect(hWnd, &m_Windowrect);
 		SetWindowLong(hWnd, GWL_STYLE, dwStyle & ~WS_OVERLAPPEDWINDOW);
 		SetWindowPos(hWnd, HWND_TOP, 0, 0, GetSystemMetrics(SM_CXSCREEN), GetSystemMetrics(SM_CYSCREEN),
@@ -314,6 +411,6 @@ void CMainProc::ToggleFullScreen(HWND hWnd)
 		ShowWindow(hWnd, SW_MAXIMIZE);
 	}
 
-	// tOύX
+	// フラグを変更
 	isFullscreen = !isFullscreen;
 }
\ No newline at end of file
@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// C [main.h]
+// メイン処理 [main.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _MAIN_H_// ̃}N`ĂȂ
-#define _MAIN_H_// 2dCN[hh~̃}N`
+#ifndef _MAIN_H_// このマクロ定義がされていなかったら
+#define _MAIN_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CvZXNX
+// メインプロセスクラス
 //*****************************************************************************
 class CMainProc
 {
@@ -19,7 +19,7 @@ public:
 	void ToggleFullScreen(HWND hWnd);
 
 private:
-	RECT m_Windowrect;	// EBhE̕
+	RECT m_Windowrect;	// ウィンドウの幅
 };
 
 #endif
\ No newline at end of file
@@ -1,20 +1,28 @@
 //=============================================================================
 //
-// }l[W[ [manager.cpp]
+// マネージャー処理 [manager.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "manager.h"
 #include "renderer.h"
 #include "sound.h"
 #include "game.h"
+#include "memorymanager.h"
+#include "light.h"
+#include "assetloader.h"
+#include "particlesystem.h"
+#include "ripplesystem.h"
+#include "billboardrenderer.h"
+#include "spritebatch.h"
+#include "debugproc3D.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 CRenderer* CManager::m_pRenderer = nullptr;
 CInputKeyboard* CManager::m_pInputKeyboard = nullptr;
@@ -26,77 +34,80 @@ CCamera* CManager::m_pCamera = nullptr;
 CScene* CManager::m_pScene = nullptr;
 CFade* CManager::m_pFade = nullptr;
 std::unique_ptr<btDiscreteDynamicsWorld> CManager::m_pDynamicsWorld = nullptr;
+double CManager::m_fLoadStartMs = 0.0;
+bool CManager::m_bLoadReport = false;
+bool CManager::m_bLoadReportEnable = false;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CManager::CManager()
 {
-	// l̃NA
-	m_fps						= 0;		// FPSl
-	m_pBroadphase				= nullptr;	// Փ˔̃NXւ̃|C^
-	m_pCollisionConfiguration	= nullptr;	// Փˌo̐ݒǗNXւ̃|C^
-	m_pDispatcher				= nullptr;	// ۂɏՓ˔菈sNXւ̃|C^
-	m_pSolver					= nullptr;	// V~[V̐\o[ւ̃|C^
+	// 値のクリア
+	m_fps						= 0;		// FPS値
+	m_pBroadphase				= nullptr;	// 衝突判定のクラスへのポインタ
+	m_pCollisionConfiguration	= nullptr;	// 衝突検出の設定を管理するクラスへのポインタ
+	m_pDispatcher				= nullptr;	// 実際に衝突判定処理を実行するクラスへのポインタ
+	m_pSolver					= nullptr;	// 物理シミュレーションの制約ソルバーへのポインタ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CManager::~CManager()
 {
 
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CManager::Init(HINSTANCE hInstance, HWND hWnd)
 {
-	// _[̐
+	// レンダラーの生成
 	m_pRenderer = new CRenderer;
 
-	// _[̏
+	// レンダラーの初期化処理
 	if (FAILED(m_pRenderer->Init(hWnd, TRUE)))
 	{
 		return -1;
 	}
 
-	// L[{[h̐
+	// キーボードの生成
 	m_pInputKeyboard = new CInputKeyboard;
 
-	// L[{[h̏
+	// キーボードの初期化処理
 	if (FAILED(m_pInputKeyboard->Init(hInstance, hWnd)))
 	{
 		return -1;
 	}
 
-	// WCpbh̐
+	// ジョイパッドの生成
 	m_pInputJoypad = new CInputJoypad;
 
-	// WCpbh̏
+	// ジョイパッドの初期化処理
 	if (FAILED(m_pInputJoypad->Init()))
 	{
 		return E_FAIL;
 	}
 
-	// }EX̐
+	// マウスの生成
 	m_pInputMouse = new CInputMouse;
 
-	// }EX̏
+	// マウスの初期化処理
 	if (FAILED(m_pInputMouse->Init(hInstance, hWnd)))
 	{
 		return E_FAIL;
 	}
 
-	// TEh̐
+	// サウンドの生成
 	m_pSound = new CSound;
 
-	// TEh̏
+	// サウンドの初期化処理
 	if (FAILED(m_pSound->Init(hWnd)))
 	{
 		return E_FAIL;
 	}
 
-	// Bullet[h̐
+	// Bullet物理ワールドの生成
 	m_pBroadphase = std::make_unique<btDbvtBroadphase>();
 	m_pCollisionConfiguration = std::make_unique <btDefaultCollisionConfiguration>();
 	m_pDispatcher = std::make_unique <btCollisionDispatcher>(m_pCollisionConfiguration.get());
@@ -104,120 +115,176 @@ HRESULT CManager::Init(HINSTANCE hInstance, HWND hWnd)
 
 	m_pDynamicsWorld = std::make_unique <btDiscreteDynamicsWorld>(m_pDispatcher.get(), m_pBroadphase.get(), m_pSolver.get(), m_pCollisionConfiguration.get());
 
-	// d͂ݒ
+	// 重力を設定
 	m_pDynamicsWorld->setGravity(btVector3(0, -9.8f, 0));
 
-	// J̐
+	// カメラの生成
 	m_pCamera = new CCamera;
 
-	// J̏
+	// カメラの初期化処理
 	m_pCamera->Init();
 
-	// eNX`̐
+	// アセット読み込みスレッドの起動
+	CAssetLoader::Init();
+
+	// テクスチャの生成
 	m_pTexture = new CTexture;
 
-	// eNX`̓ǂݍ
+	// テクスチャの読み込み
 	m_pTexture->Load();
 
-	// ^Cg
+	// パーティクル管理の初期化処理
+	CParticleSystem::Init();
+
+	// 波紋管理の初期化処理
+	CRippleSystem::Init();
+
+	// ビルボードまとめ描画の初期化処理
+	CBillboardRenderer::Init();
+
+	// 2Dスプライトまとめ描画の初期化処理
+	CSpriteBatch::Init();
+
+	// 3Dデバッグ表示の初期化処理
+	CDebugProc3D::Init();
+
+	// 起動引数で指定されていたら計測結果をCSVに書き出す
+	if (strstr(GetCommandLineA(), "-telemetry") != nullptr)
+	{
+		CTelemetry::StartCsv("telemetry.csv");
+	}
+
+	// 起動引数で指定されていたらシーンごとの読み込み時間を書き出す
+	m_bLoadReportEnable = (strstr(GetCommandLineA(), "-loadreport") != nullptr);
+
+	// タイトル画面
 	m_pFade = CFade::Create(CScene::MODE_TITLE);
 
-	// ^Cg
+	// 読み込み時間の計測開始
+	CAssetLoader::ResetReport();
+	m_fLoadStartMs = CAssetLoader::GetTimeMs();
+	m_bLoadReport = true;
+
+	// タイトル画面
 	m_pScene = CScene::Create(CScene::MODE_TITLE);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CManager::Uninit(void)
 {
-	// ׂẴIuWFNg̔j
+	// すべてのオブジェクトの破棄
 	CObject::ReleaseAll();
 
-	// eNX`̔j
+	// パーティクル管理の終了処理
+	CParticleSystem::Uninit();
+
+	// 波紋管理の終了処理
+	CRippleSystem::Uninit();
+
+	// ビルボードまとめ描画の終了処理
+	CBillboardRenderer::Uninit();
+
+	// 2Dスプライトまとめ描画の終了処理
+	CSpriteBatch::Uninit();
+
+	// 3Dデバッグ表示の終了処理
+	CDebugProc3D::Uninit();
+
+	// メモリ管理の終了処理
+	CMemoryManager::Uninit();
+
+	// 計測結果の書き出しを終了
+	CTelemetry::StopCsv();
+
+	// テクスチャの破棄
 	if (m_pTexture != nullptr)
 	{
-		// SẴeNX`̔j
+		// 全てのテクスチャの破棄
 		m_pTexture->Unload();
 
 		delete m_pTexture;
 		m_pTexture = nullptr;
 	}
 
-	// L[{[h̏I
+	// アセット読み込みスレッドの終了
+	CAssetLoader::Uninit();
+
+	// キーボードの終了処理
 	m_pInputKeyboard->Uninit();
 
-	// WCpbh̏I
+	// ジョイパッドの終了処理
 	m_pInputJoypad->Uninit();
 
-	// }EX̏I
+	// マウスの終了処理
 	m_pInputMouse->Uninit();
 
-	// TEh̏I
+	// サウンドの終了処理
 	m_pSound->Uninit();
 
-	// L[{[h̔j
+	// キーボードの破棄
 	if (m_pInputKeyboard != nullptr)
 	{
-		// _[̏I
+		// レンダラーの終了処理
 		m_pInputKeyboard->Uninit();
 
 		delete m_pInputKeyboard;
 		m_pInputKeyboard = nullptr;
 	}
 
-	// WCpbh̔j
+	// ジョイパッドの破棄
 	if (m_pInputJoypad != nullptr)
 	{
-		// WCpbh̏I
+		// ジョイパッドの終了処理
 		m_pInputJoypad->Uninit();
 
 		delete m_pInputJoypad;
 		m_pInputJoypad = nullptr;
 	}
 
-	// }EX̔j
+	// マウスの破棄
 	if (m_pInputMouse != nullptr)
 	{
-		// }EX̏I
+		// マウスの終了処理
 		m_pInputMouse->Uninit();
 
 		delete m_pInputMouse;
 		m_pInputMouse = nullptr;
 	}
 
-	// TEh̔j
+	// サウンドの破棄
 	if (m_pSound != nullptr)
 	{
-		// TEh̏I
+		// サウンドの終了処理
 		m_pSound->Uninit();
 
 		delete m_pSound;
 		m_pSound = nullptr;
 	}
 
-	// J̔j
+	// カメラの破棄
 	if (m_pCamera != nullptr)
 	{
 		delete m_pCamera;
 		m_pCamera = nullptr;
 	}
 
-	// tF[h̔j
+	// フェードの破棄
 	if (m_pFade != nullptr)
 	{
-		// tF[h̏I
+		// フェードの終了処理
 		m_pFade->Uninit();
 
 		delete m_pFade;
 		m_pFade = nullptr;
 	}
 
-	// _[̔j
+	// レンダラーの破棄
 	if (m_pRenderer != nullptr)
 	{
-		// _[̏I
+		// レンダラーの終了処理
 		m_pRenderer->Uninit();
 
 		delete m_pRenderer;
@@ -225,27 +292,39 @@ void CManager::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CManager::Update(void)
 {
-	// L[{[h̍XV
+	// フレーム一時領域のリセット
+	CMemoryManager::BeginFrame();
+
+	// リソース作成の時間の上限をリセット(テクスチャとメッシュで共通)
+	CAssetLoader::BeginFrame();
+
+	// 読み込みが終わったテクスチャの作成
+	m_pTexture->Update();
+
+	// 読み込み時間の書き出し
+	UpdateLoadReport();
+
+	// キーボードの更新
 	m_pInputKeyboard->Update();
 
-	// WCpbh̍XV
+	// ジョイパッドの更新
 	m_pInputJoypad->Update();
 
-	// }EX̍XV
+	// マウスの更新
 	m_pInputMouse->Update();
 
-	// tF[h̍XV
+	// フェードの更新処理
 	if (m_pFade != nullptr)
 	{
-		// tF[h̍XV
+		// フェードの更新処理
 		m_pFade->Update();
 	}
 
-	// |[Y̓Q[XVȂ
+	// ポーズ中はゲーム更新しない
 	if (CGame::GetisPaused() == true)
 	{
 		if (m_pInputKeyboard->GetTrigger(DIK_TAB) || m_pInputJoypad->GetTrigger(CInputJoypad::JOYKEY_START))
@@ -253,10 +332,10 @@ void CManager::Update(void)
 			CGame::SetEnablePause(false);
 		}
 
-		// }EXJ[\\ɂ
+		// マウスカーソルを表示にする
 		m_pInputMouse->SetCursorVisibility(true);
 
-		// |[Y}l[W[̍XV
+		// ポーズマネージャーの更新処理
 		CGame::GetPauseManager()->Update();
 
 		return;
@@ -264,68 +343,127 @@ void CManager::Update(void)
 
 	m_pDynamicsWorld->stepSimulation((btScalar)m_fps, 1 ,0.16f);
 
-	// J̍XV
+	// 接触ペア数の計測
+	CTelemetry::Set(CTelemetry::COUNTER_CONTACT_PAIR, m_pDispatcher->getNumManifolds());
+
+	// カメラの更新
 	m_pCamera->Update();
 
-	// _[̍XV
+	// レンダラーの更新
 	m_pRenderer->Update();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CManager::Draw(void)
 {
-	// J̐ݒ
+	// カメラの設定
 	m_pCamera->SetCamera();
 
-	// _[̕`
+	// 注視点の周りで影響の大きいライトだけをデバイスに設定する(物ごとの描画はその物の周りで選び直す)
+	CLight::ApplyView(m_pCamera->GetPosR());
+
+	// レンダラーの描画
 	m_pRenderer->Draw(m_fps);
+
+	// 計測カウンターの確定
+	CTelemetry::EndFrame();
 }
 //=============================================================================
-// [h̐ݒ
+// モードの設定
 //=============================================================================
 void CManager::SetMode(CScene::MODE mode)
 {
-	// J̏
+	// カメラの初期化処理
 	m_pCamera->Init();
 
-	// TEh̒~
+	// サウンドの停止
 	m_pSound->Stop();
 
 	if (m_pScene != nullptr)
 	{
-		// ݂̃[hj
+		// 現在のモード破棄
 		m_pScene->Uninit();
 	}
 
-	// SẴIuWFNgj
+	// 全てのオブジェクトを破棄
 	CObject::ReleaseAll();
 
-	// |[YfalseɂĂ
+	// 残っている粒子と波紋とビルボードを破棄
+	CParticleSystem::Clear();
+	CRippleSystem::Clear();
+	CBillboardRenderer::Clear();
+
+	// 2Dスプライトとアトラスを破棄(次のシーンのUIが入れ直す)
+	CSpriteBatch::Clear();
+
+	// シーン単位で確保した領域をまとめて解放
+	CMemoryManager::ReleaseScene();
+
+	// シーンで読み込んだテクスチャをまとめて破棄
+	m_pTexture->ReleaseScene();
+	CAssetLoader::ReleaseScene();
+
+	// ポーズをfalseにしておく
 	CGame::SetEnablePause(false);
 
-	// V[h̐
+	// 読み込み時間の計測開始
+	CAssetLoader::ResetReport();
+	m_fLoadStartMs = CAssetLoader::GetTimeMs();
+	m_bLoadReport = true;
+
+	// 新しいモードの生成
 	m_pScene = CScene::Create(mode);
 }
 //=============================================================================
-// ݂̃[h̎擾
+// 読み込み時間の書き出し処理(シーンの先読みとテクスチャ作成が全て終わった時に1回だけ)
+//=============================================================================
+void CManager::UpdateLoadReport(void)
+{
+	if (!m_bLoadReport || m_pTexture->GetNumPending() > 0 || !CAssetLoader::IsIdle())
+	{
+		return;
+	}
+
+	m_bLoadReport = false;
+
+	if (!m_bLoadReportEnable)
+	{
+		return;
+	}
+
+	static const char* apModeName[CScene::MODE_MAX] =
+	{
+		"title", "tutorial", "movie", "game", "result", "ranking"
+	};
+
+	CScene::MODE mode = GetMode();
+	const char* pLabel = (mode >= 0 && mode < CScene::MODE_MAX) ? apModeName[mode] : "unknown";
+
+	CAssetLoader::WriteReport("load_report.csv", pLabel, CAssetLoader::GetTimeMs() - m_fLoadStartMs);
+}
+//=============================================================================
+// 現在のモードの取得
 //=============================================================================
 CScene::MODE CManager::GetMode(void)
 {
 	return m_pScene->GetMode();
 }
 //=============================================================================
-// foCXZbgʒm
+// デバイスリセット通知
 //=============================================================================
 void CManager::OnDeviceReset(void)
 {
+	// リセットでライトの設定が消えるので次回全て設定し直す
+	CLight::InvalidateDevice();
+
 	if (m_pScene)
 	{
 		m_pScene->OnDeviceReset();
 	}
 }
 //=============================================================================
-// TlC[Xʒm
+// サムネイルリリース通知
 //=============================================================================
 void CManager::ReleaseThumbnail(void)
 {
@@ -335,7 +473,7 @@ void CManager::ReleaseThumbnail(void)
 	}
 }
 //=============================================================================
-// TlCZbgʒm
+// サムネイルリセット通知
 //=============================================================================
 void CManager::ResetThumbnail(void)
 {
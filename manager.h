@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// }l[W[ [manager.h]
+// マネージャー処理 [manager.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _MANAGER_H_// ̃}N`ĂȂ
-#define _MANAGER_H_// 2dCN[hh~̃}N`
+#ifndef _MANAGER_H_// このマクロ定義がされていなかったら
+#define _MANAGER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "renderer.h"
 #include "input.h"
@@ -19,9 +19,10 @@
 #include "scene.h"
 #include "fade.h"
 #include "pausemanager.h"
+#include "telemetry.h"
 
 //*****************************************************************************
-// }l[W[NX
+// マネージャークラス
 //*****************************************************************************
 class CManager
 {
@@ -53,21 +54,26 @@ public:
 	static void ResetThumbnail(void);
 
 private:
-	int													 m_fps;						// FPSl
-	static CRenderer*									 m_pRenderer;				// _[ւ̃|C^
-	static CInputKeyboard*								 m_pInputKeyboard;			// L[{[hւ̃|C^
-	static CInputJoypad*								 m_pInputJoypad;			// WCpbhւ̃|C^
-	static CInputMouse*									 m_pInputMouse;				// }EXւ̃|C^
-	static CSound*										 m_pSound;					// TEhւ̃|C^
-	static CTexture*									 m_pTexture;				// eNX`ւ̃|C^
-	static CCamera*										 m_pCamera;					// Jւ̃|C^
-	static CFade*										 m_pFade;					// tF[hւ̃|C^
-	static CScene*										 m_pScene;					// V[ւ̃|C^
-	std::unique_ptr<btBroadphaseInterface>				 m_pBroadphase;				// Փ˔̃NXւ̃|C^
-	std::unique_ptr<btDefaultCollisionConfiguration>	 m_pCollisionConfiguration;	// Փˌo̐ݒǗNXւ̃|C^
-	std::unique_ptr<btCollisionDispatcher>				 m_pDispatcher;				// ۂɏՓ˔菈sNXւ̃|C^
-	std::unique_ptr<btSequentialImpulseConstraintSolver> m_pSolver;					// V~[V̐\o[ւ̃|C^
-	static std::unique_ptr<btDiscreteDynamicsWorld>		 m_pDynamicsWorld;			// EǗNXւ̃|C^
+	static void UpdateLoadReport(void);
+
+	int													 m_fps;						// FPS値
+	static CRenderer*									 m_pRenderer;				// レンダラーへのポインタ
+	static CInputKeyboard*								 m_pInputKeyboard;			// キーボードへのポインタ
+	static CInputJoypad*								 m_pInputJoypad;			// ジョイパッドへのポインタ
+	static CInputMouse*									 m_pInputMouse;				// マウスへのポインタ
+	static CSound*										 m_pSound;					// サウンドへのポインタ
+	static CTexture*									 m_pTexture;				// テクスチャへのポインタ
+	static CCamera*										 m_pCamera;					// カメラへのポインタ
+	static CFade*										 m_pFade;					// フェードへのポインタ
+	static CScene*										 m_pScene;					// シーンへのポインタ
+	std::unique_ptr<btBroadphaseInterface>				 m_pBroadphase;				// 衝突判定のクラスへのポインタ
+	std::unique_ptr<btDefaultCollisionConfiguration>	 m_pCollisionConfiguration;	// 衝突検出の設定を管理するクラスへのポインタ
+	std::unique_ptr<btCollisionDispatcher>				 m_pDispatcher;				// 実際に衝突判定処理を実行するクラスへのポインタ
+	std::unique_ptr<btSequentialImpulseConstraintSolver> m_pSolver;					// 物理シミュレーションの制約ソルバーへのポインタ
+	static std::unique_ptr<btDiscreteDynamicsWorld>		 m_pDynamicsWorld;			// 物理世界を管理するクラスへのポインタ
+	static double										 m_fLoadStartMs;			// シーンの読み込みを始めた時刻
+	static bool											 m_bLoadReport;				// 読み込み時間の書き出し待ちか
+	static bool											 m_bLoadReportEnable;		// 読み込み時間を書き出すか
 };
 
 #endif
\ No newline at end of file
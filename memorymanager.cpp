@@ -0,0 +1,499 @@
+//=============================================================================
+//
+// メモリ管理処理 [memorymanager.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "memorymanager.h"
+#include "renderqueue.h"
+#include "light.h"
+#include "ui.h"
+#include "sound.h"
+#include "cassert"
+#include "new"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+CLinearAllocator CMemoryManager::m_frameAllocator(CMemoryManager::FRAME_BLOCK_SIZE);
+CSceneArena CMemoryManager::m_sceneArena;
+CMemoryManager::FrameStats CMemoryManager::m_lastFrameStats;
+size_t CMemoryManager::m_peakFrameBytes = 0;
+volatile LONG CMemoryManager::m_bHeapCount = FALSE;
+volatile LONG CMemoryManager::m_nHeapCheckAlloc = 0;
+size_t CMemoryManager::m_aHeapRecord[CMemoryManager::HEAP_CHECK_RECORD] = {};
+
+//*****************************************************************************
+// 汎用ヒープの確保の置き換え(検査中だけ数える。確保自体はmallocに任せる)
+//*****************************************************************************
+void* operator new(size_t size)
+{
+	CMemoryManager::CountHeapAlloc(size);
+
+	void* p = malloc(size != 0 ? size : 1);
+
+	if (p == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return p;
+}
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	CMemoryManager::CountHeapAlloc(size);
+
+	return malloc(size != 0 ? size : 1);
+}
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+void operator delete[](void* p) noexcept
+{
+	free(p);
+}
+void operator delete(void* p, size_t) noexcept
+{
+	free(p);
+}
+void operator delete[](void* p, size_t) noexcept
+{
+	free(p);
+}
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+	free(p);
+}
+
+//=============================================================================
+// リニアアロケーターのコンストラクタ
+//=============================================================================
+CLinearAllocator::CLinearAllocator(size_t blockSize)
+{
+	// 値のクリア
+	m_nCurBlock			= 0;			// 現在使用中のブロック
+	m_blockSize			= blockSize;	// 1ブロックの基本サイズ
+	m_usedBytes			= 0;			// 使用済みバイト数
+	m_capacity			= 0;			// 全ブロックの合計サイズ
+	m_nAllocCount		= 0;			// Reset後の確保回数
+	m_nHeapAllocCount	= 0;			// Reset後にヒープからブロックを確保した回数
+}
+//=============================================================================
+// リニアアロケーターのデストラクタ
+//=============================================================================
+CLinearAllocator::~CLinearAllocator()
+{
+	// 全ブロックの解放
+	Release();
+}
+//=============================================================================
+// 確保処理
+//=============================================================================
+void* CLinearAllocator::Alloc(size_t size, size_t align)
+{
+	if (size == 0)
+	{
+		size = 1;
+	}
+
+	while (true)
+	{
+		if (m_nCurBlock < m_blocks.size())
+		{
+			Block& block = m_blocks[m_nCurBlock];
+
+			// アライメントを合わせた位置
+			size_t offset = (block.used + (align - 1)) & ~(align - 1);
+
+			if (offset + size <= block.size)
+			{
+				m_usedBytes += (offset + size) - block.used;
+				block.used = offset + size;
+				m_nAllocCount++;
+
+				return block.pData + offset;
+			}
+
+			// 次のブロックへ
+			m_nCurBlock++;
+			continue;
+		}
+
+		// 空きが無ければブロックを追加する
+		AddBlock(size + align);
+	}
+}
+//=============================================================================
+// リセット処理(ブロックは保持したまま先頭に戻す)
+//=============================================================================
+void CLinearAllocator::Reset(void)
+{
+	// ブロックが複数に分かれていたら1つにまとめて次回以降の追加確保を無くす
+	if (m_blocks.size() > 1)
+	{
+		size_t total = m_capacity;
+
+		Release();
+
+		AddBlock(total);
+	}
+
+	for (auto& block : m_blocks)
+	{
+		block.used = 0;
+	}
+
+	m_nCurBlock = 0;
+	m_usedBytes = 0;
+	m_nAllocCount = 0;
+	m_nHeapAllocCount = 0;
+}
+//=============================================================================
+// 全ブロックの解放処理
+//=============================================================================
+void CLinearAllocator::Release(void)
+{
+	for (auto& block : m_blocks)
+	{
+		::operator delete(block.pData);
+	}
+
+	m_blocks.clear();
+	m_blocks.shrink_to_fit();
+
+	m_nCurBlock = 0;
+	m_usedBytes = 0;
+	m_capacity = 0;
+}
+//=============================================================================
+// ブロックの追加処理
+//=============================================================================
+void CLinearAllocator::AddBlock(size_t minSize)
+{
+	Block block = {};
+	block.size = (minSize > m_blockSize) ? minSize : m_blockSize;
+	block.pData = static_cast<unsigned char*>(::operator new(block.size));
+	block.used = 0;
+
+	m_blocks.push_back(block);
+	m_nCurBlock = m_blocks.size() - 1;
+	m_capacity += block.size;
+	m_nHeapAllocCount++;
+}
+//=============================================================================
+// シーンアリーナのコンストラクタ
+//=============================================================================
+CSceneArena::CSceneArena() : m_allocator(SCENE_BLOCK_SIZE)
+{
+	// 値のクリア
+	memset(m_apFree, 0, sizeof(m_apFree));	// サイズクラスごとのフリーリスト
+	m_nLiveCount	= 0;					// 使用中の個数
+	m_nReuseCount	= 0;					// フリーリストから再利用した回数
+}
+//=============================================================================
+// シーンアリーナのデストラクタ
+//=============================================================================
+CSceneArena::~CSceneArena()
+{
+	// なし
+}
+//=============================================================================
+// 確保処理
+//=============================================================================
+void* CSceneArena::Alloc(size_t size)
+{
+	// 大きいものは汎用ヒープに任せる
+	if (size == 0 || size > MAX_POOLED_SIZE)
+	{
+		return ::operator new(size);
+	}
+
+	size_t nClass = (size - 1) / SIZE_CLASS_STEP;
+
+	m_nLiveCount++;
+
+	// 解放済みの領域があれば再利用する
+	if (m_apFree[nClass] != nullptr)
+	{
+		FreeNode* pNode = m_apFree[nClass];
+		m_apFree[nClass] = pNode->pNext;
+		m_nReuseCount++;
+
+		return pNode;
+	}
+
+	return m_allocator.Alloc((nClass + 1) * SIZE_CLASS_STEP);
+}
+//=============================================================================
+// 解放処理(フリーリストに戻すだけ)
+//=============================================================================
+void CSceneArena::Free(void* p, size_t size)
+{
+	if (p == nullptr)
+	{
+		return;
+	}
+
+	if (size == 0 || size > MAX_POOLED_SIZE)
+	{
+		::operator delete(p);
+		return;
+	}
+
+	size_t nClass = (size - 1) / SIZE_CLASS_STEP;
+
+	FreeNode* pNode = static_cast<FreeNode*>(p);
+	pNode->pNext = m_apFree[nClass];
+	m_apFree[nClass] = pNode;
+
+	m_nLiveCount--;
+}
+//=============================================================================
+// シーン終了時の一括解放処理
+//=============================================================================
+bool CSceneArena::Release(void)
+{
+	// 生きている領域が残っていたら解放しない(解放漏れなので知らせる)
+	if (m_nLiveCount > 0)
+	{
+		char aStr[128];
+		sprintf_s(aStr, "CSceneArena::Release : %d個の領域が解放されていないため解放を見送りました\n", m_nLiveCount);
+		OutputDebugStringA(aStr);
+
+		assert(m_nLiveCount == 0 && "シーンアリーナの領域が解放されていない");
+
+		return false;
+	}
+
+	memset(m_apFree, 0, sizeof(m_apFree));
+
+	// 領域は次のシーンでも使うので先頭に戻すだけにする
+	m_allocator.Reset();
+
+	m_nReuseCount = 0;
+
+	return true;
+}
+//=============================================================================
+// フレーム開始処理
+//=============================================================================
+void CMemoryManager::BeginFrame(void)
+{
+	// 前フレームの統計を保存
+	m_lastFrameStats.nAllocCount = m_frameAllocator.GetAllocCount();
+	m_lastFrameStats.allocBytes = m_frameAllocator.GetUsedBytes();
+	m_lastFrameStats.nHeapAllocCount = m_frameAllocator.GetHeapAllocCount();
+
+	if (m_lastFrameStats.allocBytes > m_peakFrameBytes)
+	{
+		m_peakFrameBytes = m_lastFrameStats.allocBytes;
+	}
+
+	// 一時領域を先頭に戻す
+	m_frameAllocator.Reset();
+}
+//=============================================================================
+// シーン破棄時の解放処理
+//=============================================================================
+void CMemoryManager::ReleaseScene(void)
+{
+	// シーンアリーナの一括解放
+	m_sceneArena.Release();
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CMemoryManager::Uninit(void)
+{
+	// シーンアリーナの一括解放
+	m_sceneArena.Release();
+
+	// フレームアロケーターの解放
+	m_frameAllocator.Release();
+}
+//=============================================================================
+// 汎用ヒープ確保の計測処理(検査中でなければ何もしない)
+//=============================================================================
+void CMemoryManager::CountHeapAlloc(size_t size)
+{
+	if (!m_bHeapCount)
+	{
+		return;
+	}
+
+	// ここでは確保を伴う処理を呼ばない
+	LONG nIdx = InterlockedIncrement(&m_nHeapCheckAlloc) - 1;
+
+	if (nIdx < HEAP_CHECK_RECORD)
+	{
+		m_aHeapRecord[nIdx] = size;
+	}
+}
+//=============================================================================
+// 汎用ヒープ確保の検査の1フレーム分の処理(ゲーム中に毎フレーム通る一時データの扱いをまねる)
+//=============================================================================
+void CMemoryManager::TickHeapCheck(int nFrame, CRenderQueue* pQueue, CRenderRecorder* pRecorder, CSound* pSound, int* pSoundId)
+{
+	BeginFrame();
+
+	// フレームの一時配列(キャラクターやブロックの一覧)
+	FrameVector<int> list;
+
+	for (int nCnt = 0; nCnt < 64; nCnt++)
+	{
+		list.push_back(nCnt);
+	}
+
+	// シーン中に作り直すオブジェクト(エフェクトなど)
+	void* apObject[HEAP_CHECK_OBJECT];
+
+	for (int nCnt = 0; nCnt < HEAP_CHECK_OBJECT; nCnt++)
+	{
+		apObject[nCnt] = m_sceneArena.Alloc(48 + (size_t)((nCnt * 37 + nFrame) % 8) * 64);
+	}
+
+	for (int nCnt = 0; nCnt < HEAP_CHECK_OBJECT; nCnt++)
+	{
+		m_sceneArena.Free(apObject[nCnt], 48 + (size_t)((nCnt * 37 + nFrame) % 8) * 64);
+	}
+
+	// UIの名前での取得(登録が無くても名前からキーを作る処理は通る)
+	CUIManager* pUI = CUIManager::GetInstance();
+	pUI->GetUI("Skip_XInput");
+	pUI->GetUI("Stealth_keyboard");
+	pUI->GetUI("Escape_Keyboard");
+	pUI->GetUI("MissionFailure");
+
+	// 描画キュー(ライトの選び直しとステートキャッシュも通る)
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixIdentity(&mtxWorld);
+	D3DMATERIAL9 material = {};
+
+	for (int nCnt = 0; nCnt < HEAP_CHECK_PACKET; nCnt++)
+	{
+		LPD3DXMESH pMesh = (LPD3DXMESH)(uintptr_t)((nCnt % 16 + 1) * 0x1000);
+		mtxWorld._41 = (float)(nCnt * 50);
+
+		pQueue->Submit(CRenderQueue::PASS_OPAQUE, 0, nCnt % 12, pMesh, 0, mtxWorld, material, nullptr,
+			D3DXVECTOR3(mtxWorld._41, 0.0f, 0.0f), 40.0f);
+	}
+
+	pRecorder->BeginFrame();
+	pQueue->Flush(pRecorder);
+	pQueue->EndFrame();
+
+	// ボイスの確保と解放
+	if (pSound != nullptr && nFrame % HEAP_CHECK_SOUND == 0)
+	{
+		pSound->Stop(*pSoundId);
+		*pSoundId = pSound->Play3D(CSound::SOUND_LABEL_STEP, D3DXVECTOR3(0.0f, 0.0f, 100.0f), 10.0f, 500.0f);
+		pSound->UpdateSoundPosition(*pSoundId, D3DXVECTOR3((float)nFrame, 0.0f, 100.0f));
+		pSound->Play(CSound::SOUND_LABEL_SELECT);
+	}
+}
+//=============================================================================
+// 汎用ヒープ確保の検査処理(確保が無ければtrueを返す)
+//=============================================================================
+bool CMemoryManager::RunHeapCheck(const char* filename)
+{
+	CRenderQueue queue;
+	CRenderRecorder recorder(nullptr);
+
+	// 描画キューが選ぶ点光源(ゲームの松明の代わり)
+	CLight light;
+	light.Init();
+
+	for (int nCnt = 0; nCnt < 24; nCnt++)
+	{
+		CLight::AddLight(D3DLIGHT_POINT, D3DXCOLOR(1.0f, 0.6f, 0.3f, 1.0f), D3DXVECTOR3(0.0f, -1.0f, 0.0f),
+			D3DXVECTOR3((float)(nCnt * 400), 50.0f, 0.0f));
+	}
+
+	// 音はオーディオデバイスがある時だけ鳴らす(音量は0にする)
+	CSound sound;
+	CSound* pSound = nullptr;
+
+	if (SUCCEEDED(sound.Init(nullptr)))
+	{
+		sound.SetMasterVolume(0.0f);
+		pSound = &sound;
+	}
+
+	int nSoundId = -1;
+
+	// 容量やプールの確保を先に済ませる
+	for (int nFrame = 0; nFrame < HEAP_CHECK_WARMUP; nFrame++)
+	{
+		TickHeapCheck(nFrame, &queue, &recorder, pSound, &nSoundId);
+	}
+
+	// ここから先の確保を数える
+	m_nHeapCheckAlloc = 0;
+	InterlockedExchange(&m_bHeapCount, TRUE);
+
+	for (int nFrame = 0; nFrame < HEAP_CHECK_FRAME; nFrame++)
+	{
+		TickHeapCheck(HEAP_CHECK_WARMUP + nFrame, &queue, &recorder, pSound, &nSoundId);
+	}
+
+	InterlockedExchange(&m_bHeapCount, FALSE);
+
+	if (pSound != nullptr)
+	{
+		sound.Uninit();
+	}
+
+	CLight::Uninit();
+	m_sceneArena.Release();
+
+	bool bPass = (m_nHeapCheckAlloc == 0);
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "warmup frame           : %d\n", HEAP_CHECK_WARMUP);
+	fprintf(pFile, "check frame            : %d\n", HEAP_CHECK_FRAME);
+	fprintf(pFile, "queue packets / frame  : %d\n", HEAP_CHECK_PACKET);
+	fprintf(pFile, "arena objects / frame  : %d\n", HEAP_CHECK_OBJECT);
+	fprintf(pFile, "sound                  : %s\n", (pSound != nullptr) ? "played" : "skipped (no audio device)");
+	fprintf(pFile, "sound dropped          : %d\n", (pSound != nullptr) ? sound.GetDroppedCount() : 0);
+	fprintf(pFile, "heap alloc             : %ld\n", m_nHeapCheckAlloc);
+	fprintf(pFile, "heap alloc / frame     : %.2f\n", (double)m_nHeapCheckAlloc / HEAP_CHECK_FRAME);
+
+	// 見つかった確保のサイズ
+	int nNumRecord = (m_nHeapCheckAlloc < HEAP_CHECK_RECORD) ? (int)m_nHeapCheckAlloc : HEAP_CHECK_RECORD;
+
+	for (int nCnt = 0; nCnt < nNumRecord; nCnt++)
+	{
+		fprintf(pFile, "alloc size             : %zu bytes\n", m_aHeapRecord[nCnt]);
+	}
+
+	fprintf(pFile, "result                 : %s\n", bPass ? "pass" : "FAIL");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bPass;
+}
@@ -0,0 +1,184 @@
+//=============================================================================
+//
+// メモリ管理処理 [memorymanager.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _MEMORYMANAGER_H_// このマクロ定義がされていなかったら
+#define _MEMORYMANAGER_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "cstddef"
+
+//*****************************************************************************
+// 前方宣言
+//*****************************************************************************
+class CRenderQueue;
+class CRenderRecorder;
+class CSound;
+
+//*****************************************************************************
+// リニアアロケータークラス(確保は先頭から積むだけ、解放はまとめて行う)
+//*****************************************************************************
+class CLinearAllocator
+{
+public:
+	CLinearAllocator(size_t blockSize);
+	~CLinearAllocator();
+
+	void* Alloc(size_t size, size_t align = alignof(std::max_align_t));
+	void Reset(void);
+	void Release(void);
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	size_t GetUsedBytes(void) const { return m_usedBytes; }
+	size_t GetCapacity(void) const { return m_capacity; }
+	int GetAllocCount(void) const { return m_nAllocCount; }
+	int GetHeapAllocCount(void) const { return m_nHeapAllocCount; }
+
+private:
+	// メモリブロック構造体
+	struct Block
+	{
+		unsigned char*	pData;	// 先頭アドレス
+		size_t			size;	// ブロックのサイズ
+		size_t			used;	// 使用済みバイト数
+	};
+
+	void AddBlock(size_t minSize);
+
+	std::vector<Block>	m_blocks;			// 確保済みブロック
+	size_t				m_nCurBlock;		// 現在使用中のブロック
+	size_t				m_blockSize;		// 1ブロックの基本サイズ
+	size_t				m_usedBytes;		// 使用済みバイト数
+	size_t				m_capacity;			// 全ブロックの合計サイズ
+	int					m_nAllocCount;		// Reset後の確保回数
+	int					m_nHeapAllocCount;	// Reset後にヒープからブロックを確保した回数
+};
+
+//*****************************************************************************
+// シーンアリーナクラス(シーン中に生成と破棄を繰り返すオブジェクト用)
+//*****************************************************************************
+class CSceneArena
+{
+public:
+	CSceneArena();
+	~CSceneArena();
+
+	void* Alloc(size_t size);
+	void Free(void* p, size_t size);
+	bool Release(void);
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	size_t GetUsedBytes(void) const { return m_allocator.GetUsedBytes(); }
+	size_t GetCapacity(void) const { return m_allocator.GetCapacity(); }
+	int GetLiveCount(void) const { return m_nLiveCount; }
+	int GetReuseCount(void) const { return m_nReuseCount; }
+
+private:
+	static constexpr size_t SCENE_BLOCK_SIZE	= 1024 * 1024;	// 1ブロックのサイズ
+	static constexpr size_t SIZE_CLASS_STEP		= 16;			// サイズクラスの刻み
+	static constexpr size_t MAX_POOLED_SIZE		= 1024;			// フリーリストで再利用する最大サイズ
+	static constexpr size_t NUM_SIZE_CLASS		= MAX_POOLED_SIZE / SIZE_CLASS_STEP;
+
+	// フリーリストのノード(解放済み領域の先頭に書き込む)
+	struct FreeNode
+	{
+		FreeNode* pNext;
+	};
+
+	CLinearAllocator	m_allocator;					// 領域の確保元
+	FreeNode*			m_apFree[NUM_SIZE_CLASS];		// サイズクラスごとのフリーリスト
+	int					m_nLiveCount;					// 使用中の個数
+	int					m_nReuseCount;					// フリーリストから再利用した回数
+};
+
+//*****************************************************************************
+// メモリマネージャークラス
+//*****************************************************************************
+class CMemoryManager
+{
+public:
+	// フレーム単位の確保統計
+	struct FrameStats
+	{
+		int		nAllocCount		= 0;	// 確保回数
+		size_t	allocBytes		= 0;	// 確保バイト数
+		int		nHeapAllocCount	= 0;	// 汎用ヒープへのフォールバック回数
+	};
+
+	static void BeginFrame(void);
+	static void ReleaseScene(void);
+	static void Uninit(void);
+
+	// 汎用ヒープ確保の検査(ウィンドウもデバイスも作らずに毎フレームの処理を回し、定常状態で確保していないか調べる)
+	static bool RunHeapCheck(const char* filename);
+
+	// 汎用ヒープ確保の計測(全ての構成でoperator newから呼ばれる)
+	static void CountHeapAlloc(size_t size);
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static CLinearAllocator& GetFrameAllocator(void) { return m_frameAllocator; }
+	static CSceneArena& GetSceneArena(void) { return m_sceneArena; }
+	static const FrameStats& GetLastFrameStats(void) { return m_lastFrameStats; }
+	static size_t GetPeakFrameBytes(void) { return m_peakFrameBytes; }
+
+private:
+	static constexpr size_t FRAME_BLOCK_SIZE	= 256 * 1024;	// フレームアロケーターの1ブロックのサイズ
+	static constexpr int	HEAP_CHECK_WARMUP	= 60;			// 検査を始めるまでのフレーム数(容量やプールの確保を済ませる)
+	static constexpr int	HEAP_CHECK_FRAME	= 600;			// 検査するフレーム数
+	static constexpr int	HEAP_CHECK_RECORD	= 16;			// 報告用に記録する確保の数
+	static constexpr int	HEAP_CHECK_PACKET	= 200;			// 1フレームに描画キューへ積む数
+	static constexpr int	HEAP_CHECK_OBJECT	= 32;			// 1フレームにシーンアリーナで作り直す数
+	static constexpr int	HEAP_CHECK_SOUND	= 10;			// 音を鳴らし直す間隔(フレーム)
+
+	static void TickHeapCheck(int nFrame, CRenderQueue* pQueue, CRenderRecorder* pRecorder, CSound* pSound, int* pSoundId);
+
+	static CLinearAllocator	m_frameAllocator;							// フレームアロケーター
+	static CSceneArena		m_sceneArena;								// シーンアリーナ
+	static FrameStats		m_lastFrameStats;							// 前フレームの統計
+	static size_t			m_peakFrameBytes;							// 1フレームの最大使用量
+	static volatile LONG	m_bHeapCount;								// 汎用ヒープ確保を数えているか
+	static volatile LONG	m_nHeapCheckAlloc;							// 検査中の汎用ヒープ確保回数
+	static size_t			m_aHeapRecord[HEAP_CHECK_RECORD];			// 検査中に見つかった確保のサイズ
+};
+
+//*****************************************************************************
+// フレームアロケーターを使うSTLアロケーター(次のフレームで無効になる一時データ専用)
+//*****************************************************************************
+template<class T>
+class CFrameStlAllocator
+{
+public:
+	using value_type = T;
+
+	CFrameStlAllocator() noexcept {}
+	template<class U> CFrameStlAllocator(const CFrameStlAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(CMemoryManager::GetFrameAllocator().Alloc(sizeof(T) * n, alignof(T)));
+	}
+
+	void deallocate(T*, size_t) noexcept
+	{
+		// フレーム終了時にまとめて解放する
+	}
+
+	template<class U> bool operator==(const CFrameStlAllocator<U>&) const noexcept { return true; }
+	template<class U> bool operator!=(const CFrameStlAllocator<U>&) const noexcept { return false; }
+};
+
+// フレーム内でのみ有効な一時配列
+template<class T>
+using FrameVector = std::vector<T, CFrameStlAllocator<T>>;
+
+#endif
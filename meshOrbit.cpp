@@ -1,70 +1,72 @@
 //=============================================================================
 //
-// bV̋O [meshOrbit.cpp]
+// メッシュの軌道処理 [meshOrbit.cpp]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "meshOrbit.h"
 #include "manager.h"
+#include "random.h"
+#include "algorithm"
 
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+LPDIRECT3DTEXTURE9 CMeshOrbit::m_pRamp = nullptr;
+int CMeshOrbit::m_nNumInstance = 0;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMeshOrbit::CMeshOrbit(int nPriority) : CMeshBase(nPriority)
 {
-	// l̃NA
-	m_Top		= INIT_VEC3;	// ̈ʒu
-	m_Bottom	= INIT_VEC3;	// ̈ʒu
-	m_col		= INIT_XCOL;	// F
+	// 値のクリア
+	m_pVtxBuff	= nullptr;		// 頂点バッファ
+	m_pIdxBuff	= nullptr;		// インデックスバッファ
+	m_ring		= {};			// 頂点のリング
+	m_Top		= INIT_VEC3;	// 上の位置
+	m_Bottom	= INIT_VEC3;	// 下の位置
+	m_col		= INIT_XCOL;	// 色
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMeshOrbit::~CMeshOrbit()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
-CMeshOrbit* CMeshOrbit::Create(const D3DXVECTOR3 top, const D3DXVECTOR3 bottom, const D3DXCOLOR col, const int nSegH)
+CMeshOrbit* CMeshOrbit::Create(const D3DXVECTOR3 top, const D3DXVECTOR3 bottom, const D3DXCOLOR col, const int nSegH, const int nSubdiv)
 {
-	// CX^X𐶐
+	// インスタンスを生成
 	CMeshOrbit* pMesh = new CMeshOrbit;
 
-	// nullptrȂ΂
+	// nullptrなら飛ばす
 	if (pMesh == nullptr)
 	{
 		return nullptr;
 	}
 
-	// c̕
-	const int nSegV = 1;
-
-	// _̑
-	int nNumVtx = (nSegH + 1) * (nSegV + 1);
-
-	// CfbNX̑
-	int nNumIdx = nNumVtx;
-
-	// |S̑
-	int nNumPolygon = nNumVtx - 2;
-
-	// ̐ݒ
-	pMesh->SetSegment(nSegH, nSegV);
+	// 設定処理
+	pMesh->m_Bottom = bottom;
+	pMesh->m_Top = top;
+	pMesh->m_col = col;
+	pMesh->m_ring.nNumPair = nSegH * std::max(nSubdiv, 1) + 1;
+	pMesh->m_ring.nSubdiv = std::max(nSubdiv, 1);
 
-	// _̗vf̐ݒ
-	pMesh->SetVtxElement(nNumVtx, nNumPolygon, nNumIdx);
+	// 分割数の設定
+	pMesh->SetSegment(nSegH, 1);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pMesh->Init()))
 	{
-		// I
+		// 終了処理
 		pMesh->Uninit();
 
 		pMesh = nullptr;
@@ -72,122 +74,611 @@ CMeshOrbit* CMeshOrbit::Create(const D3DXVECTOR3 top, const D3DXVECTOR3 bottom,
 		return nullptr;
 	}
 
-	// eNX`()
-	float fPosTexH = 1.0f / nSegH;
+	return pMesh;
+}
+//=============================================================================
+// 初期化処理
+//=============================================================================
+HRESULT CMeshOrbit::Init(void)
+{
+	m_nNumInstance++;
+
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	int nNumPair = m_ring.nNumPair;
 
-	// _
-	for (int nCnt = 0; nCnt < nNumVtx; nCnt++)
+	// 頂点バッファの生成(同じ組を2か所に書くので2周分)
+	if (FAILED(pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4 * nNumPair,
+		D3DUSAGE_WRITEONLY,
+		FVF_VERTEX_3D,
+		D3DPOOL_MANAGED,
+		&m_pVtxBuff,
+		NULL)))
 	{
-		// At@l̐ݒ
-		float fAlpha = col.a * (1.0f - (float)nCnt / nNumVtx);
+		return E_FAIL;
+	}
 
-		// _̐ݒ
-		pMesh->SetVtxPos(top, nCnt);
+	// インデックスバッファの生成(1周分の連番。描き始めは頂点の位置でずらす)
+	if (FAILED(pDevice->CreateIndexBuffer(sizeof(WORD) * 2 * nNumPair,
+		D3DUSAGE_WRITEONLY,
+		D3DFMT_INDEX16,
+		D3DPOOL_MANAGED,
+		&m_pIdxBuff,
+		NULL)))
+	{
+		return E_FAIL;
+	}
 
-		// @AFAeNX`̐ݒ
-		pMesh->SetNormal(D3DXVECTOR3(0.0f, 1.0f, 0.0f), nCnt);
-		pMesh->SetVtxColor(D3DXCOLOR(col.r, col.g, col.b, fAlpha), nCnt);
-		pMesh->SetTexture(D3DXVECTOR2(fPosTexH * nCnt, 1.0f), nCnt);
+	WORD* pIdx = nullptr;
 
-		// CfbNXobt@̐ݒ
-		pMesh->SetIndexBuffer((WORD)nCnt, nCnt);
+	if (FAILED(pDevice->LockIndexBuffer(m_pIdxBuff, 0, 0, (void**)&pIdx, 0)))
+	{
+		return E_FAIL;
 	}
 
-	// 4On߂
-	for (int nCnt = nNumVtx - 4; nCnt >= 0; nCnt -= 2)
+	for (int nCnt = 0; nCnt < 2 * nNumPair; nCnt++)
 	{
-		// O̒_W
-		D3DXVECTOR3 OldVtx0 = pMesh->GetVtxPos(nCnt);
-		D3DXVECTOR3 OldVtx1 = pMesh->GetVtxPos(nCnt + 1);
-
-		// _W̐ݒ
-		pMesh->SetVtxPos(OldVtx0, nCnt + 2);
-		pMesh->SetVtxPos(OldVtx1, nCnt + 3);
+		pIdx[nCnt] = (WORD)nCnt;
 	}
 
-	// V_ǉi擪ɓj
-	pMesh->SetVtxPos(bottom, 0);
-	pMesh->SetVtxPos(top, 1);
+	pDevice->UnlockIndexBuffer(m_pIdxBuff);
 
-	// ݒ菈
-	pMesh->m_Bottom = bottom;
-	pMesh->m_Top = top;
-	pMesh->m_col = col;
+	// 全ての組を開始位置で埋める
+	VERTEX_3D* pVtx = nullptr;
 
-	return pMesh;
-}
-//=============================================================================
-// 
-//=============================================================================
-HRESULT CMeshOrbit::Init(void)
-{
-	// bVx[X̏
-	CMeshBase::Init();
+	if (FAILED(pDevice->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0)))
+	{
+		return E_FAIL;
+	}
 
-	// eNX`̐ݒ
-	SetTexPath("data/TEXTURE/.jpg");
+	InitRing(&m_ring, GetSegH(), m_ring.nSubdiv, m_Top, m_Bottom, m_col, pVtx);
+
+	pDevice->UnlockVertexBuffer(m_pVtxBuff);
+
+	// フェード用テクスチャは全ての軌跡で共有する
+	if (m_pRamp == nullptr)
+	{
+		CreateRamp();
+	}
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CMeshOrbit::Uninit(void)
 {
-	// bVx[X̏I
+	// 頂点バッファの破棄
+	if (m_pVtxBuff != nullptr)
+	{
+		m_pVtxBuff->Release();
+		m_pVtxBuff = nullptr;
+	}
+
+	// インデックスバッファの破棄
+	if (m_pIdxBuff != nullptr)
+	{
+		m_pIdxBuff->Release();
+		m_pIdxBuff = nullptr;
+	}
+
+	// 最後の軌跡ならテクスチャも破棄
+	if (--m_nNumInstance <= 0 && m_pRamp != nullptr)
+	{
+		m_pRamp->Release();
+		m_pRamp = nullptr;
+	}
+
+	// メッシュベースの終了処理
 	CMeshBase::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理(1回のロックで新しいサンプルの組だけを書き込む)
 //=============================================================================
 void CMeshOrbit::Update(void)
 {
-	int nSegH = GetSegH(); 	// ̎̕擾
-	int nSegV = 1;			// c̕
+	if (m_pVtxBuff == nullptr)
+	{
+		return;
+	}
 
-	// _̑
-	int nNumVtx = (nSegH + 1) * (nSegV + 1);
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+	VERTEX_3D* pVtx = nullptr;
 
-	// 4On߂
-	for (int nCnt = nNumVtx - 4; nCnt >= 0; nCnt -= 2)
+	if (FAILED(pDevice->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0)))
 	{
-		// O̒_W
-		D3DXVECTOR3 OldVtx0 = GetVtxPos(nCnt);
-		D3DXVECTOR3 OldVtx1 = GetVtxPos(nCnt + 1);
-
-		// _W̐ݒ
-		SetVtxPos(OldVtx0, nCnt + 2);
-		SetVtxPos(OldVtx1, nCnt + 3);
+		return;
 	}
 
-	// V_ǉi擪ɓj
-	SetVtxPos(m_Bottom, 0);
-	SetVtxPos(m_Top, 1);
+	// ロック回数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_ORBIT_LOCK);
+
+	PushRing(&m_ring, m_Top, m_Bottom, pVtx);
+
+	pDevice->UnlockVertexBuffer(m_pVtxBuff);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CMeshOrbit::Draw(void)
 {
-	// foCX̎擾
+	if (m_pVtxBuff == nullptr || m_pIdxBuff == nullptr)
+	{
+		return;
+	}
+
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	CRenderDevice* pBackend = CManager::GetRenderer()->GetBackend();
 
-	// JOݒ𖳌
+	// カリング設定を無効化
 	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
 
-	// aufBO
+	// aブレンディング
 	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
 	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
 	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE);
 
-	// bVx[X̕`揈
-	CMeshBase::Draw();
+	// ワールドマトリックスの設定
+	SetMatrix();
+
+	// テクスチャ座標をずらして最新の組を0、一番古い組を1にする(u' = 先頭の位置 - u)
+	D3DXMATRIX mtxTex;
+	D3DXMatrixIdentity(&mtxTex);
+	mtxTex._11 = -1.0f;
+	mtxTex._31 = GetHeadOffset(m_ring);
+
+	pDevice->SetTransform(D3DTS_TEXTURE0, &mtxTex);
+	pDevice->SetTextureStageState(0, D3DTSS_TEXTURETRANSFORMFLAGS, D3DTTFF_COUNT2);
+	pDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
+
+	pBackend->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
+	pBackend->SetIndices(m_pIdxBuff);
+	pBackend->SetFVF(FVF_VERTEX_3D);
+
+	// テクスチャ割り当て
+	pBackend->SetTexture(0, m_pRamp);
+
+	// 一番古い組から最新の組までを描く(2周目に同じ組があるので折り返さない)
+	int nNumPair = m_ring.nNumPair;
+	pBackend->DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, (m_ring.nHead + 1) * 2, 0, nNumPair * 2, 0, nNumPair * 2 - 2);
+
+	// テクスチャ座標の変換を元に戻す
+	pDevice->SetTextureStageState(0, D3DTSS_TEXTURETRANSFORMFLAGS, D3DTTFF_DISABLE);
+	pDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP);
 
-	// aufBOƂɖ߂
+	// aブレンディングをもとに戻す
 	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
 	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
 	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
 
-	// JOݒL
+	// カリング設定を有効化
 	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
 }
+//=============================================================================
+// リングの初期化処理(全ての組を開始位置にし、色とテクスチャ座標はここで書いたまま変えない)
+//=============================================================================
+void CMeshOrbit::InitRing(Ring* pRing, int nSegH, int nSubdiv, const D3DXVECTOR3& top, const D3DXVECTOR3& bottom,
+	const D3DXCOLOR& col, VERTEX_3D* pVtx)
+{
+	pRing->nSubdiv = std::max(nSubdiv, 1);
+	pRing->nNumPair = nSegH * pRing->nSubdiv + 1;
+	pRing->nHead = 0;
+
+	for (int nCnt = 0; nCnt < NUM_HISTORY; nCnt++)
+	{
+		pRing->aTop[nCnt] = top;
+		pRing->aBottom[nCnt] = bottom;
+	}
+
+	int nNumPair = pRing->nNumPair;
+
+	for (int nCnt = 0; nCnt < nNumPair * 2; nCnt++)
+	{
+		// 横のテクスチャ座標は2周分の通し番号(描画時に先頭の位置から引いて古さにする)
+		float fTexU = (float)nCnt / (nNumPair - 1);
+
+		VERTEX_3D* pPair = pVtx + nCnt * 2;
+
+		pPair[0].pos = bottom;
+		pPair[0].nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
+		pPair[0].col = col;
+		pPair[0].tex = D3DXVECTOR2(fTexU, 0.0f);
+
+		pPair[1].pos = top;
+		pPair[1].nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
+		pPair[1].col = col;
+		pPair[1].tex = D3DXVECTOR2(fTexU, 1.0f);
+	}
+}
+//=============================================================================
+// サンプルの追加処理(分割する時は1つ前の区間も次のサンプルを使って書き直す)
+//=============================================================================
+void CMeshOrbit::PushRing(Ring* pRing, const D3DXVECTOR3& top, const D3DXVECTOR3& bottom, VERTEX_3D* pVtx)
+{
+	// 直近のサンプルをずらす
+	for (int nCnt = NUM_HISTORY - 1; nCnt > 0; nCnt--)
+	{
+		pRing->aTop[nCnt] = pRing->aTop[nCnt - 1];
+		pRing->aBottom[nCnt] = pRing->aBottom[nCnt - 1];
+	}
+
+	pRing->aTop[0] = top;
+	pRing->aBottom[0] = bottom;
+
+	int nNumPair = pRing->nNumPair;
+	int nSubdiv = pRing->nSubdiv;
+
+	// 分割しない時は最新の組を1つ書くだけ
+	if (nSubdiv <= 1)
+	{
+		pRing->nHead = (pRing->nHead + 1) % nNumPair;
+		WritePair(*pRing, pRing->nHead, top, bottom, pVtx);
+		return;
+	}
+
+	const D3DXVECTOR3* pTop = pRing->aTop;
+	const D3DXVECTOR3* pBottom = pRing->aBottom;
+	D3DXVECTOR3 posTop, posBottom;
+
+	// 1つ前の区間(最後の組は前のサンプルそのものなので書かない)
+	for (int nCnt = 1; nCnt < nSubdiv; nCnt++)
+	{
+		float fRate = (float)nCnt / nSubdiv;
+		int nPos = (pRing->nHead - nSubdiv + nCnt + nNumPair) % nNumPair;
+
+		D3DXVec3CatmullRom(&posTop, &pTop[3], &pTop[2], &pTop[1], &pTop[0], fRate);
+		D3DXVec3CatmullRom(&posBottom, &pBottom[3], &pBottom[2], &pBottom[1], &pBottom[0], fRate);
+
+		WritePair(*pRing, nPos, posTop, posBottom, pVtx);
+	}
+
+	// 新しい区間(次のサンプルはまだ無いので、今の向きのまま延ばした点を使う)
+	D3DXVECTOR3 nextTop = pTop[0] * 2.0f - pTop[1];
+	D3DXVECTOR3 nextBottom = pBottom[0] * 2.0f - pBottom[1];
+
+	for (int nCnt = 1; nCnt <= nSubdiv; nCnt++)
+	{
+		float fRate = (float)nCnt / nSubdiv;
+
+		D3DXVec3CatmullRom(&posTop, &pTop[2], &pTop[1], &pTop[0], &nextTop, fRate);
+		D3DXVec3CatmullRom(&posBottom, &pBottom[2], &pBottom[1], &pBottom[0], &nextBottom, fRate);
+
+		pRing->nHead = (pRing->nHead + 1) % nNumPair;
+		WritePair(*pRing, pRing->nHead, posTop, posBottom, pVtx);
+	}
+}
+//=============================================================================
+// 組の書き込み処理(1周目と2周目の同じ位置に書く)
+//=============================================================================
+void CMeshOrbit::WritePair(const Ring& ring, int nPos, const D3DXVECTOR3& top, const D3DXVECTOR3& bottom, VERTEX_3D* pVtx)
+{
+	VERTEX_3D* pFirst = pVtx + nPos * 2;
+	VERTEX_3D* pSecond = pVtx + (nPos + ring.nNumPair) * 2;
+
+	pFirst[0].pos = bottom;
+	pFirst[1].pos = top;
+	pSecond[0].pos = bottom;
+	pSecond[1].pos = top;
+}
+//=============================================================================
+// フェード用テクスチャの生成処理(左が不透明、右が透明の白)
+//=============================================================================
+HRESULT CMeshOrbit::CreateRamp(void)
+{
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	if (FAILED(pDevice->CreateTexture(RAMP_SIZE, 1, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &m_pRamp, NULL)))
+	{
+		m_pRamp = nullptr;
+		return E_FAIL;
+	}
+
+	D3DLOCKED_RECT rect;
+
+	if (FAILED(m_pRamp->LockRect(0, &rect, NULL, 0)))
+	{
+		return E_FAIL;
+	}
+
+	DWORD* pTexel = (DWORD*)rect.pBits;
+
+	for (int nCnt = 0; nCnt < RAMP_SIZE; nCnt++)
+	{
+		DWORD alpha = (DWORD)(255 * (RAMP_SIZE - 1 - nCnt) / (RAMP_SIZE - 1));
+		pTexel[nCnt] = (alpha << 24) | 0x00ffffff;
+	}
+
+	m_pRamp->UnlockRect(0);
+
+	return S_OK;
+}
+//=============================================================================
+// ベンチマーク処理(頂点を1つずつずらす方法とリングを比べる)
+//=============================================================================
+bool CMeshOrbit::RunBenchmark(const char* filename)
+{
+	const int	SMOOTH_SEG		= 17;		// 曲線の確認に使うサンプル数(元の3分の1)
+	const int	SMOOTH_SUBDIV	= 3;		// 曲線の確認の分割数
+	const float	SWING_SPEED		= 0.25f;	// 剣を振る速さ(1フレームの角度)
+	const float	SWING_RADIUS	= 120.0f;	// 剣先の半径
+
+	const D3DXCOLOR col(0.7f, 0.3f, 1.0f, 0.8f);
+
+	LARGE_INTEGER freq, start, end;
+	QueryPerformanceFrequency(&freq);
+
+	auto toMs = [&](void) { return (double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)freq.QuadPart / BENCH_FRAME; };
+
+	CRandom random(3);
+
+	// --------------------------
+	// 並びが元の方法と同じになるか
+	// --------------------------
+	int nNumPair = BENCH_SEG + 1;
+
+	std::vector<D3DXVECTOR3> legacy((size_t)nNumPair * 2);
+	std::vector<VERTEX_3D> vtx((size_t)nNumPair * 4);
+	Ring ring;
+
+	D3DXVECTOR3 top(0.0f, 100.0f, 0.0f), bottom(0.0f, 0.0f, 0.0f);
+	InitRing(&ring, BENCH_SEG, 1, top, bottom, col, vtx.data());
+
+	for (int nCnt = 0; nCnt < nNumPair; nCnt++)
+	{
+		legacy[nCnt * 2] = bottom;
+		legacy[nCnt * 2 + 1] = top;
+	}
+
+	bool bMatch = true;
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME && bMatch; nFrame++)
+	{
+		top = D3DXVECTOR3(random.Range(-100.0f, 100.0f), random.Range(50.0f, 150.0f), random.Range(-100.0f, 100.0f));
+		bottom = D3DXVECTOR3(random.Range(-100.0f, 100.0f), random.Range(-50.0f, 50.0f), random.Range(-100.0f, 100.0f));
+
+		// 元の方法(後ろに1組ずつずらして先頭に入れる)
+		for (int nCnt = nNumPair * 2 - 4; nCnt >= 0; nCnt -= 2)
+		{
+			legacy[nCnt + 2] = legacy[nCnt];
+			legacy[nCnt + 3] = legacy[nCnt + 1];
+		}
+
+		legacy[0] = bottom;
+		legacy[1] = top;
+
+		PushRing(&ring, top, bottom, vtx.data());
+
+		// 描く範囲を新しい順に見て、位置と古さ(テクスチャ座標)を比べる
+		float fOffset = GetHeadOffset(ring);
+
+		for (int nAge = 0; nAge < nNumPair && bMatch; nAge++)
+		{
+			const VERTEX_3D* pPair = &vtx[(size_t)(ring.nHead + nNumPair - nAge) * 2];
+			float fAge = fOffset - pPair[0].tex.x;
+
+			bMatch = pPair[0].pos == legacy[nAge * 2] && pPair[1].pos == legacy[nAge * 2 + 1] &&
+				fabsf(fAge - (float)nAge / (nNumPair - 1)) < 0.0001f;
+		}
+	}
+
+	// --------------------------
+	// 書き込みの速さ(メモリ上)
+	// --------------------------
+	QueryPerformanceCounter(&start);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		for (int nCnt = nNumPair * 2 - 4; nCnt >= 0; nCnt -= 2)
+		{
+			legacy[nCnt + 2] = legacy[nCnt];
+			legacy[nCnt + 3] = legacy[nCnt + 1];
+		}
+
+		legacy[0] = bottom;
+		legacy[1] = top;
+	}
+
+	QueryPerformanceCounter(&end);
+	double fLegacyCpuMs = toMs();
+
+	QueryPerformanceCounter(&start);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		PushRing(&ring, top, bottom, vtx.data());
+	}
+
+	QueryPerformanceCounter(&end);
+	double fRingCpuMs = toMs();
+
+	// --------------------------
+	// 頂点バッファのロック(デバイスが作れた時だけ)
+	// --------------------------
+	int nLegacyLock = 0, nRingLock = 0;
+	double fLegacyLockMs = -1.0, fRingLockMs = -1.0;
+
+	LPDIRECT3D9 pD3D = Direct3DCreate9(D3D_SDK_VERSION);
+	LPDIRECT3DDEVICE9 pDevice = nullptr;
+
+	if (pD3D != nullptr)
+	{
+		D3DPRESENT_PARAMETERS d3dpp;
+		ZeroMemory(&d3dpp, sizeof(d3dpp));
+		d3dpp.BackBufferWidth = 1;
+		d3dpp.BackBufferHeight = 1;
+		d3dpp.BackBufferFormat = D3DFMT_UNKNOWN;
+		d3dpp.SwapEffect = D3DSWAPEFFECT_DISCARD;
+		d3dpp.Windowed = TRUE;
+
+		if (FAILED(pD3D->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_NULLREF, GetDesktopWindow(),
+			D3DCREATE_SOFTWARE_VERTEXPROCESSING, &d3dpp, &pDevice)))
+		{
+			pDevice = nullptr;
+		}
+	}
+
+	if (pDevice != nullptr)
+	{
+		LPDIRECT3DVERTEXBUFFER9 pLegacyBuff = nullptr;
+		LPDIRECT3DVERTEXBUFFER9 pRingBuff = nullptr;
+
+		pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 2 * nNumPair, D3DUSAGE_WRITEONLY, FVF_VERTEX_3D,
+			D3DPOOL_MANAGED, &pLegacyBuff, NULL);
+		pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4 * nNumPair, D3DUSAGE_WRITEONLY, FVF_VERTEX_3D,
+			D3DPOOL_MANAGED, &pRingBuff, NULL);
+
+		if (pLegacyBuff != nullptr && pRingBuff != nullptr)
+		{
+			VERTEX_3D* pVtx = nullptr;
+
+			// 元の方法(GetVtxPos・SetVtxPosが毎回ロックする)
+			auto getPos = [&](int nIdx)
+			{
+				pLegacyBuff->Lock(0, 0, (void**)&pVtx, 0);
+				D3DXVECTOR3 pos = pVtx[nIdx].pos;
+				pLegacyBuff->Unlock();
+				nLegacyLock++;
+				return pos;
+			};
+
+			auto setPos = [&](const D3DXVECTOR3& pos, int nIdx)
+			{
+				pLegacyBuff->Lock(0, 0, (void**)&pVtx, 0);
+				pVtx[nIdx].pos = pos;
+				pLegacyBuff->Unlock();
+				nLegacyLock++;
+			};
+
+			QueryPerformanceCounter(&start);
+
+			for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+			{
+				for (int nCnt = nNumPair * 2 - 4; nCnt >= 0; nCnt -= 2)
+				{
+					D3DXVECTOR3 OldVtx0 = getPos(nCnt);
+					D3DXVECTOR3 OldVtx1 = getPos(nCnt + 1);
+
+					setPos(OldVtx0, nCnt + 2);
+					setPos(OldVtx1, nCnt + 3);
+				}
+
+				setPos(bottom, 0);
+				setPos(top, 1);
+			}
+
+			QueryPerformanceCounter(&end);
+			fLegacyLockMs = toMs();
+
+			// リング(1フレーム1回)
+			pRingBuff->Lock(0, 0, (void**)&pVtx, 0);
+			InitRing(&ring, BENCH_SEG, 1, top, bottom, col, pVtx);
+			pRingBuff->Unlock();
+
+			QueryPerformanceCounter(&start);
+
+			for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+			{
+				pRingBuff->Lock(0, 0, (void**)&pVtx, 0);
+				PushRing(&ring, top, bottom, pVtx);
+				pRingBuff->Unlock();
+				nRingLock++;
+			}
+
+			QueryPerformanceCounter(&end);
+			fRingLockMs = toMs();
+		}
+
+		if (pLegacyBuff != nullptr)
+		{
+			pLegacyBuff->Release();
+		}
+
+		if (pRingBuff != nullptr)
+		{
+			pRingBuff->Release();
+		}
+
+		pDevice->Release();
+	}
+
+	if (pD3D != nullptr)
+	{
+		pD3D->Release();
+	}
+
+	// --------------------------
+	// 曲線の滑らかさ(剣先を円で振った時の、隣り合う辺の曲がる角度の最大)
+	// --------------------------
+	auto measureBend = [&](int nSegH, int nSubdiv)
+	{
+		Ring smooth;
+		std::vector<VERTEX_3D> smoothVtx((size_t)(nSegH * nSubdiv + 1) * 4);
+
+		D3DXVECTOR3 center(0.0f, 0.0f, 0.0f);
+		InitRing(&smooth, nSegH, nSubdiv, D3DXVECTOR3(SWING_RADIUS, 0.0f, 0.0f), center, col, smoothVtx.data());
+
+		// 軌跡が全部埋まるまで振る
+		for (int nFrame = 0; nFrame < nSegH + NUM_HISTORY; nFrame++)
+		{
+			float fAngle = nFrame * SWING_SPEED;
+			PushRing(&smooth, D3DXVECTOR3(cosf(fAngle) * SWING_RADIUS, 0.0f, sinf(fAngle) * SWING_RADIUS), center, smoothVtx.data());
+		}
+
+		float fMaxBend = 0.0f;
+		int nPair = smooth.nNumPair;
+
+		for (int nAge = 1; nAge < nPair - 1; nAge++)
+		{
+			D3DXVECTOR3 prev = smoothVtx[(size_t)(smooth.nHead + nPair - nAge + 1) * 2 + 1].pos;
+			D3DXVECTOR3 cur = smoothVtx[(size_t)(smooth.nHead + nPair - nAge) * 2 + 1].pos;
+			D3DXVECTOR3 next = smoothVtx[(size_t)(smooth.nHead + nPair - nAge - 1) * 2 + 1].pos;
+
+			D3DXVECTOR3 dir0 = cur - prev, dir1 = next - cur;
+			D3DXVec3Normalize(&dir0, &dir0);
+			D3DXVec3Normalize(&dir1, &dir1);
+
+			float fDot = std::max(-1.0f, std::min(1.0f, D3DXVec3Dot(&dir0, &dir1)));
+			fMaxBend = std::max(fMaxBend, D3DXToDegree(acosf(fDot)));
+		}
+
+		return fMaxBend;
+	};
+
+	float fBendCoarse = measureBend(SMOOTH_SEG, 1);
+	float fBendSmooth = measureBend(SMOOTH_SEG, SMOOTH_SUBDIV);
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "segments               : %d\n", BENCH_SEG);
+	fprintf(pFile, "frames                 : %d\n", BENCH_FRAME);
+	fprintf(pFile, "result match           : %s\n\n", bMatch ? "yes" : "no");
+	fprintf(pFile, "shift in memory  ms/f  : %.5f\n", fLegacyCpuMs);
+	fprintf(pFile, "ring in memory   ms/f  : %.5f\n", fRingCpuMs);
+
+	if (fLegacyLockMs >= 0.0)
+	{
+		fprintf(pFile, "shift per vertex locks : %d /frame  %.4f ms/f\n", nLegacyLock / BENCH_FRAME, fLegacyLockMs);
+		fprintf(pFile, "ring locks             : %d /frame  %.4f ms/f\n", nRingLock / BENCH_FRAME, fRingLockMs);
+	}
+	else
+	{
+		fprintf(pFile, "vertex buffer          : no device\n");
+	}
+
+	fprintf(pFile, "\nmax bend (deg, %.2f rad/frame swing)\n", SWING_SPEED);
+	fprintf(pFile, "%2d samples             : %.1f  (1 pair written /frame)\n", SMOOTH_SEG, fBendCoarse);
+	fprintf(pFile, "%2d samples x%d subdiv   : %.1f  (%d pairs written /frame)\n", SMOOTH_SEG, SMOOTH_SUBDIV, fBendSmooth, SMOOTH_SUBDIV * 2 - 1);
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bMatch;
+}
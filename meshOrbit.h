@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// bV̋O [meshOrbit.h]
+// メッシュの軌道処理 [meshOrbit.h]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,13 +8,13 @@
 #define _MESHORBIT_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "meshbase.h"
 
 
 //*****************************************************************************
-// bV̋ONX
+// メッシュの軌道クラス(頂点はリングで持ち、毎フレーム最新の組だけを書き込む)
 //*****************************************************************************
 class CMeshOrbit : public CMeshBase
 {
@@ -22,22 +22,51 @@ public:
 	CMeshOrbit(int nPriority = 5);
 	~CMeshOrbit();
 
-	static CMeshOrbit* Create(const D3DXVECTOR3 top, const D3DXVECTOR3 bottom, const D3DXCOLOR col, const int nSegH);
+	// nSegH : 残すサンプル数 / nSubdiv : サンプル間をCatmull-Romで何分割するか(1なら分割しない)
+	static CMeshOrbit* Create(const D3DXVECTOR3 top, const D3DXVECTOR3 bottom, const D3DXCOLOR col, const int nSegH, const int nSubdiv = 1);
 	HRESULT Init(void);
 	void Uninit(void);
 	void Update(void);
 	void Draw(void);
+	static bool RunBenchmark(const char* filename);
 
 	//*************************************************************************
-	// setter֐
+	// setter関数
 	//*************************************************************************
 	void SetStartPos(D3DXVECTOR3 top, D3DXVECTOR3 bottom) { m_Top = top; m_Bottom = bottom; }
 
 private:
-	D3DXVECTOR3 m_Top;		// ̈ʒu
-	D3DXVECTOR3 m_Bottom;	// ̈ʒu
-	D3DXCOLOR	m_col;		// F
+	static constexpr int NUM_HISTORY	= 4;	// 曲線に使うサンプルの数
+	static constexpr int RAMP_SIZE		= 256;	// フェード用テクスチャの幅
+	static constexpr int BENCH_SEG		= 50;	// ベンチマークの軌跡のサンプル数(敵の攻撃と同じ)
+	static constexpr int BENCH_FRAME	= 600;	// ベンチマークのフレーム数
 
+	// 頂点のリング(頂点バッファは2周分あり、同じ組を2か所に書くので常に連続した範囲で描ける)
+	typedef struct
+	{
+		int			nNumPair;					// 1周の組(上下の頂点)の数
+		int			nSubdiv;					// サンプル間の分割数
+		int			nHead;						// 最新の組の位置
+		D3DXVECTOR3	aTop[NUM_HISTORY];			// 直近のサンプル(上・0が最新)
+		D3DXVECTOR3	aBottom[NUM_HISTORY];		// 直近のサンプル(下・0が最新)
+	}Ring;
+
+	static void InitRing(Ring* pRing, int nSegH, int nSubdiv, const D3DXVECTOR3& top, const D3DXVECTOR3& bottom,
+		const D3DXCOLOR& col, VERTEX_3D* pVtx);
+	static void PushRing(Ring* pRing, const D3DXVECTOR3& top, const D3DXVECTOR3& bottom, VERTEX_3D* pVtx);
+	static void WritePair(const Ring& ring, int nPos, const D3DXVECTOR3& top, const D3DXVECTOR3& bottom, VERTEX_3D* pVtx);
+	static float GetHeadOffset(const Ring& ring) { return (float)(ring.nHead + ring.nNumPair) / (ring.nNumPair - 1); }
+	static HRESULT CreateRamp(void);
+
+	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// 頂点バッファ(リング2周分)
+	LPDIRECT3DINDEXBUFFER9	m_pIdxBuff;		// インデックスバッファ(1周分の連番)
+	Ring		m_ring;						// 頂点のリング
+	D3DXVECTOR3 m_Top;						// 上の位置
+	D3DXVECTOR3 m_Bottom;					// 下の位置
+	D3DXCOLOR	m_col;						// 色
+
+	static LPDIRECT3DTEXTURE9	m_pRamp;		// 古い組ほど透明にするテクスチャ(全ての軌跡で共有)
+	static int					m_nNumInstance;	// 生きている軌跡の数
 };
 
 #endif
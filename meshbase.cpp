@@ -1,51 +1,51 @@
 //=============================================================================
 //
-// bṼx[X [meshbase.cpp]
+// メッシュのベース処理 [meshbase.cpp]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "meshbase.h"
 #include "manager.h"
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMeshBase::CMeshBase(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_pVtxBuff		= nullptr;		// _obt@ւ̃|C^
-	m_pIdxBuff		= nullptr;		// CfbNXobt@ւ̃|C^
-	m_pos			= INIT_VEC3;	// ʒu
-	m_rot			= INIT_VEC3;	// 
-	m_mtxWorld		= {};			// [h}gbNX
-	m_nSegmentH		= 0;			// ̕
-	m_nSegmentV		= 0;			// c̕
-	m_nIdxTexture	= -1;			// eNX`̃CfbNX
-	m_nNumVtx		= 0;			// _
-	m_nNumPolygon	= 0;			// |S
-	m_nNumIdx		= 0;			// CfbNXobt@
+	// 値のクリア
+	m_pVtxBuff		= nullptr;		// 頂点バッファへのポインタ
+	m_pIdxBuff		= nullptr;		// インデックスバッファへのポインタ
+	m_pos			= INIT_VEC3;	// 位置
+	m_rot			= INIT_VEC3;	// 向き
+	m_mtxWorld		= {};			// ワールドマトリックス
+	m_nSegmentH		= 0;			// 横の分割数
+	m_nSegmentV		= 0;			// 縦の分割数
+	m_nIdxTexture	= -1;			// テクスチャのインデックス
+	m_nNumVtx		= 0;			// 頂点数
+	m_nNumPolygon	= 0;			// ポリゴン数
+	m_nNumIdx		= 0;			// インデックスバッファ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMeshBase::~CMeshBase()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CMeshBase::Init(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// _obt@̐
+	// 頂点バッファの生成
 	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * m_nNumVtx,
 		D3DUSAGE_WRITEONLY,
 		FVF_VERTEX_3D,
@@ -53,7 +53,7 @@ HRESULT CMeshBase::Init(void)
 		&m_pVtxBuff,
 		NULL);
 
-	// CfbNXobt@̐
+	// インデックスバッファの生成
 	pDevice->CreateIndexBuffer(sizeof(WORD) * m_nNumIdx,
 		D3DUSAGE_WRITEONLY,
 		D3DFMT_INDEX16,
@@ -64,281 +64,291 @@ HRESULT CMeshBase::Init(void)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CMeshBase::Uninit(void)
 {
-	// _obt@̔j
+	// テクスチャの参照を外す
+	if (CManager::GetTexture() != nullptr)
+	{
+		CManager::GetTexture()->Release(m_nIdxTexture);
+		m_nIdxTexture = -1;
+	}
+
+	// 頂点バッファの破棄
 	if (m_pVtxBuff != nullptr)
 	{
 		m_pVtxBuff->Release();
 		m_pVtxBuff = nullptr;
 	}
 
-	// CfbNXobt@̔j
+	// インデックスバッファの破棄
 	if (m_pIdxBuff != nullptr)
 	{
 		m_pIdxBuff->Release();
 		m_pIdxBuff = nullptr;
 	}
 
-	// g̔j
+	// 自身の破棄
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CMeshBase::Draw(void)
 {
-	// foCX̃|C^
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	// デバイスのポインタ
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	// eNX`̎擾
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// vZp̃}gbNX錾
+	// 計算用のマトリックスを宣言
 	D3DXMATRIX mtxRot, mtxTrans;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNX̐ݒ
+	// ワールドマトリックスの設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// _obt@foCX̃f[^Xg[ɐݒ
+	// 頂点バッファをデバイスのデータストリームに設定
 	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
 
-	// CfbNXobt@f[^Xg[ɐݒ
+	// インデックスバッファをデータストリームに設定
 	pDevice->SetIndices(m_pIdxBuff);
 
-	// eNX`tH[}bg̐ݒ
+	// テクスチャフォーマットの設定
 	pDevice->SetFVF(FVF_VERTEX_3D);
 
-	// eNX`蓖
+	// テクスチャ割り当て
 	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
 
-	// |S̕`
+	// ポリゴンの描画
 	pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, 0, 0, m_nNumVtx, 0, m_nNumPolygon);
 }
 //=============================================================================
-// _W̐ݒ
+// 頂点座標の設定
 //=============================================================================
 void CMeshBase::SetVtxBuffer(const D3DXVECTOR3 pos, const int nIdx, const D3DXVECTOR2 tex, const D3DXVECTOR3 nor, const D3DXCOLOR col)
 {
 	VERTEX_3D* pVtx = nullptr;
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	pVtx[nIdx].pos = pos;
 
-	//@xNg̐ݒ
+	//法線ベクトルの設定
 	pVtx[nIdx].nor = nor;
 
-	//_J[̐ݒ
+	//頂点カラーの設定
 	pVtx[nIdx].col = col;
 
-	//eNX`W̐ݒ
+	//テクスチャ座標の設定
 	pVtx[nIdx].tex = tex;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 }
 //=============================================================================
-// CfbNXobt@̐ݒ
+// インデックスバッファの設定
 //=============================================================================
 void CMeshBase::SetIndexBuffer(const WORD Idx, const int nCnt)
 {
 	WORD* pIdx;
 
-	//CfbNXobt@̃bN
-	m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0);
+	//インデックスバッファのロック
+	CManager::GetRenderer()->GetBackend()->LockIndexBuffer(m_pIdxBuff, 0, 0, (void**)&pIdx, 0);
 
 	pIdx[nCnt] = Idx;
 
-	//CfbNXobt@̃AbN
-	m_pIdxBuff->Unlock();
+	//インデックスバッファのアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockIndexBuffer(m_pIdxBuff);
 }
 //=============================================================================
-// eNX`̐ݒ菈
+// テクスチャの設定処理
 //=============================================================================
 void CMeshBase::SetTexPath(const char* pTextureName)
 {
-	// eNX`̎擾
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
+	// 前のテクスチャの参照を外す
+	pTexture->Release(m_nIdxTexture);
+
 	if (pTextureName == NULL)
 	{
 		m_nIdxTexture = -1;
 		return;
 	}
 
-	// eNX`ID̐ݒ
+	// テクスチャのIDの設定
 	m_nIdxTexture = pTexture->RegisterDynamic(pTextureName);
 }
 //=============================================================================
-// _̗vf̐ݒ菈
+// 頂点の要素の設定処理
 //=============================================================================
 void CMeshBase::SetVtxElement(const int vertex, const int polygon, const int index)
 {
-	// _̐ݒ
+	// 頂点数の設定
 	m_nNumVtx = vertex;
 
-	// |S̐ݒ
+	// ポリゴン数の設定
 	m_nNumPolygon = polygon;
 
-	// CfbNX̐ݒ
+	// インデックス数の設定
 	m_nNumIdx = index;
 }
 //=============================================================================
-// }gbNX̐ݒ
+// マトリックスの設定
 //=============================================================================
 void CMeshBase::SetMatrix(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	//vZp̃}gbNX
+	//計算用のマトリックス
 	D3DXMATRIX mtxRot, mtxTrans;
 
-	//[h}gbNX̏
+	//ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	//𔽉f
+	//向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	//ʒu𔽉f
+	//位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	//[h}gbNX̐ݒ
+	//ワールドマトリックスの設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 }
 //=============================================================================
-// _̈ʒu̐ݒ
+// 頂点の位置の設定
 //=============================================================================
 void CMeshBase::SetVtxPos(const D3DXVECTOR3 pos, const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	pVtx[nIdx].pos = pos;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 }
 //=============================================================================
-// @̐ݒ
+// 法線の設定
 //=============================================================================
 void CMeshBase::SetNormal(const D3DXVECTOR3 nor, const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	pVtx[nIdx].nor = nor;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 }
 //=============================================================================
-// F̐ݒ
+// 色の設定
 //=============================================================================
 void CMeshBase::SetVtxColor(const D3DXCOLOR col, const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	pVtx[nIdx].col = col;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 }
 //=============================================================================
-// eNX`obt@̐ݒ
+// テクスチャバッファの設定
 //=============================================================================
 void CMeshBase::SetTexture(const D3DXVECTOR2 tex, const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	pVtx[nIdx].tex = tex;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 }
 //=============================================================================
-// _W̎擾
+// 頂点座標の取得
 //=============================================================================
 D3DXVECTOR3 CMeshBase::GetVtxPos(const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
 	D3DXVECTOR3 out;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return INIT_VEC3;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	out = pVtx[nIdx].pos;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 
 	return out;
 }
 //=============================================================================
-// CfbNXԍ̎擾
+// インデックス番号の取得
 //=============================================================================
 int CMeshBase::GetIndex(const int nIdx)
 {
@@ -346,73 +356,73 @@ int CMeshBase::GetIndex(const int nIdx)
 
 	int out = 0;
 
-	// null
+	// nullだったら
 	if (m_pIdxBuff == nullptr)
 	{
 		return 0;
 	}
 
-	//CfbNXobt@̃bN
-	m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0);
+	//インデックスバッファのロック
+	CManager::GetRenderer()->GetBackend()->LockIndexBuffer(m_pIdxBuff, 0, 0, (void**)&pIdx, 0);
 
 	out = pIdx[nIdx];
 
-	//CfbNXobt@̃AbN
-	m_pIdxBuff->Unlock();
+	//インデックスバッファのアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockIndexBuffer(m_pIdxBuff);
 
 	return out;
 }
 //=============================================================================
-// F̎擾
+// 色の取得
 //=============================================================================
 D3DXCOLOR CMeshBase::GetColor(const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
 	D3DXCOLOR out;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return INIT_XCOL_WHITE;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
 	out = pVtx[nIdx].col;
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 
 	return out;
 }
 //=============================================================================
-// @̐K
+// 法線の正規化処理
 //=============================================================================
 D3DXVECTOR3 CMeshBase::NormalizeNormal(const int nIdx)
 {
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	// nullptr
+	// nullptrだったら
 	if (m_pVtxBuff == nullptr)
 	{
 		return INIT_VEC3;
 	}
 
-	// _obt@bN
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	// 頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtxBuff, 0, 0, (void**)&pVtx, 0);
 
-	// @
+	// 法線
 	D3DXVECTOR3 nor = pVtx[nIdx].pos - m_pos;
 
-	// K
+	// 正規化する
 	D3DXVec3Normalize(&nor, &nor);
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点バッファをアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtxBuff);
 
 	return nor;
 }
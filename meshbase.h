@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// bṼx[X [meshbase.h]
+// メッシュのベース処理 [meshbase.h]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,13 +8,13 @@
 #define _MESHBASE_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 
 //*****************************************************************************
-// bVx[XNX
+// メッシュベースクラス
 //*****************************************************************************
 class CMeshBase : public CObject
 {
@@ -27,7 +27,7 @@ public:
 	virtual void Draw(void);
 
 	//*************************************************************************
-	// setter֐
+	// setter関数
 	//*************************************************************************
 	void SetPosition(const D3DXVECTOR3 pos) { m_pos = pos; }
 	void SetRotation(const D3DXVECTOR3 rot) { m_rot = rot; }
@@ -45,7 +45,7 @@ public:
 	void SetTexture(const D3DXVECTOR2 tex, const int nIdx);
 
 	//*************************************************************************
-	// getter֐
+	// getter関数
 	//*************************************************************************
 	int GetSegH(void) const { return m_nSegmentH; }
 	int GetSegV(void) const { return m_nSegmentV; }
@@ -56,17 +56,17 @@ public:
 	D3DXCOLOR GetColor(const int nIdx);
 
 private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;			// _obt@ւ̃|C^
-	LPDIRECT3DINDEXBUFFER9	m_pIdxBuff;			// CfbNXobt@ւ̃|C^
-	D3DXVECTOR3				m_pos;				// ʒu
-	D3DXVECTOR3				m_rot;				// 
-	D3DXMATRIX				m_mtxWorld;			// [h}gbNX
-	int						m_nSegmentH;		// ̕
-	int						m_nSegmentV;		// c̕
-	int						m_nIdxTexture;		// eNX`̃CfbNX
-	int						m_nNumVtx;			// _
-	int						m_nNumPolygon;		// |S
-	int						m_nNumIdx;			// CfbNXobt@
+	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;			// 頂点バッファへのポインタ
+	LPDIRECT3DINDEXBUFFER9	m_pIdxBuff;			// インデックスバッファへのポインタ
+	D3DXVECTOR3				m_pos;				// 位置
+	D3DXVECTOR3				m_rot;				// 向き
+	D3DXMATRIX				m_mtxWorld;			// ワールドマトリックス
+	int						m_nSegmentH;		// 横の分割数
+	int						m_nSegmentV;		// 縦の分割数
+	int						m_nIdxTexture;		// テクスチャのインデックス
+	int						m_nNumVtx;			// 頂点数
+	int						m_nNumPolygon;		// ポリゴン数
+	int						m_nNumIdx;			// インデックスバッファ
 };
 
 #endif
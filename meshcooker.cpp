@@ -0,0 +1,793 @@
+//=============================================================================
+//
+// メッシュ変換処理 [meshcooker.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "meshcooker.h"
+#include "assetloader.h"
+#include "fstream"
+#include "sstream"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::unordered_map<std::string, std::string> CMeshCooker::m_resolved;
+
+//=============================================================================
+// 変換処理(ウィンドウを出さずに全ての.xを変換し、読み戻して確認・計測して終了する)
+//=============================================================================
+bool CMeshCooker::Run(const char* pLogFile)
+{
+	// 変換用のデバイスを作る(描画はしないのでNULLREFで良い)
+	LPDIRECT3D9 pD3D = Direct3DCreate9(D3D_SDK_VERSION);
+
+	if (pD3D == nullptr)
+	{
+		return false;
+	}
+
+	D3DPRESENT_PARAMETERS d3dpp;
+	ZeroMemory(&d3dpp, sizeof(d3dpp));
+	d3dpp.BackBufferWidth = 1;
+	d3dpp.BackBufferHeight = 1;
+	d3dpp.BackBufferFormat = D3DFMT_UNKNOWN;
+	d3dpp.SwapEffect = D3DSWAPEFFECT_DISCARD;
+	d3dpp.Windowed = TRUE;
+
+	LPDIRECT3DDEVICE9 pDevice = nullptr;
+
+	if (FAILED(pD3D->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_NULLREF, GetDesktopWindow(),
+		D3DCREATE_SOFTWARE_VERTEXPROCESSING, &d3dpp, &pDevice)))
+	{
+		if (FAILED(pD3D->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_REF, GetDesktopWindow(),
+			D3DCREATE_SOFTWARE_VERTEXPROCESSING, &d3dpp, &pDevice)))
+		{
+			pD3D->Release();
+			return false;
+		}
+	}
+
+	std::vector<std::string> sources;
+	FindSources(SOURCE_DIR, &sources);
+
+	std::ostringstream log;
+	int nNumFailed = 0;
+	bool bRejectCorrupt = true;
+
+	for (const auto& source : sources)
+	{
+		std::string line;
+
+		if (FAILED(Cook(pDevice, source, GetCookedPath(source), &line)))
+		{
+			nNumFailed++;
+		}
+		else if (&source == &sources.front())
+		{// 壊れたファイルを読まずに元の.xへ戻れるか(最初の1つで確かめる)
+			std::vector<BYTE> cooked;
+			std::ifstream ifs(GetCookedPath(source), std::ios::binary);
+			cooked.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+			bRejectCorrupt = CheckCorrupt(cooked);
+		}
+
+		log << line << "\n";
+	}
+
+	pDevice->Release();
+	pD3D->Release();
+
+	// 結果の書き出し
+	FILE* pFile = fopen(pLogFile, "w");
+
+	if (pFile != nullptr)
+	{
+		fprintf(pFile, "sources          : %d\n", (int)sources.size());
+		fprintf(pFile, "failed           : %d\n", nNumFailed);
+		fprintf(pFile, "reject corrupt   : %s\n", bRejectCorrupt ? "yes" : "no");
+		fprintf(pFile, "bench loops      : %d\n\n", BENCH_NUM_LOOP);
+		fprintf(pFile, "file,vertices,faces,subsets,index,valid,x_ms,xmb_ms\n");
+		fprintf(pFile, "%s", log.str().c_str());
+
+		// ファイルを閉じる
+		fclose(pFile);
+	}
+
+	return nNumFailed == 0 && bRejectCorrupt;
+}
+//=============================================================================
+// 変換済みメッシュの読み込み処理(1回読んだ中身から、バッファにそのまま写す)
+//=============================================================================
+HRESULT CMeshCooker::Load(const BYTE* pData, size_t size, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+	LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax)
+{
+	MeshData data;
+
+	if (!Parse(pData, size, &data))
+	{
+		return E_FAIL;
+	}
+
+	HRESULT hr = Create(data, pDevice, options, ppMat, pNumMat, ppMesh);
+
+	if (SUCCEEDED(hr) && pMin != nullptr && pMax != nullptr)
+	{
+		*pMin = data.vMin;
+		*pMax = data.vMax;
+	}
+
+	return hr;
+}
+//=============================================================================
+// 変換済みメッシュの解析処理(デバイスを使わないのでワーカースレッドから呼べる)
+//=============================================================================
+bool CMeshCooker::Parse(const BYTE* pData, size_t size, MeshData* pOut)
+{
+	if (pData == nullptr || size < sizeof(Header))
+	{
+		return false;
+	}
+
+	Header header;
+	memcpy(&header, pData, sizeof(Header));
+
+	if (memcmp(header.magic, "NJMB", 4) != 0 || header.version != FORMAT_VERSION)
+	{
+		return false;
+	}
+
+	// 頂点の大きさは頂点フォーマットから決まる(違えば壊れている)
+	if (header.vertexSize == 0 || header.vertexSize != D3DXGetFVFVertexSize(header.fvf))
+	{
+		return false;
+	}
+
+	// 数はファイルの大きさを超えられない(掛け算が溢れないよう先に割って比べる)
+	size_t idxSize = header.index32 ? sizeof(DWORD) : sizeof(WORD);
+	size_t remain = size - sizeof(Header);
+
+	if (header.numVertices == 0 || header.numFaces == 0 ||
+		header.numVertices > remain / header.vertexSize ||
+		header.numFaces > remain / (idxSize * 3 + sizeof(DWORD)) ||
+		header.numSubsets > remain / sizeof(D3DXATTRIBUTERANGE) ||
+		header.numMaterials > remain / (sizeof(D3DMATERIAL9) + sizeof(DWORD)))
+	{
+		return false;
+	}
+
+	// 16bitのインデックスで指せない頂点数
+	if (header.index32 == 0 && header.numVertices > 0x10000)
+	{
+		return false;
+	}
+
+	size_t vtxBytes = (size_t)header.numVertices * header.vertexSize;
+	size_t idxBytes = (size_t)header.numFaces * 3 * idxSize;
+	size_t attrBytes = (size_t)header.numFaces * sizeof(DWORD);
+	size_t tableBytes = (size_t)header.numSubsets * sizeof(D3DXATTRIBUTERANGE);
+
+	const BYTE* p = pData + sizeof(Header);
+	const BYTE* pEnd = pData + size;
+
+	if ((size_t)(pEnd - p) < vtxBytes + idxBytes + attrBytes + tableBytes)
+	{
+		return false;
+	}
+
+	pOut->fvf = header.fvf;
+	pOut->numVertices = header.numVertices;
+	pOut->numFaces = header.numFaces;
+	pOut->bIndex32 = (header.index32 != 0);
+	pOut->vMin = header.vMin;
+	pOut->vMax = header.vMax;
+
+	pOut->vertices.assign(p, p + vtxBytes);
+	p += vtxBytes;
+
+	pOut->indices.assign(p, p + idxBytes);
+	p += idxBytes;
+
+	pOut->attributes.resize(header.numFaces);
+	memcpy(pOut->attributes.data(), p, attrBytes);
+	p += attrBytes;
+
+	pOut->table.resize(header.numSubsets);
+	memcpy(pOut->table.data(), p, tableBytes);
+	p += tableBytes;
+
+	// 範囲外の頂点を指すインデックス・属性テーブルがあれば使わない(描画時に範囲外を読むため)
+	for (DWORD nCnt = 0; nCnt < header.numFaces * 3; nCnt++)
+	{
+		DWORD nIdx = pOut->bIndex32 ? ((const DWORD*)pOut->indices.data())[nCnt] : ((const WORD*)pOut->indices.data())[nCnt];
+
+		if (nIdx >= header.numVertices)
+		{
+			return false;
+		}
+	}
+
+	for (const auto& range : pOut->table)
+	{
+		if ((size_t)range.FaceStart + range.FaceCount > header.numFaces ||
+			(size_t)range.VertexStart + range.VertexCount > header.numVertices)
+		{
+			return false;
+		}
+	}
+
+	// マテリアル
+	pOut->materials.resize(header.numMaterials);
+	pOut->textures.assign(header.numMaterials, std::string());
+	pOut->abTexture.assign(header.numMaterials, false);
+
+	for (DWORD nCnt = 0; nCnt < header.numMaterials; nCnt++)
+	{
+		DWORD nLen = 0;
+
+		if ((size_t)(pEnd - p) < sizeof(D3DMATERIAL9) + sizeof(DWORD))
+		{
+			return false;
+		}
+
+		memcpy(&pOut->materials[nCnt], p, sizeof(D3DMATERIAL9));
+		p += sizeof(D3DMATERIAL9);
+		memcpy(&nLen, p, sizeof(DWORD));
+		p += sizeof(DWORD);
+
+		if (nLen > 0)
+		{
+			if ((size_t)(pEnd - p) < nLen)
+			{
+				return false;
+			}
+
+			pOut->textures[nCnt].assign((const char*)p, nLen);
+			pOut->abTexture[nCnt] = true;
+			p += nLen;
+		}
+	}
+
+	return true;
+}
+//=============================================================================
+// 解析済みメッシュからの作成処理(メインスレッドでバッファに写すだけ)
+//=============================================================================
+HRESULT CMeshCooker::Create(const MeshData& data, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+	LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh)
+{
+	// メッシュの作成
+	LPD3DXMESH pMesh = nullptr;
+	DWORD meshOptions = options | (data.bIndex32 ? D3DXMESH_32BIT : 0);
+
+	if (FAILED(D3DXCreateMeshFVF(data.numFaces, data.numVertices, meshOptions, data.fvf, pDevice, &pMesh)))
+	{
+		return E_FAIL;
+	}
+
+	void* pLock = nullptr;
+
+	if (SUCCEEDED(pMesh->LockVertexBuffer(0, &pLock)))
+	{
+		memcpy(pLock, data.vertices.data(), data.vertices.size());
+		pMesh->UnlockVertexBuffer();
+	}
+
+	if (SUCCEEDED(pMesh->LockIndexBuffer(0, &pLock)))
+	{
+		memcpy(pLock, data.indices.data(), data.indices.size());
+		pMesh->UnlockIndexBuffer();
+	}
+
+	DWORD* pAttr = nullptr;
+
+	if (SUCCEEDED(pMesh->LockAttributeBuffer(0, &pAttr)))
+	{
+		memcpy(pAttr, data.attributes.data(), data.attributes.size() * sizeof(DWORD));
+		pMesh->UnlockAttributeBuffer();
+	}
+
+	// 属性テーブル(DrawSubsetで面を探し直さずに済む)
+	if (!data.table.empty())
+	{
+		pMesh->SetAttributeTable(data.table.data(), (DWORD)data.table.size());
+	}
+
+	// マテリアル(テクスチャ名はD3DXと同じくバッファの後ろに並べる)
+	DWORD dwNumMat = (DWORD)data.materials.size();
+	size_t nameBytes = 0;
+
+	for (DWORD nCnt = 0; nCnt < dwNumMat; nCnt++)
+	{
+		if (data.abTexture[nCnt])
+		{
+			nameBytes += data.textures[nCnt].size() + 1;
+		}
+	}
+
+	LPD3DXBUFFER pMat = nullptr;
+
+	if (FAILED(D3DXCreateBuffer((DWORD)(sizeof(D3DXMATERIAL) * dwNumMat + nameBytes), &pMat)))
+	{
+		pMesh->Release();
+		return E_FAIL;
+	}
+
+	D3DXMATERIAL* pDst = (D3DXMATERIAL*)pMat->GetBufferPointer();
+	char* pName = (char*)(pDst + dwNumMat);
+
+	for (DWORD nCnt = 0; nCnt < dwNumMat; nCnt++)
+	{
+		pDst[nCnt].MatD3D = data.materials[nCnt];
+		pDst[nCnt].pTextureFilename = nullptr;
+
+		if (data.abTexture[nCnt])
+		{
+			memcpy(pName, data.textures[nCnt].c_str(), data.textures[nCnt].size() + 1);
+			pDst[nCnt].pTextureFilename = pName;
+			pName += data.textures[nCnt].size() + 1;
+		}
+	}
+
+	*ppMesh = pMesh;
+	*ppMat = pMat;
+	*pNumMat = dwNumMat;
+
+	return S_OK;
+}
+//=============================================================================
+// 境界だけの読み込み処理(先読み中の仮表示の大きさを決めるため、ファイルの先頭だけ読む)
+//=============================================================================
+bool CMeshCooker::ReadBounds(const char* pFilename, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax)
+{
+	FILE* pFile = fopen(pFilename, "rb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	Header header;
+	size_t nRead = fread(&header, sizeof(Header), 1, pFile);
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	if (nRead != 1 || memcmp(header.magic, "NJMB", 4) != 0 || header.version != FORMAT_VERSION)
+	{
+		return false;
+	}
+
+	*pMin = header.vMin;
+	*pMax = header.vMax;
+
+	return true;
+}
+//=============================================================================
+// 変換済みファイルのパスかの判定処理(拡張子で見る)
+//=============================================================================
+bool CMeshCooker::IsCookedPath(const std::string& path)
+{
+	size_t nLen = strlen(COOKED_EXT);
+
+	return path.size() > nLen && _stricmp(path.c_str() + path.size() - nLen, COOKED_EXT) == 0;
+}
+//=============================================================================
+// 実際に読むパスの取得処理(元の.xより新しい変換済みファイルがあればそちら)
+//=============================================================================
+const std::string& CMeshCooker::ResolvePath(const char* pFilename)
+{
+	auto it = m_resolved.find(pFilename);
+
+	if (it != m_resolved.end())
+	{
+		return it->second;
+	}
+
+	std::string cooked = GetCookedPath(pFilename);
+	bool bCooked = GetFileAttributesA(cooked.c_str()) != INVALID_FILE_ATTRIBUTES && !IsNewer(pFilename, cooked);
+
+	return m_resolved[pFilename] = bCooked ? cooked : std::string(pFilename);
+}
+//=============================================================================
+// 変換後のパスの取得処理(拡張子だけ変える)
+//=============================================================================
+std::string CMeshCooker::GetCookedPath(const std::string& source)
+{
+	size_t nDot = source.find_last_of('.');
+	size_t nSlash = source.find_last_of("/\\");
+
+	if (nDot == std::string::npos || (nSlash != std::string::npos && nDot < nSlash))
+	{
+		return source + COOKED_EXT;
+	}
+
+	return source.substr(0, nDot) + COOKED_EXT;
+}
+//=============================================================================
+// 壊れたファイルの確認処理(正しいファイルを読めて、頭や中身を壊した物は全て読まない事を確かめる)
+//=============================================================================
+bool CMeshCooker::CheckCorrupt(const std::vector<BYTE>& cooked)
+{
+	MeshData data;
+
+	if (!Parse(cooked.data(), cooked.size(), &data))
+	{
+		return false;
+	}
+
+	// 頭の値を1つ書き換えて解析する
+	auto reject = [&](size_t offset, DWORD value)
+	{
+		std::vector<BYTE> broken = cooked;
+		memcpy(&broken[offset], &value, sizeof(value));
+
+		MeshData out;
+		return !Parse(broken.data(), broken.size(), &out);
+	};
+
+	Header header;
+	memcpy(&header, cooked.data(), sizeof(Header));
+
+	bool bResult = reject(offsetof(Header, vertexSize), header.vertexSize + 4) &&
+		reject(offsetof(Header, vertexSize), 0) &&
+		reject(offsetof(Header, numVertices), 0xffffffff) &&
+		reject(offsetof(Header, numFaces), 0x7fffffff) &&
+		reject(offsetof(Header, numSubsets), 0xffffffff) &&
+		reject(offsetof(Header, numMaterials), 0xffffffff);
+
+	// 最初のインデックスを頂点数にする(範囲外)
+	size_t idxOffset = sizeof(Header) + (size_t)header.numVertices * header.vertexSize;
+
+	if (header.index32)
+	{
+		bResult = bResult && reject(idxOffset, header.numVertices);
+	}
+	else if (header.numVertices < 0x10000)
+	{
+		std::vector<BYTE> broken = cooked;
+		WORD nIdx = (WORD)header.numVertices;
+		memcpy(&broken[idxOffset], &nIdx, sizeof(nIdx));
+
+		MeshData out;
+		bResult = bResult && !Parse(broken.data(), broken.size(), &out);
+	}
+
+	// 途中で切れたファイル
+	MeshData out;
+	bResult = bResult && !Parse(cooked.data(), cooked.size() - 1, &out) &&
+		!Parse(cooked.data(), sizeof(Header) - 1, &out);
+
+	return bResult;
+}
+//=============================================================================
+// 1ファイルの変換処理(頂点キャッシュ向けに並べ替えてから書き出す)
+//=============================================================================
+HRESULT CMeshCooker::Cook(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::string& cooked, std::string* pLog)
+{
+	*pLog = source + ",0,0,0,-,no,0,0";
+
+	LPD3DXBUFFER pAdjacency = nullptr;
+	LPD3DXBUFFER pMat = nullptr;
+	DWORD dwNumMat = 0;
+	LPD3DXMESH pMesh = nullptr;
+
+	if (FAILED(D3DXLoadMeshFromXA(source.c_str(), D3DXMESH_SYSTEMMEM, pDevice, &pAdjacency, &pMat, nullptr, &dwNumMat, &pMesh)))
+	{
+		return E_FAIL;
+	}
+
+	// FVFで表せない宣言のメッシュはゲームで使う形式にする
+	if ((pMesh->GetFVF() & D3DFVF_POSITION_MASK) != D3DFVF_XYZ)
+	{
+		LPD3DXMESH pClone = nullptr;
+
+		if (SUCCEEDED(pMesh->CloneMeshFVF(pMesh->GetOptions(), D3DFVF_XYZ | D3DFVF_NORMAL | D3DFVF_TEX1, pDevice, &pClone)))
+		{
+			pMesh->Release();
+			pMesh = pClone;
+		}
+	}
+
+	// 属性ごとに面をまとめ、頂点キャッシュに合わせて並べ替える
+	pMesh->OptimizeInplace(D3DXMESHOPT_ATTRSORT | D3DXMESHOPT_VERTEXCACHE,
+		(const DWORD*)pAdjacency->GetBufferPointer(), nullptr, nullptr, nullptr);
+
+	pAdjacency->Release();
+
+	Header header;
+	ZeroMemory(&header, sizeof(header));
+	memcpy(header.magic, "NJMB", 4);
+	header.version = FORMAT_VERSION;
+	header.fvf = pMesh->GetFVF();
+	header.vertexSize = D3DXGetFVFVertexSize(header.fvf);
+	header.numVertices = pMesh->GetNumVertices();
+	header.numFaces = pMesh->GetNumFaces();
+	header.index32 = (pMesh->GetOptions() & D3DXMESH_32BIT) ? 1 : 0;
+	header.numMaterials = dwNumMat;
+
+	pMesh->GetAttributeTable(nullptr, &header.numSubsets);
+	std::vector<D3DXATTRIBUTERANGE> table(header.numSubsets);
+
+	if (header.numSubsets > 0)
+	{
+		pMesh->GetAttributeTable(table.data(), &header.numSubsets);
+	}
+
+	size_t vtxBytes = (size_t)header.numVertices * header.vertexSize;
+	size_t idxBytes = (size_t)header.numFaces * 3 * (header.index32 ? sizeof(DWORD) : sizeof(WORD));
+	size_t attrBytes = (size_t)header.numFaces * sizeof(DWORD);
+
+	std::vector<BYTE> out(sizeof(Header) + vtxBytes + idxBytes + attrBytes);
+	BYTE* p = out.data() + sizeof(Header);
+
+	// 頂点と境界
+	BYTE* pVtx = nullptr;
+	header.vMin = D3DXVECTOR3(FLT_MAX, FLT_MAX, FLT_MAX);
+	header.vMax = D3DXVECTOR3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	if (SUCCEEDED(pMesh->LockVertexBuffer(D3DLOCK_READONLY, (void**)&pVtx)))
+	{
+		memcpy(p, pVtx, vtxBytes);
+
+		for (DWORD nCnt = 0; nCnt < header.numVertices; nCnt++)
+		{
+			const D3DXVECTOR3* pPos = (const D3DXVECTOR3*)(pVtx + header.vertexSize * nCnt);
+			D3DXVec3Minimize(&header.vMin, &header.vMin, pPos);
+			D3DXVec3Maximize(&header.vMax, &header.vMax, pPos);
+		}
+
+		pMesh->UnlockVertexBuffer();
+	}
+	p += vtxBytes;
+
+	void* pIdx = nullptr;
+
+	if (SUCCEEDED(pMesh->LockIndexBuffer(D3DLOCK_READONLY, &pIdx)))
+	{
+		memcpy(p, pIdx, idxBytes);
+		pMesh->UnlockIndexBuffer();
+	}
+	p += idxBytes;
+
+	DWORD* pAttr = nullptr;
+
+	if (SUCCEEDED(pMesh->LockAttributeBuffer(D3DLOCK_READONLY, &pAttr)))
+	{
+		memcpy(p, pAttr, attrBytes);
+		pMesh->UnlockAttributeBuffer();
+	}
+
+	memcpy(out.data(), &header, sizeof(Header));
+
+	// 属性テーブル
+	const BYTE* pTable = (const BYTE*)table.data();
+	out.insert(out.end(), pTable, pTable + table.size() * sizeof(D3DXATTRIBUTERANGE));
+
+	// マテリアルとテクスチャ名
+	const D3DXMATERIAL* pSrcMat = (const D3DXMATERIAL*)pMat->GetBufferPointer();
+
+	for (DWORD nCnt = 0; nCnt < dwNumMat; nCnt++)
+	{
+		const BYTE* pMatData = (const BYTE*)&pSrcMat[nCnt].MatD3D;
+		out.insert(out.end(), pMatData, pMatData + sizeof(D3DMATERIAL9));
+
+		DWORD nLen = pSrcMat[nCnt].pTextureFilename ? (DWORD)strlen(pSrcMat[nCnt].pTextureFilename) : 0;
+		const BYTE* pLen = (const BYTE*)&nLen;
+		out.insert(out.end(), pLen, pLen + sizeof(DWORD));
+
+		if (nLen > 0)
+		{
+			out.insert(out.end(), (const BYTE*)pSrcMat[nCnt].pTextureFilename, (const BYTE*)pSrcMat[nCnt].pTextureFilename + nLen);
+		}
+	}
+
+	// 書き出し
+	std::ofstream ofs(cooked, std::ios::binary);
+
+	if (!ofs)
+	{
+		pMesh->Release();
+		pMat->Release();
+		return E_FAIL;
+	}
+
+	ofs.write((const char*)out.data(), out.size());
+	ofs.close();
+
+	// 読み戻して確認と計測
+	bool bValid = Validate(pDevice, pMesh, pMat, dwNumMat, out);
+
+	double fSourceMs = 0.0, fCookedMs = 0.0;
+	Bench(pDevice, source, out, &fSourceMs, &fCookedMs);
+
+	char aLine[512];
+	snprintf(aLine, sizeof(aLine), "%s,%u,%u,%u,%s,%s,%.3f,%.3f",
+		source.c_str(), header.numVertices, header.numFaces, header.numSubsets,
+		header.index32 ? "32" : "16", bValid ? "yes" : "no", fSourceMs, fCookedMs);
+	*pLog = aLine;
+
+	pMesh->Release();
+	pMat->Release();
+
+	return bValid ? S_OK : E_FAIL;
+}
+//=============================================================================
+// 読み戻しの確認処理(変換前のメッシュとバッファの中身が一致するか)
+//=============================================================================
+bool CMeshCooker::Validate(LPDIRECT3DDEVICE9 pDevice, LPD3DXMESH pMesh, LPD3DXBUFFER pMat, DWORD dwNumMat, const std::vector<BYTE>& cooked)
+{
+	LPD3DXMESH pLoaded = nullptr;
+	LPD3DXBUFFER pLoadedMat = nullptr;
+	DWORD dwLoadedNumMat = 0;
+	D3DXVECTOR3 vMin, vMax;
+
+	if (FAILED(Load(cooked.data(), cooked.size(), pDevice, D3DXMESH_SYSTEMMEM, &pLoadedMat, &dwLoadedNumMat, &pLoaded, &vMin, &vMax)))
+	{
+		return false;
+	}
+
+	bool bMatch = pLoaded->GetFVF() == pMesh->GetFVF() &&
+		pLoaded->GetNumVertices() == pMesh->GetNumVertices() &&
+		pLoaded->GetNumFaces() == pMesh->GetNumFaces() &&
+		dwLoadedNumMat == dwNumMat;
+
+	// バッファの中身を比べる
+	auto compare = [](const void* a, const void* b, size_t size) { return a != nullptr && b != nullptr && memcmp(a, b, size) == 0; };
+
+	if (bMatch)
+	{
+		size_t vtxBytes = (size_t)pMesh->GetNumVertices() * D3DXGetFVFVertexSize(pMesh->GetFVF());
+		size_t idxBytes = (size_t)pMesh->GetNumFaces() * 3 * ((pMesh->GetOptions() & D3DXMESH_32BIT) ? sizeof(DWORD) : sizeof(WORD));
+		size_t attrBytes = (size_t)pMesh->GetNumFaces() * sizeof(DWORD);
+
+		void* a = nullptr;
+		void* b = nullptr;
+
+		pMesh->LockVertexBuffer(D3DLOCK_READONLY, &a);
+		pLoaded->LockVertexBuffer(D3DLOCK_READONLY, &b);
+		bMatch = bMatch && compare(a, b, vtxBytes);
+		pLoaded->UnlockVertexBuffer();
+		pMesh->UnlockVertexBuffer();
+
+		pMesh->LockIndexBuffer(D3DLOCK_READONLY, &a);
+		pLoaded->LockIndexBuffer(D3DLOCK_READONLY, &b);
+		bMatch = bMatch && compare(a, b, idxBytes);
+		pLoaded->UnlockIndexBuffer();
+		pMesh->UnlockIndexBuffer();
+
+		DWORD* pAttrA = nullptr;
+		DWORD* pAttrB = nullptr;
+
+		pMesh->LockAttributeBuffer(D3DLOCK_READONLY, &pAttrA);
+		pLoaded->LockAttributeBuffer(D3DLOCK_READONLY, &pAttrB);
+		bMatch = bMatch && compare(pAttrA, pAttrB, attrBytes);
+		pLoaded->UnlockAttributeBuffer();
+		pMesh->UnlockAttributeBuffer();
+	}
+
+	// マテリアルとテクスチャ名
+	if (bMatch)
+	{
+		const D3DXMATERIAL* pA = (const D3DXMATERIAL*)pMat->GetBufferPointer();
+		const D3DXMATERIAL* pB = (const D3DXMATERIAL*)pLoadedMat->GetBufferPointer();
+
+		for (DWORD nCnt = 0; nCnt < dwNumMat && bMatch; nCnt++)
+		{
+			bMatch = memcmp(&pA[nCnt].MatD3D, &pB[nCnt].MatD3D, sizeof(D3DMATERIAL9)) == 0;
+
+			const char* pNameA = pA[nCnt].pTextureFilename;
+			const char* pNameB = pB[nCnt].pTextureFilename;
+
+			if (pNameA != nullptr && pNameA[0] == '\0')
+			{// 空の名前は書き出さない
+				pNameA = nullptr;
+			}
+
+			bMatch = bMatch && ((pNameA == nullptr && pNameB == nullptr) ||
+				(pNameA != nullptr && pNameB != nullptr && strcmp(pNameA, pNameB) == 0));
+		}
+	}
+
+	pLoaded->Release();
+	pLoadedMat->Release();
+
+	return bMatch;
+}
+//=============================================================================
+// 読み込み時間の計測処理(どちらもメモリ上の中身から作る時間だけを比べる)
+//=============================================================================
+void CMeshCooker::Bench(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::vector<BYTE>& cooked, double* pSourceMs, double* pCookedMs)
+{
+	std::ifstream ifs(source, std::ios::binary);
+	std::vector<BYTE> data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+	double fStart = CAssetLoader::GetTimeMs();
+
+	for (int nCnt = 0; nCnt < BENCH_NUM_LOOP; nCnt++)
+	{
+		LPD3DXMESH pMesh = nullptr;
+		LPD3DXBUFFER pMat = nullptr;
+		DWORD dwNumMat = 0;
+
+		if (SUCCEEDED(D3DXLoadMeshFromXInMemory(data.data(), (DWORD)data.size(), D3DXMESH_SYSTEMMEM,
+			pDevice, nullptr, &pMat, nullptr, &dwNumMat, &pMesh)))
+		{
+			pMesh->Release();
+			pMat->Release();
+		}
+	}
+
+	*pSourceMs = (CAssetLoader::GetTimeMs() - fStart) / BENCH_NUM_LOOP;
+
+	fStart = CAssetLoader::GetTimeMs();
+
+	for (int nCnt = 0; nCnt < BENCH_NUM_LOOP; nCnt++)
+	{
+		LPD3DXMESH pMesh = nullptr;
+		LPD3DXBUFFER pMat = nullptr;
+		DWORD dwNumMat = 0;
+
+		if (SUCCEEDED(Load(cooked.data(), cooked.size(), pDevice, D3DXMESH_SYSTEMMEM, &pMat, &dwNumMat, &pMesh, nullptr, nullptr)))
+		{
+			pMesh->Release();
+			pMat->Release();
+		}
+	}
+
+	*pCookedMs = (CAssetLoader::GetTimeMs() - fStart) / BENCH_NUM_LOOP;
+}
+//=============================================================================
+// aがbより新しいかの判定処理(更新日時で比べる)
+//=============================================================================
+bool CMeshCooker::IsNewer(const std::string& a, const std::string& b)
+{
+	WIN32_FILE_ATTRIBUTE_DATA dataA, dataB;
+
+	if (!GetFileAttributesExA(a.c_str(), GetFileExInfoStandard, &dataA) ||
+		!GetFileAttributesExA(b.c_str(), GetFileExInfoStandard, &dataB))
+	{
+		return false;
+	}
+
+	return CompareFileTime(&dataA.ftLastWriteTime, &dataB.ftLastWriteTime) > 0;
+}
+//=============================================================================
+// .xを集める処理(サブフォルダも探す)
+//=============================================================================
+void CMeshCooker::FindSources(const std::string& dir, std::vector<std::string>* pOut)
+{
+	WIN32_FIND_DATAA findData;
+	HANDLE hFind = FindFirstFileA((dir + "*").c_str(), &findData);
+
+	if (hFind == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	do
+	{
+		std::string name = findData.cFileName;
+
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+		{
+			if (name != "." && name != "..")
+			{
+				FindSources(dir + name + "/", pOut);
+			}
+
+			continue;
+		}
+
+		if (name.size() > 2 && _stricmp(name.c_str() + name.size() - 2, ".x") == 0)
+		{
+			pOut->push_back(dir + name);
+		}
+	} while (FindNextFileA(hFind, &findData));
+
+	FindClose(hFind);
+}
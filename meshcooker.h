@@ -0,0 +1,84 @@
+//=============================================================================
+//
+// メッシュ変換処理 [meshcooker.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _MESHCOOKER_H_// このマクロ定義がされていなかったら
+#define _MESHCOOKER_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "unordered_map"
+
+//*****************************************************************************
+// メッシュ変換クラス(.xをそのままバッファに写せるバイナリ形式に事前変換する)
+//*****************************************************************************
+class CMeshCooker
+{
+public:
+	static constexpr const char* SOURCE_DIR	= "data/MODELS/";	// 元の.xのフォルダ(サブフォルダも含む)
+	static constexpr const char* COOKED_EXT	= ".xmb";			// 変換後の拡張子(元と同じ場所に置く)
+
+	// 解析済みのメッシュ(デバイスを使わずに作れるので、ワーカーで作ってメインスレッドはバッファに写すだけ)
+	typedef struct
+	{
+		DWORD							fvf;			// 頂点フォーマット
+		DWORD							numVertices;	// 頂点数
+		DWORD							numFaces;		// 面数
+		bool							bIndex32;		// インデックスが32bitか
+		std::vector<BYTE>				vertices;		// 頂点
+		std::vector<BYTE>				indices;		// インデックス
+		std::vector<DWORD>				attributes;		// 面ごとの属性
+		std::vector<D3DXATTRIBUTERANGE>	table;			// 属性テーブル
+		std::vector<D3DMATERIAL9>		materials;		// マテリアル
+		std::vector<std::string>		textures;		// テクスチャ名(無ければ空)
+		std::vector<bool>				abTexture;		// テクスチャ名があるか
+		D3DXVECTOR3						vMin;			// 境界の最小
+		D3DXVECTOR3						vMax;			// 境界の最大
+	}MeshData;
+
+	static bool Run(const char* pLogFile);
+	static HRESULT Load(const BYTE* pData, size_t size, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+		LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax);
+	static bool Parse(const BYTE* pData, size_t size, MeshData* pOut);
+	static HRESULT Create(const MeshData& data, LPDIRECT3DDEVICE9 pDevice, DWORD options,
+		LPD3DXBUFFER* ppMat, DWORD* pNumMat, LPD3DXMESH* ppMesh);
+	static bool ReadBounds(const char* pFilename, D3DXVECTOR3* pMin, D3DXVECTOR3* pMax);
+	static bool IsCookedPath(const std::string& path);
+	static const std::string& ResolvePath(const char* pFilename);
+	static std::string GetCookedPath(const std::string& source);
+	static void ClearCache(void) { m_resolved.clear(); }
+
+private:
+	static constexpr DWORD	FORMAT_VERSION	= 1;		// 形式を変えたら上げる
+	static constexpr int	BENCH_NUM_LOOP	= 20;		// 読み込み時間の計測回数
+
+	// ファイルの先頭(並びを変えたらtools/meshcookのCXMesh::Serializeも合わせる)
+	typedef struct
+	{
+		char		magic[4];		// "NJMB"
+		DWORD		version;		// 形式の版
+		DWORD		fvf;			// 頂点フォーマット
+		DWORD		vertexSize;		// 1頂点のバイト数
+		DWORD		numVertices;	// 頂点数
+		DWORD		numFaces;		// 面数
+		DWORD		index32;		// インデックスが32bitか
+		DWORD		numSubsets;		// 属性テーブルの数
+		DWORD		numMaterials;	// マテリアル数
+		D3DXVECTOR3	vMin;			// 境界の最小
+		D3DXVECTOR3	vMax;			// 境界の最大
+	}Header;
+
+	static HRESULT Cook(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::string& cooked, std::string* pLog);
+	static bool Validate(LPDIRECT3DDEVICE9 pDevice, LPD3DXMESH pMesh, LPD3DXBUFFER pMat, DWORD dwNumMat, const std::vector<BYTE>& cooked);
+	static void Bench(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::vector<BYTE>& cooked, double* pSourceMs, double* pCookedMs);
+	static bool CheckCorrupt(const std::vector<BYTE>& cooked);
+	static bool IsNewer(const std::string& a, const std::string& b);
+	static void FindSources(const std::string& dir, std::vector<std::string>* pOut);
+
+	static std::unordered_map<std::string, std::string> m_resolved;	// 元のパスから実際に読むパスへの対応
+};
+
+#endif
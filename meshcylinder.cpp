@@ -1,319 +0,0 @@
-//=============================================================================
-//
-// bVV_[ [meshcylinder.h]
-// Author : RIKU TANEKAWA
-//
-//=============================================================================
-
-//*****************************************************************************
-// CN[ht@C
-//*****************************************************************************
-#include "meshcylinder.h"
-#include "manager.h"
-
-//=============================================================================
-// RXgN^
-//=============================================================================
-CMeshCylinder::CMeshCylinder(int nPriority) : CObject(nPriority)
-{
-	// l̃NA
-	m_pVtxBuff		= nullptr;	// _obt@ւ̃|C^
-	m_pIdxBuff		= nullptr;	// CfbNXobt@ւ̃|C^
-	m_mtxWorld		= {};		// [h}gbNX
-	m_pos			= INIT_VEC3;// ʒu
-	m_rot			= INIT_VEC3;// 
-	m_col			= INIT_XCOL;// F
-	m_fRadius		= 0.0f;		// a
-	m_incRadius		= 0.0f;		// ȃ
-	m_nLife			= 0;		// ݂̎
-	m_nMaxLife		= 0;		// ݒ莞̎
-	m_decAlpha		= 0.0f;		// At@ľ
-	m_fLineweight	= 0.0f;		// 
-}
-//=============================================================================
-// fXgN^
-//=============================================================================
-CMeshCylinder::~CMeshCylinder()
-{
-	// Ȃ
-}
-//=============================================================================
-// 
-//=============================================================================
-CMeshCylinder* CMeshCylinder::Create(D3DXVECTOR3 pos, D3DXCOLOR col, float fRad, float fWeight, float incRad, int nLife, float decAlpha)
-{
-	CMeshCylinder* pCylinder = new CMeshCylinder;
-
-	// nullptr
-	if (pCylinder == nullptr)
-	{
-		return nullptr;
-	}
-
-	pCylinder->SetPos(pos);
-	pCylinder->SetCol(col);
-	pCylinder->SetRadius(fRad);
-	pCylinder->SetLineweight(fWeight);
-	pCylinder->SetIncRadius(incRad);
-	pCylinder->SetLife(nLife);
-	pCylinder->SetDecAlpha(decAlpha);
-
-	// s
-	if (FAILED(pCylinder->Init()))
-	{
-		return nullptr;
-	}
-
-	return pCylinder;
-}
-//=============================================================================
-// 
-//=============================================================================
-HRESULT CMeshCylinder::Init(void)
-{
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * MESHCYLINDER_VERTEX,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_3D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	// CfbNXobt@̐
-	pDevice->CreateIndexBuffer(sizeof(WORD) * MESHCYLINDER_INDEX,
-		D3DUSAGE_WRITEONLY,
-		D3DFMT_INDEX16,
-		D3DPOOL_MANAGED,
-		&m_pIdxBuff,
-		NULL);
-
-	VERTEX_3D* pVtx = nullptr;// _ւ̃|C^
-
-	int nCnt = 0;
-	//float tex = 1.0f / MESHCYLINDER_X;
-	//float tex2 = 1.0f / MESHCYLINDER_Z;
-	D3DXVECTOR3 nor;
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	for (int nCntV = 0; nCntV < MESHCYLINDER_V + 1; nCntV++)
-	{
-		for (int nCntH = 0; nCntH < MESHCYLINDER_H + 1; nCntH++)
-		{
-			float Angle = (D3DX_PI * 2.0f) / MESHCYLINDER_H * nCntH;
-
-			pVtx[nCnt].pos = D3DXVECTOR3(
-				sinf(Angle) * m_fRadius - sinf(Angle),
-				0.0f, 
-				cosf(Angle) * m_fRadius - cosf(Angle)
-			);
-
-			nor.x = pVtx[nCnt].pos.x - 0.0f;
-			nor.y = pVtx[nCnt].pos.y - 0.0f;
-			nor.z = pVtx[nCnt].pos.z - 0.0f;
-
-			// @̐K
-			D3DXVec3Normalize(&pVtx[nCnt].nor, &nor);
-
-			// _J[̐ݒ
-			pVtx[nCnt].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-
-			// eNX`W̐ݒ
-			pVtx[nCnt].tex = D3DXVECTOR2(/*tex * */(float)nCntV, /*tex2 * */(float)nCntH);
-
-			nCnt++;
-		}
-	}
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-
-	WORD* pIdx;// CfbNXւ̃|C^
-
-	// CfbNXobt@bNA_ւ̃|C^擾
-	m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0);
-
-	int nCntIdx3 = MESHCYLINDER_X + 1;
-	int Num = 0;
-	int nCntNum = 0;
-
-	// CfbNX̐ݒ
-	for (int nCntIdx = 0; nCntIdx < MESHCYLINDER_Z; nCntIdx++)
-	{
-		for (int nCntIdx2 = 0; nCntIdx2 <= MESHCYLINDER_X; nCntIdx2++, nCntIdx3++, Num++)
-		{
-			pIdx[nCntNum] = (WORD)nCntIdx3;
-
-			pIdx[nCntNum + 1] = (WORD)Num;
-
-			nCntNum += 2;
-		}
-
-		// Ō̍sǂ
-		// NOTE: Ō̍sɏkރ|S
-		if (nCntIdx != MESHCYLINDER_Z - 1)
-		{
-			pIdx[nCntNum] = (WORD)Num - 1;
-
-			pIdx[nCntNum + 1] = (WORD)nCntIdx3;
-
-			nCntNum += 2;
-		}
-	}
-
-	// CfbNXobt@AbN
-	m_pIdxBuff->Unlock();
-
-	return S_OK;
-}
-//=============================================================================
-// I
-//=============================================================================
-void CMeshCylinder::Uninit(void)
-{
-	// CfbNXobt@̉
-	if (m_pIdxBuff != nullptr)
-	{
-		m_pIdxBuff->Release();
-		m_pIdxBuff = nullptr;
-	}
-
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
-
-	// IuWFNg̔j(g)
-	this->Release();
-}
-//=============================================================================
-// XV
-//=============================================================================
-void CMeshCylinder::Update(void)
-{
-	m_col.a -= m_decAlpha;// At@lXɉ
-
-	m_nLife--;
-
-	float fMugLife = (float)m_nLife / 50;
-	float fAlpha = m_col.a * fMugLife;
-
-	// ܂̓At@l0ɂȂ
-	if (m_nLife <= 0)
-	{
-		// I
-		Uninit();
-		return;
-	}
-
-	// aXɍL
-	m_fRadius += m_incRadius;
-
-	VERTEX_3D* pVtx = nullptr;// _ւ̃|C^
-
-	int nCnt = 0;
-	
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	for (int nCntV = 0; nCntV < MESHCYLINDER_V + 1; nCntV++)
-	{
-		for (int nCntH = 0; nCntH < MESHCYLINDER_H + 1; nCntH++)
-		{
-			float Angle = (D3DX_PI * 2.0f) / MESHCYLINDER_H * nCntH;
-
-			pVtx[nCnt].pos = D3DXVECTOR3(
-				sinf(Angle) * m_fRadius - sinf(Angle) * nCntV * m_fLineweight,
-				0.0f,
-				cosf(Angle) * m_fRadius - cosf(Angle) * nCntV * m_fLineweight
-			);
-
-			// _J[̐ݒ
-			float alpha;
-			alpha = fAlpha * (1.0f - nCntV);
-			pVtx[nCnt].col = D3DXCOLOR(m_col.r,m_col.g,m_col.b, alpha);
-
-			nCnt++;
-		}
-	}
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-}
-//=============================================================================
-// `揈
-//=============================================================================
-void CMeshCylinder::Draw(void)
-{
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// JOݒ𖳌
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
-
-	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // Cg𖳌ɂ
-
-	// ufBOZɐݒ
-	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
-	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
-	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE);
-
-	// eXgL
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);//ftHgfalse
-	pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
-	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);//0傫`
-
-	// vZp}gbNX
-	D3DXMATRIX mtxRot, mtxTrans;
-
-	// [h}gbNX̏
-	D3DXMatrixIdentity(&m_mtxWorld);
-
-	// 𔽉f
-	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
-
-	// ʒu𔽉f
-	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
-
-	// [h}gbNXݒ
-	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
-
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
-
-	// CfbNXobt@f[^Xg[ɐݒ
-	pDevice->SetIndices(m_pIdxBuff);
-
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_3D);
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, nullptr);
-
-	// |S̕`
-	pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, 0, 0, MESHCYLINDER_VERTEX, 0, MESHCYLINDER_PRIMITIVE);
-
-	// eXg𖳌ɖ߂
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);//ftHgfalse
-
-	// JOݒL
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
-
-	// eXg𖳌ɖ߂
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);//ftHgfalse
-
-	// ufBOɖ߂
-	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
-	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
-	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
-
-	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // CgLɂ
-}
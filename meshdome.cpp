@@ -1,41 +1,41 @@
 //=============================================================================
 //
-// bVh[ [meshdome.cpp]
+// メッシュドーム処理 [meshdome.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "meshdome.h"
 #include "manager.h"
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMeshDome::CMeshDome(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_nIdxTexture = 0;
+	// 値のクリア
+	m_nIdxTexture = -1;
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMeshDome::~CMeshDome()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CMeshDome* CMeshDome::Create(D3DXVECTOR3 pos, int nRadius)
 {
-	// CX^X
+	// インスタンス生成
 	CMeshDome* pDome = new CMeshDome;
 
-	// nullptr
+	// nullptrだったら
 	if (pDome == nullptr)
 	{
 		return nullptr;
@@ -44,7 +44,7 @@ CMeshDome* CMeshDome::Create(D3DXVECTOR3 pos, int nRadius)
 	pDome->m_pos = pos;
 	pDome->m_nRadius = nRadius;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pDome->Init()))
 	{
 		return nullptr;
@@ -53,17 +53,17 @@ CMeshDome* CMeshDome::Create(D3DXVECTOR3 pos, int nRadius)
 	return nullptr;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CMeshDome::Init(void)
 {
-	// eNX`̓o^
+	// テクスチャの登録
 	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/sky.jpg");
 
-	// foCX̃|C^
+	// デバイスのポインタ
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// _obt@̐
+	// 頂点バッファの生成
 	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * MESHDOME_VERTEX,
 		D3DUSAGE_WRITEONLY,
 		FVF_VERTEX_3D,
@@ -71,7 +71,7 @@ HRESULT CMeshDome::Init(void)
 		&m_pVtxBuff,
 		NULL);
 
-	// CfbNXobt@̐
+	// インデックスバッファの生成
 	pDevice->CreateIndexBuffer(sizeof(WORD) * MESHDOME_INDEX,
 		D3DUSAGE_WRITEONLY,
 		D3DFMT_INDEX16,
@@ -79,78 +79,78 @@ HRESULT CMeshDome::Init(void)
 		&m_pIdxBuff,
 		NULL);
 
-	// _obt@̃|C^
+	// 頂点バッファのポインタ
 	VERTEX_3D* pVtx = nullptr;
 
-	// _obt@bN
+	// 頂点バッファをロック
 	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
 
 	for (int nCntV = 0; nCntV <= MESHDOME_Z; nCntV++)
 	{
 		for (int nCntH = 0; nCntH <= MESHDOME_X; nCntH++)
 		{
-			// nCntHԖڂ̊pxvZ
+			// nCntH番目の角度を計算
 			float angleH = (360.0f / MESHDOME_X) * nCntH;
 
-			// nCntVԖڂ̊pxvZ
+			// nCntV番目の角度を計算
 			float angleV = 90.0f * ((float)nCntV / MESHDOME_Z);
 
-			// _̈ʒuݒ
+			// 頂点の位置を設定
 			pVtx[nCntV * (MESHDOME_X + 1) + nCntH].pos = D3DXVECTOR3(
-				sinf(D3DXToRadian(angleH)) * m_nRadius * cosf(D3DXToRadian(angleV)), // XW
-				m_nRadius * sinf(D3DXToRadian(angleV)),								 // YW
-				cosf(D3DXToRadian(angleH)) * m_nRadius * cosf(D3DXToRadian(angleV))  // ZW
+				sinf(D3DXToRadian(angleH)) * m_nRadius * cosf(D3DXToRadian(angleV)), // X座標
+				m_nRadius * sinf(D3DXToRadian(angleV)),								 // Y座標
+				cosf(D3DXToRadian(angleH)) * m_nRadius * cosf(D3DXToRadian(angleV))  // Z座標
 			);
 
-			// @vZ (_W̒PʃxNg)
+			// 法線を計算 (頂点座標からの単位ベクトル)
 			D3DXVECTOR3 normal = D3DXVECTOR3(
 				pVtx[nCntV * (MESHDOME_X + 1) + nCntH].pos.x / m_nRadius,
 				pVtx[nCntV * (MESHDOME_X + 1) + nCntH].pos.y / m_nRadius,
 				pVtx[nCntV * (MESHDOME_X + 1) + nCntH].pos.z / m_nRadius
 			);
 
-			// K
+			// 正規化する
 			D3DXVec3Normalize(&normal, &normal);
 
-			// @Ɋ蓖
+			// 法線に割り当て
 			pVtx[nCntV * (MESHDOME_X + 1) + nCntH].nor = normal;
 
-			// _J[ݒ
+			// 頂点カラーを設定
 			pVtx[nCntV * (MESHDOME_X + 1) + nCntH].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 
-			// eNX`Wݒ
+			// テクスチャ座標を設定
 			pVtx[nCntV * (MESHDOME_X + 1) + nCntH].tex = D3DXVECTOR2(
-				(float)nCntH / MESHDOME_X,						// UWi~j
-				1.0f - (float)nCntV / MESHDOME_Z				// VWij
+				(float)nCntH / MESHDOME_X,						// U座標（円周方向）
+				1.0f - (float)nCntV / MESHDOME_Z				// V座標（高さ方向）
 			);
 		}
 	}
 
-	// _obt@AbN
+	// 頂点バッファをアンロック
 	m_pVtxBuff->Unlock();
 
-	// CfbNXobt@̃|C^
+	// インデックスバッファのポインタ
 	WORD* pIdx = nullptr;
 
-	// CfbNXobt@bN
+	// インデックスバッファをロック
 	m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0);
 
-	// CfbNX̐ݒ
+	// インデックスの設定
 	WORD idx = 0;
 
 	for (int nCntV = 0; nCntV < MESHDOME_Z; nCntV++)
 	{
 		for (int nCntX = 0; nCntX < MESHDOME_X; nCntX++)
 		{
-			// ̃CfbNX
+			// 基準のインデックス
 			WORD baseIndex = nCntV * (MESHDOME_X + 1) + nCntX;
 
-			// Op`1
+			// 三角形1
 			pIdx[idx++] = baseIndex;
 			pIdx[idx++] = baseIndex + MESHDOME_X + 1;
 			pIdx[idx++] = baseIndex + 1;
 
-			// Op`2
+			// 三角形2
 			pIdx[idx++] = baseIndex + 1;
 			pIdx[idx++] = baseIndex + MESHDOME_X + 1;
 			pIdx[idx++] = baseIndex + MESHDOME_X + 2;
@@ -158,79 +158,83 @@ HRESULT CMeshDome::Init(void)
 
 	}
 
-	// CfbNXobt@AbN
+	// インデックスバッファをアンロック
 	m_pIdxBuff->Unlock();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CMeshDome::Uninit(void)
 {
-	// CfbNXobt@̉
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
+
+	// インデックスバッファの解放
 	if (m_pIdxBuff != nullptr)
 	{
 		m_pIdxBuff->Release();
 		m_pIdxBuff = nullptr;
 	}
 
-	// _obt@̔j
+	// 頂点バッファの破棄
 	if (m_pVtxBuff != nullptr)
 	{
 		m_pVtxBuff->Release();
 		m_pVtxBuff = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CMeshDome::Update(void)
 {
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CMeshDome::Draw(void)
 {
-	// eNX`̎擾
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// vZp}gbNX
+	// 計算用マトリックス
 	D3DXMATRIX mtxRot, mtxTrans;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNXݒ
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// _obt@f[^Xg[ɐݒ
+	// 頂点バッファをデータストリームに設定
 	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
 
-	// CfbNXobt@f[^Xg[ɐݒ
+	// インデックスバッファをデータストリームに設定
 	pDevice->SetIndices(m_pIdxBuff);
 
-	// _tH[}bg̐ݒ
+	// 頂点フォーマットの設定
 	pDevice->SetFVF(FVF_VERTEX_3D);
 
-	// eNX`̐ݒ
+	// テクスチャの設定
 	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
 
-	// |S̕`
+	// ポリゴンの描画
 	pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, MESHDOME_VERTEX, 0, MESHDOME_INDEX);
 }
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// bVh[ [meshdome.h]
+// メッシュドーム処理 [meshdome.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,13 +8,13 @@
 #define _MESHDOME_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 
 //*****************************************************************************
-// bVh[NX
+// メッシュドームクラス
 //*****************************************************************************
 class CMeshDome : public CObject
 {
@@ -31,20 +31,20 @@ public:
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
 
 private:
-	static constexpr int MESHDOME_X			= 18;														// XubN
-	static constexpr int MESHDOME_Z			= 18;														// ZubN
-	static constexpr int MESHDOME_VERTEX	= (MESHDOME_X + 1) * (MESHDOME_Z + 1);						// _
-	static constexpr int MESHDOME_INDEX		= MESHDOME_X * MESHDOME_Z * 6;								// CfbNX
-	static constexpr int MESHDOME_PRIMITIVE = (MESHDOME_X * MESHDOME_Z * 2) + ((MESHDOME_Z - 1) * 2);	// |S
-
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@ւ̃|C^
-	LPDIRECT3DINDEXBUFFER9	m_pIdxBuff;		// CfbNXobt@ւ̃|C^
-	D3DXMATRIX				m_mtxWorld;		// [h}gbNX
-	D3DXVECTOR3				m_pos;			// ʒu
-	D3DXVECTOR3				m_rot;			// 
-	D3DXCOLOR				m_col;			// F
-	int						m_nRadius;		// a
-	int						m_nIdxTexture;	// eNX`CfbNX
+	static constexpr int MESHDOME_X			= 18;														// Xブロック数
+	static constexpr int MESHDOME_Z			= 18;														// Zブロック数
+	static constexpr int MESHDOME_VERTEX	= (MESHDOME_X + 1) * (MESHDOME_Z + 1);						// 頂点数
+	static constexpr int MESHDOME_INDEX		= MESHDOME_X * MESHDOME_Z * 6;								// インデックス数
+	static constexpr int MESHDOME_PRIMITIVE = (MESHDOME_X * MESHDOME_Z * 2) + ((MESHDOME_Z - 1) * 2);	// ポリゴン数
+
+	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// 頂点バッファへのポインタ
+	LPDIRECT3DINDEXBUFFER9	m_pIdxBuff;		// インデックスバッファへのポインタ
+	D3DXMATRIX				m_mtxWorld;		// ワールドマトリックス
+	D3DXVECTOR3				m_pos;			// 位置
+	D3DXVECTOR3				m_rot;			// 向き
+	D3DXCOLOR				m_col;			// 色
+	int						m_nRadius;		// 半径
+	int						m_nIdxTexture;	// テクスチャインデックス
 };
 
 #endif
@@ -1,65 +1,70 @@
 //=============================================================================
 //
-// bVtB[h [ meshfield.cpp ]
+// メッシュフィールド処理 [ meshfield.cpp ]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "meshfield.h"
 #include "manager.h"
 #include "texture.h"
 #include "algorithm"
+#include "culling.h"
+#include "random.h"
+#include "light.h"
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMeshField::CMeshField(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_pIdx			= nullptr;		// CfbNXobt@
-	m_pVtx			= nullptr;		// _obt@
-	m_pos			= INIT_VEC3;	// ʒu
-	m_rot			= INIT_VEC3;	// 
-	m_mtxWorld		= {};			// [h}gbNX
-	m_MeshFiled		= {};			// \̕ϐ
-	m_riverDir		= RIVER_X;		// ̕
+	// 値のクリア
+	m_pos			= INIT_VEC3;	// 位置
+	m_rot			= INIT_VEC3;	// 向き
+	m_mtxWorld		= {};			// ワールドマトリックス
+	m_MeshFiled		= {};			// 構造体変数
+	m_MeshFiled.nTexIdx = -1;		// テクスチャインデックス
+	m_riverDir		= RIVER_X;		// 川の方向
 	m_riverCenter	= 0.0f;			// X or Z
-	m_riverWidth	= 0.0f;			// a
-	m_riverDepth	= 0.0f;			// [
+	m_riverWidth	= 0.0f;			// 半径
+	m_riverDepth	= 0.0f;			// 深さ
+	m_nNumChunkX	= 0;			// 区画数X
+	m_nNumChunkZ	= 0;			// 区画数Z
+	m_nNumDrawChunk	= 0;			// 前回描画した区画数
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMeshField::~CMeshField()
 {
-	// 
+	// 無し
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CMeshField* CMeshField::Create(D3DXVECTOR3 pos, float fRadiusX, float fRadiusZ, int nNumX, int nNumZ)
 {
-	// CX^X
+	// インスタンス生成
 	CMeshField* pMeshField = new CMeshField;
 
-	// nullptr
+	// nullptrだったら
 	if (pMeshField == nullptr)
 	{
 		return nullptr;
 	}
 
-	// IuWFNgݒ
+	// オブジェクト設定
 	pMeshField->m_pos = pos;
 	pMeshField->m_MeshFiled.fRadiusX = fRadiusX;
 	pMeshField->m_MeshFiled.fRadiusZ = fRadiusZ;
 	pMeshField->m_MeshFiled.nNumX = nNumX;
 	pMeshField->m_MeshFiled.nNumZ = nNumZ;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pMeshField->Init()))
 	{
 		return nullptr;
@@ -68,312 +73,385 @@ CMeshField* CMeshField::Create(D3DXVECTOR3 pos, float fRadiusX, float fRadiusZ,
 	return pMeshField;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CMeshField::Init(void)
 {
-	// foCX̃|C^
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`|C^擾
+	// テクスチャポインタ取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// eNX`蓖
+	// テクスチャ割り当て
 	m_MeshFiled.nTexIdx = pTexture->RegisterDynamic("data/TEXTURE/field100.jpg");
 
-	// _vZ
-	m_MeshFiled.nNumAllVtx = ((m_MeshFiled.nNumX + 1) * (m_MeshFiled.nNumZ + 1)); // _
-	m_MeshFiled.nNumPrimitive = (((m_MeshFiled.nNumX * m_MeshFiled.nNumZ) * 2)) + (4 * (m_MeshFiled.nNumZ - 1)); // |S
-	m_MeshFiled.nNumIdx = m_MeshFiled.nNumPrimitive + 2; // CfbNX
+	// 川はマップと同じ系列から決める(シード値で同じ形になる)
+	CRandom& random = CRandom::Get(CRandom::STREAM_MAP);
 
-	// ̌Eݐp[^
-	m_riverDir = (rand() % 2 == 0) ? RIVER_X : RIVER_Z;// ̕
+	// 川の窪み生成パラメータ
+	m_riverDir = (random.Int(2) == 0) ? RIVER_X : RIVER_Z;// 川の方向
 
 	float fieldRadius =
 		(m_riverDir == RIVER_X)
 		? m_MeshFiled.fRadiusZ
 		: m_MeshFiled.fRadiusX;
 
-	m_riverCenter = ((rand() / (float)RAND_MAX) - 0.5f) * fieldRadius * 0.6f;// ̒S
-	m_riverWidth = RIVER_WIDTH;// ̕
-	m_riverDepth = RIVER_DEPTH;// ̐[
+	m_riverCenter = (random.Float() - 0.5f) * fieldRadius * 0.6f;// 川の中心
+	m_riverWidth = RIVER_WIDTH;// 川の幅
+	m_riverDepth = RIVER_DEPTH;// 川の深さ
 
-	// ֍sC̐
+	// 蛇行ラインの生成
 	CreateRiverLine();
 
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * m_MeshFiled.nNumAllVtx,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_3D,
-		D3DPOOL_MANAGED,
-		&m_pVtx,
-		NULL);
-
-	// CfbNXobt@̐
-	pDevice->CreateIndexBuffer(sizeof(WORD) * m_MeshFiled.nNumIdx,
-		D3DUSAGE_WRITEONLY,
-		D3DFMT_INDEX16,
-		D3DPOOL_MANAGED,
-		&m_pIdx,
-		NULL);
-
-	// ϐ̏
+	// 変数の初期化
 	m_rot = INIT_VEC3;
 
-	// _̃|C^錾
-	VERTEX_3D* pVtx = nullptr;
+	// 区画の生成(川の窪みも含めて頂点はここで一度だけ作る)
+	if (FAILED(CreateChunks()))
+	{
+		return E_FAIL;
+	}
 
-	//_obt@bN
-	m_pVtx->Lock(0, 0, (void**)&pVtx, 0);
+	return S_OK;
+}
+//=============================================================================
+// 区画の生成処理
+//=============================================================================
+HRESULT CMeshField::CreateChunks(void)
+{
+	// 描画デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	// eNX`WvZϐ
-	float fTexX = 1.0f / m_MeshFiled.nNumX;
-	float fTexY = 1.0f / m_MeshFiled.nNumZ;
-	int nCnt = 0;
+	const int nChunkCells = CTerrainLod::CHUNK_CELLS;
 
-	D3DXVECTOR3 MathPos = m_pos;
+	m_nNumChunkX = (m_MeshFiled.nNumX + nChunkCells - 1) / nChunkCells;
+	m_nNumChunkZ = (m_MeshFiled.nNumZ + nChunkCells - 1) / nChunkCells;
+	m_MeshFiled.nNumAllVtx = 0;
 
-	// c
-	for (int nCntZ = 0; nCntZ <= m_MeshFiled.nNumZ; nCntZ++)
+	m_chunks.reserve(m_nNumChunkX * m_nNumChunkZ);
+
+	for (int nChunkZ = 0; nChunkZ < m_nNumChunkZ; nChunkZ++)
 	{
-		// 
-		for (int nCntX = 0; nCntX <= m_MeshFiled.nNumX; nCntX++)
+		for (int nChunkX = 0; nChunkX < m_nNumChunkX; nChunkX++)
 		{
-			// _WvZ
-			MathPos.x = ((m_MeshFiled.fRadiusX / m_MeshFiled.nNumX) * nCntX) - (m_MeshFiled.fRadiusX * 0.5f);
-			MathPos.y = m_pos.y;
-			MathPos.z = m_MeshFiled.fRadiusZ - ((m_MeshFiled.fRadiusZ / m_MeshFiled.nNumZ) * nCntZ) - (m_MeshFiled.fRadiusZ * 0.5f);
-
-			// _W̐ݒ
-			pVtx[nCnt].pos = MathPos;
-
-			// @xNg̐ݒ
-			pVtx[nCnt].nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
-
-			// _J[̐ݒ
-			pVtx[nCnt].col = INIT_XCOL_WHITE;
-
-			// eNX`W̐ݒ
-			pVtx[nCnt].tex = D3DXVECTOR2(fTexX * nCntX, nCntZ * fTexY);
+			Chunk chunk = {};
+			chunk.nStartX = nChunkX * nChunkCells;
+			chunk.nStartZ = nChunkZ * nChunkCells;
+			chunk.nCellX = std::min(nChunkCells, m_MeshFiled.nNumX - chunk.nStartX);
+			chunk.nCellZ = std::min(nChunkCells, m_MeshFiled.nNumZ - chunk.nStartZ);
+			chunk.nMaxLod = CTerrainLod::CalcMaxLod(chunk.nCellX, chunk.nCellZ);
+
+			int nNumVtx = (chunk.nCellX + 1) * (chunk.nCellZ + 1);
+
+			// 頂点バッファの生成
+			if (FAILED(pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * nNumVtx,
+				D3DUSAGE_WRITEONLY,
+				FVF_VERTEX_3D,
+				D3DPOOL_MANAGED,
+				&chunk.pVtx,
+				NULL)))
+			{
+				return E_FAIL;
+			}
 
-			// Z
-			nCnt++;
-		}
-	}
+			// 頂点情報のポインタを宣言
+			VERTEX_3D* pVtx = nullptr;
 
-	// AbN
-	m_pVtx->Unlock();
+			//頂点バッファをロック
+			pDevice->LockVertexBuffer(chunk.pVtx, 0, 0, (void**)&pVtx, 0);
 
-	// CfbNXobt@̃|C^
-	WORD* pIdx;
+			// 頂点の設定
+			SetChunkVertex(chunk, pVtx);
 
-	// CfbNXobt@̃bN
-	m_pIdx->Lock(0, 0, (void**)&pIdx, 0);
+			// アンロック
+			pDevice->UnlockVertexBuffer(chunk.pVtx);
 
-	WORD IndxNum = m_MeshFiled.nNumX + 1;// X
-	WORD IdxCnt = 0;// z
-	WORD Num = 0;
+			m_MeshFiled.nNumAllVtx += nNumVtx;
 
-	// CfbNX̐ݒ
-	for (int IndxCount1 = 0; IndxCount1 < m_MeshFiled.nNumZ; IndxCount1++)
-	{
-		for (int IndxCount2 = 0; IndxCount2 <= m_MeshFiled.nNumX; IndxCount2++, IndxNum++, Num++)
-		{
-			pIdx[IdxCnt] = IndxNum;
-			pIdx[IdxCnt + 1] = Num;
-			IdxCnt += 2;
-		}
-
-		// Ō̍sȂ
-		if (IndxCount1 < m_MeshFiled.nNumZ - 1)
-		{
-			pIdx[IdxCnt] = Num - 1;
-			pIdx[IdxCnt + 1] = IndxNum;
-			IdxCnt += 2;
+			m_chunks.push_back(chunk);
 		}
 	}
 
-	// CfbNXobt@̃AbN
-	m_pIdx->Unlock();
-
 	return S_OK;
 }
 //=============================================================================
-// I
+// 区画の頂点の設定処理
 //=============================================================================
-void CMeshField::Uninit(void)
+void CMeshField::SetChunkVertex(Chunk& chunk, VERTEX_3D* pVtx)
 {
-	// _obt@̔j
-	if (m_pVtx != nullptr)
-	{
-		m_pVtx->Release();
-		m_pVtx = nullptr;
-	}
-
-	// CfbNXobt@̔j
-	if (m_pIdx != nullptr)
-	{
-		m_pIdx->Release();
-		m_pIdx = nullptr;
-	}
-
-	// g̔j
-	this->Release();
-}
-//=============================================================================
-// XV
-//=============================================================================
-void CMeshField::Update(void)
-{
-	// _̃|C^錾
-	VERTEX_3D* pVtx = nullptr;
-
-	//_obt@bN
-	m_pVtx->Lock(0, 0, (void**)&pVtx, 0);
-
-	// eNX`WvZϐ
+	// テクスチャ座標を計算する変数(区画をまたいでも連続するように全体の番号で計算する)
 	float fTexX = UV_RATE_X / m_MeshFiled.nNumX;
 	float fTexY = UV_RATE_Y / m_MeshFiled.nNumZ;
 	int nCnt = 0;
 
+	D3DXVECTOR3 vMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	D3DXVECTOR3 vMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
 	D3DXVECTOR3 MathPos = m_pos;
 
-	//c
-	for (int nCntZ = 0; nCntZ <= m_MeshFiled.nNumZ; nCntZ++)
+	// 縦
+	for (int nZ = 0; nZ <= chunk.nCellZ; nZ++)
 	{
-		//
-		for (int nCntX = 0; nCntX <= m_MeshFiled.nNumX; nCntX++)
+		// 横
+		for (int nX = 0; nX <= chunk.nCellX; nX++)
 		{
-			// _WvZ
+			int nCntX = chunk.nStartX + nX;
+			int nCntZ = chunk.nStartZ + nZ;
+
+			// 頂点座標を計算
 			MathPos.x = ((m_MeshFiled.fRadiusX / m_MeshFiled.nNumX) * nCntX) - (m_MeshFiled.fRadiusX * 0.5f);
 			MathPos.y = m_pos.y;
 			MathPos.z = m_MeshFiled.fRadiusZ - ((m_MeshFiled.fRadiusZ / m_MeshFiled.nNumZ) * nCntZ) - (m_MeshFiled.fRadiusZ * 0.5f);
 
-			// 󂾂΂
-			if (m_riverLine.empty())
-			{
-				return;
-			}
-
-			// --- ̂ڂ݌vZ ---
-			float dist = 0.0f;
-
-			if (m_riverDir == RIVER_X)
-			{
-				// XɗieXƂZSj
-				float centerZ = m_riverLine[nCntX];
-				dist = fabsf(MathPos.z - centerZ);
-			}
-			else // RIVER_Z
+			// --- 川のくぼみ計算 ---
+			if (!m_riverLine.empty())
 			{
-				// ZɗieZƂXSj
-				float centerX = m_riverLine[nCntZ];
-				dist = fabsf(MathPos.x - centerX);
+				float dist = 0.0f;
+
+				if (m_riverDir == RIVER_X)
+				{
+					// X方向に流れる川（各XごとにZ中心がある）
+					float centerZ = m_riverLine[nCntX];
+					dist = fabsf(MathPos.z - centerZ);
+				}
+				else // RIVER_Z
+				{
+					// Z方向に流れる川（各ZごとにX中心がある）
+					float centerX = m_riverLine[nCntZ];
+					dist = fabsf(MathPos.x - centerX);
+				}
+
+				// 深さを取得して窪みを作る
+				float depth = GetRiverDepth(dist);
+				MathPos.y -= depth;
 			}
 
-			// [擾ČE݂
-			float depth = GetRiverDepth(dist);
-			MathPos.y -= depth;
-
-			// _W̐ݒ
+			// 頂点座標の設定
 			pVtx[nCnt].pos = MathPos;
 
-			// @xNg̐ݒ
+			// 法線ベクトルの設定
 			pVtx[nCnt].nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
 
-			// _J[̐ݒ
+			// 頂点カラーの設定
 			pVtx[nCnt].col = D3DXCOLOR(0.5f, 0.5f, 0.5f, 1.0f);
 
-			// eNX`W̐ݒ
+			// テクスチャ座標の設定
 			pVtx[nCnt].tex = D3DXVECTOR2(fTexX * nCntX, nCntZ * fTexY);
 
-			// Z
+			// AABBを広げる
+			D3DXVec3Minimize(&vMin, &vMin, &MathPos);
+			D3DXVec3Maximize(&vMax, &vMax, &MathPos);
+
+			// 加算
 			nCnt++;
 		}
 	}
 
-	// AbN
-	m_pVtx->Unlock();
+	// 描画時にワールドマトリックスで位置をずらす分も含める
+	chunk.vMin = vMin + m_pos;
+	chunk.vMax = vMax + m_pos;
+}
+//=============================================================================
+// インデックスバッファの取得処理(無ければ生成する)
+//=============================================================================
+const CMeshField::LodIndex* CMeshField::GetLodIndex(const Chunk& chunk, const int anEdgeStep[CTerrainLod::EDGE_MAX])
+{
+	unsigned long long key = CTerrainLod::MakeKey(chunk.nCellX, chunk.nCellZ, chunk.nLod, anEdgeStep);
+	auto it = m_lodIndex.find(key);
+
+	if (it != m_lodIndex.end())
+	{
+		return &it->second;
+	}
+
+	// インデックスの生成
+	std::vector<WORD> indices;
+	int nNumPrimitive = CTerrainLod::BuildIndices(chunk.nCellX, chunk.nCellZ, chunk.nLod, anEdgeStep, &indices);
 
-	// CfbNXobt@̃|C^
-	WORD* pIdx;
+	LodIndex lodIndex = {};
 
-	// CfbNXobt@̃bN
-	m_pIdx->Lock(0, 0, (void**)&pIdx, 0);
+	// 描画デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	WORD IndxNum = m_MeshFiled.nNumX + 1;// X
+	// インデックスバッファの生成
+	if (nNumPrimitive <= 0 || FAILED(pDevice->CreateIndexBuffer(sizeof(WORD) * (UINT)indices.size(),
+		D3DUSAGE_WRITEONLY,
+		D3DFMT_INDEX16,
+		D3DPOOL_MANAGED,
+		&lodIndex.pIdx,
+		NULL)))
+	{
+		return nullptr;
+	}
+
+	// インデックスバッファのポインタ
+	WORD* pIdx = nullptr;
+
+	// インデックスバッファのロック
+	pDevice->LockIndexBuffer(lodIndex.pIdx, 0, 0, (void**)&pIdx, 0);
 
-	WORD IdxCnt = 0;// z
+	memcpy(pIdx, indices.data(), sizeof(WORD) * indices.size());
+
+	// インデックスバッファのアンロック
+	pDevice->UnlockIndexBuffer(lodIndex.pIdx);
+
+	lodIndex.nNumPrimitive = nNumPrimitive;
+
+	return &(m_lodIndex[key] = lodIndex);
+}
+//=============================================================================
+// 隣の区画のLODの取得処理(範囲外なら既定値を返す)
+//=============================================================================
+int CMeshField::GetChunkLod(int nChunkX, int nChunkZ, int nDefault) const
+{
+	if (nChunkX < 0 || nChunkX >= m_nNumChunkX || nChunkZ < 0 || nChunkZ >= m_nNumChunkZ)
+	{
+		return nDefault;
+	}
 
-	WORD Num = 0;
+	return m_chunks[nChunkZ * m_nNumChunkX + nChunkX].nLod;
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CMeshField::Uninit(void)
+{
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_MeshFiled.nTexIdx);
+	m_MeshFiled.nTexIdx = -1;
 
-	// CfbNX̐ݒ
-	for (int IndxCount1 = 0; IndxCount1 < m_MeshFiled.nNumZ; IndxCount1++)
+	// 区画の頂点バッファの破棄
+	for (auto& chunk : m_chunks)
 	{
-		for (int IndxCount2 = 0; IndxCount2 <= m_MeshFiled.nNumX; IndxCount2++, IndxNum++, Num++)
+		if (chunk.pVtx != nullptr)
 		{
-			pIdx[IdxCnt] = IndxNum;
-			pIdx[IdxCnt + 1] = Num;
-			IdxCnt += 2;
+			chunk.pVtx->Release();
+			chunk.pVtx = nullptr;
 		}
+	}
 
-		// Ō̍sȂ
-		if (IndxCount1 < m_MeshFiled.nNumZ - 1)
+	m_chunks.clear();
+
+	// インデックスバッファの破棄
+	for (auto& pair : m_lodIndex)
+	{
+		if (pair.second.pIdx != nullptr)
 		{
-			pIdx[IdxCnt] = Num - 1;
-			pIdx[IdxCnt + 1] = IndxNum;
-			IdxCnt += 2;
+			pair.second.pIdx->Release();
+			pair.second.pIdx = nullptr;
 		}
 	}
 
-	// CfbNXobt@̃AbN
-	m_pIdx->Unlock();
+	m_lodIndex.clear();
+
+	// 自身の破棄
+	this->Release();
 }
 //=============================================================================
-// `揈
+// 更新処理
+//=============================================================================
+void CMeshField::Update(void)
+{
+	// 地形は生成後に変わらないので頂点は作り直さない
+}
+//=============================================================================
+// 描画処理
 //=============================================================================
 void CMeshField::Draw(void)
 {
-	// foCX̃|C^
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	// デバイスのポインタ
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	// eNX`̎擾
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// vZp̃}gbNX錾
+	// 視点の位置
+	D3DXVECTOR3 posV = CManager::GetCamera()->GetPosV();
+
+	// 先に全区画のLODを決める(継ぎ目の処理で画面外の隣も参照するため)
+	for (auto& chunk : m_chunks)
+	{
+		// 視点に一番近い点までの距離
+		D3DXVECTOR3 closest(std::max(chunk.vMin.x, std::min(posV.x, chunk.vMax.x)),
+			std::max(chunk.vMin.y, std::min(posV.y, chunk.vMax.y)),
+			std::max(chunk.vMin.z, std::min(posV.z, chunk.vMax.z)));
+
+		D3DXVECTOR3 diff = closest - posV;
+
+		chunk.nLod = CTerrainLod::SelectLod(D3DXVec3Length(&diff), chunk.nMaxLod);
+	}
+
+	// 計算用のマトリックスを宣言
 	D3DXMATRIX mtxRot, mtxTrans;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNX̐ݒ
+	// ワールドマトリックスの設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// _obt@foCX̃f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtx, 0, sizeof(VERTEX_3D));
-
-	// CfbNXobt@f[^Xg[ɐݒ
-	pDevice->SetIndices(m_pIdx);
-
-	// eNX`tH[}bg̐ݒ
+	// テクスチャフォーマットの設定
 	pDevice->SetFVF(FVF_VERTEX_3D);
 
-	// eNX`蓖
+	// テクスチャ割り当て
 	pDevice->SetTexture(0, pTexture->GetAddress(m_MeshFiled.nTexIdx));
 
-	// |S̕`
-	pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, 0, 0, m_MeshFiled.nNumAllVtx, 0, m_MeshFiled.nNumPrimitive);
+	m_nNumDrawChunk = 0;
+
+	for (int nChunkZ = 0; nChunkZ < m_nNumChunkZ; nChunkZ++)
+	{
+		for (int nChunkX = 0; nChunkX < m_nNumChunkX; nChunkX++)
+		{
+			const Chunk& chunk = m_chunks[nChunkZ * m_nNumChunkX + nChunkX];
+
+			// 画面外の区画は描画しない
+			if (!CCulling::IsVisibleAABB(chunk.vMin, chunk.vMax, CCulling::TYPE_TERRAIN))
+			{
+				continue;
+			}
+
+			// 隣の方が粗い辺は隣の頂点間隔に合わせる
+			int anEdgeStep[CTerrainLod::EDGE_MAX];
+			anEdgeStep[CTerrainLod::EDGE_LEFT]		= CTerrainLod::CalcEdgeStep(chunk.nLod, GetChunkLod(nChunkX - 1, nChunkZ, chunk.nLod));
+			anEdgeStep[CTerrainLod::EDGE_RIGHT]		= CTerrainLod::CalcEdgeStep(chunk.nLod, GetChunkLod(nChunkX + 1, nChunkZ, chunk.nLod));
+			anEdgeStep[CTerrainLod::EDGE_TOP]		= CTerrainLod::CalcEdgeStep(chunk.nLod, GetChunkLod(nChunkX, nChunkZ - 1, chunk.nLod));
+			anEdgeStep[CTerrainLod::EDGE_BOTTOM]	= CTerrainLod::CalcEdgeStep(chunk.nLod, GetChunkLod(nChunkX, nChunkZ + 1, chunk.nLod));
+
+			const LodIndex* pLodIndex = GetLodIndex(chunk, anEdgeStep);
+
+			if (pLodIndex == nullptr)
+			{
+				continue;
+			}
+
+			// 区画を包む球に届くライトを選ぶ
+			D3DXVECTOR3 extent = (chunk.vMax - chunk.vMin) * 0.5f;
+			CLight::Apply((chunk.vMax + chunk.vMin) * 0.5f, D3DXVec3Length(&extent));
+
+			// 頂点バッファをデバイスのデータストリームに設定
+			pDevice->SetStreamSource(0, chunk.pVtx, 0, sizeof(VERTEX_3D));
+
+			// インデックスバッファをデータストリームに設定
+			pDevice->SetIndices(pLodIndex->pIdx);
+
+			// ポリゴンの描画
+			pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, (chunk.nCellX + 1) * (chunk.nCellZ + 1), 0, pLodIndex->nNumPrimitive);
+
+			m_nNumDrawChunk++;
+		}
+	}
+
+	// 注視点の周りのライトに戻す
+	CLight::RestoreView();
 }
 //=============================================================================
-// ̐[̎擾
+// 川の深さの取得
 //=============================================================================
 float CMeshField::GetRiverDepth(float dist) const
 {
@@ -382,16 +460,18 @@ float CMeshField::GetRiverDepth(float dist) const
 		return 0.0f;
 	}
 
-	float t = dist / m_riverWidth; // 0`1
+	float t = dist / m_riverWidth; // 0～1
 
-	// Ȃ߂炩ȃJ[uij
+	// なめらかなカーブ（放物線）
 	return (1.0f - t * t) * m_riverDepth;
 }
 //=============================================================================
-// ֍sC
+// 蛇行ライン生成処理
 //=============================================================================
 void CMeshField::CreateRiverLine(void)
 {
+	CRandom& random = CRandom::Get(CRandom::STREAM_MAP);
+
 	if (m_riverDir == RIVER_Z)
 	{
 		m_riverLine.resize(m_MeshFiled.nNumZ + 1);
@@ -402,26 +482,26 @@ void CMeshField::CreateRiverLine(void)
 		float safeSideX = EXIT_HALF_WIDTH + m_riverWidth * 0.5f;
 		safeSideX = std::min(safeSideX, maxOffset);
 
-		float sideSign = (rand() % 2 == 0) ? -1.0f : 1.0f;
+		float sideSign = (random.Int(2) == 0) ? -1.0f : 1.0f;
 		float sideX = safeSideX * sideSign;
 
 		for (int z = 0; z <= m_MeshFiled.nNumZ; z++)
 		{
-			// oʂǂ
+			// 出口正面かどうか
 			if (z <= m_MeshFiled.nNumZ)
 			{
-				float t = (float)z / m_MeshFiled.nNumZ;					// 0:o / 1:O
+				float t = (float)z / m_MeshFiled.nNumZ;					// 0:出口 / 1:少し手前
 				t = std::clamp(t, 0.0f, 1.0f);
 
 				float noise =
-					((rand() / (float)RAND_MAX) - 0.5f) * 20.0f * t;	// hXɌ炷
+					(random.Float() - 0.5f) * 20.0f * t;	// 揺れを徐々に減らす
 
-				// oʂ牡ɂ炷
+				// 出口正面から横にずらす
 				m_riverLine[z] = sideX + noise;
 				continue;
 			}
 
-			float delta = ((rand() / (float)RAND_MAX) - 0.5f) * 20.0f;
+			float delta = (random.Float() - 0.5f) * 20.0f;
 			center += delta;
 			center = std::clamp(center, -maxOffset, maxOffset);
 
@@ -437,7 +517,7 @@ void CMeshField::CreateRiverLine(void)
 
 		for (int x = 0; x <= m_MeshFiled.nNumX; x++)
 		{
-			float delta = ((rand() / (float)RAND_MAX) - 0.5f) * 20.0f;
+			float delta = (random.Float() - 0.5f) * 20.0f;
 			center += delta;
 			center = std::clamp(center, -maxOffset, maxOffset);
 
@@ -445,7 +525,7 @@ void CMeshField::CreateRiverLine(void)
 		}
 	}
 
-	// (܂𖳂)
+	// 平滑化(折れ線感を無くす)
 	for (int nCnt = 1; nCnt < (int)m_riverLine.size() - 1; nCnt++)
 	{
 		m_riverLine[nCnt] =
@@ -453,11 +533,11 @@ void CMeshField::CreateRiverLine(void)
 	}
 }
 //=============================================================================
-// 씻֐
+// 川判定関数
 //=============================================================================
 bool CMeshField::IsRiverArea(float x, float z) const
 {
-	// 색C̏ꍇ
+	// 川ラインが空の場合
 	if (m_riverLine.empty())
 	{
 		return false;
@@ -467,7 +547,7 @@ bool CMeshField::IsRiverArea(float x, float z) const
 	return GetRiverDepth(dist) > 0.01f;
 }
 //=============================================================================
-// ZPʐ씻֐
+// セル単位川判定関数
 //=============================================================================
 bool CMeshField::IsRiverCell(float cx, float cz, float size)
 {
@@ -480,11 +560,11 @@ bool CMeshField::IsRiverCell(float cx, float cz, float size)
 		IsRiverArea(cx + h, cz + h);
 }
 //=============================================================================
-// ̋vZ֐
+// 川の距離を計算する関数
 //=============================================================================
 float CMeshField::GetRiverDistance(float worldX, float worldZ) const
 {
-	// 󂾂FLT_MAX(l)Ԃ
+	// 空だったらFLT_MAX(無効値)を返す
 	if (m_riverLine.empty())
 	{
 		return FLT_MAX;
@@ -493,59 +573,59 @@ float CMeshField::GetRiverDistance(float worldX, float worldZ) const
 	float localX = worldX - m_pos.x;
 	float localZ = worldZ - m_pos.z;
 
-	// X̐̏ꍇ
+	// X方向の川の場合
 	if (m_riverDir == RIVER_X)
 	{
-		// ZW0`1̊ɕϊ
+		// Z座標を0～1の割合に変換
 		float zRate = (localZ + m_MeshFiled.fRadiusZ * 0.5f) / m_MeshFiled.fRadiusZ;
 
-		// 색Cz̃CfbNXɕϊ
+		// 川ライン配列のインデックスに変換
 		int idx = (int)(zRate * m_MeshFiled.nNumZ);
 
-		// ͈͊O`FbN
+		// 範囲外チェック
 		if (idx < 0 || idx >= (int)m_riverLine.size())
 		{
 			return FLT_MAX;
 		}
 
-		// Zʒuł̐̒S
+		// そのZ位置での川の中心線
 		float centerZ = m_riverLine[idx];
 
-		// 쒆S̋Ԃ
+		// 川中心線からの距離を返す
 		return fabsf(localZ - centerZ);
 	}
-	// Z̐̏ꍇ
+	// Z方向の川の場合
 	else
 	{
-		// XW 0`1 ̊ɕϊ
+		// X座標を 0～1 の割合に変換
 		float xRate = (localX + m_MeshFiled.fRadiusX * 0.5f) / m_MeshFiled.fRadiusX;
 
-		// 색Cz̃CfbNXɕϊ
+		// 川ライン配列のインデックスに変換
 		int idx = (int)(xRate * m_MeshFiled.nNumX);
 
-		// ͈͊O`FbN
+		// 範囲外チェック
 		if (idx < 0 || idx >= (int)m_riverLine.size())
 		{
 			return FLT_MAX;
 		}
 
-		// Xʒuł̐̒S
+		// そのX位置での川の中心線
 		float centerX = m_riverLine[idx];
 
-		// 쒆S̋
+		// 川中心線からの距離
 		return fabsf(localX - centerX);
 	}
 }
 //=============================================================================
-// 擾֐
+// 高さを取得する関数
 //=============================================================================
 float CMeshField::GetHeight(float worldX, float worldZ) const
 {
-	// [h  [J
+	// ワールド → ローカル
 	float localX = worldX - m_pos.x;
 	float localZ = worldZ - m_pos.z;
 
-	// bV͈͊O(x[X̍Ԃ)
+	// メッシュ範囲外(ベースの高さを返す)
 	if (localX < -m_MeshFiled.fRadiusX * 0.5f ||
 		localX >  m_MeshFiled.fRadiusX * 0.5f ||
 		localZ < -m_MeshFiled.fRadiusZ * 0.5f ||
@@ -554,30 +634,30 @@ float CMeshField::GetHeight(float worldX, float worldZ) const
 		return m_pos.y;
 	}
 
-	// ObhTCY
+	// グリッドサイズ
 	float cellX = m_MeshFiled.fRadiusX / m_MeshFiled.nNumX;
 	float cellZ = m_MeshFiled.fRadiusZ / m_MeshFiled.nNumZ;
 
-	// ObhW
+	// グリッド座標
 	float fx = (localX + m_MeshFiled.fRadiusX * 0.5f) / cellX;
 	float fz = (m_MeshFiled.fRadiusZ * 0.5f - localZ) / cellZ;
 
-	// ̐CfbNX
+	// 左上の整数インデックス
 	int ix = (int)fx;
 	int iz = (int)fz;
 
-	// ͈̓Nv
+	// 範囲クランプ
 	ix = std::max(0, std::min(ix, m_MeshFiled.nNumX - 1));
 	iz = std::max(0, std::min(iz, m_MeshFiled.nNumZ - 1));
 
-	// ԌW
+	// 補間係数
 	float tx = fx - ix;
 	float tz = fz - iz;
 
-	// 4_̍擾郉_֐
+	// 4頂点の高さ取得するラムダ関数
 	auto getVertexHeight = [&](int x, int z)
 	{
-		// _̃[JW
+		// 頂点のローカル座標
 		float vx =
 			((m_MeshFiled.fRadiusX / m_MeshFiled.nNumX) * x)
 			- (m_MeshFiled.fRadiusX * 0.5f);
@@ -587,32 +667,32 @@ float CMeshField::GetHeight(float worldX, float worldZ) const
 			- ((m_MeshFiled.fRadiusZ / m_MeshFiled.nNumZ) * z)
 			- (m_MeshFiled.fRadiusZ * 0.5f);
 
-		// 쒆S̋vZ
+		// 川中心からの距離を計算
 		float dist = 0.0f;
 		if (m_riverDir == RIVER_X)
 		{
-			// Xɗ(Zŋ)
+			// X方向に流れる川(Zで距離判定)
 			float centerZ = m_riverLine[x];
 			dist = fabsf(vz - centerZ);
 		}
 		else
 		{
-			// ZɗiXŋj
+			// Z方向に流れる川（Xで距離判定）
 			float centerX = m_riverLine[z];
 			dist = fabsf(vx - centerX);
 		}
 
-		// x[X - ̐[
+		// ベース高さ - 川の深さ
 		return m_pos.y - GetRiverDepth(dist);
 	};
 
-	// 4_̍擾
+	// 4頂点の高さを取得
 	float h00 = getVertexHeight(ix, iz);
 	float h10 = getVertexHeight(ix + 1, iz);
 	float h01 = getVertexHeight(ix, iz + 1);
 	float h11 = getVertexHeight(ix + 1, iz + 1);
 
-	// oCjAԂŊ炩ȍZo
+	// バイリニア補間で滑らかな高さを算出
 	float h0 = h00 + (h10 - h00) * tx;
 	float h1 = h01 + (h11 - h01) * tx;
 	float h = h0 + (h1 - h0) * tz;
@@ -620,16 +700,16 @@ float CMeshField::GetHeight(float worldX, float worldZ) const
 	return h;
 }
 //=============================================================================
-// ̗擾֐
+// 川の流れる方向を取得する関数
 //=============================================================================
 D3DXVECTOR3 CMeshField::GetRiverFlowDir(void) const
 {
 	switch (m_riverDir)
 	{
 	case RIVER_X:
-		return D3DXVECTOR3(1.0f, 0.0f, 0.0f); // +X ɗ
+		return D3DXVECTOR3(1.0f, 0.0f, 0.0f); // +X に流れる
 	case RIVER_Z:
-		return D3DXVECTOR3(0.0f, 0.0f, 1.0f); // +Z ɗ
+		return D3DXVECTOR3(0.0f, 0.0f, 1.0f); // +Z に流れる
 	default:
 		return D3DXVECTOR3(0.0f, 0.0f, 0.0f);
 	}
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// bVtB[h [ meshfield.h ]
+// メッシュフィールド処理 [ meshfield.h ]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,34 +8,34 @@
 #define _MESHFIELD_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
+#include "terrainlod.h"
+#include "unordered_map"
 
 //*****************************************************************************
-// bVtB[hNX
+// メッシュフィールドクラス
 //*****************************************************************************
 class CMeshField : public CObject
 {
 public:
 
 	//*************************************************************************
-	// \̐錾
+	// 構造体宣言
 	//*************************************************************************
 	struct MeshField
 	{
-		float	fRadiusX;		// X̔a
-		float	fRadiusZ;		// Z̔a
-		int		nNumPrimitive;	// v~eBu
-		int		nNumIdx;		// CfbNX
-		int		nNumAllVtx;		// S̒_
-		int		nNumX;			// X_
-		int		nNumZ;			// Z_
-		int		nTexIdx;		// eNX`CfbNX
+		float	fRadiusX;		// X方向の半径
+		float	fRadiusZ;		// Z方向の半径
+		int		nNumAllVtx;		// 全体頂点数
+		int		nNumX;			// X頂点
+		int		nNumZ;			// Z頂点
+		int		nTexIdx;		// テクスチャインデックス
 	};
 
 	//*************************************************************************
-	// ̕
+	// 川の方向
 	//*************************************************************************
 	enum RiverDir
 	{
@@ -54,47 +54,78 @@ public:
 	void CreateRiverLine(void);
 
 	//*************************************************************************
-	// flagment֐
+	// flagment関数
 	//*************************************************************************
 	bool IsRiverArea(float worldX, float worldZ) const;
 	bool IsRiverCell(float cx, float cz, float size);
 
 	//*************************************************************************
-	// setter֐
+	// setter関数
 	//*************************************************************************
 	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
 	void SetRaiusZ(float fRadius) { m_MeshFiled.fRadiusZ = fRadius; }
 	void SetRaiusX(float fRadius) { m_MeshFiled.fRadiusX = fRadius; }
 
 	//*************************************************************************
-	// getter֐
+	// getter関数
 	//*************************************************************************
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
 	float GetRadiusX(void) { return m_MeshFiled.fRadiusX; }
 	float GetRadiusZ(void) { return m_MeshFiled.fRadiusZ; }
+	int GetNumChunk(void) const { return (int)m_chunks.size(); }
+	int GetNumDrawChunk(void) const { return m_nNumDrawChunk; }
 	float GetRiverDepth(float dist) const;
 	float GetRiverDistance(float worldX, float worldZ) const;
 	float GetHeight(float worldX, float worldZ) const;
 	D3DXVECTOR3 GetRiverFlowDir(void) const;
 
 private:
-	static constexpr float EXIT_HALF_WIDTH	= 80.0f;	// on[t
-	static constexpr float RIVER_WIDTH		= 65.0f;	// ̕
-	static constexpr float RIVER_DEPTH		= 20.0f;	// ̐[
-	static constexpr float UV_RATE_X		= 8.0f;		// eNX`W̊X
-	static constexpr float UV_RATE_Y		= 8.0f;		// eNX`W̊Y
+	static constexpr float EXIT_HALF_WIDTH	= 80.0f;	// 出口ハーフ幅
+	static constexpr float RIVER_WIDTH		= 65.0f;	// 川の幅
+	static constexpr float RIVER_DEPTH		= 20.0f;	// 川の深さ
+	static constexpr float UV_RATE_X		= 8.0f;		// テクスチャ座標の割合X
+	static constexpr float UV_RATE_Y		= 8.0f;		// テクスチャ座標の割合Y
 
-	LPDIRECT3DINDEXBUFFER9	m_pIdx;						// CfbNXobt@
-	LPDIRECT3DVERTEXBUFFER9 m_pVtx;						// _obt@
-	D3DXVECTOR3				m_pos;						// W
-	D3DXVECTOR3				m_rot;						// px
-	D3DXMATRIX				m_mtxWorld;					// [h}gbNX
-	MeshField				m_MeshFiled;				// \̕ϐ
-	RiverDir				m_riverDir;					// ̕
+	// 地形の一区画(区画ごとに頂点バッファを持ち、視錐台とLODを判定する)
+	struct Chunk
+	{
+		LPDIRECT3DVERTEXBUFFER9 pVtx;		// 頂点バッファ
+		int						nStartX;	// 開始セルX
+		int						nStartZ;	// 開始セルZ
+		int						nCellX;		// セル数X
+		int						nCellZ;		// セル数Z
+		int						nMaxLod;	// 使える最大LOD
+		int						nLod;		// 今回のLOD
+		D3DXVECTOR3				vMin;		// AABBの最小値(ワールド)
+		D3DXVECTOR3				vMax;		// AABBの最大値(ワールド)
+	};
+
+	// LODと継ぎ目ごとのインデックスバッファ(同じ形の区画で共有する)
+	struct LodIndex
+	{
+		LPDIRECT3DINDEXBUFFER9	pIdx;			// インデックスバッファ
+		int						nNumPrimitive;	// ポリゴン数
+	};
+
+	HRESULT CreateChunks(void);
+	void SetChunkVertex(Chunk& chunk, VERTEX_3D* pVtx);
+	const LodIndex* GetLodIndex(const Chunk& chunk, const int anEdgeStep[CTerrainLod::EDGE_MAX]);
+	int GetChunkLod(int nChunkX, int nChunkZ, int nDefault) const;
+
+	D3DXVECTOR3				m_pos;						// 座標
+	D3DXVECTOR3				m_rot;						// 角度
+	D3DXMATRIX				m_mtxWorld;					// ワールドマトリックス
+	MeshField				m_MeshFiled;				// 構造体変数
+	RiverDir				m_riverDir;					// 川の方向
 	float					m_riverCenter;				// X or Z
-	float					m_riverWidth;				// a
-	float					m_riverDepth;				// [
-	std::vector<float>		m_riverLine;				// 쒆SC
+	float					m_riverWidth;				// 半径
+	float					m_riverDepth;				// 深さ
+	std::vector<float>		m_riverLine;				// 川中心ライン
+	std::vector<Chunk>		m_chunks;					// 区画の一覧
+	std::unordered_map<unsigned long long, LodIndex> m_lodIndex;// 形ごとのインデックスバッファ
+	int						m_nNumChunkX;				// 区画数X
+	int						m_nNumChunkZ;				// 区画数Z
+	int						m_nNumDrawChunk;			// 前回描画した区画数
 };
 
 #endif
\ No newline at end of file
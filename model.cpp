@@ -1,53 +1,59 @@
 //=============================================================================
 //
-// f [model.cpp]
+// モデル処理 [model.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "model.h"
 #include "texture.h"
 #include "renderer.h"
 #include "manager.h"
+#include "assetloader.h"
+#include "light.h"
+#include "algorithm"
 #include "cstdio"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CModel::CModel()
 {
-	// l̃NA
-	memset(m_Path, 0, sizeof(m_Path));			// t@CpX
-	m_nIdxTexture	= 0;						// eNX`CfbNX
-	m_pos			= INIT_VEC3;				// ʒu
-	m_rot			= INIT_VEC3;				// 
-	m_move			= INIT_VEC3;				// ړ
-	m_col			= INIT_XCOL_WHITE;			// F
-	m_pMesh			= nullptr;					// bVւ̃|C^
-	m_pBuffMat		= nullptr;					// }eAւ̃|C^
-	m_dwNumMat		= NULL;						// }eA
-	m_mtxWorld		= {};						// [h}gbNX
-	m_pParent		= nullptr;					// efւ̃|C^
-	m_outlineColor	= D3DXVECTOR4(0, 0, 0, 1);	// AEgCJ[
+	// 値のクリア
+	memset(m_Path, 0, sizeof(m_Path));			// ファイルパス
+	m_nIdxTexture	= 0;						// テクスチャインデックス
+	m_pos			= INIT_VEC3;				// 位置
+	m_rot			= INIT_VEC3;				// 向き
+	m_move			= INIT_VEC3;				// 移動量
+	m_col			= INIT_XCOL_WHITE;			// 色
+	m_pMesh			= nullptr;					// メッシュへのポインタ
+	m_pBuffMat		= nullptr;					// マテリアルへのポインタ
+	m_dwNumMat		= NULL;						// マテリアル数
+	m_mtxWorld		= {};						// ワールドマトリックス
+	m_pParent		= nullptr;					// 親モデルへのポインタ
+	m_outlineColor	= D3DXVECTOR4(0, 0, 0, 1);	// アウトラインカラー
+	m_vMin			= INIT_VEC3;				// モデルの元の境界の最小
+	m_vMax			= INIT_VEC3;				// モデルの元の境界の最大
+	m_bMeshPending	= false;					// メッシュが先読み中か
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CModel::~CModel()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CModel* CModel::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot)
 {
 	CModel* pModel = new CModel;
 
-	// nullptr
+	// nullptrだったら
 	if (pModel == nullptr)
 	{
 		return nullptr;
@@ -55,9 +61,9 @@ CModel* CModel::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot)
 
 	pModel->m_pos = pos;
 	pModel->m_rot = D3DXToRadian(rot);
-	strcpy_s(pModel->m_Path, pFilepath); // pXۑ
+	strcpy_s(pModel->m_Path, pFilepath); // パス保存
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pModel->Init()))
 	{
 		return nullptr;
@@ -66,52 +72,73 @@ CModel* CModel::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot)
 	return pModel;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CModel::Init(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// Xt@C̓ǂݍ
-	D3DXLoadMeshFromX(m_Path,
-		D3DXMESH_SYSTEMMEM,
+	// Xファイルの読み込み(先読み中なら待たずに仮の箱で表示し、届いてから作る)
+	HRESULT hr = CAssetLoader::CreateMesh(m_Path,
 		pDevice,
-		NULL,
+		D3DXMESH_SYSTEMMEM,
 		&m_pBuffMat,
-		NULL,
 		&m_dwNumMat,
-		&m_pMesh);
+		&m_pMesh,
+		&m_vMin,
+		&m_vMax);
+
+	if (hr == E_PENDING)
+	{
+		// 仮の箱の大きさはここで1回だけ取る
+		CAssetLoader::GetMeshBounds(m_Path, &m_vMin, &m_vMax);
 
-	int nNumVtx;		// _
-	DWORD sizeFVF;		// _tH[}bg̃TCY
-	BYTE* pVtxBuff;		// _obt@ւ̃|C^
+		m_bMeshPending = true;
+		return S_OK;
+	}
 
-	// bVǂݍ܂Ă邩mF
+	// メッシュが読み込まれているか確認
 	if (m_pMesh == nullptr)
 	{
-		MessageBox(nullptr, "Xt@C̓ǂݍ݂Ɏs܂ibVNULLłj", "G[", MB_OK | MB_ICONERROR);
+		MessageBox(nullptr, "Xファイルの読み込みに失敗しました（メッシュがNULLです）", "エラー", MB_OK | MB_ICONERROR);
 		return 0;
 	}
 
-	// X[YVF[fBOp̖@𐶐(X[Y)
+	SetupMesh();
+
+	return S_OK;
+}
+//=============================================================================
+// 読み込んだメッシュの準備処理(法線のスムーズ化とテクスチャの登録)
+//=============================================================================
+void CModel::SetupMesh(void)
+{
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	int nNumVtx;		// 頂点数
+	DWORD sizeFVF;		// 頂点フォーマットのサイズ
+	BYTE* pVtxBuff;		// 頂点バッファへのポインタ
+
+	// スムーズシェーディング用の法線を生成する(スムーズ化)
 	{
-		// ꎞbV|C^
+		// 一時メッシュポインタ
 		ID3DXMesh* pTempMesh = nullptr;
 
-		// אڏ̊mۂƍ쐬
+		// 隣接情報の確保と作成
 		DWORD* pAdjacency = new DWORD[m_pMesh->GetNumFaces() * 3];
 		m_pMesh->GenerateAdjacency(1e-6f, pAdjacency);
 
-		// @iX[Yj
+		// 法線生成（スムーズ化）
 		HRESULT hr = D3DXComputeNormals(m_pMesh, pAdjacency);
 
 		if (FAILED(hr))
 		{
-			// fɖ@ꍇAN[Ė@t^
+			// モデルに法線が無い場合、いったんクローンして法線を付与
 			D3DVERTEXELEMENT9 decl[MAX_FVF_DECL_SIZE];
 			m_pMesh->GetDeclaration(decl);
 			m_pMesh->CloneMesh(D3DXMESH_SYSTEMMEM, decl, pDevice, &pTempMesh);
@@ -121,31 +148,31 @@ HRESULT CModel::Init(void)
 				pTempMesh->GenerateAdjacency(1e-6f, pAdjacency);
 				D3DXComputeNormals(pTempMesh, pAdjacency);
 
-				// bVɍւ
+				// メッシュに差し替え
 				m_pMesh->Release();
 				m_pMesh = pTempMesh;
 			}
 		}
 
-		// אڏ
+		// 隣接情報解放
 		delete[] pAdjacency;
 	}
 
-	// _̎擾
+	// 頂点数の取得
 	nNumVtx = m_pMesh->GetNumVertices();
 
-	// _tH[}bg̎擾
+	// 頂点フォーマットの取得
 	sizeFVF = D3DXGetFVFVertexSize(m_pMesh->GetFVF());
 
-	// _obt@̃bN
+	// 頂点バッファのロック
 	m_pMesh->LockVertexBuffer(D3DLOCK_READONLY, (void**)&pVtxBuff);
 
-	// _obt@̃AbN
+	// 頂点バッファのアンロック
 	m_pMesh->UnlockVertexBuffer();
 
-	D3DXMATERIAL* pMat;// }eAւ̃|C^
+	D3DXMATERIAL* pMat;// マテリアルへのポインタ
 
-	// }eAf[^ւ̃|C^擾
+	// マテリアルデータへのポインタを取得
 	pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
 
 	m_nIdxTexture = new int[m_dwNumMat];
@@ -153,38 +180,143 @@ HRESULT CModel::Init(void)
 	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
 	{
 		if (pMat[nCntMat].pTextureFilename != nullptr)
-		{// eNX`t@C݂
-			// eNX`̓o^
+		{// テクスチャファイルが存在する
+			// テクスチャの登録
 			m_nIdxTexture[nCntMat] = pTexture->RegisterDynamic(pMat[nCntMat].pTextureFilename);
 		}
 		else
-		{// eNX`݂Ȃ
+		{// テクスチャが存在しない
 			m_nIdxTexture[nCntMat] = -1;
 		}
 	}
+}
+//=============================================================================
+// 先読み中のメッシュの作成処理(作れたらtrue。まだ届いていない・今回のフレームの上限を超えた時はfalse)
+//=============================================================================
+bool CModel::UpdatePendingMesh(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	HRESULT hr = CAssetLoader::CreateMesh(m_Path, pDevice, D3DXMESH_SYSTEMMEM,
+		&m_pBuffMat, &m_dwNumMat, &m_pMesh, &m_vMin, &m_vMax);
+
+	if (hr == E_PENDING)
+	{
+		return false;
+	}
 
-	return S_OK;
+	m_bMeshPending = false;
+
+	if (FAILED(hr) || m_pMesh == nullptr)
+	{// 読めなかった時は何も描かない
+		return false;
+	}
+
+	SetupMesh();
+
+	return true;
+}
+//=============================================================================
+// 仮の箱の描画処理(モデルの元の境界の大きさで描く。キューを使う時は他のパケットと一緒に描く)
+//=============================================================================
+void CModel::DrawPlaceholder(CRenderDevice* pDevice, CRenderQueue* pQueue)
+{
+	LPD3DXMESH pBox = CAssetLoader::GetPlaceholderMesh(CManager::GetRenderer()->GetDevice());
+
+	if (pBox == nullptr)
+	{
+		return;
+	}
+
+	// 1x1x1の箱を元の境界に合わせる
+	D3DXVECTOR3 size = m_vMax - m_vMin;
+	D3DXVECTOR3 center = (m_vMax + m_vMin) * 0.5f;
+	D3DXMATRIX mtxBox, mtxTrans;
+	D3DXMatrixScaling(&mtxBox, size.x, size.y, size.z);
+	D3DXMatrixTranslation(&mtxTrans, center.x, center.y, center.z);
+	mtxBox = mtxBox * mtxTrans * m_mtxWorld;
+
+	D3DMATERIAL9 matDef;
+	pDevice->GetMaterial(&matDef);
+
+	D3DMATERIAL9 mat = {};
+	mat.Diffuse = D3DXCOLOR(PLACEHOLDER_GRAY, PLACEHOLDER_GRAY, PLACEHOLDER_GRAY, m_col.a);
+	mat.Ambient = mat.Diffuse;
+
+	// ライトはパーツの境界球の周りで選ぶ
+	D3DXVECTOR3 lightCenter;
+	float fLightRadius;
+	GetWorldBounds(&lightCenter, &fLightRadius);
+
+	// 描画パケットを積む(テクスチャなし。マテリアルがまだ無いのでモデルの色だけで見る)
+	if (pQueue->IsEnable() && m_col.a >= 1.0f)
+	{
+		pQueue->Submit(CRenderQueue::PASS_OPAQUE, 0, -1, pBox, 0, mtxBox, mat, nullptr, lightCenter, fLightRadius);
+		return;
+	}
+
+	// 溜まっている分を描いてからその場で描画する
+	pQueue->Flush();
+	CLight::Apply(lightCenter, fLightRadius);
+
+	pDevice->SetTransform(D3DTS_WORLD, &mtxBox);
+	pDevice->SetMaterial(&mat);
+	pDevice->SetTexture(0, nullptr);
+	pDevice->DrawSubset(pBox, 0);
+
+	// 元マテリアルに戻す
+	pDevice->SetMaterial(&matDef);
+
+	// 注視点の周りのライトに戻す
+	CLight::RestoreView();
+}
+//=============================================================================
+// ワールド空間の境界球の取得処理(パーツごとにライトを選ぶ範囲)
+//=============================================================================
+void CModel::GetWorldBounds(D3DXVECTOR3* pCenter, float* pRadius)
+{
+	// 元の中心をワールド空間に移す
+	D3DXVECTOR3 center = (m_vMax + m_vMin) * 0.5f;
+	D3DXVec3TransformCoord(pCenter, &center, &m_mtxWorld);
+
+	// 親の拡大も含めて一番大きい軸の拡大率で広げる
+	D3DXVECTOR3 axisX(m_mtxWorld._11, m_mtxWorld._12, m_mtxWorld._13);
+	D3DXVECTOR3 axisY(m_mtxWorld._21, m_mtxWorld._22, m_mtxWorld._23);
+	D3DXVECTOR3 axisZ(m_mtxWorld._31, m_mtxWorld._32, m_mtxWorld._33);
+	float fScale = std::max(D3DXVec3Length(&axisX), std::max(D3DXVec3Length(&axisY), D3DXVec3Length(&axisZ)));
+
+	D3DXVECTOR3 size = m_vMax - m_vMin;
+	*pRadius = D3DXVec3Length(&size) * 0.5f * fScale;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CModel::Uninit(void)
 {
-	// eNX`CfbNX̔j
+	// テクスチャインデックスの破棄
 	if (m_nIdxTexture != nullptr)
 	{
+		// テクスチャの参照を外す
+		CTexture* pTexture = CManager::GetTexture();
+
+		for (int nCntMat = 0; pTexture != nullptr && nCntMat < (int)m_dwNumMat; nCntMat++)
+		{
+			pTexture->Release(m_nIdxTexture[nCntMat]);
+		}
+
 		delete[] m_nIdxTexture;
 		m_nIdxTexture = nullptr;
 	}
 
-	// bV̔j
+	// メッシュの破棄
 	if (m_pMesh != nullptr)
 	{
 		m_pMesh->Release();
 		m_pMesh = nullptr;
 	}
 
-	// }eA̔j
+	// マテリアルの破棄
 	if (m_pBuffMat != nullptr)
 	{
 		m_pBuffMat->Release();
@@ -192,99 +324,211 @@ void CModel::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CModel::Update(void)
 {
-	// ʒuXV
+	// 位置を更新
 	m_pos.x += m_move.x;
 	m_pos.z += m_move.z;
 	m_pos.y += m_move.y;
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CModel::Draw(void)
 {
-	// _[̎擾
+	// レンダラーの取得
 	CRenderer* pRenderer = CManager::GetRenderer();
 
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = pRenderer->GetDevice();
+	// デバイスの取得
+	CRenderDevice* pDevice = pRenderer->GetBackend();
 
-	// vZp}gbNX
-	D3DXMATRIX mtxRot, mtxTrans;
+	// ワールドマトリックスの計算
+	UpdateWorldMatrix();
 
-	// [h}gbNX̏
-	D3DXMatrixIdentity(&m_mtxWorld);
-
-	// f
-	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y + m_OffsetRot.y, m_rot.x + m_OffsetRot.x, m_rot.z + m_OffsetRot.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
+	// 描画キューの取得
+	CRenderQueue* pQueue = pRenderer->GetRenderQueue();
 
-	// ʒuf
-	D3DXMatrixTranslation(&mtxTrans, m_pos.x + m_OffsetPos.x, m_pos.y + m_OffsetPos.y, m_pos.z + m_OffsetPos.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
+	// 先読み中のメッシュが届いていれば作り、まだなら仮の箱を描く
+	if (m_bMeshPending && !UpdatePendingMesh())
+	{
+		if (m_bMeshPending)
+		{
+			DrawPlaceholder(pDevice, pQueue);
+		}
 
-	D3DXMATRIX mtxParent;
+		return;
+	}
 
-	if (m_pParent != nullptr)
-	{// e݂
-		// ef̃}gbNX擾
-		mtxParent = m_pParent->GetMtxWorld();
-		D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxParent);
+	// 読み込みに失敗したメッシュは描かない
+	if (m_pMesh == nullptr)
+	{
+		return;
 	}
-	else
-	{// e݂Ȃ
-		// (ŐV)̃}gbNX擾
-		pDevice->GetTransform(D3DTS_WORLD, &mtxParent);
-		D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxParent);
+
+	// 描画キューに積めるなら全キャラクター分まとめて描く
+	if (pQueue->IsEnable() && !IsTranslucent())
+	{
+		Submit(pQueue);
+		return;
 	}
 
-	// [h}gbNXݒ
+	// 溜まっている分を描いてからその場で描画する
+	pQueue->Flush();
+
+	// 自分の周りのライトを選ぶ
+	D3DXVECTOR3 lightCenter;
+	float fLightRadius;
+	GetWorldBounds(&lightCenter, &fLightRadius);
+	CLight::Apply(lightCenter, fLightRadius);
+
+	// ワールドマトリックス設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// ===== AEgC` =====
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CW); // JO]
+	// ===== アウトライン描画 =====
+	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CW); // カリング反転
 	pDevice->SetVertexShader(pRenderer->GetOutlineVS());
 	pDevice->SetPixelShader(pRenderer->GetOutlinePS());
 
-	// 萔̐ݒ菈
+	// 定数の設定処理
 	SetOutlineShaderConstants(pDevice);
 
 	for (int n = 0; n < (int)m_dwNumMat; n++)
 	{
-		// f̕`(AEgCp)
-		m_pMesh->DrawSubset(n);
+		// モデルの描画(アウトライン用)
+		pDevice->DrawSubset(m_pMesh, n);
 	}
 
-	// ԃZbg
+	// 状態リセット
 	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
 	pDevice->SetVertexShader(nullptr);
 	pDevice->SetPixelShader(nullptr);
 
-	// ===== ʏ` =====
+	// ===== 通常描画 =====
 	DrawNormal(pDevice);
+
+	// 注視点の周りのライトに戻す
+	CLight::RestoreView();
 }
 //=============================================================================
-// ʏ탂f`揈
+// 描画キューへの登録処理(アウトラインと通常描画を別のパスに積む)
 //=============================================================================
-void CModel::DrawNormal(LPDIRECT3DDEVICE9 pDevice)
+void CModel::Submit(CRenderQueue* pQueue)
 {
-	// eNX`̎擾
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
+
+	// マテリアルデータへのポインタ
+	D3DXMATERIAL* pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
+
+	// アウトラインの色はマテリアルのディフューズに入れて渡す
+	D3DMATERIAL9 matOutline = {};
+	matOutline.Diffuse = D3DXCOLOR(m_outlineColor.x, m_outlineColor.y, m_outlineColor.z, m_outlineColor.w);
+
+	// ライトはパーツの境界球の周りで選ぶ
+	D3DXVECTOR3 lightCenter;
+	float fLightRadius;
+	GetWorldBounds(&lightCenter, &fLightRadius);
+
+	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
+	{
+		// アウトライン
+		pQueue->Submit(CRenderQueue::PASS_OUTLINE, SHADER_OUTLINE, -1, m_pMesh, nCntMat, m_mtxWorld, matOutline, nullptr, lightCenter, fLightRadius);
+
+		// 元のマテリアル色に補正を掛ける
+		D3DMATERIAL9 mat = pMat[nCntMat].MatD3D;
+
+		mat.Diffuse.r *= m_col.r;
+		mat.Diffuse.g *= m_col.g;
+		mat.Diffuse.b *= m_col.b;
+		mat.Diffuse.a *= m_col.a;
+
+		LPDIRECT3DTEXTURE9 pTex = nullptr;
+
+		if (m_nIdxTexture[nCntMat] != -1)
+		{
+			pTex = pTexture->GetAddress(m_nIdxTexture[nCntMat]);
+		}
+
+		// 通常描画
+		pQueue->Submit(CRenderQueue::PASS_OPAQUE, SHADER_NORMAL, m_nIdxTexture[nCntMat], m_pMesh, nCntMat, m_mtxWorld, mat, pTex, lightCenter, fLightRadius);
+	}
+}
+//=============================================================================
+// 半透明かどうかの判定処理(並べ替えると重なりが崩れるのでキューに積まない)
+//=============================================================================
+bool CModel::IsTranslucent(void)
+{
+	// マテリアルデータへのポインタ
+	D3DXMATERIAL* pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
+
+	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
+	{
+		if (pMat[nCntMat].MatD3D.Diffuse.a * m_col.a < 1.0f)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+//=============================================================================
+// ワールドマトリックスの計算処理(描画しない時も武器の当たり判定のために呼ぶ)
+//=============================================================================
+void CModel::UpdateWorldMatrix(void)
+{
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// 計算用マトリックス
+	D3DXMATRIX mtxRot, mtxTrans;
+
+	// ワールドマトリックスの初期化
+	D3DXMatrixIdentity(&m_mtxWorld);
+
+	// 向き反映
+	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y + m_OffsetRot.y, m_rot.x + m_OffsetRot.x, m_rot.z + m_OffsetRot.z);
+	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
+
+	// 位置反映
+	D3DXMatrixTranslation(&mtxTrans, m_pos.x + m_OffsetPos.x, m_pos.y + m_OffsetPos.y, m_pos.z + m_OffsetPos.z);
+	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
+
+	D3DXMATRIX mtxParent;
+
+	if (m_pParent != nullptr)
+	{// 親が存在する
+		// 親モデルのマトリックスを取得
+		mtxParent = m_pParent->GetMtxWorld();
+		D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxParent);
+	}
+	else
+	{// 親が存在しない
+		// 現在(最新)のマトリックスを取得する
+		pDevice->GetTransform(D3DTS_WORLD, &mtxParent);
+		D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxParent);
+	}
+}
+//=============================================================================
+// 通常モデル描画処理
+//=============================================================================
+void CModel::DrawNormal(CRenderDevice* pDevice)
+{
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
 	D3DMATERIAL9 matDef;
 
-	// ݂̃}eA̕ۑ
+	// 現在のマテリアルの保存
 	pDevice->GetMaterial(&matDef);
 
-	// }eAf[^ւ̃|C^
+	// マテリアルデータへのポインタ
 	D3DXMATERIAL* pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
 
 	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
 	{
-		// ̃}eAFɕ␳|
+		// 元のマテリアル色に補正を掛ける
 		D3DMATERIAL9 mat = pMat[nCntMat].MatD3D;
 
 		mat.Diffuse.r *= m_col.r;
@@ -292,10 +536,10 @@ void CModel::DrawNormal(LPDIRECT3DDEVICE9 pDevice)
 		mat.Diffuse.b *= m_col.b;
 		mat.Diffuse.a *= m_col.a;
 
-		// }eA̐ݒ
+		// マテリアルの設定
 		pDevice->SetMaterial(&mat);
 
-		// eNX`ݒ
+		// テクスチャ設定
 		if (m_nIdxTexture[nCntMat] == -1)
 		{
 			pDevice->SetTexture(0, nullptr);
@@ -305,52 +549,26 @@ void CModel::DrawNormal(LPDIRECT3DDEVICE9 pDevice)
 			pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture[nCntMat]));
 		}
 
-		// `
-		m_pMesh->DrawSubset(nCntMat);
+		// 描画
+		pDevice->DrawSubset(m_pMesh, nCntMat);
 	}
 
-	// }eAɖ߂
+	// 元マテリアルに戻す
 	pDevice->SetMaterial(&matDef);
 }
 //=============================================================================
-// 萔ݒ菈
+// 定数設定処理
 //=============================================================================
-void CModel::SetOutlineShaderConstants(LPDIRECT3DDEVICE9 pDevice)
+void CModel::SetOutlineShaderConstants(CRenderDevice* pDevice)
 {
-	// _[̎擾
-	CRenderer* pRenderer = CManager::GetRenderer();
-
-	// AEgC_VF[_[̎擾
-	LPDIRECT3DVERTEXSHADER9 pOutlineVS = pRenderer->GetOutlineVS();
-
-	// AEgCsNZVF[_[̎擾
-	LPDIRECT3DPIXELSHADER9 pOutlinePS = pRenderer->GetOutlinePS();
-
-	// AEgC_VF[_[̃RX^ge[u̎擾
-	LPD3DXCONSTANTTABLE pVSConsts = pRenderer->GetVSConsts();
-
-	// AEgCsNZVF[_[̃RX^ge[u̎擾
-	LPD3DXCONSTANTTABLE pPSConsts = pRenderer->GetPSConsts();
-
-	// s擾
-	D3DXMATRIX view, proj, wvp;
-	pDevice->GetTransform(D3DTS_WORLD, &m_mtxWorld);
+	// 行列を取得
+	D3DXMATRIX view, proj, viewProj;
 	pDevice->GetTransform(D3DTS_VIEW, &view);
 	pDevice->GetTransform(D3DTS_PROJECTION, &proj);
 
-	wvp = m_mtxWorld * view * proj;
+	viewProj = view * proj;
 
-	// 萔VF[_ɓn
-	if (pOutlineVS) // _VF[_萔e[u
-	{
-		pVSConsts->SetMatrix(pDevice, "g_mWorld", &m_mtxWorld);
-		pVSConsts->SetMatrix(pDevice, "g_mWorldViewProj", &wvp);
-		pVSConsts->SetFloat(pDevice, "g_OutlineWidth", 0.2f); // AEgC
-	}
-
-	if (pOutlinePS) // sNZVF[_萔e[u
-	{
-		// AEgC̐Fݒ
-		pPSConsts->SetVector(pDevice, "g_OutlineColor", &m_outlineColor);
-	}
+	// 定数をシェーダに渡す(描画キューと同じレジスタ配置)
+	CRenderQueue::SetOutlineConstants(pDevice, m_mtxWorld, viewProj,
+		D3DXCOLOR(m_outlineColor.x, m_outlineColor.y, m_outlineColor.z, m_outlineColor.w));
 }
\ No newline at end of file
@@ -1,19 +1,25 @@
 //=============================================================================
 //
-// f [model.h]
+// モデル処理 [model.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _MODEL_H_// ̃}N`ĂȂ
-#define _MODEL_H_// 2dCN[hh~̃}N`
+#ifndef _MODEL_H_// このマクロ定義がされていなかったら
+#define _MODEL_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 //*****************************************************************************
-// fNX
+// 前方宣言
+//*****************************************************************************
+class CRenderDevice;
+class CRenderQueue;
+
+//*****************************************************************************
+// モデルクラス
 //*****************************************************************************
 class CModel
 {
@@ -26,12 +32,14 @@ public:
 	void Uninit(void);
 	void Update(void);
 	void Draw(void);
-	void DrawNormal(LPDIRECT3DDEVICE9 pDevice);
+	void DrawNormal(CRenderDevice* pDevice);
+	void UpdateWorldMatrix(void);
+	void Submit(CRenderQueue* pQueue);
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
-	void SetOutlineShaderConstants(LPDIRECT3DDEVICE9 pDevice);
+	void SetOutlineShaderConstants(CRenderDevice* pDevice);
 	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
 	void SetRot(D3DXVECTOR3 rot) { m_rot = D3DXToRadian(rot); }
 	void SetCol(D3DXCOLOR col) { m_col = col; }
@@ -41,7 +49,7 @@ public:
 	void SetOutlineColor(const D3DXVECTOR4& col) { m_outlineColor = col; }
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
 	D3DXMATRIX GetMtxWorld(void) { return m_mtxWorld; }
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
@@ -52,21 +60,45 @@ public:
 	const char* GetPath(void) { return m_Path; }
 	CModel* GetParent(void) { return m_pParent; }
 
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	bool IsTranslucent(void);
+	bool IsMeshPending(void) const { return m_bMeshPending; }
+
 private:
-	int*					m_nIdxTexture;			// eNX`CfbNX
-	D3DXVECTOR3				m_pos;					// ʒu
-	D3DXVECTOR3				m_rot;					// 
-	D3DXCOLOR				m_col;					// F
-	D3DXVECTOR3				m_move;					// ړ
-	LPD3DXMESH				m_pMesh;				// bVւ̃|C^
-	LPD3DXBUFFER			m_pBuffMat;				// }eAւ̃|C^
-	DWORD					m_dwNumMat;				// }eA
-	D3DXMATRIX				m_mtxWorld;				// [h}gbNX
-	CModel*					m_pParent;				// efւ̃|C^
-	char					m_Path[MAX_PATH];		// t@CpX
-	D3DXVECTOR3				m_OffsetPos;			// ItZbg
-	D3DXVECTOR3				m_OffsetRot;			// ItZbg
-	D3DXVECTOR4				m_outlineColor;			// AEgCJ[
+	static constexpr float PLACEHOLDER_GRAY = 0.5f;	// 仮の箱の明るさ
+
+	// 描画キューのシェーダー識別子
+	typedef enum
+	{
+		SHADER_NORMAL = 0,	// 固定機能
+		SHADER_OUTLINE,		// アウトライン
+		SHADER_MAX
+	}SHADER;
+
+	void SetupMesh(void);
+	bool UpdatePendingMesh(void);
+	void DrawPlaceholder(CRenderDevice* pDevice, CRenderQueue* pQueue);
+	void GetWorldBounds(D3DXVECTOR3* pCenter, float* pRadius);
+
+	int*					m_nIdxTexture;			// テクスチャインデックス
+	D3DXVECTOR3				m_pos;					// 位置
+	D3DXVECTOR3				m_rot;					// 向き
+	D3DXCOLOR				m_col;					// 色
+	D3DXVECTOR3				m_move;					// 移動量
+	LPD3DXMESH				m_pMesh;				// メッシュへのポインタ
+	LPD3DXBUFFER			m_pBuffMat;				// マテリアルへのポインタ
+	DWORD					m_dwNumMat;				// マテリアル数
+	D3DXMATRIX				m_mtxWorld;				// ワールドマトリックス
+	CModel*					m_pParent;				// 親モデルへのポインタ
+	char					m_Path[MAX_PATH];		// ファイルパス
+	D3DXVECTOR3				m_OffsetPos;			// オフセット
+	D3DXVECTOR3				m_OffsetRot;			// オフセット
+	D3DXVECTOR4				m_outlineColor;			// アウトラインカラー
+	D3DXVECTOR3				m_vMin;					// モデルの元の境界の最小
+	D3DXVECTOR3				m_vMax;					// モデルの元の境界の最大
+	bool					m_bMeshPending;			// メッシュが先読み中か(届くまでは仮の箱を描く)
 };
 
 #endif
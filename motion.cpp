@@ -1,67 +1,67 @@
 //=============================================================================
 //
-// [V [motion.cpp]
+// モーション処理 [motion.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "motion.h"
 #include "manager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMotion::CMotion()
 {
-	// l̃NA
-	m_motionType		  = 0;				// [V̎
-	m_nNumMotion		  = 0;				// [V
-	m_bLoopMotion		  = false;			// [v邩ǂ
-	m_nNumKey			  = 0;				// L[̑
-	m_nKey				  = 0;				// ݂̃L[No.
-	m_nCounterMotion	  = 0;				// [ṼJE^[
-	m_bFinishMotion		  = false;			// ݂̃[VIĂ邩ǂ
-	m_bBlendMotion		  = false;			// uh[V邩ǂ
-	m_motionTypeBlend	  = 0;				// uh[V̎
-	m_bLoopMotionBlend	  = false;			// uh[V[v邩ǂ
-	m_nNumKeyBlend        = 0;				// uh[ṼL[
-	m_nKeyBlend           = 0;				// uh[V݂̌̃L[No.
-	m_nCounterMotionBlend = 0;				// uh[ṼJE^[
-	m_nFrameBlend		  = 0;				// uh̃t[(t[ăuh邩)
-	m_nCounterBlend       = 0;				// uhJE^[
-	m_motionSpeedRate	  = 1.0f;			// 1.0 = ʏ
-	m_motionCounterAcc	  = 0.0f;			// isp
+	// 値のクリア
+	m_motionType		  = 0;				// モーションの種類
+	m_nNumMotion		  = 0;				// モーション総数
+	m_bLoopMotion		  = false;			// ループするかどうか
+	m_nNumKey			  = 0;				// キーの総数
+	m_nKey				  = 0;				// 現在のキーNo.
+	m_nCounterMotion	  = 0;				// モーションのカウンター
+	m_bFinishMotion		  = false;			// 現在のモーションが終了しているかどうか
+	m_bBlendMotion		  = false;			// ブレンドモーションがあるかどうか
+	m_motionTypeBlend	  = 0;				// ブレンドモーションの種類
+	m_bLoopMotionBlend	  = false;			// ブレンドモーションがループするかどうか
+	m_nNumKeyBlend        = 0;				// ブレンドモーションのキー数
+	m_nKeyBlend           = 0;				// ブレンドモーションの現在のキーNo.
+	m_nCounterMotionBlend = 0;				// ブレンドモーションのカウンター
+	m_nFrameBlend		  = 0;				// ブレンドのフレーム数(何フレームかけてブレンドするか)
+	m_nCounterBlend       = 0;				// ブレンドカウンター
+	m_motionSpeedRate	  = 1.0f;			// 1.0 = 通常
+	m_motionCounterAcc	  = 0.0f;			// 小数進行用
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMotion::~CMotion()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// [VeLXgt@C̓ǂݍ
+// モーションテキストファイルの読み込み
 //=============================================================================
 CMotion* CMotion::Load(const char* pFilepath, CModel* pModel[], int& nNumModel, int nMaxMotion)
 {
 	CMotion* pMotion = new CMotion;
 
-	// t@CJ
+	// ファイルを開く
 	FILE* pFile = fopen(pFilepath, "r");
 
 	if (!pFile)
 	{
-		return nullptr;  // t@CJȂ
+		return nullptr;  // ファイルが開けなかった
 	}
 
 	char aString[MAX_WORD];
 	int nIdx = 0;
 	int nCntMotion = 0;
 
-	// ꎞIȐẽCfbNXz
+	// 一時的な親のインデックス配列
 	int parentIdx[MAX_PARTS];
 
 	for (int i = 0; i < MAX_PARTS; i++) 
@@ -71,7 +71,7 @@ CMotion* CMotion::Load(const char* pFilepath, CModel* pModel[], int& nNumModel,
 
 	while (fscanf(pFile, "%s", aString) != EOF)
 	{
-		// SCRIPT ȊO͖
+		// SCRIPT 以外は無視
 		if (strcmp(aString, "SCRIPT") != 0)
 		{
 			continue;
@@ -103,14 +103,14 @@ CMotion* CMotion::Load(const char* pFilepath, CModel* pModel[], int& nNumModel,
 				continue;
 			}
 
-			// ȊO͖
+			// これら以外は無視
 		}
 	}
 
-	// t@C
+	// ファイルを閉じる
 	fclose(pFile);
 
-	// eq֌Wݒ
+	// 親子関係設定
 	for (int nCnt = 0; nCnt < nNumModel; nCnt++)
 	{
 		if (parentIdx[nCnt] >= 0 && parentIdx[nCnt] < nNumModel)
@@ -122,7 +122,7 @@ CMotion* CMotion::Load(const char* pFilepath, CModel* pModel[], int& nNumModel,
 	return pMotion;
 }
 //=============================================================================
-// f̓ǂݍݏ
+// モデル情報の読み込み処理
 //=============================================================================
 void CMotion::LoadModelInfo(FILE* pFile, char* aString, CModel* pModel[], int& nNumModel, int& nIdx)
 {
@@ -143,14 +143,14 @@ void CMotion::LoadModelInfo(FILE* pFile, char* aString, CModel* pModel[], int& n
 		{
 			fscanf(pFile, "%s", aString);
 
-			// f̐
+			// モデルの生成
 			pModel[nIdx] = CModel::Create(aString, D3DXVECTOR3(0, 0, 0), D3DXVECTOR3(0, 0, 0));
 			nIdx++;
 		}
 	}
 }
 //=============================================================================
-// L̐ݒ菈
+// キャラの設定処理
 //=============================================================================
 void CMotion::LoadCharacterSet(FILE* pFile, char* aString, CModel* pModel[], int nNumModel, int parentIdx[])
 {
@@ -166,13 +166,13 @@ void CMotion::LoadCharacterSet(FILE* pFile, char* aString, CModel* pModel[], int
 			continue;
 		}
 
-		// PARTSSETJn
+		// PARTSSET開始
 		int idx = -1;
 		int pIdx = -1;
 		D3DXVECTOR3 pos(0, 0, 0);
 		D3DXVECTOR3 rot(0, 0, 0);
 
-		// PARTSSET[v
+		// PARTSSET内ループ
 		while (fscanf(pFile, "%s", aString) != EOF)
 		{
 			if (strcmp(aString, "END_PARTSSET") == 0)
@@ -208,10 +208,10 @@ void CMotion::LoadCharacterSet(FILE* pFile, char* aString, CModel* pModel[], int
 				continue;
 			}
 
-			// ȊO͖
+			// これら以外は無視
 		}
 
-		// ݒm
+		// 設定確定
 		if (idx < 0 || idx >= nNumModel || pModel[idx] == nullptr)
 		{
 			continue;
@@ -223,7 +223,7 @@ void CMotion::LoadCharacterSet(FILE* pFile, char* aString, CModel* pModel[], int
 	}
 }
 //=============================================================================
-// g[NT֐
+// トークン探索関数
 //=============================================================================
 bool CMotion::FindToken(FILE* f, char* buf, const char* token)
 {
@@ -238,7 +238,7 @@ bool CMotion::FindToken(FILE* f, char* buf, const char* token)
 	return false;
 }
 //=============================================================================
-// L[Zbg[h֐
+// キーセットリード関数
 //=============================================================================
 void CMotion::ParseKeySet(FILE* f, char* buf, KEY_INFO& keyInfo)
 {
@@ -261,7 +261,7 @@ void CMotion::ParseKeySet(FILE* f, char* buf, KEY_INFO& keyInfo)
 	}
 }
 //=============================================================================
-// L[[h֐
+// キーリード関数
 //=============================================================================
 void CMotion::ParseKey(FILE* f, char* buf, KEY_INFO& keyInfo,
 	int& posIdx, int& rotIdx)
@@ -297,7 +297,7 @@ void CMotion::ParseKey(FILE* f, char* buf, KEY_INFO& keyInfo,
 	}
 }
 //=============================================================================
-// [V̓ǂݍݏ
+// モーションの読み込み処理
 //=============================================================================
 void CMotion::LoadMotionSet(FILE* pFile, char* aString, CMotion* pMotion, int& nCntMotion, int nMaxMotion)
 {
@@ -341,19 +341,19 @@ void CMotion::LoadMotionSet(FILE* pFile, char* aString, CMotion* pMotion, int& n
 			fscanf(pFile, "%s", aString);
 			fscanf(pFile, "%d", &motion.aKeyInfo[nCnt].nFrame);
 
-			// L[Zbg
+			// キーセット
 			ParseKeySet(pFile, aString, motion.aKeyInfo[nCnt]);
 		}
 	}
 }
 //=============================================================================
-// L[JE^[XV
+// キーカウンター更新
 //=============================================================================
 void CMotion::AdvanceKeyCounter(int motionType, int& nKey, int& nCounter, bool bLoop)
 {
 	m_motionCounterAcc += m_motionSpeedRate;
 
-	// i܂ȂȂ牽Ȃ
+	// 進まないなら何もしない
 	if (m_motionCounterAcc < 1.0f)
 	{
 		return;
@@ -378,38 +378,38 @@ void CMotion::AdvanceKeyCounter(int motionType, int& nKey, int& nCounter, bool b
 		nCounter -= frame;
 		++nKey;
 
-		// L[͈͓Ȃ瑱s
+		// キー範囲内なら続行
 		if (nKey < motion.nNumKey)
 		{
 			continue;
 		}
 
-		// L[Ō܂ōsă[vꍇ
+		// キー最後まで行ってループする場合
 		if (bLoop)
 		{
 			nKey = 0;
 			continue;
 		}
 
-		// [vȂꍇ͍ŌŒ~
+		// ループしない場合は最後で停止
 		nKey = motion.nNumKey - 1;
 		break;
 	}
 }
 
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CMotion::Update(CModel** pModel, int& nNumModel)
 {
 	if (m_bBlendMotion && m_nFrameBlend > 0)
 	{
-		// uhisx
+		// ブレンド進行度
 		float blendRate = (float)m_nCounterBlend / (float)m_nFrameBlend;
 
 		for (int nCnt = 0; nCnt < nNumModel; nCnt++)
 		{
-			// ݃[V
+			// 現在モーション
 			int nextKey = (m_nKey + 1) % m_aMotionInfo[m_motionType].nNumKey;
 
 			float tCur = (float)m_nCounterMotion / m_aMotionInfo[m_motionType].aKeyInfo[m_nKey].nFrame;
@@ -418,7 +418,7 @@ void CMotion::Update(CModel** pModel, int& nNumModel)
 			D3DXVECTOR3 rotCurrent = LerpRot(m_aMotionInfo[m_motionType].aKeyInfo[m_nKey].aKey[nCnt],
 				m_aMotionInfo[m_motionType].aKeyInfo[nextKey].aKey[nCnt], tCur);
 
-			// uh惂[V
+			// ブレンド先モーション
 			int nextKeyBlend = (m_nKeyBlend + 1) % m_aMotionInfo[m_motionTypeBlend].nNumKey;
 
 			float tBlend = (float)m_nCounterMotionBlend / m_aMotionInfo[m_motionTypeBlend].aKeyInfo[m_nKeyBlend].nFrame;
@@ -427,7 +427,7 @@ void CMotion::Update(CModel** pModel, int& nNumModel)
 			D3DXVECTOR3 rotBlend = LerpRot(m_aMotionInfo[m_motionTypeBlend].aKeyInfo[m_nKeyBlend].aKey[nCnt],
 				m_aMotionInfo[m_motionTypeBlend].aKeyInfo[nextKeyBlend].aKey[nCnt], tBlend);
 
-			// uh
+			// ブレンド合成
 			D3DXVECTOR3 posFinal = posCurrent * (1.0f - blendRate) + posBlend * blendRate;
 			D3DXVECTOR3 rotFinal = rotCurrent * (1.0f - blendRate) + rotBlend * blendRate;
 
@@ -435,15 +435,15 @@ void CMotion::Update(CModel** pModel, int& nNumModel)
 			pModel[nCnt]->SetOffsetRot(rotFinal);
 		}
 
-		// JE^[is
+		// カウンター進行
 		AdvanceKeyCounter(m_motionType, m_nKey, m_nCounterMotion, m_aMotionInfo[m_motionType].bLoop);
 		AdvanceKeyCounter(m_motionTypeBlend, m_nKeyBlend, m_nCounterMotionBlend, m_aMotionInfo[m_motionTypeBlend].bLoop);
 
-		// uhis
+		// ブレンド進行
 		m_nCounterBlend++;
 		if (m_nCounterBlend >= m_nFrameBlend)
 		{
-			// uhI
+			// ブレンド終了
 			m_motionType = m_motionTypeBlend;
 			m_nKey = m_nKeyBlend;
 			m_nCounterMotion = m_nCounterMotionBlend;
@@ -452,7 +452,7 @@ void CMotion::Update(CModel** pModel, int& nNumModel)
 	}
 	else
 	{
-		// ʏ탂[V
+		// 通常モーション
 		for (int nCnt = 0; nCnt < nNumModel; nCnt++)
 		{
 			int nextKey = (m_nKey + 1 >= m_aMotionInfo[m_motionType].nNumKey) ?
@@ -469,23 +469,23 @@ void CMotion::Update(CModel** pModel, int& nNumModel)
 			pModel[nCnt]->SetOffsetRot(rot);
 		}
 
-		// JE^[is
+		// カウンター進行
 		AdvanceKeyCounter(m_motionType, m_nKey, m_nCounterMotion, m_aMotionInfo[m_motionType].bLoop);
 
-		// Ii[vȂꍇ̂݁j
+		// 終了判定（ループしない場合のみ）
 		if (!m_aMotionInfo[m_motionType].bLoop &&
 			m_nKey == m_aMotionInfo[m_motionType].nNumKey - 1)
 		{
-			m_bFinishMotion = true;  // Ō̃L[ɓBItO𗧂đ
+			m_bFinishMotion = true;  // 最後のキーに到達したら終了フラグを立て続ける
 		}
 		else if (m_aMotionInfo[m_motionType].bLoop)
 		{
-			m_bFinishMotion = false; // [v[VȂ false
+			m_bFinishMotion = false; // ループモーションなら常に false
 		}
 	}
 }
 //=============================================================================
-// Ԋ֐(ʒu)
+// 補間関数(位置)
 //=============================================================================
 inline D3DXVECTOR3 CMotion::LerpPos(const KEY& a, const KEY& b, float t)
 {
@@ -496,7 +496,7 @@ inline D3DXVECTOR3 CMotion::LerpPos(const KEY& a, const KEY& b, float t)
 	);
 }
 //=============================================================================
-// Ԋ֐()
+// 補間関数(向き)
 //=============================================================================
 inline D3DXVECTOR3 CMotion::LerpRot(const KEY& a, const KEY& b, float t)
 {
@@ -522,14 +522,14 @@ inline D3DXVECTOR3 CMotion::LerpRot(const KEY& a, const KEY& b, float t)
 	);
 }
 //=============================================================================
-// [VXs[hݒ菈
+// モーションスピード設定処理
 //=============================================================================
 void CMotion::SetMotionSpeedRate(float rate)
 {
-	m_motionSpeedRate = std::max(rate, 0.1f); // 
+	m_motionSpeedRate = std::max(rate, 0.1f); // 下限
 }
 //=============================================================================
-// [VuhJn
+// モーションブレンド開始処理
 //=============================================================================
 void CMotion::StartBlendMotion(int  motionTypeBlend, int nFrameBlend)
 {
@@ -537,19 +537,19 @@ void CMotion::StartBlendMotion(int  motionTypeBlend, int nFrameBlend)
 	m_nFrameBlend = nFrameBlend;
 	m_nCounterBlend = 0;
 
-	// 擪X^[g
+	// 先頭からスタート
 	m_nKeyBlend = 0;
 	m_nCounterMotionBlend = 0;
 
 	m_bBlendMotion = true;
 
-	// uh̃[VL[擾
+	// ブレンド先のモーションキー数取得
 	m_nNumKeyBlend = m_aMotionInfo[m_motionTypeBlend].nNumKey;
 
 	m_bFinishMotion = false;
 }
 //=============================================================================
-// [V̐ݒ菈
+// モーションの設定処理
 //=============================================================================
 void CMotion::SetMotion(int  motionType)
 {
@@ -559,7 +559,7 @@ void CMotion::SetMotion(int  motionType)
 	m_bFinishMotion = false;
 }
 //=============================================================================
-// ݂̃[V
+// 現在のモーション
 //=============================================================================
 bool CMotion::IsCurrentMotion(int motionType) const
 {
@@ -568,14 +568,14 @@ bool CMotion::IsCurrentMotion(int motionType) const
 	return currentMotion;
 }
 //=============================================================================
-// [V̏I
+// モーションの終了判定
 //=============================================================================
 bool CMotion::IsCurrentMotionEnd(int motionType) const
 {
-// uh`FbNꍇ
+// ブレンド中もチェックする場合
     bool endCurrent = (m_motionType == motionType) && m_bFinishMotion;
 
-    // uhŁA^[Qbg motionType ̏ꍇI
+    // ブレンド中で、ターゲットが motionType の場合も終了判定
     if (m_bBlendMotion && m_motionTypeBlend == motionType)
     {
         int lastKey = m_aMotionInfo[m_motionTypeBlend].nNumKey - 1;
@@ -589,24 +589,24 @@ bool CMotion::IsCurrentMotionEnd(int motionType) const
     return endCurrent;
 }
 //=============================================================================
-// [V͈̔
+// モーションの範囲
 //=============================================================================
 bool CMotion::EventMotionRange(int motionType, int startKey, int endKey, int startFrame, int endFrame) const
 {
-	// [VvȂ or IĂ false
+	// モーションが一致しない or 終了していたら false
 	if (m_motionType != motionType || m_bFinishMotion)
 	{
 		return false;
 	}
 
-	// ݂̃L[͈͓
+	// 現在のキーが範囲内か
 	if (m_nKey < startKey || m_nKey > endKey)
 	{
 		return false;
 	}
 
-	// ݂̃t[͈͓
-	// iJnL[ƏIL[ȂAstartFrame/endFrameKpj
+	// 現在のフレームが範囲内か
+	// （開始キーと終了キーが同じなら、startFrame/endFrameを適用）
 	if (m_nKey == startKey && m_nCounterMotion < startFrame)
 	{
 		return false;
@@ -619,23 +619,23 @@ bool CMotion::EventMotionRange(int motionType, int startKey, int endKey, int sta
 	return true;
 }
 //=============================================================================
-// [V͈̔(1t[)
+// モーションの範囲(1フレーム)
 //=============================================================================
 bool CMotion::EventMotionRange(int motionType, int Key, int Frame) const
 {
-	// [VvȂ or IĂ false
+	// モーションが一致しない or 終了していたら false
 	if (m_motionType != motionType || m_bFinishMotion)
 	{
 		return false;
 	}
 
-	// ݂̃L[͈͓
+	// 現在のキーが範囲内か
 	if (m_nKey < Key || m_nKey > Key)
 	{
 		return false;
 	}
 
-	// ݂̃t[͈͓
+	// 現在のフレームが範囲内か
 	if (m_nKey == Key && m_nCounterMotion < Frame)
 	{
 		return false;
@@ -648,13 +648,13 @@ bool CMotion::EventMotionRange(int motionType, int Key, int Frame) const
 	return true;
 }
 //=============================================================================
-// [Vis
+// モーション進行率
 //=============================================================================
 float CMotion::GetMotionRate(void) const
 {
 	const MOTION_INFO& info = m_aMotionInfo[m_motionType];
 
-	// S̃t[Zo
+	// 全体フレーム数を算出
 	int totalFrame = 0;
 	for (int i = 0; i < info.nNumKey; i++)
 	{
@@ -666,20 +666,20 @@ float CMotion::GetMotionRate(void) const
 		return 0.0f;
 	}
 
-	// ݂̃L[܂ł̗ݐσt[
+	// 現在のキーまでの累積フレーム数
 	int currentFrame = 0;
 	for (int i = 0; i < m_nKey; i++)
 	{
 		currentFrame += info.aKeyInfo[i].nFrame;
 	}
 
-	currentFrame += m_nCounterMotion; // ݃L[̐isZ
+	currentFrame += m_nCounterMotion; // 現在キー内の進行も加算
 
-	// isԂi0.0 ` 1.0j
+	// 進行率を返す（0.0 ～ 1.0）
 	return (float)currentFrame / (float)totalFrame;
 }
 //=============================================================================
-// [Vt[̎擾
+// モーションフレームの取得
 //=============================================================================
 int CMotion::GetMotionFrame(void)
 {
@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// [V [motion.h]
+// モーション処理 [motion.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _MOTION_H_// ̃}N`ĂȂ
-#define _MOTION_H_// 2dCN[hh~̃}N`
+#ifndef _MOTION_H_// このマクロ定義がされていなかったら
+#define _MOTION_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "model.h"
 
 //*****************************************************************************
-// [VNX
+// モーションクラス
 //*****************************************************************************
 class CMotion
 {
@@ -43,75 +43,75 @@ private:
 	bool FindToken(FILE* f, char* buf, const char* token);
 
 private:
-	static constexpr int MAX_WORD	= 1024;	// ő啶
-	static constexpr int MAX_PARTS	= 32;	// őp[c
-	static constexpr int MAX_KEY	= 256;	// őL[
-	static constexpr int MAX_MOTION = 20;	// [V̍ő吔
+	static constexpr int MAX_WORD	= 1024;	// 最大文字数
+	static constexpr int MAX_PARTS	= 32;	// 最大パーツ数
+	static constexpr int MAX_KEY	= 256;	// 最大キー数
+	static constexpr int MAX_MOTION = 20;	// モーションの最大数
 
 	//*************************************************************************
-	// L[\
+	// キー構造体
 	//*************************************************************************
 	typedef struct
 	{
-		float fPosX;							// ʒu(X)
-		float fPosY;							// ʒu(Y)
-		float fPosZ;							// ʒu(Z)
-		float fRotX;							// (X)
-		float fRotY;							// (Y)
-		float fRotZ;							// (Z)
+		float fPosX;							// 位置(X)
+		float fPosY;							// 位置(Y)
+		float fPosZ;							// 位置(Z)
+		float fRotX;							// 向き(X)
+		float fRotY;							// 向き(Y)
+		float fRotZ;							// 向き(Z)
 	}KEY;
 
 	//*************************************************************************
-	// Ԋ֐(ʒu)
+	// 補間関数(位置)
 	//*************************************************************************
 	inline D3DXVECTOR3 LerpPos(const KEY& a, const KEY& b, float t);
 
 	//*************************************************************************
-	// Ԋ֐()
+	// 補間関数(向き)
 	//*************************************************************************
 	inline D3DXVECTOR3 LerpRot(const KEY& a, const KEY& b, float t);
 
 	//*************************************************************************
-	// L[̍\
+	// キー情報の構造体
 	//*************************************************************************
 	typedef struct
 	{
-		int nFrame;								// Đt[
-		KEY aKey[MAX_PARTS];					// ep[c̃L[vf
+		int nFrame;								// 再生フレーム
+		KEY aKey[MAX_PARTS];					// 各パーツのキー要素
 	}KEY_INFO;
 	void ParseKeySet(FILE* f, char* buf, KEY_INFO& keyInfo);
 	void ParseKey(FILE* f, char* buf, KEY_INFO& keyInfo,
 		int& posIdx, int& rotIdx);
 
 	//*************************************************************************
-	// [V̍\
+	// モーション情報の構造体
 	//*************************************************************************
 	typedef struct
 	{
-		bool	 bLoop;							// [v邩ǂ
-		int		 nNumKey;						// L[̑
-		KEY_INFO aKeyInfo[MAX_KEY];				// L[
-		int		 startKey, startFrame;			// L[̊JnEIt[
+		bool	 bLoop;							// ループするかどうか
+		int		 nNumKey;						// キーの総数
+		KEY_INFO aKeyInfo[MAX_KEY];				// キー情報
+		int		 startKey, startFrame;			// キーの開始・終了フレーム
 	}MOTION_INFO;
 
-	MOTION_INFO m_aMotionInfo[MAX_MOTION];		// [V
-	int			m_motionType;					// [V̎
-	int			m_nNumMotion;					// [V
-	bool		m_bLoopMotion;					// [v邩ǂ
-	int			m_nNumKey;						// L[̑
-	int			m_nKey;							// ݂̃L[No.
-	int			m_nCounterMotion;				// [ṼJE^[
-	bool		m_bFinishMotion;				// ݂̃[VIĂ邩ǂ
-	bool		m_bBlendMotion;					// uh[V邩ǂ
-	int			m_motionTypeBlend;				// uh[V邩ǂ
-	bool		m_bLoopMotionBlend;				// uh[V[v邩ǂ
-	int			m_nNumKeyBlend;					// uh[ṼL[
-	int			m_nKeyBlend;					// uh[V݂̌̃L[No.
-	int			m_nCounterMotionBlend;			// uh[ṼJE^[
-	int			m_nFrameBlend;					// uh̃t[(t[ăuh邩)
-	int			m_nCounterBlend;				// uhJE^[
-	float		m_motionSpeedRate;				// [VXs[h
-	float		m_motionCounterAcc;				// isp
+	MOTION_INFO m_aMotionInfo[MAX_MOTION];		// モーション情報
+	int			m_motionType;					// モーションの種類
+	int			m_nNumMotion;					// モーション総数
+	bool		m_bLoopMotion;					// ループするかどうか
+	int			m_nNumKey;						// キーの総数
+	int			m_nKey;							// 現在のキーNo.
+	int			m_nCounterMotion;				// モーションのカウンター
+	bool		m_bFinishMotion;				// 現在のモーションが終了しているかどうか
+	bool		m_bBlendMotion;					// ブレンドモーションがあるかどうか
+	int			m_motionTypeBlend;				// ブレンドモーションがあるかどうか
+	bool		m_bLoopMotionBlend;				// ブレンドモーションがループするかどうか
+	int			m_nNumKeyBlend;					// ブレンドモーションのキー数
+	int			m_nKeyBlend;					// ブレンドモーションの現在のキーNo.
+	int			m_nCounterMotionBlend;			// ブレンドモーションのカウンター
+	int			m_nFrameBlend;					// ブレンドのフレーム数(何フレームかけてブレンドするか)
+	int			m_nCounterBlend;				// ブレンドカウンター
+	float		m_motionSpeedRate;				// モーションスピード
+	float		m_motionCounterAcc;				// 小数進行用
 };
 
 #endif
\ No newline at end of file
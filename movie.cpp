@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// [r[ [movie.cpp]
+// ムービー処理 [movie.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "movie.h"
 #include "manager.h"
@@ -17,59 +17,65 @@
 #include "dummyPlayer.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-CTime* CMovie::m_pTime = nullptr;					// ^Cւ̃|C^
+CTime* CMovie::m_pTime = nullptr;					// タイムへのポインタ
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CMovie::CMovie() : CScene(CScene::MODE_MOVIE)
 {
-	// l̃NA
-	m_pBlockManager = nullptr;		// ubN}l[W[ւ̃|C^
-	m_pLight		= nullptr;		// Cgւ̃|C^
-	m_timer			= 0;			// ^C}[
-	m_particleTimer = 0;			// p[eBN^C}[
-	m_pDummyPlayer	= nullptr;		// _~[vC[ւ̃|C^
-	m_smokeTimer	= 0;			// ^C}[
-	m_smokeActive	= false;		// o
-	m_delayTime		= 0;			// x
+	// 値のクリア
+	m_pBlockManager = nullptr;		// ブロックマネージャーへのポインタ
+	m_pLight		= nullptr;		// ライトへのポインタ
+	m_timer			= 0;			// タイマー
+	m_particleTimer = 0;			// パーティクル生成タイマー
+	m_pDummyPlayer	= nullptr;		// ダミープレイヤーへのポインタ
+	m_smokeTimer	= 0;			// 煙タイマー
+	m_smokeActive	= false;		// 煙が出たか
+	m_delayTime		= 0;			// 遅延時間
+	m_nLightGeneration = 0;			// 登録した時のライトの世代
+
+	for (int nCnt = 0; nCnt < LIGHT_MAX; nCnt++)
+	{
+		m_anLight[nCnt] = -1;		// 登録したライトの番号
+	}
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CMovie::~CMovie()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CMovie::Init(void)
 {
-	// ubN}l[W[̐
+	// ブロックマネージャーの生成
 	m_pBlockManager = new CBlockManager;
 
-	// ubN}l[W[̏
+	// ブロックマネージャーの初期化
 	m_pBlockManager->Init();
 
-	// Cg̐
+	// ライトの生成
 	m_pLight = new CLight;
 
-	// Cg̏
+	// ライトの初期化
 	m_pLight->Init();
 
-	// Cgݒ菈
+	// ライト設定処理
 	ResetLight();
 
-	// zu̓ǂݍ
+	// 配置情報の読み込み
 	m_pBlockManager->LoadFromJson("data/movie_blockinfo.json");
 
-	// ^C̐
+	// タイムの生成
 	m_pTime = CTime::Create(3, 0, 760.0f, 10.0f, 42.0f, 58.0f, false);
 
-	// _~[vC[̐
+	// ダミープレイヤーの生成
 	m_pDummyPlayer = CDummyPlayer::Create(D3DXVECTOR3(0.0f, 0.0f, 700.0f),
 		D3DXVECTOR3(0.0f, 0.0f, 0.0f), CDummyPlayer::APPEARANCE);
 	m_pDummyPlayer->SetVisibleFlag(false);
@@ -78,13 +84,13 @@ HRESULT CMovie::Init(void)
 	m_delayTime = 120;
 	m_smokeActive = true;
 
-	// bVh[̐
+	// メッシュドームの生成
 	CMeshDome::Create(D3DXVECTOR3(0.0f, 0.0f, 0.0f), 1000);
 
-	// J̎擾
+	// カメラの取得
 	CCamera* pCamera = CManager::GetCamera();
 
-	// [r[J̐ݒ
+	// ムービーカメラの設定
 	pCamera->SetCamMode(CCamera::MODE_MOVIE);
 	std::vector<CCamera::CameraKeyFrame> movie;
 
@@ -117,53 +123,53 @@ HRESULT CMovie::Init(void)
 
 	pCamera->SetMovieCamera(movie);
 
-	// ^[{bNXUI
+	// レターボックスUI生成
 	auto topBar = CUITexture::Create(nullptr, 0.73f, 0.1f, D3DXCOLOR(0.0f, 0.0f, 0.0f, 1.0f), 0.7f, 0.1f);
 	auto bottomBar = CUITexture::Create(nullptr, 0.73f, 1.0f, D3DXCOLOR(0.0f, 0.0f, 0.0f, 1.0f), 0.7f, 0.1f);
 
-	// XLbvUI
+	// スキップUI生成
 	auto skip_xinput = CUITexture::Create("data/TEXTURE/ui_skip_xinput.png", 0.9f, 0.95f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.09f, 0.06f);
 	auto skip_keyboard = CUITexture::Create("data/TEXTURE/ui_skip_keyboard.png", 0.9f, 0.95f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.09f, 0.06f);
 
-	// ^[{bNXUIo^
+	// レターボックスUI登録
 	CUIManager::GetInstance()->AddUI("MovieTopBar", topBar);
 	CUIManager::GetInstance()->AddUI("MovieBottomBar", bottomBar);
 
-	// XLbvUIo^
+	// スキップUI登録
 	CUIManager::GetInstance()->AddUI("Skip_XInput", skip_xinput);
 	CUIManager::GetInstance()->AddUI("Skip_Keyboard", skip_keyboard);
 
-	// UIݒ
+	// UI初期設定
 	skip_xinput->Show();
 	skip_keyboard->Hide();
 	
 	float barHeightPx =
 		CManager::GetRenderer()->GetBackBufferHeight();
 
-	// ^[{bNXXChC
+	// レターボックスをスライドインさせる
 	topBar->SlideIn(D3DXVECTOR3(0.0f, -barHeightPx, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f), 60.0f);
 	bottomBar->SlideIn(D3DXVECTOR3(0.0f, barHeightPx, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f), 60.0f);
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// `[gABGM̍Đ
+	// チュートリアルBGMの再生
 	if (pSound)
 	{
 		pSound->Play(CSound::SOUND_LABEL_TUTORIALBGM);
 	}
 
-	// ʑJڃ^C}[ݒ
+	// 画面遷移タイマーを設定
 	m_timer = FADE_TIME;
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CMovie::Uninit(void)
 {
-	// ubN}l[W[̔j
+	// ブロックマネージャーの破棄
 	if (m_pBlockManager != nullptr)
 	{
 		m_pBlockManager->Uninit();
@@ -172,7 +178,7 @@ void CMovie::Uninit(void)
 		m_pBlockManager = nullptr;
 	}
 
-	// Cg̔j
+	// ライトの破棄
 	if (m_pLight != nullptr)
 	{
 		delete m_pLight;
@@ -180,57 +186,57 @@ void CMovie::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CMovie::Update(void)
 {
 	m_particleTimer++;
 
-	if (m_particleTimer >= BLOSSOM_INTERVAL)// ԊuŐ
-	{// ̐
-		// Zbg
+	if (m_particleTimer >= BLOSSOM_INTERVAL)// 一定間隔で生成
+	{// 桜の生成
+		// リセット
 		m_particleTimer = 0;
 
-		// J̈ʒu擾Ď_ɐ
+		// カメラの位置を取得して視点を基準に生成
 		D3DXVECTOR3 camPosR = CManager::GetCamera()->GetPosR();
 
-		// p[eBN
+		// パーティクル生成
 		CParticle::Create<CBlossomParticle>(INIT_VEC3, camPosR, D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.8f), 0, 1);
 	}
 
-	// ͏̎擾
+	// 入力処理の取得
 	CFade* pFade = CManager::GetFade();
 	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// UI̎擾
+	// UIの取得
 	auto skip_xinput = CUIManager::GetInstance()->GetUI("Skip_XInput");
 	auto skip_keyboard = CUIManager::GetInstance()->GetUI("Skip_Keyboard");
 
-	// ̓foCXɉUI؂ւ
+	// 入力デバイスに応じてUIを切り替える
 	if (pJoypad->GetAnyTrigger() || pJoypad->GetStick())
 	{
-		// L[{[h\OFFɂXInput\
+		// キーボード表示をOFFにしてXInput表示
 		skip_keyboard->Hide();
 
 		skip_xinput->Show();
 	}
 	else if (pKeyboard->GetAnyKeyTrigger())
 	{
-		// XInput\OFFɂăL[{[h\
+		// XInput表示をOFFにしてキーボード表示
 		skip_xinput->Hide();
 
 		skip_keyboard->Show();
 	}
 
-	// ubN}l[W[̍XV
+	// ブロックマネージャーの更新処理
 	m_pBlockManager->Update();
 
-	// XLbv
+	// スキップ
 	if (pFade->GetFade() == CFade::FADE_NONE && 
 		(pKeyboard->GetTrigger(DIK_TAB) || pJoypad->GetTrigger(CInputJoypad::JOYKEY_START)))
 	{
-		// Q[ʂɈڍs
+		// ゲーム画面に移行
 		pFade->SetFade(MODE_GAME);
 	}
 
@@ -244,7 +250,7 @@ void CMovie::Update(void)
 		{
 			D3DXVECTOR3 pos = D3DXVECTOR3(0.0f, 0.0f, 700.0f);
 
-			// Xɏグ
+			// 高さを徐々に上げる
 			pos.y += static_cast<float>(nCnt) * HEIGHT_STEP;
 
 			CParticle::Create<CSmokeParticle>(
@@ -258,30 +264,30 @@ void CMovie::Update(void)
 
 		if (--m_smokeTimer <= 0)
 		{
-			// _~[vC[tOONɂ
+			// ダミープレイヤー可視フラグをONにする
 			m_pDummyPlayer->SetVisibleFlag(true);
 
-			// o[Vɂ
+			// 出現モーションにする
 			m_pDummyPlayer->GetMotion()->StartBlendMotion(CDummyPlayer::APPEARANCE, 10);
 
 			m_smokeActive = false;
 		}
 	}
 
-	// o[VI_bV[Vɂ
+	// 出現モーションが終わったらダッシュモーションにする
 	if (m_pDummyPlayer->GetMotion()->IsCurrentMotionEnd(CDummyPlayer::APPEARANCE))
 	{
-		// ړʂ̐ݒ
+		// 移動量の設定
 		m_pDummyPlayer->SetMove(D3DXVECTOR3(0.0f, 0.0f, -4.0f));
 
-		// _bV[Vɂ
+		// ダッシュモーションにする
 		m_pDummyPlayer->GetMotion()->StartBlendMotion(CDummyPlayer::DUSH, 10);
 	}
 
-	// JEg_E
+	// カウントダウン
 	m_timer--;
 
-	// 莞Ԍo߂ʑJ
+	// 一定時間経過したら画面遷移
 	if (m_timer <= 0)
 	{
 		m_timer = 0;
@@ -289,10 +295,10 @@ void CMovie::Update(void)
 
 		if (pFade->GetFade() == CFade::FADE_NONE)
 		{
-			// U~
+			// 振動停止
 			pJoypad->StopVibration();
 
-			// Q[ʂɈڍs
+			// ゲーム画面に移行
 			pFade->SetFade(MODE_GAME);
 		}
 	}
@@ -302,57 +308,57 @@ void CMovie::Update(void)
 
 	if (pFade->GetFade() == CFade::FADE_NONE && pInputKeyboard->GetTrigger(DIK_RETURN))
 	{
-		// Q[ʂɈڍs
+		// ゲーム画面に移行
 		pFade->SetFade(MODE_GAME);
 	}
 #endif
 
 }
 //=============================================================================
-// Cgݒ菈
+// ライト設定処理(登録済みなら色と向きだけ書き換える)
 //=============================================================================
 void CMovie::ResetLight(void)
 {
-	// CCgF
-	D3DXCOLOR evening(1.0f, 0.65f, 0.35f, 1.0f); // [
+	// メインライト色
+	D3DXCOLOR evening(1.0f, 0.65f, 0.35f, 1.0f); // 夕方
 
-	// ̌
+	// 光の向き
 	D3DXVECTOR3 dirEvening(0.5f, -1.0f, 0.3f);
 
-	// Đݒ
-	CLight::Uninit();
+	// メインライト
+	SetSceneLight(LIGHT_MAIN, evening, dirEvening, D3DXVECTOR3(0.0f, 300.0f, 0.0f));
 
-	// ubN}l[W[̍XV
-	m_pBlockManager->UpdateLight();
+	// サブライト
+	D3DXCOLOR skyEvening(0.4f, 0.45f, 0.8f, 1.0f);
 
-	// CCg
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		evening,
-		dirEvening,
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
+	SetSceneLight(LIGHT_SKY, skyEvening, D3DXVECTOR3(0.0f, -1.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 
-	// TuCg
-	D3DXCOLOR skyEvening(0.4f, 0.45f, 0.8f, 1.0f);
+	// 補助光
+	SetSceneLight(LIGHT_FILL, D3DXCOLOR(0.7f, 0.3f, 0.25f, 1.0f), D3DXVECTOR3(-0.3f, 0.0f, -0.7f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 登録した世代を覚えておく
+	m_nLightGeneration = CLight::GetGeneration();
+
+	// 灯籠などのライトの更新
+	m_pBlockManager->UpdateLight();
+}
+//=============================================================================
+// シーンライトの設定処理(登録は1回だけ行い、以降は色と向きだけ書き換える)
+//=============================================================================
+void CMovie::SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos)
+{
+	// ライトが作り直されていたら登録し直す
+	if (m_anLight[light] < 0 || m_nLightGeneration != CLight::GetGeneration())
+	{
+		m_anLight[light] = CLight::AddLight(D3DLIGHT_DIRECTIONAL, col, dir, pos);
+		return;
+	}
 
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		skyEvening,
-		D3DXVECTOR3(0.0f, -1.0f, 0.0f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
-
-	// ⏕
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.7f, 0.3f, 0.25f, 1.0f),
-		D3DXVECTOR3(-0.3f, 0.0f, -0.7f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
+	CLight::SetLightDiffuse(m_anLight[light], col);
+	CLight::SetLightDirection(m_anLight[light], dir);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CMovie::Draw(void)
 {
@@ -360,25 +366,25 @@ void CMovie::Draw(void)
 
 }
 //=============================================================================
-// foCXZbgʒm
+// デバイスリセット通知
 //=============================================================================
 void CMovie::OnDeviceReset(void)
 {
-	// Cg̐ݒ菈
+	// ライトの設定処理
 	ResetLight();
 }
 //=============================================================================
-// TlC[Xʒm
+// サムネイルリリース通知
 //=============================================================================
 void CMovie::ReleaseThumbnail(void)
 {
 	m_pBlockManager->ReleaseThumbnailRenderTarget();
 }
 //=============================================================================
-// TlCZbgʒm
+// サムネイルリセット通知
 //=============================================================================
 void CMovie::ResetThumbnail(void)
 {
 	m_pBlockManager->InitThumbnailRenderTarget(CManager::GetRenderer()->GetDevice());
-	m_pBlockManager->GenerateThumbnailsForResources(); // LbVč쐬
+	m_pBlockManager->GenerateThumbnailsForResources(); // キャッシュも再作成
 }
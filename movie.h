@@ -1,27 +1,27 @@
 //=============================================================================
 //
-// [r[ [movie.h]
+// ムービー処理 [movie.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _MOVIE_H_// ̃}N`ĂȂ
-#define _MOVIE_H_// 2dCN[hh~̃}N`
+#ifndef _MOVIE_H_// このマクロ定義がされていなかったら
+#define _MOVIE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 #include "blockmanager.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CTime;
 class CLight;
 class CDummyPlayer;
 
 //*****************************************************************************
-// [r[NX
+// ムービークラス
 //*****************************************************************************
 class CMovie : public CScene
 {
@@ -41,20 +41,33 @@ public:
 	static CTime* GetTime(void) { return m_pTime; }
 
 private:
-	static constexpr int	FADE_TIME			= 960;		// ʑJڂ܂ł̎
-	static constexpr int	EFFECT_CREATE_NUM	= 3;		// GtFNg
-	static constexpr float	HEIGHT_STEP			= 30.0f;	// ̑
-	static constexpr int	BLOSSOM_INTERVAL	= 15;		// ̐C^[o
-
-	CBlockManager*	m_pBlockManager;						// ubN}l[W[ւ̃|C^
-	CLight*			m_pLight;								// Cgւ̃|C^
-	static CTime*	m_pTime;								// ^Cւ̃|C^
-	int				m_timer;								// ʑJڃ^C}[
-	int				m_particleTimer;						// p[eBN^C}[
-	CDummyPlayer*	m_pDummyPlayer;							// _~[vC[
-	int				m_smokeTimer;							// 
-	int				m_delayTime;							// ܂ł̒x
-	bool			m_smokeActive;							// tO
+	static constexpr int	FADE_TIME			= 960;		// 画面遷移までの時間
+	static constexpr int	EFFECT_CREATE_NUM	= 3;		// エフェクト生成数
+	static constexpr float	HEIGHT_STEP			= 30.0f;	// 高さの増加量
+	static constexpr int	BLOSSOM_INTERVAL	= 15;		// 桜の生成インターバル
+
+	// ムービーで使うライト
+	typedef enum
+	{
+		LIGHT_MAIN = 0,	// メインライト
+		LIGHT_SKY,		// サブライト
+		LIGHT_FILL,		// 補助光
+		LIGHT_MAX
+	}LIGHT;
+
+	void SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos);
+
+	CBlockManager*	m_pBlockManager;						// ブロックマネージャーへのポインタ
+	CLight*			m_pLight;								// ライトへのポインタ
+	int				m_anLight[LIGHT_MAX];					// 登録したライトの番号
+	unsigned int	m_nLightGeneration;						// 登録した時のライトの世代
+	static CTime*	m_pTime;								// タイムへのポインタ
+	int				m_timer;								// 画面遷移タイマー
+	int				m_particleTimer;						// パーティクル生成タイマー
+	CDummyPlayer*	m_pDummyPlayer;							// ダミープレイヤー
+	int				m_smokeTimer;							// 煙発生時間
+	int				m_delayTime;							// 煙発生までの遅延時間
+	bool			m_smokeActive;							// 煙発生フラグ
 };
 
 #endif
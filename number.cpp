@@ -1,57 +1,69 @@
 //=============================================================================
 //
-// io[ [number.cpp]
+// ナンバー処理 [number.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "number.h"
 #include "renderer.h"
 #include "manager.h"
 #include "easing.h"
+#include "spritebatch.h"
+#include "algorithm"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+int CNumber::m_nNumLayout = 0;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CNumber::CNumber()
 {
-	// l̃NA
-	m_pVtxBuff	= nullptr;	// _obt@ւ̃|C^
-	m_pos		= INIT_VEC3;// ʒu
-	m_col		= INIT_COL;	// F
-	m_digit		= 0;		// 
-	m_fWidth	= 0.0f;		// 
-	m_fHeight	= 0.0f;		// 
-	m_scale		= 0.0f;		// g嗦
-	m_easeTime	= 0.0f;		// ^C}[
-	m_easeSpeed = 0.0f;		// t̐iރXs[h
-	m_isExpanding = false;	// true : g, false : k
+	// 値のクリア
+	memset(m_aVtx, 0, sizeof(m_aVtx));					// 並べた頂点
+	memset(m_anIdxTexture, 0, sizeof(m_anIdxTexture));	// 文字ごとのテクスチャインデックス
+	memset(m_szText, 0, sizeof(m_szText));				// 表示する文字
+	m_nNumGlyph		= 0;			// 並べた文字の数
+	m_nIdxDigit		= -1;			// 数字のテクスチャインデックス
+	m_nIdxColon		= -1;			// コロンのテクスチャインデックス
+	m_pos			= INIT_VEC3;	// 位置
+	m_col			= INIT_COL;		// 色
+	m_fWidth		= 0.0f;			// 幅
+	m_fHeight		= 0.0f;			// 高さ
+	m_scale			= 0.0f;			// 拡大率
+	m_easeTime		= 0.0f;			// タイマー
+	m_easeSpeed		= 0.0f;			// tの進むスピード
+	m_isExpanding	= false;		// true : 拡大, false : 縮小
+	m_bDirty		= true;			// 並びを作り直すか
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CNumber::~CNumber()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CNumber* CNumber::Create(float fposX, float fposY, float fWidth, float fHeight)
 {
-	// IuWFNg̐
+	// オブジェクトの生成
 	CNumber* pNumber = new CNumber;
 
-	// nullptr
+	// nullptrだったら
 	if (pNumber == nullptr)
 	{
 		return nullptr;
 	}
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pNumber->Init(fposX, fposY, fWidth, fHeight)))
 	{
 		return nullptr;
@@ -60,176 +72,263 @@ CNumber* CNumber::Create(float fposX, float fposY, float fWidth, float fHeight)
 	return pNumber;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CNumber::Init(float fposX, float fposY, float fWidth, float fHeight)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// l̕ۑ
+	// 値の保存
 	m_pos = D3DXVECTOR3(fposX, fposY, 0.0f);
 	m_fWidth = fWidth;
 	m_fHeight = fHeight;
 	m_col = D3DCOLOR_ARGB(255, 255, 255, 255);
-	m_digit = 0;
-
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(fposX, fposY, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(fposX + fWidth, fposY, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(fposX, fposY + fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(fposX + fWidth, fposY + fHeight, 0.0f);
-
-	// rhw̐ݒ
-	pVtx[0].rhw = 1.0f;
-	pVtx[1].rhw = 1.0f;
-	pVtx[2].rhw = 1.0f;
-	pVtx[3].rhw = 1.0f;
-
-	// _J[̐ݒ
-	pVtx[0].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[1].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[2].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[3].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-
-	// eNX`W̐ݒ
-	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
-	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
-	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
-	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	m_scale = 1.0f;
+
+	// テクスチャの登録
+	CTexture* pTexture = CManager::GetTexture();
+	m_nIdxDigit = pTexture->RegisterDynamic("data/TEXTURE/num_01.png");
+	m_nIdxColon = pTexture->RegisterDynamic("data/TEXTURE/colon.png");
+
+	// 数字とコロンをアトラスへ入れ、表ごと1回で描けるようにする
+	// (数字は横に10個並んだ画像なので、アトラスの幅に縮めて入れる)
+	CSpriteBatch::RegisterAtlas(m_nIdxDigit, true);
+	CSpriteBatch::RegisterAtlas(m_nIdxColon);
+
+	SetValue(0);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CNumber::Uninit(void)
 {
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
+	// 頂点はまとめ描画側で持つので、テクスチャの参照を外すだけ
+	CTexture* pTexture = CManager::GetTexture();
+	pTexture->Release(m_nIdxDigit);
+	pTexture->Release(m_nIdxColon);
+	m_nIdxDigit = -1;
+	m_nIdxColon = -1;
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CNumber::Update(void)
 {
-	// XP[XVigk[vj
+	// スケール更新（拡大縮小ループ）
 	if (m_easeSpeed != 0.0f)
 	{
-		// Ԃi߂
+		// 時間を進める
 		m_easeTime += (m_isExpanding ? m_easeSpeed : -m_easeSpeed);
 
-		// B  kɐ؂ւ
+		// 上限到達 → 縮小に切り替え
 		if (m_easeTime >= 1.0f)
 		{
 			m_easeTime = 1.0f;
 			m_isExpanding = false;
 		}
 
-		// B  gɐ؂ւ
+		// 下限到達 → 拡大に切り替え
 		if (m_easeTime <= 0.0f)
 		{
 			m_easeTime = 0.0f;
 			m_isExpanding = true;
 		}
 
-		// C[WOKp
+		// イージング適用
 		m_scale = CEasing::Ease(1.0f, MAX_SCALE, m_easeTime, CEasing::EaseInOutSine);
 	}
 	else
 	{
 		m_scale = 1.0f;
 	}
+}
+//=============================================================================
+// 描画処理
+//=============================================================================
+void CNumber::Draw(void)
+{
+	// 値・位置・大きさが変わった時だけ並べ直す
+	if (m_bDirty)
+	{
+		Layout();
+	}
 
-	// UVvZi110̏ꍇj
-	const float digitWidthUV = 1.0f / 10.0f;
-	float tu = m_digit * digitWidthUV;
-	float tu2 = tu + digitWidthUV;
-
-	VERTEX_2D* pVtx;
+	for (int nCnt = 0; nCnt < m_nNumGlyph; nCnt++)
+	{
+		const VERTEX_2D* pVtx = m_aVtx[nCnt];
 
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+		if (m_scale == 1.0f)
+		{
+			// まとめ描画に積む
+			CSpriteBatch::Submit(pVtx, m_anIdxTexture[nCnt]);
+			continue;
+		}
 
-	// _W scale 𔽉fiSgj
-	float w = m_fWidth * m_scale;
-	float h = m_fHeight * m_scale;
-	float cx = m_pos.x + m_fWidth * 0.5f;
-	float cy = m_pos.y + m_fHeight * 0.5f;
+		// 拡大中は文字ごとに中心で拡大する
+		float cx = (pVtx[0].pos.x + pVtx[3].pos.x) * 0.5f;
+		float cy = (pVtx[0].pos.y + pVtx[3].pos.y) * 0.5f;
 
-	pVtx[0].pos = D3DXVECTOR3(cx - w * 0.5f, cy - h * 0.5f, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(cx + w * 0.5f, cy - h * 0.5f, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(cx - w * 0.5f, cy + h * 0.5f, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(cx + w * 0.5f, cy + h * 0.5f, 0.0f);
+		VERTEX_2D aVtx[4];
 
-	// UVW̍XVieNX`̈ꕔ𐔎Ƃɐ؂ւj
-	pVtx[0].tex = D3DXVECTOR2(tu, 0.0f);   // 
-	pVtx[1].tex = D3DXVECTOR2(tu2, 0.0f);  // E
-	pVtx[2].tex = D3DXVECTOR2(tu, 1.0f);   // 
-	pVtx[3].tex = D3DXVECTOR2(tu2, 1.0f);  // E
+		for (int nCntVtx = 0; nCntVtx < 4; nCntVtx++)
+		{
+			aVtx[nCntVtx] = pVtx[nCntVtx];
+			aVtx[nCntVtx].pos.x = cx + (pVtx[nCntVtx].pos.x - cx) * m_scale;
+			aVtx[nCntVtx].pos.y = cy + (pVtx[nCntVtx].pos.y - cy) * m_scale;
+		}
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+		// まとめ描画に積む
+		CSpriteBatch::Submit(aVtx, m_anIdxTexture[nCnt]);
+	}
 }
 //=============================================================================
-// `揈
+// 並びの作成処理
 //=============================================================================
-void CNumber::Draw(void)
+void CNumber::Layout(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	const float digitWidthUV = 1.0f / NUM_CELL;
+	float fX = m_pos.x;
+
+	m_nNumGlyph = 0;
 
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
+	for (const char* pChar = m_szText; *pChar != '\0'; pChar++)
+	{
+		VERTEX_2D* pVtx = m_aVtx[m_nNumGlyph];
+
+		if (*pChar >= '0' && *pChar <= '9')
+		{// 数字(10分割の画像の1マス)
+			float tu = (*pChar - '0') * digitWidthUV;
+
+			CSpriteBatch::SetRect(pVtx, fX, m_pos.y, fX + m_fWidth, m_pos.y + m_fHeight);
+			CSpriteBatch::SetTexRect(pVtx, tu, 0.0f, tu + digitWidthUV, 1.0f);
+			CSpriteBatch::SetColor(pVtx, m_col);
 
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_2D);
+			m_anIdxTexture[m_nNumGlyph] = m_nIdxDigit;
+			m_nNumGlyph++;
+
+			fX += m_fWidth;
+		}
+		else if (*pChar == ':')
+		{// コロン
+			float fColonWidth = m_fWidth * COLON_RATE;
 
-	// |S̕`
-	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
+			CSpriteBatch::SetRect(pVtx, fX, m_pos.y, fX + fColonWidth, m_pos.y + m_fHeight);
+			CSpriteBatch::SetTexRect(pVtx, 0.0f, 0.0f, 1.0f, 1.0f);
+			CSpriteBatch::SetColor(pVtx, m_col);
 
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, nullptr);
+			m_anIdxTexture[m_nNumGlyph] = m_nIdxColon;
+			m_nNumGlyph++;
+
+			fX += fColonWidth;
+		}
+		else
+		{// 空白
+			fX += m_fWidth;
+		}
+	}
+
+	m_bDirty = false;
+	m_nNumLayout++;
 }
 //=============================================================================
-// ݒ菈
+// 文字の設定処理(前と同じなら並べ直さない)
 //=============================================================================
-void CNumber::SetDigit(int digit)
+void CNumber::SetText(const char* pText)
 {
-	// ͈̓`FbN
-	if (digit < 0 || digit > 9)
+	if (strncmp(m_szText, pText, MAX_GLYPH) == 0)
 	{
-		digit = 0;
+		return;
 	}
 
-	m_digit = digit;
+	strncpy_s(m_szText, sizeof(m_szText), pText, MAX_GLYPH);
+	m_bDirty = true;
 }
 //=============================================================================
-// XP[Aj[Vݒ菈
+// 値の設定処理(nMinDigitの桁までは0で埋める)
+//=============================================================================
+void CNumber::SetValue(int nValue, int nMinDigit)
+{
+	char szText[MAX_GLYPH + 1];
+
+	// 範囲チェック
+	if (nValue < 0)
+	{
+		nValue = 0;
+	}
+
+	sprintf_s(szText, sizeof(szText), "%0*d", nMinDigit, nValue);
+
+	SetText(szText);
+}
+//=============================================================================
+// 時間の設定処理(mm:ss)
+//=============================================================================
+void CNumber::SetTime(int nMinutes, int nSeconds)
+{
+	char szText[MAX_GLYPH + 1];
+
+	// 範囲チェック
+	nMinutes = std::max(0, std::min(nMinutes, 99));
+	nSeconds = std::max(0, std::min(nSeconds, 59));
+
+	sprintf_s(szText, sizeof(szText), "%02d:%02d", nMinutes, nSeconds);
+
+	SetText(szText);
+}
+//=============================================================================
+// 位置の設定処理
+//=============================================================================
+void CNumber::SetPos(D3DXVECTOR3 pos)
+{
+	if (pos != m_pos)
+	{
+		m_pos = pos;
+		m_bDirty = true;
+	}
+}
+//=============================================================================
+// 大きさの設定処理
+//=============================================================================
+void CNumber::SetSize(float w, float h)
+{
+	if (w != m_fWidth || h != m_fHeight)
+	{
+		m_fWidth = w;
+		m_fHeight = h;
+		m_bDirty = true;
+	}
+}
+//=============================================================================
+// 色の設定処理
+//=============================================================================
+void CNumber::SetColor(D3DCOLOR col)
+{
+	if (col != m_col)
+	{
+		m_col = col;
+		m_bDirty = true;
+	}
+}
+//=============================================================================
+// スケールアニメーション設定処理
 //=============================================================================
 void CNumber::SetScaleAnim(void)
 {
-	m_easeTime = 0.0f;       // Aj[VJnʒu
-	m_isExpanding = true;    // g
-	m_easeSpeed = 0.03f;     // t ̑ʁixj
+	m_easeTime = 0.0f;       // アニメーション開始位置
+	m_isExpanding = true;    // 拡大
+	m_easeSpeed = 0.03f;     // t の増加量（速度）
+}
+//=============================================================================
+// 並べた時の幅の取得
+//=============================================================================
+float CNumber::GetWidth(void) const
+{
+	float fTotal = 0.0f;
+
+	for (const char* pChar = m_szText; *pChar != '\0'; pChar++)
+	{
+		fTotal += (*pChar == ':') ? m_fWidth * COLON_RATE : m_fWidth;
+	}
+
+	return fTotal;
 }
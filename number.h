@@ -1,18 +1,18 @@
 //=============================================================================
 //
-// io[ [number.h]
+// ナンバー処理 [number.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _NUMBER_H_// ̃}N`ĂȂ
-#define _NUMBER_H_// 2dCN[hh~̃}N`
+#ifndef _NUMBER_H_// このマクロ定義がされていなかったら
+#define _NUMBER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 //*****************************************************************************
-// io[NX
+// ナンバークラス(数字の並びを1つで持ち、値が変わった時だけ並びを作り直す)
 //*****************************************************************************
 class CNumber
 {
@@ -25,23 +25,44 @@ public:
 	void Uninit(void);
 	void Update(void);
 	void Draw(void);
-	void SetDigit(int digit);
-	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
+	void SetValue(int nValue, int nMinDigit = 1);
+	void SetTime(int nMinutes, int nSeconds);
+	void SetPos(D3DXVECTOR3 pos);
+	void SetSize(float w, float h);
+	void SetColor(D3DCOLOR col);
 	void SetScaleAnim(void);
-	void SetSize(float w, float h) { m_fWidth = w; m_fHeight = h; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	float GetWidth(void) const;
+	static int GetNumLayout(void) { return m_nNumLayout; }
+
 private:
-	static constexpr float MAX_SCALE = 1.3f;// őg嗦
-
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@ւ̃|C^
-	D3DXVECTOR3				m_pos;			// ʒu
-	D3DCOLOR				m_col;			// F
-	int						m_digit;		// 
-	float					m_fWidth;		// 
-	float					m_fHeight;		// 
-	float					m_scale;		// g嗦
-	float					m_easeTime;		// ^C}[
-	float					m_easeSpeed;	// t̐iރXs[h
-	bool					m_isExpanding;	// true : g, false : k
+	static constexpr float	MAX_SCALE		= 1.3f;	// 最大拡大率
+	static constexpr int	MAX_GLYPH		= 16;	// 並べられる文字の数
+	static constexpr int	NUM_CELL		= 10;	// 数字の画像の分割数
+	static constexpr float	COLON_RATE		= 0.5f;	// 数字の幅に対してのコロンの幅
+
+	void SetText(const char* pText);
+	void Layout(void);
+
+	VERTEX_2D	m_aVtx[MAX_GLYPH][4];		// 並べた頂点(拡大前)
+	int			m_anIdxTexture[MAX_GLYPH];	// 文字ごとのテクスチャインデックス
+	char		m_szText[MAX_GLYPH + 1];	// 表示する文字('0'～'9'、':'、' ')
+	int			m_nNumGlyph;				// 並べた文字の数
+	int			m_nIdxDigit;				// 数字のテクスチャインデックス
+	int			m_nIdxColon;				// コロンのテクスチャインデックス
+	D3DXVECTOR3	m_pos;						// 位置(左上)
+	D3DCOLOR	m_col;						// 色
+	float		m_fWidth;					// 数字1桁の幅
+	float		m_fHeight;					// 高さ
+	float		m_scale;					// 拡大率
+	float		m_easeTime;					// タイマー
+	float		m_easeSpeed;				// tの進むスピード
+	bool		m_isExpanding;				// true : 拡大, false : 縮小
+	bool		m_bDirty;					// 並びを作り直すか
+	static int	m_nNumLayout;				// 並びを作り直した回数(確認用)
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,34 +1,41 @@
 //=============================================================================
 //
-// IuWFNg [object.cpp]
+// オブジェクト処理 [object.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "camera.h"
 #include "manager.h"
 #include "game.h"
+#include "shadowS.h"
+#include "particlesystem.h"
+#include "ripplesystem.h"
+#include "billboardrenderer.h"
+#include "spritebatch.h"
+#include "debugproc3D.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 CObject* CObject::m_apTop[MAX_OBJ_PRIORITY] = {};
 CObject* CObject::m_apCur[MAX_OBJ_PRIORITY] = {};
 int CObject::m_nNumAll = 0;
+int CObject::m_anNumPriority[MAX_OBJ_PRIORITY] = {};
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CObject::CObject(int nPriority)
 {
 	m_nPriority = 0;
 	m_type = TYPE_NONE;
 
-	// IuWFNg()Xgɒǉ
+	// オブジェクト(自分)をリストに追加
 	m_pPrev = m_apCur[nPriority];
 
 	if (m_pPrev != nullptr)
@@ -46,18 +53,19 @@ CObject::CObject(int nPriority)
 	m_apCur[nPriority] = this;
 
 	m_nNumAll++;
+	m_anNumPriority[nPriority]++;
 	m_nPriority = nPriority;
 	m_bDeath = false;
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CObject::~CObject()
 {
-	// ͂Ȃ
+	// 今はなし
 }
 //=============================================================================
-// SẴIuWFNg̔j
+// 全てのオブジェクトの破棄
 //=============================================================================
 void CObject::ReleaseAll(void)
 {
@@ -67,20 +75,20 @@ void CObject::ReleaseAll(void)
 
 		while (pObject != nullptr)
 		{
-			CObject* pObjectNext = pObject->m_pNext;// ̃IuWFNgۑ
+			CObject* pObjectNext = pObject->m_pNext;// 次のオブジェクトを保存
 
-			// I
+			// 終了処理
 			pObject->Uninit();
 
-			// IuWFNg̃Xg폜Ɣj
+			// オブジェクトのリスト削除と破棄
 			pObject->Destroy();
 
-			pObject = pObjectNext;// ̃IuWFNg
+			pObject = pObjectNext;// 次のオブジェクトを代入
 		}
 	}
 }
 //=============================================================================
-// SẴIuWFNg̍XV
+// 全てのオブジェクトの更新処理
 //=============================================================================
 void CObject::UpdateAll(void)
 {
@@ -90,15 +98,15 @@ void CObject::UpdateAll(void)
 
 		while (pObject != nullptr)
 		{
-			CObject* pObjectNext = pObject->m_pNext;// ̃IuWFNgۑ
+			CObject* pObjectNext = pObject->m_pNext;// 次のオブジェクトを保存
 
 			if (!pObject->m_bDeath)
 			{
-				// XV
+				// 更新処理
 				pObject->Update();
 			}
 
-			pObject = pObjectNext;// ̃IuWFNg
+			pObject = pObjectNext;// 次のオブジェクトを代入
 		}
 	}
 
@@ -108,94 +116,161 @@ void CObject::UpdateAll(void)
 
 		while (pObject != nullptr)
 		{
-			CObject* pObjectNext = pObject->m_pNext;// ̃IuWFNgۑ
+			CObject* pObjectNext = pObject->m_pNext;// 次のオブジェクトを保存
 
 			if (pObject->m_bDeath)
 			{
-				// IuWFNg̃Xg폜Ɣj
+				// オブジェクトのリスト削除と破棄
 				pObject->Destroy();
 			}
 
-			pObject = pObjectNext;// ̃IuWFNg
+			pObject = pObjectNext;// 次のオブジェクトを代入
 		}
 	}
 
+	// パーティクルの更新処理
+	CParticleSystem::Update();
+
+	// 波紋の更新処理
+	CRippleSystem::Update();
 }
 //=============================================================================
-// SẴIuWFNg̕`揈
+// 全てのオブジェクトの描画処理
 //=============================================================================
 void CObject::DrawAll(void)
 {
-	// ubN̓蔻̕`
+	// ブロックの当たり判定の描画
 	CGame::GetBlockManager()->Draw();
 
+	// 静的ブロックのインスタンス描画
+	CBlockManager::DrawInstances();
+
+	// 描画キューの取得
+	CRenderQueue* pQueue = CManager::GetRenderer()->GetRenderQueue();
+
+	// ビルボードと2Dスプライトの描画数を締める
+	CBillboardRenderer::BeginFrame();
+	CSpriteBatch::BeginFrame();
+	CDebugProc3D::BeginFrame();
+
 	for (int nPriority = 0; nPriority < MAX_OBJ_PRIORITY; nPriority++)
 	{
 		CObject* pObject = m_apTop[nPriority];
 
 		while (pObject != nullptr)
 		{
-			CObject* pObjectNext = pObject->m_pNext;// ̃IuWFNgۑ
+			CObject* pObjectNext = pObject->m_pNext;// 次のオブジェクトを保存
 
-			// `揈
+			// キューに積まないオブジェクトの前に溜まっている分を描画して順番を守る
+			if (!pObject->IsRenderQueued())
+			{
+				pQueue->Flush();
+			}
+
+			// 描画処理
 			pObject->Draw();
 
-			pObject = pObjectNext;// ̃IuWFNg
+			pObject = pObjectNext;// 次のオブジェクトを代入
+		}
+
+		// 優先順位ごとに描画しきる
+		pQueue->Flush();
+
+		// 積んだビルボードもまとめて描く
+		CBillboardRenderer::Flush();
+
+		// 積んだ2Dスプライトもまとめて描く
+		CSpriteBatch::Flush();
+
+		// ステンシルシャドウは優先順位の最後にまとめて描く
+		if (nPriority == CShadowS::PRIORITY)
+		{
+			CShadowS::DrawBatch();
+		}
+
+		// パーティクルは優先順位の最後にまとめて描く
+		if (nPriority == CParticleSystem::PRIORITY)
+		{
+			CParticleSystem::Draw();
+		}
+
+		// 波紋も優先順位の最後にまとめて描く
+		if (nPriority == CRippleSystem::PRIORITY)
+		{
+			CRippleSystem::Draw();
+		}
+
+		// デバッグ表示の線は3Dの優先順位の最後にまとめて描く
+		if (nPriority == CDebugProc3D::PRIORITY)
+		{
+			CDebugProc3D::Flush();
 		}
 	}
 }
 //=============================================================================
-// IuWFNg̔jtOݒ
+// オブジェクトの破棄フラグ設定
 //=============================================================================
 void CObject::Release(void)
 {
 	m_bDeath = true;
 }
 //=============================================================================
-// IuWFNg̑̎擾
+// オブジェクトの総数の取得
 //=============================================================================
 int CObject::GetNumObject(void)
 {
 	return m_nNumAll;
 }
 //=============================================================================
-// ^Cv̐ݒ菈
+// 優先順位ごとのオブジェクト数の取得
+//=============================================================================
+int CObject::GetNumObject(int nPriority)
+{
+	if (nPriority < 0 || nPriority >= MAX_OBJ_PRIORITY)
+	{
+		return 0;
+	}
+
+	return m_anNumPriority[nPriority];
+}
+//=============================================================================
+// タイプの設定処理
 //=============================================================================
 void CObject::SetType(TYPE type)
 {
 	m_type = type;
 }
 //=============================================================================
-// ^Cv̎擾
+// タイプの取得
 //=============================================================================
 CObject::TYPE CObject::GetType(void)
 {
 	return m_type;
 }
 //=============================================================================
-// IuWFNg̃Xg폜Ɣj
+// オブジェクトのリスト削除と破棄
 //=============================================================================
 void CObject::Destroy(void)
 {
 	int nPriority = this->m_nPriority;
 
 	if (m_pPrev != nullptr && m_pNext != nullptr)
-	{// ԂƂ
+	{// 間を消したとき
 		m_pNext->m_pPrev = m_pPrev;
 		m_pPrev->m_pNext = m_pNext;
 	}
 	else if (m_pPrev == nullptr && m_pNext != nullptr)
-	{// 擪Ƃ
+	{// 先頭を消したとき
 		m_pNext->m_pPrev = nullptr;
 		m_apTop[nPriority] = m_pNext;
 	}
 	else if (m_pPrev != nullptr && m_pNext == nullptr)
-	{// ŌƂ
+	{// 最後尾を消したとき
 		m_pPrev->m_pNext = nullptr;
 		m_apCur[nPriority] = m_pPrev;
 	}
 	else if (m_pPrev == nullptr && m_pNext == nullptr)
-	{// B̗vfꍇ
+	{// 唯一の要素だった場合
 		m_apTop[nPriority] = nullptr;
 		m_apCur[nPriority] = nullptr;
 	}
@@ -204,6 +279,7 @@ void CObject::Destroy(void)
 	m_pNext = nullptr;
 
 	m_nNumAll--;
+	m_anNumPriority[nPriority]--;
 
 	delete this;
 }
\ No newline at end of file
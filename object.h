@@ -1,15 +1,15 @@
 //=============================================================================
 //
-// IuWFNg [object.h]
+// オブジェクト処理 [object.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _OBJECT_H_// ̃}N`ĂȂ
-#define _OBJECT_H_// 2dCN[hh~̃}N`
+#ifndef _OBJECT_H_// このマクロ定義がされていなかったら
+#define _OBJECT_H_// 2重インクルード防止のマクロ定義
 
 
 //*****************************************************************************
-// IuWFNgNX
+// オブジェクトクラス
 //*****************************************************************************
 class CObject
 {
@@ -17,7 +17,7 @@ public:
 	CObject(int nPriority = 3);
 	virtual ~CObject();
 
-	// IuWFNg̎
+	// オブジェクトの種類
 	typedef enum
 	{
 		TYPE_NONE = 0,
@@ -33,25 +33,28 @@ public:
 	static void UpdateAll(void);
 	static void DrawAll(void);
 	static int GetNumObject(void);
+	static int GetNumObject(int nPriority);
 	void SetType(TYPE type);
 	TYPE GetType(void);
 	void Destroy(void);
 	bool GetDeath(void) { return m_bDeath; }
+	virtual bool IsRenderQueued(void) const { return false; }	// 描画キューに積むオブジェクトか
 
 protected:
 	void Release(void);
 
 private:
-	static constexpr int MAX_OBJ_PRIORITY = 8;	// D揇
-
-	static CObject* m_apTop[MAX_OBJ_PRIORITY];	// 擪̃IuWFNgւ̃|C^
-	static CObject* m_apCur[MAX_OBJ_PRIORITY];	// Ō̃IuWFNgւ̃|C^
-	CObject*		m_pPrev;					// ÕIuWFNgւ̃|C^
-	CObject*		m_pNext;					// ̃IuWFNgւ̃|C^
-	static int		m_nNumAll;					// IuWFNg̑
-	TYPE			m_type;						// 
-	int				m_nPriority;				// D揇ʂ̈ʒu
-	bool			m_bDeath;					// StO
+	static constexpr int MAX_OBJ_PRIORITY = 8;	// 優先順位
+
+	static CObject* m_apTop[MAX_OBJ_PRIORITY];	// 先頭のオブジェクトへのポインタ
+	static CObject* m_apCur[MAX_OBJ_PRIORITY];	// 最後尾のオブジェクトへのポインタ
+	CObject*		m_pPrev;					// 前のオブジェクトへのポインタ
+	CObject*		m_pNext;					// 次のオブジェクトへのポインタ
+	static int		m_nNumAll;					// オブジェクトの総数
+	static int		m_anNumPriority[MAX_OBJ_PRIORITY];// 優先順位ごとのオブジェクト数
+	TYPE			m_type;						// 種類
+	int				m_nPriority;				// 優先順位の位置
+	bool			m_bDeath;					// 死亡フラグ
 };
 
 #endif
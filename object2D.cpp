@@ -1,56 +1,59 @@
 //=============================================================================
 //
-// 2DIuWFNg [object2D.cpp]
+// 2Dオブジェクト処理 [object2D.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object2D.h"
 #include "manager.h"
 #include "renderer.h"
+#include "spritebatch.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CObject2D::CObject2D(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_pVtxBuff	   = nullptr;						// _obt@
-	m_pos		   = INIT_VEC3;						// ʒu
-	m_rot		   = INIT_VEC3;						// 
-	m_move		   = INIT_VEC3;						// ړ
-	m_col		   = D3DCOLOR_ARGB(255, 0, 0, 0);	// F
-	m_fLength	   = 0.0f;							// 
-	m_fAngle	   = 0.0f;							// px
-	m_fWidth	   = 0.0f;							// 
-	m_fHeight	   = 0.0f;							// 
-	m_nCounterAnim = 0;								// Aj[VJE^[
-	m_nPatternAnim = 0;								// Aj[Vp^[No.
-	m_fUSpeed	   = 0.0f;							// ̃XN[Xs[h
-	m_fVSpeed	   = 0.0f;							// c̃XN[Xs[h
-	m_aPosTexU	   = 0.0f;							// ̃XN[pϐ
-	m_fTexU		   = 0.0f;							// eNX`UV
-	m_fTexV		   = 0.0f;							// eNX`UV
+	// 値のクリア
+	memset(m_aVtx, 0, sizeof(m_aVtx));				// 頂点
+	m_pos		   = INIT_VEC3;						// 位置
+	m_rot		   = INIT_VEC3;						// 向き
+	m_move		   = INIT_VEC3;						// 移動量
+	m_col		   = D3DCOLOR_ARGB(255, 0, 0, 0);	// 色
+	m_fLength	   = 0.0f;							// 長さ
+	m_fAngle	   = 0.0f;							// 角度
+	m_fWidth	   = 0.0f;							// 幅
+	m_fHeight	   = 0.0f;							// 高さ
+	m_nCounterAnim = 0;								// アニメーションカウンター
+	m_nPatternAnim = 0;								// アニメーションパターンNo.
+	m_fUSpeed	   = 0.0f;							// 横のスクロールスピード
+	m_fVSpeed	   = 0.0f;							// 縦のスクロールスピード
+	m_aPosTexU	   = 0.0f;							// 横のスクロール用変数
+	m_fTexU		   = 0.0f;							// テクスチャUV
+	m_fTexV		   = 0.0f;							// テクスチャUV
+	m_nIdxTexture  = -1;							// テクスチャインデックス
+	m_nLayer	   = 0;								// 重ね順
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CObject2D::~CObject2D()
 {
-	// ͂Ȃ
+	// 今はなし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CObject2D* CObject2D::Create(D3DXVECTOR3 pos, D3DXCOLOR col, float fWidth, float fHeight)
 {
-	// IuWFNg̐
+	// オブジェクトの生成
 	CObject2D* pObject2D = new CObject2D;
 
-	// nullptr
+	// nullptrだったら
 	if (pObject2D == nullptr)
 	{
 		return nullptr;
@@ -60,7 +63,7 @@ CObject2D* CObject2D::Create(D3DXVECTOR3 pos, D3DXCOLOR col, float fWidth, float
 	pObject2D->SetSize(fWidth, fHeight);
 	pObject2D->SetCol(col);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pObject2D->Init()))
 	{
 		return nullptr;
@@ -69,87 +72,60 @@ CObject2D* CObject2D::Create(D3DXVECTOR3 pos, D3DXCOLOR col, float fWidth, float
 	return pObject2D;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CObject2D::Init(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
+	// 頂点座標の設定
 	pVtx[0].pos = D3DXVECTOR3(m_pos.x - m_fWidth, m_pos.y - m_fHeight, 0.0f);
 	pVtx[1].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y - m_fHeight, 0.0f);
 	pVtx[2].pos = D3DXVECTOR3(m_pos.x - m_fWidth, m_pos.y + m_fHeight, 0.0f);
 	pVtx[3].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y + m_fHeight, 0.0f);
 
-	// rhw̐ݒ
+	// rhwの設定
 	pVtx[0].rhw = 1.0f;
 	pVtx[1].rhw = 1.0f;
 	pVtx[2].rhw = 1.0f;
 	pVtx[3].rhw = 1.0f;
 
-	// _J[̐ݒ
+	// 頂点カラーの設定
 	pVtx[0].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 	pVtx[1].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 	pVtx[2].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 	pVtx[3].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 
-	// eNX`W̐ݒ
+	// テクスチャ座標の設定
 	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
 	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
 	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
 	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CObject2D::Uninit(void)
 {
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
-
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CObject2D::Update()
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// Ίp̒Zo
+	// 対角線の長さを算出する
 	m_fLength = sqrtf(m_fWidth * m_fWidth + m_fHeight * m_fHeight);
 
-	// Ίp̊pxZo
+	// 対角線の角度を算出する
 	m_fAngle = atan2f(m_fWidth, m_fHeight);
 
-	// _W̐ݒ
+	// 頂点座標の設定
 	pVtx[0].pos.x = m_pos.x + sinf(m_rot.z + (D3DX_PI + m_fAngle)) * m_fLength;
 	pVtx[0].pos.y = m_pos.y + cosf(m_rot.z + (D3DX_PI + m_fAngle)) * m_fLength;
 	pVtx[0].pos.z = 0.0f;
@@ -170,134 +146,92 @@ void CObject2D::Update()
 	pVtx[1].col = m_col;
 	pVtx[2].col = m_col;
 	pVtx[3].col = m_col;
-
-	//_obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CObject2D::Draw(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_2D);
-
-	// |S̕`
-	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, nullptr);
+	// CSpriteBatchに積み、優先順位の最後にまとめて描く
+	CSpriteBatch::Submit(m_aVtx, m_nIdxTexture, m_nLayer);
 }
 //=============================================================================
-// eNX`UV̐ݒ
+// テクスチャUVの設定
 //=============================================================================
 void CObject2D::SetUV(int nTexU, int nTexV)
 {
 	m_fTexU = 1.0f / nTexU;
 	m_fTexV = 1.0f / nTexV;
 
-	VERTEX_2D* pVtx;// _ւ̃|C^
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// eNX`W̐ݒ
+	// テクスチャ座標の設定
 	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
 	pVtx[1].tex = D3DXVECTOR2(m_fTexU, 0.0f);
 	pVtx[2].tex = D3DXVECTOR2(0.0f, m_fTexV);
 	pVtx[3].tex = D3DXVECTOR2(m_fTexU, m_fTexV);
-
-	//_obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// eNX`UVړ
+// テクスチャUV移動処理
 //=============================================================================
 void CObject2D::MoveTexUV(float fLeft, float fTop, float fWidth, float fHeight)
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
 	pVtx[0].tex = D3DXVECTOR2(fLeft, fTop);
 	pVtx[1].tex = D3DXVECTOR2(fLeft + fWidth, fTop);
 	pVtx[2].tex = D3DXVECTOR2(fLeft, fTop + fHeight);
 	pVtx[3].tex = D3DXVECTOR2(fLeft + fWidth, fTop + fHeight);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// ʏeNX`Aj[V
+// 通常テクスチャアニメーション処理
 //=============================================================================
 void CObject2D::TextureAnim(int nTexPosX, int nTexPosY, int nAnimSpeed)
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
 	float UV1 = 1.0f / nTexPosX;
 	float UV2 = 1.0f / nTexPosY;
 
-	m_nCounterAnim++;// JE^[Z
+	m_nCounterAnim++;// カウンターを加算
 
 	if ((m_nCounterAnim % nAnimSpeed) == 0)
 	{
 		m_nCounterAnim = 0;
 
-		// nTexPosXڂ̎1ڂɖ߂
+		// nTexPosX枚目の次は1枚目に戻る
 		m_nPatternAnim = (m_nPatternAnim + 1) % nTexPosX;
 
-		// _obt@bNA_ւ̃|C^擾
-		m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-		// eNX`W̐ݒ
+		// テクスチャ座標の設定
 		pVtx[0].tex = D3DXVECTOR2(m_nPatternAnim * UV1, 0.0f);
 		pVtx[1].tex = D3DXVECTOR2(m_nPatternAnim * UV1 + UV1, 0.0f);
 		pVtx[2].tex = D3DXVECTOR2(m_nPatternAnim * UV1, UV2);
 		pVtx[3].tex = D3DXVECTOR2(m_nPatternAnim * UV1 + UV1, UV2);
-
-		// _obt@AbN
-		m_pVtxBuff->Unlock();
 	}
 }
 //=============================================================================
-// eNX`XN[
+// テクスチャスクロール処理
 //=============================================================================
 void CObject2D::ScrollTexture(void)
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
 	 m_aPosTexU += m_fUSpeed;
 
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	//eNX`W̍XV
+	//テクスチャ座標の更新
 	pVtx[0].tex = D3DXVECTOR2(m_aPosTexU, 0.0f);
 	pVtx[1].tex = D3DXVECTOR2(m_aPosTexU + 1.0f, 0.0f);
 	pVtx[2].tex = D3DXVECTOR2(m_aPosTexU, 1.0f);
 	pVtx[3].tex = D3DXVECTOR2(m_aPosTexU + 1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// Q[W̒_WXV
+// ゲージの頂点座標更新処理
 //=============================================================================
 void CObject2D::UpdateGuageVtx(float fRate)
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	float currentWidth = m_fWidth * fRate; // rate: 0.0f`1.0fiQ[Wj
+	float currentWidth = m_fWidth * fRate; // rate: 0.0f～1.0f（ゲージ割合）
 
 	pVtx[0].pos = D3DXVECTOR3(m_pos.x, m_pos.y - m_fHeight, 0.0f);
 	pVtx[1].pos = D3DXVECTOR3(m_pos.x + currentWidth, m_pos.y - m_fHeight, 0.0f);
@@ -308,21 +242,15 @@ void CObject2D::UpdateGuageVtx(float fRate)
 	pVtx[1].col = m_col;
 	pVtx[2].col = m_col;
 	pVtx[3].col = m_col;
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// t[̒_WXV
+// フレームの頂点座標更新処理
 //=============================================================================
 void CObject2D::UpdateFrame(void)
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	// t[̃TCYItZbg
+	// フレームのサイズオフセット
 	float offset = 3.0f;
 
 	pVtx[0].pos = D3DXVECTOR3(m_pos.x - offset, m_pos.y - m_fHeight - offset, 0.0f);
@@ -334,12 +262,9 @@ void CObject2D::UpdateFrame(void)
 	pVtx[1].col = m_col;
 	pVtx[2].col = m_col;
 	pVtx[3].col = m_col;
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// TCYݒ
+// サイズ設定
 //=============================================================================
 void CObject2D::SetSize(float fWidth, float fHeight)
 {
@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// 2DIuWFNg [object2D.h]
+// 2Dオブジェクト処理 [object2D.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _OBJECT2D_H_// ̃}N`ĂȂ
-#define _OBJECT2D_H_// 2dCN[hh~̃}N`
+#ifndef _OBJECT2D_H_// このマクロ定義がされていなかったら
+#define _OBJECT2D_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 //*****************************************************************************
-// 2DIuWFNgNX
+// 2Dオブジェクトクラス
 //*****************************************************************************
 class CObject2D : public CObject
 {
@@ -33,6 +33,8 @@ public:
 	void SetSize(float fWidth, float fHeight);
 	void SetScrollSpeed(float fUSpeed) { m_fUSpeed = fUSpeed; }
 	void SetUV(int nTexU, int nTexV);
+	void SetIdxTexture(int nIdxTexture) { m_nIdxTexture = nIdxTexture; }
+	void SetLayer(int nLayer) { m_nLayer = nLayer; }
 
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
 	D3DXVECTOR3 GetMove(void) { return m_move; }
@@ -44,26 +46,28 @@ public:
 	void MoveTexUV(float fLeft, float fTop, float fWidth, float fHeight);
 	void TextureAnim(int nTexPosX, int nTexPosY, int nAnimSpeed);
 	void ScrollTexture(void);
-	void UpdateGuageVtx(float fRate);		// HPQ[WŎg_WXV
-	void UpdateFrame(void);					// HPQ[W̃t[̒_WXV
+	void UpdateGuageVtx(float fRate);		// HPゲージで使う頂点座標更新
+	void UpdateFrame(void);					// HPゲージのフレームの頂点座標更新
 
 private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@ւ̃|C^
-	D3DXVECTOR3				m_pos;			// ʒu
-	D3DXVECTOR3				m_rot;			// 
-	D3DXVECTOR3				m_move;			// ړ
-	D3DCOLOR				m_col;			// F
-	float					m_fTexU;		// eNX`UV
-	float					m_fTexV;		// eNX`UV
-	int						m_nCounterAnim;	// Aj[VJE^[
-	int						m_nPatternAnim;	// Aj[Vp^[No.
-	float					m_fWidth;		// 
-	float					m_fHeight;		// 
-	float					m_fLength;		// 
-	float					m_fAngle;		// px
-	float					m_fUSpeed;		// ̃XN[Xs[h
-	float					m_fVSpeed;		// c̃XN[Xs[h
-	float					m_aPosTexU;		// ̃XN[pϐ
+	VERTEX_2D				m_aVtx[4];		// 頂点(描画時にCSpriteBatchへ積む)
+	D3DXVECTOR3				m_pos;			// 位置
+	D3DXVECTOR3				m_rot;			// 向き
+	D3DXVECTOR3				m_move;			// 移動量
+	D3DCOLOR				m_col;			// 色
+	float					m_fTexU;		// テクスチャUV
+	float					m_fTexV;		// テクスチャUV
+	int						m_nCounterAnim;	// アニメーションカウンター
+	int						m_nPatternAnim;	// アニメーションパターンNo.
+	float					m_fWidth;		// 幅
+	float					m_fHeight;		// 高さ
+	float					m_fLength;		// 長さ
+	float					m_fAngle;		// 角度
+	float					m_fUSpeed;		// 横のスクロールスピード
+	float					m_fVSpeed;		// 縦のスクロールスピード
+	float					m_aPosTexU;		// 横のスクロール用変数
+	int						m_nIdxTexture;	// 描画するテクスチャインデックス
+	int						m_nLayer;		// 重ね順
 };
 
 #endif
\ No newline at end of file
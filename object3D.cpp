@@ -1,52 +1,52 @@
 //=============================================================================
 //
-// 3DIuWFNg [object3D.cpp]
+// 3Dオブジェクト処理 [object3D.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object3D.h"
 #include "texture.h"
 #include "manager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CObject3D::CObject3D(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_pVtxBuff = nullptr;	// _obt@ւ̃|C^
-	m_pos	   = INIT_VEC3;	// ʒu
-	m_rot	   = INIT_VEC3;	// 
-	m_mtxWorld = {};		// [h}gbNX
-	m_fWidth   = 0.0f;		// 
-	m_fHeight  = 0.0f;		// 
+	// 値のクリア
+	m_pVtxBuff = nullptr;	// 頂点バッファへのポインタ
+	m_pos	   = INIT_VEC3;	// 位置
+	m_rot	   = INIT_VEC3;	// 向き
+	m_mtxWorld = {};		// ワールドマトリックス
+	m_fWidth   = 0.0f;		// 幅
+	m_fHeight  = 0.0f;		// 高さ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CObject3D::~CObject3D()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CObject3D* CObject3D::Create(void)
 {
-	// IuWFNg̐
+	// オブジェクトの生成
 	CObject3D* pObject3D = new CObject3D;
 
-	// nullptr
+	// nullptrだったら
 	if (pObject3D == nullptr)
 	{
 		return nullptr;
 	}
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pObject3D->Init()))
 	{
 		return nullptr;
@@ -55,14 +55,14 @@ CObject3D* CObject3D::Create(void)
 	return pObject3D;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CObject3D::Init(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// _obt@̐
+	// 頂点バッファの生成
 	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4,
 		D3DUSAGE_WRITEONLY,
 		FVF_VERTEX_3D,
@@ -70,114 +70,114 @@ HRESULT CObject3D::Init(void)
 		&m_pVtxBuff,
 		NULL);
 
-	VERTEX_3D* pVtx = nullptr;// _ւ̃|C^
+	VERTEX_3D* pVtx = nullptr;// 頂点情報へのポインタ
 
-	// _obt@bNA_ւ̃|C^擾
+	// 頂点バッファをロックし、頂点情報へのポインタを取得
 	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
 
-	// _W̐ݒ
+	// 頂点座標の設定
 	pVtx[0].pos = D3DXVECTOR3(-m_fWidth, +m_fHeight, 0.0f);
 	pVtx[1].pos = D3DXVECTOR3(+m_fWidth, +m_fHeight, 0.0f);
 	pVtx[2].pos = D3DXVECTOR3(-m_fWidth, -m_fHeight, 0.0f);
 	pVtx[3].pos = D3DXVECTOR3(+m_fWidth, -m_fHeight, 0.0f);
 
-	// e_̖@̐ݒ
+	// 各頂点の法線の設定
 	pVtx[0].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
 	pVtx[1].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
 	pVtx[2].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
 	pVtx[3].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
 
-	// _J[̐ݒ
+	// 頂点カラーの設定
 	pVtx[0].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 	pVtx[1].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 	pVtx[2].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 	pVtx[3].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 
-	// eNX`W̐ݒ
+	// テクスチャ座標の設定
 	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
 	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
 	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
 	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
 
-	// _obt@AbN
+	// 頂点バッファをアンロックする
 	m_pVtxBuff->Unlock();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CObject3D::Uninit(void)
 {
-	// _obt@̔j
+	// 頂点バッファの破棄
 	if (m_pVtxBuff != nullptr)
 	{
 		m_pVtxBuff->Release();
 		m_pVtxBuff = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CObject3D::Update(void)
 {
-	VERTEX_3D* pVtx;// _ւ̃|C^
+	VERTEX_3D* pVtx;// 頂点情報へのポインタ
 
-	// _obt@bNA_ւ̃|C^擾
+	// 頂点バッファをロックし、頂点情報へのポインタを取得
 	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
 
-	// _W̐ݒ
+	// 頂点座標の設定
 	pVtx[0].pos = D3DXVECTOR3(-m_fWidth, +m_fHeight, 0.0f);
 	pVtx[1].pos = D3DXVECTOR3(+m_fWidth, +m_fHeight, 0.0f);
 	pVtx[2].pos = D3DXVECTOR3(-m_fWidth, -m_fHeight, 0.0f);
 	pVtx[3].pos = D3DXVECTOR3(+m_fWidth, -m_fHeight, 0.0f);
 
-	// _J[̐ݒ
+	// 頂点カラーの設定
 	pVtx[0].col = m_col;
 	pVtx[1].col = m_col;
 	pVtx[2].col = m_col;
 	pVtx[3].col = m_col;
 
-	// _obt@AbN
+	// 頂点バッファをアンロックする
 	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CObject3D::Draw(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// vZp}gbNX
+	// 計算用マトリックス
 	D3DXMATRIX mtxRot, mtxTrans;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNXݒ
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// _obt@f[^Xg[ɐݒ
+	// 頂点バッファをデータストリームに設定
 	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
 
-	// _tH[}bg̐ݒ
+	// 頂点フォーマットの設定
 	pDevice->SetFVF(FVF_VERTEX_3D);
 
-	// |S̕`
+	// ポリゴンの描画
 	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
 
-	// eNX`̐ݒ
+	// テクスチャの設定
 	pDevice->SetTexture(0, nullptr);
 }
\ No newline at end of file
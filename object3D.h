@@ -1,20 +1,20 @@
 //=============================================================================
 //
-// 3DIuWFNg [object3D.h]
+// 3Dオブジェクト処理 [object3D.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _OBJECT3D_H_// ̃}N`ĂȂ
-#define _OBJECT3D_H_// 2dCN[hh~̃}N`
+#ifndef _OBJECT3D_H_// このマクロ定義がされていなかったら
+#define _OBJECT3D_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 
 //*****************************************************************************
-// 3DIuWFNgNX
+// 3Dオブジェクトクラス
 //*****************************************************************************
 class CObject3D : public CObject
 {
@@ -39,13 +39,13 @@ public:
 	D3DXCOLOR GetCol(void) { return m_col; }
 
 private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@ւ̃|C^
-	D3DXVECTOR3				m_pos;			// ʒu
-	D3DXVECTOR3				m_rot;			// 
-	D3DXCOLOR				m_col;			// F
-	D3DXMATRIX				m_mtxWorld;		// [h}gbNX
-	float					m_fWidth;		// 
-	float					m_fHeight;		// 
+	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// 頂点バッファへのポインタ
+	D3DXVECTOR3				m_pos;			// 位置
+	D3DXVECTOR3				m_rot;			// 向き
+	D3DXCOLOR				m_col;			// 色
+	D3DXMATRIX				m_mtxWorld;		// ワールドマトリックス
+	float					m_fWidth;		// 幅
+	float					m_fHeight;		// 高さ
 };
 
 #endif
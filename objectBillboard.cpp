@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// r{[h [objectBillboard.cpp]
+// ビルボード処理 [objectBillboard.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "objectBillboard.h"
 #include "renderer.h"
@@ -14,269 +14,133 @@
 #include "player.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CObjectBillboard::CObjectBillboard(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_szPath, 0, sizeof(m_szPath));	// t@CpX
-	m_pVtxBuff		= nullptr;				// _obt@ւ̃|C^
-	m_pos			= INIT_VEC3;			// ʒu
-	m_rot			= INIT_VEC3;			// 
-	m_col			= INIT_XCOL;			// F
-	m_mtxWorld		= {};					// [h}gbNX
-	m_fSize			= 0.0f;					// TCY(GtFNga)
-	m_fWidth		= 0.0f;					// TCY
-	m_fHeight		= 0.0f;					// TCY(r{[h)
-	m_nIdxTexture	= 0;					// eNX`CfbNX
+	// 値のクリア
+	memset(m_szPath, 0, sizeof(m_szPath));	// ファイルパス
+	m_pos			= INIT_VEC3;			// 位置
+	m_rot			= INIT_VEC3;			// 向き
+	m_col			= INIT_XCOL;			// 色
+	m_uvMin			= D3DXVECTOR2(0.0f, 0.0f);	// 左上のテクスチャ座標
+	m_uvMax			= D3DXVECTOR2(1.0f, 1.0f);	// 右下のテクスチャ座標
+	m_blend			= CBillboardRenderer::BLEND_NORMAL;// ブレンドの種類
+	m_nLayer		= 0;					// 重ね順
+	m_fLeft			= 0.0f;					// 左端
+	m_fRight		= 0.0f;					// 右端
+	m_fTop			= 0.0f;					// 上端
+	m_fBottom		= 0.0f;					// 下端
+	m_fQuadRot		= 0.0f;					// 画面内の回転
+	m_fSize			= 0.0f;					// サイズ(エフェクト半径)
+	m_fWidth		= 0.0f;					// サイズ
+	m_fHeight		= 0.0f;					// サイズ(ビルボード)
+	m_nIdxTexture	= -1;					// テクスチャインデックス
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CObjectBillboard::~CObjectBillboard()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CObjectBillboard::Init(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`̓o^
+	// テクスチャの登録
 	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic(m_szPath);
 
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_3D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	VERTEX_3D* pVtx = nullptr;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(-m_fSize, +m_fSize + m_fHeight, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(+m_fSize, +m_fSize + m_fHeight, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(-m_fSize, -m_fSize - m_fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(+m_fSize, -m_fSize - m_fHeight, 0.0f);
-
-	// e_̖@̐ݒ
-	pVtx[0].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
-	pVtx[1].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
-	pVtx[2].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
-	pVtx[3].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
-
-	// _J[̐ݒ
-	pVtx[0].col = m_col;
-	pVtx[1].col = m_col;
-	pVtx[2].col = m_col;
-	pVtx[3].col = m_col;
-
-	// eNX`W̐ݒ
-	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
-	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
-	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
-	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点はCBillboardRendererがまとめて書くので、ここでは広がりだけ持つ
+	SetExtent(-m_fSize, +m_fSize, +m_fSize + m_fHeight, -m_fSize - m_fHeight);
+	m_fQuadRot = 0.0f;
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CObjectBillboard::Uninit(void)
 {
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
+	// テクスチャの参照を外す
+	if (CManager::GetTexture() != nullptr)
 	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
+		CManager::GetTexture()->Release(m_nIdxTexture);
+		m_nIdxTexture = -1;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CObjectBillboard::Update(void)
 {
-	VERTEX_3D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-	
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(-m_fSize, +m_fSize + m_fHeight, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(+m_fSize, +m_fSize + m_fHeight, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(-m_fSize, -m_fSize - m_fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(+m_fSize, -m_fSize - m_fHeight, 0.0f);
-
-	pVtx[0].col = m_col;
-	pVtx[1].col = m_col;
-	pVtx[2].col = m_col;
-	pVtx[3].col = m_col;
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 頂点座標の設定
+	SetExtent(-m_fSize, +m_fSize, +m_fSize + m_fHeight, -m_fSize - m_fHeight);
+	m_fQuadRot = 0.0f;
 }
 //=============================================================================
-// XV(])
+// 更新処理(回転)
 //=============================================================================
 void CObjectBillboard::UpdateTurn(void)
 {
-	VERTEX_3D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	float c = cosf(m_rot.z);
-	float s = sinf(m_rot.z);
-
-	// ̒_]
-	for (int nCnt = 0; nCnt < 4; nCnt++)
-	{
-		float x = pVtx[nCnt].pos.x;
-		float y = pVtx[nCnt].pos.y;
-
-		pVtx[nCnt].pos.x = x * c - y * s;
-		pVtx[nCnt].pos.y = x * s + y * c;
-
-		// F̍XV
-		pVtx[nCnt].col = m_col;
-	}
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// 元の頂点を回転(回転はまとめて描く時に頂点へ反映する)
+	m_fQuadRot = m_rot.z;
 }
 //=============================================================================
-// `揈
+// 描画処理(CBillboardRendererに積み、優先順位の最後にまとめて描く)
 //=============================================================================
 void CObjectBillboard::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// Cg𖳌ɂ
-	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);
-
-	// ZeXg
-	pDevice->SetRenderState(D3DRS_ZFUNC, D3DCMP_LESSEQUAL);	// Z̔r@
-	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, FALSE);		// Zobt@ɏ܂Ȃ
-
-	// vZp}gbNX
-	D3DXMATRIX mtxRot, mtxTrans;
-
-	// [h}gbNX̏
-	D3DXMatrixIdentity(&m_mtxWorld);
-
-	// r[}gbNX̎擾
-	D3DXMATRIX mtxView;
-	pDevice->GetTransform(D3DTS_VIEW, &mtxView);
-
-	// J̋tsݒ
-	m_mtxWorld._11 = mtxView._11;
-	m_mtxWorld._12 = mtxView._21;
-	m_mtxWorld._13 = mtxView._31;
-	m_mtxWorld._21 = mtxView._12;
-	m_mtxWorld._22 = mtxView._22;
-	m_mtxWorld._23 = mtxView._32;
-	m_mtxWorld._31 = mtxView._13;
-	m_mtxWorld._32 = mtxView._23;
-	m_mtxWorld._33 = mtxView._33;
-
-	// ʒu𔽉f
-	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
-
-	// [h}gbNXݒ
-	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
-
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
-
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_3D);
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-	// |S̕`
-	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
-
-	// ɖ߂
-	pDevice->SetRenderState(D3DRS_ZFUNC, D3DCMP_LESSEQUAL);//Z̔r@
-	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);//Zobt@ɏ
+	// 透明なものは積まない
+	if (m_col.a <= 0.0f)
+	{
+		return;
+	}
 
-	// CgLɂ
-	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);
+	CBillboardRenderer::Sprite sprite;
+	sprite.pos = m_pos;
+	sprite.fLeft = m_fLeft;
+	sprite.fRight = m_fRight;
+	sprite.fTop = m_fTop;
+	sprite.fBottom = m_fBottom;
+	sprite.fRot = m_fQuadRot;
+	sprite.col = m_col;
+	sprite.uvMin = m_uvMin;
+	sprite.uvMax = m_uvMax;
+	sprite.nIdxTexture = m_nIdxTexture;
+	sprite.blend = m_blend;
+	sprite.nLayer = m_nLayer;
+
+	CBillboardRenderer::Submit(sprite);
 }
 //=============================================================================
-// 3DQ[W̒_WXV
+// 3Dゲージの頂点座標更新処理
 //=============================================================================
 void CObjectBillboard::UpdateGuageVtx(float fRate)
 {
-	VERTEX_3D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
 	float totalWidth = m_fWidth;
 	float currentWidth = totalWidth * fRate;
 	float halfHeight = m_fHeight;
 
-	// r{[h[JWŉE[𒆐SɌŒ
-	pVtx[0].pos = D3DXVECTOR3(-m_fWidth * 0.5f, halfHeight, 0.0f); // 
-	pVtx[1].pos = D3DXVECTOR3(currentWidth - m_fWidth * 0.5f, halfHeight, 0.0f); // E
-	pVtx[2].pos = D3DXVECTOR3(-m_fWidth * 0.5f, -halfHeight, 0.0f); // 
-	pVtx[3].pos = D3DXVECTOR3(currentWidth - m_fWidth * 0.5f, -halfHeight, 0.0f); // E
-
-	pVtx[0].col = m_col;
-	pVtx[1].col = m_col;
-	pVtx[2].col = m_col;
-	pVtx[3].col = m_col;
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
+	// ビルボードローカル座標で右端を中心に固定
+	SetExtent(-m_fWidth * 0.5f, currentWidth - m_fWidth * 0.5f, halfHeight, -halfHeight);
+	m_fQuadRot = 0.0f;
 }
 //=============================================================================
-// t[̒_WXV
+// フレームの頂点座標更新処理
 //=============================================================================
 void CObjectBillboard::UpdateFrame(void)
 {
-	VERTEX_3D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
 	float halfWidth = m_fWidth * 0.5f;
 	float halfHeight = m_fHeight;
 
-	float offset = 1.0f; // t[̐̃ItZbg
-
-	// Q[WƓ
-	pVtx[0].pos = D3DXVECTOR3(-halfWidth - offset, halfHeight + offset, 0.0f);	// 
-	pVtx[1].pos = D3DXVECTOR3(halfWidth + offset, halfHeight + offset, 0.0f);	// E
-	pVtx[2].pos = D3DXVECTOR3(-halfWidth - offset, -halfHeight - offset, 0.0f);	// 
-	pVtx[3].pos = D3DXVECTOR3(halfWidth + offset, -halfHeight - offset, 0.0f);	// E
+	float offset = 1.0f; // フレームの線幅分のオフセット
 
-	pVtx[0].col = m_col;
-	pVtx[1].col = m_col;
-	pVtx[2].col = m_col;
-	pVtx[3].col = m_col;
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-}
+	// ゲージと同じ中央揃え
+	SetExtent(-halfWidth - offset, halfWidth + offset, halfHeight + offset, -halfHeight - offset);
+	m_fQuadRot = 0.0f;
+}
\ No newline at end of file
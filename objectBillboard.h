@@ -1,20 +1,21 @@
 //=============================================================================
 //
-// r{[h [objectBillboard.h]
+// ビルボード処理 [objectBillboard.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _OBJECTBILLBOARD_H_// ̃}N`ĂȂ
-#define _OBJECTBILLBOARD_H_// 2dCN[hh~̃}N`
+#ifndef _OBJECTBILLBOARD_H_// このマクロ定義がされていなかったら
+#define _OBJECTBILLBOARD_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
+#include "billboardrenderer.h"
 
 
 //*****************************************************************************
-// r{[hNX
+// ビルボードクラス
 //*****************************************************************************
 class CObjectBillboard : public CObject
 {
@@ -23,18 +24,18 @@ public:
 	~CObjectBillboard();
 
 	//*************************************************************************
-	// r{[hev[g
+	// ビルボード生成テンプレート
 	//*************************************************************************
-	// billboardType : r{[hNX
+	// billboardType : 生成したいビルボードクラス名
 	template <typename billboardType>
 	static CObjectBillboard* Create(const char* path, D3DXVECTOR3 pos, float fWidth, float fHeight)
 	{
-		// nꂽ^CObjectBillboardpĂȂꍇ
-		static_assert(std::is_base_of<CObjectBillboard, billboardType>::value, "^CObjectBillboardpĂ܂B");
+		// 渡された型がCObjectBillboardを継承していなかった場合
+		static_assert(std::is_base_of<CObjectBillboard, billboardType>::value, "型はCObjectBillboardを継承していません。");
 
-		billboardType* pBillboard = new billboardType();// ^̃CX^X
+		billboardType* pBillboard = new billboardType();// 型のインスタンス生成
 
-		// nullptr
+		// nullptrだったら
 		if (!pBillboard)
 		{
 			return nullptr;
@@ -42,11 +43,11 @@ public:
 
 		pBillboard->SetPath(path);
 		pBillboard->m_pos = pos;
-		pBillboard->m_fSize = fWidth;// GtFNg̔a
+		pBillboard->m_fSize = fWidth;// エフェクトの半径
 		pBillboard->SetHeight(fHeight);
 		pBillboard->m_col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 
-		// s
+		// 初期化失敗時
 		if (FAILED(pBillboard->Init()))
 		{
 			return nullptr;
@@ -68,6 +69,9 @@ public:
 	void SetCol(D3DXCOLOR col) { m_col = col; }
 	void SetSize(float fRadius) { m_fSize = fRadius; }
 	void SetSize(float fWidth, float fHeight) { m_fWidth = fWidth; m_fHeight = fHeight; }
+	void SetUV(D3DXVECTOR2 uvMin, D3DXVECTOR2 uvMax) { m_uvMin = uvMin; m_uvMax = uvMax; }
+	void SetBlendMode(CBillboardRenderer::BLEND blend) { m_blend = blend; }
+	void SetLayer(int nLayer) { m_nLayer = nLayer; }
 	void SetPath(const char* path)
 	{ 
 		if (path == nullptr)
@@ -83,16 +87,31 @@ public:
 	D3DXCOLOR GetCol(void) { return m_col; }
 
 private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;			// _obt@ւ̃|C^
-	D3DXVECTOR3				m_pos;				// ʒu
-	D3DXVECTOR3				m_rot;				// 
-	D3DXCOLOR				m_col;				// F
-	D3DXMATRIX				m_mtxWorld;			// [h}gbNX
-	float					m_fSize;			// TCY(GtFNga)
-	float					m_fWidth;			// TCY
-	float					m_fHeight;			// TCY(r{[h)
-	int						m_nIdxTexture;		// eNX`CfbNX
-	char					m_szPath[MAX_PATH];	// t@CpX
+	void SetExtent(float fLeft, float fRight, float fTop, float fBottom)
+	{
+		m_fLeft = fLeft;
+		m_fRight = fRight;
+		m_fTop = fTop;
+		m_fBottom = fBottom;
+	}
+
+	D3DXVECTOR3				m_pos;				// 位置
+	D3DXVECTOR3				m_rot;				// 向き
+	D3DXCOLOR				m_col;				// 色
+	D3DXVECTOR2				m_uvMin;			// 左上のテクスチャ座標
+	D3DXVECTOR2				m_uvMax;			// 右下のテクスチャ座標
+	CBillboardRenderer::BLEND m_blend;			// ブレンドの種類
+	int						m_nLayer;			// 重ね順
+	float					m_fLeft;			// 左端(ビルボードのローカル座標)
+	float					m_fRight;			// 右端
+	float					m_fTop;				// 上端
+	float					m_fBottom;			// 下端
+	float					m_fQuadRot;			// 画面内の回転
+	float					m_fSize;			// サイズ(エフェクト半径)
+	float					m_fWidth;			// サイズ
+	float					m_fHeight;			// サイズ(ビルボード)
+	int						m_nIdxTexture;		// テクスチャインデックス
+	char					m_szPath[MAX_PATH];	// ファイルパス
 };
 
 #endif
\ No newline at end of file
@@ -1,52 +1,63 @@
 //=============================================================================
 //
-// Xt@C [objectX.cpp]
+// Xファイル処理 [objectX.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "objectX.h"
 #include "renderer.h"
 #include "manager.h"
+#include "assetloader.h"
+#include "light.h"
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CObjectX::CObjectX(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_szPath, 0, sizeof(m_szPath));	// t@CpX
-	m_nIdxTexture	= 0;					// eNX`CfbNX
-	m_pos			= INIT_VEC3;			// ʒu
-	m_rot			= INIT_VEC3;			// 
-	m_move			= INIT_VEC3;			// ړ
-	m_size			= INIT_VEC3;			// TCY : 1.0ɂĂ
-	m_pMesh			= nullptr;				// bVւ̃|C^
-	m_pBuffMat		= nullptr;				// }eAւ̃|C^
-	m_dwNumMat		= NULL;					// }eA
-	m_mtxWorld		= {};					// [h}gbNX
-	m_modelSize		= INIT_VEC3;			// f̌TCYiŜ̕EEsj
-	m_isGhostObject = false;				// S[XgIuWFNg()ǂ
+	// 値のクリア
+	memset(m_szPath, 0, sizeof(m_szPath));	// ファイルパス
+	m_nIdxTexture	= 0;					// テクスチャインデックス
+	m_pos			= INIT_VEC3;			// 位置
+	m_rot			= INIT_VEC3;			// 向き
+	m_move			= INIT_VEC3;			// 移動量
+	m_size			= INIT_VEC3;			// サイズ : 初期は1.0にしておく
+	m_pMesh			= nullptr;				// メッシュへのポインタ
+	m_pBuffMat		= nullptr;				// マテリアルへのポインタ
+	m_dwNumMat		= NULL;					// マテリアル数
+	m_mtxWorld		= {};					// ワールドマトリックス
+	m_modelSize		= INIT_VEC3;			// モデルの元サイズ（全体の幅・高さ・奥行き）
+	m_modelCenter	= INIT_VEC3;			// モデルの元の中心(AABBの中心)
+	m_boundCenter	= INIT_VEC3;			// ワールド空間の境界球の中心
+	m_fBoundRadius	= 0.0f;					// ワールド空間の境界球の半径
+	m_bBoundDirty	= true;					// 境界球の再計算が必要か
+	m_nCullFrame	= 0;					// カリングを判定したフレーム
+	m_bInView		= true;					// 判定したフレームで見えていたか
+	m_isGhostObject = false;				// ゴーストオブジェクト(透明)かどうか
+	m_pass			= CRenderQueue::PASS_OPAQUE;// 描画パス
+	m_bRenderQueue	= true;					// 描画キューを使うか
+	m_bMeshPending	= false;				// メッシュが先読み中か
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CObjectX::~CObjectX()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CObjectX* CObjectX::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 rot, D3DXVECTOR3 size)
 {
 	CObjectX* pObjectX = new CObjectX;
 
-	// nullptr
+	// nullptrだったら
 	if (pObjectX == nullptr)
 	{
 		return nullptr;
@@ -55,9 +66,9 @@ CObjectX* CObjectX::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 r
 	pObjectX->m_pos = pos;
 	pObjectX->m_rot = D3DXToRadian(rot);
 	pObjectX->m_size = size;
-	pObjectX->SetPath(pFilepath);	// pXۑ
+	pObjectX->SetPath(pFilepath);	// パス保存
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pObjectX->Init()))
 	{
 		return nullptr;
@@ -66,133 +77,225 @@ CObjectX* CObjectX::Create(const char* pFilepath, D3DXVECTOR3 pos, D3DXVECTOR3 r
 	return pObjectX;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CObjectX::Init(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// Xt@C̓ǂݍ
-	D3DXLoadMeshFromX(m_szPath,
-		D3DXMESH_SYSTEMMEM,
+	// 境界の最小・最大値(変換済みのメッシュなら変換時に求めた値)
+	D3DXVECTOR3 vMin, vMax;
+
+	// Xファイルの読み込み(先読み中なら待たずに仮の箱で表示し、届いてから作る)
+	HRESULT hr = CAssetLoader::CreateMesh(m_szPath,
 		pDevice,
-		NULL,
+		D3DXMESH_SYSTEMMEM,
 		&m_pBuffMat,
-		NULL,
 		&m_dwNumMat,
-		&m_pMesh);
+		&m_pMesh,
+		&vMin,
+		&vMax);
+
+	if (hr == E_PENDING)
+	{
+		// 仮の箱の大きさはここで1回だけ取る
+		CAssetLoader::GetMeshBounds(m_szPath, &vMin, &vMax);
 
-	int nNumVtx;		// _
-	DWORD sizeFVF;		// _tH[}bg̃TCY
-	BYTE* pVtxBuff;		// _obt@ւ̃|C^
+		m_bMeshPending = true;
+		SetModelBounds(vMin, vMax);
+		return S_OK;
+	}
 
-	// bVǂݍ܂Ă邩mF
+	// メッシュが読み込まれているか確認
 	if (m_pMesh == nullptr)
 	{
-		MessageBox(nullptr, "Xt@C̓ǂݍ݂Ɏs܂ibVNULLłj", "G[", MB_OK | MB_ICONERROR);
+		MessageBox(nullptr, "Xファイルの読み込みに失敗しました（メッシュがNULLです）", "エラー", MB_OK | MB_ICONERROR);
 		return 0;
 	}
 
-	// _̎擾
-	nNumVtx = m_pMesh->GetNumVertices();
-
-	// _0ȂAfƂ݂Ȃ
-	if (nNumVtx == 0)
+	// 頂点数が0なら、モデルが空とみなす
+	if (m_pMesh->GetNumVertices() == 0)
 	{
-		MessageBox(nullptr, "Xt@C̓ǂݍ݂Ɏs܂i_0łj", "G[", MB_OK | MB_ICONERROR);
+		MessageBox(nullptr, "Xファイルの読み込みに失敗しました（頂点数が0です）", "エラー", MB_OK | MB_ICONERROR);
 		return 0;
 	}
-	else
-	{// f
 
-		// _tH[}bg̎擾
-		sizeFVF = D3DXGetFVFVertexSize(m_pMesh->GetFVF());
+	// モデルあり
+	SetModelBounds(vMin, vMax);
+	RegisterTextures();
+
+	return S_OK;
+}
+//=============================================================================
+// モデルの元の境界の設定処理
+//=============================================================================
+void CObjectX::SetModelBounds(const D3DXVECTOR3& vMin, const D3DXVECTOR3& vMax)
+{
+	// 元サイズ = 最大 - 最小
+	m_modelSize = vMax - vMin;
 
-		// _obt@̃bN
-		m_pMesh->LockVertexBuffer(D3DLOCK_READONLY, (void**)&pVtxBuff);
+	// 境界球の中心(原点がモデルの中心とは限らない)
+	m_modelCenter = (vMax + vMin) * 0.5f;
+	m_bBoundDirty = true;
+}
+//=============================================================================
+// マテリアルのテクスチャの登録処理
+//=============================================================================
+void CObjectX::RegisterTextures(void)
+{
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
 
-		// AABBvZp̍ŏEől
-		D3DXVECTOR3 vMin(FLT_MAX, FLT_MAX, FLT_MAX);
-		D3DXVECTOR3 vMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	D3DXMATERIAL* pMat;// マテリアルへのポインタ
 
-		// őlEŏl߂
-		for (int nCnt = 0; nCnt < nNumVtx; nCnt++)
-		{
-			D3DXVECTOR3* p = (D3DXVECTOR3*)(pVtxBuff + sizeFVF * nCnt);
+	// マテリアルデータへのポインタを取得
+	pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
 
-			vMin.x = std::min(vMin.x, p->x);
-			vMin.y = std::min(vMin.y, p->y);
-			vMin.z = std::min(vMin.z, p->z);
+	m_nIdxTexture = new int[m_dwNumMat];
 
-			vMax.x = std::max(vMax.x, p->x);
-			vMax.y = std::max(vMax.y, p->y);
-			vMax.z = std::max(vMax.z, p->z);
+	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
+	{
+		if (pMat[nCntMat].pTextureFilename != nullptr)
+		{// テクスチャファイルが存在する
+			// テクスチャの登録
+			m_nIdxTexture[nCntMat] = pTexture->RegisterDynamic(pMat[nCntMat].pTextureFilename);
 		}
+		else
+		{// テクスチャが存在しない
+			m_nIdxTexture[nCntMat] = -1;
+		}
+	}
+}
+//=============================================================================
+// 先読み中のメッシュの作成処理(作れたらtrue。まだ届いていない・今回のフレームの上限を超えた時はfalse)
+//=============================================================================
+bool CObjectX::UpdatePendingMesh(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-		// _obt@̃AbN
-		m_pMesh->UnlockVertexBuffer();
+	D3DXVECTOR3 vMin, vMax;
 
-		// TCY = ő - ŏ
-		m_modelSize = vMax - vMin;
+	HRESULT hr = CAssetLoader::CreateMesh(m_szPath, pDevice, D3DXMESH_SYSTEMMEM,
+		&m_pBuffMat, &m_dwNumMat, &m_pMesh, &vMin, &vMax);
 
-		D3DXMATERIAL* pMat;// }eAւ̃|C^
+	if (hr == E_PENDING)
+	{
+		return false;
+	}
 
-		// }eAf[^ւ̃|C^擾
-		pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
+	m_bMeshPending = false;
 
-		m_nIdxTexture = new int[m_dwNumMat];
+	if (FAILED(hr) || m_pMesh == nullptr)
+	{// 読めなかった時は何も描かない
+		return false;
+	}
 
-		for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
-		{
-			if (pMat[nCntMat].pTextureFilename != nullptr)
-			{// eNX`t@C݂
-				// eNX`̓o^
-				m_nIdxTexture[nCntMat] = pTexture->RegisterDynamic(pMat[nCntMat].pTextureFilename);
-			}
-			else
-			{// eNX`݂Ȃ
-				m_nIdxTexture[nCntMat] = -1;
-			}
-		}
+	SetModelBounds(vMin, vMax);
+	RegisterTextures();
+
+	OnMeshLoaded();
+
+	return true;
+}
+//=============================================================================
+// 仮の箱の描画処理(モデルの元の境界の大きさで描く。キューを使う時は他のパケットと一緒に描く)
+//=============================================================================
+void CObjectX::DrawPlaceholder(void)
+{
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	LPD3DXMESH pBox = CAssetLoader::GetPlaceholderMesh(CManager::GetRenderer()->GetDevice());
+
+	if (pBox == nullptr)
+	{
+		return;
 	}
 
-	return S_OK;
+	// ワールドマトリックスの計算
+	CalcWorldMatrix();
+
+	// 1x1x1の箱を元の境界に合わせる
+	D3DXMATRIX mtxBox, mtxTrans;
+	D3DXMatrixScaling(&mtxBox, m_modelSize.x, m_modelSize.y, m_modelSize.z);
+	D3DXMatrixTranslation(&mtxTrans, m_modelCenter.x, m_modelCenter.y, m_modelCenter.z);
+	mtxBox = mtxBox * mtxTrans * m_mtxWorld;
+
+	D3DMATERIAL9 matDef;
+	pDevice->GetMaterial(&matDef);
+
+	D3DMATERIAL9 mat = {};
+	mat.Diffuse = D3DXCOLOR(PLACEHOLDER_GRAY, PLACEHOLDER_GRAY, PLACEHOLDER_GRAY, 1.0f);
+	mat.Ambient = mat.Diffuse;
+
+	// ライトは境界球の周りで選ぶ
+	D3DXVECTOR3 center;
+	float fRadius;
+	GetWorldBounds(&center, &fRadius);
+
+	// 描画パケットを積む(テクスチャなし)
+	if (IsRenderQueued())
+	{
+		CManager::GetRenderer()->GetRenderQueue()->Submit(CRenderQueue::PASS_OPAQUE, 0, -1, pBox, 0, mtxBox, mat, nullptr, center, fRadius);
+		return;
+	}
+
+	CLight::Apply(center, fRadius);
+
+	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS, TRUE);// 法線正規化を有効にする
+	pDevice->SetTransform(D3DTS_WORLD, &mtxBox);
+	pDevice->SetMaterial(&mat);
+	pDevice->SetTexture(0, nullptr);
+	pDevice->DrawSubset(pBox, 0);
+	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS, FALSE);// 法線正規化を無効にする
+
+	// 保存していたマテリアルを戻す
+	pDevice->SetMaterial(&matDef);
+
+	// 注視点の周りのライトに戻す
+	CLight::RestoreView();
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CObjectX::Uninit(void)
 {
-	// eNX`CfbNX̔j
+	// テクスチャインデックスの破棄
 	if (m_nIdxTexture != nullptr)
 	{
+		// テクスチャの参照を外す
+		CTexture* pTexture = CManager::GetTexture();
+
+		for (int nCntMat = 0; pTexture != nullptr && nCntMat < (int)m_dwNumMat; nCntMat++)
+		{
+			pTexture->Release(m_nIdxTexture[nCntMat]);
+		}
+
 		delete[] m_nIdxTexture;
 		m_nIdxTexture = nullptr;
 	}
 
-	// bV̔j
+	// メッシュの破棄
 	if (m_pMesh != nullptr)
 	{
 		m_pMesh->Release();
 		m_pMesh = nullptr;
 	}
 
-	// }eA̔j
+	// マテリアルの破棄
 	if (m_pBuffMat != nullptr)
 	{
 		m_pBuffMat->Release();
 		m_pBuffMat = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CObjectX::Update(void)
 {
@@ -200,52 +303,143 @@ void CObjectX::Update(void)
 
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CObjectX::Draw(void)
 {
+	// 先読み中のメッシュが届いていれば作り、まだなら仮の箱を描く
+	if (m_bMeshPending && !UpdatePendingMesh())
+	{
+		if (m_bMeshPending && IsInView())
+		{
+			DrawPlaceholder();
+		}
+
+		return;
+	}
+
+	// 画面外なら描画しない
+	if (!IsInView())
+	{
+		return;
+	}
+
+	// 描画キューを使わない場合はその場で描画する
+	if (!IsRenderQueued())
+	{
+		DrawImmediate();
+		return;
+	}
+
 	if (!m_pBuffMat || !m_pMesh || m_dwNumMat == 0)
 	{
 		return;
 	}
 
-	// eNX`̎擾
+	// マテリアルデータへのポインタを取得
+	D3DXMATERIAL* pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
+
+	if (!pMat)
+	{
+		return;
+	}
+
+	// 描画キューの取得
+	CRenderQueue* pQueue = CManager::GetRenderer()->GetRenderQueue();
+
+	// 色の取得
+	D3DXCOLOR col = GetCol();
+
+	// ゴーストオブジェクトなら透明度補正
+	if (IsGhostObject())
+	{
+		col.a = 0.0f;// 透明にする
+	}
+
+	// 半透明のものは並べ替えると重なりが崩れるので、溜まっている分を描いてからその場で描画する
+	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
+	{
+		if (pMat[nCntMat].MatD3D.Diffuse.a * col.a < 1.0f)
+		{
+			pQueue->Flush();
+			DrawImmediate();
+			return;
+		}
+	}
+
+	// ワールドマトリックスの計算
+	CalcWorldMatrix();
+
+	// ライトは境界球の周りで選ぶ
+	D3DXVECTOR3 center;
+	float fRadius;
+	GetWorldBounds(&center, &fRadius);
+
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
+	{
+		// 元のマテリアル色に補正を掛ける
+		D3DMATERIAL9 mat = pMat[nCntMat].MatD3D;
 
-	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS, TRUE);// @KLɂ
+		mat.Diffuse.r *= col.r;
+		mat.Diffuse.g *= col.g;
+		mat.Diffuse.b *= col.b;
+		mat.Diffuse.a *= col.a;
 
-	// vZp}gbNX
-	D3DXMATRIX mtxRot, mtxTrans, mtxSize;
+		LPDIRECT3DTEXTURE9 pTex = nullptr;
 
-	D3DMATERIAL9 matDef;	// ݂̃}eAۑp
+		if (m_nIdxTexture[nCntMat] != -1)
+		{
+			pTex = pTexture->GetAddress(m_nIdxTexture[nCntMat]);
+		}
 
-	D3DXMATERIAL* pMat;		// }eAf[^ւ̃|C^
+		// 描画パケットを積む
+		pQueue->Submit(m_pass, 0, m_nIdxTexture[nCntMat], m_pMesh, nCntMat, m_mtxWorld, mat, pTex, center, fRadius);
+	}
+}
+//=============================================================================
+// 即時描画処理(キューを通さずに描画する)
+//=============================================================================
+void CObjectX::DrawImmediate(void)
+{
+	if (!m_pBuffMat || !m_pMesh || m_dwNumMat == 0)
+	{
+		return;
+	}
 
-	// [h}gbNX̏
-	D3DXMatrixIdentity(&m_mtxWorld);
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
 
-	// TCY𔽉f
-	D3DXMatrixScaling(&mtxSize, m_size.x, m_size.y, m_size.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxSize);
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	// 𔽉f
-	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
+	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS, TRUE);// 法線正規化を有効にする
 
-	// ʒu𔽉f
-	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
-	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
+	// 描画パスのレンダーステート設定
+	CRenderQueue::BeginPass(pDevice, m_pass);
 
-	// [h}gbNXݒ
+	D3DMATERIAL9 matDef;	// 現在のマテリアル保存用
+
+	D3DXMATERIAL* pMat;		// マテリアルデータへのポインタ
+
+	// ワールドマトリックスの計算
+	CalcWorldMatrix();
+
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// ݂̃}eA̎擾
+	// 自分の周りのライトを選ぶ
+	D3DXVECTOR3 center;
+	float fRadius;
+	GetWorldBounds(&center, &fRadius);
+	CLight::Apply(center, fRadius);
+
+	// 現在のマテリアルの取得
 	pDevice->GetMaterial(&matDef);
 
-	// }eAf[^ւ̃|C^擾
+	// マテリアルデータへのポインタを取得
 	pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
 
 	if (!pMat)
@@ -253,18 +447,18 @@ void CObjectX::Draw(void)
 		return;
 	}
 
-	// F̎擾
+	// 色の取得
 	D3DXCOLOR col = GetCol();
 
-	// S[XgIuWFNgȂ瓧x␳
+	// ゴーストオブジェクトなら透明度補正
 	if (IsGhostObject())
 	{
-		col.a = 0.0f;// ɂ
+		col.a = 0.0f;// 透明にする
 	}
 
 	for (int nCntMat = 0; nCntMat < (int)m_dwNumMat; nCntMat++)
 	{
-		// ̃}eAFɕ␳|
+		// 元のマテリアル色に補正を掛ける
 		D3DMATERIAL9 mat = pMat[nCntMat].MatD3D;
 
 		mat.Diffuse.r *= col.r;
@@ -272,39 +466,132 @@ void CObjectX::Draw(void)
 		mat.Diffuse.b *= col.b;
 		mat.Diffuse.a *= col.a;
 
-		// }eA̐ݒ
+		// マテリアルの設定
 		pDevice->SetMaterial(&mat);
 
 		if (m_nIdxTexture[nCntMat] == -1)
 		{
-			// eNX`̐ݒ
+			// テクスチャの設定
 			pDevice->SetTexture(0, nullptr);
 		}
 		else
 		{
-			// eNX`̐ݒ
+			// テクスチャの設定
 			pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture[nCntMat]));
 		}
 
-		// f(p[c)̕`
-		m_pMesh->DrawSubset(nCntMat);
+		// モデル(パーツ)の描画
+		pDevice->DrawSubset(m_pMesh, nCntMat);
 	}
 
-	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS, FALSE);// @K𖳌ɂ
+	// 描画パスのレンダーステートを戻す
+	CRenderQueue::EndPass(pDevice, m_pass);
+
+	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS, FALSE);// 法線正規化を無効にする
 
-	// ۑĂ}eA߂
+	// 保存していたマテリアルを戻す
 	pDevice->SetMaterial(&matDef);
+
+	// 注視点の周りのライトに戻す
+	CLight::RestoreView();
+}
+//=============================================================================
+// ワールドマトリックスの計算処理
+//=============================================================================
+void CObjectX::CalcWorldMatrix(void)
+{
+	// 計算用マトリックス
+	D3DXMATRIX mtxRot, mtxTrans, mtxSize;
+
+	// ワールドマトリックスの初期化
+	D3DXMatrixIdentity(&m_mtxWorld);
+
+	// サイズを反映
+	D3DXMatrixScaling(&mtxSize, m_size.x, m_size.y, m_size.z);
+	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxSize);
+
+	// 向きを反映
+	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
+	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
+
+	// 位置を反映
+	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
+	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
+}
+//=============================================================================
+// 描画キューに積むオブジェクトかどうか
+//=============================================================================
+bool CObjectX::IsRenderQueued(void) const
+{
+	return m_bRenderQueue && CManager::GetRenderer()->GetRenderQueue()->IsEnable();
+}
+//=============================================================================
+// ワールド空間の境界球の更新処理(位置・向き・拡大率が変わった時だけ計算する)
+//=============================================================================
+void CObjectX::UpdateWorldBounds(void)
+{
+	if (!m_bBoundDirty)
+	{
+		return;
+	}
+
+	m_bBoundDirty = false;
+
+	// 一番大きい軸の拡大率で広げる
+	float fScale = std::max(fabsf(m_size.x), std::max(fabsf(m_size.y), fabsf(m_size.z)));
+
+	m_fBoundRadius = D3DXVec3Length(&m_modelSize) * 0.5f * fScale;
+
+	// 元の中心をワールド空間に移す
+	CalcWorldMatrix();
+	D3DXVec3TransformCoord(&m_boundCenter, &m_modelCenter, &m_mtxWorld);
+}
+//=============================================================================
+// ワールド空間の境界球の取得
+//=============================================================================
+void CObjectX::GetWorldBounds(D3DXVECTOR3* pCenter, float* pRadius)
+{
+	UpdateWorldBounds();
+
+	if (pCenter != nullptr)
+	{
+		*pCenter = m_boundCenter;
+	}
+
+	if (pRadius != nullptr)
+	{
+		*pRadius = m_fBoundRadius;
+	}
+}
+//=============================================================================
+// 画面内かどうかの判定処理(同じフレームでは最初の結果を使う)
+//=============================================================================
+bool CObjectX::IsInView(void)
+{
+	unsigned int nFrame = CCulling::GetFrame();
+
+	if (m_nCullFrame == nFrame)
+	{
+		return m_bInView;
+	}
+
+	UpdateWorldBounds();
+
+	m_nCullFrame = nFrame;
+	m_bInView = CCulling::IsVisibleSphere(m_boundCenter, m_fBoundRadius, GetCullType());
+
+	return m_bInView;
 }
 //=============================================================================
-// }eA̎擾
+// マテリアルの取得
 //=============================================================================
 D3DXCOLOR CObjectX::GetMaterialColor(void) const
 {
 	if (m_pBuffMat && m_dwNumMat > 0)
 	{
 		D3DXMATERIAL* pMat = (D3DXMATERIAL*)m_pBuffMat->GetBufferPointer();
-		return pMat[0].MatD3D.Diffuse;  // 0Ԗڂ̃}eÅgUFԂ
+		return pMat[0].MatD3D.Diffuse;  // 0番目のマテリアルの拡散光色を返す
 	}
 
-	return INIT_XCOL_WHITE; // ftHg
+	return INIT_XCOL_WHITE; // デフォルト白
 }
\ No newline at end of file
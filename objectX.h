@@ -1,19 +1,21 @@
 //=============================================================================
 //
-// Xt@C [objectX.h]
+// Xファイル処理 [objectX.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _OBJECTX_H_// ̃}N`ĂȂ
-#define _OBJECTX_H_// 2dCN[hh~̃}N`
+#ifndef _OBJECTX_H_// このマクロ定義がされていなかったら
+#define _OBJECTX_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
+#include "renderqueue.h"
+#include "culling.h"
 
 //*****************************************************************************
-// Xt@CNX
+// Xファイルクラス
 //*****************************************************************************
 class CObjectX : public CObject
 {
@@ -26,14 +28,20 @@ public:
 	void Uninit(void);
 	void Update(void);
 	void Draw(void);
+	void DrawImmediate(void);
+	bool IsRenderQueued(void) const override;
+	bool IsInView(void);
+	bool IsMeshPending(void) const { return m_bMeshPending; }
 
-	void SetSize(D3DXVECTOR3 size) { m_size = size; }
-	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
-	void SetRot(D3DXVECTOR3 rot) { m_rot = rot; }
+	void SetSize(D3DXVECTOR3 size) { m_size = size; m_bBoundDirty = true; OnTransformChanged(); }
+	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; m_bBoundDirty = true; OnTransformChanged(); }
+	void SetRot(D3DXVECTOR3 rot) { m_rot = rot; m_bBoundDirty = true; OnTransformChanged(); }
 	void SetGhostObject(bool flag) { m_isGhostObject = flag; }
+	void SetRenderPass(CRenderQueue::PASS pass) { m_pass = pass; }
+	void SetUseRenderQueue(bool enable) { m_bRenderQueue = enable; }
 	void SetPath(const char* path)
 	{
-		// nullptr
+		// nullptrだったら
 		if (path == nullptr)
 		{
 			path = " ";
@@ -45,25 +53,54 @@ public:
 	const char* GetPath(void) { return m_szPath; }
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
 	D3DXVECTOR3 GetRot(void) { return m_rot; }
-	D3DXVECTOR3 GetSize(void) const { return m_size; }		// g嗦
-	D3DXVECTOR3 GetModelSize(void) { return m_modelSize; }	// f̌TCY
+	D3DXVECTOR3 GetSize(void) const { return m_size; }		// 拡大率
+	D3DXVECTOR3 GetModelSize(void) { return m_modelSize; }	// モデルの元サイズ
 	virtual D3DXCOLOR GetCol(void) const { return D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f); }
 	D3DXCOLOR GetMaterialColor(void) const;
 	bool IsGhostObject(void) const { return m_isGhostObject; }
+	LPD3DXMESH GetMesh(void) const { return m_pMesh; }
+	LPD3DXBUFFER GetBuffMat(void) const { return m_pBuffMat; }
+	DWORD GetNumMat(void) const { return m_dwNumMat; }
+	int GetIdxTexture(int nMat) const { return m_nIdxTexture[nMat]; }
+	CRenderQueue::PASS GetRenderPass(void) const { return m_pass; }
+	void GetWorldBounds(D3DXVECTOR3* pCenter, float* pRadius);
+	virtual CCulling::TYPE GetCullType(void) { return CCulling::GetPropType(m_fBoundRadius); }
+
+protected:
+	virtual void OnTransformChanged(void) {}	// 位置・向き・大きさが変わった時の通知
+	virtual void OnMeshLoaded(void) {}			// 先読み中のメッシュが届いた時の通知
 
 private:
+	static constexpr float PLACEHOLDER_GRAY = 0.5f;	// 仮の箱の明るさ
+
+	void CalcWorldMatrix(void);
+	void UpdateWorldBounds(void);
+	void SetModelBounds(const D3DXVECTOR3& vMin, const D3DXVECTOR3& vMax);
+	void RegisterTextures(void);
+	bool UpdatePendingMesh(void);
+	void DrawPlaceholder(void);
+
 	int*			m_nIdxTexture;
-	D3DXVECTOR3		m_pos;				// ʒu
-	D3DXVECTOR3		m_rot;				// 
-	D3DXVECTOR3		m_move;				// ړ
-	D3DXVECTOR3		m_size;				// TCY
-	LPD3DXMESH		m_pMesh;			// bVւ̃|C^
-	LPD3DXBUFFER	m_pBuffMat;			// }eAւ̃|C^
-	DWORD			m_dwNumMat;			// }eA
-	D3DXMATRIX		m_mtxWorld;			// [h}gbNX
-	char			m_szPath[MAX_PATH];	// t@CpX
-	D3DXVECTOR3		m_modelSize;		// f̌TCYiŜ̕EEsj
-	bool			m_isGhostObject;	// S[XgIuWFNg()ǂ
+	D3DXVECTOR3		m_pos;				// 位置
+	D3DXVECTOR3		m_rot;				// 向き
+	D3DXVECTOR3		m_move;				// 移動量
+	D3DXVECTOR3		m_size;				// サイズ
+	LPD3DXMESH		m_pMesh;			// メッシュへのポインタ
+	LPD3DXBUFFER	m_pBuffMat;			// マテリアルへのポインタ
+	DWORD			m_dwNumMat;			// マテリアル数
+	D3DXMATRIX		m_mtxWorld;			// ワールドマトリックス
+	char			m_szPath[MAX_PATH];	// ファイルパス
+	D3DXVECTOR3		m_modelSize;		// モデルの元サイズ（全体の幅・高さ・奥行き）
+	D3DXVECTOR3		m_modelCenter;		// モデルの元の中心(AABBの中心)
+	D3DXVECTOR3		m_boundCenter;		// ワールド空間の境界球の中心
+	float			m_fBoundRadius;		// ワールド空間の境界球の半径
+	bool			m_bBoundDirty;		// 境界球の再計算が必要か
+	unsigned int	m_nCullFrame;		// カリングを判定したフレーム
+	bool			m_bInView;			// 判定したフレームで見えていたか
+	bool			m_isGhostObject;	// ゴーストオブジェクト(透明)かどうか
+	CRenderQueue::PASS m_pass;			// 描画パス
+	bool			m_bRenderQueue;		// 描画キューを使うか
+	bool			m_bMeshPending;		// メッシュが先読み中か(届くまでは仮の箱を描く)
 };
 
 #endif
\ No newline at end of file
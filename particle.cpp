@@ -10,6 +10,10 @@
 //*****************************************************************************
 #include "particle.h"
 
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::vector<float> CParticle::m_random;
 
 //=============================================================================
 // コンストラクタ
@@ -17,6 +21,8 @@
 CParticle::CParticle()
 {
 	// 値のクリア
+	m_pos			= INIT_VEC3;// 位置
+	m_col			= INIT_XCOL;// 色
 	m_Dir			= INIT_VEC3;// 方向
 	m_nLife			= 0;		// 寿命
 	m_nMaxParticle	= 0;		// 粒子の最大数
@@ -29,59 +35,38 @@ CParticle::~CParticle()
 	// なし
 }
 //=============================================================================
-// 初期化処理
+// 乱数をまとめて引く処理(演出用の系列から粒子の数×nPerParticle個)
 //=============================================================================
-HRESULT CParticle::Init(void)
+const float* CParticle::DrawRandom(int nPerParticle)
 {
-	// エフェクトの初期化
-	CEffect::Init();
+	int nNum = m_nMaxParticle * nPerParticle;
 
-	return S_OK;
-}
-//=============================================================================
-// 更新処理
-//=============================================================================
-void CParticle::Update(void)
-{
-	// 寿命が尽きたら
-	m_nLife--;
-
-	if (m_nLife <= 0)
+	if ((int)m_random.size() < nNum)
 	{
-		// 終了
-		Uninit();
-		return;
+		m_random.resize(nNum);
 	}
 
-	// エフェクトの更新
-	CEffect::Update();
-}
-
+	CRandom::Get(CRandom::STREAM_EFFECT).FillFloat(m_random.data(), nNum);
 
-//=============================================================================
-// 炎パーティクルの初期化処理
-//=============================================================================
-HRESULT CFireParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/fire.jpg");
+	return m_random.data();
+}
 
-	// パーティクルの初期化処理
-	CParticle::Init();
 
-	return S_OK;
-}
 //=============================================================================
-// 炎パーティクルの更新処理
+// 炎パーティクルの生成処理
 //=============================================================================
-void CFireParticle::Update(void)
+void CFireParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/fire.jpg";
@@ -90,18 +75,18 @@ void CFireParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 120) / 400.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 0.3f + 0.2f;
 
 		desc.move.x = cosf(angle) * speed;
 		desc.move.z = sinf(angle) * speed;
-		desc.move.y = (rand() % 50) / 100.0f + 0.9f; // 上方向
+		desc.move.y = r[2] * 0.5f + 0.9f; // 上方向
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 7.0f + (rand() % 7);
+		desc.fRadius = 7.0f + r[3] * 7.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -113,38 +98,26 @@ void CFireParticle::Update(void)
 		desc.fDecRadius = 0.3f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 水しぶきパーティクルの初期化処理
-//=============================================================================
-HRESULT CWaterParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/smoke.jpg");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 水しぶきパーティクルの更新処理
+// 水しぶきパーティクルの生成処理
 //=============================================================================
-void CWaterParticle::Update(void)
+void CWaterParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/smoke.jpg";
@@ -153,18 +126,18 @@ void CWaterParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 200) / 80.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 2.5f + 0.2f;
 
 		desc.move.x = cosf(angle) * speed;
 		desc.move.z = sinf(angle) * speed;
-		desc.move.y = (rand() % 300) / 70.0f + 0.05f; // 少しだけ上方向
+		desc.move.y = r[2] * 4.3f + 0.05f; // 少しだけ上方向
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 4.0f + (rand() % 5);
+		desc.fRadius = 4.0f + r[3] * 5.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -176,38 +149,26 @@ void CWaterParticle::Update(void)
 		desc.fDecRadius = 0.1f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 埃パーティクルの初期化処理
+// 埃パーティクルの生成処理
 //=============================================================================
-HRESULT CDustParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/smoke.jpg");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 埃パーティクルの更新処理
-//=============================================================================
-void CDustParticle::Update(void)
+void CDustParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/smoke.jpg";
@@ -216,18 +177,18 @@ void CDustParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 50) / 100.0f + 0.02f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 0.5f + 0.02f;
 
 		desc.move.x = cosf(angle) * speed;
-		desc.move.y = (rand() % 20) / 200.0f + 0.02f;
+		desc.move.y = r[2] * 0.1f + 0.02f;
 		desc.move.z = sinf(angle) * speed;
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 10.0f + (rand() % 15);
+		desc.fRadius = 10.0f + r[3] * 15.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -239,38 +200,26 @@ void CDustParticle::Update(void)
 		desc.fDecRadius = 0.28f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 浮遊パーティクルの初期化処理
-//=============================================================================
-HRESULT CFloatingParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/smoke.jpg");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 浮遊パーティクルの更新処理
+// 浮遊パーティクルの生成処理
 //=============================================================================
-void CFloatingParticle::Update(void)
+void CFloatingParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/smoke.jpg";
@@ -279,18 +228,18 @@ void CFloatingParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 150) / 300.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 0.5f + 0.2f;
 
 		desc.move.x = cosf(angle) * speed;
 		desc.move.z = sinf(angle) * speed;
-		desc.move.y = -((rand() % 300) / 100.0f + 0.9f); // 下方向
+		desc.move.y = -(r[2] * 3.0f + 0.9f); // 下方向
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 5.0f + (rand() % 30);
+		desc.fRadius = 5.0f + r[3] * 30.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -302,38 +251,26 @@ void CFloatingParticle::Update(void)
 		desc.fDecRadius = 0.8f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 桜パーティクルのコンストラクタ
-//=============================================================================
-HRESULT CBlossomParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/blossom.png");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 桜パーティクルのコンストラクタ
+// 桜パーティクルの生成処理
 //=============================================================================
-void CBlossomParticle::Update(void)
+void CBlossomParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(距離・角度・高さ・移動量・半径・寿命)
+	const float* pRand = DrawRandom(8);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 8;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/blossom.png";
@@ -342,13 +279,13 @@ void CBlossomParticle::Update(void)
 		float radiusMax = 550.0f;
 
 		// 0.0～1.0 の乱数
-		float r = (rand() % 10000) / 10000.0f;
+		float fDist = r[0];
 
 		// 平方根を取って均一に分布させる
-		float radius = sqrtf(r) * radiusMax;
+		float radius = sqrtf(fDist) * radiusMax;
 
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float height = (rand() % 400) - 30.0f; // -30～370くらい
+		float angle = r[1] * D3DX_PI * 2.0f;
+		float height = r[2] * 400.0f - 30.0f; // -30～370くらい
 
 		// 位置
 		D3DXVECTOR3 offPos = GetPos();
@@ -357,18 +294,18 @@ void CBlossomParticle::Update(void)
 		desc.pos.y = offPos.y + height;
 
 		// 移動量
-		desc.move.x = (rand() % 100 - 50) / 10.0f;
-		desc.move.z = (rand() % 100 - 50) / 10.0f;
-		desc.move.y = (rand() % 50) / 200.0f - 0.01f;
+		desc.move.x = r[3] * 10.0f - 5.0f;
+		desc.move.z = r[4] * 10.0f - 5.0f;
+		desc.move.y = r[5] * 0.25f - 0.01f;
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 6.0f + (rand() % 6);
+		desc.fRadius = 6.0f + r[6] * 6.0f;
 
 		// 寿命の設定
-		desc.nLife = 200 + (rand() % 200);
+		desc.nLife = 200 + (int)(r[7] * 200.0f);
 
 		// 重力の設定
 		desc.fGravity = 0.006f;
@@ -383,38 +320,26 @@ void CBlossomParticle::Update(void)
 		desc.turnSpeed = 0.04f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// お宝パーティクルの初期化処理
+// お宝パーティクルの生成処理
 //=============================================================================
-HRESULT CTreasureParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/treasure_effect.png");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// お宝パーティクルの更新処理
-//=============================================================================
-void CTreasureParticle::Update(void)
+void CTreasureParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/treasure_effect.png";
@@ -423,18 +348,18 @@ void CTreasureParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 200) / 100.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 2.0f + 0.2f;
 
 		desc.move.x = cosf(angle) * speed;
 		desc.move.z = sinf(angle) * speed;
-		desc.move.y = (rand() % 300) / 100.0f + 0.9f; // 上方向
+		desc.move.y = r[2] * 3.0f + 0.9f; // 上方向
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 35.0f + (rand() % 40);
+		desc.fRadius = 35.0f + r[3] * 40.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -446,38 +371,26 @@ void CTreasureParticle::Update(void)
 		desc.fDecRadius = 1.5f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 鬼火パーティクルの初期化処理
+// 鬼火パーティクルの生成処理
 //=============================================================================
-HRESULT COnibiParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/smoke.jpg");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 鬼火パーティクルの更新処理
-//=============================================================================
-void COnibiParticle::Update(void)
+void COnibiParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)//発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/smoke.jpg";
@@ -486,18 +399,18 @@ void COnibiParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 120) / 400.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 0.3f + 0.2f;
 
 		desc.move.x = cosf(angle) * speed;
 		desc.move.z = sinf(angle) * speed;
-		desc.move.y = (rand() % 50) / 100.0f + 0.9f; // 上方向
+		desc.move.y = r[2] * 0.5f + 0.9f; // 上方向
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 7.0f + (rand() % 7);
+		desc.fRadius = 7.0f + r[3] * 7.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -509,38 +422,26 @@ void COnibiParticle::Update(void)
 		desc.fDecRadius = 0.35f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 煙パーティクルの初期化処理
-//=============================================================================
-HRESULT CSmokeParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/smoke_01.png");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 煙パーティクルの更新処理
+// 煙パーティクルの生成処理
 //=============================================================================
-void CSmokeParticle::Update(void)
+void CSmokeParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)// 発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/smoke_01.png";
@@ -549,18 +450,18 @@ void CSmokeParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 200) / 250.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 0.8f + 0.2f;
 
 		desc.move.x = cosf(angle) * speed;
 		desc.move.z = sinf(angle) * speed;
-		desc.move.y = (rand() % 100) / 150.0f + 0.9f; // 上方向
+		desc.move.y = r[2] * 0.67f + 0.9f; // 上方向
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 21.0f + (rand() % 22);
+		desc.fRadius = 21.0f + r[3] * 22.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -581,38 +482,26 @@ void CSmokeParticle::Update(void)
 		desc.turnSpeed = 0.04f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// 血しぶきパーティクルの初期化処理
-//=============================================================================
-HRESULT CBloodSplatter::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/effect000.jpg");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// 血しぶきパーティクルの更新処理
+// 血しぶきパーティクルの生成処理
 //=============================================================================
-void CBloodSplatter::Update(void)
+void CBloodSplatter::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)// 発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/effect000.jpg";
@@ -621,22 +510,22 @@ void CBloodSplatter::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / -180.0f);
-		float speed = (rand() % 300) / 100.0f + 0.2f;
+		float angle = r[0] * -2.0f;
+		float speed = r[1] * 3.0f + 0.2f;
 
 		// 方向
 		D3DXVECTOR3 dir = GetDir();
 
 		// 移動量
 		desc.move.x = cosf(angle) * speed;
-		desc.move.y = (rand() % 20) / 600.0f + 0.9f; // 上方向
+		desc.move.y = r[2] * 0.033f + 0.9f; // 上方向
 		desc.move.z = sinf(angle) * speed;
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 7.0f + (rand() % 3);
+		desc.fRadius = 7.0f + r[3] * 3.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -648,38 +537,26 @@ void CBloodSplatter::Update(void)
 		desc.fDecRadius = 0.3f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
 
 
 //=============================================================================
-// ダッシュパーティクルの初期化処理
+// ダッシュパーティクルの生成処理
 //=============================================================================
-HRESULT CDushParticle::Init(void)
-{
-	// テクスチャを設定しておく
-	SetPath("data/TEXTURE/smoke_01.png");
-
-	// パーティクルの初期化処理
-	CParticle::Init();
-
-	return S_OK;
-}
-//=============================================================================
-// ダッシュパーティクルの更新処理
-//=============================================================================
-void CDushParticle::Update(void)
+void CDushParticle::Emit(void)
 {
 	int nMaxParticle = GetMaxParticle();
 
+	// 乱数は粒子の数だけまとめて引く(角度・速さ・上方向・半径)
+	const float* pRand = DrawRandom(4);
+
 	// パーティクル生成
 	for (int nCnt = 0; nCnt < nMaxParticle; nCnt++)// 発生させたい粒子の数
 	{
 		EffectDesc desc;
+		const float* r = pRand + nCnt * 4;
 
 		// テクスチャの指定
 		desc.path = "data/TEXTURE/smoke_01.png";
@@ -688,22 +565,22 @@ void CDushParticle::Update(void)
 		desc.pos = GetPos();
 
 		// ランダムな角度で横に広がる
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
-		float speed = (rand() % 200) / 250.0f + 0.2f;
+		float angle = r[0] * D3DX_PI * 2.0f;
+		float speed = r[1] * 0.8f + 0.2f;
 
 		// 方向
 		D3DXVECTOR3 dir = GetDir();
 
 		// 移動量
 		desc.move.x = dir.x * speed;
-		desc.move.y = (rand() % 50) / 80.0f + 0.9f; // 上方向
+		desc.move.y = r[2] * 0.63f + 0.9f; // 上方向
 		desc.move.z = sinf(angle) * speed;
 
 		// 色の設定
 		desc.col = GetCol();
 
 		// 半径の設定
-		desc.fRadius = 8.0f + (rand() % 14);
+		desc.fRadius = 8.0f + r[3] * 14.0f;
 
 		// 寿命の設定
 		desc.nLife = GetLife();
@@ -724,9 +601,6 @@ void CDushParticle::Update(void)
 		desc.turnSpeed = 0.1f;
 
 		// エフェクトの設定
-		CEffect::Create(desc);
+		CParticleSystem::Emit(desc, GetCategory());
 	}
-
-	// パーティクルの更新処理
-	CParticle::Update();
 }
\ No newline at end of file
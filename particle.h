@@ -1,83 +1,90 @@
 //=============================================================================
 //
-// p[eBN [particle.h]
+// パーティクル処理 [particle.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _PARTICLE_H_// ̃}N`ĂȂ
-#define _PARTICLE_H_// 2dCN[hh~̃}N`
+#ifndef _PARTICLE_H_// このマクロ定義がされていなかったら
+#define _PARTICLE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
-#include "effect.h"
-#include "unordered_map"
-#include "functional"
+#include "particlesystem.h"
+#include "random.h"
 
 //*****************************************************************************
-// p[eBNNX
+// パーティクルクラス(生成した時に粒子をまとめてパーティクル管理に出す)
 //*****************************************************************************
-class CParticle : public CEffect
+class CParticle
 {
 public:
 	CParticle();
-	~CParticle();
+	virtual ~CParticle();
 
 	//*************************************************************************
-	// p[eBNev[g
+	// パーティクル生成テンプレート
 	//*************************************************************************
-	// particleType : p[eBNNX
+	// particleType : 生成したいパーティクルクラス名
 	template <typename particleType>
-	static particleType* Create(D3DXVECTOR3 dir, D3DXVECTOR3 pos, D3DXCOLOR col, int nLife, int nMaxParticle)
+	static void Create(D3DXVECTOR3 dir, D3DXVECTOR3 pos, D3DXCOLOR col, int nLife, int nMaxParticle)
 	{
-		// nꂽ^CParticlepĂȂꍇ
-		static_assert(std::is_base_of<CParticle, particleType>::value, "^CParticlepĂ܂B");
+		// 渡された型がCParticleを継承していなかった場合
+		static_assert(std::is_base_of<CParticle, particleType>::value, "型はCParticleを継承していません。");
 
-		particleType* pParticle = new particleType();// ^̃CX^X
+		// 粒子を出すだけなのでオブジェクトにはしない
+		particleType particle;
 
-		// nullptr
-		if (!pParticle)
+		if (dir != INIT_VEC3)
 		{
-			return nullptr;
+			particle.SetDir(dir);
 		}
 
-		// s
-		if (FAILED(pParticle->Init()))
-		{
-			return nullptr;
-		}
+		particle.SetPos(pos);
+		particle.SetCol(col);
+		particle.SetLife(nLife);
 
-		if (dir != INIT_VEC3)
+		// 予算と見え方から出す数を決める(画面外なら出さない)
+		particle.m_nMaxParticle = CEffectBudget::Request(particle.GetCategory(), pos, nMaxParticle);
+
+		if (particle.m_nMaxParticle <= 0)
 		{
-			pParticle->SetDir(dir);
+			return;
 		}
 
-		pParticle->SetPos(pos);
-		pParticle->SetCol(col);
-		pParticle->SetLife(nLife);
-		pParticle->m_nMaxParticle = nMaxParticle;
-
-		return pParticle;
+		// 粒子の生成
+		particle.Emit();
 	}
 
-	HRESULT Init(void);
-	void Update(void);
+	virtual void Emit(void) = 0;
+	virtual CEffectBudget::CATEGORY GetCategory(void) = 0;
 
+	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
+	void SetCol(D3DXCOLOR col) { m_col = col; }
 	void SetLife(int nLife) { m_nLife = nLife; }
 	void SetDir(D3DXVECTOR3 dir) { m_Dir = dir; }
 
+	D3DXVECTOR3 GetPos(void) { return m_pos; }
+	D3DXCOLOR GetCol(void) { return m_col; }
 	int GetLife(void) { return m_nLife; }
 	int GetMaxParticle(void) { return m_nMaxParticle; }
 	D3DXVECTOR3 GetDir(void) { return m_Dir; }
 
+protected:
+	const float* DrawRandom(int nPerParticle);
+
 private:
-	D3DXVECTOR3 m_Dir;			// 
-	int			m_nLife;		// 
-	int			m_nMaxParticle;	// q̐
+	static std::vector<float> m_random;	// まとめて引いた乱数(使い回す)
+
+	D3DXVECTOR3 m_pos;			// 位置
+	D3DXCOLOR	m_col;			// 色
+	D3DXVECTOR3 m_Dir;			// 方向
+	int			m_nLife;		// 寿命
+	int			m_nMaxParticle;	// 粒子の数
 };
 
 //*****************************************************************************
-// p[eBNNX
+// 炎パーティクルクラス
 //*****************************************************************************
 class CFireParticle : public CParticle
 {
@@ -85,15 +92,15 @@ public:
 	CFireParticle() {}
 	~CFireParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_FIRE; }
 
 private:
 
 };
 
 //*****************************************************************************
-// Ԃp[eBNNX
+// 水しぶきパーティクルクラス
 //*****************************************************************************
 class CWaterParticle : public CParticle
 {
@@ -101,15 +108,15 @@ public:
 	CWaterParticle() {}
 	~CWaterParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_WATER; }
 
 private:
 
 };
 
 //*****************************************************************************
-// p[eBNNX
+// 埃パーティクルクラス
 //*****************************************************************************
 class CDustParticle : public CParticle
 {
@@ -117,15 +124,15 @@ public:
 	CDustParticle() {}
 	~CDustParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_DUST; }
 
 private:
 
 };
 
 //*****************************************************************************
-// Vp[eBNNX
+// 浮遊パーティクルクラス
 //*****************************************************************************
 class CFloatingParticle : public CParticle
 {
@@ -133,15 +140,15 @@ public:
 	CFloatingParticle() {}
 	~CFloatingParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_FLOATING; }
 
 private:
 
 };
 
 //*****************************************************************************
-// p[eBNNX
+// 桜パーティクルクラス
 //*****************************************************************************
 class CBlossomParticle : public CParticle
 {
@@ -149,15 +156,15 @@ public:
 	CBlossomParticle() {}
 	~CBlossomParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_BLOSSOM; }
 
 private:
 
 };
 
 //*****************************************************************************
-// p[eBNNX
+// お宝パーティクルクラス
 //*****************************************************************************
 class CTreasureParticle : public CParticle
 {
@@ -165,15 +172,15 @@ public:
 	CTreasureParticle() {}
 	~CTreasureParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_TREASURE; }
 
 private:
 
 };
 
 //*****************************************************************************
-// S΃p[eBNNX
+// 鬼火パーティクルクラス
 //*****************************************************************************
 class COnibiParticle : public CParticle
 {
@@ -181,15 +188,15 @@ public:
 	COnibiParticle() {}
 	~COnibiParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_ONIBI; }
 
 private:
 
 };
 
 //*****************************************************************************
-// p[eBNNX
+// 煙パーティクルクラス
 //*****************************************************************************
 class CSmokeParticle : public CParticle
 {
@@ -197,15 +204,15 @@ public:
 	CSmokeParticle() {}
 	~CSmokeParticle() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_SMOKE; }
 
 private:
 
 };
 
 //*****************************************************************************
-// Ԃp[eBNNX
+// 血しぶきパーティクルクラス
 //*****************************************************************************
 class CBloodSplatter : public CParticle
 {
@@ -213,15 +220,15 @@ public:
 	CBloodSplatter() {}
 	~CBloodSplatter() {}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_BLOOD; }
 
 private:
 
 };
 
 //*****************************************************************************
-// _bVp[eBNNX
+// ダッシュパーティクルクラス
 //*****************************************************************************
 class CDushParticle : public CParticle
 {
@@ -229,8 +236,8 @@ public:
 	CDushParticle() {}
 	~CDushParticle(){}
 
-	HRESULT Init(void);
-	void Update(void);
+	void Emit(void) override;
+	CEffectBudget::CATEGORY GetCategory(void) override { return CEffectBudget::CATEGORY_DUSH; }
 
 private:
 
@@ -0,0 +1,855 @@
+//=============================================================================
+//
+// パーティクル管理処理 [particlesystem.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "particlesystem.h"
+#include "renderer.h"
+#include "manager.h"
+#include "emmintrin.h"
+#include "random.h"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::vector<CParticleSystem::Pool> CParticleSystem::m_pools;
+LPDIRECT3DVERTEXBUFFER9 CParticleSystem::m_pVtxBuff = nullptr;
+LPDIRECT3DINDEXBUFFER9 CParticleSystem::m_pIdxBuff = nullptr;
+int CParticleSystem::m_nVtxCursor = 0;
+int CParticleSystem::m_nNumDropped = 0;
+
+//=============================================================================
+// 初期化処理
+//=============================================================================
+HRESULT CParticleSystem::Init(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	// インデックスバッファの生成(中身は変わらないので最初に作っておく)
+	if (FAILED(pDevice->CreateIndexBuffer(sizeof(WORD) * 6 * BATCH_QUAD,
+		D3DUSAGE_WRITEONLY,
+		D3DFMT_INDEX16,
+		D3DPOOL_MANAGED,
+		&m_pIdxBuff,
+		NULL)))
+	{
+		return E_FAIL;
+	}
+
+	WORD* pIdx = nullptr;
+
+	if (SUCCEEDED(m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0)))
+	{
+		for (int nCnt = 0; nCnt < BATCH_QUAD; nCnt++)
+		{
+			WORD nTop = (WORD)(nCnt * 4);
+
+			// 左上・右上・左下 / 左下・右上・右下
+			pIdx[0] = nTop + 0;
+			pIdx[1] = nTop + 1;
+			pIdx[2] = nTop + 2;
+			pIdx[3] = nTop + 2;
+			pIdx[4] = nTop + 1;
+			pIdx[5] = nTop + 3;
+			pIdx += 6;
+		}
+
+		m_pIdxBuff->Unlock();
+	}
+
+	// 粒子は使われ始めた時に配列を作る
+	m_pools.clear();
+	m_nNumDropped = 0;
+	CEffectBudget::Reset();
+
+	// 頂点バッファの生成
+	RestoreDevice();
+
+	return S_OK;
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CParticleSystem::Uninit(void)
+{
+	// 粒子とテクスチャの参照の破棄
+	Clear();
+
+	// 頂点バッファの破棄
+	InvalidateDevice();
+
+	// インデックスバッファの破棄
+	if (m_pIdxBuff != nullptr)
+	{
+		m_pIdxBuff->Release();
+		m_pIdxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット前の破棄処理(動的頂点バッファはD3DPOOL_DEFAULTなので作り直す)
+//=============================================================================
+void CParticleSystem::InvalidateDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		m_pVtxBuff->Release();
+		m_pVtxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット後の生成処理
+//=============================================================================
+void CParticleSystem::RestoreDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		return;
+	}
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4 * BUFFER_QUAD,
+		D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY,
+		FVF_VERTEX_3D,
+		D3DPOOL_DEFAULT,
+		&m_pVtxBuff,
+		NULL);
+
+	// 次の書き込みで捨てさせる
+	m_nVtxCursor = BUFFER_QUAD;
+}
+//=============================================================================
+// 粒子の追加処理
+//=============================================================================
+bool CParticleSystem::Emit(const EffectDesc& desc, CEffectBudget::CATEGORY category)
+{
+	// 予算を超えるなら出さない
+	if (!CEffectBudget::CanSpawn(category))
+	{
+		return false;
+	}
+
+	const char* pPath = (desc.path != nullptr) ? desc.path : "";
+	Pool* pPool = nullptr;
+
+	// 同じテクスチャとブレンドの配列を探す(種類は数個なので順番に見る)
+	for (auto& pool : m_pools)
+	{
+		if (pool.bBlend == desc.bBlend && pool.path == pPath)
+		{
+			pPool = &pool;
+			break;
+		}
+	}
+
+	if (pPool == nullptr)
+	{
+		m_pools.emplace_back();
+		pPool = &m_pools.back();
+
+		CreatePool(pPool, POOL_CAPACITY);
+		pPool->path = pPath;
+		pPool->bBlend = desc.bBlend;
+
+		// テクスチャが無い時(描画しない確認処理など)は登録しない
+		CTexture* pTexture = CManager::GetTexture();
+		pPool->nIdxTexture = (pTexture != nullptr) ? pTexture->RegisterDynamic(pPath) : -1;
+	}
+
+	// 一杯なら出さない
+	if (pPool->nNum >= pPool->nCapacity)
+	{
+		m_nNumDropped++;
+		return false;
+	}
+
+	Push(pPool, desc, category);
+
+	return true;
+}
+//=============================================================================
+// 更新処理
+//=============================================================================
+void CParticleSystem::Update(void)
+{
+	for (auto& pool : m_pools)
+	{
+		// 移動・重力・半径・寿命・回転をまとめて進める
+		Simulate(&pool, 0, pool.nNum);
+
+		// 消えた粒子を詰める
+		Compact(&pool);
+
+		// 更新したエフェクト数の計測
+		CTelemetry::Add(CTelemetry::COUNTER_EFFECT, pool.nNum);
+	}
+}
+//=============================================================================
+// 描画処理(テクスチャとブレンドごとに1回で描く)
+//=============================================================================
+void CParticleSystem::Draw(void)
+{
+	if (m_pVtxBuff == nullptr || m_pIdxBuff == nullptr)
+	{
+		return;
+	}
+
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
+
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// カメラの右と上(頂点はワールド座標でカメラに向けて作る)
+	D3DXMATRIX mtxView;
+	pDevice->GetTransform(D3DTS_VIEW, &mtxView);
+
+	D3DXVECTOR3 right(mtxView._11, mtxView._21, mtxView._31);
+	D3DXVECTOR3 up(mtxView._12, mtxView._22, mtxView._32);
+
+	// ワールドマトリックスは単位行列
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixIdentity(&mtxWorld);
+	pDevice->SetTransform(D3DTS_WORLD, &mtxWorld);
+
+	// ライトを無効にする
+	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);
+
+	// Zテスト
+	pDevice->SetRenderState(D3DRS_ZFUNC, D3DCMP_LESSEQUAL);	// Zの比較方法
+	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, FALSE);		// Zバッファに書き込まない
+
+	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
+	pDevice->SetIndices(m_pIdxBuff);
+	pDevice->SetFVF(FVF_VERTEX_3D);
+
+	for (const auto& pool : m_pools)
+	{
+		if (pool.nNum == 0)
+		{
+			continue;
+		}
+
+		SetBlendState(pDevice, pool.bBlend);
+
+		// テクスチャの設定
+		pDevice->SetTexture(0, pTexture->GetAddress(pool.nIdxTexture));
+
+		int nCursor = 0;
+
+		while (nCursor < pool.nNum)
+		{
+			// 残りに入りきらなければ捨てて先頭から使う(描画中の所は上書きしない)
+			DWORD flags = D3DLOCK_NOOVERWRITE;
+
+			if (m_nVtxCursor + BATCH_QUAD > BUFFER_QUAD)
+			{
+				flags = D3DLOCK_DISCARD;
+				m_nVtxCursor = 0;
+			}
+
+			VERTEX_3D* pVtx = nullptr;
+
+			if (FAILED(pDevice->LockVertexBuffer(m_pVtxBuff, sizeof(VERTEX_3D) * 4 * m_nVtxCursor,
+				sizeof(VERTEX_3D) * 4 * BATCH_QUAD, (void**)&pVtx, flags)))
+			{
+				break;
+			}
+
+			int nNumQuad = WriteQuads(pool, &nCursor, BATCH_QUAD, right, up, true, pVtx);
+
+			pDevice->UnlockVertexBuffer(m_pVtxBuff);
+
+			if (nNumQuad > 0)
+			{
+				pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, m_nVtxCursor * 4, 0, nNumQuad * 4, 0, nNumQuad * 2);
+				m_nVtxCursor += nNumQuad;
+			}
+		}
+
+		ResetBlendState(pDevice, pool.bBlend);
+	}
+
+	// 元に戻す
+	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);	// Zバッファに書き込む
+
+	// ライトを有効にする
+	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);
+}
+//=============================================================================
+// 全ての粒子の破棄処理(シーンの切り替え時)
+//=============================================================================
+void CParticleSystem::Clear(void)
+{
+	CTexture* pTexture = CManager::GetTexture();
+
+	// テクスチャの参照を外す
+	for (auto& pool : m_pools)
+	{
+		if (pTexture != nullptr)
+		{
+			pTexture->Release(pool.nIdxTexture);
+		}
+	}
+
+	m_pools.clear();
+	m_nNumDropped = 0;
+	CEffectBudget::Reset();
+}
+//=============================================================================
+// 生きている粒子の数の取得
+//=============================================================================
+int CParticleSystem::GetNumAlive(void)
+{
+	int nNum = 0;
+
+	for (const auto& pool : m_pools)
+	{
+		nNum += pool.nNum;
+	}
+
+	return nNum;
+}
+//=============================================================================
+// 配列の確保処理
+//=============================================================================
+void CParticleSystem::CreatePool(Pool* pPool, int nCapacity)
+{
+	pPool->nIdxTexture = -1;
+	pPool->bBlend = true;
+	pPool->nNum = 0;
+	pPool->nCapacity = nCapacity;
+
+	// SIMDで4つずつ読むので端数分の余白を付ける
+	size_t size = (size_t)nCapacity + 4;
+
+	pPool->posX.assign(size, 0.0f);
+	pPool->posY.assign(size, 0.0f);
+	pPool->posZ.assign(size, 0.0f);
+	pPool->moveX.assign(size, 0.0f);
+	pPool->moveY.assign(size, 0.0f);
+	pPool->moveZ.assign(size, 0.0f);
+	pPool->radius.assign(size, 0.0f);
+	pPool->decRadius.assign(size, 0.0f);
+	pPool->gravity.assign(size, 0.0f);
+	pPool->rot.assign(size, 0.0f);
+	pPool->turnSpeed.assign(size, 0.0f);
+	pPool->life.assign(size, 0);
+	pPool->col.assign(size, 0);
+	pPool->category.assign(size, CEffectBudget::CATEGORY_OTHER);
+}
+//=============================================================================
+// 配列の末尾に粒子を入れる処理
+//=============================================================================
+void CParticleSystem::Push(Pool* pPool, const EffectDesc& desc, CEffectBudget::CATEGORY category)
+{
+	int nIdx = pPool->nNum++;
+
+	pPool->posX[nIdx] = desc.pos.x;
+	pPool->posY[nIdx] = desc.pos.y;
+	pPool->posZ[nIdx] = desc.pos.z;
+	pPool->moveX[nIdx] = desc.move.x;
+	pPool->moveY[nIdx] = desc.move.y;
+	pPool->moveZ[nIdx] = desc.move.z;
+	pPool->radius[nIdx] = desc.fRadius;
+	pPool->decRadius[nIdx] = desc.fDecRadius;
+	pPool->gravity[nIdx] = desc.fGravity;
+	pPool->rot[nIdx] = 0.0f;
+	pPool->turnSpeed[nIdx] = desc.bTurn ? desc.turnSpeed : 0.0f;
+	pPool->life[nIdx] = desc.nLife;
+	pPool->col[nIdx] = desc.col;
+	pPool->category[nIdx] = (unsigned char)category;
+
+	// 予算に数える
+	CEffectBudget::OnSpawn(category);
+}
+//=============================================================================
+// 粒子を進める処理(範囲ごとに独立しているので分割して別スレッドでも回せる)
+//=============================================================================
+void CParticleSystem::Simulate(Pool* pPool, int nStart, int nEnd)
+{
+	float* pPosX = pPool->posX.data();
+	float* pPosY = pPool->posY.data();
+	float* pPosZ = pPool->posZ.data();
+	float* pMoveX = pPool->moveX.data();
+	float* pMoveY = pPool->moveY.data();
+	float* pMoveZ = pPool->moveZ.data();
+	float* pRadius = pPool->radius.data();
+	const float* pDecRadius = pPool->decRadius.data();
+	const float* pGravity = pPool->gravity.data();
+	float* pRot = pPool->rot.data();
+	const float* pTurnSpeed = pPool->turnSpeed.data();
+	int* pLife = pPool->life.data();
+
+	const __m128 zero = _mm_setzero_ps();
+	const __m128i one = _mm_set1_epi32(1);
+
+	int nCnt = nStart;
+
+	// 4つずつまとめて進める
+	for (; nCnt + 4 <= nEnd; nCnt += 4)
+	{
+		// 重力加速度
+		__m128 moveY = _mm_add_ps(_mm_loadu_ps(pMoveY + nCnt), _mm_loadu_ps(pGravity + nCnt));
+		_mm_storeu_ps(pMoveY + nCnt, moveY);
+
+		// 位置を更新
+		_mm_storeu_ps(pPosX + nCnt, _mm_add_ps(_mm_loadu_ps(pPosX + nCnt), _mm_loadu_ps(pMoveX + nCnt)));
+		_mm_storeu_ps(pPosY + nCnt, _mm_add_ps(_mm_loadu_ps(pPosY + nCnt), moveY));
+		_mm_storeu_ps(pPosZ + nCnt, _mm_add_ps(_mm_loadu_ps(pPosZ + nCnt), _mm_loadu_ps(pMoveZ + nCnt)));
+
+		// 半径の減衰(0で止める)
+		__m128 radius = _mm_sub_ps(_mm_loadu_ps(pRadius + nCnt), _mm_loadu_ps(pDecRadius + nCnt));
+		_mm_storeu_ps(pRadius + nCnt, _mm_max_ps(radius, zero));
+
+		// 回転
+		_mm_storeu_ps(pRot + nCnt, _mm_add_ps(_mm_loadu_ps(pRot + nCnt), _mm_loadu_ps(pTurnSpeed + nCnt)));
+
+		// 寿命
+		__m128i life = _mm_loadu_si128((const __m128i*)(pLife + nCnt));
+		_mm_storeu_si128((__m128i*)(pLife + nCnt), _mm_sub_epi32(life, one));
+	}
+
+	// 端数
+	for (; nCnt < nEnd; nCnt++)
+	{
+		pMoveY[nCnt] += pGravity[nCnt];
+
+		pPosX[nCnt] += pMoveX[nCnt];
+		pPosY[nCnt] += pMoveY[nCnt];
+		pPosZ[nCnt] += pMoveZ[nCnt];
+
+		pRadius[nCnt] = std::max(pRadius[nCnt] - pDecRadius[nCnt], 0.0f);
+		pRot[nCnt] += pTurnSpeed[nCnt];
+		pLife[nCnt]--;
+	}
+}
+//=============================================================================
+// 消えた粒子を末尾の粒子で埋める処理(並びは変わるが配列は詰まったまま)
+//=============================================================================
+void CParticleSystem::Compact(Pool* pPool)
+{
+	int nCnt = 0;
+
+	while (nCnt < pPool->nNum)
+	{
+		if (pPool->life[nCnt] > 0 && pPool->radius[nCnt] > 0.0f)
+		{
+			nCnt++;
+			continue;
+		}
+
+		// 予算から外す
+		CEffectBudget::OnDeath((CEffectBudget::CATEGORY)pPool->category[nCnt]);
+
+		int nLast = --pPool->nNum;
+
+		pPool->posX[nCnt] = pPool->posX[nLast];
+		pPool->posY[nCnt] = pPool->posY[nLast];
+		pPool->posZ[nCnt] = pPool->posZ[nLast];
+		pPool->moveX[nCnt] = pPool->moveX[nLast];
+		pPool->moveY[nCnt] = pPool->moveY[nLast];
+		pPool->moveZ[nCnt] = pPool->moveZ[nLast];
+		pPool->radius[nCnt] = pPool->radius[nLast];
+		pPool->decRadius[nCnt] = pPool->decRadius[nLast];
+		pPool->gravity[nCnt] = pPool->gravity[nLast];
+		pPool->rot[nCnt] = pPool->rot[nLast];
+		pPool->turnSpeed[nCnt] = pPool->turnSpeed[nLast];
+		pPool->life[nCnt] = pPool->life[nLast];
+		pPool->col[nCnt] = pPool->col[nLast];
+		pPool->category[nCnt] = pPool->category[nLast];
+	}
+}
+//=============================================================================
+// 粒子の四角形を頂点に書き込む処理(書いた四角形の数を返す)
+//=============================================================================
+int CParticleSystem::WriteQuads(const Pool& pool, int* pCursor, int nMaxQuad, const D3DXVECTOR3& right, const D3DXVECTOR3& up,
+	bool bCull, VERTEX_3D* pVtx)
+{
+	static const D3DXVECTOR2 aCorner[4] =
+	{
+		D3DXVECTOR2(-1.0f, +1.0f),	// 左上
+		D3DXVECTOR2(+1.0f, +1.0f),	// 右上
+		D3DXVECTOR2(-1.0f, -1.0f),	// 左下
+		D3DXVECTOR2(+1.0f, -1.0f),	// 右下
+	};
+
+	static const D3DXVECTOR2 aTex[4] =
+	{
+		D3DXVECTOR2(0.0f, 0.0f),
+		D3DXVECTOR2(1.0f, 0.0f),
+		D3DXVECTOR2(0.0f, 1.0f),
+		D3DXVECTOR2(1.0f, 1.0f),
+	};
+
+	int nNumQuad = 0;
+	int nIdx = *pCursor;
+
+	for (; nIdx < pool.nNum && nNumQuad < nMaxQuad; nIdx++)
+	{
+		D3DXVECTOR3 pos(pool.posX[nIdx], pool.posY[nIdx], pool.posZ[nIdx]);
+		float fRadius = pool.radius[nIdx];
+
+		// 画面外や遠くの粒子は描画しない
+		if (bCull && !CCulling::IsVisibleSphere(pos, fRadius, CCulling::TYPE_EFFECT))
+		{
+			continue;
+		}
+
+		float fRot = pool.rot[nIdx];
+		float c = 1.0f;
+		float s = 0.0f;
+
+		if (fRot != 0.0f)
+		{
+			c = cosf(fRot);
+			s = sinf(fRot);
+		}
+
+		for (int nCnt = 0; nCnt < 4; nCnt++)
+		{
+			// 板の上で回転させてからカメラに向ける
+			float x = (aCorner[nCnt].x * c - aCorner[nCnt].y * s) * fRadius;
+			float y = (aCorner[nCnt].x * s + aCorner[nCnt].y * c) * fRadius;
+
+			pVtx[nCnt].pos = pos + right * x + up * y;
+			pVtx[nCnt].nor = D3DXVECTOR3(0.0f, 0.0f, -1.0f);
+			pVtx[nCnt].col = pool.col[nIdx];
+			pVtx[nCnt].tex = aTex[nCnt];
+		}
+
+		pVtx += 4;
+		nNumQuad++;
+	}
+
+	*pCursor = nIdx;
+
+	return nNumQuad;
+}
+//=============================================================================
+// ブレンドの設定処理(CEffectと同じ設定)
+//=============================================================================
+void CParticleSystem::SetBlendState(CRenderDevice* pDevice, bool bBlend)
+{
+	if (!bBlend)
+	{
+		return;
+	}
+
+	// αブレンディングを加算合成に設定
+	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE);
+
+	// αテストを有効
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);
+	pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
+	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);// 0より大きかったら描画
+}
+//=============================================================================
+// ブレンドを元に戻す処理
+//=============================================================================
+void CParticleSystem::ResetBlendState(CRenderDevice* pDevice, bool bBlend)
+{
+	if (!bBlend)
+	{
+		return;
+	}
+
+	// αテストを無効に戻す
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);
+
+	// αブレンディングを元に戻す
+	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+}
+//=============================================================================
+// ベンチマーク処理(ウィンドウを出さずに5万粒子で計測して終了する)
+//=============================================================================
+bool CParticleSystem::RunBenchmark(const char* filename)
+{
+	// 1粒子1オブジェクトだった頃と同じ並び(比較用)
+	struct Legacy
+	{
+		D3DXVECTOR3 pos, move;
+		D3DXCOLOR col;
+		float fRadius, fDecRadius, fGravity, fRot, fTurnSpeed;
+		int nLife;
+	};
+
+	Pool pool;
+	CreatePool(&pool, BENCH_NUM);
+
+	std::vector<Legacy> legacy(BENCH_NUM);
+
+	// 同じ粒子を両方に入れる(途中で消えないように寿命は長くする)
+	CRandom random(1);
+
+	for (int nCnt = 0; nCnt < BENCH_NUM; nCnt++)
+	{
+		EffectDesc desc;
+
+		float angle = random.Angle();
+		float speed = random.Range(0.2f, 0.5f);
+
+		desc.pos = D3DXVECTOR3(random.Range(-1000.0f, 1000.0f), random.Range(0.0f, 400.0f), random.Range(-1000.0f, 1000.0f));
+		desc.move = D3DXVECTOR3(cosf(angle) * speed, random.Range(0.9f, 1.4f), sinf(angle) * speed);
+		desc.col = D3DXCOLOR(1.0f, 0.6f, 0.3f, 0.8f);
+		desc.fRadius = random.Range(1000.0f, 1007.0f);
+		desc.fDecRadius = 0.01f;
+		desc.fGravity = -0.001f;
+		desc.nLife = BENCH_FRAME * 4;
+		desc.bTurn = (nCnt % 2) == 0;
+		desc.turnSpeed = 0.04f;
+
+		Push(&pool, desc, CEffectBudget::CATEGORY_OTHER);
+
+		Legacy& particle = legacy[nCnt];
+		particle.pos = desc.pos;
+		particle.move = desc.move;
+		particle.col = desc.col;
+		particle.fRadius = desc.fRadius;
+		particle.fDecRadius = desc.fDecRadius;
+		particle.fGravity = desc.fGravity;
+		particle.fRot = 0.0f;
+		particle.fTurnSpeed = desc.bTurn ? desc.turnSpeed : 0.0f;
+		particle.nLife = desc.nLife;
+	}
+
+	D3DXVECTOR3 right(1.0f, 0.0f, 0.0f);
+	D3DXVECTOR3 up(0.0f, 1.0f, 0.0f);
+
+	LARGE_INTEGER freq, start, end;
+	QueryPerformanceFrequency(&freq);
+
+	auto toMs = [&](void) { return (double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)freq.QuadPart / BENCH_FRAME; };
+
+	// 配列ごとの更新
+	QueryPerformanceCounter(&start);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		Simulate(&pool, 0, pool.nNum);
+		Compact(&pool);
+	}
+
+	QueryPerformanceCounter(&end);
+	double fSimulateMs = toMs();
+
+	// 1粒子ずつの更新
+	QueryPerformanceCounter(&start);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		for (auto& particle : legacy)
+		{
+			particle.move.y += particle.fGravity;
+			particle.pos += particle.move;
+			particle.fRadius = std::max(particle.fRadius - particle.fDecRadius, 0.0f);
+			particle.fRot += particle.fTurnSpeed;
+			particle.nLife--;
+		}
+	}
+
+	QueryPerformanceCounter(&end);
+	double fLegacyMs = toMs();
+
+	// 結果が一致するか(並べ替えが起きていないので同じ添字で比べられる)
+	bool bMatch = pool.nNum == BENCH_NUM;
+
+	for (int nCnt = 0; nCnt < pool.nNum && bMatch; nCnt++)
+	{
+		bMatch = fabsf(pool.posY[nCnt] - legacy[nCnt].pos.y) < 0.01f &&
+			fabsf(pool.radius[nCnt] - legacy[nCnt].fRadius) < 0.01f &&
+			pool.life[nCnt] == legacy[nCnt].nLife;
+	}
+
+	// 頂点の書き込み(メモリ上)
+	std::vector<VERTEX_3D> vtx((size_t)BATCH_QUAD * 4);
+
+	QueryPerformanceCounter(&start);
+
+	for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+	{
+		int nCursor = 0;
+
+		while (nCursor < pool.nNum)
+		{
+			WriteQuads(pool, &nCursor, BATCH_QUAD, right, up, false, vtx.data());
+		}
+	}
+
+	QueryPerformanceCounter(&end);
+	double fWriteMs = toMs();
+
+	// 頂点バッファへの書き込み(デバイスが作れた時だけ)
+	double fDynamicMs = -1.0;
+	double fPerObjectMs = -1.0;
+	int nNumBatch = 0;
+	bool bDevice = false;
+
+	LPDIRECT3D9 pD3D = Direct3DCreate9(D3D_SDK_VERSION);
+	LPDIRECT3DDEVICE9 pDevice = nullptr;
+
+	if (pD3D != nullptr)
+	{
+		D3DPRESENT_PARAMETERS d3dpp;
+		ZeroMemory(&d3dpp, sizeof(d3dpp));
+		d3dpp.BackBufferWidth = 1;
+		d3dpp.BackBufferHeight = 1;
+		d3dpp.BackBufferFormat = D3DFMT_UNKNOWN;
+		d3dpp.SwapEffect = D3DSWAPEFFECT_DISCARD;
+		d3dpp.Windowed = TRUE;
+
+		if (FAILED(pD3D->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_NULLREF, GetDesktopWindow(),
+			D3DCREATE_SOFTWARE_VERTEXPROCESSING, &d3dpp, &pDevice)))
+		{
+			pDevice = nullptr;
+		}
+	}
+
+	if (pDevice != nullptr)
+	{
+		bDevice = true;
+
+		// 1つの動的頂点バッファに詰める
+		LPDIRECT3DVERTEXBUFFER9 pVtxBuff = nullptr;
+
+		if (SUCCEEDED(pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4 * BUFFER_QUAD,
+			D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, FVF_VERTEX_3D, D3DPOOL_DEFAULT, &pVtxBuff, NULL)))
+		{
+			int nVtxCursor = BUFFER_QUAD;
+
+			QueryPerformanceCounter(&start);
+
+			for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+			{
+				int nCursor = 0;
+
+				while (nCursor < pool.nNum)
+				{
+					DWORD flags = D3DLOCK_NOOVERWRITE;
+
+					if (nVtxCursor + BATCH_QUAD > BUFFER_QUAD)
+					{
+						flags = D3DLOCK_DISCARD;
+						nVtxCursor = 0;
+					}
+
+					VERTEX_3D* pVtx = nullptr;
+
+					if (FAILED(pVtxBuff->Lock(sizeof(VERTEX_3D) * 4 * nVtxCursor, sizeof(VERTEX_3D) * 4 * BATCH_QUAD, (void**)&pVtx, flags)))
+					{
+						break;
+					}
+
+					nVtxCursor += WriteQuads(pool, &nCursor, BATCH_QUAD, right, up, false, pVtx);
+					pVtxBuff->Unlock();
+
+					if (nFrame == 0)
+					{
+						nNumBatch++;
+					}
+				}
+			}
+
+			QueryPerformanceCounter(&end);
+			fDynamicMs = toMs();
+
+			pVtxBuff->Release();
+		}
+
+		// 粒子ごとの頂点バッファ(CObjectBillboardと同じ作り)
+		std::vector<LPDIRECT3DVERTEXBUFFER9> buffers(BENCH_NUM, nullptr);
+		bool bCreated = true;
+
+		for (auto& pBuff : buffers)
+		{
+			if (FAILED(pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * 4, D3DUSAGE_WRITEONLY, FVF_VERTEX_3D,
+				D3DPOOL_MANAGED, &pBuff, NULL)))
+			{
+				bCreated = false;
+				break;
+			}
+		}
+
+		if (bCreated)
+		{
+			QueryPerformanceCounter(&start);
+
+			for (int nFrame = 0; nFrame < BENCH_FRAME; nFrame++)
+			{
+				for (int nCnt = 0; nCnt < BENCH_NUM; nCnt++)
+				{
+					VERTEX_3D* pVtx = nullptr;
+
+					if (SUCCEEDED(buffers[nCnt]->Lock(0, 0, (void**)&pVtx, 0)))
+					{
+						int nCursor = nCnt;
+						WriteQuads(pool, &nCursor, 1, right, up, false, pVtx);
+						buffers[nCnt]->Unlock();
+					}
+				}
+			}
+
+			QueryPerformanceCounter(&end);
+			fPerObjectMs = toMs();
+		}
+
+		for (auto& pBuff : buffers)
+		{
+			if (pBuff != nullptr)
+			{
+				pBuff->Release();
+			}
+		}
+
+		pDevice->Release();
+	}
+
+	if (pD3D != nullptr)
+	{
+		pD3D->Release();
+	}
+
+	// 計測用の粒子は予算に残さない
+	CEffectBudget::Reset();
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "particles              : %d\n", BENCH_NUM);
+	fprintf(pFile, "frames                 : %d\n", BENCH_FRAME);
+	fprintf(pFile, "result match           : %s\n\n", bMatch ? "yes" : "no");
+	fprintf(pFile, "update soa simd  ms/f  : %.3f\n", fSimulateMs);
+	fprintf(pFile, "update per object ms/f : %.3f\n", fLegacyMs);
+	fprintf(pFile, "write vertex     ms/f  : %.3f\n", fWriteMs);
+
+	if (bDevice)
+	{
+		fprintf(pFile, "dynamic vb       ms/f  : %.3f (%d locks/draws per frame)\n", fDynamicMs, nNumBatch);
+		fprintf(pFile, "vb per particle  ms/f  : %.3f (%d locks/draws per frame)\n", fPerObjectMs, BENCH_NUM);
+	}
+	else
+	{
+		fprintf(pFile, "vertex buffer          : skipped (no device)\n");
+	}
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bMatch;
+}
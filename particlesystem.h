@@ -0,0 +1,89 @@
+//=============================================================================
+//
+// パーティクル管理処理 [particlesystem.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _PARTICLESYSTEM_H_// このマクロ定義がされていなかったら
+#define _PARTICLESYSTEM_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "effect.h"
+#include "effectbudget.h"
+
+//*****************************************************************************
+// 前方宣言
+//*****************************************************************************
+class CRenderDevice;
+
+//*****************************************************************************
+// パーティクル管理クラス(テクスチャとブレンドごとの配列で粒子を持ち、1つの頂点バッファでまとめて描く)
+//*****************************************************************************
+class CParticleSystem
+{
+public:
+	static constexpr int PRIORITY = 5;	// 描画の優先順位(エフェクトと同じ。この優先順位の最後にまとめて描く)
+
+	static HRESULT Init(void);
+	static void Uninit(void);
+	static void InvalidateDevice(void);
+	static void RestoreDevice(void);
+	static bool Emit(const EffectDesc& desc, CEffectBudget::CATEGORY category = CEffectBudget::CATEGORY_OTHER);
+	static void Update(void);
+	static void Draw(void);
+	static void Clear(void);
+	static bool RunBenchmark(const char* filename);
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static int GetNumAlive(void);
+	static int GetNumPool(void) { return (int)m_pools.size(); }
+	static int GetNumDropped(void) { return m_nNumDropped; }
+
+private:
+	static constexpr int	POOL_CAPACITY	= 4096;					// 1つの配列に入る粒子の数(最初に確保しておく)
+	static constexpr int	BATCH_QUAD		= 4096;					// 1回の描画で描く最大の四角形数(16bitインデックスに収める)
+	static constexpr int	BUFFER_QUAD		= BATCH_QUAD * 4;		// 頂点バッファに入る四角形数(使い切ったら捨てて先頭から使う)
+	static constexpr int	BENCH_NUM		= 50000;				// ベンチマークの粒子数
+	static constexpr int	BENCH_FRAME		= 120;					// ベンチマークのフレーム数
+
+	// 同じテクスチャとブレンドの粒子の配列(1要素ずつ別の配列に並べる)
+	typedef struct
+	{
+		std::string				path;			// テクスチャのパス
+		int						nIdxTexture;	// テクスチャインデックス
+		bool					bBlend;			// 加算合成するか
+		int						nNum;			// 生きている粒子の数
+		int						nCapacity;		// 入る粒子の数
+		std::vector<float>		posX, posY, posZ;		// 位置
+		std::vector<float>		moveX, moveY, moveZ;	// 移動量
+		std::vector<float>		radius;			// 半径
+		std::vector<float>		decRadius;		// 半径の減衰量
+		std::vector<float>		gravity;		// 重力
+		std::vector<float>		rot;			// 回転
+		std::vector<float>		turnSpeed;		// 回転スピード
+		std::vector<int>		life;			// 寿命
+		std::vector<D3DCOLOR>	col;			// 色
+		std::vector<unsigned char>	category;	// 種類(予算の数え直しに使う)
+	}Pool;
+
+	static void CreatePool(Pool* pPool, int nCapacity);
+	static void Push(Pool* pPool, const EffectDesc& desc, CEffectBudget::CATEGORY category);
+	static void Simulate(Pool* pPool, int nStart, int nEnd);
+	static void Compact(Pool* pPool);
+	static int WriteQuads(const Pool& pool, int* pCursor, int nMaxQuad, const D3DXVECTOR3& right, const D3DXVECTOR3& up,
+		bool bCull, VERTEX_3D* pVtx);
+	static void SetBlendState(CRenderDevice* pDevice, bool bBlend);
+	static void ResetBlendState(CRenderDevice* pDevice, bool bBlend);
+
+	static std::vector<Pool>		m_pools;		// 粒子の配列
+	static LPDIRECT3DVERTEXBUFFER9	m_pVtxBuff;		// 全粒子共通の動的頂点バッファ
+	static LPDIRECT3DINDEXBUFFER9	m_pIdxBuff;		// 四角形のインデックスバッファ
+	static int						m_nVtxCursor;	// 頂点バッファの次に書き込む四角形の位置
+	static int						m_nNumDropped;	// 配列が一杯で出せなかった粒子の数
+};
+
+#endif
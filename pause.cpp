@@ -20,7 +20,7 @@ CPause::CPause(int nPriority) : CObject2D(nPriority)
 {
 	// 値のクリア
 	memset(m_szPath, 0, sizeof(m_szPath));	// ファイルパス
-	m_nIdxTexture	= 0;					// テクスチャインデックス
+	m_nIdxTexture	= -1;					// テクスチャインデックス
 	m_isSelected	= false;				// 選択したかどうか
 }
 //=============================================================================
@@ -90,7 +90,11 @@ HRESULT CPause::Init(void)
 // 終了処理
 //=============================================================================
 void CPause::Uninit(void)
-{	
+{
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
+
 	// 2Dオブジェクトの終了処理
 	CObject2D::Uninit();
 }
@@ -117,17 +121,11 @@ void CPause::Update(void)
 //=============================================================================
 void CPause::Draw(void)
 {
-	// テクスチャの取得
-	CTexture* pTexture = CManager::GetTexture();
-
 	// ポーズ状態だったら
 	if (CGame::GetisPaused())
 	{
-		// デバイスの取得
-		LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
 		// テクスチャの設定
-		pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
+		SetIdxTexture(m_nIdxTexture);
 
 		// 2Dオブジェクトの描画処理
 		CObject2D::Draw();
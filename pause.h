@@ -1,20 +1,20 @@
 //=============================================================================
 //
-// |[Y [pause.h]
+// ポーズ処理 [pause.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _PAUSE_H_// ̃}N`ĂȂ
-#define _PAUSE_H_// 2dCN[hh~̃}N`
+#ifndef _PAUSE_H_// このマクロ定義がされていなかったら
+#define _PAUSE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object2D.h"
 
 
 //*****************************************************************************
-// |[YNX
+// ポーズクラス
 //*****************************************************************************
 class CPause : public CObject2D
 {
@@ -22,12 +22,12 @@ public:
 	CPause(int nPriority = 7);
 	~CPause();
 
-	// Iڂ̎
+	// 選択項目の種類
 	typedef enum
 	{
-		MENU_CONTINUE = 0,		// Q[ɖ߂
-		MENU_RETRY,				// Q[蒼
-		MENU_QUIT,				// ^Cgʂɖ߂
+		MENU_CONTINUE = 0,		// ゲームに戻る
+		MENU_RETRY,				// ゲームをやり直す
+		MENU_QUIT,				// タイトル画面に戻る
 		MENU_MAX
 	}MENU;
 
@@ -49,18 +49,18 @@ public:
 		strcpy_s(m_szPath, MAX_PATH, path);
 	}
 
-	// IԐݒE擾
+	// 選択状態設定・取得
 	void SetSelected(bool selected) { m_isSelected = selected; }
 	bool IsSelected(void) const { return m_isSelected; }
 
 private:
-	int		m_nIdxTexture;				// eNX`CfbNX
-	char	m_szPath[MAX_PATH];			// t@CpX
-	bool	m_isSelected;				// I񂾂
+	int		m_nIdxTexture;				// テクスチャインデックス
+	char	m_szPath[MAX_PATH];			// ファイルパス
+	bool	m_isSelected;				// 選んだか
 };
 
 //*****************************************************************************
-// ReBj[ڃNX
+// コンティニュー項目クラス
 //*****************************************************************************
 class CContinue : public CPause
 {
@@ -75,7 +75,7 @@ private:
 };
 
 //*****************************************************************************
-// gCڃNX
+// リトライ項目クラス
 //*****************************************************************************
 class CRetry : public CPause
 {
@@ -90,7 +90,7 @@ private:
 };
 
 //*****************************************************************************
-// IڃNX
+// 終了項目クラス
 //*****************************************************************************
 class CQuit : public CPause
 {
@@ -1,91 +1,75 @@
 //=============================================================================
 //
-// |[Y}l[W[ [pausemanager.cpp]
+// ポーズマネージャー処理 [pausemanager.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "pausemanager.h"
 #include "manager.h"
 #include "game.h"
+#include "spritebatch.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CPauseManager::CPauseManager()
 {
-    // l̃NA
-    m_pVtxBuff      = nullptr;  // _obt@ւ̃|C^
-    m_SelectedIndex = 0;        // ICfbNX
-    m_inputLock     = false;    // ͐tO
+    // 値のクリア
+    memset(m_aVtx, 0, sizeof(m_aVtx));// 背景用頂点
+    m_SelectedIndex = 0;        // 選択したインデックス
+    m_inputLock     = false;    // 入力制限フラグ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CPauseManager::~CPauseManager()
 {
-    // Ȃ
+    // なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 void CPauseManager::Init(void)
 {
-    // foCX̎擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+    VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-    // _obt@̐
-    pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-        D3DUSAGE_WRITEONLY,
-        FVF_VERTEX_2D,
-        D3DPOOL_MANAGED,
-        &m_pVtxBuff,
-        NULL);
-
-    VERTEX_2D* pVtx;// _ւ̃|C^
-
-    // _obt@bNA_ւ̃|C^擾
-    m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-    // _W̐ݒ
+    // 頂点座標の設定
     pVtx[0].pos = D3DXVECTOR3(0.0f, 0.0f, 0.0f);
     pVtx[1].pos = D3DXVECTOR3(1920.0f, 0.0f, 0.0f);
     pVtx[2].pos = D3DXVECTOR3(0.0f, 1080.0f, 0.0f);
     pVtx[3].pos = D3DXVECTOR3(1920.0f, 1080.0f, 0.0f);
 
-    // rhw̐ݒ
+    // rhwの設定
     pVtx[0].rhw = 1.0f;
     pVtx[1].rhw = 1.0f;
     pVtx[2].rhw = 1.0f;
     pVtx[3].rhw = 1.0f;
 
-    // _J[̐ݒ
+    // 頂点カラーの設定
     pVtx[0].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
     pVtx[1].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
     pVtx[2].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
     pVtx[3].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
 
-    // eNX`W̐ݒ
+    // テクスチャ座標の設定
     pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
     pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
     pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
     pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
 
-    // _obt@AbN
-    m_pVtxBuff->Unlock();
-
-    // ɂ
+    // 空にする
     m_Items.clear();
 
-    // ̏ʒuiUpdateŏ㏑j
+    // 仮の初期位置（Updateで上書き）
     for (int nCnt = 0; nCnt < ITEM_NUM; nCnt++)
     {
         CPause* pause = nullptr;
 
-        // |[Yڂ̐
+        // ポーズ項目の生成
         switch (nCnt)
         {
         case CPause::MENU_CONTINUE:
@@ -99,7 +83,7 @@ void CPauseManager::Init(void)
             break;
         }
 
-        // |[Y̏
+        // ポーズの初期化処理
         pause->Init();
 
         pause->SetSelected(false);
@@ -111,22 +95,15 @@ void CPauseManager::Init(void)
     m_inputLock = false;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CPauseManager::Uninit(void)
 {
-    // _obt@̔j
-    if (m_pVtxBuff != nullptr)
-    {
-        m_pVtxBuff->Release();
-        m_pVtxBuff = nullptr;
-    }
-
-    // ɂ
+    // 空にする
     m_Items.clear();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CPauseManager::Update(void)
 {
@@ -135,23 +112,23 @@ void CPauseManager::Update(void)
         return;
     }
 
-    // obNobt@TCY̎擾
+    // バックバッファサイズの取得
     float screenW = (float)CManager::GetRenderer()->GetBackBufferWidth();
     float screenH = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
-    // ɂ炷
+    // 横にずらす
     float baseX = screenW * ANCHOR_X;
     float startY = screenH * ANCHOR_Y;
 
-    // TCYʃTCYɔĒ
+    // サイズも画面サイズに伴って調整
     float itemW = screenW * ITEM_WRATE;
     float itemH = screenH * ITEM_HRATE;
     float spacingY = screenH * SPACING_YRATE;
 
-    // ڂ̈ʒuXV
+    // 項目の位置更新
     for (int nCnt = 0; nCnt < (int)m_Items.size(); nCnt++)
     {
-        // TCY̍XV
+        // サイズの更新
         m_Items[nCnt]->SetSize(itemW, itemH);
 
         D3DXVECTOR3 pos(
@@ -160,28 +137,28 @@ void CPauseManager::Update(void)
             0.0f
         );
 
-        // ʒu̍XV
+        // 位置の更新
         m_Items[nCnt]->SetPos(pos);
     }
 
     int mouseOver = GetMouseOverIndex();
 
-    // }EXI[o[̑IύXSE
+    // マウスオーバー時の選択変更＆SE
     if (mouseOver != -1 && mouseOver != m_SelectedIndex)
     {
         m_SelectedIndex = mouseOver;
 
-        // ISE
+        // 選択SE
         CManager::GetSound()->Play(CSound::SOUND_LABEL_SELECT);
     }
 
-    // Q[pbhł̏㉺ړ
+    // ゲームパッドでの上下移動
     bool up = CManager::GetInputJoypad()->GetTrigger(CInputJoypad::JOYKEY_UP);
     bool down = CManager::GetInputJoypad()->GetTrigger(CInputJoypad::JOYKEY_DOWN);
 
     if ((up || down) && !m_inputLock)
     {
-        // ISE
+        // 選択SE
         CManager::GetSound()->Play(CSound::SOUND_LABEL_SELECT);
 
         if (up)
@@ -210,18 +187,18 @@ void CPauseManager::Update(void)
         m_inputLock = false;
     }
 
-    // NbN܂̓Q[pbh{^Ŏs
+    // クリックまたはゲームパッドボタンで実行
     if (CManager::GetFade()->GetFade() == CFade::FADE_NONE)
     {
         bool confirm = false;
 
-        // }EXNbN
+        // マウスクリック
         if (mouseOver != -1 && CManager::GetInputMouse()->GetTrigger(0))
         {
             confirm = true;
         }
 
-        // Q[pbh
+        // ゲームパッド
         if (CManager::GetInputJoypad()->GetTrigger(CInputJoypad::JOYKEY_A))
         {
             confirm = true;
@@ -229,42 +206,30 @@ void CPauseManager::Update(void)
 
         if (confirm)
         {
-            // SE
+            // 決定SE
             CManager::GetSound()->Play(CSound::SOUND_LABEL_ENTER);
 
-            // eڂ̑I
+            // 各項目の選択時処理
             m_Items[m_SelectedIndex]->Execute();
         }
     }
 
-    // IԍXV
+    // 選択状態更新
     for (size_t nCnt = 0; nCnt < m_Items.size(); nCnt++)
     {
         m_Items[nCnt]->SetSelected(nCnt == static_cast<size_t>(m_SelectedIndex));
 
-        // |[Y̍XV
+        // ポーズの更新処理
         m_Items[nCnt]->Update();
     }
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CPauseManager::Draw(void)
 {
-    // foCX̎擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-    // _obt@f[^Xg[ɐݒ
-    pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-    // _tH[}bg̐ݒ
-    pDevice->SetFVF(FVF_VERTEX_2D);
-
-    // eNX`̐ݒ
-    pDevice->SetTexture(0, nullptr);
-
-    // |S̕`
-    pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
+    // 背景をまとめ描画に積む(テクスチャ無し)
+    CSpriteBatch::Submit(m_aVtx, -1);
 
     for (auto item : m_Items)
     {
@@ -275,7 +240,7 @@ void CPauseManager::Draw(void)
     }
 }
 //=============================================================================
-// }EXI
+// マウス選択処理
 //=============================================================================
 int CPauseManager::GetMouseOverIndex(void) const
 {
@@ -1,11 +1,11 @@
 //=============================================================================
 //
-// RpC [pch.cpp]
+// コンパイル処理 [pch.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "pch.h"
\ No newline at end of file
@@ -1,28 +1,28 @@
 //=============================================================================
 //
-// RpC [pch.h]
+// コンパイル処理 [pch.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _PCH_H_// ̃}N`ĂȂ
-#define _PCH_H_// 2dCN[hh~̃}N`
+#ifndef _PCH_H_// このマクロ定義がされていなかったら
+#define _PCH_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// rȟxΏp}N
+// ビルド時の警告対処用マクロ
 //*****************************************************************************
 #define DIRECTINPUT_VERSION (0x0800)							
 
-#define NOMINMAX       // windows.h ̑Oɓ
+#define NOMINMAX       // windows.h の前に入れる
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "windows.h"
-#include "d3dx9.h"												// `揈ɕKv
-#include "dinput.h"												// ͏ɕKv
-#include "Xinput.h"												// WCpbhɕKv
-#include "xaudio2.h"											// 2DTEhɕKv
-#include "X3DAudio.h"											// 3DTEhɕKv
+#include "d3dx9.h"												// 描画処理に必要
+#include "dinput.h"												// 入力処理に必要
+#include "Xinput.h"												// ジョイパッド処理に必要
+#include "xaudio2.h"											// 2Dサウンド処理に必要
+#include "X3DAudio.h"											// 3Dサウンド処理に必要
 #include "array"
 #include "string"
 #include "vector"
@@ -30,33 +30,35 @@
 #include "fstream"
 #include "commdlg.h"
 #include "functional"
+#include "wincodec.h"											// 画像の展開に必要
 
 //*****************************************************************************
-// CũN
+// ライブラリのリンク
 //*****************************************************************************
-#pragma comment(lib,"d3d9.lib")									// `揈ɕKv
-#pragma comment(lib,"d3dx9.lib")								// [d3d9.lib]̊gCu
-#pragma comment(lib,"dxguid.lib")								// DirectXR|[lg(i)gpɕKv
-#pragma comment(lib,"winmm.lib")								// VXe擾ɕKv
-#pragma comment(lib,"dinput8.lib")								// ͏ɕKv
-#pragma comment(lib,"xinput.lib")								// WCpbhɕKv
-#pragma comment(lib,"X3DAudio.lib")								// 3DTEhɕKv
+#pragma comment(lib,"d3d9.lib")									// 描画処理に必要
+#pragma comment(lib,"d3dx9.lib")								// [d3d9.lib]の拡張ライブラリ
+#pragma comment(lib,"dxguid.lib")								// DirectXコンポーネント(部品)使用に必要
+#pragma comment(lib,"winmm.lib")								// システム時刻取得に必要
+#pragma comment(lib,"dinput8.lib")								// 入力処理に必要
+#pragma comment(lib,"xinput.lib")								// ジョイパッド処理に必要
+#pragma comment(lib,"X3DAudio.lib")								// 3Dサウンド処理に必要
+#pragma comment(lib,"windowscodecs.lib")						// 画像の展開に必要
 
 // Bullet Physics
 #include "btBulletDynamicsCommon.h"
 
 //*****************************************************************************
-// }N`
+// マクロ定義
 //*****************************************************************************
-#define CLASS_NAME	  "WindowClass"								// EBhENX̖O
-#define WINDOW_NAME	  "NINJAFT Steal & Vanish"					// EBhE̖O(LvVɕ\)
-#define SCREEN_WIDTH  (1280)									// EBhE̕
-#define SCREEN_HEIGHT (720)										// EBhE̍
+#define CLASS_NAME	  "WindowClass"								// ウィンドウクラスの名前
+#define WINDOW_NAME	  "NINJAFT Steal & Vanish"					// ウィンドウの名前(キャプションに表示)
+#define SCREEN_WIDTH  (1280)									// ウィンドウの幅
+#define SCREEN_HEIGHT (720)										// ウィンドウの高さ
 #define FVF_VERTEX_2D (D3DFVF_XYZRHW|D3DFVF_DIFFUSE|D3DFVF_TEX1)
-#define FVF_VERTEX_3D (D3DFVF_XYZ|D3DFVF_NORMAL|D3DFVF_DIFFUSE|D3DFVF_TEX1)	// WE@EJ[EeNX`
+#define FVF_VERTEX_3D (D3DFVF_XYZ|D3DFVF_NORMAL|D3DFVF_DIFFUSE|D3DFVF_TEX1)	// 座標・法線・カラー・テクスチャ
 
 //*****************************************************************************
-// p}N`
+// 初期化用マクロ定義
 //*****************************************************************************
 #define INIT_VEC3	(D3DXVECTOR3(0.0f, 0.0f, 0.0f))
 #define INIT_COL	(D3DCOLOR_RGBA (0, 0, 0, 255))
@@ -70,37 +72,37 @@
 #define VEC4_YELLOW (D3DXVECTOR4(1.0f, 1.0f, 0.0f, 1.0f))
 
 //*****************************************************************************
-// ʂ̎
+// 画面の種類
 //*****************************************************************************
 typedef enum
 {
-	MODE_TITLE = 0,												// ^Cg
-	MODE_GAME,													// Q[
-	MODE_RESULT,												// Ug
-	MODE_RANKING,												// LO
+	MODE_TITLE = 0,												// タイトル画面
+	MODE_GAME,													// ゲーム画面
+	MODE_RESULT,												// リザルト画面
+	MODE_RANKING,												// ランキング画面
 	MODE_MAX
 }MODE;
 
 //*****************************************************************************
-// _[2D]̍\
+// 頂点情報[2D]の構造体
 //*****************************************************************************
 typedef struct
 {
-	D3DXVECTOR3 pos;											// _W
-	float rhw;													// WϊpW
-	D3DCOLOR col;												// WJ[
-	D3DXVECTOR2 tex;											// eNX`W
+	D3DXVECTOR3 pos;											// 頂点座標
+	float rhw;													// 座標変換用係数
+	D3DCOLOR col;												// 座標カラー
+	D3DXVECTOR2 tex;											// テクスチャ座標
 }VERTEX_2D;
 
 //*****************************************************************************
-// _[3D]̍\
+// 頂点情報[3D]の構造体
 //*****************************************************************************
 typedef struct
 {
-	D3DXVECTOR3 pos;											//_W
-	D3DXVECTOR3 nor;											//@xNg
-	D3DCOLOR col;												//WJ[
-	D3DXVECTOR2 tex;											//eNX`W
+	D3DXVECTOR3 pos;											//頂点座標
+	D3DXVECTOR3 nor;											//法線ベクトル
+	D3DCOLOR col;												//座標カラー
+	D3DXVECTOR2 tex;											//テクスチャ座標
 }VERTEX_3D;
 
 #endif
\ No newline at end of file
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// vC[ [player.cpp]
+// プレイヤー処理 [player.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "player.h"
 #include "texture.h"
@@ -23,46 +23,46 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CPlayer::CPlayer()
 {
-	// l̃NA
-	memset(m_apModel, 0, sizeof(m_apModel));			// f(p[c)ւ̃|C^
-	m_mtxWorld			= {};							// [h}gbNX
-	m_nNumModel			= 0;							// f(p[c)̑
-	m_pShadowS			= nullptr;						// XeVVhEւ̃|C^
-	m_pMotion			= nullptr;						// [Vւ̃|C^
-	m_pTargetTreasure	= nullptr;						// ubNւ̃|C^
-	m_bIsMoving			= false;						// ړ̓tO
-	m_bOnGround			= false;						// ڒntO
-	m_pDebug3D			= nullptr;						// 3DfobO\ւ̃|C^
-	m_isInGrass			= false;						// ͈͓̔
-	m_isInTorch			= false;						// Ă͈͓̔
-	m_isStealth			= false;						// XeXԂ
-	m_canControl		= false;						// tO
-	m_smokeTimer		= 30;							// 
-	m_smokeActive		= true;							// tO
-	m_isGameStartSmoke	= true;							// Q[JntO
-	m_isDead			= false;						// S
-	m_bDamagePhysics	= false;						// _[Wɏd͂g
-	m_HeartbeatCnt		= 0;							// SJE^[
+	// 値のクリア
+	memset(m_apModel, 0, sizeof(m_apModel));			// モデル(パーツ)へのポインタ
+	m_mtxWorld			= {};							// ワールドマトリックス
+	m_nNumModel			= 0;							// モデル(パーツ)の総数
+	m_pShadowS			= nullptr;						// ステンシルシャドウへのポインタ
+	m_pMotion			= nullptr;						// モーションへのポインタ
+	m_pTargetTreasure	= nullptr;						// 埋蔵金ブロックへのポインタ
+	m_bIsMoving			= false;						// 移動入力フラグ
+	m_bOnGround			= false;						// 接地フラグ
+	m_pDebug3D			= nullptr;						// 3Dデバッグ表示へのポインタ
+	m_isInGrass			= false;						// 草の範囲内か
+	m_isInTorch			= false;						// 灯籠の範囲内か
+	m_isStealth			= false;						// ステルス状態か
+	m_canControl		= false;						// 操作フラグ
+	m_smokeTimer		= 30;							// 煙生成時間
+	m_smokeActive		= true;							// 煙フラグ
+	m_isGameStartSmoke	= true;							// ゲーム開始フラグ
+	m_isDead			= false;						// 死亡したか
+	m_bDamagePhysics	= false;						// ダメージ時に重力を使うか
+	m_HeartbeatCnt		= 0;							// 心音カウンター
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CPlayer::~CPlayer()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CPlayer* CPlayer::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot)
 {
 	CPlayer* pPlayer = new CPlayer;
 
-	// nullptr
+	// nullptrだったら
 	if (pPlayer == nullptr)
 	{
 		return nullptr;
@@ -72,7 +72,7 @@ CPlayer* CPlayer::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot)
 	pPlayer->SetRot(D3DXToRadian(rot));
 	pPlayer->SetSize(D3DXVECTOR3(1.2f, 1.2f, 1.2f));
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pPlayer->Init()))
 	{
 		return nullptr;
@@ -81,61 +81,60 @@ CPlayer* CPlayer::Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot)
 	return pPlayer;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CPlayer::Init(void)
 {
 	CModel* pModels[MAX_PARTS];
 	int nNumModels = 0;
 
-	// p[c̓ǂݍ
+	// パーツの読み込み
 	m_pMotion = CMotion::Load("data/motion.txt", pModels, nNumModels, MAX);
 
 	for (int nCnt = 0; nCnt < nNumModels && nCnt < MAX_PARTS; nCnt++)
 	{
 		m_apModel[nCnt] = pModels[nCnt];
 
-		// ItZbgl
+		// オフセット考慮
 		m_apModel[nCnt]->SetOffsetPos(m_apModel[nCnt]->GetPos());
 		m_apModel[nCnt]->SetOffsetRot(m_apModel[nCnt]->GetRot());
 	}
 
-	// p[c
+	// パーツ数を代入
 	m_nNumModel = nNumModels;
 
-	// ڕW̌ݒ
+	// 目標の向きを設定
 	SetRotDest(D3DXVECTOR3(0.0f, D3DXToRadian(180.0f), 0.0f));
 
-	// JvZRC_[̐ݒ
+	// カプセルコライダーの設定
 	CreatePhysics(CAPSULE_RADIUS, CAPSULE_HEIGHT, 2.0f);
 
-	// XeVVhE̐
+	// ステンシルシャドウの生成
 	m_pShadowS = CShadowS::Create("data/MODELS/stencilshadow.x", D3DXVECTOR3(1.0f, 1.0f, 1.0f));
-	m_pShadowS->SetStencilRef(1);// ʂ̃XeVobt@̎Qƒlݒ
 
-	// CX^X̃|C^n
+	// インスタンスのポインタを渡す
 	m_stateMachine.Start(this);
 
-	// Ԃ̃Xe[gZbg
+	// 初期状態のステートをセット
 	m_stateMachine.ChangeState<CPlayer_StartState>();
 
-	// HP̐ݒ
+	// HPの設定
 	SetHp(10.0f);
 
-	//// Q[W𐶐
+	//// ゲージを生成
 	//SetGuages({ 100.0f, 100.0f, 0.0f }, { 0.0f,1.0f,0.0f,1.0f }, { 1.0f,0.0f,0.0f,1.0f }, 420.0f, 20.0f);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CPlayer::Uninit(void)
 {
-	// 蔻̔j
+	// 当たり判定の破棄
 	ReleasePhysics();
 
-	// f̔j
+	// モデルの破棄
 	for (int nCnt = 0; nCnt < MAX_PARTS; nCnt++)
 	{
 		if (m_apModel[nCnt] != nullptr)
@@ -146,66 +145,66 @@ void CPlayer::Uninit(void)
 		}
 	}
 
-	// [V̔j
+	// モーションの破棄
 	if (m_pMotion != nullptr)
 	{
 		delete m_pMotion;
 		m_pMotion = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CPlayer::Update(void)
 {
-	// J̎擾
+	// カメラの取得
 	CCamera* pCamera = CManager::GetCamera();
 
-	// J̊px̎擾
+	// カメラの角度の取得
 	D3DXVECTOR3 CamRot = pCamera->GetRot();
 
-	// Q[pbh̎擾
+	// ゲームパッドの取得
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// bVtB[h̎擾
+	// メッシュフィールドの取得
 	CMeshField* pMeshField = CGenerateMap::GetInstance()->GetMeshField();
 
 	if (pMeshField)
 	{
-		// ڒn
+		// 接地判定
 		m_bOnGround = OnGroundMesh(pMeshField, 35.0f);
 	}
 
-	// Xe[g}VXV
+	// ステートマシン更新
 	m_stateMachine.Update();
 
-	// ͔̎擾
+	// 入力判定の取得
 	InputData input = GatherInput();
 
 #ifdef _DEBUG
-	// L[{[h̎擾
+	// キーボードの取得
 	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
 
 	if (pKeyboard->GetTrigger(DIK_1))
 	{
-		// _[W
+		// ダメージ処理
 		Damage(1.0f);
 	}
 	else if (pKeyboard->GetTrigger(DIK_2))
 	{
-		// 񕜏
+		// 回復処理
 		Heal(1.0f);
 	}
 
 #endif
 	
-	// vC[HPȂ(ȉ)
+	// プレイヤーHPが少ない(半分以下)
 	IsHpFew hpFew;
 	
-	// vC[HPƂĂȂ
+	// プレイヤーHPがとても少ない
 	IsHpVeryFew hpVeryFew;
 
 	if (hpFew.IsSatisfiedBy(*this) && !m_isDead)
@@ -218,7 +217,7 @@ void CPlayer::Update(void)
 			{
 				m_HeartbeatCnt = 0;
 
-				// U
+				// 振動
 				pJoypad->SetVibration(5000, 5000, 15);
 			}
 		}
@@ -228,19 +227,19 @@ void CPlayer::Update(void)
 			{
 				m_HeartbeatCnt = 0;
 
-				// U
+				// 振動
 				pJoypad->SetVibration(5000, 5000, 20);
 			}
 		}
 	}
 
-	// ̃ubNɓ肷邽߁AubN}l[W[擾
+	// 特定のブロックに当たったか判定するため、ブロックマネージャーを取得する
 	CBlockManager* pBlockManager = CGame::GetBlockManager();
 
-	// ̃ubNɓĂ邩肷
+	// 特定のブロックに当たっているか判定する
 	bool playerInGrass = pBlockManager->IsPlayerInGrass();
 
-	// Q[Jn
+	// ゲーム開始時
 	if (m_isGameStartSmoke)
 	{
 		m_smokeActive = true;
@@ -254,7 +253,7 @@ void CPlayer::Update(void)
 		{
 			D3DXVECTOR3 pos = GetPos();
 
-			// Xɏグ
+			// 高さを徐々に上げる
 			pos.y += static_cast<float>(nCnt) * HEIGHT_STEP;
 
 			CParticle::Create<CSmokeParticle>(
@@ -272,23 +271,23 @@ void CPlayer::Update(void)
 		}
 	}
 
-	// ̍XV
+	// 向きの更新処理
 	UpdateRotation(0.09f);
 
-	// ړ͂΃vC[͕
+	// 移動入力があればプレイヤー向きを入力方向に
 	if (input.moveDir.x != 0.0f || input.moveDir.z != 0.0f)
 	{
-		// YĝŖڕW̌擾
+		// Y成分だけを使いたいので目標の向きを取得
 		D3DXVECTOR3 rotDest = GetRotDest();
 
-		// Y͕Ɍ
+		// Yを入力方向に向ける
 		rotDest.y = atan2f(-input.moveDir.x, -input.moveDir.z);
 
-		// ڕW̌ɐݒ肷
+		// 目標の向きに設定する
 		SetRotDest(rotDest);
 	}
 
-	// Bullet݈ʒu擾
+	// Bullet現在位置取得
 	btTransform trans;
 	btRigidBody* pRigidBody = GetRigidBody();
 	pRigidBody->getMotionState()->getWorldTransform(trans);
@@ -297,25 +296,25 @@ void CPlayer::Update(void)
 	D3DXVECTOR3 RigidPos;
 	btVector3 vel = pRigidBody->getLinearVelocity();
 
-	if (pMeshField && m_bOnGround && !m_bDamagePhysics)	// ڒn
+	if (pMeshField && m_bOnGround && !m_bDamagePhysics)	// 接地中
 	{
-		// ڈʒun`ɋz
+		// 見た目位置を地形に吸着
 		float groundY = pMeshField->GetHeight(btPos.getX(), btPos.getZ());
 		float targetY = groundY + COLLIDER_OFFSET;
 
 		float dy = targetY - btPos.getY();
 
-		// olIɒnʂɋziɂɂj
+		// バネ的に地面に吸着（上にも下にも動ける）
 		vel.setY(dy * 5.0f);
 
 		pRigidBody->setLinearVelocity(vel);
 
-		// 
+		// 見た目
 		SetPos(D3DXVECTOR3(btPos.getX(), groundY, btPos.getZ()));
 	}
-	else// 
+	else// 空中
 	{
-		// Bullet哱ŌڂXV
+		// Bullet主導で見た目を更新
 		RigidPos.x = btPos.getX();
 		RigidPos.y = btPos.getY() - COLLIDER_OFFSET;
 		RigidPos.z = btPos.getZ();
@@ -323,117 +322,130 @@ void CPlayer::Update(void)
 		SetPos(RigidPos);
 	}
 
-	// ʒu̎擾
+	// 位置の取得
 	D3DXVECTOR3 pos = GetPos();
 
 	if (pos.y < RESPAWN_HEIGHT)
 	{
-		// X|[
+		// リスポーン処理
 		Respawn(D3DXVECTOR3(0.0f, 30.0f, -300.0f));
 	}
 
 	if (m_pShadowS != nullptr)
 	{
-		// XeVVhËʒuݒ
+		// ステンシルシャドウの位置設定
 		m_pShadowS->SetPosition(GetPos());
 	}
 
-	// Ԃ̎擾
+	// 時間の取得
 	CTime* pTime = CGame::GetTime();
 
 	bool isNight = false;
 
 	if (pTime)
 	{
-		// 邩
+		// 夜か判定
 		isNight = pTime->IsNight();
 	}
 
-	// ̃ubNɓĂ邩肷
+	// 特定のブロックに当たっているか判定する
 	bool playerInTorch = pBlockManager->IsPlayerInTorch() && isNight;
 
-	D3DXVECTOR4 outlineColor = VEC4_BLACK; // ʏ͍
-	float modelAlpha = 1.0f;// f̃At@l
+	D3DXVECTOR4 outlineColor = VEC4_BLACK; // 通常は黒
+	float modelAlpha = 1.0f;// モデルのアルファ値
 
-	if (playerInTorch)// Ăɋ߂Â
+	if (playerInTorch)// 灯籠に近づく
 	{
 		if (!m_isStealth && m_bIsMoving)
 		{
-			outlineColor = VEC4_RED; // ԐF
+			outlineColor = VEC4_RED; // 赤色
 			modelAlpha = 1.0f;
 		}
 		else
 		{
-			outlineColor = VEC4_YELLOW; // F
+			outlineColor = VEC4_YELLOW; // 黄色
 			modelAlpha = 1.0f;
 		}
 	}
-	else if (playerInGrass)// ɓ
+	else if (playerInGrass)// 草に入る
 	{
 		if (!m_isStealth && m_bIsMoving)
 		{
-			outlineColor = VEC4_RED; // ԐF
+			outlineColor = VEC4_RED; // 赤色
 			modelAlpha = 1.0f;
 		}
 		else
 		{
-			outlineColor = D3DXVECTOR4(1.0f, 1.0f, 1.0f, 0.1f);	// 
+			outlineColor = D3DXVECTOR4(1.0f, 1.0f, 1.0f, 0.1f);	// 半透明
 			modelAlpha = 0.1f;
 		}
 	}
 
-	// FKp
+	// 色を適用
 	CModel** models = GetModels();
 	int num = GetNumModels();
 
 	for (int nCnt = 0; nCnt < num; nCnt++)
 	{
-		// AEgCJ[̐ݒ
+		// アウトラインカラーの設定
 		models[nCnt]->SetOutlineColor(outlineColor);
 
-		// fJ[̐ݒ
+		// モデルカラーの設定
 		models[nCnt]->SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, modelAlpha));
 	}
 
-	// [V̍XV
+	// モーションの更新処理
 	m_pMotion->Update(m_apModel, m_nNumModel);
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CPlayer::Draw(void)
 {
-	// foCX̎擾
+	// デバイスの取得
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// vZp}gbNX
+	// 計算用マトリックス
 	D3DXMATRIX mtxRot, mtxTrans, mtxSize;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// TCY𔽉f
+	// サイズを反映
 	D3DXMatrixScaling(&mtxSize, GetSize().x, GetSize().y, GetSize().z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxSize);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, GetRot().y, GetRot().x, GetRot().z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, GetPos().x, GetPos().y, GetPos().z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNXݒ
+	// ワールドマトリックスを設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
+	// 画面外ならパーツの位置だけ更新する(武器の当たり判定がパーツの位置を使うため)
+	bool bInView = IsInView();
+
 	for (int nCntMat = 0; nCntMat < m_nNumModel; nCntMat++)
 	{
-		// f(p[c)̕`
-		if (m_apModel[nCntMat])
+		if (m_apModel[nCntMat] == nullptr)
+		{
+			continue;
+		}
+
+		if (bInView)
 		{
+			// モデル(パーツ)の描画
 			m_apModel[nCntMat]->Draw();
 		}
+		else
+		{
+			// モデル(パーツ)のワールドマトリックスの計算
+			m_apModel[nCntMat]->UpdateWorldMatrix();
+		}
 	}
 
 #ifdef _DEBUG
@@ -441,24 +453,24 @@ void CPlayer::Draw(void)
 	btRigidBody* pRigid = GetRigidBody();
 	btCollisionShape* pShape = GetCollisionShape();
 
-	// JvZRC_[̕`
+	// カプセルコライダーの描画
 	if (pRigid && pShape)
 	{
 		btTransform transform;
 		pRigid->getMotionState()->getWorldTransform(transform);
 
-		m_pDebug3D->DrawCapsuleCollider((btCapsuleShape*)pShape, transform, D3DXCOLOR(1, 1, 1, 1));
+		CDebugProc3D::DrawCapsuleCollider((btCapsuleShape*)pShape, transform, D3DXCOLOR(1, 1, 1, 1), CDebugProc3D::CATEGORY_CHARACTER);
 	}
 
 #endif
 
 }
 //=============================================================================
-// X|[(ڐݒ)
+// リスポーン(直接設定)処理
 //=============================================================================
 void CPlayer::Respawn(D3DXVECTOR3 pos)
 {
-	D3DXVECTOR3 respawnPos = pos; // Cӂ̈ʒu
+	D3DXVECTOR3 respawnPos = pos; // 任意の位置
 
 	GetPos() = respawnPos;
 
@@ -469,7 +481,7 @@ void CPlayer::Respawn(D3DXVECTOR3 pos)
 		pRigid->setLinearVelocity(btVector3(0, 0, 0));
 		pRigid->setAngularVelocity(btVector3(0, 0, 0));
 
-		// [hWXV
+		// ワールド座標更新
 		btTransform trans;
 		trans.setIdentity();
 		trans.setOrigin(btVector3(respawnPos.x, respawnPos.y, respawnPos.z));
@@ -483,7 +495,7 @@ void CPlayer::Respawn(D3DXVECTOR3 pos)
 	}
 }
 //=============================================================================
-// bV̐ڒn
+// メッシュの接地判定
 //=============================================================================
 bool CPlayer::OnGroundMesh(const CMeshField* field, float footOffset)
 {
@@ -509,19 +521,19 @@ bool CPlayer::OnGroundMesh(const CMeshField* field, float footOffset)
 	return (btPos.getY() <= footY + 1.0f);
 }
 //=============================================================================
-// vC[̑OxNg擾
+// プレイヤーの前方ベクトル取得
 //=============================================================================
 D3DXVECTOR3 CPlayer::GetForward(void)
 {
 	D3DXVECTOR3 forward(-m_mtxWorld._31, m_mtxWorld._32, -m_mtxWorld._33);
 
-	// K
+	// 正規化する
 	D3DXVec3Normalize(&forward, &forward);
 
 	return forward;
 }
 //=============================================================================
-// ͔擾֐
+// 入力判定取得関数
 //=============================================================================
 CPlayer::InputData CPlayer::GatherInput(void)
 {
@@ -531,11 +543,11 @@ CPlayer::InputData CPlayer::GatherInput(void)
 	input.stealth = false;
 	m_isStealth = false;
 
-	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();	// L[{[h̎擾
-	CInputJoypad* pJoypad = CManager::GetInputJoypad();			// WCpbh̎擾
-	XINPUT_STATE* pStick = pJoypad->GetStickAngle();		// XeBbN̎擾
-	CCamera* pCamera = CManager::GetCamera();					// J̎擾
-	D3DXVECTOR3 CamRot = pCamera->GetRot();						// Jpx̎擾
+	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();	// キーボードの取得
+	CInputJoypad* pJoypad = CManager::GetInputJoypad();			// ジョイパッドの取得
+	XINPUT_STATE* pStick = pJoypad->GetStickAngle();		// スティックの取得
+	CCamera* pCamera = CManager::GetCamera();					// カメラの取得
+	D3DXVECTOR3 CamRot = pCamera->GetRot();						// カメラ角度の取得
 
 	if (this == nullptr || !m_canControl)
 	{
@@ -543,7 +555,7 @@ CPlayer::InputData CPlayer::GatherInput(void)
 	}
 
 	// ---------------------------
-	// Eё
+	// 忍び足入力
 	// ---------------------------
 	if (pKeyboard->GetPress(DIK_LCONTROL) || pJoypad->GetPressR2())
 	{
@@ -553,7 +565,7 @@ CPlayer::InputData CPlayer::GatherInput(void)
 	m_isStealth = input.stealth || !m_bIsMoving;
 
 	// ---------------------------
-	// ^[WԒ͈ړ͖
+	// タメージ状態中は移動入力無効化
 	// ---------------------------
 	if (m_pMotion->IsCurrentMotion(DAMAGE) || m_isDead)
 	{
@@ -561,7 +573,7 @@ CPlayer::InputData CPlayer::GatherInput(void)
 	}
 
 	// ---------------------------
-	// Q[pbh
+	// ゲームパッド入力
 	// ---------------------------
 	if (pJoypad->GetStick() && pStick)
 	{
@@ -590,7 +602,7 @@ CPlayer::InputData CPlayer::GatherInput(void)
 	}
 
 	// ---------------------------
-	// L[{[h
+	// キーボード入力
 	// ---------------------------
 	if (pKeyboard->GetPress(DIK_W))
 	{
@@ -609,7 +621,7 @@ CPlayer::InputData CPlayer::GatherInput(void)
 		input.moveDir += D3DXVECTOR3(-cosf(CamRot.y), 0, sinf(CamRot.y));
 	}
 
-	// K
+	// 正規化
 	if (input.moveDir.x != 0.0f || input.moveDir.z != 0.0f)
 	{
 		D3DXVec3Normalize(&input.moveDir, &input.moveDir);
@@ -618,16 +630,16 @@ CPlayer::InputData CPlayer::GatherInput(void)
 	return input;
 }
 //=============================================================================
-// _[W
+// ダメージ処理
 //=============================================================================
 void CPlayer::Damage(float fDamage)
 {
 	if (!m_pMotion->IsCurrentMotion(DAMAGE))
 	{
-		// ܂ʂHP
+		// まず共通のHP処理
 		CCharacter::Damage(fDamage);
 
-		// _[WXe[g
+		// ダメージステートへ
 		m_stateMachine.ChangeState<CPlayer_DamageState>();
 	}
 }
@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// vC[ [player.h]
+// プレイヤー処理 [player.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _PLAYER_H_// ̃}N`ĂȂ
-#define _PLAYER_H_// 2dCN[hh~̃}N`
+#ifndef _PLAYER_H_// このマクロ定義がされていなかったら
+#define _PLAYER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "state.h"
 #include "charactermanager.h"
@@ -16,7 +16,7 @@
 #include "blocklist.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CBlock;
 class CDebugProc3D;
@@ -26,7 +26,7 @@ class CModel;
 class CMeshField;
 
 //*****************************************************************************
-// vC[NX
+// プレイヤークラス
 //*****************************************************************************
 class CPlayer : public CCharacter
 {
@@ -34,31 +34,31 @@ public:
 	CPlayer();
 	~CPlayer();
 
-	static constexpr float PLAYER_SPEED			= 22.0f;		// ʏړXs[h
-	static constexpr float INJURY_SPEED			= 12.0f;		// Xs[h
-	static constexpr float STEALTH_SPEED		= 8.0f;			// EшړXs[h
-	static constexpr float DECELERATION_RATE	= 0.82f;		// 
-	static constexpr float ACCEL_RATE			= 0.15f;		// Xs[h̕ԗ
+	static constexpr float PLAYER_SPEED			= 22.0f;		// 通常移動時スピード
+	static constexpr float INJURY_SPEED			= 12.0f;		// 負傷時スピード
+	static constexpr float STEALTH_SPEED		= 8.0f;			// 忍び移動時スピード
+	static constexpr float DECELERATION_RATE	= 0.82f;		// 減速率
+	static constexpr float ACCEL_RATE			= 0.15f;		// スピードの補間率
 
-	// vC[[V̎
+	// プレイヤーモーションの種類
 	typedef enum
 	{
-		NEUTRAL = 0,		// ҋ@
-		MOVE,				// ړ
-		INJURY,				// 
-		STEALTH_MOVE,		// Eё
-		DAMAGE,				// _[W
-		START,				// X^[g
-		DIG_UP,				// @o
+		NEUTRAL = 0,		// 待機
+		MOVE,				// 移動
+		INJURY,				// 負傷
+		STEALTH_MOVE,		// 忍び足
+		DAMAGE,				// ダメージ
+		START,				// スタート時
+		DIG_UP,				// 掘り出し
 		MAX
 	}PLAYER_MOTION;
 
-	// ̓f[^\
+	// 入力データ構造体
 	struct InputData
 	{
-		D3DXVECTOR3 moveDir;	// OړxNg
-		bool attack;			// U
-		bool stealth;			// Eё
+		D3DXVECTOR3 moveDir;	// 前後移動ベクトル
+		bool attack;			// 攻撃入力
+		bool stealth;			// 忍び足入力
 	};
 
 	static CPlayer* Create(D3DXVECTOR3 pos, D3DXVECTOR3 rot);
@@ -71,23 +71,23 @@ public:
 	{
 		D3DXVECTOR3 move = GetMove();
 
-		// 
+		// 減速させる
 		move *= DECELERATION_RATE;
 
 		if (fabsf(move.x) < 0.01f) move.x = 0;
 		if (fabsf(move.z) < 0.01f) move.z = 0;
 
-		// ړʂ̐ݒ
+		// 移動量の設定
 		SetMove(move);
 	}
 
 	//*****************************************************************************
-	// flagment֐
+	// flagment関数
 	//*****************************************************************************
 	bool OnGroundMesh(const CMeshField* field, float footOffset);
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
 	void SetInGrass(bool flag) { m_isInGrass = flag; }
 	void SetInTorch(bool flag) { m_isInTorch = flag; }
@@ -98,7 +98,7 @@ public:
 	void SetTargetTreasure(CBuriedTreasureBlock* p) { m_pTargetTreasure = p; }
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
 	CMotion* GetMotion(void) const { return m_pMotion; }
 	bool GetOnGround(void) { return m_bOnGround; }
@@ -111,7 +111,7 @@ public:
 	bool GetControlFlag(void) { return m_canControl; }
 	CBuriedTreasureBlock* GetTargetTreasure(void) const { return m_pTargetTreasure; }
 
-	// Xe[gpɃtOXV
+	// ステート用にフラグ更新
 	void UpdateMovementFlags(const D3DXVECTOR3& moveDir)
 	{
 		m_bIsMoving = (moveDir.x != 0.0f || moveDir.z != 0.0f);
@@ -120,38 +120,38 @@ public:
 	void Damage(float fDamage) override;
 
 private:
-	static constexpr int	MAX_PARTS			= 32;		// őp[c
-	static constexpr float	CAPSULE_RADIUS		= 10.5f;	// JvZRC_[̔a
-	static constexpr float	CAPSULE_HEIGHT		= 45.5f;	// JvZRC_[̍
-	static constexpr float	RESPAWN_HEIGHT		= -280.0f;	// X|[鍂
-	static constexpr float	COLLIDER_OFFSET		= 35.0f;	// RC_[ItZbgʒu
-	static constexpr int	EFFECT_CREATE_NUM	= 3;		// GtFNg
-	static constexpr float	HEIGHT_STEP			= 30.0f;	// ̑
-	static constexpr int	HEARTBEART_INTERVAL_1 = 60;		// S̃C^[o1iK
-	static constexpr int	HEARTBEART_INTERVAL_2 = 30;		// S̃C^[o2iK
-
-	D3DXMATRIX				m_mtxWorld;						// [h}gbNX
-	CModel*					m_apModel[MAX_PARTS];			// f(p[c)ւ̃|C^
-	CShadowS*				m_pShadowS;						// XeVVhEւ̃|C^
-	CMotion*				m_pMotion;						// [Vւ̃|C^
-	CDebugProc3D*			m_pDebug3D;						// 3DfobO\ւ̃|C^
-	CBuriedTreasureBlock*	m_pTargetTreasure;				// ubNւ̃|C^
-	int						m_nNumModel;					// f(p[c)̑
-	int						m_smokeTimer;					// 
-	int						m_deleyTime;					// ړ܂ł̒x(oŎgp)
-	bool					m_bIsMoving;					// ړ̓tO
-	bool					m_bOnGround;					// ڒntO
-	bool					m_isInGrass;					// ͈͓̔
-	bool					m_isInTorch;					// Ă͈͓̔
-	bool					m_isStealth;					// XeXԂ
-	bool					m_canControl;					// tO
-	bool					m_smokeActive;					// tO
-	bool					m_isGameStartSmoke;				// Q[JntO
-	bool					m_isDead;						// S
-	bool					m_bDamagePhysics;				// _[Wɏd͂g
-	int						m_HeartbeatCnt;					// SJE^[
-
-	// Xe[gǗNX̃CX^X
+	static constexpr int	MAX_PARTS			= 32;		// 最大パーツ数
+	static constexpr float	CAPSULE_RADIUS		= 10.5f;	// カプセルコライダーの半径
+	static constexpr float	CAPSULE_HEIGHT		= 45.5f;	// カプセルコライダーの高さ
+	static constexpr float	RESPAWN_HEIGHT		= -280.0f;	// リスポーンする高さ
+	static constexpr float	COLLIDER_OFFSET		= 35.0f;	// コライダーオフセット位置
+	static constexpr int	EFFECT_CREATE_NUM	= 3;		// エフェクト生成数
+	static constexpr float	HEIGHT_STEP			= 30.0f;	// 高さの増加量
+	static constexpr int	HEARTBEART_INTERVAL_1 = 60;		// 心音のインターバル1段階目
+	static constexpr int	HEARTBEART_INTERVAL_2 = 30;		// 心音のインターバル2段階目
+
+	D3DXMATRIX				m_mtxWorld;						// ワールドマトリックス
+	CModel*					m_apModel[MAX_PARTS];			// モデル(パーツ)へのポインタ
+	CShadowS*				m_pShadowS;						// ステンシルシャドウへのポインタ
+	CMotion*				m_pMotion;						// モーションへのポインタ
+	CDebugProc3D*			m_pDebug3D;						// 3Dデバッグ表示へのポインタ
+	CBuriedTreasureBlock*	m_pTargetTreasure;				// 埋蔵金ブロックへのポインタ
+	int						m_nNumModel;					// モデル(パーツ)の総数
+	int						m_smokeTimer;					// 煙生成時間
+	int						m_deleyTime;					// 移動までの遅延時間(演出等で使用)
+	bool					m_bIsMoving;					// 移動入力フラグ
+	bool					m_bOnGround;					// 接地フラグ
+	bool					m_isInGrass;					// 草の範囲内か
+	bool					m_isInTorch;					// 灯籠の範囲内か
+	bool					m_isStealth;					// ステルス状態か
+	bool					m_canControl;					// 操作フラグ
+	bool					m_smokeActive;					// 煙フラグ
+	bool					m_isGameStartSmoke;				// ゲーム開始フラグ
+	bool					m_isDead;						// 死亡したか
+	bool					m_bDamagePhysics;				// ダメージ時に重力を使うか
+	int						m_HeartbeatCnt;					// 心音カウンター
+
+	// ステートを管理するクラスのインスタンス
 	StateMachine<CPlayer> m_stateMachine;
 };
 
@@ -1,25 +1,25 @@
 //=============================================================================
 //
-// vC[̏ԏ [playerState.h]
+// プレイヤーの状態処理 [playerState.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _PLAYERSTATE_H_// ̃}N`ĂȂ
-#define _PLAYERSTATE_H_//2dCN[hh~̃}N`
+#ifndef _PLAYERSTATE_H_// このマクロ定義がされていなかったら
+#define _PLAYERSTATE_H_//2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
-#include "meshcylinder.h"
 #include "blocklist.h"
 #include "blood.h"
 #include "specbase.h"
 #include "generateMap.h"
 #include "waterfield.h"
 #include "meshOrbit.h"
+#include "random.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CPlayer_StandState;
 class CPlayer_MoveState;
@@ -30,7 +30,7 @@ class CPlayer_InjuryState;
 class CPlayer_DigUpState;
 
 //*****************************************************************************
-// vC[̑ҋ@
+// プレイヤーの待機状態
 //*****************************************************************************
 class CPlayer_StandState :public StateBase<CPlayer>
 {
@@ -38,72 +38,72 @@ public:
 
 	void OnStart(CPlayer* pPlayer)override
 	{
-		// ҋ@[V
+		// 待機モーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::NEUTRAL, 10);
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// ͂擾
+		// 入力を取得
 		CPlayer::InputData input = pPlayer->GatherInput();
 
-		// ͏ԂXV
+		// 入力状態を更新
 		pPlayer->UpdateMovementFlags(input.moveDir);
 
-		// vC[HPȂ
+		// プレイヤーHPが少ない
 		IsHpFew hpFew;
 
-		// 
+		// 減速処理
 		pPlayer->ApplyDeceleration();
 
-		// ړ͂ƃXeX{^Ă
+		// 移動入力とステルスボタンが押されていたら
 		if (pPlayer->GetIsMoving() && input.stealth)
 		{
-			// EёړԂֈڍs
+			// 忍び足移動状態へ移行
 			m_pMachine->ChangeState<CPlayer_StealthMoveState>();
 
 			return;
 		}
-		// ړ݂͂̂ړXe[gɈڍs
+		// 移動入力のみだったら移動ステートに移行
 		else if (pPlayer->GetIsMoving() && !input.stealth)
 		{
 			if (hpFew.IsSatisfiedBy(*pPlayer))
 			{
-				// Ԃֈڍs
+				// 負傷状態へ移行
 				m_pMachine->ChangeState<CPlayer_InjuryState>();
 			}
 			else
 			{
-				// ړԂֈڍs
+				// 移動状態へ移行
 				m_pMachine->ChangeState<CPlayer_MoveState>();
 			}
 
 			return;
 		}
 
-		// --- ubN͈͓̔mF ---
+		// --- 埋蔵金ブロックの範囲内か確認 ---
 		auto buriedTreasureBlocks = CBlockManager::GetBlocksOfType<CBuriedTreasureBlock>();
 
-		// ݂Ȃreturn
+		// 埋蔵金が存在しなかったらreturn
 		if (!buriedTreasureBlocks.empty())
 		{
 			for (CBuriedTreasureBlock* treasure : buriedTreasureBlocks)
 			{
-				// ̕
+				// 埋蔵金の方向
 				D3DXVECTOR3 toTarget = pPlayer->GetPos() - treasure->GetPos();
 				toTarget.y = 0;
 
-				// ߂ĐK
+				// 距離を求めて正規化する
 				float distance = D3DXVec3Length(&toTarget);
 				D3DXVec3Normalize(&toTarget, &toTarget);
 
-				// ͈͊Ȍꍇ͔΂
+				// 範囲外の場合は飛ばす
 				if (distance < TRIGGER_DISTANCE)
 				{
-					// Ώۂɐݒ
+					// 対象に設定
 					pPlayer->SetTargetTreasure(treasure);
 
-					// @oԂֈڍs
+					// 掘り出し状態へ移行
 					m_pMachine->ChangeState<CPlayer_DigUpState>();
 				}
 			}
@@ -116,12 +116,12 @@ public:
 	}
 
 private:
-	static constexpr float TRIGGER_DISTANCE = 40.0f;// 苗
+	static constexpr float TRIGGER_DISTANCE = 40.0f;// 判定距離
 
 };
 
 //*****************************************************************************
-// vC[̈ړ
+// プレイヤーの移動状態
 //*****************************************************************************
 class CPlayer_MoveState :public StateBase<CPlayer>
 {
@@ -129,44 +129,44 @@ public:
 
 	void OnStart(CPlayer* pPlayer)override
 	{
-		// ړ[V
+		// 移動モーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::MOVE, 10);
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// ͎擾
+		// 入力取得
 		CPlayer::InputData input = pPlayer->GatherInput();
 
-		// tOXV
+		// フラグ更新
 		pPlayer->UpdateMovementFlags(input.moveDir);
 
-		// vC[HPȂ
+		// プレイヤーHPが少ない
 		IsHpFew hpFew;
 
-		// Ă
+		// 満たしていたら
 		if (hpFew.IsSatisfiedBy(*pPlayer))
 		{
-			// 
+			// 負傷状態
 			m_pMachine->ChangeState<CPlayer_InjuryState>();
 			return;
 		}
 
-		// ̎擾ɉăXs[hx
+		// 埋蔵金の取得数に応じてスピードを遅くする
 		int treasureCount = CBuriedTreasureBlock::GetTreasureCount();
 
-		// ɓ
+		// 水に入ったか
 		bool playerInWater = CGenerateMap::GetInstance()->GetWaterField()->IsInWater(pPlayer->GetPos());
 
-		// ͏̎擾
-		CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();	// L[{[h̎擾
-		CInputJoypad* pJoypad = CManager::GetInputJoypad();			// WCpbh̎擾
+		// 入力処理の取得
+		CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();	// キーボードの取得
+		CInputJoypad* pJoypad = CManager::GetInputJoypad();			// ジョイパッドの取得
 
-		// 擾ʂɉXs[h
-		float speedRate = 1.0f - treasureCount * DEC_SPEED_RATE;// 5%ቺ
-		speedRate = std::max(speedRate, MAX_DEC_RATE); // ő50%
+		// 埋蔵金取得量に応じたスピード
+		float speedRate = 1.0f - treasureCount * DEC_SPEED_RATE;// 5%ずつ低下
+		speedRate = std::max(speedRate, MAX_DEC_RATE); // 最大50%
 
-		// _bV
+		// ダッシュ入力
 		if ((pKeyboard->GetPress(DIK_LSHIFT) || pJoypad->GetPress(CInputJoypad::JOYKEY_RB)) &&
 			treasureCount <= DASH_PARTICLE_INTERVAL)
 		{
@@ -176,23 +176,23 @@ public:
 			{
 				m_dushTimer = 0;
 
-				// ʒu
+				// 生成位置
 				D3DXVECTOR3 spawnPos = pPlayer->GetPos();
 				spawnPos.y += SPAWN_OFFPOS;
 
-				// 
+				// 生成方向
 				D3DXVECTOR3 dir = pPlayer->GetForward();
 
-				// p[eBN
+				// パーティクル生成
 				CParticle::Create<CDushParticle>(INIT_VEC3, spawnPos, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 90, 3);
 			}
 
-			// _bV̓Xs[h[gグ
+			// ダッシュ時はスピードレートを上げる
 			speedRate = DUSH_SPEED_RATE;
 			
-			// 邽тɃ[g𗎂Ƃ
-			float NewSpeedRate = speedRate - treasureCount * DEC_NEWSPEED_RATE;// 8%ቺ
-			NewSpeedRate = std::max(NewSpeedRate, MAX_DEC_RATE); // ő50%
+			// 埋蔵金を取るたびにレートを落とす
+			float NewSpeedRate = speedRate - treasureCount * DEC_NEWSPEED_RATE;// 8%ずつ低下
+			NewSpeedRate = std::max(NewSpeedRate, MAX_DEC_RATE); // 最大50%
 
 			speedRate = NewSpeedRate;
 		}
@@ -200,11 +200,11 @@ public:
 		{
 			m_dushTimer = 0;
 
-			// [VXs[hxĂ
+			// モーションスピードを遅くしていく
 			pPlayer->GetMotion()->SetMotionSpeedRate(speedRate);
 		}
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CPlayer::PLAYER_SPEED * speedRate;
 
 		D3DXVECTOR3 targetMove = input.moveDir;
@@ -220,53 +220,53 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pPlayer->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CPlayer::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CPlayer::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pPlayer->SetMove(currentMove);
 		
-		// vC[̈ʒu擾
+		// プレイヤーの位置取得
 		D3DXVECTOR3 pos = pPlayer->GetPos();
 
-		// XeXړĂ
+		// ステルスかつ移動していたら
 		if (input.stealth && pPlayer->GetIsMoving())
 		{
-			// EёړԂֈڍs
+			// 忍び足移動状態へ移行
 			m_pMachine->ChangeState<CPlayer_StealthMoveState>();
 			return;
 		}
 
-		// ړĂȂΑҋ@Xe[gɖ߂
+		// 移動していなければ待機ステートに戻す
 		if (!pPlayer->GetIsMoving())
 		{
-			// ҋ@
+			// 待機状態
 			m_pMachine->ChangeState<CPlayer_StandState>();
 		}
 	}
 
 	void OnExit(CPlayer* pPlayer)override
 	{
-		// [VXs[hʏɖ߂
+		// モーションスピードを通常に戻す
 		pPlayer->GetMotion()->SetMotionSpeedRate(1.0f);
 	}
 
 private:
-	static constexpr int	DASH_PARTICLE_INTERVAL	= 5;		// p[eBNԊuit[j
-	static constexpr float	SPAWN_OFFPOS			= 20.0f;	// ʒuItZbg
-	static constexpr float	DUSH_SPEED_RATE			= 1.5f;		// _bṼXs[h[g
-	static constexpr float	DEC_SPEED_RATE			= 0.05f;	// _bVXs[ȟ
-	static constexpr float	DEC_NEWSPEED_RATE		= 0.08f;	// 擾̃_bVXs[ȟ
-	static constexpr float	MAX_DEC_RATE			= 0.5f;		// ő劄(%)
+	static constexpr int	DASH_PARTICLE_INTERVAL	= 5;		// パーティクル発生間隔（フレーム数）
+	static constexpr float	SPAWN_OFFPOS			= 20.0f;	// 生成位置オフセット
+	static constexpr float	DUSH_SPEED_RATE			= 1.5f;		// ダッシュ時のスピードレート
+	static constexpr float	DEC_SPEED_RATE			= 0.05f;	// ダッシュスピードの減少率
+	static constexpr float	DEC_NEWSPEED_RATE		= 0.08f;	// 埋蔵金取得時のダッシュスピードの減少率
+	static constexpr float	MAX_DEC_RATE			= 0.5f;		// 減少する最大割合(%)
 
 	int			m_dushTimer;
 };
 
 //*****************************************************************************
-// vC[̕
+// プレイヤーの負傷状態
 //*****************************************************************************
 class CPlayer_InjuryState :public StateBase<CPlayer>
 {
@@ -274,19 +274,19 @@ public:
 
 	void OnStart(CPlayer* pPlayer)override
 	{
-		// [V
+		// 負傷モーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::INJURY, 10);
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// ͎擾
+		// 入力取得
 		CPlayer::InputData input = pPlayer->GatherInput();
 
-		// tOXV
+		// フラグ更新
 		pPlayer->UpdateMovementFlags(input.moveDir);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CPlayer::INJURY_SPEED /** speedRate*/;
 
 		D3DXVECTOR3 targetMove = input.moveDir;
@@ -302,25 +302,25 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pPlayer->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CPlayer::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CPlayer::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pPlayer->SetMove(currentMove);
 
-		// ʒu擾
+		// 位置を取得
 		D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-		// vC[̈ʒu擾
+		// プレイヤーの位置取得
 		D3DXVECTOR3 pos = pPlayer->GetPos();
 
-		// vC[HPȂ
+		// プレイヤーHPが少ない
 		IsHpFew hpFew;
 
-		// Ă
+		// 満たしていたら
 		if (hpFew.IsSatisfiedBy(*pPlayer))
 		{
 			m_bloodTimer++;
@@ -329,29 +329,29 @@ public:
 			{
 				m_bloodTimer = 0;
 
-				// nʂɖȂ悤ɏɏグ
+				// 地面に埋もれないように少し上に上げる
 				pos.y += OFFSET_HEIGHT;
 
-				// ̃TCY_ɂ
-				float size = (rand()% 15) + 5.0f;
+				// 血痕のサイズをランダムにする
+				float size = CRandom::Get(CRandom::STREAM_EFFECT).Int(15) + 5.0f;
 
-				// ̐
+				// 血痕の生成
 				CBlood::Create(pos, D3DXVECTOR3(90.0f, 0.0f, 0.0f), D3DXCOLOR(0.5f, 0.5f, 0.5f, 1.0f), size, size);
 			}
 		}
 
-		// XeXړĂ
+		// ステルスかつ移動していたら
 		if (input.stealth && pPlayer->GetIsMoving())
 		{
-			// EёړԂֈڍs
+			// 忍び足移動状態へ移行
 			m_pMachine->ChangeState<CPlayer_StealthMoveState>();
 			return;
 		}
 
-		// ړĂȂΑҋ@Xe[gɖ߂
+		// 移動していなければ待機ステートに戻す
 		if (!pPlayer->GetIsMoving())
 		{
-			// ҋ@
+			// 待機状態
 			m_pMachine->ChangeState<CPlayer_StandState>();
 		}
 	}
@@ -362,14 +362,14 @@ public:
 	}
 
 private:
-	static constexpr int	BLOOD_INTERVAL	= 50;	// Ԋuit[j
-	static constexpr float	OFFSET_HEIGHT	= 2.0f;	// ̍̃ItZbg
+	static constexpr int	BLOOD_INTERVAL	= 50;	// 血痕生成間隔（フレーム数）
+	static constexpr float	OFFSET_HEIGHT	= 2.0f;	// 血痕の高さのオフセット
 
-	int m_bloodTimer;		// ^C}[
+	int m_bloodTimer;		// 血痕生成タイマー
 };
 
 //*****************************************************************************
-// vC[̔Eёړ
+// プレイヤーの忍び足移動状態
 //*****************************************************************************
 class CPlayer_StealthMoveState :public StateBase<CPlayer>
 {
@@ -377,19 +377,19 @@ public:
 
 	void OnStart(CPlayer* pPlayer)override
 	{
-		// Eёړ[V
+		// 忍び足移動モーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::STEALTH_MOVE, 10);
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// ͎擾
+		// 入力取得
 		CPlayer::InputData input = pPlayer->GatherInput();
 
-		// tOXV
+		// フラグ更新
 		pPlayer->UpdateMovementFlags(input.moveDir);
 
-		// ڕWxvZ
+		// 目標速度計算
 		float moveSpeed = CPlayer::STEALTH_SPEED;
 
 		D3DXVECTOR3 targetMove = input.moveDir;
@@ -405,27 +405,27 @@ public:
 			targetMove = D3DXVECTOR3(0, 0, 0);
 		}
 
-		// ݑxƂ̕ԁiC[WOj
+		// 現在速度との補間（イージング）
 		D3DXVECTOR3 currentMove = pPlayer->GetMove();
 
 		currentMove.x += (targetMove.x - currentMove.x) * CPlayer::ACCEL_RATE;
 		currentMove.z += (targetMove.z - currentMove.z) * CPlayer::ACCEL_RATE;
 
-		// Ԍ̑xvC[ɃZbg
+		// 補間後の速度をプレイヤーにセット
 		pPlayer->SetMove(currentMove);
 
-		// ړ͂ΈړXe[gɈڍs
+		// 移動入力があれば移動ステートに移行
 		if (pPlayer->GetIsMoving() && !input.stealth)
 		{
-			// ړԂֈڍs
+			// 移動状態へ移行
 			m_pMachine->ChangeState<CPlayer_MoveState>();
 			return;
 		}
 
-		// ړĂȂΑҋ@Xe[gɖ߂
+		// 移動していなければ待機ステートに戻す
 		if(!pPlayer->GetIsMoving())
 		{
-			// ҋ@
+			// 待機状態
 			m_pMachine->ChangeState<CPlayer_StandState>();
 		}
 	}
@@ -440,7 +440,7 @@ private:
 };
 
 //*****************************************************************************
-// vC[̃_[W
+// プレイヤーのダメージ状態
 //*****************************************************************************
 class CPlayer_DamageState :public StateBase<CPlayer>
 {
@@ -450,31 +450,31 @@ public:
 	{
 		pPlayer->SetDamagePhysics(true);
 
-		// Ôߐڒn
+		// 念のため接地解除
 		pPlayer->SetOnGround(false);
 
-		// ̎擾
+		// 音の取得
 		CSound* pSound = CManager::GetSound();
 
-		// WCpbh̎擾
+		// ジョイパッドの取得
 		CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
 		if (pJoypad)
 		{
-			// U
+			// 振動させる
 			pJoypad->SetVibration(20000, 20000, 40);
 		}
 
-		// _[WSE̍Đ
+		// ダメージSEの再生
 		if (pSound)
 		{
 			pSound->Play(CSound::SOUND_LABEL_DAMAGE);
 		}
 
-		// _[W[V
+		// ダメージモーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::DAMAGE, 10);
 		
-		// [_[G̎擾
+		// リーダー敵の取得
 		CEnemy* pEnemy = CCharacterManager::GetInstance().GetCharacter<CEnemy>();
 
 		if (!pEnemy)
@@ -482,7 +482,7 @@ public:
 			return;
 		}
 
-		// ŏ̐iւ̏j
+		// 最初の勢い（後方への初速）
 		D3DXVECTOR3 damageDir = pEnemy->GetForward();
 		D3DXVec3Normalize(&damageDir, &damageDir);
 
@@ -490,37 +490,37 @@ public:
 
 		pPlayer->SetMove(move);
 
-		// 
+		// 上方向初速
 		m_verticalVelocity = FIRST_UP_VELOCITY;
 
-		// ɔf
+		// 物理に反映
 		btVector3 velocity = pPlayer->GetRigidBody()->getLinearVelocity();
 		velocity.setX(move.x);
 		velocity.setY(m_verticalVelocity);
 		velocity.setZ(move.z);
 		pPlayer->GetRigidBody()->setLinearVelocity(velocity);
 
-		//// ʒu
+		//// 生成位置
 		//D3DXVECTOR3 spawnPos = pPlayer->GetPos();
 		//spawnPos.y += 70.0f;
 
-		//// 
+		//// 生成方向
 		//D3DXVECTOR3 dir = pPlayer->GetForward();
 
 		//for (int n = 0; n < 6; n++)
 		//{
-		//	// Ԃp[eBN
+		//	// 血しぶきパーティクル生成
 		//	CParticle::Create<CBloodSplatter>(-dir, spawnPos, D3DXCOLOR(0.8f, 0.0f, 0.0f, 0.8f), 900, 3);
 		//}
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// [V̐isx擾
-		float motionRate = pPlayer->GetMotion()->GetMotionRate(); // 0.0`1.0
+		// モーションの進行度を取得
+		float motionRate = pPlayer->GetMotion()->GetMotionRate(); // 0.0～1.0
 		D3DXVECTOR3 move = pPlayer->GetMove();
 
-		// [VOOړێ
+		// モーション前半だけ前方移動を維持
 		if (motionRate < MOTIONRATE_THRESHOLD)
 		{
 			D3DXVECTOR3 forwardDir = -pPlayer->GetForward();
@@ -528,7 +528,7 @@ public:
 
 			move = forwardDir * SLIDE_POWER;
 
-			// nfalseɖ߂
+			// 着地したらfalseに戻す
 			if (pPlayer->GetOnGround())
 			{
 				pPlayer->SetDamagePhysics(false);
@@ -536,23 +536,23 @@ public:
 		}
 		else
 		{
-			// 㔼͌
+			// 後半は減速
 			move *= JUMP_DECELERATION_RATE;
 			if (fabsf(move.x) < 0.01f) move.x = 0;
 			if (fabsf(move.z) < 0.01f) move.z = 0;
 		}
 
-		// ===== d͏ =====
-		m_verticalVelocity -= GRAVITY; // d͉x
+		// ===== 重力処理 =====
+		m_verticalVelocity -= GRAVITY; // 重力加速度
 		if (m_verticalVelocity < MAX_DOWN_SPEED)
 		{
-			m_verticalVelocity = MAX_DOWN_SPEED; // ő嗎x𐧌
+			m_verticalVelocity = MAX_DOWN_SPEED; // 最大落下速度を制限
 		}
 
-		// ړʂݒ
+		// 移動量を設定
 		pPlayer->SetMove(move);
 
-		// Wbh{fBɔf
+		// リジッドボディに反映
 		btVector3 velocity = pPlayer->GetRigidBody()->getLinearVelocity();
 		velocity.setX(move.x);
 		velocity.setY(m_verticalVelocity);
@@ -561,14 +561,14 @@ public:
 
 		if (pPlayer->GetMotion()->IsCurrentMotionEnd(CPlayer::DAMAGE))
 		{
-			// 񂾂
+			// 死んだら
 			if (pPlayer->IsDead())
 			{
 				pPlayer->SetIsDead(true);
 			}
 			else
 			{
-				// ҋ@
+				// 待機状態
 				m_pMachine->ChangeState<CPlayer_StandState>();
 			}
 		}
@@ -581,19 +581,19 @@ public:
 	}
 
 private:
-	static constexpr float FIRST_UP_VELOCITY		= 50.0f;	// ŏ̗̏
-	static constexpr float SLIDE_POWER				= 15.0f;	// XChp[
-	static constexpr float GRAVITY					= 3.0f;		// d͉x
-	static constexpr float JUMP_DECELERATION_RATE	= 0.88f;	// Wv̌
-	static constexpr float FORWARD_POWER			= 120.0f;	// p[
-	static constexpr float MAX_DOWN_SPEED			= -30.0f;	// ő嗎x
-	static constexpr float MOTIONRATE_THRESHOLD		= 0.4f;		// [V[g臒l
-
-	float m_verticalVelocity; // ㉺x
+	static constexpr float FIRST_UP_VELOCITY		= 50.0f;	// 最初の上方向の力
+	static constexpr float SLIDE_POWER				= 15.0f;	// スライドパワー
+	static constexpr float GRAVITY					= 3.0f;		// 重力加速度
+	static constexpr float JUMP_DECELERATION_RATE	= 0.88f;	// ジャンプ時の減速率
+	static constexpr float FORWARD_POWER			= 120.0f;	// 初速パワー
+	static constexpr float MAX_DOWN_SPEED			= -30.0f;	// 最大落下速度
+	static constexpr float MOTIONRATE_THRESHOLD		= 0.4f;		// モーションレートの閾値
+
+	float m_verticalVelocity; // 上下方向速度
 };
 
 //*****************************************************************************
-// vC[̃X^[g
+// プレイヤーのスタート状態
 //*****************************************************************************
 class CPlayer_StartState :public StateBase<CPlayer>
 {
@@ -601,18 +601,18 @@ public:
 
 	void OnStart(CPlayer* pPlayer)override
 	{
-		// X^[g[V
+		// スタートモーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::START, 10);
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// 
+		// 減速処理
 		pPlayer->ApplyDeceleration();
 
 		if (pPlayer->GetMotion()->IsCurrentMotionEnd(CPlayer::START))
 		{
-			// ҋ@
+			// 待機状態
 			m_pMachine->ChangeState<CPlayer_StandState>();
 		}
 	}
@@ -627,7 +627,7 @@ private:
 };
 
 //*****************************************************************************
-// vC[̌@o
+// プレイヤーの掘り出し状態
 //*****************************************************************************
 class CPlayer_DigUpState :public StateBase<CPlayer>
 {
@@ -635,55 +635,55 @@ public:
 
 	void OnStart(CPlayer* pPlayer)override
 	{
-		// @o[V
+		// 掘り出しモーション
 		pPlayer->GetMotion()->StartBlendMotion(CPlayer::DIG_UP, 10);
 	}
 
 	void OnUpdate(CPlayer* pPlayer)override
 	{
-		// 
+		// 減速処理
 		pPlayer->ApplyDeceleration();
 
-		// ͂擾
+		// 入力を取得
 		CPlayer::InputData input = pPlayer->GatherInput();
 
-		// ͂̍XV
+		// 入力の更新
 		pPlayer->UpdateMovementFlags(input.moveDir);
 
-		// vC[HPȂ
+		// プレイヤーHPが少ない
 		IsHpFew hpFew;
 
-		// ړ͂ƃXeX{^Ă
+		// 移動入力とステルスボタンが押されていたら
 		if (pPlayer->GetIsMoving() && input.stealth)
 		{
-			// EёړԂֈڍs
+			// 忍び足移動状態へ移行
 			m_pMachine->ChangeState<CPlayer_StealthMoveState>();
 			return;
 		}
-		// ړ݂͂̂ړXe[gɈڍs
+		// 移動入力のみだったら移動ステートに移行
 		else if (pPlayer->GetIsMoving())
 		{
 			if (hpFew.IsSatisfiedBy(*pPlayer))
 			{
-				// Ԃֈڍs
+				// 負傷状態へ移行
 				m_pMachine->ChangeState<CPlayer_InjuryState>();
 			}
 			else
 			{
-				// ړԂֈڍs
+				// 移動状態へ移行
 				m_pMachine->ChangeState<CPlayer_MoveState>();
 			}
 
 			return;
 		}
 
-		// Ώۂ̖ubN擾
+		// 対象の埋蔵金ブロックを取得
 		auto* pTreasure = pPlayer->GetTargetTreasure();
 
-		// Ώۂ̖ubN擾mF
+		// 対象の埋蔵金ブロックを取得したか確認
 		if (!pTreasure || pTreasure->IsFinished())
 		{
-			// ҋ@Ԃֈڍs
+			// 待機状態へ移行
 			m_pMachine->ChangeState<CPlayer_StandState>();
 			return;
 		}
@@ -695,7 +695,7 @@ public:
 	}
 
 private:
-	static constexpr float TRIGGER_DISTANCE = 40.0f;// 苗
+	static constexpr float TRIGGER_DISTANCE = 40.0f;// 判定距離
 
 };
 
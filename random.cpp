@@ -0,0 +1,484 @@
+//=============================================================================
+//
+// 乱数処理 [random.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "random.h"
+#include "emmintrin.h"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+CRandom CRandom::m_aStream[STREAM_MAX] =
+{
+	CRandom(0x6a09e667f3bcc908ULL),	// ゲームの進行
+	CRandom(0xbb67ae8584caa73bULL),	// マップ生成
+	CRandom(0x3c6ef372fe94f82bULL),	// 演出
+};
+
+namespace
+{
+	// 左回転
+	inline unsigned int Rotl(unsigned int x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// 上位24bitを[0,1)の小数にする
+	inline float ToFloat(unsigned int x)
+	{
+		return (x >> 8) * (1.0f / 16777216.0f);
+	}
+}
+
+//=============================================================================
+// コンストラクタ
+//=============================================================================
+CRandom::CRandom(unsigned long long seed)
+{
+	// 値のクリア
+	memset(m_aState, 0, sizeof(m_aState));
+	memset(m_aLane, 0, sizeof(m_aLane));
+
+	Seed(seed);
+}
+//=============================================================================
+// シード値の設定処理(全て0にならないようにSplitMix64で広げる)
+//=============================================================================
+void CRandom::Seed(unsigned long long seed)
+{
+	unsigned long long state = seed;
+
+	for (int nCnt = 0; nCnt < 4; nCnt += 2)
+	{
+		unsigned long long value = SplitMix(&state);
+		m_aState[nCnt] = (unsigned int)value;
+		m_aState[nCnt + 1] = (unsigned int)(value >> 32);
+	}
+
+	// まとめて引く用の4系列も同じシードから作る
+	for (int nLane = 0; nLane < LANE; nLane++)
+	{
+		for (int nWord = 0; nWord < 4; nWord += 2)
+		{
+			unsigned long long value = SplitMix(&state);
+			m_aLane[nWord][nLane] = (unsigned int)value;
+			m_aLane[nWord + 1][nLane] = (unsigned int)(value >> 32);
+		}
+	}
+}
+//=============================================================================
+// 次の値の取得処理(xoshiro128**)
+//=============================================================================
+unsigned int CRandom::Next(void)
+{
+	unsigned int result = Rotl(m_aState[1] * 5, 7) * 9;
+	unsigned int t = m_aState[1] << 9;
+
+	m_aState[2] ^= m_aState[0];
+	m_aState[3] ^= m_aState[1];
+	m_aState[1] ^= m_aState[2];
+	m_aState[0] ^= m_aState[3];
+	m_aState[2] ^= t;
+	m_aState[3] = Rotl(m_aState[3], 11);
+
+	return result;
+}
+//=============================================================================
+// [0,1)の小数の取得処理
+//=============================================================================
+float CRandom::Float(void)
+{
+	return ToFloat(Next());
+}
+//=============================================================================
+// [fMin,fMax)の小数の取得処理
+//=============================================================================
+float CRandom::Range(float fMin, float fMax)
+{
+	return fMin + Float() * (fMax - fMin);
+}
+//=============================================================================
+// [0,nMax)の整数の取得処理(剰余を使わず、偏りも出ない)
+//=============================================================================
+int CRandom::Int(int nMax)
+{
+	if (nMax <= 0)
+	{
+		return 0;
+	}
+
+	unsigned int range = (unsigned int)nMax;
+	unsigned long long m = (unsigned long long)Next() * range;
+	unsigned int low = (unsigned int)m;
+
+	// 端数に当たった時だけ引き直す
+	if (low < range)
+	{
+		unsigned int threshold = (0u - range) % range;
+
+		while (low < threshold)
+		{
+			m = (unsigned long long)Next() * range;
+			low = (unsigned int)m;
+		}
+	}
+
+	return (int)(m >> 32);
+}
+//=============================================================================
+// [nMin,nMax]の整数の取得処理
+//=============================================================================
+int CRandom::Range(int nMin, int nMax)
+{
+	return nMin + Int(nMax - nMin + 1);
+}
+//=============================================================================
+// [0,1)の小数をまとめて作る処理(xoshiro128+を4系列同時に進める)
+//=============================================================================
+void CRandom::FillFloat(float* pOut, int nNum)
+{
+	__m128i s0 = _mm_load_si128((const __m128i*)m_aLane[0]);
+	__m128i s1 = _mm_load_si128((const __m128i*)m_aLane[1]);
+	__m128i s2 = _mm_load_si128((const __m128i*)m_aLane[2]);
+	__m128i s3 = _mm_load_si128((const __m128i*)m_aLane[3]);
+
+	const __m128 scale = _mm_set1_ps(1.0f / 16777216.0f);
+
+	for (int nCnt = 0; nCnt < nNum; nCnt += LANE)
+	{
+		// 上位24bitを小数にする
+		__m128i result = _mm_add_epi32(s0, s3);
+		__m128 value = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(result, 8)), scale);
+
+		// 状態を進める
+		__m128i t = _mm_slli_epi32(s1, 9);
+
+		s2 = _mm_xor_si128(s2, s0);
+		s3 = _mm_xor_si128(s3, s1);
+		s1 = _mm_xor_si128(s1, s2);
+		s0 = _mm_xor_si128(s0, s3);
+		s2 = _mm_xor_si128(s2, t);
+		s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+		if (nCnt + LANE <= nNum)
+		{
+			_mm_storeu_ps(pOut + nCnt, value);
+		}
+		else
+		{// 端数
+			alignas(16) float aValue[LANE];
+			_mm_store_ps(aValue, value);
+
+			for (int nLane = 0; nCnt + nLane < nNum; nLane++)
+			{
+				pOut[nCnt + nLane] = aValue[nLane];
+			}
+		}
+	}
+
+	_mm_store_si128((__m128i*)m_aLane[0], s0);
+	_mm_store_si128((__m128i*)m_aLane[1], s1);
+	_mm_store_si128((__m128i*)m_aLane[2], s2);
+	_mm_store_si128((__m128i*)m_aLane[3], s3);
+}
+//=============================================================================
+// [fMin,fMax)の小数をまとめて作る処理
+//=============================================================================
+void CRandom::FillRange(float* pOut, int nNum, float fMin, float fMax)
+{
+	FillFloat(pOut, nNum);
+
+	float fWidth = fMax - fMin;
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		pOut[nCnt] = fMin + pOut[nCnt] * fWidth;
+	}
+}
+//=============================================================================
+// 円周上の向きをまとめて作る処理(XZ平面で使う)
+//=============================================================================
+void CRandom::FillCircle(float* pCos, float* pSin, int nNum)
+{
+	FillRange(pCos, nNum, 0.0f, D3DX_PI * 2.0f);
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		float fAngle = pCos[nCnt];
+		pCos[nCnt] = cosf(fAngle);
+		pSin[nCnt] = sinf(fAngle);
+	}
+}
+//=============================================================================
+// 球面上の向きをまとめて作る処理(高さと角度を一様に取ると球面上で一様になる)
+//=============================================================================
+void CRandom::FillSphere(D3DXVECTOR3* pOut, int nNum)
+{
+	std::vector<float> value((size_t)nNum * 2);
+	FillFloat(value.data(), nNum * 2);
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		float y = value[nCnt * 2] * 2.0f - 1.0f;
+		float fAngle = value[nCnt * 2 + 1] * D3DX_PI * 2.0f;
+		float r = sqrtf(std::max(0.0f, 1.0f - y * y));
+
+		pOut[nCnt] = D3DXVECTOR3(cosf(fAngle) * r, y, sinf(fAngle) * r);
+	}
+}
+//=============================================================================
+// SplitMix64(シード値から状態を作る)
+//=============================================================================
+unsigned long long CRandom::SplitMix(unsigned long long* pState)
+{
+	unsigned long long z = (*pState += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+//=============================================================================
+// 確認処理(ウィンドウを出さずに統計の確認と速度の計測をして終了する)
+//=============================================================================
+bool CRandom::RunTest(const char* filename)
+{
+	static constexpr int	NUM_SAMPLE		= 1000000;	// 統計の確認に使う数
+	static constexpr int	NUM_BUCKET		= 100;		// 一様性の確認の区間数
+	static constexpr double	CHI2_BUCKET		= 148.2;	// 自由度99・有意水準0.1%の値
+	static constexpr int	INT_RANGE		= 7;		// 整数の偏りの確認に使う範囲
+	static constexpr double	CHI2_INT		= 22.46;	// 自由度6・有意水準0.1%の値
+	static constexpr double	CORREL_LIMIT	= 0.01;		// 相関として許す値
+	static constexpr int	NUM_BENCH		= 20000000;	// 速度の計測に使う数
+	static constexpr int	BENCH_BATCH		= 1024;		// まとめて引く数
+
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	bool bAllPass = true;
+
+	auto report = [&](const char* pName, bool bPass, const char* pDetail)
+	{
+		fprintf(pFile, "%-28s : %s  %s\n", pName, bPass ? "pass" : "FAIL", pDetail);
+		bAllPass = bAllPass && bPass;
+	};
+
+	char aDetail[256];
+
+	// 同じシードなら同じ列、違うシードなら違う列
+	{
+		CRandom a(42), b(42), c(43);
+		bool bSame = true, bDiffer = false;
+
+		for (int nCnt = 0; nCnt < 1000; nCnt++)
+		{
+			unsigned int va = a.Next();
+			bSame = bSame && (va == b.Next());
+			bDiffer = bDiffer || (va != c.Next());
+		}
+
+		float aFloatA[37], aFloatB[37];
+		CRandom d(7), e(7);
+		d.FillFloat(aFloatA, 37);
+		e.FillFloat(aFloatB, 37);
+		bSame = bSame && memcmp(aFloatA, aFloatB, sizeof(aFloatA)) == 0;
+
+		report("determinism", bSame && bDiffer, "");
+	}
+
+	// 一様性(1つずつ・まとめて)
+	for (int nMode = 0; nMode < 2; nMode++)
+	{
+		CRandom random(1234);
+		std::vector<float> value(NUM_SAMPLE);
+
+		if (nMode == 0)
+		{
+			for (auto& f : value)
+			{
+				f = random.Float();
+			}
+		}
+		else
+		{
+			random.FillFloat(value.data(), NUM_SAMPLE);
+		}
+
+		std::vector<int> bucket(NUM_BUCKET, 0);
+		double fSum = 0.0, fSumSq = 0.0, fLag = 0.0;
+		bool bInRange = true;
+
+		for (int nCnt = 0; nCnt < NUM_SAMPLE; nCnt++)
+		{
+			float f = value[nCnt];
+			bInRange = bInRange && f >= 0.0f && f < 1.0f;
+			bucket[std::min((int)(f * NUM_BUCKET), NUM_BUCKET - 1)]++;
+			fSum += f;
+			fSumSq += (double)f * f;
+
+			if (nCnt > 0)
+			{
+				fLag += (double)(f - 0.5f) * (value[nCnt - 1] - 0.5f);
+			}
+		}
+
+		double fExpect = (double)NUM_SAMPLE / NUM_BUCKET;
+		double fChi2 = 0.0;
+
+		for (int nCnt : bucket)
+		{
+			fChi2 += (nCnt - fExpect) * (nCnt - fExpect) / fExpect;
+		}
+
+		double fMean = fSum / NUM_SAMPLE;
+		double fVar = fSumSq / NUM_SAMPLE - fMean * fMean;
+		double fSerial = (fLag / (NUM_SAMPLE - 1)) / (1.0 / 12.0);
+
+		const char* pMode = (nMode == 0) ? "scalar" : "batch";
+
+		snprintf(aDetail, sizeof(aDetail), "(chi2 %.1f < %.1f)", fChi2, CHI2_BUCKET);
+		report(nMode == 0 ? "uniform chi2 scalar" : "uniform chi2 batch", bInRange && fChi2 < CHI2_BUCKET, aDetail);
+
+		snprintf(aDetail, sizeof(aDetail), "(mean %.4f var %.4f)", fMean, fVar);
+		report(nMode == 0 ? "mean/variance scalar" : "mean/variance batch", fabs(fMean - 0.5) < 0.002 && fabs(fVar - 1.0 / 12.0) < 0.002, aDetail);
+
+		snprintf(aDetail, sizeof(aDetail), "(lag1 %.4f, %s)", fSerial, pMode);
+		report(nMode == 0 ? "serial correlation scalar" : "serial correlation batch", fabs(fSerial) < CORREL_LIMIT, aDetail);
+	}
+
+	// 整数の偏り
+	{
+		CRandom random(99);
+		std::vector<int> count(INT_RANGE, 0);
+
+		for (int nCnt = 0; nCnt < NUM_SAMPLE; nCnt++)
+		{
+			count[random.Int(INT_RANGE)]++;
+		}
+
+		double fExpect = (double)NUM_SAMPLE / INT_RANGE;
+		double fChi2 = 0.0;
+
+		for (int nCnt : count)
+		{
+			fChi2 += (nCnt - fExpect) * (nCnt - fExpect) / fExpect;
+		}
+
+		snprintf(aDetail, sizeof(aDetail), "(chi2 %.2f < %.2f)", fChi2, CHI2_INT);
+		report("int bias", fChi2 < CHI2_INT, aDetail);
+	}
+
+	// 系列同士の相関
+	{
+		CRandom a(1), b(2);
+		double fCov = 0.0;
+
+		for (int nCnt = 0; nCnt < NUM_SAMPLE; nCnt++)
+		{
+			fCov += (double)(a.Float() - 0.5f) * (b.Float() - 0.5f);
+		}
+
+		double fCorrel = (fCov / NUM_SAMPLE) / (1.0 / 12.0);
+
+		snprintf(aDetail, sizeof(aDetail), "(r %.4f)", fCorrel);
+		report("stream correlation", fabs(fCorrel) < CORREL_LIMIT, aDetail);
+	}
+
+	// 球面上の向き
+	{
+		CRandom random(5);
+		std::vector<D3DXVECTOR3> dir(NUM_SAMPLE / 10);
+		random.FillSphere(dir.data(), (int)dir.size());
+
+		D3DXVECTOR3 mean(0.0f, 0.0f, 0.0f);
+		bool bUnit = true;
+
+		for (const auto& v : dir)
+		{
+			mean += v;
+			bUnit = bUnit && fabsf(D3DXVec3Length(&v) - 1.0f) < 0.001f;
+		}
+
+		mean /= (float)dir.size();
+
+		snprintf(aDetail, sizeof(aDetail), "(mean %.4f %.4f %.4f)", mean.x, mean.y, mean.z);
+		report("sphere direction", bUnit && D3DXVec3Length(&mean) < 0.01f, aDetail);
+	}
+
+	// 速度
+	LARGE_INTEGER freq, start, end;
+	QueryPerformanceFrequency(&freq);
+
+	auto toRate = [&](void) { return NUM_BENCH / ((double)(end.QuadPart - start.QuadPart) / freq.QuadPart) / 1000000.0; };
+
+	volatile unsigned int sink = 0;
+	fprintf(pFile, "\nthroughput (million per second, %d values)\n", NUM_BENCH);
+
+	QueryPerformanceCounter(&start);
+
+	for (int nCnt = 0; nCnt < NUM_BENCH; nCnt++)
+	{
+		sink += rand();
+	}
+
+	QueryPerformanceCounter(&end);
+	fprintf(pFile, "crt rand()                   : %.1f\n", toRate());
+
+	CRandom random(11);
+	QueryPerformanceCounter(&start);
+
+	for (int nCnt = 0; nCnt < NUM_BENCH; nCnt++)
+	{
+		sink += random.Next();
+	}
+
+	QueryPerformanceCounter(&end);
+	fprintf(pFile, "Next()                       : %.1f\n", toRate());
+
+	float fSink = 0.0f;
+	QueryPerformanceCounter(&start);
+
+	for (int nCnt = 0; nCnt < NUM_BENCH; nCnt++)
+	{
+		fSink += random.Float();
+	}
+
+	QueryPerformanceCounter(&end);
+	fprintf(pFile, "Float()                      : %.1f\n", toRate());
+
+	std::vector<float> batch(BENCH_BATCH);
+	QueryPerformanceCounter(&start);
+
+	for (int nCnt = 0; nCnt < NUM_BENCH; nCnt += BENCH_BATCH)
+	{
+		random.FillFloat(batch.data(), BENCH_BATCH);
+		fSink += batch[0];
+	}
+
+	QueryPerformanceCounter(&end);
+	fprintf(pFile, "FillFloat() batch %-4d       : %.1f\n", BENCH_BATCH, toRate());
+
+	QueryPerformanceCounter(&start);
+
+	for (int nCnt = 0; nCnt < NUM_BENCH; nCnt++)
+	{
+		sink += random.Int(100);
+	}
+
+	QueryPerformanceCounter(&end);
+	fprintf(pFile, "Int(100)                     : %.1f\n", toRate());
+	fprintf(pFile, "(checksum %u %.1f)\n", (unsigned int)sink, fSink);
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bAllPass;
+}
@@ -0,0 +1,63 @@
+//=============================================================================
+//
+// 乱数処理 [random.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _RANDOM_H_// このマクロ定義がされていなかったら
+#define _RANDOM_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// 乱数クラス(xoshiro128系。用途ごとに別の系列を持ち、お互いの結果に影響しない)
+//*****************************************************************************
+class CRandom
+{
+public:
+	// 乱数の系列
+	typedef enum
+	{
+		STREAM_GAMEPLAY = 0,	// ゲームの進行(敵の行動・配置など)
+		STREAM_MAP,				// マップ生成(シード値で同じマップを再現する)
+		STREAM_EFFECT,			// 見た目だけの演出(パーティクル・カメラの揺れなど)
+		STREAM_MAX
+	}STREAM;
+
+	// std::shuffleなどにそのまま渡せるようにする
+	typedef unsigned int result_type;
+
+	CRandom(unsigned long long seed = 0);
+	~CRandom() {}
+
+	void Seed(unsigned long long seed);
+	unsigned int Next(void);
+	float Float(void);
+	float Range(float fMin, float fMax);
+	int Int(int nMax);
+	int Range(int nMin, int nMax);
+	float Angle(void) { return Float() * D3DX_PI * 2.0f; }
+
+	// まとめて生成(4つずつSIMDで作る)
+	void FillFloat(float* pOut, int nNum);
+	void FillRange(float* pOut, int nNum, float fMin, float fMax);
+	void FillCircle(float* pCos, float* pSin, int nNum);
+	void FillSphere(D3DXVECTOR3* pOut, int nNum);
+
+	unsigned int operator()(void) { return Next(); }
+	static constexpr result_type min(void) { return 0; }
+	static constexpr result_type max(void) { return 0xffffffff; }
+
+	static CRandom& Get(STREAM stream) { return m_aStream[stream]; }
+	static bool RunTest(const char* filename);
+
+private:
+	static constexpr int LANE = 4;	// SIMDで同時に進める系列の数
+
+	static unsigned long long SplitMix(unsigned long long* pState);
+
+	unsigned int m_aState[4];				// 1つずつ引く時の状態
+	alignas(16) unsigned int m_aLane[4][LANE];	// まとめて引く時の状態(状態の語ごとに4系列を並べる)
+
+	static CRandom m_aStream[STREAM_MAX];	// 用途ごとの系列
+};
+
+#endif
@@ -1,44 +1,45 @@
 //=============================================================================
 //
-// LOʕ\ [rank.cpp]
+// ランキング順位表示処理 [rank.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "rank.h"
 #include "renderer.h"
 #include "manager.h"
+#include "spritebatch.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CRank::CRank(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_pVtxBuff		= nullptr;		// _obt@
-	m_pos			= INIT_VEC3;	// ʒu
-	m_fWidth		= 0.0f;			// 
-	m_fHeight		= 0.0f;			// 
-	m_nIdxTexture	= 0;			// eNX`CfbNX
+	// 値のクリア
+	memset(m_aVtx, 0, sizeof(m_aVtx));// 頂点
+	m_pos			= INIT_VEC3;	// 位置
+	m_fWidth		= 0.0f;			// 幅
+	m_fHeight		= 0.0f;			// 高さ
+	m_nIdxTexture	= -1;			// テクスチャインデックス
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CRank::~CRank()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CRank* CRank::Create(D3DXVECTOR3 pos, float fWidth, float fHeight, float fRank)
 {
 	CRank* pRank = new CRank;
 
-	// nullptr
+	// nullptrだったら
 	if (pRank == nullptr)
 	{
 		return nullptr;
@@ -49,7 +50,7 @@ CRank* CRank::Create(D3DXVECTOR3 pos, float fWidth, float fHeight, float fRank)
 	pRank->m_fHeight = fHeight;
 	pRank->m_fRank = fRank;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pRank->Init()))
 	{
 		return nullptr;
@@ -58,137 +59,99 @@ CRank* CRank::Create(D3DXVECTOR3 pos, float fWidth, float fHeight, float fRank)
 	return pRank;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CRank::Init(void)
 {
-	// foCX擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
 	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/rank.png");
 
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	VERTEX_2D* pVtx;// _ւ̃|C^
+	// 順位の画像は数字と一緒に描けるようにアトラスへ入れる(横に5つ並んだ画像なので幅に合わせて入れる)
+	CSpriteBatch::RegisterAtlas(m_nIdxTexture, true);
 
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	// _W̐ݒ
+	// 頂点座標の設定
 	pVtx[0].pos = D3DXVECTOR3(m_pos.x, m_pos.y, 0.0f);
 	pVtx[1].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y, 0.0f);
 	pVtx[2].pos = D3DXVECTOR3(m_pos.x, m_pos.y + m_fHeight, 0.0f);
 	pVtx[3].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y + m_fHeight, 0.0f);
 
-	// rhw̐ݒ
+	// rhwの設定
 	pVtx[0].rhw = 1.0f;
 	pVtx[1].rhw = 1.0f;
 	pVtx[2].rhw = 1.0f;
 	pVtx[3].rhw = 1.0f;
 
-	// _J[̐ݒ
+	// 頂点カラーの設定
 	if (m_fRank == RANK_FIRST)
-	{// 1
+	{// 1位
 		pVtx[0].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 		pVtx[1].col = D3DCOLOR_RGBA(255, 215, 0, 255);
 		pVtx[2].col = D3DCOLOR_RGBA(255, 215, 0, 255);
 		pVtx[3].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 	}
 	else if (m_fRank == RANK_SECOND)
-	{// 2
+	{// 2位
 		pVtx[0].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 		pVtx[1].col = D3DCOLOR_RGBA(192, 192, 192, 255);
 		pVtx[2].col = D3DCOLOR_RGBA(192, 192, 192, 255);
 		pVtx[3].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 	}
 	else if (m_fRank == RANK_THIRD)
-	{// 3
+	{// 3位
 		pVtx[0].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 		pVtx[1].col = D3DCOLOR_RGBA(196, 112, 34, 255);
 		pVtx[2].col = D3DCOLOR_RGBA(196, 112, 34, 255);
 		pVtx[3].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 	}
 	else
-	{// ̑
+	{// その他
 		pVtx[0].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 		pVtx[1].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 		pVtx[2].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 		pVtx[3].col = D3DCOLOR_RGBA(255, 255, 255, 255);
 	}
 
-	// eNX`W̐ݒ
+	// テクスチャ座標の設定
 	pVtx[0].tex = D3DXVECTOR2(m_fRank * 0.2f, 0.0f);
 	pVtx[1].tex = D3DXVECTOR2(m_fRank * 0.2f + 0.2f, 0.0f);
 	pVtx[2].tex = D3DXVECTOR2(m_fRank * 0.2f, 1.0f);
 	pVtx[3].tex = D3DXVECTOR2(m_fRank * 0.2f + 0.2f, 1.0f);
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CRank::Uninit(void)
 {
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTexture);
+	m_nIdxTexture = -1;
 
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CRank::Update(void)
 {
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	// W
+	// 座標
 	pVtx[0].pos = { m_pos.x,             m_pos.y,              0.0f };
 	pVtx[1].pos = { m_pos.x + m_fWidth,  m_pos.y,              0.0f };
 	pVtx[2].pos = { m_pos.x,             m_pos.y + m_fHeight,  0.0f };
 	pVtx[3].pos = { m_pos.x + m_fWidth,  m_pos.y + m_fHeight,  0.0f };
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CRank::Draw(void)
 {
 	if (CManager::GetMode() == CScene::MODE_RANKING)
 	{
-		// eNX`̎擾
-		CTexture* pTexture = CManager::GetTexture();
-
-		// foCX̎擾
-		LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-		// _obt@f[^Xg[ɐݒ
-		pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-		// _tH[}bg̐ݒ
-		pDevice->SetFVF(FVF_VERTEX_2D);
-
-		// eNX`̐ݒ
-		pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-		// |S̕`
-		pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
+		// まとめ描画に積む
+		CSpriteBatch::Submit(m_aVtx, m_nIdxTexture);
 	}
 }
\ No newline at end of file
@@ -1,30 +1,30 @@
 //=============================================================================
 //
-// LOʕ\ [rank.h]
+// ランキング順位表示処理 [rank.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RANK_H_// ̃}N`ĂȂ
-#define _RANK_H_// 2dCN[hh~̃}N`
+#ifndef _RANK_H_// このマクロ定義がされていなかったら
+#define _RANK_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 //*****************************************************************************
-// LOʃNX
+// ランキング順位クラス
 //*****************************************************************************
 class CRank : public CObject
 {
 public:
-	// 
+	// 順位
 	enum RANK
 	{
-		RANK_FIRST = 0,	// 1
-		RANK_SECOND,	// 2
-		RANK_THIRD,		// 3
-		RANK_OTHER,		// ̑
+		RANK_FIRST = 0,	// 1位
+		RANK_SECOND,	// 2位
+		RANK_THIRD,		// 3位
+		RANK_OTHER,		// その他
 		RANK_MAX
 	};
 
@@ -41,12 +41,12 @@ public:
 	void SetSize(float w, float h) { m_fWidth = w; m_fHeight = h; }
 
 private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@
-	D3DXVECTOR3				m_pos;			// ʒu
-	float					m_fWidth;		// 
-	float					m_fHeight;		// 
-	float					m_fRank;		// 
-	int						m_nIdxTexture;	// eNX`CfbNX
+	VERTEX_2D				m_aVtx[4];		// 頂点
+	D3DXVECTOR3				m_pos;			// 位置
+	float					m_fWidth;		// 幅
+	float					m_fHeight;		// 高さ
+	float					m_fRank;		// 順位
+	int						m_nIdxTexture;	// テクスチャインデックス
 };
 
 #endif
\ No newline at end of file
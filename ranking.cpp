@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// LO [ranking.cpp]
+// ランキング処理 [ranking.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "ranking.h"
 #include "manager.h"
@@ -19,46 +19,46 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CRanking::CRanking() : CScene(CScene::MODE_RANKING)
 {
-	// l̃NA
-	m_pRankingManager	= nullptr;		// LO}l[W[ւ̃|C^
-	m_pRankItem			= nullptr;		// NACeւ̃|C^
+	// 値のクリア
+	m_pRankingManager	= nullptr;		// ランキングマネージャーへのポインタ
+	m_pRankItem			= nullptr;		// ランクアイテムへのポインタ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CRanking::~CRanking()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CRanking::Init(void)
 {
-	// LO}l[W[̃CX^X
+	// ランキングマネージャーのインスタンス生成
 	m_pRankingManager = CRankingManager::GetInstance();
 
-	// wi̐
+	// 背景の生成
 	CBackground::Create("data/TEXTURE/ranking_back.png", 0.57f, 0.7f, 0.15f, 0.4f);
 
-	//// ^CLO
+	//// タイムランキング
 	//TimeRanking(m_pRankingManager);
 
-	// ACeLO
+	// アイテムランキング
 	ItemRanking(m_pRankingManager);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CRanking::Uninit(void)
 {
-	// LO}l[W[̔j
+	// ランキングマネージャーの破棄
 	if (m_pRankingManager != nullptr)
 	{
 		delete m_pRankingManager;
@@ -66,37 +66,37 @@ void CRanking::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CRanking::Update(void)
 {
-	// ͎t̂߂ɃCvbg擾
+	// 入力受付のためにインプット処理を取得
 	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// ʑJڂ̂߂ɃtF[h擾
+	// 画面遷移のためにフェードを取得
 	CFade* pFade = CManager::GetFade();
 
 #ifdef _DEBUG
-	// ʑJ
+	// 画面遷移
 	if (pFade->GetFade() == CFade::FADE_NONE && 
 		(pKeyboard->GetAnyKeyTrigger() || pJoypad->GetTrigger(pJoypad->JOYKEY_A)))
 	{
-		// ^CgʂɈڍs
+		// タイトル画面に移行
 		CManager::GetFade()->SetFade(CScene::MODE_TITLE);
 	}
 #else
-	// ʑJ
+	// 画面遷移
 	if (pFade->GetFade() == CFade::FADE_NONE && 
 		((pKeyboard->GetAnyKeyTrigger()) || pJoypad->GetTrigger(pJoypad->JOYKEY_A)))
 	{
-		// ^CgʂɈڍs
+		// タイトル画面に移行
 		CManager::GetFade()->SetFade(CScene::MODE_TITLE);
 	}
 #endif
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CRanking::Draw(void)
 {
@@ -104,14 +104,14 @@ void CRanking::Draw(void)
 
 }
 //=============================================================================
-// ^CLO
+// タイムランキング処理
 //=============================================================================
 void CRanking::TimeRanking(CRankingManager* pRankingManager)
 {
-	// LO^C̐
+	// ランキングタイムの生成
 	m_pRankTime = CRankTime::Create(600.0f, 170.0f, 62.0f, 78.0f);
 
-	// LOf[^Zbg
+	// ランキングデータをセット
 	if (pRankingManager)
 	{
 		std::vector<std::pair<int, int>> rankList;
@@ -121,27 +121,27 @@ void CRanking::TimeRanking(CRankingManager* pRankingManager)
 			rankList.push_back({ r.minutes, r.seconds });
 		}
 
-		// ^CXg̐ݒ
+		// タイムリストの設定
 		m_pRankTime->SetRankList(rankList);
 
 		int  rankIndex = CResult::GetClearRank();
 
 		if (rankIndex >= 0 && rankIndex < static_cast<int>(rankList.size()))
 		{
-			// NCAj[V
+			// ランクインアニメーション
 			m_pRankTime->ShowNewRankEffect(rankIndex);
 		}
 	}
 }
 //=============================================================================
-// ACeLO
+// アイテムランキング処理
 //=============================================================================
 void CRanking::ItemRanking(CRankingManager* pRankingManager)
 {
-	// LOACe̐
+	// ランキングアイテムの生成
 	m_pRankItem = CRankItem::Create(0.53f, 0.23f, 0.08f, 0.09f, 1.3f);
 
-	// LOf[^Zbg
+	// ランキングデータをセット
 	if (pRankingManager)
 	{
 		std::vector<int> rankList;
@@ -151,14 +151,14 @@ void CRanking::ItemRanking(CRankingManager* pRankingManager)
 			rankList.push_back({ r.items });
 		}
 
-		// ACeXg̐ݒ
+		// アイテムリストの設定
 		m_pRankItem->SetRankList(rankList);
 
 		int  rankIndex = CResult::GetClearRank();
 
 		if (rankIndex >= 0 && rankIndex < static_cast<int>(rankList.size()))
 		{
-			// NCAj[V
+			// ランクインアニメーション
 			m_pRankItem->ShowNewRankEffect(rankIndex);
 		}
 	}
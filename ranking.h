@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// LO [ranking.h]
+// ランキング処理 [ranking.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RANKING_H_// ̃}N`ĂȂ
-#define _RANKING_H_// 2dCN[hh~̃}N`
+#ifndef _RANKING_H_// このマクロ定義がされていなかったら
+#define _RANKING_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CRankItem;
 class CRankTime;
@@ -21,7 +21,7 @@ class CRankingManager;
 
 
 //*****************************************************************************
-// LONX
+// ランキングクラス
 //*****************************************************************************
 class CRanking : public CScene
 {
@@ -38,9 +38,9 @@ public:
 	void ItemRanking(CRankingManager* pRankingManager);
 
 private:
-	CRankTime*			m_pRankTime;		// NA^CLO\p
-	CRankItem*			m_pRankItem;		// ACeLO\p
-	CRankingManager*	m_pRankingManager;	// LOւ̃|C^
+	CRankTime*			m_pRankTime;		// クリアタイムランキング表示用
+	CRankItem*			m_pRankItem;		// アイテムランキング表示用
+	CRankingManager*	m_pRankingManager;	// ランキングへのポインタ
 };
 
 
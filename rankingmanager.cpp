@@ -1,26 +1,26 @@
 //=============================================================================
 //
-// LO}l[W[ [rankingmanager.cpp]
+// ランキングマネージャー処理 [rankingmanager.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "rankingmanager.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 CRankingManager* CRankingManager::m_Instance = nullptr;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CRankingManager::CRankingManager()
 {
-    // LO 99:59 Ŗ߂Ă
+    // 初期ランキングを 99:59 で埋めておく
     m_rankList.resize(MAX_RANK);
     for (auto& r : m_rankList)
     {
@@ -28,22 +28,22 @@ CRankingManager::CRankingManager()
         r.seconds = 59;
     }
 
-    // LO̓ǂݍ
+    // ランキングの読み込み
 	Load();
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CRankingManager::~CRankingManager()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// ۑ
+// 保存処理
 //=============================================================================
 void CRankingManager::Save(void)
 {
-    // t@CJ
+    // ファイルを開く
     FILE* fp = fopen("data/ranking.txt", "w");
 
     if (!fp)
@@ -56,17 +56,17 @@ void CRankingManager::Save(void)
         fprintf(fp, "%d %d %d\n", data.minutes, data.seconds, data.items);
     }
 
-    // t@C
+    // ファイルを閉じる
     fclose(fp);
 }
 //=============================================================================
-// ǂݍݏ
+// 読み込み処理
 //=============================================================================
 void CRankingManager::Load(void)
 {
     m_rankList.clear();
 
-    // t@CJ
+    // ファイルを開く
     FILE* fp = fopen("data/ranking.txt", "r");
 
     if (!fp)
@@ -85,6 +85,6 @@ void CRankingManager::Load(void)
         m_rankList.push_back(data);
     }
 
-    // t@C
+    // ファイルを閉じる
     fclose(fp);
 }
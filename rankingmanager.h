@@ -1,31 +1,31 @@
 //=============================================================================
 //
-// LO}l[W[ [rankingmanager.h]
+// ランキングマネージャー処理 [rankingmanager.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RANKINGMANAGER_H_// ̃}N`ĂȂ
-#define _RANKINGMANAGER_H_// 2dCN[hh~̃}N`
+#ifndef _RANKINGMANAGER_H_// このマクロ定義がされていなかったら
+#define _RANKINGMANAGER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "algorithm"
 
 //*****************************************************************************
-// LO}l[W[NX
+// ランキングマネージャークラス
 //*****************************************************************************
 class CRankingManager
 {
 private:
-    // LOf[^\
+    // ランキングデータ構造体
     struct RankData
     {
-        // NA^C
+        // クリアタイム
         int minutes = 0;
         int seconds = 0;
 
-        // ACe
+        // アイテム個数
         int items = 0;
     };
 
@@ -33,7 +33,7 @@ private:
 
     std::vector<RankData> m_rankList;
     static CRankingManager* m_Instance;
-    int m_rankIdx;// ʂ̃CfbNX
+    int m_rankIdx;// 順位のインデックス
 
 public:
 	CRankingManager();
@@ -41,8 +41,8 @@ public:
 
     enum class RankType
     {
-        ClearTime,  // 
-        ItemCount   // 
+        ClearTime,  // 速い順
+        ItemCount   // 多い順
     };
 
     static CRankingManager* GetInstance(void)
@@ -52,7 +52,7 @@ public:
         return m_Instance;
     }
 
-    // ORs[pɎ擾
+    // 外部からコピー用に取得
     std::vector<RankData> GetRankList(void) const
     {
         std::vector<RankData> list;
@@ -65,7 +65,7 @@ public:
     }
 
     //*****************************************************************************
-    // ʏ̃^Ĉ܂ܓo^
+    // 通常のタイムをそのまま登録
     //*****************************************************************************
     void AddRecord(int minutes, int seconds)
     {
@@ -74,7 +74,7 @@ public:
     }
 
     //*****************************************************************************
-    // ACe̐L^
+    // アイテムの数を記録
     //*****************************************************************************
     void AddItemRecord(int itemCount)
     {
@@ -84,7 +84,7 @@ public:
     }
 
     //*****************************************************************************
-    // c莞ԂNA^Cɕϊēo^
+    // 残り時間をクリアタイムに変換して登録
     //*****************************************************************************
     void AddRecordWithLimit(int limitMinutes, int limitSeconds, int remainMinutes, int remainSeconds)
     {
@@ -95,7 +95,7 @@ public:
     void SetRankType(RankType type)
     {
         m_rankType = type;
-        SortRank();   // ؂ւёւ
+        SortRank();   // 切り替えたら並び替え
     }
 
     const std::vector<RankData>& GetList(void) const { return m_rankList; }
@@ -108,7 +108,7 @@ private:
     RankType m_rankType = RankType::ItemCount;
 
     //*****************************************************************************
-    // c莞  NA^Cւ̕ϊ
+    // 残り時間 → クリアタイムへの変換
     //*****************************************************************************
     RankData ConvertToClearTime(int limitMinutes, int limitSeconds, int remainMinutes, int remainSeconds)
     {
@@ -128,23 +128,23 @@ private:
     }
 
     //*****************************************************************************
-    // NXgւ̓o^iʁj
+    // ランクリストへの登録処理（共通）
     //*****************************************************************************
     void RegisterRecord(const RankData& data)
     {
         m_rankList.push_back(data);
 
-        // \[g
+        // ソート処理
         SortRank();
 
-        // 5ɐ
+        // 上位5件に制限
         if (m_rankList.size() > MAX_RANK)
         {
             m_rankList.resize(MAX_RANK);
         }
 
-        // ۂɉʂɓTi5̒Łj
-        m_rankIdx = -1; // l̓NC
+        // 実際に何位に入ったかを探す（上位5件の中で）
+        m_rankIdx = -1; // 初期値はランクイン無し
         for (size_t i = 0; i < m_rankList.size(); i++)
         {
             if ((m_rankList[i].minutes == data.minutes &&
@@ -156,12 +156,12 @@ private:
             }
         }
 
-        // ۑ
+        // 保存
         Save();
     }
 
     //*****************************************************************************
-    // \[g
+    // ソート処理
     //*****************************************************************************
     void SortRank(void)
     {
@@ -170,7 +170,7 @@ private:
             {
                 if (m_rankType == RankType::ItemCount)
                 {
-                    // ACeF
+                    // アイテム数：多い順
                     if (a.items != b.items)
                     {
                         return a.items > b.items;
@@ -178,7 +178,7 @@ private:
                 }
                 else
                 {
-                    // NA^CF
+                    // クリアタイム：速い順
                     if (a.minutes != b.minutes)
                     {
                         return a.minutes < b.minutes;
@@ -190,7 +190,7 @@ private:
                     }
                 }
 
-                // _̕ی
+                // 同点時の保険
                 return a.items > b.items;
             });
     }
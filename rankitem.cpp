@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// LOACe [rankitem.cpp]
+// ランキングアイテム処理 [rankitem.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "rankitem.h"
 #include "texture.h"
@@ -15,33 +15,33 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CRankItem::CRankItem(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_apNumber, 0, sizeof(m_apNumber));	// e̐\p
-	memset(m_apRank, 0, sizeof(m_apRank));		// ȅʕ\p
-	m_digitWidth	= 0.0f;						// 1̕
-	m_digitHeight	= 0.0f;						// 1̍
-	m_basePos		= INIT_VEC3;				// \̊Jnʒu
-	m_nIdxTexture	= 0;						// eNX`CfbNX
+	// 値のクリア
+	memset(m_apNumber, 0, sizeof(m_apNumber));	// 各行の数字表示用
+	memset(m_anValue, 0, sizeof(m_anValue));	// 各行の個数
+	memset(m_apRank, 0, sizeof(m_apRank));		// 各桁の順位表示用
+	m_digitWidth	= 0.0f;						// 数字1桁あたりの幅
+	m_digitHeight	= 0.0f;						// 数字1桁あたりの高さ
+	m_basePos		= INIT_VEC3;				// 表示の開始位置
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CRankItem::~CRankItem()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CRankItem* CRankItem::Create(float anchorX, float anchorY, float digitWidthRate, float digitHeightRate, float SpaceRate)
 {
 	CRankItem* rankItem = new CRankItem;
 
-	// nullptr
+	// nullptrだったら
 	if (rankItem == nullptr)
 	{
 		return nullptr;
@@ -53,7 +53,7 @@ CRankItem* CRankItem::Create(float anchorX, float anchorY, float digitWidthRate,
 	rankItem->m_layout.digitHeightRate = digitHeightRate;
 	rankItem->m_layout.lineSpacingRate = SpaceRate;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(rankItem->Init()))
 	{
 		return nullptr;
@@ -62,67 +62,59 @@ CRankItem* CRankItem::Create(float anchorX, float anchorY, float digitWidthRate,
 	return rankItem;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CRankItem::Init(void)
 {
-	// 5ʂ܂Ő
+	// 5位まで生成する
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		// UI̐
+		// 順位UIの生成
 		float UIbaseX = m_basePos.x + m_digitWidth;
 		float UIbaseY = m_basePos.y + nCnt * (m_digitHeight + 50.0f);
 
-		// ʕ\
+		// 順位表示
 		m_apRank[nCnt] = CRank::Create(D3DXVECTOR3(UIbaseX, UIbaseY, 0.0f), m_digitWidth / 2, m_digitHeight, (float)nCnt);
 
-		// UI̕
+		// 順位UIの幅
 		float rankWidth = (m_digitWidth / 2) + 30.0f;
 
-		// ACě
-		for (int nCnt2 = 0; nCnt2 < MAX_DIGITS; nCnt2++)
-		{
-			float x = UIbaseX + rankWidth + nCnt2 * m_digitWidth;
-			float y = UIbaseY;
+		// アイテム数(1行を1つのナンバーで並べる)
+		m_apNumber[nCnt] = CNumber::Create(UIbaseX + rankWidth, UIbaseY, m_digitWidth, m_digitHeight);
 
-			m_apNumber[nCnt][nCnt2] = CNumber::Create(x, y, m_digitWidth, m_digitHeight);
+		if (!m_apNumber[nCnt])
+		{
+			return E_FAIL;
 		}
 	}
 
-	// eNX`蓖
-	CTexture* pTexture = CManager::GetTexture();
-	m_nIdxTexture = pTexture->RegisterDynamic("data/TEXTURE/num_01.png");
-
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CRankItem::Uninit(void)
 {
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		for (int nCnt2 = 0; nCnt2 < MAX_DIGITS; nCnt2++)
+		if (m_apNumber[nCnt])
 		{
-			if (m_apNumber[nCnt][nCnt2])
-			{
-				// io[̏I
-				m_apNumber[nCnt][nCnt2]->Uninit();
+			// ナンバーの終了処理
+			m_apNumber[nCnt]->Uninit();
 
-				delete m_apNumber[nCnt][nCnt2];
-				m_apNumber[nCnt][nCnt2] = nullptr;
-			}
+			delete m_apNumber[nCnt];
+			m_apNumber[nCnt] = nullptr;
 		}
 	}
 
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CRankItem::Update(void)
 {
-	// obNobt@TCY̎擾
+	// バックバッファサイズの取得
 	float sw = (float)CManager::GetRenderer()->GetBackBufferWidth();
 	float sh = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
@@ -130,21 +122,21 @@ void CRankItem::Update(void)
 	float digitH = sh * m_layout.digitHeightRate;
 	float lineH = digitH * m_layout.lineSpacingRate;
 
-	// LOŜ̊Jnʒu
+	// ランキング全体の開始位置
 	float startX = sw * m_layout.anchorX;
 	float startY = sh * m_layout.anchorY;
 
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		// \錅i0ł1\j
-		int value = m_nDig[nCnt][0] * 100 + m_nDig[nCnt][1] * 10 + m_nDig[nCnt][2];
-		int digitCount = (value == 0) ? 1 : DigitNum(value);
+		// 表示する桁数（0でも1桁表示）
+		int value = m_anValue[nCnt];
+		int digitCount = DigitNum(value);
 
 		float totalWidth = digitW * digitCount;
 		float x = startX - totalWidth * 0.5f;
 		float y = startY + nCnt * lineH;
 
-		// UI
+		// 順位UI
 		if (m_apRank[nCnt])
 		{
 			m_apRank[nCnt]->SetPos({ x - digitW, y, 0.0f });
@@ -152,67 +144,35 @@ void CRankItem::Update(void)
 			m_apRank[nCnt]->Update();
 		}
 
-		for (int nCnt2 = 0; nCnt2 < MAX_DIGITS; nCnt2++)
+		if (m_apNumber[nCnt])
 		{
-			// ʒu
+			// 位置を代入(変わった時だけ並べ直される)
 			D3DXVECTOR3 pos(x + digitW * SPACING_RANK_X, y, 0.0f);
 
-			m_apNumber[nCnt][nCnt2]->SetPos(pos);
-			m_apNumber[nCnt][nCnt2]->SetSize(digitW, digitH);
+			m_apNumber[nCnt]->SetPos(pos);
+			m_apNumber[nCnt]->SetSize(digitW, digitH);
 
-			// io[XV
-			m_apNumber[nCnt][nCnt2]->Update();
+			// ナンバー更新
+			m_apNumber[nCnt]->Update();
 		}
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CRankItem::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		bool drawStarted = false;
-
-		for (int nCnt2 = 0; nCnt2 < MAX_DIGITS; nCnt2++)
+		if (m_apNumber[nCnt])
 		{
-			int digit = m_nDig[nCnt][nCnt2]; // e̒l
-
-			// 擪0XLbv
-			if (!drawStarted)
-			{
-				if (digit == 0 && nCnt2 != MAX_DIGITS - 1)
-				{
-					continue;
-				}
-
-				drawStarted = true;
-			}
-
-			if (!m_apNumber[nCnt][nCnt2])
-			{
-				continue;
-			}
-
-			// ̐ݒ
-			m_apNumber[nCnt][nCnt2]->SetDigit(digit);
-
-			// eNX`̐ݒ
-			pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-			// io[̕`
-			m_apNumber[nCnt][nCnt2]->Draw();
+			// ナンバーの描画(先頭の0は並べない)
+			m_apNumber[nCnt]->Draw();
 		}
 	}
 }
 //=============================================================================
-// 
+// 桁分割処理
 //=============================================================================
 int CRankItem::DigitNum(int nCount)
 {
@@ -231,7 +191,7 @@ int CRankItem::DigitNum(int nCount)
 	return nCnt;
 }
 //=============================================================================
-// LOXg̐ݒ菈
+// ランキングリストの設定処理
 //=============================================================================
 void CRankItem::SetRankList(const std::vector<int>& itemList)
 {
@@ -239,17 +199,20 @@ void CRankItem::SetRankList(const std::vector<int>& itemList)
 	{
 		int value = (nCnt < itemList.size()) ? itemList[nCnt] : 0;
 
-		// ő 999 ɐ
+		// 最大 999 に制限
 		value = std::min(value, 999);
 
-		// 
-		m_nDig[nCnt][0] = (value / 100) % 10;
-		m_nDig[nCnt][1] = (value / 10) % 10;
-		m_nDig[nCnt][2] = value % 10;
+		m_anValue[nCnt] = value;
+
+		// 変わった時だけ並べ直される
+		if (m_apNumber[nCnt])
+		{
+			m_apNumber[nCnt]->SetValue(value);
+		}
 	}
 }
 //=============================================================================
-// NCGtFNg̕\
+// ランクインエフェクトの表示
 //=============================================================================
 void CRankItem::ShowNewRankEffect(int rankIndex)
 {
@@ -258,12 +221,9 @@ void CRankItem::ShowNewRankEffect(int rankIndex)
 		return;
 	}
 
-	for (int nCnt = 0; nCnt < MAX_DIGITS; nCnt++)
+	if (m_apNumber[rankIndex])
 	{
-		if (m_apNumber[rankIndex][nCnt])
-		{
-			// NC̃XP[Aj[V
-			m_apNumber[rankIndex][nCnt]->SetScaleAnim();
-		}
+		// ランクインのスケールアニメーション
+		m_apNumber[rankIndex]->SetScaleAnim();
 	}
 }
\ No newline at end of file
@@ -1,27 +1,27 @@
 //=============================================================================
 //
-// LOACe [rankitem.h]
+// ランキングアイテム処理 [rankitem.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RANKITEM_H_// ̃}N`ĂȂ
-#define _RANKITEM_H_// 2dCN[hh~̃}N`
+#ifndef _RANKITEM_H_// このマクロ定義がされていなかったら
+#define _RANKITEM_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "number.h"
 #include "rankingmanager.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CRank;
 
 
 //*****************************************************************************
-// LOACeNX
+// ランキングアイテムクラス
 //*****************************************************************************
 class CRankItem : public CObject
 {
@@ -29,14 +29,14 @@ public:
 	CRankItem(int nPriority = 7);
 	~CRankItem();
 
-	// CAEg\
+	// レイアウト構造体
 	struct RankLayout
 	{
-		float anchorX;          // 0.0`1.0
-		float anchorY;          // 0.0`1.0
-		float digitWidthRate;   // ʕɑ΂銄
-		float digitHeightRate;  // ʍɑ΂銄
-		float lineSpacingRate;  // sԁidigitHeightj
+		float anchorX;          // 0.0～1.0
+		float anchorY;          // 0.0～1.0
+		float digitWidthRate;   // 画面幅に対する割合
+		float digitHeightRate;  // 画面高に対する割合
+		float lineSpacingRate;  // 行間（digitHeight基準）
 	};
 
 	static CRankItem* Create(float anchorX, float anchorY, float digitWidthRate, float digitHeightRate, float SpaceRate);
@@ -52,18 +52,16 @@ public:
 	void ShowNewRankEffect(int rankIndex);
 
 private:
-	static constexpr int	MaxRanking		= 5;	// \
-	static constexpr int	MAX_DIGITS		= 3;	// 
-	static constexpr float	SPACING_RANK_X	= 0.2f;	// ʂƌ̊Ԃ̊Ԋu
+	static constexpr int	MaxRanking		= 5;	// 表示数
+	static constexpr float	SPACING_RANK_X	= 0.2f;	// 順位と個数の間の間隔
 
-	CNumber*	m_apNumber[MaxRanking][MAX_DIGITS];	// e̐\p
-	int			m_nDig[MaxRanking][MAX_DIGITS];		// \
-	float		m_digitWidth;						// 1̕
-	float		m_digitHeight;						// 1̍
-	D3DXVECTOR3 m_basePos;							// \̊Jnʒu
-	int			m_nIdxTexture;						// eNX`CfbNX
-	RankLayout	m_layout;							// CAEg\̕ϐ
-	CRank*		m_apRank[MaxRanking];				// ʂւ̃|C^
+	CNumber*	m_apNumber[MaxRanking];				// 各行の数字表示用
+	int			m_anValue[MaxRanking];				// 各行の個数
+	float		m_digitWidth;						// 数字1桁あたりの幅
+	float		m_digitHeight;						// 数字1桁あたりの高さ
+	D3DXVECTOR3 m_basePos;							// 表示の開始位置
+	RankLayout	m_layout;							// レイアウト構造体変数
+	CRank*		m_apRank[MaxRanking];				// 順位へのポインタ
 
 };
 
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// LO^C [ranktime.cpp]
+// ランキングタイム処理 [ranktime.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "ranktime.h"
 #include "renderer.h"
@@ -15,35 +15,33 @@
 #include "rank.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CRankTime::CRankTime(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_apNumber, 0, sizeof(m_apNumber));		// e̐\p
-	memset(m_apRankClon, 0, sizeof(m_apRankClon));	// Rւ̃|C^
-	m_nMinutes		= 0;							// 
-	m_nSeconds		= 0;							// b
-	m_digitWidth	= 0.0f;							// 1̕
-	m_digitHeight	= 0.0f;							// 1̍
-	m_basePos		= INIT_VEC3;					// \̊Jnʒu
-	m_nIdxTexture	= 0;							// eNX`CfbNX
+	// 値のクリア
+	memset(m_apNumber, 0, sizeof(m_apNumber));		// 各行の数字表示用
+	m_nMinutes		= 0;							// 分
+	m_nSeconds		= 0;							// 秒
+	m_digitWidth	= 0.0f;							// 数字1桁あたりの幅
+	m_digitHeight	= 0.0f;							// 数字1桁あたりの高さ
+	m_basePos		= INIT_VEC3;					// 表示の開始位置
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CRankTime::~CRankTime()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CRankTime* CRankTime::Create(float baseX,float baseY,float digitWidth,float digitHeight)
 {
 	CRankTime* pRankTime = new CRankTime;
 
-	// nullptr
+	// nullptrだったら
 	if (pRankTime == nullptr)
 	{
 		return nullptr;
@@ -53,7 +51,7 @@ CRankTime* CRankTime::Create(float baseX,float baseY,float digitWidth,float digi
 	pRankTime->m_digitWidth = digitWidth;
 	pRankTime->m_digitHeight = digitHeight;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pRankTime->Init()))
 	{
 		return nullptr;
@@ -62,142 +60,99 @@ CRankTime* CRankTime::Create(float baseX,float baseY,float digitWidth,float digi
 	return pRankTime;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CRankTime::Init(void)
 {
-	// 5ʂ܂Ő
+	// 5位まで生成する
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		// UI̐
+		// 順位UIの生成
 		float UIbaseX = m_basePos.x + m_digitWidth;
 		float UIbaseY = m_basePos.y + nCnt * (m_digitHeight + 50.0f);
 
-		// ʕ\
+		// 順位表示
 		CRank::Create(D3DXVECTOR3(UIbaseX, UIbaseY, 0.0f), m_digitWidth / 2, m_digitHeight, (float)nCnt);
 
-		// UI̕
+		// 順位UIの幅
 		float rankWidth = (m_digitWidth / 2) + 50.0f;
 
-		// 
-		for (int nCnt2 = 0; nCnt2 < 2; nCnt2++)
-		{
-			float x = UIbaseX + rankWidth + nCnt2 * m_digitWidth;
-			float y = UIbaseY;
-
-			m_apNumber[nCnt][nCnt2] = CNumber::Create(x, y, m_digitWidth, m_digitHeight);
-		}
-		
-		// R̐iƕb̊ԁj
-		float colonX = UIbaseX + rankWidth + 2 * m_digitWidth;
-		float colonY = UIbaseY;
-		m_apRankClon[nCnt] = CRankColon::Create(D3DXVECTOR3(colonX, colonY, 0.0f), m_digitWidth / 2, m_digitHeight);
+		// 分と秒をコロンで区切って1行を1つのナンバーで並べる
+		m_apNumber[nCnt] = CNumber::Create(UIbaseX + rankWidth, UIbaseY, m_digitWidth, m_digitHeight);
 
-		// R̕
-		float colonWidth = rankWidth + m_digitWidth / 2;
-
-		// b
-		for (int nCnt2 = 2; nCnt2 < DIGITS; nCnt2++)
+		if (!m_apNumber[nCnt])
 		{
-			float x = UIbaseX + colonWidth + nCnt2 * m_digitWidth;
-			float y = UIbaseY;
-
-			m_apNumber[nCnt][nCnt2] = CNumber::Create(x, y, m_digitWidth, m_digitHeight);
+			return E_FAIL;
 		}
-	}
 
-	// eNX`蓖
-	CTexture* pTexture = CManager::GetTexture();
-	m_nIdxTexture = pTexture->RegisterDynamic("data/TEXTURE/num_01.png");
+		m_apNumber[nCnt]->SetTime(0, 0);
+	}
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CRankTime::Uninit(void)
 {
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		for (int nCnt2 = 0; nCnt2 < DIGITS; nCnt2++)
+		if (m_apNumber[nCnt])
 		{
-			if (m_apNumber[nCnt][nCnt2])
-			{
-				// io[̏I
-				m_apNumber[nCnt][nCnt2]->Uninit();
+			// ナンバーの終了処理
+			m_apNumber[nCnt]->Uninit();
 
-				delete m_apNumber[nCnt][nCnt2];
-				m_apNumber[nCnt][nCnt2] = nullptr;
-			}
+			delete m_apNumber[nCnt];
+			m_apNumber[nCnt] = nullptr;
 		}
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CRankTime::Update(void)
 {
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		for (int nCnt2 = 0; nCnt2 < DIGITS; nCnt2++)
+		if (m_apNumber[nCnt])
 		{
-			if (m_apNumber[nCnt][nCnt2])
-			{
-				// io[̍XV(UV)
-				m_apNumber[nCnt][nCnt2]->Update();
-			}
+			// ナンバーの更新処理(拡大アニメーション)
+			m_apNumber[nCnt]->Update();
 		}
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CRankTime::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
 	for (int nCnt = 0; nCnt < MaxRanking; nCnt++)
 	{
-		for (int nCnt2 = 0; nCnt2 < DIGITS; nCnt2++)
+		if (m_apNumber[nCnt])
 		{
-			if (m_apNumber[nCnt][nCnt2])
-			{
-				// eNX`̐ݒ
-				pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-				// io[̕`揈
-				m_apNumber[nCnt][nCnt2]->Draw();
-			}
+			// ナンバーの描画処理
+			m_apNumber[nCnt]->Draw();
 		}
 	}
 }
 //=============================================================================
-// LOXg̐ݒ菈
+// ランキングリストの設定処理
 //=============================================================================
 void CRankTime::SetRankList(const std::vector<std::pair<int, int>>& rankList)
 {
 	for (size_t nCnt = 0; nCnt < rankList.size() && nCnt < MaxRanking; nCnt++)
 	{
-		int min10 = rankList[nCnt].first / 10;
-		int min1 = rankList[nCnt].first % 10;
-		int sec10 = rankList[nCnt].second / 10;
-		int sec1 = rankList[nCnt].second % 10;
-
-		if (m_apNumber[nCnt][0])m_apNumber[nCnt][0]->SetDigit(min10);
-		if (m_apNumber[nCnt][1])m_apNumber[nCnt][1]->SetDigit(min1);
-		if (m_apNumber[nCnt][2])m_apNumber[nCnt][2]->SetDigit(sec10);
-		if (m_apNumber[nCnt][3])m_apNumber[nCnt][3]->SetDigit(sec1);
+		if (m_apNumber[nCnt])
+		{
+			m_apNumber[nCnt]->SetTime(rankList[nCnt].first, rankList[nCnt].second);
+		}
 	}
 }
 //=============================================================================
-// NCGtFNg̕\
+// ランクインエフェクトの表示
 //=============================================================================
 void CRankTime::ShowNewRankEffect(int rankIndex)
 {
@@ -206,161 +161,9 @@ void CRankTime::ShowNewRankEffect(int rankIndex)
 		return;
 	}
 
-	for (int n = 0; n < DIGITS; n++)
+	if (m_apNumber[rankIndex])
 	{
-		if (m_apNumber[rankIndex][n])
-		{
-			// NC̃XP[Aj[V
-			m_apNumber[rankIndex][n]->SetScaleAnim();
-		}
-	}
-}
-
-
-//=============================================================================
-// R̃RXgN^
-//=============================================================================
-CRankColon::CRankColon(int nPriority) : CObject(nPriority)
-{
-	// l̃NA
-	m_pVtxBuff		= nullptr;		// _obt@
-	m_pos			= INIT_VEC3;	// ʒu
-	m_fWidth		= 0.0f;			// 
-	m_fHeight		= 0.0f;			// 
-	m_nIdxTexture	= 0;			// eNX`CfbNX
-}
-//=============================================================================
-// R̃fXgN^
-//=============================================================================
-CRankColon::~CRankColon()
-{
-	// Ȃ
-}
-//=============================================================================
-// R̐
-//=============================================================================
-CRankColon* CRankColon::Create(D3DXVECTOR3 pos, float fWidth, float fHeight)
-{
-	CRankColon* pRankColon = new CRankColon;
-
-	// nullptr
-	if (pRankColon == nullptr)
-	{
-		return nullptr;
-	}
-
-	pRankColon->m_pos = pos;
-	pRankColon->m_fWidth = fWidth;
-	pRankColon->m_fHeight = fHeight;
-
-	// s
-	if (FAILED(pRankColon->Init()))
-	{
-		return nullptr;
-	}
-
-	return pRankColon;
-}
-//=============================================================================
-// Ȑ
-//=============================================================================
-HRESULT CRankColon::Init(void)
-{
-	// foCX擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`̓o^
-	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/colon.png");
-
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(m_pos.x, m_pos.y, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(m_pos.x, m_pos.y + m_fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y + m_fHeight, 0.0f);
-
-	// rhw̐ݒ
-	pVtx[0].rhw = 1.0f;
-	pVtx[1].rhw = 1.0f;
-	pVtx[2].rhw = 1.0f;
-	pVtx[3].rhw = 1.0f;
-
-	// _J[̐ݒ
-	pVtx[0].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[1].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[2].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[3].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-
-	// eNX`W̐ݒ
-	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
-	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
-	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
-	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-
-	return S_OK;
-}
-//=============================================================================
-// ȐI
-//=============================================================================
-void CRankColon::Uninit(void)
-{
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
-
-	this->Release();
-}
-//=============================================================================
-// R̍XV
-//=============================================================================
-void CRankColon::Update(void)
-{
-
-
-
-
-}
-//=============================================================================
-// R̕`揈
-//=============================================================================
-void CRankColon::Draw(void)
-{
-	if (CManager::GetMode() == CScene::MODE_RANKING)
-	{
-		// eNX`̎擾
-		CTexture* pTexture = CManager::GetTexture();
-
-		// foCX̎擾
-		LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-		// _obt@f[^Xg[ɐݒ
-		pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-		// _tH[}bg̐ݒ
-		pDevice->SetFVF(FVF_VERTEX_2D);
-
-		// eNX`̐ݒ
-		pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-		// |S̕`
-		pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
+		// ランクインのスケールアニメーション
+		m_apNumber[rankIndex]->SetScaleAnim();
 	}
 }
\ No newline at end of file
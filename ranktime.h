@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// LO^C [ranktime.h]
+// ランキングタイム処理 [ranktime.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RANKTIME_H_// ̃}N`ĂȂ
-#define _RANKTIME_H_// 2dCN[hh~̃}N`
+#ifndef _RANKTIME_H_// このマクロ定義がされていなかったら
+#define _RANKTIME_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "number.h"
@@ -16,12 +16,7 @@
 #include "time.h"
 
 //*****************************************************************************
-// O錾
-//*****************************************************************************
-class CRankColon;
-
-//*****************************************************************************
-// LO^CNX
+// ランキングタイムクラス
 //*****************************************************************************
 class CRankTime : public CObject
 {
@@ -39,41 +34,15 @@ public:
 	void ShowNewRankEffect(int rankIndex);
 
 private:
-	static constexpr int MaxRanking = 5;		// \
-	static constexpr int DIGITS		= 4;		// (2Ab2)
-
-	CNumber*	m_apNumber[MaxRanking][DIGITS];	// io[ւ̃|C^
-	int			m_nMinutes;						// 
-	int			m_nSeconds;						// b
-	float		m_digitWidth;					// 1̕
-	float		m_digitHeight;					// 1̍
-	D3DXVECTOR3 m_basePos;						// \̊Jnʒu
-	CRankColon* m_apRankClon[MaxRanking];		// Rւ̃|C^
-	int			m_nIdxTexture;					// eNX`CfbNX
-
-};
-
-//*****************************************************************************
-// LORNX
-//*****************************************************************************
-class CRankColon : public CObject
-{
-public:
-	CRankColon(int nPriority = 7);
-	~CRankColon();
+	static constexpr int MaxRanking = 5;		// 表示数
 
-	static CRankColon* Create(D3DXVECTOR3 pos, float fWidth, float fHeight);
-	HRESULT Init(void);
-	void Uninit(void);
-	void Update(void);
-	void Draw(void);
+	CNumber*	m_apNumber[MaxRanking];			// 各行のナンバーへのポインタ(mm:ss)
+	int			m_nMinutes;						// 分
+	int			m_nSeconds;						// 秒
+	float		m_digitWidth;					// 数字1桁あたりの幅
+	float		m_digitHeight;					// 数字1桁あたりの高さ
+	D3DXVECTOR3 m_basePos;						// 表示の開始位置
 
-private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@
-	D3DXVECTOR3				m_pos;			// ʒu
-	float					m_fWidth;		// 
-	float					m_fHeight;		// 
-	int						m_nIdxTexture;	// eNX`CfbNX
 };
 
 #endif
\ No newline at end of file
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// CLXg [raycast.cpp]
+// レイキャスト処理 [raycast.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "raycast.h"
 #include "renderer.h"
@@ -14,32 +14,32 @@
 
 
 //=============================================================================
-// }EXʒu烏[hC擾鏈
+// マウス位置からワールドレイを取得する処理
 //=============================================================================
 bool CRayCast::GetMouseRay(D3DXVECTOR3& outOrigin, D3DXVECTOR3& outDir)
 {
-    // }EXW擾
+    // マウス座標取得
     POINT pt;
     GetCursorPos(&pt);
 
-    // NCAgWɕϊ
+    // クライアント座標に変換
     HWND hwnd = GetActiveWindow();
     ScreenToClient(hwnd, &pt);
 
-    // foCXEr[|[g
+    // デバイス・ビューポート
     CRenderer* renderer = CManager::GetRenderer();
     LPDIRECT3DDEVICE9 pDevice = renderer->GetDevice();
 
     D3DVIEWPORT9 vp;
     pDevice->GetViewport(&vp);
 
-    // s擾
+    // 行列取得
     D3DXMATRIX matProj, matView, matWorld;
     pDevice->GetTransform(D3DTS_PROJECTION, &matProj);
     pDevice->GetTransform(D3DTS_VIEW, &matView);
-    D3DXMatrixIdentity(&matWorld); // Pʍs
+    D3DXMatrixIdentity(&matWorld); // 単位行列
 
-    // Unproject near/far 2_[hԂɕϊ
+    // Unprojectで near/far の2点をワールド空間に変換
     D3DXVECTOR3 nearPt((float)pt.x, (float)pt.y, 0.0f);
     D3DXVECTOR3 farPt((float)pt.x, (float)pt.y, 1.0f);
 
@@ -47,7 +47,7 @@ bool CRayCast::GetMouseRay(D3DXVECTOR3& outOrigin, D3DXVECTOR3& outDir)
     D3DXVec3Unproject(&worldNear, &nearPt, &vp, &matProj, &matView, &matWorld);
     D3DXVec3Unproject(&worldFar, &farPt, &vp, &matProj, &matView, &matWorld);
 
-    // C̏o_ƕ
+    // レイの出発点と方向
     outOrigin = worldNear;
     outDir = worldFar - worldNear;
     D3DXVec3Normalize(&outDir, &outDir);
@@ -55,7 +55,7 @@ bool CRayCast::GetMouseRay(D3DXVECTOR3& outOrigin, D3DXVECTOR3& outDir)
     return true;
 }
 //=============================================================================
-// CAABB̓蔻
+// レイとAABBの当たり判定
 //=============================================================================
 bool CRayCast::IntersectAABB(const D3DXVECTOR3& rayOrigin,
     const D3DXVECTOR3& rayDir,
@@ -106,7 +106,7 @@ bool CRayCast::IntersectAABB(const D3DXVECTOR3& rayOrigin,
     return true;
 }
 //=============================================================================
-// COBB̓蔻
+// レイとOBBの当たり判定
 //=============================================================================
 bool CRayCast::IntersectOBB(
     const D3DXVECTOR3& rayOrigin,
@@ -116,28 +116,28 @@ bool CRayCast::IntersectOBB(
     float& outDistance
 )
 {
-    // [h[Jւ̋tsvZ
+    // ワールド→ローカルへの逆行列を計算
     D3DXMATRIX invWorld;
     if (D3DXMatrixInverse(&invWorld, NULL, &worldMatrix) == NULL)
     {
         return false;
     }
 
-    // C[JԂɕϊ
+    // レイをローカル空間に変換
     D3DXVECTOR3 localOrigin, localDir;
     D3DXVec3TransformCoord(&localOrigin, &rayOrigin, &invWorld);
     D3DXVec3TransformNormal(&localDir, &rayDir, &invWorld);
     D3DXVec3Normalize(&localDir, &localDir);
 
-    // [JԂAABBɑ΂郌C蔻
-    // AABBmin/maxvZ
+    // ローカル空間のAABBに対するレイ当たり判定
+    // AABBのmin/maxを計算
     D3DXVECTOR3 boxMin = -halfSize;
     D3DXVECTOR3 boxMax = +halfSize;
 
     float tmin = -FLT_MAX;
     float tmax = FLT_MAX;
 
-    // eƂɌvZ
+    // 各軸ごとに交差計算
     for (int nCnt = 0; nCnt < 3; nCnt++)
     {
         float origin = ((float*)&localOrigin)[nCnt];
@@ -171,11 +171,11 @@ bool CRayCast::IntersectOBB(
         }
     }
 
-    // ŏԂ
+    // 最小交差距離を返す
 
     if (tmin < 0.0f)
     {
-        return false; // C̎n_͖̌
+        return false; // レイの始点より後ろの交差は無効
     }
 
     outDistance = tmin;
@@ -1,34 +1,34 @@
 //=============================================================================
 //
-// CLXg [raycast.h]
+// レイキャスト処理 [raycast.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RAYCAST_H_// ̃}N`ĂȂ
-#define _RAYCAST_H_// 2dCN[hh~̃}N`
+#ifndef _RAYCAST_H_// このマクロ定義がされていなかったら
+#define _RAYCAST_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 
 //*****************************************************************************
-// CLXgNX
+// レイキャストクラス
 //*****************************************************************************
 class CRayCast
 {
 public:
 
-    // }EXʒu烏[hC擾
+    // マウス位置からワールドレイを取得
     static bool GetMouseRay(D3DXVECTOR3& outOrigin, D3DXVECTOR3& outDir);
 
-    // CAABB̓蔻
+    // レイとAABBの当たり判定
     static bool IntersectAABB(const D3DXVECTOR3& rayOrigin,
         const D3DXVECTOR3& rayDir,
         const D3DXVECTOR3& boxMin,
         const D3DXVECTOR3& boxMax,
         float& outDist);
 
-    // COBB̓蔻
+    // レイとOBBの当たり判定
     static bool IntersectOBB(
         const D3DXVECTOR3& rayOrigin,
         const D3DXVECTOR3& rayDir,
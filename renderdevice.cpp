@@ -0,0 +1,1090 @@
+//=============================================================================
+//
+// 描画デバイス処理 [renderdevice.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "renderdevice.h"
+#include "telemetry.h"
+#include "memorymanager.h"
+
+//*****************************************************************************
+// 命令の名前(ダンプ用)
+//*****************************************************************************
+namespace
+{
+	const char* CMD_NAME[CRenderRecorder::CMD_MAX] =
+	{
+		"CREATE",
+		"LOCK",
+		"TEX",
+		"RS",
+		"XFORM",
+		"MTRL",
+		"LIGHT",
+		"SHADER",
+		"CONST",
+		"FVF",
+		"STREAM",
+		"DRAW",
+	};
+
+	// 変換行列の種類を記録用のインデックスに変換する
+	int TransformIndex(D3DTRANSFORMSTATETYPE type)
+	{
+		switch (type)
+		{
+		case D3DTS_WORLD:		return 0;
+		case D3DTS_VIEW:		return 1;
+		case D3DTS_PROJECTION:	return 2;
+		default:				return -1;
+		}
+	}
+
+	// ステートキャッシュの未設定を表す値
+	const DWORD						INVALID_FVF	= 0xFFFFFFFF;
+	const LPDIRECT3DVERTEXBUFFER9	INVALID_VB	= (LPDIRECT3DVERTEXBUFFER9)(uintptr_t)-1;
+	const LPDIRECT3DINDEXBUFFER9	INVALID_IB	= (LPDIRECT3DINDEXBUFFER9)(uintptr_t)-1;
+	const LPDIRECT3DVERTEXSHADER9	INVALID_VS	= (LPDIRECT3DVERTEXSHADER9)(uintptr_t)-1;
+	const LPDIRECT3DPIXELSHADER9	INVALID_PS	= (LPDIRECT3DPIXELSHADER9)(uintptr_t)-1;
+}
+
+//=============================================================================
+// D3D9描画デバイスのコンストラクタ
+//=============================================================================
+CRenderDeviceD3D9::CRenderDeviceD3D9(LPDIRECT3DDEVICE9 pDevice)
+{
+	// 値のクリア
+	m_pDevice = pDevice;	// デバイスへのポインタ
+}
+//=============================================================================
+// D3D9描画デバイスのデストラクタ
+//=============================================================================
+CRenderDeviceD3D9::~CRenderDeviceD3D9()
+{
+	// デバイスはレンダラーが解放する
+}
+//=============================================================================
+// 頂点バッファの生成
+//=============================================================================
+HRESULT CRenderDeviceD3D9::CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle)
+{
+	return m_pDevice->CreateVertexBuffer(length, usage, fvf, pool, ppVtxBuff, pSharedHandle);
+}
+//=============================================================================
+// インデックスバッファの生成
+//=============================================================================
+HRESULT CRenderDeviceD3D9::CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle)
+{
+	return m_pDevice->CreateIndexBuffer(length, usage, format, pool, ppIdxBuff, pSharedHandle);
+}
+//=============================================================================
+// 頂点バッファのロック
+//=============================================================================
+HRESULT CRenderDeviceD3D9::LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags)
+{
+	// ロック回数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_BUFFER_LOCK);
+
+	return pVtxBuff->Lock(offset, size, ppData, flags);
+}
+//=============================================================================
+// 頂点バッファのアンロック
+//=============================================================================
+HRESULT CRenderDeviceD3D9::UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff)
+{
+	return pVtxBuff->Unlock();
+}
+//=============================================================================
+// インデックスバッファのロック
+//=============================================================================
+HRESULT CRenderDeviceD3D9::LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags)
+{
+	// ロック回数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_BUFFER_LOCK);
+
+	return pIdxBuff->Lock(offset, size, ppData, flags);
+}
+//=============================================================================
+// インデックスバッファのアンロック
+//=============================================================================
+HRESULT CRenderDeviceD3D9::UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff)
+{
+	return pIdxBuff->Unlock();
+}
+//=============================================================================
+// テクスチャの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	// テクスチャ設定回数の計測(ステートキャッシュで省かれた物は届かないので数えない)
+	CTelemetry::Add(CTelemetry::COUNTER_TEXTURE_SET);
+
+	return m_pDevice->SetTexture(stage, pTexture);
+}
+//=============================================================================
+// レンダーステートの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetRenderState(D3DRENDERSTATETYPE state, DWORD value)
+{
+	return m_pDevice->SetRenderState(state, value);
+}
+//=============================================================================
+// 変換行列の設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix)
+{
+	return m_pDevice->SetTransform(type, pMatrix);
+}
+//=============================================================================
+// 変換行列の取得
+//=============================================================================
+HRESULT CRenderDeviceD3D9::GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix)
+{
+	return m_pDevice->GetTransform(type, pMatrix);
+}
+//=============================================================================
+// マテリアルの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetMaterial(const D3DMATERIAL9* pMaterial)
+{
+	return m_pDevice->SetMaterial(pMaterial);
+}
+//=============================================================================
+// マテリアルの取得
+//=============================================================================
+HRESULT CRenderDeviceD3D9::GetMaterial(D3DMATERIAL9* pMaterial)
+{
+	return m_pDevice->GetMaterial(pMaterial);
+}
+//=============================================================================
+// ライトの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetLight(DWORD index, const D3DLIGHT9* pLight)
+{
+	return m_pDevice->SetLight(index, pLight);
+}
+//=============================================================================
+// ライトの有効・無効の設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::LightEnable(DWORD index, BOOL bEnable)
+{
+	return m_pDevice->LightEnable(index, bEnable);
+}
+//=============================================================================
+// 頂点シェーダーの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader)
+{
+	// シェーダー切り替え回数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_SHADER_SWITCH);
+
+	return m_pDevice->SetVertexShader(pShader);
+}
+//=============================================================================
+// ピクセルシェーダーの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader)
+{
+	// シェーダー切り替え回数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_SHADER_SWITCH);
+
+	return m_pDevice->SetPixelShader(pShader);
+}
+//=============================================================================
+// 頂点シェーダー定数の設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount)
+{
+	return m_pDevice->SetVertexShaderConstantF(startRegister, pData, vector4fCount);
+}
+//=============================================================================
+// ピクセルシェーダー定数の設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount)
+{
+	return m_pDevice->SetPixelShaderConstantF(startRegister, pData, vector4fCount);
+}
+//=============================================================================
+// 頂点フォーマットの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetFVF(DWORD fvf)
+{
+	return m_pDevice->SetFVF(fvf);
+}
+//=============================================================================
+// 頂点バッファをデータストリームに設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride)
+{
+	return m_pDevice->SetStreamSource(stream, pVtxBuff, offset, stride);
+}
+//=============================================================================
+// インデックスバッファの設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff)
+{
+	return m_pDevice->SetIndices(pIdxBuff);
+}
+//=============================================================================
+// ストリームの分周設定(インスタンシング用)
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetStreamSourceFreq(UINT stream, UINT setting)
+{
+	return m_pDevice->SetStreamSourceFreq(stream, setting);
+}
+//=============================================================================
+// 頂点宣言の設定
+//=============================================================================
+HRESULT CRenderDeviceD3D9::SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl)
+{
+	return m_pDevice->SetVertexDeclaration(pDecl);
+}
+//=============================================================================
+// ポリゴンの描画
+//=============================================================================
+HRESULT CRenderDeviceD3D9::DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount)
+{
+	return m_pDevice->DrawPrimitive(type, startVertex, primitiveCount);
+}
+//=============================================================================
+// インデックス付きポリゴンの描画
+//=============================================================================
+HRESULT CRenderDeviceD3D9::DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount)
+{
+	return m_pDevice->DrawIndexedPrimitive(type, baseVertex, minIndex, numVertices, startIndex, primitiveCount);
+}
+//=============================================================================
+// ユーザーメモリからのポリゴンの描画
+//=============================================================================
+HRESULT CRenderDeviceD3D9::DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride)
+{
+	return m_pDevice->DrawPrimitiveUP(type, primitiveCount, pVertexData, stride);
+}
+//=============================================================================
+// メッシュのサブセット描画
+//=============================================================================
+HRESULT CRenderDeviceD3D9::DrawSubset(LPD3DXMESH pMesh, DWORD attribId)
+{
+	// DrawSubset回数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_DRAW_SUBSET);
+
+	return pMesh->DrawSubset(attribId);
+}
+//=============================================================================
+// 記録描画デバイスのコンストラクタ
+//=============================================================================
+CRenderRecorder::CRenderRecorder(CRenderDevice* pInner)
+{
+	// 値のクリア
+	m_pInner		= pInner;	// 転送先のデバイス
+	memset(m_anCount, 0, sizeof(m_anCount));// 命令の種類ごとの回数
+	m_nUploadUP		= 0;		// DrawPrimitiveUPで送った回数
+	m_material		= {};		// 記録のみのときのマテリアル
+	m_nextNullHandle = NULL_HANDLE_BASE;	// 記録のみのときに次に返すバッファの識別子
+
+	for (int nCnt = 0; nCnt < 3; nCnt++)
+	{
+		D3DXMatrixIdentity((D3DXMATRIX*)&m_aTransform[nCnt]);
+	}
+}
+//=============================================================================
+// 記録描画デバイスのデストラクタ
+//=============================================================================
+CRenderRecorder::~CRenderRecorder()
+{
+	// 転送先のデバイスはレンダラーが破棄する
+}
+//=============================================================================
+// フレーム開始処理(記録のリセット)
+//=============================================================================
+void CRenderRecorder::BeginFrame(void)
+{
+	// 容量は残したまま空にする
+	m_commands.clear();
+
+	memset(m_anCount, 0, sizeof(m_anCount));
+	m_nUploadUP = 0;
+}
+//=============================================================================
+// 記録した命令列の書き出し処理
+//=============================================================================
+void CRenderRecorder::WriteFrame(FILE* pFile) const
+{
+	if (pFile == nullptr)
+	{
+		return;
+	}
+
+	for (const auto& cmd : m_commands)
+	{
+		fprintf(pFile, "%s %lu %lu\n", CMD_NAME[cmd.type], cmd.arg0, cmd.arg1);
+	}
+
+	fprintf(pFile, "# draw %d state %d upload %d\n", GetDrawCount(), GetStateChangeCount(), GetUploadCount());
+}
+//=============================================================================
+// ステート変更回数の取得
+//=============================================================================
+int CRenderRecorder::GetStateChangeCount(void) const
+{
+	return m_anCount[CMD_SET_TEXTURE] + m_anCount[CMD_SET_RENDERSTATE] + m_anCount[CMD_SET_TRANSFORM] +
+		m_anCount[CMD_SET_MATERIAL] + m_anCount[CMD_SET_LIGHT] + m_anCount[CMD_SET_SHADER] + m_anCount[CMD_SET_CONSTANT] + m_anCount[CMD_SET_FVF] + m_anCount[CMD_SET_STREAM];
+}
+//=============================================================================
+// 命令の記録処理
+//=============================================================================
+void CRenderRecorder::Record(CMD type, DWORD arg0, DWORD arg1)
+{
+	Command cmd = { (DWORD)type, arg0, arg1 };
+
+	m_commands.push_back(cmd);
+	m_anCount[type]++;
+}
+//=============================================================================
+// 記録のみのときのバッファの生成処理(識別子だけを返し、大きさを覚えておく。COMオブジェクトではないのでこのデバイス以外に渡さない)
+//=============================================================================
+void* CRenderRecorder::CreateNullBuffer(UINT length)
+{
+	uintptr_t handle = m_nextNullHandle;
+	m_nextNullHandle += NULL_HANDLE_STEP;
+
+	m_nullBuffer[handle] = length;
+
+	return (void*)handle;
+}
+//=============================================================================
+// 記録のみのときのバッファのロック処理(書き込み先だけ用意する。大きさ0は生成時の大きさの残り全部)
+//=============================================================================
+HRESULT CRenderRecorder::LockNullBuffer(const void* pBuff, UINT offset, UINT size, void** ppData)
+{
+	auto it = m_nullBuffer.find((uintptr_t)pBuff);
+
+	if (it == m_nullBuffer.end() || offset > it->second)
+	{
+		*ppData = nullptr;
+		return E_FAIL;
+	}
+
+	if (size == 0)
+	{
+		size = it->second - offset;
+	}
+
+	if (size > it->second - offset)
+	{
+		*ppData = nullptr;
+		return E_FAIL;
+	}
+
+	*ppData = CMemoryManager::GetFrameAllocator().Alloc(size);
+
+	return S_OK;
+}
+//=============================================================================
+// 頂点バッファの生成
+//=============================================================================
+HRESULT CRenderRecorder::CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle)
+{
+	Record(CMD_CREATE_BUFFER, length, fvf);
+
+	if (m_pInner == nullptr)
+	{
+		*ppVtxBuff = (LPDIRECT3DVERTEXBUFFER9)CreateNullBuffer(length);
+		return S_OK;
+	}
+
+	return m_pInner->CreateVertexBuffer(length, usage, fvf, pool, ppVtxBuff, pSharedHandle);
+}
+//=============================================================================
+// インデックスバッファの生成
+//=============================================================================
+HRESULT CRenderRecorder::CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle)
+{
+	Record(CMD_CREATE_BUFFER, length, (DWORD)format);
+
+	if (m_pInner == nullptr)
+	{
+		*ppIdxBuff = (LPDIRECT3DINDEXBUFFER9)CreateNullBuffer(length);
+		return S_OK;
+	}
+
+	return m_pInner->CreateIndexBuffer(length, usage, format, pool, ppIdxBuff, pSharedHandle);
+}
+//=============================================================================
+// 頂点バッファのロック
+//=============================================================================
+HRESULT CRenderRecorder::LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags)
+{
+	Record(CMD_LOCK, offset, size);
+
+	if (m_pInner == nullptr)
+	{
+		return LockNullBuffer(pVtxBuff, offset, size, ppData);
+	}
+
+	if (pVtxBuff == nullptr)
+	{
+		*ppData = nullptr;
+		return E_FAIL;
+	}
+
+	return m_pInner->LockVertexBuffer(pVtxBuff, offset, size, ppData, flags);
+}
+//=============================================================================
+// 頂点バッファのアンロック
+//=============================================================================
+HRESULT CRenderRecorder::UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff)
+{
+	if (m_pInner == nullptr)
+	{
+		return m_nullBuffer.count((uintptr_t)pVtxBuff) != 0 ? S_OK : E_FAIL;
+	}
+
+	if (pVtxBuff == nullptr)
+	{
+		return E_FAIL;
+	}
+
+	return m_pInner->UnlockVertexBuffer(pVtxBuff);
+}
+//=============================================================================
+// インデックスバッファのロック
+//=============================================================================
+HRESULT CRenderRecorder::LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags)
+{
+	Record(CMD_LOCK, offset, size);
+
+	if (m_pInner == nullptr)
+	{
+		return LockNullBuffer(pIdxBuff, offset, size, ppData);
+	}
+
+	if (pIdxBuff == nullptr)
+	{
+		*ppData = nullptr;
+		return E_FAIL;
+	}
+
+	return m_pInner->LockIndexBuffer(pIdxBuff, offset, size, ppData, flags);
+}
+//=============================================================================
+// インデックスバッファのアンロック
+//=============================================================================
+HRESULT CRenderRecorder::UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff)
+{
+	if (m_pInner == nullptr)
+	{
+		return m_nullBuffer.count((uintptr_t)pIdxBuff) != 0 ? S_OK : E_FAIL;
+	}
+
+	if (pIdxBuff == nullptr)
+	{
+		return E_FAIL;
+	}
+
+	return m_pInner->UnlockIndexBuffer(pIdxBuff);
+}
+//=============================================================================
+// テクスチャの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	Record(CMD_SET_TEXTURE, stage, (DWORD)(uintptr_t)pTexture);
+
+	return m_pInner ? m_pInner->SetTexture(stage, pTexture) : S_OK;
+}
+//=============================================================================
+// レンダーステートの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetRenderState(D3DRENDERSTATETYPE state, DWORD value)
+{
+	Record(CMD_SET_RENDERSTATE, (DWORD)state, value);
+
+	return m_pInner ? m_pInner->SetRenderState(state, value) : S_OK;
+}
+//=============================================================================
+// 変換行列の設定
+//=============================================================================
+HRESULT CRenderRecorder::SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix)
+{
+	Record(CMD_SET_TRANSFORM, (DWORD)type, 0);
+
+	int nIdx = TransformIndex(type);
+
+	if (nIdx >= 0)
+	{
+		m_aTransform[nIdx] = *pMatrix;
+	}
+
+	return m_pInner ? m_pInner->SetTransform(type, pMatrix) : S_OK;
+}
+//=============================================================================
+// 変換行列の取得
+//=============================================================================
+HRESULT CRenderRecorder::GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix)
+{
+	if (m_pInner != nullptr)
+	{
+		return m_pInner->GetTransform(type, pMatrix);
+	}
+
+	int nIdx = TransformIndex(type);
+
+	if (nIdx < 0)
+	{
+		return E_FAIL;
+	}
+
+	*pMatrix = m_aTransform[nIdx];
+
+	return S_OK;
+}
+//=============================================================================
+// マテリアルの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetMaterial(const D3DMATERIAL9* pMaterial)
+{
+	Record(CMD_SET_MATERIAL, 0, 0);
+
+	m_material = *pMaterial;
+
+	return m_pInner ? m_pInner->SetMaterial(pMaterial) : S_OK;
+}
+//=============================================================================
+// マテリアルの取得
+//=============================================================================
+HRESULT CRenderRecorder::GetMaterial(D3DMATERIAL9* pMaterial)
+{
+	if (m_pInner != nullptr)
+	{
+		return m_pInner->GetMaterial(pMaterial);
+	}
+
+	*pMaterial = m_material;
+
+	return S_OK;
+}
+//=============================================================================
+// ライトの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetLight(DWORD index, const D3DLIGHT9* pLight)
+{
+	Record(CMD_SET_LIGHT, index, 0);
+
+	return m_pInner ? m_pInner->SetLight(index, pLight) : S_OK;
+}
+//=============================================================================
+// ライトの有効・無効の設定
+//=============================================================================
+HRESULT CRenderRecorder::LightEnable(DWORD index, BOOL bEnable)
+{
+	Record(CMD_SET_LIGHT, index, bEnable ? 1 : 0);
+
+	return m_pInner ? m_pInner->LightEnable(index, bEnable) : S_OK;
+}
+//=============================================================================
+// 頂点シェーダーの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader)
+{
+	Record(CMD_SET_SHADER, 0, (DWORD)(uintptr_t)pShader);
+
+	return m_pInner ? m_pInner->SetVertexShader(pShader) : S_OK;
+}
+//=============================================================================
+// ピクセルシェーダーの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader)
+{
+	Record(CMD_SET_SHADER, 1, (DWORD)(uintptr_t)pShader);
+
+	return m_pInner ? m_pInner->SetPixelShader(pShader) : S_OK;
+}
+//=============================================================================
+// 頂点シェーダー定数の設定
+//=============================================================================
+HRESULT CRenderRecorder::SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount)
+{
+	Record(CMD_SET_CONSTANT, startRegister, vector4fCount);
+
+	return m_pInner ? m_pInner->SetVertexShaderConstantF(startRegister, pData, vector4fCount) : S_OK;
+}
+//=============================================================================
+// ピクセルシェーダー定数の設定(レジスタ番号の上位にピクセルシェーダーの印を付ける)
+//=============================================================================
+HRESULT CRenderRecorder::SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount)
+{
+	Record(CMD_SET_CONSTANT, startRegister | 0x10000, vector4fCount);
+
+	return m_pInner ? m_pInner->SetPixelShaderConstantF(startRegister, pData, vector4fCount) : S_OK;
+}
+//=============================================================================
+// 頂点フォーマットの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetFVF(DWORD fvf)
+{
+	Record(CMD_SET_FVF, fvf, 0);
+
+	return m_pInner ? m_pInner->SetFVF(fvf) : S_OK;
+}
+//=============================================================================
+// 頂点バッファをデータストリームに設定
+//=============================================================================
+HRESULT CRenderRecorder::SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride)
+{
+	Record(CMD_SET_STREAM, stream, stride);
+
+	return m_pInner ? m_pInner->SetStreamSource(stream, pVtxBuff, offset, stride) : S_OK;
+}
+//=============================================================================
+// インデックスバッファの設定
+//=============================================================================
+HRESULT CRenderRecorder::SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff)
+{
+	Record(CMD_SET_STREAM, (DWORD)-1, 0);
+
+	return m_pInner ? m_pInner->SetIndices(pIdxBuff) : S_OK;
+}
+//=============================================================================
+// ストリームの分周設定(インスタンシング用)
+//=============================================================================
+HRESULT CRenderRecorder::SetStreamSourceFreq(UINT stream, UINT setting)
+{
+	Record(CMD_SET_STREAM, stream, setting);
+
+	return m_pInner ? m_pInner->SetStreamSourceFreq(stream, setting) : S_OK;
+}
+//=============================================================================
+// 頂点宣言の設定
+//=============================================================================
+HRESULT CRenderRecorder::SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl)
+{
+	Record(CMD_SET_FVF, 0, (DWORD)(uintptr_t)pDecl);
+
+	return m_pInner ? m_pInner->SetVertexDeclaration(pDecl) : S_OK;
+}
+//=============================================================================
+// ポリゴンの描画
+//=============================================================================
+HRESULT CRenderRecorder::DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount)
+{
+	Record(CMD_DRAW, (DWORD)type, primitiveCount);
+
+	return m_pInner ? m_pInner->DrawPrimitive(type, startVertex, primitiveCount) : S_OK;
+}
+//=============================================================================
+// インデックス付きポリゴンの描画
+//=============================================================================
+HRESULT CRenderRecorder::DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount)
+{
+	Record(CMD_DRAW, (DWORD)type, primitiveCount);
+
+	return m_pInner ? m_pInner->DrawIndexedPrimitive(type, baseVertex, minIndex, numVertices, startIndex, primitiveCount) : S_OK;
+}
+//=============================================================================
+// ユーザーメモリからのポリゴンの描画
+//=============================================================================
+HRESULT CRenderRecorder::DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride)
+{
+	Record(CMD_DRAW, (DWORD)type, primitiveCount);
+
+	// 頂点を毎回送るのでアップロードとしても数える
+	m_nUploadUP++;
+
+	return m_pInner ? m_pInner->DrawPrimitiveUP(type, primitiveCount, pVertexData, stride) : S_OK;
+}
+//=============================================================================
+// メッシュのサブセット描画
+//=============================================================================
+HRESULT CRenderRecorder::DrawSubset(LPD3DXMESH pMesh, DWORD attribId)
+{
+	Record(CMD_DRAW, (DWORD)-1, attribId);
+
+	return m_pInner ? m_pInner->DrawSubset(pMesh, attribId) : S_OK;
+}
+//=============================================================================
+// ステートキャッシュ描画デバイスのコンストラクタ
+//=============================================================================
+CRenderStateCache::CRenderStateCache()
+{
+	// 値のクリア
+	m_pInner		= nullptr;	// 転送先のデバイス
+	m_nSkipCount	= 0;		// 送らずに済んだ回数
+	m_nPassCount	= 0;		// デバイスに送った回数
+
+	Invalidate();
+}
+//=============================================================================
+// ステートキャッシュ描画デバイスのデストラクタ
+//=============================================================================
+CRenderStateCache::~CRenderStateCache()
+{
+	// 転送先のデバイスはレンダラーが破棄する
+}
+//=============================================================================
+// 使用開始処理(転送先を設定してキャッシュを無効にする)
+//=============================================================================
+void CRenderStateCache::Begin(CRenderDevice* pInner)
+{
+	m_pInner = pInner;
+
+	// キャッシュ外で変更されている可能性があるので全て無効にする
+	Invalidate();
+}
+//=============================================================================
+// キャッシュの無効化処理
+//=============================================================================
+void CRenderStateCache::Invalidate(void)
+{
+	memset(m_abRenderState, 0, sizeof(m_abRenderState));
+	memset(m_abTexture, 0, sizeof(m_abTexture));
+
+	m_bWorld	= false;
+	m_bMaterial	= false;
+
+	// どの値とも一致しない値にしておく
+	m_pVS		= INVALID_VS;
+	m_pPS		= INVALID_PS;
+
+	InvalidateStream();
+}
+//=============================================================================
+// 頂点フォーマット・ストリームのキャッシュ無効化処理
+//=============================================================================
+void CRenderStateCache::InvalidateStream(void)
+{
+	// どの値とも一致しない値にしておく
+	m_fvf			= INVALID_FVF;
+	m_pStream		= INVALID_VB;
+	m_streamStride	= 0;
+	m_pIndices		= INVALID_IB;
+}
+//=============================================================================
+// 頂点バッファの生成
+//=============================================================================
+HRESULT CRenderStateCache::CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle)
+{
+	return m_pInner->CreateVertexBuffer(length, usage, fvf, pool, ppVtxBuff, pSharedHandle);
+}
+//=============================================================================
+// インデックスバッファの生成
+//=============================================================================
+HRESULT CRenderStateCache::CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle)
+{
+	return m_pInner->CreateIndexBuffer(length, usage, format, pool, ppIdxBuff, pSharedHandle);
+}
+//=============================================================================
+// 頂点バッファのロック
+//=============================================================================
+HRESULT CRenderStateCache::LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags)
+{
+	return m_pInner->LockVertexBuffer(pVtxBuff, offset, size, ppData, flags);
+}
+//=============================================================================
+// 頂点バッファのアンロック
+//=============================================================================
+HRESULT CRenderStateCache::UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff)
+{
+	return m_pInner->UnlockVertexBuffer(pVtxBuff);
+}
+//=============================================================================
+// インデックスバッファのロック
+//=============================================================================
+HRESULT CRenderStateCache::LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags)
+{
+	return m_pInner->LockIndexBuffer(pIdxBuff, offset, size, ppData, flags);
+}
+//=============================================================================
+// インデックスバッファのアンロック
+//=============================================================================
+HRESULT CRenderStateCache::UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff)
+{
+	return m_pInner->UnlockIndexBuffer(pIdxBuff);
+}
+//=============================================================================
+// テクスチャの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	if (stage < MAX_TEXTURE_STAGE)
+	{
+		if (m_abTexture[stage] && m_apTexture[stage] == pTexture)
+		{
+			m_nSkipCount++;
+			return S_OK;
+		}
+
+		m_abTexture[stage] = true;
+		m_apTexture[stage] = pTexture;
+	}
+
+	m_nPassCount++;
+
+	return m_pInner->SetTexture(stage, pTexture);
+}
+//=============================================================================
+// レンダーステートの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetRenderState(D3DRENDERSTATETYPE state, DWORD value)
+{
+	if ((int)state < MAX_RENDERSTATE)
+	{
+		if (m_abRenderState[state] && m_aRenderState[state] == value)
+		{
+			m_nSkipCount++;
+			return S_OK;
+		}
+
+		m_abRenderState[state] = true;
+		m_aRenderState[state] = value;
+	}
+
+	m_nPassCount++;
+
+	return m_pInner->SetRenderState(state, value);
+}
+//=============================================================================
+// 変換行列の設定
+//=============================================================================
+HRESULT CRenderStateCache::SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix)
+{
+	if (type == D3DTS_WORLD)
+	{
+		if (m_bWorld && memcmp(&m_mtxWorld, pMatrix, sizeof(D3DMATRIX)) == 0)
+		{
+			m_nSkipCount++;
+			return S_OK;
+		}
+
+		m_bWorld = true;
+		m_mtxWorld = *pMatrix;
+	}
+
+	m_nPassCount++;
+
+	return m_pInner->SetTransform(type, pMatrix);
+}
+//=============================================================================
+// 変換行列の取得
+//=============================================================================
+HRESULT CRenderStateCache::GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix)
+{
+	if (type == D3DTS_WORLD && m_bWorld)
+	{
+		*pMatrix = m_mtxWorld;
+		return S_OK;
+	}
+
+	return m_pInner->GetTransform(type, pMatrix);
+}
+//=============================================================================
+// マテリアルの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetMaterial(const D3DMATERIAL9* pMaterial)
+{
+	if (m_bMaterial && memcmp(&m_material, pMaterial, sizeof(D3DMATERIAL9)) == 0)
+	{
+		m_nSkipCount++;
+		return S_OK;
+	}
+
+	m_bMaterial = true;
+	m_material = *pMaterial;
+	m_nPassCount++;
+
+	return m_pInner->SetMaterial(pMaterial);
+}
+//=============================================================================
+// マテリアルの取得
+//=============================================================================
+HRESULT CRenderStateCache::GetMaterial(D3DMATERIAL9* pMaterial)
+{
+	if (m_bMaterial)
+	{
+		*pMaterial = m_material;
+		return S_OK;
+	}
+
+	return m_pInner->GetMaterial(pMaterial);
+}
+//=============================================================================
+// ライトの設定(ライトは呼ぶ側で変わった物だけ送っているのでそのまま渡す)
+//=============================================================================
+HRESULT CRenderStateCache::SetLight(DWORD index, const D3DLIGHT9* pLight)
+{
+	m_nPassCount++;
+
+	return m_pInner->SetLight(index, pLight);
+}
+//=============================================================================
+// ライトの有効・無効の設定
+//=============================================================================
+HRESULT CRenderStateCache::LightEnable(DWORD index, BOOL bEnable)
+{
+	m_nPassCount++;
+
+	return m_pInner->LightEnable(index, bEnable);
+}
+//=============================================================================
+// 頂点シェーダーの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader)
+{
+	if (m_pVS == pShader)
+	{
+		m_nSkipCount++;
+		return S_OK;
+	}
+
+	m_pVS = pShader;
+	m_nPassCount++;
+
+	return m_pInner->SetVertexShader(pShader);
+}
+//=============================================================================
+// ピクセルシェーダーの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader)
+{
+	if (m_pPS == pShader)
+	{
+		m_nSkipCount++;
+		return S_OK;
+	}
+
+	m_pPS = pShader;
+	m_nPassCount++;
+
+	return m_pInner->SetPixelShader(pShader);
+}
+//=============================================================================
+// 頂点シェーダー定数の設定(毎回値が変わるのでキャッシュしない)
+//=============================================================================
+HRESULT CRenderStateCache::SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount)
+{
+	m_nPassCount++;
+
+	return m_pInner->SetVertexShaderConstantF(startRegister, pData, vector4fCount);
+}
+//=============================================================================
+// ピクセルシェーダー定数の設定(毎回値が変わるのでキャッシュしない)
+//=============================================================================
+HRESULT CRenderStateCache::SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount)
+{
+	m_nPassCount++;
+
+	return m_pInner->SetPixelShaderConstantF(startRegister, pData, vector4fCount);
+}
+//=============================================================================
+// 頂点フォーマットの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetFVF(DWORD fvf)
+{
+	if (m_fvf == fvf)
+	{
+		m_nSkipCount++;
+		return S_OK;
+	}
+
+	m_fvf = fvf;
+	m_nPassCount++;
+
+	return m_pInner->SetFVF(fvf);
+}
+//=============================================================================
+// 頂点バッファの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride)
+{
+	if (stream == 0)
+	{
+		if (offset == 0 && m_pStream == pVtxBuff && m_streamStride == stride)
+		{
+			m_nSkipCount++;
+			return S_OK;
+		}
+
+		// オフセット付きはキャッシュしない
+		m_pStream = (offset == 0) ? pVtxBuff : INVALID_VB;
+		m_streamStride = stride;
+	}
+
+	m_nPassCount++;
+
+	return m_pInner->SetStreamSource(stream, pVtxBuff, offset, stride);
+}
+//=============================================================================
+// インデックスバッファの設定
+//=============================================================================
+HRESULT CRenderStateCache::SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff)
+{
+	if (m_pIndices == pIdxBuff)
+	{
+		m_nSkipCount++;
+		return S_OK;
+	}
+
+	m_pIndices = pIdxBuff;
+	m_nPassCount++;
+
+	return m_pInner->SetIndices(pIdxBuff);
+}
+//=============================================================================
+// ストリームの分周設定(インスタンシング用)
+//=============================================================================
+HRESULT CRenderStateCache::SetStreamSourceFreq(UINT stream, UINT setting)
+{
+	m_nPassCount++;
+
+	return m_pInner->SetStreamSourceFreq(stream, setting);
+}
+//=============================================================================
+// 頂点宣言の設定
+//=============================================================================
+HRESULT CRenderStateCache::SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl)
+{
+	// 頂点宣言を設定するとFVFは上書きされる
+	m_fvf = INVALID_FVF;
+	m_nPassCount++;
+
+	return m_pInner->SetVertexDeclaration(pDecl);
+}
+//=============================================================================
+// 頂点バッファの描画
+//=============================================================================
+HRESULT CRenderStateCache::DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount)
+{
+	return m_pInner->DrawPrimitive(type, startVertex, primitiveCount);
+}
+//=============================================================================
+// インデックス付き頂点バッファの描画
+//=============================================================================
+HRESULT CRenderStateCache::DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount)
+{
+	return m_pInner->DrawIndexedPrimitive(type, baseVertex, minIndex, numVertices, startIndex, primitiveCount);
+}
+//=============================================================================
+// 頂点データを直接渡す描画
+//=============================================================================
+HRESULT CRenderStateCache::DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride)
+{
+	// UP描画はストリーム0を解除する
+	InvalidateStream();
+
+	return m_pInner->DrawPrimitiveUP(type, primitiveCount, pVertexData, stride);
+}
+//=============================================================================
+// メッシュのサブセット描画
+//=============================================================================
+HRESULT CRenderStateCache::DrawSubset(LPD3DXMESH pMesh, DWORD attribId)
+{
+	// D3DXが内部で頂点フォーマット・ストリームを設定する
+	InvalidateStream();
+
+	return m_pInner->DrawSubset(pMesh, attribId);
+}
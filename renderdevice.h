@@ -0,0 +1,272 @@
+//=============================================================================
+//
+// 描画デバイス処理 [renderdevice.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _RENDERDEVICE_H_// このマクロ定義がされていなかったら
+#define _RENDERDEVICE_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "unordered_map"
+
+//*****************************************************************************
+// 描画デバイスの基底クラス(バッファ・テクスチャ・ステート・描画の窓口)
+//*****************************************************************************
+class CRenderDevice
+{
+public:
+	virtual ~CRenderDevice() {}
+
+	//*****************************************************************************
+	// バッファ
+	//*****************************************************************************
+	virtual HRESULT CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle) = 0;
+	virtual HRESULT CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle) = 0;
+	virtual HRESULT LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags) = 0;
+	virtual HRESULT UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff) = 0;
+	virtual HRESULT LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags) = 0;
+	virtual HRESULT UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff) = 0;
+
+	//*****************************************************************************
+	// テクスチャ
+	//*****************************************************************************
+	virtual HRESULT SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture) = 0;
+
+	//*****************************************************************************
+	// ステート
+	//*****************************************************************************
+	virtual HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD value) = 0;
+	virtual HRESULT SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix) = 0;
+	virtual HRESULT GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix) = 0;
+	virtual HRESULT SetMaterial(const D3DMATERIAL9* pMaterial) = 0;
+	virtual HRESULT GetMaterial(D3DMATERIAL9* pMaterial) = 0;
+	virtual HRESULT SetLight(DWORD index, const D3DLIGHT9* pLight) = 0;
+	virtual HRESULT LightEnable(DWORD index, BOOL bEnable) = 0;
+	virtual HRESULT SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader) = 0;
+	virtual HRESULT SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader) = 0;
+	virtual HRESULT SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) = 0;
+	virtual HRESULT SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) = 0;
+	virtual HRESULT SetFVF(DWORD fvf) = 0;
+	virtual HRESULT SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride) = 0;
+	virtual HRESULT SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff) = 0;
+	virtual HRESULT SetStreamSourceFreq(UINT stream, UINT setting) = 0;
+	virtual HRESULT SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl) = 0;
+
+	//*****************************************************************************
+	// 描画
+	//*****************************************************************************
+	virtual HRESULT DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount) = 0;
+	virtual HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount) = 0;
+	virtual HRESULT DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride) = 0;
+	virtual HRESULT DrawSubset(LPD3DXMESH pMesh, DWORD attribId) = 0;
+};
+
+//*****************************************************************************
+// D3D9描画デバイスクラス(そのままデバイスに渡す)
+//*****************************************************************************
+class CRenderDeviceD3D9 : public CRenderDevice
+{
+public:
+	CRenderDeviceD3D9(LPDIRECT3DDEVICE9 pDevice);
+	~CRenderDeviceD3D9();
+
+	HRESULT CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle) override;
+	HRESULT CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle) override;
+	HRESULT LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags) override;
+	HRESULT UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff) override;
+	HRESULT LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags) override;
+	HRESULT UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff) override;
+	HRESULT SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture) override;
+	HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD value) override;
+	HRESULT SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix) override;
+	HRESULT GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix) override;
+	HRESULT SetMaterial(const D3DMATERIAL9* pMaterial) override;
+	HRESULT GetMaterial(D3DMATERIAL9* pMaterial) override;
+	HRESULT SetLight(DWORD index, const D3DLIGHT9* pLight) override;
+	HRESULT LightEnable(DWORD index, BOOL bEnable) override;
+	HRESULT SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader) override;
+	HRESULT SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader) override;
+	HRESULT SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) override;
+	HRESULT SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) override;
+	HRESULT SetFVF(DWORD fvf) override;
+	HRESULT SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride) override;
+	HRESULT SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff) override;
+	HRESULT SetStreamSourceFreq(UINT stream, UINT setting) override;
+	HRESULT SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl) override;
+	HRESULT DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount) override;
+	HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount) override;
+	HRESULT DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride) override;
+	HRESULT DrawSubset(LPD3DXMESH pMesh, DWORD attribId) override;
+
+private:
+	LPDIRECT3DDEVICE9 m_pDevice;	// デバイスへのポインタ
+};
+
+//*****************************************************************************
+// 記録描画デバイスクラス(命令を記録し、内側のデバイスがあれば転送する)
+//*****************************************************************************
+class CRenderRecorder : public CRenderDevice
+{
+public:
+	// 命令の種類
+	typedef enum
+	{
+		CMD_CREATE_BUFFER = 0,	// バッファ生成
+		CMD_LOCK,				// バッファのロック(アップロード)
+		CMD_SET_TEXTURE,		// テクスチャ設定
+		CMD_SET_RENDERSTATE,	// レンダーステート設定
+		CMD_SET_TRANSFORM,		// 変換行列設定
+		CMD_SET_MATERIAL,		// マテリアル設定
+		CMD_SET_LIGHT,			// ライト設定
+		CMD_SET_SHADER,			// シェーダー設定
+		CMD_SET_CONSTANT,		// シェーダー定数設定
+		CMD_SET_FVF,			// 頂点フォーマット設定
+		CMD_SET_STREAM,			// 頂点・インデックスバッファ設定
+		CMD_DRAW,				// 描画
+		CMD_MAX
+	}CMD;
+
+	// 記録する命令(1命令12バイト)
+	struct Command
+	{
+		DWORD type;	// 命令の種類
+		DWORD arg0;	// 引数1
+		DWORD arg1;	// 引数2
+	};
+
+	CRenderRecorder(CRenderDevice* pInner);
+	~CRenderRecorder();
+
+	void BeginFrame(void);
+	void WriteFrame(FILE* pFile) const;
+
+	HRESULT CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle) override;
+	HRESULT CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle) override;
+	HRESULT LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags) override;
+	HRESULT UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff) override;
+	HRESULT LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags) override;
+	HRESULT UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff) override;
+	HRESULT SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture) override;
+	HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD value) override;
+	HRESULT SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix) override;
+	HRESULT GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix) override;
+	HRESULT SetMaterial(const D3DMATERIAL9* pMaterial) override;
+	HRESULT GetMaterial(D3DMATERIAL9* pMaterial) override;
+	HRESULT SetLight(DWORD index, const D3DLIGHT9* pLight) override;
+	HRESULT LightEnable(DWORD index, BOOL bEnable) override;
+	HRESULT SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader) override;
+	HRESULT SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader) override;
+	HRESULT SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) override;
+	HRESULT SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) override;
+	HRESULT SetFVF(DWORD fvf) override;
+	HRESULT SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride) override;
+	HRESULT SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff) override;
+	HRESULT SetStreamSourceFreq(UINT stream, UINT setting) override;
+	HRESULT SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl) override;
+	HRESULT DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount) override;
+	HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount) override;
+	HRESULT DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride) override;
+	HRESULT DrawSubset(LPD3DXMESH pMesh, DWORD attribId) override;
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	int GetCount(CMD cmd) const { return m_anCount[cmd]; }
+	int GetDrawCount(void) const { return m_anCount[CMD_DRAW]; }
+	int GetUploadCount(void) const { return m_anCount[CMD_LOCK] + m_nUploadUP; }
+	int GetStateChangeCount(void) const;
+	const std::vector<Command>& GetCommands(void) const { return m_commands; }
+
+private:
+	static constexpr uintptr_t NULL_HANDLE_BASE	= 0x10000;	// 記録のみのときに返すバッファの識別子の開始値
+	static constexpr uintptr_t NULL_HANDLE_STEP	= 0x10;		// 記録のみのときに返すバッファの識別子の間隔
+
+	void Record(CMD type, DWORD arg0, DWORD arg1);
+	void* CreateNullBuffer(UINT length);
+	HRESULT LockNullBuffer(const void* pBuff, UINT offset, UINT size, void** ppData);
+
+	CRenderDevice*			m_pInner;				// 転送先のデバイス(nullptrなら記録のみ)
+	std::vector<Command>	m_commands;				// 今フレームの命令列
+	int						m_anCount[CMD_MAX];		// 命令の種類ごとの回数
+	int						m_nUploadUP;			// DrawPrimitiveUPで送った回数
+	D3DMATRIX				m_aTransform[3];		// 記録のみのときの変換行列(ワールド・ビュー・プロジェクション)
+	D3DMATERIAL9			m_material;				// 記録のみのときのマテリアル
+	std::unordered_map<uintptr_t, UINT> m_nullBuffer;	// 記録のみのときに返したバッファの識別子と生成時の大きさ
+	uintptr_t				m_nextNullHandle;		// 記録のみのときに次に返すバッファの識別子
+};
+
+//*****************************************************************************
+// ステートキャッシュ描画デバイスクラス(前回と同じ設定はデバイスに送らない)
+//*****************************************************************************
+class CRenderStateCache : public CRenderDevice
+{
+public:
+	CRenderStateCache();
+	~CRenderStateCache();
+
+	void Begin(CRenderDevice* pInner);
+	void Invalidate(void);
+
+	HRESULT CreateVertexBuffer(UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, LPDIRECT3DVERTEXBUFFER9* ppVtxBuff, HANDLE* pSharedHandle) override;
+	HRESULT CreateIndexBuffer(UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, LPDIRECT3DINDEXBUFFER9* ppIdxBuff, HANDLE* pSharedHandle) override;
+	HRESULT LockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT size, void** ppData, DWORD flags) override;
+	HRESULT UnlockVertexBuffer(LPDIRECT3DVERTEXBUFFER9 pVtxBuff) override;
+	HRESULT LockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff, UINT offset, UINT size, void** ppData, DWORD flags) override;
+	HRESULT UnlockIndexBuffer(LPDIRECT3DINDEXBUFFER9 pIdxBuff) override;
+	HRESULT SetTexture(DWORD stage, LPDIRECT3DBASETEXTURE9 pTexture) override;
+	HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD value) override;
+	HRESULT SetTransform(D3DTRANSFORMSTATETYPE type, const D3DMATRIX* pMatrix) override;
+	HRESULT GetTransform(D3DTRANSFORMSTATETYPE type, D3DMATRIX* pMatrix) override;
+	HRESULT SetMaterial(const D3DMATERIAL9* pMaterial) override;
+	HRESULT GetMaterial(D3DMATERIAL9* pMaterial) override;
+	HRESULT SetLight(DWORD index, const D3DLIGHT9* pLight) override;
+	HRESULT LightEnable(DWORD index, BOOL bEnable) override;
+	HRESULT SetVertexShader(LPDIRECT3DVERTEXSHADER9 pShader) override;
+	HRESULT SetPixelShader(LPDIRECT3DPIXELSHADER9 pShader) override;
+	HRESULT SetVertexShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) override;
+	HRESULT SetPixelShaderConstantF(UINT startRegister, const float* pData, UINT vector4fCount) override;
+	HRESULT SetFVF(DWORD fvf) override;
+	HRESULT SetStreamSource(UINT stream, LPDIRECT3DVERTEXBUFFER9 pVtxBuff, UINT offset, UINT stride) override;
+	HRESULT SetIndices(LPDIRECT3DINDEXBUFFER9 pIdxBuff) override;
+	HRESULT SetStreamSourceFreq(UINT stream, UINT setting) override;
+	HRESULT SetVertexDeclaration(LPDIRECT3DVERTEXDECLARATION9 pDecl) override;
+	HRESULT DrawPrimitive(D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount) override;
+	HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE type, INT baseVertex, UINT minIndex, UINT numVertices, UINT startIndex, UINT primitiveCount) override;
+	HRESULT DrawPrimitiveUP(D3DPRIMITIVETYPE type, UINT primitiveCount, const void* pVertexData, UINT stride) override;
+	HRESULT DrawSubset(LPD3DXMESH pMesh, DWORD attribId) override;
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	int GetSkipCount(void) const { return m_nSkipCount; }
+	int GetPassCount(void) const { return m_nPassCount; }
+
+private:
+	static constexpr int MAX_RENDERSTATE	= 256;	// キャッシュするレンダーステートの数
+	static constexpr int MAX_TEXTURE_STAGE	= 8;	// キャッシュするテクスチャステージの数
+
+	void InvalidateStream(void);
+
+	CRenderDevice*			m_pInner;								// 転送先のデバイス
+	DWORD					m_aRenderState[MAX_RENDERSTATE];		// レンダーステートの値
+	bool					m_abRenderState[MAX_RENDERSTATE];		// レンダーステートが有効か
+	LPDIRECT3DBASETEXTURE9	m_apTexture[MAX_TEXTURE_STAGE];			// テクスチャ
+	bool					m_abTexture[MAX_TEXTURE_STAGE];			// テクスチャが有効か
+	D3DMATRIX				m_mtxWorld;								// ワールドマトリックス
+	bool					m_bWorld;								// ワールドマトリックスが有効か
+	D3DMATERIAL9			m_material;								// マテリアル
+	bool					m_bMaterial;							// マテリアルが有効か
+	LPDIRECT3DVERTEXSHADER9	m_pVS;									// 頂点シェーダー
+	LPDIRECT3DPIXELSHADER9	m_pPS;									// ピクセルシェーダー
+	DWORD					m_fvf;									// 頂点フォーマット
+	LPDIRECT3DVERTEXBUFFER9	m_pStream;								// ストリーム0の頂点バッファ
+	UINT					m_streamStride;							// ストリーム0の頂点サイズ
+	LPDIRECT3DINDEXBUFFER9	m_pIndices;								// インデックスバッファ
+	int						m_nSkipCount;							// 送らずに済んだ回数
+	int						m_nPassCount;							// デバイスに送った回数
+};
+
+#endif
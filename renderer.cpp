@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// _O [renderer.cpp]
+// レンダリング処理 [renderer.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "renderer.h"
 #include "object.h"
@@ -17,45 +17,56 @@
 #include "debugproc.h"
 #include "debugproc3D.h"
 #include "game.h"
+#include "culling.h"
+#include "shadowS.h"
+#include "particlesystem.h"
+#include "ripplesystem.h"
+#include "billboardrenderer.h"
+#include "spritebatch.h"
+#include "number.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
 CDebugProc* CRenderer::m_pDebug = nullptr;
 CDebugProc3D* CRenderer::m_pDebug3D = nullptr;
 int CRenderer::m_nFPS = 0;
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CRenderer::CRenderer()
 {
-	// l̃NA
+	// 値のクリア
 	m_pD3D			= nullptr;
 	m_pD3DDevice	= nullptr;
 	m_ResizeWidth	= 0;
 	m_ResizeHeight	= 0;
 	m_d3dpp			= {};
 	m_bgCol			= INIT_XCOL;
-	m_pOutlineVS	= nullptr;				// _VF[_
-	m_pVSConsts		= nullptr;				// _VF[_RX^ge[u
-	m_pPSConsts		= nullptr;				// sNZVF[_RX^ge[u
+	m_pOutlineVS	= nullptr;				// 頂点シェーダ
+	m_pVSConsts		= nullptr;				// 頂点シェーダコンスタントテーブル
+	m_pPSConsts		= nullptr;				// ピクセルシェーダコンスタントテーブル
+	m_pBackend		= nullptr;				// 描画デバイス
+	m_pRecorder		= nullptr;				// 命令を記録する描画デバイス
+	m_bRecording	= false;				// 描画命令を記録するかどうか
+	m_pRenderQueue	= nullptr;				// 描画キュー
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CRenderer::~CRenderer()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CRenderer::Init(HWND hWnd, BOOL bWindow)
 {
-	D3DDISPLAYMODE d3ddm;			// fBXvC[h
+	D3DDISPLAYMODE d3ddm;			// ディスプレイモード
 
-	// DirectX3DIuWFNg̐
+	// DirectX3Dオブジェクトの生成
 	m_pD3D = Direct3DCreate9(D3D_SDK_VERSION);
 
 	if (m_pD3D == nullptr)
@@ -63,27 +74,27 @@ HRESULT CRenderer::Init(HWND hWnd, BOOL bWindow)
 		return E_FAIL;
 	}
 
-	// ݂̃fBXvC[h擾
+	// 現在のディスプレイモードを取得
 	if (FAILED(m_pD3D->GetAdapterDisplayMode(D3DADAPTER_DEFAULT, &d3ddm)))
 	{
 		return E_FAIL;
 	}
 
-	// foCX̃v[e[Vp[^̐ݒ
-	ZeroMemory(&m_d3dpp, sizeof(m_d3dpp));								// p[^̃[NA
-
-	m_d3dpp.BackBufferWidth				= SCREEN_WIDTH;					// Q[ʃTCYij
-	m_d3dpp.BackBufferHeight			= SCREEN_HEIGHT;				// Q[ʃTCYij
-	m_d3dpp.BackBufferFormat			= d3ddm.Format;					// obNobt@̌`
-	m_d3dpp.BackBufferCount				= 1;							// obNobt@̐
-	m_d3dpp.SwapEffect					= D3DSWAPEFFECT_DISCARD;		// _uobt@̐؂ւ
-	m_d3dpp.EnableAutoDepthStencil		= TRUE;							// fvXobt@ƃXeVobt@쐬
-	m_d3dpp.AutoDepthStencilFormat		= D3DFMT_D24S8;					// fvXobt@Ƃ16bitg
-	m_d3dpp.Windowed					= bWindow;						// EChE[h
-	m_d3dpp.FullScreen_RefreshRateInHz	= D3DPRESENT_RATE_DEFAULT;		// tbV[g
-	m_d3dpp.PresentationInterval		= D3DPRESENT_INTERVAL_DEFAULT;	// C^[o
-
-	// DirectX3DfoCX̐
+	// デバイスのプレゼンテーションパラメータの設定
+	ZeroMemory(&m_d3dpp, sizeof(m_d3dpp));								// パラメータのゼロクリア
+
+	m_d3dpp.BackBufferWidth				= SCREEN_WIDTH;					// ゲーム画面サイズ（幅）
+	m_d3dpp.BackBufferHeight			= SCREEN_HEIGHT;				// ゲーム画面サイズ（高さ）
+	m_d3dpp.BackBufferFormat			= d3ddm.Format;					// バックバッファの形式
+	m_d3dpp.BackBufferCount				= 1;							// バックバッファの数
+	m_d3dpp.SwapEffect					= D3DSWAPEFFECT_DISCARD;		// ダブルバッファの切り替え
+	m_d3dpp.EnableAutoDepthStencil		= TRUE;							// デプスバッファとステンシルバッファを作成
+	m_d3dpp.AutoDepthStencilFormat		= D3DFMT_D24S8;					// デプスバッファとして16bitを使う
+	m_d3dpp.Windowed					= bWindow;						// ウインドウモード
+	m_d3dpp.FullScreen_RefreshRateInHz	= D3DPRESENT_RATE_DEFAULT;		// リフレッシュレート
+	m_d3dpp.PresentationInterval		= D3DPRESENT_INTERVAL_DEFAULT;	// インターバル
+
+	// DirectX3Dデバイスの生成
 	if (FAILED(m_pD3D->CreateDevice(D3DADAPTER_DEFAULT,
 		D3DDEVTYPE_HAL,
 		hWnd,
@@ -91,7 +102,7 @@ HRESULT CRenderer::Init(HWND hWnd, BOOL bWindow)
 		&m_d3dpp,
 		&m_pD3DDevice)))
 	{
-		// DirectX3DfoCX̐
+		// DirectX3Dデバイスの生成
 		if (FAILED(m_pD3D->CreateDevice(D3DADAPTER_DEFAULT,
 			D3DDEVTYPE_HAL,
 			hWnd,
@@ -99,7 +110,7 @@ HRESULT CRenderer::Init(HWND hWnd, BOOL bWindow)
 			&m_d3dpp,
 			&m_pD3DDevice)))
 		{
-			// DirectX3DfoCX̐
+			// DirectX3Dデバイスの生成
 			if (FAILED(m_pD3D->CreateDevice(D3DADAPTER_DEFAULT,
 				D3DDEVTYPE_REF,
 				hWnd,
@@ -112,174 +123,400 @@ HRESULT CRenderer::Init(HWND hWnd, BOOL bWindow)
 		}
 	}
 
-	// _[Xe[g̐ݒ
+	// 描画デバイスの生成
+	m_pBackend = new CRenderDeviceD3D9(m_pD3DDevice);
+
+	// 記録用の描画デバイスの生成(記録しつつD3D9に転送する)
+	m_pRecorder = new CRenderRecorder(m_pBackend);
+
+	// 起動引数で指定されていたら最初から記録する
+	m_bRecording = (strstr(GetCommandLineA(), "-recorddraw") != nullptr);
+
+	// 描画キューの生成
+	m_pRenderQueue = new CRenderQueue;
+
+	// 起動引数で指定されていたらキューを使わずに描画する(比較用)
+	m_pRenderQueue->SetEnable(strstr(GetCommandLineA(), "-norenderqueue") == nullptr);
+
+	// レンダーステートの設定
 	m_pD3DDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
 	m_pD3DDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE);
 	m_pD3DDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
 	m_pD3DDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
 
-	// Tv[Xe[g̐ݒ
+	// サンプラーステートの設定
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP);
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_ADDRESSV, D3DTADDRESS_WRAP);
 
-	// eNX`Xe[WXe[g̐ݒ
+	// テクスチャステージステートの設定
 	m_pD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
 	m_pD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
 	m_pD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_CURRENT);
 
-	// fobOtHg̏
+	// デバッグフォントの初期化
 	m_pDebug->Init();
 
-	// 3DfobO\̏
+	// 3Dデバッグ表示の初期化
 	m_pDebug3D->Init();
 
 
-	// _VF[_RpC
+	// 頂点シェーダをコンパイル
 	CompileVertexShader("data/Shader/OutlineVS.hlsl", "VSMain", &m_pOutlineVS, &m_pVSConsts);
 
-	// sNZVF[_RpC
+	// ピクセルシェーダをコンパイル
 	CompilePixelShader("data/Shader/OutlinePS.hlsl", "PSMain", &m_pOutlinePS, &m_pPSConsts);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CRenderer::Uninit(void)
 {
-	// fobOtHg̏I
+	// デバッグフォントの終了処理
 	m_pDebug->Uninit();
 
-	// 3DfobO\̏I
+	// 3Dデバッグ表示の終了処理
 	m_pDebug3D->Uninit();
 
-	// Direct3DfoCX̔j
+	// 描画デバイスの破棄
+	if (m_pRecorder != nullptr)
+	{
+		delete m_pRecorder;
+		m_pRecorder = nullptr;
+	}
+
+	// 描画キューの破棄
+	if (m_pRenderQueue != nullptr)
+	{
+		delete m_pRenderQueue;
+		m_pRenderQueue = nullptr;
+	}
+
+	if (m_pBackend != nullptr)
+	{
+		delete m_pBackend;
+		m_pBackend = nullptr;
+	}
+
+	m_bRecording = false;
+
+	// Direct3Dデバイスの破棄
 	if (m_pD3DDevice != nullptr)
 	{
 		m_pD3DDevice->Release();
 		m_pD3DDevice = nullptr;
 	}
 
-	// Direct3DIuWFNg̔j
+	// Direct3Dオブジェクトの破棄
 	if (m_pD3D != nullptr)
 	{
 		m_pD3D->Release();
 		m_pD3D = nullptr;
 	}
 
-	// VF[_[̔j
+	// シェーダーの破棄
 	if (m_pOutlineVS) { m_pOutlineVS->Release(); m_pOutlineVS = nullptr; }
 	if (m_pOutlinePS) { m_pOutlinePS->Release(); m_pOutlinePS = nullptr; }
 	if (m_pVSConsts) { m_pVSConsts->Release();  m_pVSConsts = nullptr; }
 	if (m_pPSConsts) { m_pPSConsts->Release();  m_pPSConsts = nullptr; }
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CRenderer::Update(void)
 {
-	// ׂẴIuWFNg̍XV
+	// すべてのオブジェクトの更新処理
 	CObject::UpdateAll();
 
 #ifdef _DEBUG
 
-	// ꏊ
+	// 場所
 	CImGuiManager::Instance().SetPosImgui(ImVec2(20.0f, 20.0f));
 
-	// TCY
+	// サイズ
 	CImGuiManager::Instance().SetSizeImgui(ImVec2(420.0f, 500.0f));
 
-	// ŏGui
+	// 最初のGui
 	CImGuiManager::Instance().StartImgui(u8"DebugInfo", CImGuiManager::IMGUITYPE_DEFOULT);
 
-	// FPSl̎擾
+	// FPS値の取得
 	int fps = GetFPS();
 
-	// FPSl
+	// FPS値
 	ImGui::Text("FPS : %d", fps);
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-	// V[hl
+	// シード値
 	ImGui::Text("SEED : %d", CGame::GetSeed());
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
 	ImGui::Text("BG Color:");
 
 	ImGui::ColorEdit4("col", m_bgCol);
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// ライトの個数
+	ImGui::Text("Light Num : %d  Active : %d", CLight::GetLightNum(), CLight::GetActiveNum());
+
+	// テクスチャの個数
+	ImGui::Text("Texture Num : %d  Slot : %d", CManager::GetTexture()->GetNumLoaded(), CManager::GetTexture()->GetNumSlot());
+
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// 描画命令の記録
+	ImGui::Checkbox("Record Draw Commands", &m_bRecording);
+
+	if (m_bRecording)
+	{
+		// 前フレームの記録結果
+		ImGui::Text("Draw : %d  State : %d  Upload : %d",
+			m_pRecorder->GetDrawCount(), m_pRecorder->GetStateChangeCount(), m_pRecorder->GetUploadCount());
+
+		// 命令列の書き出し
+		if (ImGui::Button("Dump Frame"))
+		{
+			FILE* pFile = fopen("drawcmd.txt", "w");
+
+			if (pFile != nullptr)
+			{
+				m_pRecorder->WriteFrame(pFile);
+
+				// ファイルを閉じる
+				fclose(pFile);
+			}
+		}
+	}
+
+	// 描画キューの使用
+	bool bQueue = m_pRenderQueue->IsEnable();
+
+	if (ImGui::Checkbox("Use Render Queue", &bQueue))
+	{
+		m_pRenderQueue->SetEnable(bQueue);
+	}
+
+	if (bQueue)
+	{
+		// 前フレームの描画キューの結果
+		ImGui::Text("Packet : %d  Sent : %d  Skipped : %d",
+			m_pRenderQueue->GetLastPacketCount(), m_pRenderQueue->GetLastPassCount(), m_pRenderQueue->GetLastSkipCount());
+	}
+
+	// 前フレームのシェーダー切り替え回数(キューを切ると全キャラクターのパーツごとに切り替わる)
+	ImGui::Text("Shader Switch : %d", CTelemetry::GetValue(CTelemetry::COUNTER_SHADER_SWITCH));
+
+	// ブロックのインスタンス描画
+	CBlockInstancer& instancer = CBlockManager::GetInstancer();
+	bool bInstancing = instancer.IsEnable();
+
+	if (ImGui::Checkbox("Block Instancing", &bInstancing))
+	{
+		instancer.SetEnable(bInstancing);
+	}
+
+	if (instancer.IsSupported())
+	{
+		// まとめた結果
+		ImGui::Text("Batch : %d  Instance : %d  Draw : %d  Rebuild : %d",
+			instancer.GetNumBatch(), instancer.GetNumInstance(), instancer.GetNumDrawCall(), instancer.GetNumRebuild());
+	}
+	else
+	{
+		ImGui::Text("Instancing is not supported");
+	}
+
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// 視錐台カリング
+	bool bCulling = CCulling::IsEnable();
+
+	if (ImGui::Checkbox("Frustum Culling", &bCulling))
+	{
+		CCulling::SetEnable(bCulling);
+	}
+
+	// 種類ごとの描画数 / 総数
+	ImGui::Text("Block : %d / %d  Prop : %d / %d",
+		CTelemetry::GetValue(CTelemetry::COUNTER_CULL_BLOCK_VISIBLE), CTelemetry::GetValue(CTelemetry::COUNTER_CULL_BLOCK_TOTAL),
+		CTelemetry::GetValue(CTelemetry::COUNTER_CULL_PROP_VISIBLE), CTelemetry::GetValue(CTelemetry::COUNTER_CULL_PROP_TOTAL));
+	ImGui::Text("Chara : %d / %d  Effect : %d / %d",
+		CTelemetry::GetValue(CTelemetry::COUNTER_CULL_CHARA_VISIBLE), CTelemetry::GetValue(CTelemetry::COUNTER_CULL_CHARA_TOTAL),
+		CTelemetry::GetValue(CTelemetry::COUNTER_CULL_EFFECT_VISIBLE), CTelemetry::GetValue(CTelemetry::COUNTER_CULL_EFFECT_TOTAL));
+	ImGui::Text("Terrain : %d / %d",
+		CTelemetry::GetValue(CTelemetry::COUNTER_CULL_TERRAIN_VISIBLE), CTelemetry::GetValue(CTelemetry::COUNTER_CULL_TERRAIN_TOTAL));
+
+	// パーティクル(生きている数・配列の数・出せなかった数)
+	ImGui::Text("Particle : %d  Pool : %d  Dropped : %d",
+		CParticleSystem::GetNumAlive(), CParticleSystem::GetNumPool(), CParticleSystem::GetNumDropped());
+
+	// 波紋(生きている数・描画回数・出せなかった数・シェーダーで広げているか)
+	ImGui::Text("Ripple : %d  Draw : %d  Dropped : %d  %s",
+		CRippleSystem::GetNumAlive(), CRippleSystem::GetNumDrawCall(), CRippleSystem::GetNumDropped(),
+		CRippleSystem::IsShader() ? "Shader" : "CPU");
+
+	// ビルボード(描いた数・描画回数)
+	ImGui::Text("Billboard : %d  Draw : %d",
+		CBillboardRenderer::GetNumSprite(), CBillboardRenderer::GetNumDrawCall());
+
+	// 2Dスプライト(描いた数・描画回数・アトラスに入れた画像の数)
+	ImGui::Text("Sprite : %d  Draw : %d  Atlas : %d",
+		CSpriteBatch::GetNumQuad(), CSpriteBatch::GetNumDrawCall(), CSpriteBatch::GetNumAtlas());
+
+	// 数字の並びを作り直した回数(値が変わらなければ増えない)
+	ImGui::Text("Number Layout : %d", CNumber::GetNumLayout());
+
+	// エフェクト予算(全体の上限・減らした数・画面外で出さなかった数)
+	bool bBudget = CEffectBudget::IsEnable();
+
+	if (ImGui::Checkbox("Effect Budget", &bBudget))
+	{
+		CEffectBudget::SetEnable(bBudget);
+	}
+
+	ImGui::Text("Budget : %d / %d  Suppressed : %d  Culled : %d",
+		CEffectBudget::GetNumAlive(), CEffectBudget::MAX_ALIVE, CEffectBudget::GetNumSuppressed(), CEffectBudget::GetNumCulled());
+
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// 3Dデバッグ表示(種類ごとの表示・手前表示、描いた線の数・描画回数)
+	bool bDebugLine = CDebugProc3D::IsEnable();
 
-	// Cǧ
-	ImGui::Text("Light Num : %d", CLight::GetLightNum());
+	if (ImGui::Checkbox("Debug Line", &bDebugLine))
+	{
+		CDebugProc3D::SetEnable(bDebugLine);
+	}
+
+	for (int nCnt = 0; nCnt < CDebugProc3D::CATEGORY_MAX; nCnt++)
+	{
+		CDebugProc3D::CATEGORY category = (CDebugProc3D::CATEGORY)nCnt;
+		bool bShow = CDebugProc3D::IsCategoryEnable(category);
+		bool bOverlay = CDebugProc3D::IsCategoryOverlay(category);
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+		ImGui::PushID(nCnt);
+
+		if (ImGui::Checkbox(CDebugProc3D::GetCategoryName(category), &bShow))
+		{
+			CDebugProc3D::SetCategoryEnable(category, bShow);
+		}
+
+		ImGui::SameLine(120.0f);
+
+		if (ImGui::Checkbox("Overlay", &bOverlay))
+		{
+			CDebugProc3D::SetCategoryOverlay(category, bOverlay);
+		}
+
+		ImGui::PopID();
+	}
 
-	// vC[̃fobO̕\
+	ImGui::Text("Debug Line : %d  Draw : %d",
+		CDebugProc3D::GetNumLine(), CDebugProc3D::GetNumDrawCall());
+
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// 影(遠いキャラクターは丸影にする)
+	float fBlobDistance = CShadowS::GetBlobDistance();
+
+	if (ImGui::DragFloat("Blob Shadow Distance", &fBlobDistance, 10.0f, 0.0f, 20000.0f, "%.0f"))
+	{
+		CShadowS::SetBlobDistance(fBlobDistance);
+	}
+
+	ImGui::Text("Shadow Volume : %d  Blob : %d",
+		CTelemetry::GetValue(CTelemetry::COUNTER_SHADOW_VOLUME), CTelemetry::GetValue(CTelemetry::COUNTER_SHADOW_BLOB));
+
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// プレイヤーのデバッグ情報の表示処理
 	CGuiInfo::PlayerInfo();
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-	// G̃fobO̕\
+	// 敵のデバッグ情報の表示処理
 	CGuiInfo::EnemyInfo();
 
-	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 󔒂󂯂
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
 
-	// J̃fobO̕\
+	// カメラのデバッグ情報の表示処理
 	CGuiInfo::CameraInfo();
 
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// メモリのデバッグ情報の表示処理
+	CGuiInfo::MemoryInfo();
+
+	ImGui::Dummy(ImVec2(0.0f, 10.0f)); // 空白を空ける
+
+	// 計測カウンターの表示処理
+	CGuiInfo::TelemetryInfo();
+
 	ImGui::End();
 
 #endif
 
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CRenderer::Draw(int fps)
 {
-	// ʃNA
+	// 描画命令の記録のリセット
+	if (m_bRecording)
+	{
+		m_pRecorder->BeginFrame();
+	}
+
+	// 画面クリア
 	m_pD3DDevice->Clear(0, NULL,
 		(D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER | D3DCLEAR_STENCIL),
 		m_bgCol, 1.0f, 0);
 
-	// `Jn
+	// 描画開始
 	if (SUCCEEDED(m_pD3DDevice->BeginScene()))
-	{// `Jnꍇ
+	{// 描画開始が成功した場合
 
-		// ׂẴIuWFNg̕`揈
+		// すべてのオブジェクトの描画処理
 		CObject::DrawAll();
 
-		// tF[h̎擾
+		// 描画キューの統計の確定
+		m_pRenderQueue->EndFrame();
+
+		// フェードの取得
 		CFade* pFade = CManager::GetFade();
 
-		// tF[h̕`揈
+		// フェードの描画処理
 		if (pFade != nullptr)
 		{
-			// tF[h̕`揈
+			// フェードの描画処理
 			pFade->Draw();
 		}
 
-		// FPS̃Zbg
+		// フェードはオブジェクトより後に描く
+		CSpriteBatch::Flush();
+
+		// FPSのセット
 		SetFPS(fps);
 		
 #ifdef _DEBUG
 
-		// ImGui̕`I
+		// ImGuiの描画終了
 		CImGuiManager::Instance().EndImguiRender();
 #endif
-		// `I
+		// 描画終了
 		m_pD3DDevice->EndScene();
 	}
 
-	// obNobt@ƃtgobt@̓ւ
+	// バックバッファとフロントバッファの入れ替え
 	m_pD3DDevice->Present(NULL, NULL, NULL, NULL);
 }
 //=============================================================================
-// foCX̃Zbg
+// デバイスのリセット
 //=============================================================================
 void CRenderer::ResetDevice(void)
 {
@@ -288,18 +525,18 @@ void CRenderer::ResetDevice(void)
 		return;
 	}
 
-	// fobOtHg̔j
+	// デバッグフォントの破棄
 	m_pDebug->Uninit();
 
-	// 3DfobO\̔j
+	// 3Dデバッグ表示の破棄
 	m_pDebug3D->Uninit();
 
-	//// SUIɃfoCXĐݒʒm
+	//// 全UIにデバイス再設定通知
 	//CUIManager* pUIManager = CUIManager::GetInstance();
 
 	//for (auto ui : pUIManager->GetAllUI())
 	//{
-	//	ui->Uninit(); // CUIText ̏ꍇ D3DXFONT Đ
+	//	ui->Uninit(); // CUIText の場合は D3DXFONT を再生成
 	//}
 
 	m_d3dpp.BackBufferWidth = m_ResizeWidth;
@@ -308,9 +545,21 @@ void CRenderer::ResetDevice(void)
 
 	ImGui_ImplDX9_InvalidateDeviceObjects();
 
-	// TlC̃[Xʒm
+	// サムネイルのリリース通知
 	CManager::ReleaseThumbnail();
 
+	// パーティクルの動的頂点バッファの破棄
+	CParticleSystem::InvalidateDevice();
+
+	// 波紋の動的頂点バッファの破棄
+	CRippleSystem::InvalidateDevice();
+
+	// ビルボードの動的頂点バッファの破棄
+	CBillboardRenderer::InvalidateDevice();
+
+	// 2Dスプライトの動的頂点バッファの破棄
+	CSpriteBatch::InvalidateDevice();
+
 	HRESULT hr = m_pD3DDevice->Reset(&m_d3dpp);
 
 	if (hr == D3DERR_INVALIDCALL)
@@ -320,48 +569,60 @@ void CRenderer::ResetDevice(void)
 
 	ImGui_ImplDX9_CreateDeviceObjects();
 
-	// TlC̃Zbgʒm
+	// サムネイルのリセット通知
 	CManager::ResetThumbnail();
 
-	// _[Xe[g̐ݒ
+	// パーティクルの動的頂点バッファの再生成
+	CParticleSystem::RestoreDevice();
+
+	// 波紋の動的頂点バッファの再生成
+	CRippleSystem::RestoreDevice();
+
+	// ビルボードの動的頂点バッファの再生成
+	CBillboardRenderer::RestoreDevice();
+
+	// 2Dスプライトの動的頂点バッファの再生成
+	CSpriteBatch::RestoreDevice();
+
+	// レンダーステートの設定
 	m_pD3DDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
 	m_pD3DDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE);
 	m_pD3DDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
 	m_pD3DDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
 
-	// Tv[Xe[g̐ݒ
+	// サンプラーステートの設定
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP);
 	m_pD3DDevice->SetSamplerState(0, D3DSAMP_ADDRESSV, D3DTADDRESS_WRAP);
 
-	// eNX`Xe[WXe[g̐ݒ
+	// テクスチャステージステートの設定
 	m_pD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
 	m_pD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
 	m_pD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_CURRENT);
 
-	// fobOtHg̏
+	// デバッグフォントの初期化
 	m_pDebug->Init();
 
-	// 3DfobO\̏
+	// 3Dデバッグ表示の初期化
 	m_pDebug3D->Init();
 
 	//for (auto ui : pUIManager->GetAllUI())
 	//{
-	//	ui->Init(); // CUIText ̏ꍇ D3DXFONT Đ
+	//	ui->Init(); // CUIText の場合は D3DXFONT を再生成
 	//}
 
-	// foCXZbgʒm(V[Cg)
+	// デバイスリセット通知(シーンライト)
 	CManager::OnDeviceReset();
 }
 //=============================================================================
-// _VF[_RpCp֐
+// 頂点シェーダコンパイル用関数
 //=============================================================================
 HRESULT CRenderer::CompileVertexShader(
-	const char* filename,         // HLSLt@C
-	const char* entryPoint,       // Gg|Cg
-	LPDIRECT3DVERTEXSHADER9* ppVS,// 쐬VF[_̃|C^
-	LPD3DXCONSTANTTABLE* ppConsts // 萔e[u󂯎ꍇ
+	const char* filename,         // HLSLファイル名
+	const char* entryPoint,       // エントリポイント名
+	LPDIRECT3DVERTEXSHADER9* ppVS,// 作成したシェーダのポインタ
+	LPD3DXCONSTANTTABLE* ppConsts // 定数テーブルを受け取る場合
 )
 {
 	if (!m_pD3DDevice)
@@ -413,13 +674,13 @@ HRESULT CRenderer::CompileVertexShader(
 	return hr;
 }
 //=============================================================================
-// sNZVF[_RpCp֐
+// ピクセルシェーダコンパイル用関数
 //=============================================================================
 HRESULT CRenderer::CompilePixelShader(
-	const char* filename,         // HLSLt@C
-	const char* entryPoint,       // Gg|Cg
-	LPDIRECT3DPIXELSHADER9* ppPS, // 쐬VF[_̃|C^
-	LPD3DXCONSTANTTABLE* ppConsts // 萔e[u󂯎ꍇ
+	const char* filename,         // HLSLファイル名
+	const char* entryPoint,       // エントリポイント名
+	LPDIRECT3DPIXELSHADER9* ppPS, // 作成したシェーダのポインタ
+	LPD3DXCONSTANTTABLE* ppConsts // 定数テーブルを受け取る場合
 )
 {
 	if (!m_pD3DDevice)
@@ -471,7 +732,7 @@ HRESULT CRenderer::CompilePixelShader(
 	return hr;
 }
 //=============================================================================
-// TCY̍Đݒ
+// サイズの再設定
 //=============================================================================
 void CRenderer::OnResize(UINT width, UINT height)
 {
@@ -479,7 +740,7 @@ void CRenderer::OnResize(UINT width, UINT height)
 	m_ResizeHeight = height;
 }
 //=============================================================================
-// foCX̃ZbgKvǂ
+// デバイスのリセットが必要かどうか
 //=============================================================================
 bool CRenderer::NeedsReset(void) const
 {
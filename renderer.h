@@ -1,25 +1,27 @@
 //=============================================================================
 //
-// _O [renderer.h]
+// レンダリング処理 [renderer.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RENDERER_H_// ̃}N`ĂȂ
-#define _RENDERER_H_// 2dCN[hh~̃}N`
+#ifndef _RENDERER_H_// このマクロ定義がされていなかったら
+#define _RENDERER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "imguimaneger.h"
+#include "renderdevice.h"
+#include "renderqueue.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CDebugProc;
 class CDebugProc3D;
 
 //*****************************************************************************
-// _[NX
+// レンダラークラス
 //*****************************************************************************
 class CRenderer
 {
@@ -35,36 +37,41 @@ public:
 	void OnResize(UINT width, UINT height);
 
 	HRESULT CompileVertexShader(
-		const char* filename,         // HLSLt@C
-		const char* entryPoint,       // Gg|Cg
-		LPDIRECT3DVERTEXSHADER9* ppVS,// 쐬VF[_̃|C^
-		LPD3DXCONSTANTTABLE* ppConsts // 萔e[u󂯎ꍇ
+		const char* filename,         // HLSLファイル名
+		const char* entryPoint,       // エントリポイント名
+		LPDIRECT3DVERTEXSHADER9* ppVS,// 作成したシェーダのポインタ
+		LPD3DXCONSTANTTABLE* ppConsts // 定数テーブルを受け取る場合
 	);
 	HRESULT CompilePixelShader(
-		const char* filename,         // HLSLt@C
-		const char* entryPoint,       // Gg|Cg
-		LPDIRECT3DPIXELSHADER9* ppPS, // 쐬VF[_̃|C^
-		LPD3DXCONSTANTTABLE* ppConsts // 萔e[u󂯎ꍇ
+		const char* filename,         // HLSLファイル名
+		const char* entryPoint,       // エントリポイント名
+		LPDIRECT3DPIXELSHADER9* ppPS, // 作成したシェーダのポインタ
+		LPD3DXCONSTANTTABLE* ppConsts // 定数テーブルを受け取る場合
 	);
 
 	//*****************************************************************************
-	// flagment֐
+	// flagment関数
 	//*****************************************************************************
 	bool NeedsReset(void) const;
 
 	//*****************************************************************************
-	// setter֐
+	// setter関数
 	//*****************************************************************************
 	void SetFPS(int fps) { m_nFPS = fps; }
 	void SetBgCol(D3DXCOLOR col) { m_bgCol = col; }
+	void SetRecording(bool enable) { m_bRecording = enable; }
 
 	//*****************************************************************************
-	// getter֐
+	// getter関数
 	//*****************************************************************************
 	static CDebugProc* GetDebug(void) { return m_pDebug; }
 	static CDebugProc3D* GetDebug3D(void) { return m_pDebug3D; }
 	static int GetFPS(void) { return m_nFPS; }
 	LPDIRECT3DDEVICE9 GetDevice(void) { return m_pD3DDevice; };
+	CRenderDevice* GetBackend(void) { return m_bRecording ? (CRenderDevice*)m_pRecorder : (CRenderDevice*)m_pBackend; }
+	CRenderRecorder* GetRecorder(void) { return m_pRecorder; }
+	CRenderQueue* GetRenderQueue(void) { return m_pRenderQueue; }
+	bool IsRecording(void) const { return m_bRecording; }
 	D3DXCOLOR GetBgCol(void) { return m_bgCol; }
 	UINT GetBackBufferWidth(void) { return m_d3dpp.BackBufferWidth; }
 	UINT GetBackBufferHeight(void) { return m_d3dpp.BackBufferHeight; }
@@ -74,19 +81,23 @@ public:
 	LPD3DXCONSTANTTABLE GetPSConsts(void) { return m_pPSConsts; }
 
 private:
-	LPDIRECT3D9				m_pD3D;				// DirectX3DIuWFNgւ̃|C^
-	LPDIRECT3DDEVICE9		m_pD3DDevice;		// foCXւ̃|C^
-	static CDebugProc*		m_pDebug;			// fobOtHgւ̃|C^
-	static CDebugProc3D*	m_pDebug3D;			// 3DfobO\ւ̃|C^
-	D3DXCOLOR				m_bgCol;			// ʔwi̐F
-	UINT					m_ResizeWidth;		// Đݒp̉ʂ̕
-	UINT					m_ResizeHeight;		// Đݒp̉ʂ̍
-	D3DPRESENT_PARAMETERS	m_d3dpp;			// Đݒp̃p[^[
-	static int				m_nFPS;				// FPSl̑p
-	LPDIRECT3DVERTEXSHADER9 m_pOutlineVS;		// _VF[_
-	LPDIRECT3DPIXELSHADER9  m_pOutlinePS;		// sNZVF[_
-	LPD3DXCONSTANTTABLE     m_pVSConsts;		// _VF[_RX^ge[u
-	LPD3DXCONSTANTTABLE     m_pPSConsts;		// sNZVF[_RX^ge[u
+	LPDIRECT3D9				m_pD3D;				// DirectX3Dオブジェクトへのポインタ
+	LPDIRECT3DDEVICE9		m_pD3DDevice;		// デバイスへのポインタ
+	static CDebugProc*		m_pDebug;			// デバッグフォントへのポインタ
+	static CDebugProc3D*	m_pDebug3D;			// 3Dデバッグ表示へのポインタ
+	D3DXCOLOR				m_bgCol;			// 画面背景の色
+	UINT					m_ResizeWidth;		// 再設定用の画面の幅
+	UINT					m_ResizeHeight;		// 再設定用の画面の高さ
+	D3DPRESENT_PARAMETERS	m_d3dpp;			// 再設定用のパラメーター
+	static int				m_nFPS;				// FPS値の代入用
+	LPDIRECT3DVERTEXSHADER9 m_pOutlineVS;		// 頂点シェーダ
+	LPDIRECT3DPIXELSHADER9  m_pOutlinePS;		// ピクセルシェーダ
+	LPD3DXCONSTANTTABLE     m_pVSConsts;		// 頂点シェーダコンスタントテーブル
+	LPD3DXCONSTANTTABLE     m_pPSConsts;		// ピクセルシェーダコンスタントテーブル
+	CRenderDeviceD3D9*		m_pBackend;			// 描画デバイス
+	CRenderRecorder*		m_pRecorder;		// 命令を記録する描画デバイス
+	bool					m_bRecording;		// 描画命令を記録するかどうか
+	CRenderQueue*			m_pRenderQueue;		// 描画キュー
 
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,695 @@
+//=============================================================================
+//
+// 描画キュー処理 [renderqueue.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "renderqueue.h"
+#include "manager.h"
+#include "memorymanager.h"
+#include "light.h"
+
+//=============================================================================
+// コンストラクタ
+//=============================================================================
+CRenderQueue::CRenderQueue()
+{
+	// 値のクリア
+	m_bEnable		= true;	// キューを使用するか
+	m_pOutlineVS	= nullptr;	// アウトラインの頂点シェーダー
+	m_pOutlinePS	= nullptr;	// アウトラインのピクセルシェーダー
+	m_nFramePacket	= 0;	// 今回のフレームで描画したパケット数
+	m_nFrameSkip	= 0;	// 今回のフレームで省いた設定数
+	m_nFramePass	= 0;	// 今回のフレームで送った設定数
+	m_nLastPacket	= 0;	// 前フレームで描画したパケット数
+	m_nLastSkip		= 0;	// 前フレームで省いた設定数
+	m_nLastPass		= 0;	// 前フレームで送った設定数
+}
+//=============================================================================
+// デストラクタ
+//=============================================================================
+CRenderQueue::~CRenderQueue()
+{
+	// なし
+}
+//=============================================================================
+// 並べ替えキーの生成処理
+//=============================================================================
+UINT64 CRenderQueue::MakeKey(PASS pass, int nShader, int nIdxTexture, LPD3DXMESH pMesh, float fDepth)
+{
+	// テクスチャなし(-1)を0にする
+	UINT64 texId = (UINT64)(nIdxTexture + 1) & ((1ull << TEX_BITS) - 1);
+
+	// メッシュはポインタを混ぜて識別子にする(衝突しても並びが崩れるだけ)
+	uintptr_t addr = (uintptr_t)pMesh;
+	UINT64 meshId = (UINT64)((addr >> 4) ^ (addr >> 20)) & ((1ull << MESH_BITS) - 1);
+
+	// 手前から順に描画するように距離を量子化する
+	float fRate = fDepth / MAX_DEPTH;
+
+	if (fRate < 0.0f)
+	{
+		fRate = 0.0f;
+	}
+	else if (fRate > 1.0f)
+	{
+		fRate = 1.0f;
+	}
+
+	UINT64 depth = (UINT64)(fRate * (float)((1 << DEPTH_BITS) - 1));
+
+	UINT64 key = (UINT64)pass;
+	key = (key << SHADER_BITS) | ((UINT64)nShader & ((1ull << SHADER_BITS) - 1));
+	key = (key << TEX_BITS) | texId;
+	key = (key << MESH_BITS) | meshId;
+	key = (key << DEPTH_BITS) | depth;
+
+	return key;
+}
+//=============================================================================
+// 描画パケットの登録処理
+//=============================================================================
+void CRenderQueue::Submit(PASS pass, int nShader, int nIdxTexture, LPD3DXMESH pMesh, DWORD attribId,
+	const D3DXMATRIX& mtxWorld, const D3DMATERIAL9& material, LPDIRECT3DTEXTURE9 pTexture,
+	const D3DXVECTOR3& lightCenter, float fLightRadius)
+{
+	// カメラからの距離
+	float fDepth = 0.0f;
+	CCamera* pCamera = CManager::GetCamera();
+
+	if (pCamera != nullptr)
+	{
+		D3DXVECTOR3 diff = D3DXVECTOR3(mtxWorld._41, mtxWorld._42, mtxWorld._43) - pCamera->GetPosV();
+		fDepth = D3DXVec3Length(&diff);
+	}
+
+	DrawPacket packet;
+	packet.key		= MakeKey(pass, nShader, nIdxTexture, pMesh, fDepth);
+	packet.pMesh	= pMesh;
+	packet.attribId	= attribId;
+	packet.mtxWorld	= mtxWorld;
+	packet.material	= material;
+	packet.pTexture	= pTexture;
+	packet.pass		= pass;
+	packet.lightCenter	= lightCenter;
+	packet.fLightRadius	= fLightRadius;
+
+	m_packets.push_back(packet);
+}
+//=============================================================================
+// インデックスの並べ替え処理(8ビットずつの基数ソート)
+//=============================================================================
+void CRenderQueue::SortIndices(UINT* pIndex, int nNum)
+{
+	CLinearAllocator& frame = CMemoryManager::GetFrameAllocator();
+
+	UINT* pTemp = static_cast<UINT*>(frame.Alloc(sizeof(UINT) * nNum));
+
+	UINT* pSrc = pIndex;
+	UINT* pDst = pTemp;
+
+	for (int nShift = 0; nShift < 64; nShift += 8)
+	{
+		int anCount[256] = {};
+
+		for (int nCnt = 0; nCnt < nNum; nCnt++)
+		{
+			anCount[(m_packets[pSrc[nCnt]].key >> nShift) & 0xFF]++;
+		}
+
+		// 全て同じ桁なら並べ替える必要はない
+		if (anCount[(m_packets[pSrc[0]].key >> nShift) & 0xFF] == nNum)
+		{
+			continue;
+		}
+
+		// 累積して書き込み位置にする
+		int nOffset = 0;
+
+		for (int nCnt = 0; nCnt < 256; nCnt++)
+		{
+			int nValue = anCount[nCnt];
+			anCount[nCnt] = nOffset;
+			nOffset += nValue;
+		}
+
+		for (int nCnt = 0; nCnt < nNum; nCnt++)
+		{
+			pDst[anCount[(m_packets[pSrc[nCnt]].key >> nShift) & 0xFF]++] = pSrc[nCnt];
+		}
+
+		UINT* pSwap = pSrc;
+		pSrc = pDst;
+		pDst = pSwap;
+	}
+
+	// 結果が一時領域に残っていたら戻す
+	if (pSrc != pIndex)
+	{
+		memcpy(pIndex, pSrc, sizeof(UINT) * nNum);
+	}
+}
+//=============================================================================
+// 描画処理(並べ替えてまとめて描画する。デバイスを省いたらレンダラーの物を使う)
+//=============================================================================
+void CRenderQueue::Flush(CRenderDevice* pDevice)
+{
+	if (m_packets.empty())
+	{
+		return;
+	}
+
+	int nNum = (int)m_packets.size();
+
+	// 並べ替え用のインデックス
+	UINT* pIndex = static_cast<UINT*>(CMemoryManager::GetFrameAllocator().Alloc(sizeof(UINT) * nNum));
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		pIndex[nCnt] = (UINT)nCnt;
+	}
+
+	SortIndices(pIndex, nNum);
+
+	if (pDevice == nullptr)
+	{
+		pDevice = CManager::GetRenderer()->GetBackend();
+	}
+
+	// ステートキャッシュを通して描画する
+	m_cache.Begin(pDevice);
+
+	int nSkip = m_cache.GetSkipCount();
+	int nPass = m_cache.GetPassCount();
+
+	// 現在のマテリアルの取得
+	D3DMATERIAL9 matDef;
+	m_cache.GetMaterial(&matDef);
+
+	m_cache.SetRenderState(D3DRS_NORMALIZENORMALS, TRUE);// 法線正規化を有効にする
+
+	// アウトライン用のビュー×プロジェクション(パケットごとにはデバイスから取らない)
+	D3DXMATRIX mtxView, mtxProj, mtxViewProj;
+	m_cache.GetTransform(D3DTS_VIEW, &mtxView);
+	m_cache.GetTransform(D3DTS_PROJECTION, &mtxProj);
+	D3DXMatrixMultiply(&mtxViewProj, &mtxView, &mtxProj);
+
+	PASS passCur = PASS_MAX;
+	const DrawPacket* pLastOutline = nullptr;	// 前回定数を送ったアウトラインのパケット
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		const DrawPacket& packet = m_packets[pIndex[nCnt]];
+
+		// 描画パスの切り替え
+		if (packet.pass != passCur)
+		{
+			if (passCur != PASS_MAX)
+			{
+				EndPass(&m_cache, passCur);
+			}
+
+			BeginPass(&m_cache, packet.pass, m_pOutlineVS, m_pOutlinePS);
+			passCur = packet.pass;
+		}
+
+		if (packet.pass == PASS_OUTLINE)
+		{
+			// 固定機能のステートは使わず、定数だけ送る(色はマテリアルのディフューズに入れてある)
+			// 同じパーツの別のサブセットは行列も色も同じなので送り直さない
+			if (pLastOutline == nullptr ||
+				memcmp(&pLastOutline->mtxWorld, &packet.mtxWorld, sizeof(D3DXMATRIX)) != 0 ||
+				memcmp(&pLastOutline->material.Diffuse, &packet.material.Diffuse, sizeof(D3DCOLORVALUE)) != 0)
+			{
+				SetOutlineConstants(&m_cache, packet.mtxWorld, mtxViewProj, packet.material.Diffuse);
+				pLastOutline = &packet;
+			}
+
+			// サブセットの描画
+			m_cache.DrawSubset(packet.pMesh, packet.attribId);
+			continue;
+		}
+
+		// その物の周りのライトを選ぶ(前回と同じ物なら何もしない)
+		CLight::Apply(packet.lightCenter, packet.fLightRadius, &m_cache);
+
+		m_cache.SetTransform(D3DTS_WORLD, &packet.mtxWorld);
+		m_cache.SetMaterial(&packet.material);
+		m_cache.SetTexture(0, packet.pTexture);
+
+		// サブセットの描画
+		m_cache.DrawSubset(packet.pMesh, packet.attribId);
+	}
+
+	EndPass(&m_cache, passCur);
+
+	// 後に描く物のために注視点の周りのライトに戻す
+	CLight::RestoreView(&m_cache);
+
+	m_cache.SetRenderState(D3DRS_NORMALIZENORMALS, FALSE);// 法線正規化を無効にする
+
+	// 保存していたマテリアルを戻す
+	m_cache.SetMaterial(&matDef);
+
+	m_nFramePacket += nNum;
+	m_nFrameSkip += m_cache.GetSkipCount() - nSkip;
+	m_nFramePass += m_cache.GetPassCount() - nPass;
+
+	// 容量は残したまま空にする
+	m_packets.clear();
+}
+//=============================================================================
+// フレーム終了処理(統計の確定)
+//=============================================================================
+void CRenderQueue::EndFrame(void)
+{
+	m_nLastPacket = m_nFramePacket;
+	m_nLastSkip = m_nFrameSkip;
+	m_nLastPass = m_nFramePass;
+
+	m_nFramePacket = 0;
+	m_nFrameSkip = 0;
+	m_nFramePass = 0;
+}
+//=============================================================================
+// アウトラインのシェーダー定数の設定処理(頂点・ピクセルそれぞれ1回で送る)
+//=============================================================================
+void CRenderQueue::SetOutlineConstants(CRenderDevice* pDevice, const D3DXMATRIX& mtxWorld, const D3DXMATRIX& mtxViewProj, const D3DXCOLOR& col)
+{
+	// c0～c3:ワールド×ビュー×プロジェクション(シェーダーは列優先なので転置する) c4:太さ
+	float afConst[OUTLINE_VS_COUNT * 4] = {};
+
+	D3DXMATRIX mtxWVP;
+	D3DXMatrixMultiply(&mtxWVP, &mtxWorld, &mtxViewProj);
+	D3DXMatrixTranspose((D3DXMATRIX*)afConst, &mtxWVP);
+
+	afConst[16] = OUTLINE_WIDTH;
+
+	pDevice->SetVertexShaderConstantF(OUTLINE_VS_REGISTER, afConst, OUTLINE_VS_COUNT);
+
+	// 輪郭の色
+	pDevice->SetPixelShaderConstantF(OUTLINE_PS_REGISTER, (const float*)&col, 1);
+}
+//=============================================================================
+// 描画パスの開始処理(パスごとのレンダーステート設定。アウトラインのシェーダーを省いたらレンダラーの物を使う)
+//=============================================================================
+void CRenderQueue::BeginPass(CRenderDevice* pDevice, PASS pass, LPDIRECT3DVERTEXSHADER9 pOutlineVS, LPDIRECT3DPIXELSHADER9 pOutlinePS)
+{
+	switch (pass)
+	{
+	case PASS_OUTLINE:
+	{
+		if (pOutlineVS == nullptr || pOutlinePS == nullptr)
+		{
+			CRenderer* pRenderer = CManager::GetRenderer();
+
+			pOutlineVS = pRenderer->GetOutlineVS();
+			pOutlinePS = pRenderer->GetOutlinePS();
+		}
+
+		// 裏面を太らせて描くのでカリングを反転する
+		pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CW);
+		pDevice->SetVertexShader(pOutlineVS);
+		pDevice->SetPixelShader(pOutlinePS);
+		break;
+	}
+
+	case PASS_ALPHATEST_NOCULL:
+
+		// αブレンディングを加算合成に設定
+		pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+		pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+		pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+
+		// αテストを有効
+		pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);
+		pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
+		pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);//0より大きかったら描画
+
+		// カリング設定を無効化
+		pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
+		break;
+
+	default:
+		break;
+	}
+}
+//=============================================================================
+// 描画パスの終了処理(デフォルトのレンダーステートに戻す)
+//=============================================================================
+void CRenderQueue::EndPass(CRenderDevice* pDevice, PASS pass)
+{
+	switch (pass)
+	{
+	case PASS_OUTLINE:
+
+		// 状態リセット
+		pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
+		pDevice->SetVertexShader(nullptr);
+		pDevice->SetPixelShader(nullptr);
+		break;
+
+	case PASS_ALPHATEST_NOCULL:
+
+		// カリング設定を有効化
+		pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
+
+		// αテストを無効に戻す
+		pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);
+
+		// αブレンディングを元に戻す
+		pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+		pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+		pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+		break;
+
+	default:
+		break;
+	}
+}
+//=============================================================================
+// テクスチャ設定回数の計測(デバイスを作らずに、記録デバイスへ描画して数える)
+//=============================================================================
+bool CRenderQueue::RunBenchmark(const char* filename)
+{
+	CRenderQueue queue;
+	CRenderRecorder recorder(nullptr);
+
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixIdentity(&mtxWorld);
+
+	D3DMATERIAL9 material = {};
+	int nNumPacket = 0;
+	int nNumSubmit = 0;		// 積んだ時に数えていた回数(テクスチャありのパケット数)
+	bool abUsed[BENCH_TEXTURE + 1] = {};
+
+	// 同じメッシュは同じテクスチャを使う(実際のモデルと同じ)
+	for (int nCntObj = 0; nCntObj < BENCH_OBJECT; nCntObj++)
+	{
+		int nMesh = nCntObj % BENCH_MESH;
+
+		// 描画はしないので識別できる値であれば良い
+		LPD3DXMESH pMesh = (LPD3DXMESH)(uintptr_t)((nMesh + 1) * 0x1000);
+
+		mtxWorld._41 = (float)nCntObj;
+
+		for (int nCntMat = 0; nCntMat < BENCH_MATERIAL; nCntMat++)
+		{
+			// 最後のマテリアルは半分のメッシュでテクスチャ無し
+			int nIdxTexture = (nCntMat == BENCH_MATERIAL - 1 && nMesh % 2 == 0) ? -1 : (nMesh * BENCH_MATERIAL + nCntMat) % BENCH_TEXTURE;
+			LPDIRECT3DTEXTURE9 pTexture = (nIdxTexture == -1) ? nullptr : (LPDIRECT3DTEXTURE9)(uintptr_t)((nIdxTexture + 1) * 0x100);
+
+			if (nIdxTexture != -1)
+			{
+				nNumSubmit++;
+			}
+
+			abUsed[nIdxTexture + 1] = true;
+			nNumPacket++;
+
+			queue.Submit(PASS_OPAQUE, 0, nIdxTexture, pMesh, nCntMat, mtxWorld, material, pTexture,
+				D3DXVECTOR3(mtxWorld._41, mtxWorld._42, mtxWorld._43), 0.0f);
+		}
+	}
+
+	// キューを使わない描画(CObjectX::DrawImmediateと同じ順に、物ごとにデバイスへ送る)
+	int anDirect[CRenderRecorder::CMD_MAX];
+	int nDirectState = 0;
+
+	CLight::InvalidateDevice();
+	recorder.BeginFrame();
+
+	for (int nCntObj = 0; nCntObj < BENCH_OBJECT; nCntObj++)
+	{
+		int nMesh = nCntObj % BENCH_MESH;
+		LPD3DXMESH pMesh = (LPD3DXMESH)(uintptr_t)((nMesh + 1) * 0x1000);
+
+		mtxWorld._41 = (float)nCntObj;
+
+		recorder.SetRenderState(D3DRS_NORMALIZENORMALS, TRUE);
+		BeginPass(&recorder, PASS_OPAQUE);
+		recorder.SetTransform(D3DTS_WORLD, &mtxWorld);
+		CLight::Apply(D3DXVECTOR3(mtxWorld._41, mtxWorld._42, mtxWorld._43), 0.0f, &recorder);
+
+		D3DMATERIAL9 matDef;
+		recorder.GetMaterial(&matDef);
+
+		for (int nCntMat = 0; nCntMat < BENCH_MATERIAL; nCntMat++)
+		{
+			int nIdxTexture = (nCntMat == BENCH_MATERIAL - 1 && nMesh % 2 == 0) ? -1 : (nMesh * BENCH_MATERIAL + nCntMat) % BENCH_TEXTURE;
+			LPDIRECT3DTEXTURE9 pTexture = (nIdxTexture == -1) ? nullptr : (LPDIRECT3DTEXTURE9)(uintptr_t)((nIdxTexture + 1) * 0x100);
+
+			recorder.SetMaterial(&material);
+			recorder.SetTexture(0, pTexture);
+			recorder.DrawSubset(pMesh, nCntMat);
+		}
+
+		EndPass(&recorder, PASS_OPAQUE);
+		recorder.SetRenderState(D3DRS_NORMALIZENORMALS, FALSE);
+		recorder.SetMaterial(&matDef);
+		CLight::RestoreView(&recorder);
+	}
+
+	for (int nCnt = 0; nCnt < CRenderRecorder::CMD_MAX; nCnt++)
+	{
+		anDirect[nCnt] = recorder.GetCount((CRenderRecorder::CMD)nCnt);
+	}
+
+	nDirectState = recorder.GetStateChangeCount();
+
+	// キューを通して描く(記録デバイスに届いた数 = D3D9のデバイスで数える回数)
+	int anQueued[CRenderRecorder::CMD_MAX];
+
+	CLight::InvalidateDevice();
+	recorder.BeginFrame();
+	queue.Flush(&recorder);
+
+	for (int nCnt = 0; nCnt < CRenderRecorder::CMD_MAX; nCnt++)
+	{
+		anQueued[nCnt] = recorder.GetCount((CRenderRecorder::CMD)nCnt);
+	}
+
+	int nQueuedState = recorder.GetStateChangeCount();
+	int nNumDevice = anQueued[CRenderRecorder::CMD_SET_TEXTURE];
+	int nNumDraw = anQueued[CRenderRecorder::CMD_DRAW];
+
+	// テクスチャ順に並ぶので、使った種類の数だけ設定されるはず
+	int nNumUsed = 0;
+
+	for (bool bUsed : abUsed)
+	{
+		nNumUsed += bUsed ? 1 : 0;
+	}
+
+	bool bMatch = (nNumDraw == nNumPacket) && (anDirect[CRenderRecorder::CMD_DRAW] == nNumPacket) &&
+		(nNumDevice == nNumUsed) && (nQueuedState < nDirectState);
+
+	// キャラクターのアウトライン(人数を変えて、キュー無しはパーツごと・キュー有りは1回の切り替えになるか)
+	static const int CHARA_NUM[] = { 1, 10, 30 };
+	CharaBench aChara[sizeof(CHARA_NUM) / sizeof(CHARA_NUM[0])];
+
+	for (int nCnt = 0; nCnt < (int)(sizeof(CHARA_NUM) / sizeof(CHARA_NUM[0])); nCnt++)
+	{
+		aChara[nCnt] = RunCharaBench(&recorder, CHARA_NUM[nCnt]);
+
+		int nNumPart = CHARA_NUM[nCnt] * BENCH_PART;
+
+		// キュー無しはパーツごとに頂点・ピクセルの設定と解除で4回、キュー有りはパスの開始と終了で4回
+		bMatch = bMatch &&
+			(aChara[nCnt].anShader[0] == nNumPart * 4) && (aChara[nCnt].anShader[1] == 4) &&
+			(aChara[nCnt].anConstant[1] <= aChara[nCnt].anConstant[0]) &&
+			(aChara[nCnt].anDraw[0] == aChara[nCnt].anDraw[1]);
+	}
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "packets                : %d (%d objects x %d materials)\n", nNumPacket, BENCH_OBJECT, BENCH_MATERIAL);
+	fprintf(pFile, "meshes / textures      : %d / %d (%d used incl. none)\n", BENCH_MESH, BENCH_TEXTURE, nNumUsed);
+	fprintf(pFile, "draws                  : %d\n", nNumDraw);
+	fprintf(pFile, "texture set (submit)   : %d\n", nNumSubmit);
+	fprintf(pFile, "texture set (device)   : %d\n\n", nNumDevice);
+
+	// 種類ごとのステート変更回数(どちらも記録デバイスで数える。DrawSubsetの中の設定は両方同じなので含めない)
+	static const struct
+	{
+		CRenderRecorder::CMD	cmd;
+		const char*				pName;
+	} ROWS[] =
+	{
+		{ CRenderRecorder::CMD_SET_RENDERSTATE,	"render state" },
+		{ CRenderRecorder::CMD_SET_TRANSFORM,	"transform" },
+		{ CRenderRecorder::CMD_SET_MATERIAL,	"material" },
+		{ CRenderRecorder::CMD_SET_TEXTURE,		"texture" },
+		{ CRenderRecorder::CMD_SET_LIGHT,		"light" },
+		{ CRenderRecorder::CMD_SET_FVF,			"fvf" },
+		{ CRenderRecorder::CMD_SET_STREAM,		"stream" },
+		{ CRenderRecorder::CMD_SET_SHADER,		"shader" },
+		{ CRenderRecorder::CMD_SET_CONSTANT,	"shader constant" },
+		{ CRenderRecorder::CMD_DRAW,			"draw" },
+	};
+
+	fprintf(pFile, "                       : no queue   queued\n");
+
+	for (const auto& row : ROWS)
+	{
+		fprintf(pFile, "%-23s: %8d %8d\n", row.pName, anDirect[row.cmd], anQueued[row.cmd]);
+	}
+
+	fprintf(pFile, "total state changes    : %8d %8d\n\n", nDirectState, nQueuedState);
+
+	// キャラクターのアウトライン(shader_switchは頂点・ピクセルシェーダーの設定回数)
+	fprintf(pFile, "characters             : %d parts x %d materials, %d models\n", BENCH_PART, BENCH_PART_MATERIAL, BENCH_CHARA_MODEL);
+	fprintf(pFile, "                       : shader_switch      shader constant    state changes\n");
+	fprintf(pFile, "                       : no queue   queued  no queue   queued  no queue   queued\n");
+
+	for (int nCnt = 0; nCnt < (int)(sizeof(CHARA_NUM) / sizeof(CHARA_NUM[0])); nCnt++)
+	{
+		char aName[32];
+		sprintf_s(aName, "%d chara x %d parts", CHARA_NUM[nCnt], BENCH_PART);
+
+		const CharaBench& chara = aChara[nCnt];
+		fprintf(pFile, "%-23s: %8d %8d  %8d %8d  %8d %8d\n", aName,
+			chara.anShader[0], chara.anShader[1], chara.anConstant[0], chara.anConstant[1], chara.anState[0], chara.anState[1]);
+	}
+
+	fprintf(pFile, "\n");
+	fprintf(pFile, "result match           : %s\n", bMatch ? "yes" : "no");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bMatch;
+}
+//=============================================================================
+// キャラクターのアウトラインの計測処理(CModel::Drawのキュー無しの描画と、CModel::Submitで積んだ時を記録デバイスで数える)
+//=============================================================================
+CRenderQueue::CharaBench CRenderQueue::RunCharaBench(CRenderRecorder* pRecorder, int nNumChara)
+{
+	// 描画はしないので識別できる値であれば良い
+	LPDIRECT3DVERTEXSHADER9 pOutlineVS = (LPDIRECT3DVERTEXSHADER9)(uintptr_t)0x10;
+	LPDIRECT3DPIXELSHADER9 pOutlinePS = (LPDIRECT3DPIXELSHADER9)(uintptr_t)0x20;
+
+	// 識別子はCModelと同じ(0:固定機能 1:アウトライン)
+	const int SHADER_NORMAL = 0;
+	const int SHADER_OUTLINE = 1;
+
+	CharaBench result = {};
+	D3DMATERIAL9 matOutline = {};
+	matOutline.Diffuse = D3DXCOLOR(0.0f, 0.0f, 0.0f, 1.0f);
+	D3DMATERIAL9 material = {};
+	D3DXMATRIX mtxWorld, mtxViewProj;
+	D3DXMatrixIdentity(&mtxWorld);
+	D3DXMatrixIdentity(&mtxViewProj);
+
+	// パーツのメッシュとテクスチャ(同じ種類のキャラクターは同じ物を使う)
+	auto getMesh = [](int nChara, int nPart)
+	{
+		return (LPD3DXMESH)(uintptr_t)(((nChara % BENCH_CHARA_MODEL) * BENCH_PART + nPart + 1) * 0x1000);
+	};
+
+	auto getTexture = [](int nChara, int nMat)
+	{
+		int nIdxTexture = (nChara % BENCH_CHARA_MODEL) * BENCH_PART_MATERIAL + nMat;
+		return (LPDIRECT3DTEXTURE9)(uintptr_t)((nIdxTexture + 1) * 0x100);
+	};
+
+	auto getCount = [&](int nPass)
+	{
+		result.anShader[nPass] = pRecorder->GetCount(CRenderRecorder::CMD_SET_SHADER);
+		result.anConstant[nPass] = pRecorder->GetCount(CRenderRecorder::CMD_SET_CONSTANT);
+		result.anState[nPass] = pRecorder->GetStateChangeCount();
+		result.anDraw[nPass] = pRecorder->GetCount(CRenderRecorder::CMD_DRAW);
+	};
+
+	// キュー無し(パーツごとにアウトラインのシェーダーを設定して外す)
+	CLight::InvalidateDevice();
+	pRecorder->BeginFrame();
+
+	for (int nCntChara = 0; nCntChara < nNumChara; nCntChara++)
+	{
+		for (int nCntPart = 0; nCntPart < BENCH_PART; nCntPart++)
+		{
+			LPD3DXMESH pMesh = getMesh(nCntChara, nCntPart);
+			D3DXVECTOR3 center((float)nCntChara * 100.0f, (float)nCntPart * 5.0f, 0.0f);
+
+			mtxWorld._41 = center.x;
+			mtxWorld._42 = center.y;
+
+			CLight::Apply(center, 10.0f, pRecorder);
+			pRecorder->SetTransform(D3DTS_WORLD, &mtxWorld);
+
+			// アウトライン描画
+			pRecorder->SetRenderState(D3DRS_CULLMODE, D3DCULL_CW);
+			pRecorder->SetVertexShader(pOutlineVS);
+			pRecorder->SetPixelShader(pOutlinePS);
+			SetOutlineConstants(pRecorder, mtxWorld, mtxViewProj, matOutline.Diffuse);
+
+			for (int nCntMat = 0; nCntMat < BENCH_PART_MATERIAL; nCntMat++)
+			{
+				pRecorder->DrawSubset(pMesh, nCntMat);
+			}
+
+			pRecorder->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
+			pRecorder->SetVertexShader(nullptr);
+			pRecorder->SetPixelShader(nullptr);
+
+			// 通常描画
+			D3DMATERIAL9 matDef;
+			pRecorder->GetMaterial(&matDef);
+
+			for (int nCntMat = 0; nCntMat < BENCH_PART_MATERIAL; nCntMat++)
+			{
+				pRecorder->SetMaterial(&material);
+				pRecorder->SetTexture(0, getTexture(nCntChara, nCntMat));
+				pRecorder->DrawSubset(pMesh, nCntMat);
+			}
+
+			pRecorder->SetMaterial(&matDef);
+			CLight::RestoreView(pRecorder);
+		}
+	}
+
+	getCount(0);
+
+	// キュー有り(全キャラクターのアウトラインを1つのパスで描く)
+	CRenderQueue queue;
+	queue.SetOutlineShader(pOutlineVS, pOutlinePS);
+
+	for (int nCntChara = 0; nCntChara < nNumChara; nCntChara++)
+	{
+		for (int nCntPart = 0; nCntPart < BENCH_PART; nCntPart++)
+		{
+			LPD3DXMESH pMesh = getMesh(nCntChara, nCntPart);
+			D3DXVECTOR3 center((float)nCntChara * 100.0f, (float)nCntPart * 5.0f, 0.0f);
+
+			mtxWorld._41 = center.x;
+			mtxWorld._42 = center.y;
+
+			for (int nCntMat = 0; nCntMat < BENCH_PART_MATERIAL; nCntMat++)
+			{
+				int nIdxTexture = (nCntChara % BENCH_CHARA_MODEL) * BENCH_PART_MATERIAL + nCntMat;
+
+				queue.Submit(PASS_OUTLINE, SHADER_OUTLINE, -1, pMesh, nCntMat, mtxWorld, matOutline, nullptr, center, 10.0f);
+				queue.Submit(PASS_OPAQUE, SHADER_NORMAL, nIdxTexture, pMesh, nCntMat, mtxWorld, material, getTexture(nCntChara, nCntMat), center, 10.0f);
+			}
+		}
+	}
+
+	CLight::InvalidateDevice();
+	pRecorder->BeginFrame();
+	queue.Flush(pRecorder);
+
+	getCount(1);
+
+	return result;
+}
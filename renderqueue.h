@@ -0,0 +1,122 @@
+//=============================================================================
+//
+// 描画キュー処理 [renderqueue.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _RENDERQUEUE_H_// このマクロ定義がされていなかったら
+#define _RENDERQUEUE_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "renderdevice.h"
+
+//*****************************************************************************
+// 描画キュークラス(描画パケットをキーで並べ替えてまとめて描画する)
+//*****************************************************************************
+class CRenderQueue
+{
+public:
+	CRenderQueue();
+	~CRenderQueue();
+
+	// 描画パスの種類(キーの最上位。ステートの切り替えが一番重いもの)
+	typedef enum
+	{
+		PASS_OUTLINE = 0,		// アウトライン(シェーダーを1回だけ設定して全キャラクター分を描く)
+		PASS_OPAQUE,			// 不透明
+		PASS_ALPHATEST_NOCULL,	// αテストあり・カリングなし(草など)
+		PASS_MAX
+	}PASS;
+
+	// 描画パケット
+	struct DrawPacket
+	{
+		UINT64				key;		// 並べ替えキー
+		LPD3DXMESH			pMesh;		// メッシュ
+		DWORD				attribId;	// サブセット番号
+		D3DXMATRIX			mtxWorld;	// ワールドマトリックス
+		D3DMATERIAL9		material;	// マテリアル
+		LPDIRECT3DTEXTURE9	pTexture;	// テクスチャ
+		PASS				pass;		// 描画パス
+		D3DXVECTOR3			lightCenter;	// ライトを選ぶ境界球の中心
+		float				fLightRadius;	// ライトを選ぶ境界球の半径
+	};
+
+	void Submit(PASS pass, int nShader, int nIdxTexture, LPD3DXMESH pMesh, DWORD attribId,
+		const D3DXMATRIX& mtxWorld, const D3DMATERIAL9& material, LPDIRECT3DTEXTURE9 pTexture,
+		const D3DXVECTOR3& lightCenter, float fLightRadius);
+	void Flush(CRenderDevice* pDevice = nullptr);
+	void Clear(void) { m_packets.clear(); }
+	void EndFrame(void);
+
+	static void BeginPass(CRenderDevice* pDevice, PASS pass, LPDIRECT3DVERTEXSHADER9 pOutlineVS = nullptr, LPDIRECT3DPIXELSHADER9 pOutlinePS = nullptr);
+	static void EndPass(CRenderDevice* pDevice, PASS pass);
+	static UINT64 MakeKey(PASS pass, int nShader, int nIdxTexture, LPD3DXMESH pMesh, float fDepth);
+	static void SetOutlineConstants(CRenderDevice* pDevice, const D3DXMATRIX& mtxWorld, const D3DXMATRIX& mtxViewProj, const D3DXCOLOR& col);
+	static bool RunBenchmark(const char* filename);
+
+	//*****************************************************************************
+	// setter関数
+	//*****************************************************************************
+	void SetEnable(bool enable) { m_bEnable = enable; }
+	void SetOutlineShader(LPDIRECT3DVERTEXSHADER9 pVS, LPDIRECT3DPIXELSHADER9 pPS) { m_pOutlineVS = pVS; m_pOutlinePS = pPS; }
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	bool IsEnable(void) const { return m_bEnable; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	int GetNumPacket(void) const { return (int)m_packets.size(); }
+	int GetLastPacketCount(void) const { return m_nLastPacket; }
+	int GetLastSkipCount(void) const { return m_nLastSkip; }
+	int GetLastPassCount(void) const { return m_nLastPass; }
+
+private:
+	static constexpr float	MAX_DEPTH	= 20000.0f;			// キーに入れる最大距離
+	static constexpr int	DEPTH_BITS	= 24;				// 距離のビット数
+	static constexpr int	MESH_BITS	= 16;				// メッシュ識別子のビット数
+	static constexpr int	TEX_BITS	= 16;				// テクスチャ識別子のビット数
+	static constexpr int	SHADER_BITS	= 4;				// シェーダー識別子のビット数
+	static constexpr float	OUTLINE_WIDTH		= 0.2f;	// アウトラインの太さ
+	static constexpr UINT	OUTLINE_VS_REGISTER	= 0;	// アウトライン頂点シェーダーの定数の先頭(c0～c3:WVP c4:太さ)
+	static constexpr UINT	OUTLINE_VS_COUNT	= 5;	// アウトライン頂点シェーダーの定数の数
+	static constexpr UINT	OUTLINE_PS_REGISTER	= 0;	// アウトラインピクセルシェーダーの色のレジスタ
+	static constexpr int	BENCH_OBJECT		= 300;	// 計測用のオブジェクト数
+	static constexpr int	BENCH_MATERIAL		= 3;	// 計測用の1オブジェクトのマテリアル数
+	static constexpr int	BENCH_MESH			= 20;	// 計測用のメッシュの種類
+	static constexpr int	BENCH_TEXTURE		= 12;	// 計測用のテクスチャの種類
+	static constexpr int	BENCH_PART			= 15;	// 計測用の1キャラクターのパーツ数
+	static constexpr int	BENCH_PART_MATERIAL	= 2;	// 計測用の1パーツのマテリアル数
+	static constexpr int	BENCH_CHARA_MODEL	= 2;	// 計測用のキャラクターの種類(プレイヤーと敵)
+
+	// キャラクターの計測結果(パスごとのシェーダー切り替え回数とステート変更回数)
+	typedef struct
+	{
+		int anShader[2];	// シェーダーの設定回数(キュー無し・キュー有り)
+		int anConstant[2];	// シェーダー定数の設定回数
+		int anState[2];		// ステート変更回数の合計
+		int anDraw[2];		// 描画回数
+	}CharaBench;
+
+	void SortIndices(UINT* pIndex, int nNum);
+	static CharaBench RunCharaBench(CRenderRecorder* pRecorder, int nNumChara);
+
+	std::vector<DrawPacket>	m_packets;		// 今回のフレームの描画パケット
+	CRenderStateCache		m_cache;		// 重複した設定を省くステートキャッシュ
+	bool					m_bEnable;		// キューを使用するか
+	LPDIRECT3DVERTEXSHADER9	m_pOutlineVS;	// アウトラインの頂点シェーダー(nullptrならレンダラーの物を使う)
+	LPDIRECT3DPIXELSHADER9	m_pOutlinePS;	// アウトラインのピクセルシェーダー(nullptrならレンダラーの物を使う)
+	int						m_nFramePacket;	// 今回のフレームで描画したパケット数
+	int						m_nFrameSkip;	// 今回のフレームで省いた設定数
+	int						m_nFramePass;	// 今回のフレームで送った設定数
+	int						m_nLastPacket;	// 前フレームで描画したパケット数
+	int						m_nLastSkip;	// 前フレームで省いた設定数
+	int						m_nLastPass;	// 前フレームで送った設定数
+};
+
+#endif
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// Ug [result.cpp]
+// リザルト処理 [result.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "result.h"
 #include "input.h"
@@ -20,125 +20,131 @@
 #include "blockmanager.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-int CResult::m_clearRankIndex	= 0;			// NÃNCfbNX
-int CResult::m_soundCount		= 0;			// ̔
-int CResult::m_insightCount		= 0;			// ꂽ
-int CResult::m_treasureCount	= 0;			// ̐
+int CResult::m_clearRankIndex	= 0;			// クリア時のランクインデックス
+int CResult::m_soundCount		= 0;			// 音の発生数
+int CResult::m_insightCount		= 0;			// 発見された回数
+int CResult::m_treasureCount	= 0;			// 宝の数
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CResult::CResult() : CScene(CScene::MODE_RESULT)
 {
-	// l̃NA
-	m_pBlockManager = nullptr;	// ubN}l[W[ւ̃|C^
-	m_pLight		= nullptr;	// Cgւ̃|C^
-	m_timer			= 0;		// \^C}[
+	// 値のクリア
+	m_pBlockManager = nullptr;	// ブロックマネージャーへのポインタ
+	m_pLight		= nullptr;	// ライトへのポインタ
+	m_nLightGeneration = 0;		// 登録した時のライトの世代
+	m_timer			= 0;		// 表示タイマー
+
+	for (int nCnt = 0; nCnt < LIGHT_MAX; nCnt++)
+	{
+		m_anLight[nCnt] = -1;	// 登録したライトの番号
+	}
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CResult::~CResult()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CResult::Init(void)
 {
-	// }EXJ[\\
+	// マウスカーソルを表示する
 	CManager::GetInputMouse()->SetCursorVisibility(true);
 
-	// ubN}l[W[̐
+	// ブロックマネージャーの生成
 	m_pBlockManager = new CBlockManager;
 
-	// ubN}l[W[̏
+	// ブロックマネージャーの初期化
 	m_pBlockManager->Init();
 
-	// Cg̐
+	// ライトの生成
 	m_pLight = new CLight;
 
-	// Cg̏
+	// ライトの初期化
 	m_pLight->Init();
 
-	// Cg̍Đݒ菈
+	// ライトの再設定処理
 	ResetLight();
 
-	// JSON̓ǂݍ
+	// JSONの読み込み
 	m_pBlockManager->LoadFromJson("data/result_blockinfo.json");
 
-	// wi̐
+	// 背景の生成
 	CBackground::Create("data/TEXTURE/.png", 0.29f, 0.75f, 0.2f, 0.5f);
 
-	// _~[vC[̐
+	// ダミープレイヤーの生成
 	CDummyPlayer::Create(D3DXVECTOR3(0.0f, 110.0f, 0.0f), D3DXVECTOR3(0.0f, 180.0f, 0.0f), CDummyPlayer::DUSH);
 
-	// bVh[̐
+	// メッシュドームの生成
 	CMeshDome::Create(D3DXVECTOR3(0.0f, -50.0f, 0.0f), 2800);
 
 
-	// l̕\
+	// 宝獲得数の表示
 	CCount::Create(0.2f, 0.2f, 0.08f, 0.1f, m_treasureCount);
 
-	// ̕\
+	// 音発生数の表示
 	CCount::Create(0.2f, 0.46f, 0.08f, 0.1f, m_soundCount);
 
-	// ꂽ񐔂̕\
+	// 発見された回数の表示
 	CCount::Create(0.2f, 0.72f, 0.08f, 0.1f, m_insightCount);
 
-	// u̐vUI
+	// 「埋蔵金の数」UI生成
 	auto treasureCount = CUITexture::Create("data/TEXTURE/ui_treasurecount.png", 0.18f, 0.12f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.11f, 0.05f);
 
-	// u̔vUI
+	// 「音の発生数」UI生成
 	auto soundCount = CUITexture::Create("data/TEXTURE/ui_soundcount.png", 0.18f, 0.37f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.11f, 0.05f);
 
-	// uꂽ񐔁vUI
+	// 「発見された回数」UI生成
 	auto insight = CUITexture::Create("data/TEXTURE/ui_insightcount.png", 0.22f, 0.64f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.13f, 0.06f);
 
-	// NUI
+	// ランクUI生成
 	auto rank = CUITexture::Create("data/TEXTURE/ui_resultRank.png", 0.33f, 0.88f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.045f, 0.07f);
 
-	// u]vUI
+	// 「評価」UI生成
 	auto evaluation = CUITexture::Create("data/TEXTURE/ui_evaluation.png", 0.3f, 0.9f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.11f, 0.06f);
 
-	// u̐vUIo^
+	// 「埋蔵金の数」UI登録
 	CUIManager::GetInstance()->AddUI("TreasureCount", treasureCount);
 
-	// u̔vUIo^
+	// 「音の発生数」UI登録
 	CUIManager::GetInstance()->AddUI("SoundCount", soundCount);
 
-	// uꂽ񐔁vUIo^
+	// 「発見された回数」UI登録
 	CUIManager::GetInstance()->AddUI("Insight", insight);
 
-	// NUIo^
+	// ランクUI登録
 	CUIManager::GetInstance()->AddUI("Rank", rank);
 
-	// u]vUIo^
+	// 「評価」UI登録
 	CUIManager::GetInstance()->AddUI("Evaluation", evaluation);
 
-	// UȈݒ
+	// UIの初期設定
 	rank->Hide();
 	rank->SetUVDirtyUse(true);
 
-	// UI\xԂ̐ݒ
+	// UI表示遅延時間の設定
 	m_timer = DELAY_TIME;
 
-	// J̎擾
+	// カメラの取得
 	CCamera* pCamera = CManager::GetCamera();
 
-	// J̏ʒuݒ肵Ă
+	// カメラの初期位置を設定しておく
 	pCamera->SetCamParameter(D3DXVECTOR3(64.0f, 170.8f, 50.6f),
 		D3DXVECTOR3(-41.4f, 152.2f, -112.4f),
 		D3DXVECTOR3(0.10f, 0.57f, 0.0f),
 		0.0f);
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// UgSE̍Đ
+	// リザルトSEの再生
 	if (pSound)
 	{
 		pSound->Play(CSound::SOUND_LABEL_RESULTSE);
@@ -147,11 +153,11 @@ HRESULT CResult::Init(void)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CResult::Uninit(void)
 {
-	// ubN}l[W[̔j
+	// ブロックマネージャーの破棄
 	if (m_pBlockManager != nullptr)
 	{
 		m_pBlockManager->Uninit();
@@ -160,7 +166,7 @@ void CResult::Uninit(void)
 		m_pBlockManager = nullptr;
 	}
 
-	// Cg̔j
+	// ライトの破棄
 	if (m_pLight != nullptr)
 	{
 		delete m_pLight;
@@ -168,57 +174,57 @@ void CResult::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CResult::Update(void)
 {
 	m_timer--;
 
-	// NUI̎擾
+	// ランクUIの取得
 	auto rank = CUIManager::GetInstance()->GetUI("Rank");
 
 	if (m_timer <= 0)
 	{
 		m_timer = 0;
 
-		// NUI\
+		// ランクUIを表示する
 		rank->Show();
 	}
 
-	// ubN}l[W[̍XV
+	// ブロックマネージャーの更新処理
 	m_pBlockManager->Update();
 
 	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
-	CInputJoypad* pJoypad = CManager::GetInputJoypad();		// Q[pbh͎̓擾
+	CInputJoypad* pJoypad = CManager::GetInputJoypad();		// ゲームパッドの入力取得
 	CFade* pFade = CManager::GetFade();
 
 	if (pFade->GetFade() == CFade::FADE_NONE && 
 		(pKeyboard->GetAnyKeyTrigger() || pJoypad->GetTrigger(CInputJoypad::JOYKEY_A) ||
 			CManager::GetInputKeyboard()->GetTrigger(DIK_RETURN)))
 	{
-		// LOʂɈڍs
+		// ランキング画面に移行
 		pFade->SetFade(MODE_RANKING);
 	}
 
 #ifdef _DEBUG
 	if (pFade->GetFade() == CFade::FADE_NONE && pKeyboard->GetAnyKeyTrigger())
 	{
-		// LOʂɈڍs
+		// ランキング画面に移行
 		pFade->SetFade(MODE_RANKING);
 	}
 #endif
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CResult::Draw(void)
 {
-	// J̎擾
+	// カメラの取得
 	CCamera* pCamera = CManager::GetCamera();
 
 	if (!pCamera->GetMode() == CCamera::MODE_EDIT)
 	{
-		// J̐ݒ
+		// カメラの設定
 		pCamera->SetCamParameter(D3DXVECTOR3(64.0f, 170.8f, 50.6f),
 			D3DXVECTOR3(-41.4f, 152.2f, -112.4f),
 			D3DXVECTOR3(0.10f, 0.57f, 0.0f),
@@ -226,65 +232,60 @@ void CResult::Draw(void)
 	}
 }
 //=============================================================================
-// Cgݒ菈
+// ライト設定処理(登録済みなら色と向きだけ書き換える)
 //=============================================================================
 void CResult::ResetLight(void)
 {
-	// Cg폜Ă
-	CLight::Uninit();
-
-	// gFE΂߉
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f),    // IWn
-		D3DXVECTOR3(-0.3f, -0.8f, 0.2f),       // ̂悤Ɏ΂
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
-
-	// gF
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f),    // IWn
-		D3DXVECTOR3(0.0f, -0.8f, -0.2f),
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
-
-	// 
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.3f, 0.35f, 0.5f, 1.0f),    // [̋̊F
-		D3DXVECTOR3(0.0f, 1.0f, 0.0f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
-
-	// Iȕ⏕
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.5f, 0.4f, 0.4f, 1.0f),     // _炩߂̐Ԍn
-		D3DXVECTOR3(0.3f, -0.2f, -0.3f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
+	// 暖色・斜め下方向(オレンジ系で西日のように斜め)
+	SetSceneLight(LIGHT_SUNSET, D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f), D3DXVECTOR3(-0.3f, -0.8f, 0.2f), D3DXVECTOR3(0.0f, 300.0f, 0.0f));
+
+	// 暖色(オレンジ系)
+	SetSceneLight(LIGHT_WARM, D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f), D3DXVECTOR3(0.0f, -0.8f, -0.2f), D3DXVECTOR3(0.0f, 300.0f, 0.0f));
+
+	// 薄い青(夕方の空の寒色寄り)
+	SetSceneLight(LIGHT_SKY, D3DXCOLOR(0.3f, 0.35f, 0.5f, 1.0f), D3DXVECTOR3(0.0f, 1.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 環境的な補助光(柔らかめの赤系)
+	SetSceneLight(LIGHT_FILL, D3DXCOLOR(0.5f, 0.4f, 0.4f, 1.0f), D3DXVECTOR3(0.3f, -0.2f, -0.3f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 登録した世代を覚えておく
+	m_nLightGeneration = CLight::GetGeneration();
+}
+//=============================================================================
+// シーンライトの設定処理(登録は1回だけ行い、以降は色と向きだけ書き換える)
+//=============================================================================
+void CResult::SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos)
+{
+	// ライトが作り直されていたら登録し直す
+	if (m_anLight[light] < 0 || m_nLightGeneration != CLight::GetGeneration())
+	{
+		m_anLight[light] = CLight::AddLight(D3DLIGHT_DIRECTIONAL, col, dir, pos);
+		return;
+	}
+
+	CLight::SetLightDiffuse(m_anLight[light], col);
+	CLight::SetLightDirection(m_anLight[light], dir);
 }
 //=============================================================================
-// foCXZbgʒm
+// デバイスリセット通知
 //=============================================================================
 void CResult::OnDeviceReset(void)
 {
-	// Cg̍Đݒ菈
+	// ライトの再設定処理
 	ResetLight();
 }
 //=============================================================================
-// TlC[Xʒm
+// サムネイルリリース通知
 //=============================================================================
 void CResult::ReleaseThumbnail(void)
 {
 	m_pBlockManager->ReleaseThumbnailRenderTarget();
 }
 //=============================================================================
-// TlCZbgʒm
+// サムネイルリセット通知
 //=============================================================================
 void CResult::ResetThumbnail(void)
 {
 	m_pBlockManager->InitThumbnailRenderTarget(CManager::GetRenderer()->GetDevice());
-	m_pBlockManager->GenerateThumbnailsForResources(); // LbVč쐬
+	m_pBlockManager->GenerateThumbnailsForResources(); // キャッシュも再作成
 }
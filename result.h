@@ -1,27 +1,27 @@
 //=============================================================================
 //
-// Ug [result.h]
+// リザルト処理 [result.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RESULT_H_// ̃}N`ĂȂ
-#define _RESULT_H_// 2dCN[hh~̃}N`
+#ifndef _RESULT_H_// このマクロ定義がされていなかったら
+#define _RESULT_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 #include "resulttime.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CLight;
 class CBlockManager;
 
 
 //*****************************************************************************
-// UgNX
+// リザルトクラス
 //*****************************************************************************
 class CResult : public CScene
 {
@@ -44,21 +44,35 @@ public:
 	static int GetInsightCount(void) { return m_insightCount; }
 
 
-	static void ResetLight(void);
+	void ResetLight(void);
 	void OnDeviceReset(void) override;
 	void ReleaseThumbnail(void) override;
 	void ResetThumbnail(void) override;
 
 private:
-	static constexpr int DELAY_TIME = 120;	// \x
+	static constexpr int DELAY_TIME = 120;	// 表示遅延時間
 
-	static int			m_clearRankIndex;	// NÃNCfbNX
-	static int			m_soundCount;		// ̔
-	static int			m_insightCount;		// 
-	static int			m_treasureCount;	// ̐
-	CLight*				m_pLight;			// Cgւ̃|C^
-	CBlockManager*		m_pBlockManager;	// ubN}l[W[ւ̃|C^
-	int					m_timer;			// \^C}[
+	// リザルトで使うライト
+	typedef enum
+	{
+		LIGHT_SUNSET = 0,	// 暖色・斜め下方向
+		LIGHT_WARM,			// 暖色
+		LIGHT_SKY,			// 薄い青
+		LIGHT_FILL,			// 環境的な補助光
+		LIGHT_MAX
+	}LIGHT;
+
+	void SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos);
+
+	static int			m_clearRankIndex;	// クリア時のランクインデックス
+	static int			m_soundCount;		// 音の発生数
+	static int			m_insightCount;		// 見つかった回数
+	static int			m_treasureCount;	// 宝の数
+	CLight*				m_pLight;			// ライトへのポインタ
+	int					m_anLight[LIGHT_MAX];	// 登録したライトの番号
+	unsigned int		m_nLightGeneration;	// 登録した時のライトの世代
+	CBlockManager*		m_pBlockManager;	// ブロックマネージャーへのポインタ
+	int					m_timer;			// 表示タイマー
 };
 
 #endif
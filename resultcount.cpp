@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// 񐔕\ [resultcount.cpp]
+// 回数表示処理 [resultcount.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "resultcount.h"
 #include "texture.h"
@@ -14,35 +14,34 @@
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CCount::CCount(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_apNumber, 0, sizeof(m_apNumber));	// e̐\p
-	m_nCount		= 0;						// 
-	m_digitWidth	= 0.0f;						// 1̕
-	m_digitHeight	= 0.0f;						// 1̍
-	m_basePos		= INIT_VEC3;				// \̊Jnʒu
-	m_nIdxTexture	= 0;						// eNX`CfbNX
-	m_layoutPos		= INIT_VEC3;				// CAEg̈ʒu
+	// 値のクリア
+	m_pNumber		= nullptr;					// 数字表示用
+	m_nCount		= 0;						// 数
+	m_digitWidth	= 0.0f;						// 数字1桁あたりの幅
+	m_digitHeight	= 0.0f;						// 数字1桁あたりの高さ
+	m_basePos		= INIT_VEC3;				// 表示の開始位置
+	m_layoutPos		= INIT_VEC3;				// レイアウト時の位置
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CCount::~CCount()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CCount* CCount::Create(float anchorX, float anchorY,
 	float digitWidthRate, float digitHeightRate, int count)
 {
 	CCount* pCount = new CCount;
 
-	// nullptr
+	// nullptrだったら
 	if (pCount == nullptr)
 	{
 		return nullptr;
@@ -54,7 +53,7 @@ CCount* CCount::Create(float anchorX, float anchorY,
 	pCount->m_layout.digitHeightRate = digitHeightRate;
 	pCount->m_nCount = count;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pCount->Init()))
 	{
 		return nullptr;
@@ -63,54 +62,44 @@ CCount* CCount::Create(float anchorX, float anchorY,
 	return pCount;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CCount::Init(void)
 {
-	for (int nCnt = 0; nCnt < MAX_DIGITS; nCnt++)
-	{
-		float posX = m_basePos.x + nCnt * m_digitWidth;
-		float posY = m_basePos.y;
-
-		m_apNumber[nCnt] = CNumber::Create(posX, posY, m_digitWidth, m_digitHeight);
+	// 数を1つのナンバーで並べる
+	m_pNumber = CNumber::Create(m_basePos.x, m_basePos.y, m_digitWidth, m_digitHeight);
 
-		if (!m_apNumber[nCnt])
-		{
-			return E_FAIL;
-		}
+	if (!m_pNumber)
+	{
+		return E_FAIL;
 	}
 
-	// eNX`蓖
-	CTexture* pTexture = CManager::GetTexture();
-	m_nIdxTexture = pTexture->RegisterDynamic("data/TEXTURE/num_01.png");
+	m_pNumber->SetValue(m_nCount);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CCount::Uninit(void)
 {
-	for (int nCnt = 0; nCnt < MAX_DIGITS; nCnt++)
+	if (m_pNumber != nullptr)
 	{
-		if (m_apNumber[nCnt] != nullptr)
-		{
-			// io[̏I
-			m_apNumber[nCnt]->Uninit();
-
-			delete m_apNumber[nCnt];
-			m_apNumber[nCnt] = nullptr;
-		}
+		// ナンバーの終了処理
+		m_pNumber->Uninit();
+
+		delete m_pNumber;
+		m_pNumber = nullptr;
 	}
 
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CCount::Update(void)
 {
-	// obNobt@TCY̎擾
+	// バックバッファサイズの取得
 	float sw = (float)CManager::GetRenderer()->GetBackBufferWidth();
 	float sh = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
@@ -123,61 +112,27 @@ void CCount::Update(void)
 	float startX = sw * m_layout.anchorX - totalWidth * 0.5f;
 	float startY = sh * m_layout.anchorY - digitH * 0.5f;
 
-	// vZ
-	int nSoundCount = m_nCount;
-	for (int nCnt = 0; nCnt < MAX_DIGITS; nCnt++)
+	// 位置と大きさの更新(変わった時だけ並べ直される)
+	if (m_pNumber)
 	{
-		m_nDig[nCnt] = 0;
-	}
-
-	for (int nCnt = 0; nCnt < digitCount; nCnt++)
-	{
-		int idx = digitCount - 1 - nCnt;
-		m_nDig[idx] = nSoundCount % 10;
-		nSoundCount /= 10;
-	}
-
-	// zu
-	for (int nCnt = 0; nCnt < digitCount; nCnt++)
-	{
-		// ʒu
-		D3DXVECTOR3 pos(startX + nCnt * digitW, startY, 0.0f);
-
-		// ʒu̍XV
-		m_apNumber[nCnt]->SetPos(pos);
-
-		m_apNumber[nCnt]->SetSize(digitW, digitH);
-		m_apNumber[nCnt]->Update();
+		m_pNumber->SetPos(D3DXVECTOR3(startX, startY, 0.0f));
+		m_pNumber->SetSize(digitW, digitH);
+		m_pNumber->Update();
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CCount::Draw(void)
 {
-	for (int nCnt = 0; nCnt < DigitNum(m_nCount); nCnt++)
+	if (m_pNumber)
 	{
-		int digit = m_nDig[nCnt];
-
-		// ̐ݒ
-		m_apNumber[nCnt]->SetDigit(digit);
-
-		// eNX`̎擾
-		CTexture* pTexture = CManager::GetTexture();
-
-		// foCX̎擾
-		CRenderer* renderer = CManager::GetRenderer();
-		LPDIRECT3DDEVICE9 pDevice = renderer->GetDevice();
-
-		// eNX`̐ݒ
-		pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-		// `
-		m_apNumber[nCnt]->Draw();
+		// 描画
+		m_pNumber->Draw();
 	}
 }
 //=============================================================================
-// 
+// 桁分割処理
 //=============================================================================
 int CCount::DigitNum(int nCount)
 {
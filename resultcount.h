@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// 񐔕\ [resultcount.h]
+// 回数表示処理 [resultcount.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,13 +8,13 @@
 #define _RESULTCOUNT_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "number.h"
 
 //*****************************************************************************
-// 񐔕\NX
+// 回数表示クラス
 //*****************************************************************************
 class CCount : public CObject
 {
@@ -22,7 +22,7 @@ public:
 	CCount(int nPriority = 6);
 	~CCount();
 
-	// CAEg\
+	// レイアウト構造体
 	struct Layout
 	{
 		float anchorX;
@@ -43,17 +43,13 @@ public:
 	D3DXVECTOR3 GetPos(void) { return D3DXVECTOR3(); }
 
 private:
-	static const int MAX_DIGITS = 3;		// 
-
-	CNumber*	m_apNumber[MAX_DIGITS];		// e̐\p
-	int			m_nCount;					// 
-	int			m_nDig[MAX_DIGITS];			// \
-	float		m_digitWidth;				// 1̕
-	float		m_digitHeight;				// 1̍
-	D3DXVECTOR3 m_basePos;					// \̊Jnʒu
-	int			m_nIdxTexture;				// eNX`CfbNX
-	Layout		m_layout;					// CAEg\̕ϐ
-	D3DXVECTOR3 m_layoutPos;				// CAEg̈ʒu
+	CNumber*	m_pNumber;					// 数字表示用
+	int			m_nCount;					// 数
+	float		m_digitWidth;				// 数字1桁あたりの幅
+	float		m_digitHeight;				// 数字1桁あたりの高さ
+	D3DXVECTOR3 m_basePos;					// 表示の開始位置
+	Layout		m_layout;					// レイアウト構造体変数
+	D3DXVECTOR3 m_layoutPos;				// レイアウト時の位置
 };
 
 
@@ -1,48 +1,46 @@
 //=============================================================================
 //
-// Ug^C [resulttime.cpp]
+// リザルトタイム処理 [resulttime.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "resulttime.h"
 #include "renderer.h"
 #include "manager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CResultTime::CResultTime(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_apNumber, 0, sizeof(m_apNumber));	// e̐\p
-	m_nMinutes		= 0;						// 
-	m_nSeconds		= 0;						// b
-	m_nFrameCount	= 0;						// t[JEg
-	m_digitWidth	= 0.0f;						// 1̕
-	m_digitHeight	= 0.0f;						// 1̍
-	m_basePos		= INIT_VEC3;				// \̊Jnʒu
-	m_pColon		= nullptr;					// R
-	m_nIdxTexture	= NULL;						// eNX`CfbNX
+	// 値のクリア
+	m_pNumber		= nullptr;					// 数字表示用
+	m_nMinutes		= 0;						// 分
+	m_nSeconds		= 0;						// 秒
+	m_nFrameCount	= 0;						// フレームカウント
+	m_digitWidth	= 0.0f;						// 数字1桁あたりの幅
+	m_digitHeight	= 0.0f;						// 数字1桁あたりの高さ
+	m_basePos		= INIT_VEC3;				// 表示の開始位置
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CResultTime::~CResultTime()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CResultTime* CResultTime::Create(int minutes, int seconds, float baseX, float baseY, float digitWidth, float digitHeight)
 {
 	CResultTime* pTime = new CResultTime;
 
-	// nullptr
+	// nullptrだったら
 	if (pTime == nullptr)
 	{
 		return nullptr;
@@ -55,7 +53,7 @@ CResultTime* CResultTime::Create(int minutes, int seconds, float baseX, float ba
 	pTime->m_digitWidth = digitWidth;
 	pTime->m_digitHeight = digitHeight;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pTime->Init()))
 	{
 		return nullptr;
@@ -64,112 +62,58 @@ CResultTime* CResultTime::Create(int minutes, int seconds, float baseX, float ba
 	return pTime;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CResultTime::Init(void)
 {
-	// ̐i0,1j
-	for (int nCnt = 0; nCnt < 2; nCnt++)
-	{
-		float posX = m_basePos.x + nCnt * m_digitWidth;
-		float posY = m_basePos.y;
-
-		// io[̐
-		m_apNumber[nCnt] = CNumber::Create(posX, posY, m_digitWidth, m_digitHeight);
-
-		if (!m_apNumber[nCnt])
-		{
-			return E_FAIL;
-		}
-	}
+	// 分と秒をコロンで区切って1つのナンバーで並べる
+	m_pNumber = CNumber::Create(m_basePos.x, m_basePos.y, m_digitWidth, m_digitHeight);
 
-	// R̐
-	CColon::Create(D3DXVECTOR3(m_basePos.x + 2 * m_digitWidth, m_basePos.y, 0.0f), m_digitWidth / 2, m_digitHeight, true);
-
-	// R̕
-	float colonWidth = m_digitWidth / 2;
-
-	// b̐̓R̕Eɂ炷
-	for (int nCnt = 2; nCnt < DIGITS; nCnt++)
+	if (!m_pNumber)
 	{
-		float posX = m_basePos.x + colonWidth + nCnt * m_digitWidth;
-		float posY = m_basePos.y;
-
-		m_apNumber[nCnt] = CNumber::Create(posX, posY, m_digitWidth, m_digitHeight);
-
-		if (!m_apNumber[nCnt])
-		{
-			return E_FAIL;
-		}
+		return E_FAIL;
 	}
 
-	// eNX`蓖
-	CTexture* pTexture = CManager::GetTexture();
-	m_nIdxTexture = pTexture->RegisterDynamic("data/TEXTURE/num_01.png");
+	m_pNumber->SetTime(m_nMinutes, m_nSeconds);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CResultTime::Uninit(void)
 {
-	for (int nCnt = 0; nCnt < DIGITS; nCnt++)
+	if (m_pNumber != nullptr)
 	{
-		if (m_apNumber[nCnt] != nullptr)
-		{
-			// io[̏I
-			m_apNumber[nCnt]->Uninit();
+		// ナンバーの終了処理
+		m_pNumber->Uninit();
 
-			delete m_apNumber[nCnt];
-			m_apNumber[nCnt] = nullptr;
-		}
+		delete m_pNumber;
+		m_pNumber = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CResultTime::Update(void)
 {
-	// e̕\lvZ
-	int min10 = m_nMinutes / 10;
-	int min1 = m_nMinutes % 10;
-	int sec10 = m_nSeconds / 10;
-	int sec1 = m_nSeconds % 10;
-
-	// io[IuWFNgɔf
-	if (m_apNumber[0]) m_apNumber[0]->SetDigit(min10);
-	if (m_apNumber[1]) m_apNumber[1]->SetDigit(min1);
-	if (m_apNumber[2]) m_apNumber[2]->SetDigit(sec10);
-	if (m_apNumber[3]) m_apNumber[3]->SetDigit(sec1);
-
-	for (int nCnt = 0; nCnt < DIGITS; nCnt++)
+	// 表示する時間を反映(変わった時だけ並べ直される)
+	if (m_pNumber)
 	{
-		m_apNumber[nCnt]->Update();  // UVXV
+		m_pNumber->SetTime(m_nMinutes, m_nSeconds);
+		m_pNumber->Update();
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CResultTime::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	for (int nCnt = 0; nCnt < DIGITS; nCnt++)
+	if (m_pNumber)
 	{
-		if (m_apNumber[nCnt])
-		{
-			// eNX`̐ݒ
-			pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-			m_apNumber[nCnt]->Draw();
-		}
+		m_pNumber->Draw();
 	}
 }
@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// Ug^C [resulttime.h]
+// リザルトタイム処理 [resulttime.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _RESULTTIME_H_// ̃}N`ĂȂ
-#define _RESULTTIME_H_// 2dCN[hh~̃}N`
+#ifndef _RESULTTIME_H_// このマクロ定義がされていなかったら
+#define _RESULTTIME_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "number.h"
@@ -16,7 +16,7 @@
 
 
 //*****************************************************************************
-// Ug^CNX
+// リザルトタイムクラス
 //*****************************************************************************
 class CResultTime : public CObject
 {
@@ -36,17 +36,13 @@ public:
 	int GetnSeconds(void) { return m_nSeconds; }
 
 private:
-	static constexpr int DIGITS = 4;// (2,b2)
-
-	CNumber*	m_apNumber[DIGITS];
-	int			m_nMinutes;			// 
-	int			m_nSeconds;			// b
-	int			m_nFrameCount;		// t[JEg
-	float		m_digitWidth;		// 1̕
-	float		m_digitHeight;		// 1̍
-	D3DXVECTOR3 m_basePos;			// \̊Jnʒu
-	CColon*		m_pColon;			// Rւ̃|C^
-	int			m_nIdxTexture;		// eNX`CfbNX
+	CNumber*	m_pNumber;			// ナンバーへのポインタ(mm:ss)
+	int			m_nMinutes;			// 分
+	int			m_nSeconds;			// 秒
+	int			m_nFrameCount;		// フレームカウント
+	float		m_digitWidth;		// 数字1桁あたりの幅
+	float		m_digitHeight;		// 数字1桁あたりの高さ
+	D3DXVECTOR3 m_basePos;			// 表示の開始位置
 
 };
 
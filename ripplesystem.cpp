@@ -0,0 +1,491 @@
+//=============================================================================
+//
+// 波紋管理処理 [ripplesystem.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "ripplesystem.h"
+#include "renderer.h"
+#include "manager.h"
+#include "algorithm"
+
+//*****************************************************************************
+// 定数定義
+//*****************************************************************************
+namespace
+{
+	// 頂点宣言(x,y : 円周上の向き z : 内周なら1 w : バッチ内の番号)
+	const D3DVERTEXELEMENT9 RING_DECL[] =
+	{
+		{ 0,  0, D3DDECLTYPE_FLOAT4, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_POSITION, 0 },
+		D3DDECL_END()
+	};
+}
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+CRippleSystem::Ripple CRippleSystem::m_aRipple[CRippleSystem::MAX_RIPPLE] = {};
+D3DXVECTOR2 CRippleSystem::m_aDir[CRippleSystem::NUM_DIV + 1] = {};
+int CRippleSystem::m_nNumAlive = 0;
+int CRippleSystem::m_nNumDropped = 0;
+int CRippleSystem::m_nNumDrawCall = 0;
+LPDIRECT3DVERTEXBUFFER9 CRippleSystem::m_pRingBuff = nullptr;
+LPDIRECT3DVERTEXBUFFER9 CRippleSystem::m_pVtxBuff = nullptr;
+LPDIRECT3DINDEXBUFFER9 CRippleSystem::m_pIdxBuff = nullptr;
+LPDIRECT3DVERTEXSHADER9 CRippleSystem::m_pVS = nullptr;
+LPDIRECT3DPIXELSHADER9 CRippleSystem::m_pPS = nullptr;
+LPDIRECT3DVERTEXDECLARATION9 CRippleSystem::m_pDecl = nullptr;
+
+//=============================================================================
+// 初期化処理
+//=============================================================================
+HRESULT CRippleSystem::Init(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	// 円周上の向き(毎フレーム三角関数を使わないように最初に求めておく)
+	for (int nCnt = 0; nCnt <= NUM_DIV; nCnt++)
+	{
+		float fAngle = (D3DX_PI * 2.0f) / NUM_DIV * nCnt;
+		m_aDir[nCnt] = D3DXVECTOR2(sinf(fAngle), cosf(fAngle));
+	}
+
+	// インデックスバッファの生成(輪をバッチの数だけ並べる。中身は変わらない)
+	if (FAILED(pDevice->CreateIndexBuffer(sizeof(WORD) * RING_INDEX * BATCH_RIPPLE,
+		D3DUSAGE_WRITEONLY,
+		D3DFMT_INDEX16,
+		D3DPOOL_MANAGED,
+		&m_pIdxBuff,
+		NULL)))
+	{
+		return E_FAIL;
+	}
+
+	WORD* pIdx = nullptr;
+
+	if (SUCCEEDED(m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0)))
+	{
+		for (int nCntRing = 0; nCntRing < BATCH_RIPPLE; nCntRing++)
+		{
+			for (int nCnt = 0; nCnt < NUM_DIV; nCnt++)
+			{
+				WORD nOuter = (WORD)(nCntRing * RING_VERTEX + nCnt * 2);
+
+				// 外周・内周・次の外周 / 次の外周・内周・次の内周
+				pIdx[0] = nOuter;
+				pIdx[1] = nOuter + 1;
+				pIdx[2] = nOuter + 2;
+				pIdx[3] = nOuter + 2;
+				pIdx[4] = nOuter + 1;
+				pIdx[5] = nOuter + 3;
+				pIdx += 6;
+			}
+		}
+
+		m_pIdxBuff->Unlock();
+	}
+
+	// シェーダーが使えない環境では毎フレーム頂点を書いてまとめて描く
+	if (!CreateShader())
+	{
+		ReleaseShader();
+	}
+
+	m_nNumAlive = 0;
+	m_nNumDropped = 0;
+
+	// 書き込み用の頂点バッファの生成(シェーダーが使えない時だけ)
+	RestoreDevice();
+
+	return S_OK;
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CRippleSystem::Uninit(void)
+{
+	// 波紋の破棄
+	Clear();
+
+	// 書き込み用の頂点バッファの破棄
+	InvalidateDevice();
+
+	// シェーダーと共通の輪の破棄
+	ReleaseShader();
+
+	// インデックスバッファの破棄
+	if (m_pIdxBuff != nullptr)
+	{
+		m_pIdxBuff->Release();
+		m_pIdxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット前の破棄処理(書き込み用の頂点バッファはD3DPOOL_DEFAULTなので作り直す)
+//=============================================================================
+void CRippleSystem::InvalidateDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		m_pVtxBuff->Release();
+		m_pVtxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット後の生成処理
+//=============================================================================
+void CRippleSystem::RestoreDevice(void)
+{
+	if (m_pVtxBuff != nullptr || IsShader())
+	{
+		return;
+	}
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * RING_VERTEX * BATCH_RIPPLE,
+		D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY,
+		FVF_VERTEX_3D,
+		D3DPOOL_DEFAULT,
+		&m_pVtxBuff,
+		NULL);
+}
+//=============================================================================
+// シェーダーと共通の輪の生成処理
+//=============================================================================
+bool CRippleSystem::CreateShader(void)
+{
+	CRenderer* pRenderer = CManager::GetRenderer();
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = pRenderer->GetDevice();
+
+	// 頂点・ピクセルシェーダー3.0が必要
+	D3DCAPS9 caps;
+	pDevice->GetDeviceCaps(&caps);
+
+	if (caps.VertexShaderVersion < D3DVS_VERSION(3, 0) || caps.PixelShaderVersion < D3DPS_VERSION(3, 0))
+	{
+		return false;
+	}
+
+	// シェーダーのコンパイル
+	if (FAILED(pRenderer->CompileVertexShader("data/Shader/RippleVS.hlsl", "VSMain", &m_pVS, nullptr)) ||
+		FAILED(pRenderer->CompilePixelShader("data/Shader/RipplePS.hlsl", "PSMain", &m_pPS, nullptr)))
+	{
+		return false;
+	}
+
+	// 頂点宣言の生成
+	if (FAILED(pDevice->CreateVertexDeclaration(RING_DECL, &m_pDecl)))
+	{
+		return false;
+	}
+
+	// 共通の輪の頂点バッファの生成
+	if (FAILED(pDevice->CreateVertexBuffer(sizeof(D3DXVECTOR4) * RING_VERTEX * BATCH_RIPPLE,
+		D3DUSAGE_WRITEONLY,
+		0,
+		D3DPOOL_MANAGED,
+		&m_pRingBuff,
+		NULL)))
+	{
+		return false;
+	}
+
+	D3DXVECTOR4* pVtx = nullptr;
+
+	if (FAILED(m_pRingBuff->Lock(0, 0, (void**)&pVtx, 0)))
+	{
+		return false;
+	}
+
+	// 半径1の輪をバッチの数だけ並べる(位置と大きさは描画時に定数で渡す)
+	for (int nCntRing = 0; nCntRing < BATCH_RIPPLE; nCntRing++)
+	{
+		for (int nCnt = 0; nCnt <= NUM_DIV; nCnt++)
+		{
+			pVtx[0] = D3DXVECTOR4(m_aDir[nCnt].x, m_aDir[nCnt].y, 0.0f, (float)nCntRing);
+			pVtx[1] = D3DXVECTOR4(m_aDir[nCnt].x, m_aDir[nCnt].y, 1.0f, (float)nCntRing);
+			pVtx += 2;
+		}
+	}
+
+	m_pRingBuff->Unlock();
+
+	return true;
+}
+//=============================================================================
+// シェーダーと共通の輪の破棄処理
+//=============================================================================
+void CRippleSystem::ReleaseShader(void)
+{
+	if (m_pRingBuff != nullptr)
+	{
+		m_pRingBuff->Release();
+		m_pRingBuff = nullptr;
+	}
+
+	if (m_pDecl != nullptr)
+	{
+		m_pDecl->Release();
+		m_pDecl = nullptr;
+	}
+
+	if (m_pVS != nullptr)
+	{
+		m_pVS->Release();
+		m_pVS = nullptr;
+	}
+
+	if (m_pPS != nullptr)
+	{
+		m_pPS->Release();
+		m_pPS = nullptr;
+	}
+}
+//=============================================================================
+// 波紋の追加処理
+//=============================================================================
+bool CRippleSystem::Emit(const D3DXVECTOR3& pos, const D3DXCOLOR& col, float fRadius, float fLineweight, float fIncRadius,
+	int nLife, float fDecAlpha)
+{
+	// 一杯なら出さない
+	if (m_nNumAlive >= MAX_RIPPLE)
+	{
+		m_nNumDropped++;
+		return false;
+	}
+
+	Ripple& ripple = m_aRipple[m_nNumAlive];
+
+	ripple.pos = pos;
+	ripple.col = col;
+	ripple.fRadius = fRadius;
+	ripple.fLineweight = fLineweight;
+	ripple.fIncRadius = fIncRadius;
+	ripple.fDecAlpha = fDecAlpha;
+	ripple.nLife = nLife;
+
+	m_nNumAlive++;
+
+	return true;
+}
+//=============================================================================
+// 更新処理
+//=============================================================================
+void CRippleSystem::Update(void)
+{
+	int nCnt = 0;
+
+	while (nCnt < m_nNumAlive)
+	{
+		Ripple& ripple = m_aRipple[nCnt];
+
+		ripple.col.a -= ripple.fDecAlpha;// アルファ値を徐々に下げる
+		ripple.nLife--;
+
+		// 寿命が尽きたら最後の波紋を詰める
+		if (ripple.nLife <= 0)
+		{
+			m_nNumAlive--;
+			ripple = m_aRipple[m_nNumAlive];
+			continue;
+		}
+
+		// 半径を徐々に広げる
+		ripple.fRadius += ripple.fIncRadius;
+
+		nCnt++;
+	}
+
+	// 更新したエフェクト数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_EFFECT, m_nNumAlive);
+}
+//=============================================================================
+// 描画処理(バッチの数ずつ1回で描く)
+//=============================================================================
+void CRippleSystem::Draw(void)
+{
+	m_nNumDrawCall = 0;
+
+	if (m_nNumAlive == 0 || m_pIdxBuff == nullptr || (!IsShader() && m_pVtxBuff == nullptr))
+	{
+		return;
+	}
+
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// カリング設定を無効化
+	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
+
+	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);         // ライトを無効にする
+
+	// αブレンディングを加算合成に設定
+	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_ONE);
+
+	// αテストを有効
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, TRUE);
+	pDevice->SetRenderState(D3DRS_ALPHAREF, 0);
+	pDevice->SetRenderState(D3DRS_ALPHAFUNC, D3DCMP_GREATER);//0より大きかったら描画
+
+	// テクスチャは使わない
+	pDevice->SetTexture(0, nullptr);
+	pDevice->SetIndices(m_pIdxBuff);
+
+	if (IsShader())
+	{
+		// c0～c3:ビュー×プロジェクション(シェーダーは列優先なので転置する)
+		float afConst[VS_COUNT * 4] = {};
+
+		D3DXMATRIX mtxView, mtxProj, mtxViewProj;
+		pDevice->GetTransform(D3DTS_VIEW, &mtxView);
+		pDevice->GetTransform(D3DTS_PROJECTION, &mtxProj);
+		mtxViewProj = mtxView * mtxProj;
+		D3DXMatrixTranspose((D3DXMATRIX*)afConst, &mtxViewProj);
+
+		pDevice->SetVertexDeclaration(m_pDecl);
+		pDevice->SetVertexShader(m_pVS);
+		pDevice->SetPixelShader(m_pPS);
+		pDevice->SetStreamSource(0, m_pRingBuff, 0, sizeof(D3DXVECTOR4));
+
+		for (int nStart = 0; nStart < m_nNumAlive; nStart += BATCH_RIPPLE)
+		{
+			int nNum = std::min(BATCH_RIPPLE, m_nNumAlive - nStart);
+
+			// c4～:波紋ごとに(中心・外径) (内径) (色)
+			float* pConst = afConst + 16;
+
+			for (int nCnt = 0; nCnt < nNum; nCnt++)
+			{
+				const Ripple& ripple = m_aRipple[nStart + nCnt];
+
+				pConst[0] = ripple.pos.x;
+				pConst[1] = ripple.pos.y;
+				pConst[2] = ripple.pos.z;
+				pConst[3] = ripple.fRadius;
+				pConst[4] = ripple.fRadius - ripple.fLineweight;
+				pConst[8] = ripple.col.r;
+				pConst[9] = ripple.col.g;
+				pConst[10] = ripple.col.b;
+				pConst[11] = GetAlpha(ripple);
+				pConst += RIPPLE_REGISTER * 4;
+			}
+
+			pDevice->SetVertexShaderConstantF(VS_REGISTER, afConst, 4 + nNum * RIPPLE_REGISTER);
+
+			// ポリゴンの描画
+			pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, nNum * RING_VERTEX, 0, nNum * NUM_DIV * 2);
+			m_nNumDrawCall++;
+		}
+
+		// 設定を戻す
+		pDevice->SetVertexShader(nullptr);
+		pDevice->SetPixelShader(nullptr);
+	}
+	else
+	{
+		// 頂点はワールド座標で書くのでワールドマトリックスは単位行列
+		D3DXMATRIX mtxWorld;
+		D3DXMatrixIdentity(&mtxWorld);
+		pDevice->SetTransform(D3DTS_WORLD, &mtxWorld);
+
+		pDevice->SetFVF(FVF_VERTEX_3D);
+		pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_3D));
+
+		for (int nStart = 0; nStart < m_nNumAlive; nStart += BATCH_RIPPLE)
+		{
+			int nNum = std::min(BATCH_RIPPLE, m_nNumAlive - nStart);
+
+			VERTEX_3D* pVtx = nullptr;
+
+			if (FAILED(pDevice->LockVertexBuffer(m_pVtxBuff, 0, sizeof(VERTEX_3D) * RING_VERTEX * nNum, (void**)&pVtx, D3DLOCK_DISCARD)))
+			{
+				break;
+			}
+
+			WriteRings(nStart, nNum, pVtx);
+
+			pDevice->UnlockVertexBuffer(m_pVtxBuff);
+
+			// ポリゴンの描画
+			pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, nNum * RING_VERTEX, 0, nNum * NUM_DIV * 2);
+			m_nNumDrawCall++;
+		}
+	}
+
+	// αテストを無効に戻す
+	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);
+
+	// カリング設定を有効化
+	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
+
+	// αブレンディングを元に戻す
+	pDevice->SetRenderState(D3DRS_BLENDOP, D3DBLENDOP_ADD);
+	pDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_SRCALPHA);
+	pDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA);
+
+	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);          // ライトを有効にする
+}
+//=============================================================================
+// 全ての波紋の破棄処理(シーンの切り替え時)
+//=============================================================================
+void CRippleSystem::Clear(void)
+{
+	m_nNumAlive = 0;
+	m_nNumDropped = 0;
+}
+//=============================================================================
+// 外周のアルファ値の取得処理(内周は0)
+//=============================================================================
+float CRippleSystem::GetAlpha(const Ripple& ripple)
+{
+	float fAlpha = ripple.col.a * (float)ripple.nLife / FADE_LIFE;
+
+	return std::max(0.0f, std::min(1.0f, fAlpha));
+}
+//=============================================================================
+// 輪の頂点の書き込み処理(シェーダーが使えない時)
+//=============================================================================
+int CRippleSystem::WriteRings(int nStart, int nNum, VERTEX_3D* pVtx)
+{
+	for (int nCntRing = 0; nCntRing < nNum; nCntRing++)
+	{
+		const Ripple& ripple = m_aRipple[nStart + nCntRing];
+
+		float fOuter = ripple.fRadius;
+		float fInner = ripple.fRadius - ripple.fLineweight;
+
+		D3DXCOLOR colOuter(ripple.col.r, ripple.col.g, ripple.col.b, GetAlpha(ripple));
+		D3DXCOLOR colInner(ripple.col.r, ripple.col.g, ripple.col.b, 0.0f);
+
+		for (int nCnt = 0; nCnt <= NUM_DIV; nCnt++)
+		{
+			const D3DXVECTOR2& dir = m_aDir[nCnt];
+
+			pVtx[0].pos = D3DXVECTOR3(ripple.pos.x + dir.x * fOuter, ripple.pos.y, ripple.pos.z + dir.y * fOuter);
+			pVtx[0].nor = D3DXVECTOR3(dir.x, 0.0f, dir.y);
+			pVtx[0].col = colOuter;
+			pVtx[0].tex = D3DXVECTOR2(0.0f, (float)nCnt);
+
+			pVtx[1].pos = D3DXVECTOR3(ripple.pos.x + dir.x * fInner, ripple.pos.y, ripple.pos.z + dir.y * fInner);
+			pVtx[1].nor = D3DXVECTOR3(dir.x, 0.0f, dir.y);
+			pVtx[1].col = colInner;
+			pVtx[1].tex = D3DXVECTOR2(1.0f, (float)nCnt);
+
+			pVtx += 2;
+		}
+	}
+
+	return nNum;
+}
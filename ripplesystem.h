@@ -0,0 +1,81 @@
+//=============================================================================
+//
+// 波紋管理処理 [ripplesystem.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _RIPPLESYSTEM_H_// このマクロ定義がされていなかったら
+#define _RIPPLESYSTEM_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// 波紋管理クラス(決まった数の波紋を持ち、共通の輪の頂点をシェーダー定数で広げて1回で描く)
+//*****************************************************************************
+class CRippleSystem
+{
+public:
+	static constexpr int PRIORITY = 5;	// 描画の優先順位(エフェクトと同じ。この優先順位の最後にまとめて描く)
+
+	static HRESULT Init(void);
+	static void Uninit(void);
+	static void InvalidateDevice(void);
+	static void RestoreDevice(void);
+	static bool Emit(const D3DXVECTOR3& pos, const D3DXCOLOR& col, float fRadius, float fLineweight, float fIncRadius,
+		int nLife, float fDecAlpha);
+	static void Update(void);
+	static void Draw(void);
+	static void Clear(void);
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	static bool IsShader(void) { return m_pVS != nullptr && m_pPS != nullptr && m_pDecl != nullptr && m_pRingBuff != nullptr; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static int GetNumAlive(void) { return m_nNumAlive; }
+	static int GetNumDropped(void) { return m_nNumDropped; }
+	static int GetNumDrawCall(void) { return m_nNumDrawCall; }
+
+private:
+	static constexpr int	MAX_RIPPLE		= 128;						// 同時に出せる波紋の数
+	static constexpr int	NUM_DIV			= 20;						// 円周の分割数
+	static constexpr int	RING_VERTEX		= (NUM_DIV + 1) * 2;		// 1つの輪の頂点数(外周と内周)
+	static constexpr int	RING_INDEX		= NUM_DIV * 6;				// 1つの輪のインデックス数
+	static constexpr int	BATCH_RIPPLE	= 64;						// 1回の描画で描く波紋の数(定数レジスタに収める)
+	static constexpr float	FADE_LIFE		= 50.0f;					// 残り寿命をこの値で割って薄くする
+	static constexpr UINT	VS_REGISTER		= 0;						// 頂点シェーダーの定数の先頭(c0～c3:VP c4～:波紋)
+	static constexpr UINT	RIPPLE_REGISTER	= 3;						// 波紋1つの定数の数(中心と外径・内径・色)
+	static constexpr UINT	VS_COUNT		= 4 + BATCH_RIPPLE * RIPPLE_REGISTER;	// 頂点シェーダーの定数の数
+
+	// 波紋
+	typedef struct
+	{
+		D3DXVECTOR3	pos;			// 中心
+		D3DXCOLOR	col;			// 色
+		float		fRadius;		// 半径
+		float		fLineweight;	// 太さ
+		float		fIncRadius;		// 半径の増加量
+		float		fDecAlpha;		// アルファ値の減少量
+		int			nLife;			// 寿命
+	}Ripple;
+
+	static bool CreateShader(void);
+	static void ReleaseShader(void);
+	static float GetAlpha(const Ripple& ripple);
+	static int WriteRings(int nStart, int nNum, VERTEX_3D* pVtx);
+
+	static Ripple							m_aRipple[MAX_RIPPLE];		// 波紋(生きているものを先頭に詰める)
+	static D3DXVECTOR2						m_aDir[NUM_DIV + 1];		// 円周上の向き(sin・cos)
+	static int								m_nNumAlive;				// 生きている波紋の数
+	static int								m_nNumDropped;				// 一杯で出せなかった波紋の数
+	static int								m_nNumDrawCall;				// 前回の描画回数
+	static LPDIRECT3DVERTEXBUFFER9			m_pRingBuff;				// 共通の輪の頂点バッファ(シェーダー用。x,y:円周上の向き z:内周なら1 w:バッチ内の番号)
+	static LPDIRECT3DVERTEXBUFFER9			m_pVtxBuff;					// 書き込み用の動的頂点バッファ(シェーダーが使えない時)
+	static LPDIRECT3DINDEXBUFFER9			m_pIdxBuff;					// 輪のインデックスバッファ(両方で共通)
+	static LPDIRECT3DVERTEXSHADER9			m_pVS;						// 頂点シェーダー
+	static LPDIRECT3DPIXELSHADER9			m_pPS;						// ピクセルシェーダー
+	static LPDIRECT3DVERTEXDECLARATION9		m_pDecl;					// 頂点宣言
+};
+
+#endif
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// V[ [scene.cpp]
+// シーン処理 [scene.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 #include "title.h"
@@ -17,22 +17,22 @@
 #include "movie.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CScene::CScene(MODE mode):CObject(7)
 {
-	// l̃NA
-	m_mode = mode;	// [h
+	// 値のクリア
+	m_mode = mode;	// モード
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CScene::~CScene()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CScene* CScene::Create(MODE mode)
 {
@@ -41,32 +41,32 @@ CScene* CScene::Create(MODE mode)
 	switch (mode)
 	{
 	case MODE_TITLE:
-		// ^Cgʂ̐
+		// タイトル画面の生成
 		pScene = new CTitle();
 		break;
 
 	case MODE_TUTORIAL:
-		// `[gA
+		// チュートリアル画面
 		pScene = new CTutorial();
 		break;
 
 	case MODE_MOVIE:
-		// [r[ʂ̐
+		// ムービー画面の生成
 		pScene = new CMovie;
 		break;
 
 	case MODE_GAME:
-		// Q[ʂ̐
+		// ゲーム画面の生成
 		pScene = new CGame();
 		break;
 
 	case MODE_RESULT:
-		// Ugʂ̐
+		// リザルト画面の生成
 		pScene = new CResult();
 		break;
 
 	case MODE_RANKING:
-		// LOʂ̐
+		// ランキング画面の生成
 		pScene = new CRanking();
 		break;
 
@@ -74,7 +74,7 @@ CScene* CScene::Create(MODE mode)
 		break;
 	}
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pScene->Init()))
 	{
 		return nullptr;
@@ -1,19 +1,19 @@
 //=============================================================================
 //
-// V[ [scene.h]
+// シーン処理 [scene.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _SCENE_H_// ̃}N`ĂȂ
-#define _SCENE_H_// 2dCN[hh~̃}N`
+#ifndef _SCENE_H_// このマクロ定義がされていなかったら
+#define _SCENE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 //*****************************************************************************
-// V[NX
+// シーンクラス
 //*****************************************************************************
 class CScene : public CObject
 {
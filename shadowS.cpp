@@ -1,44 +1,50 @@
 //=============================================================================
 //
-// XeVVhE [shadowS.cpp]
+// ステンシルシャドウ処理 [shadowS.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "shadowS.h"
 #include "renderer.h"
 #include "manager.h"
 
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::vector<CShadowS*>	CShadowS::m_volumes;							// 今回ステンシルで描く影
+std::vector<VERTEX_3D>	CShadowS::m_blobVtx;							// 今回の丸影の頂点
+float					CShadowS::m_fBlobDistance = BLOB_DISTANCE;		// 丸影に切り替えるカメラからの距離
+
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CShadowS::CShadowS(int nPriority) : CObjectX(nPriority)
 {
-	// l̃NA
-	m_pVtxBuff	= nullptr;		// _obt@ւ̃|C^
-	m_pos		= INIT_VEC3;	// ʒu
-	m_col		= INIT_XCOL;	// F
-	m_fWidth	= 0.0f;			// 
-	m_fHeight	= 0.0f;			// 
+	// 値のクリア
+	m_pos = INIT_VEC3;	// 位置
+
+	// ステンシル設定の間で描画するので描画キューには積まない
+	SetUseRenderQueue(false);
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CShadowS::~CShadowS()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CShadowS* CShadowS::Create(const char* pFilepath,D3DXVECTOR3 size)
 {
 	CShadowS* pShadowS = new CShadowS;
 
-	// nullptr
+	// nullptrだったら
 	if (pShadowS == nullptr)
 	{
 		return nullptr;
@@ -47,7 +53,7 @@ CShadowS* CShadowS::Create(const char* pFilepath,D3DXVECTOR3 size)
 	pShadowS->SetPath(pFilepath);
 	pShadowS->SetSize(size);
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pShadowS->Init()))
 	{
 		return nullptr;
@@ -56,165 +62,242 @@ CShadowS* CShadowS::Create(const char* pFilepath,D3DXVECTOR3 size)
 	return pShadowS;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CShadowS::Init(void)
 {
-	// Xt@CIuWFNg̏
+	// Xファイルオブジェクトの初期化処理
 	CObjectX::Init();
 
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	// 
+	// 初期化
 	m_pos = D3DXVECTOR3(0.0f, 0.0f, 0.0f);
-	m_fWidth = 1920.0f;
-	m_fHeight = 1080.0f;
-
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(m_pos.x, m_pos.y, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(m_pos.x, m_pos.y + m_fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y + m_fHeight, 0.0f);
-
-	// rhw̐ݒ
-	pVtx[0].rhw = 1.0f;
-	pVtx[1].rhw = 1.0f;
-	pVtx[2].rhw = 1.0f;
-	pVtx[3].rhw = 1.0f;
-
-	// _J[̐ݒ
-	pVtx[0].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
-	pVtx[1].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
-	pVtx[2].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
-	pVtx[3].col = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.5f);
-
-	// eNX`W̐ݒ
-	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
-	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
-	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
-	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CShadowS::Uninit(void)
 {
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
-
-	// Xt@CIuWFNg̔j
+	// Xファイルオブジェクトの破棄
 	CObjectX::Uninit();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CShadowS::Update(void)
 {
-	// Xt@CIuWFNg̍XV
+	// Xファイルオブジェクトの更新処理
 	CObjectX::Update();
 
-	// ʒu̐ݒ
+	// 位置の設定
 	SetPos(m_pos);
 }
 //=============================================================================
-// `揈
+// 描画処理(ここでは登録だけ行い、DrawBatchでまとめて描く)
 //=============================================================================
 void CShadowS::Draw(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	// 影の体積が画面外ならステンシルに何も書かれないので丸ごと省く
+	if (!IsInView())
+	{
+		return;
+	}
+
+	// カメラの取得
+	CCamera* pCamera = CManager::GetCamera();
+
+	// 遠くのキャラクターは丸影で済ませる
+	if (pCamera != nullptr)
+	{
+		D3DXVECTOR3 diff = GetPos() - pCamera->GetPosV();
 
-	// XeVeXgLɂ
+		if (D3DXVec3LengthSq(&diff) > m_fBlobDistance * m_fBlobDistance)
+		{
+			AddBlob();
+			return;
+		}
+	}
+
+	m_volumes.push_back(this);
+}
+//=============================================================================
+// まとめて描画する処理(全ての影の体積をステンシルに書いてから画面を1回だけ塗る)
+//=============================================================================
+void CShadowS::DrawBatch(void)
+{
+	// 影の数の計測
+	CTelemetry::Add(CTelemetry::COUNTER_SHADOW_VOLUME, (int)m_volumes.size());
+	CTelemetry::Add(CTelemetry::COUNTER_SHADOW_BLOB, (int)m_blobVtx.size() / (BLOB_SEGMENT * 3));
+
+	if (!m_volumes.empty())
+	{
+		DrawVolumes();
+	}
+
+	if (!m_blobVtx.empty())
+	{
+		DrawBlobs();
+	}
+
+	// 容量は残したまま空にする
+	m_volumes.clear();
+	m_blobVtx.clear();
+}
+//=============================================================================
+// 影の体積の描画処理
+//=============================================================================
+void CShadowS::DrawVolumes(void)
+{
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// ステンシルテストを有効にする
 	pDevice->SetRenderState(D3DRS_STENCILENABLE, TRUE);
 
-	// Zobt@ւ݂̏𖳌ɂ
+	// Zバッファへの書き込みを無効にする
 	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, FALSE);
 
-	// J[obt@ւ݂̏𖳌ɂ
+	// カラーバッファへの書き込みを無効にする
 	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE, 0x00000000);
 
-	// XeVobt@̔rp[^ݒ
+	// ステンシルバッファの比較パラメータを設定
 	pDevice->SetRenderState(D3DRS_STENCILFUNC, D3DCMP_ALWAYS);
-	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_KEEP);	// XeVeXg : i / ZeXg : i
-
-	// \ʂJO
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CW);
+	pDevice->SetRenderState(D3DRS_STENCILZFAIL, D3DSTENCILOP_KEEP);	// ステンシルテスト : 合格 / Zテスト : 不合格
+	pDevice->SetRenderState(D3DRS_STENCILFAIL, D3DSTENCILOP_KEEP);	// ステンシルテスト : 不合格
 
-	// XIuWFNg̕`揈
-	CObjectX::Draw();
-
-	// XeVobt@̎Qƒlݒ(1ɂ)
-	pDevice->SetRenderState(D3DRS_STENCILREF, m_stencilRef);
+	// 表面を描いて加算する
+	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_INCR);	// ステンシルテスト : 合格 / Zテスト : 合格
+	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
 
-	// XeVobt@̔rp[^ݒ
-	pDevice->SetRenderState(D3DRS_STENCILFUNC, D3DCMP_EQUAL);
-	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_INCRSAT);	// XeVeXg : i / ZeXg : i
-	pDevice->SetRenderState(D3DRS_STENCILZFAIL, D3DSTENCILOP_KEEP);		// XeVeXg : i / ZeXg : si
-	pDevice->SetRenderState(D3DRS_STENCILFAIL, D3DSTENCILOP_INCRSAT);	// XeVeXg : si
+	for (CShadowS* pShadow : m_volumes)
+	{
+		pShadow->DrawImmediate();
+	}
 
-	// ʂJO
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
+	// 裏面を描いて減算する(体積の中にある地面だけ0以外が残る)
+	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_DECR);	// ステンシルテスト : 合格 / Zテスト : 合格
+	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CW);
 
-	// XIuWFNg̕`揈
-	CObjectX::Draw();
+	for (CShadowS* pShadow : m_volumes)
+	{
+		pShadow->DrawImmediate();
+	}
 
-	// J[obt@ւ݂̏Lɂ
+	// カラーバッファへの書き込みを有効にする
 	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE, 0x0000000F);
 
-	// XeVobt@̎Qƒlݒ(2ɂ)
-	pDevice->SetRenderState(D3DRS_STENCILREF, m_stencilRef + 1);
+	// 0以外のところを塗り、塗ったところは0に戻す(影が重なっても濃くならない)
+	pDevice->SetRenderState(D3DRS_STENCILREF, 0);
+	pDevice->SetRenderState(D3DRS_STENCILFUNC, D3DCMP_NOTEQUAL);
+	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_ZERO);	// ステンシルテスト : 合格 / Zテスト : 合格
+	pDevice->SetRenderState(D3DRS_STENCILZFAIL, D3DSTENCILOP_ZERO);	// ステンシルテスト : 合格 / Zテスト : 不合格
+	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
 
-	// XeVobt@̔rp[^ݒ
-	pDevice->SetRenderState(D3DRS_STENCILFUNC, D3DCMP_EQUAL);
-	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_KEEP);	// XeVeXg : i / ZeXg : i
-	pDevice->SetRenderState(D3DRS_STENCILZFAIL, D3DSTENCILOP_INCRSAT);	// XeVeXg : i / ZeXg : si
-	pDevice->SetRenderState(D3DRS_STENCILFAIL, D3DSTENCILOP_INCRSAT);	// XeVeXg : si
+	// 画面全体の黒いポリゴン
+	D3DCOLOR col = D3DXCOLOR(0.0f, 0.0f, 0.0f, SHADOW_ALPHA);
 
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
+	VERTEX_2D aVtx[4] =
+	{
+		{ D3DXVECTOR3(0.0f,					0.0f,					0.0f), 1.0f, col, D3DXVECTOR2(0.0f, 0.0f) },
+		{ D3DXVECTOR3((float)SCREEN_WIDTH,	0.0f,					0.0f), 1.0f, col, D3DXVECTOR2(1.0f, 0.0f) },
+		{ D3DXVECTOR3(0.0f,					(float)SCREEN_HEIGHT,	0.0f), 1.0f, col, D3DXVECTOR2(0.0f, 1.0f) },
+		{ D3DXVECTOR3((float)SCREEN_WIDTH,	(float)SCREEN_HEIGHT,	0.0f), 1.0f, col, D3DXVECTOR2(1.0f, 1.0f) },
+	};
 
-	// _tH[}bg̐ݒ
+	// 頂点フォーマットの設定
 	pDevice->SetFVF(FVF_VERTEX_2D);
 
-	// |S̕`
-	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
+	// テクスチャの設定
+	pDevice->SetTexture(0, nullptr);
+
+	// 黒いポリゴンの描画(全ての影で1回だけ)
+	pDevice->DrawPrimitiveUP(D3DPT_TRIANGLESTRIP, 2, aVtx, sizeof(VERTEX_2D));
 
 	//*****************************************************************************
-	// Ԃɖ߂
+	// 状態を元に戻す
 	//*****************************************************************************
 
-	// XeVeXg𖳌ɂ
+	// ステンシルテストを無効にする
 	pDevice->SetRenderState(D3DRS_STENCILENABLE, FALSE);
+	pDevice->SetRenderState(D3DRS_STENCILFUNC, D3DCMP_ALWAYS);
+	pDevice->SetRenderState(D3DRS_STENCILPASS, D3DSTENCILOP_KEEP);
+	pDevice->SetRenderState(D3DRS_STENCILZFAIL, D3DSTENCILOP_KEEP);
 
-	// Zobt@ւ݂̏Lɂ
+	// Zバッファへの書き込みを有効にする
 	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);
+}
+//=============================================================================
+// 丸影の頂点の追加処理(足元に中心が濃く外側が透明な円を置く)
+//=============================================================================
+void CShadowS::AddBlob(void)
+{
+	// 影の体積の大きさから半径を決める
+	float fRadius = GetModelSize().x * GetSize().x * 0.5f;
 
-	// J[obt@ւ݂̏Lɂ
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE, 0x0000000F);
+	if (fRadius <= 0.0f)
+	{
+		return;
+	}
 
-	// JOݒL
-	pDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_CCW);
+	D3DXVECTOR3 center = GetPos();
+	center.y += BLOB_OFFSET_Y;
+
+	D3DCOLOR colCenter = D3DXCOLOR(0.0f, 0.0f, 0.0f, SHADOW_ALPHA);
+	D3DCOLOR colEdge = D3DXCOLOR(0.0f, 0.0f, 0.0f, 0.0f);
+
+	VERTEX_3D vtx;
+	vtx.nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
+	vtx.tex = D3DXVECTOR2(0.0f, 0.0f);
+
+	for (int nCnt = 0; nCnt < BLOB_SEGMENT; nCnt++)
+	{
+		float fAngle0 = D3DX_PI * 2.0f * (float)nCnt / (float)BLOB_SEGMENT;
+		float fAngle1 = D3DX_PI * 2.0f * (float)(nCnt + 1) / (float)BLOB_SEGMENT;
+
+		// 上から見て時計回り(中心 → 現在の角度 → 次の角度)
+		vtx.pos = center;
+		vtx.col = colCenter;
+		m_blobVtx.push_back(vtx);
+
+		vtx.pos = center + D3DXVECTOR3(sinf(fAngle0) * fRadius, 0.0f, cosf(fAngle0) * fRadius);
+		vtx.col = colEdge;
+		m_blobVtx.push_back(vtx);
+
+		vtx.pos = center + D3DXVECTOR3(sinf(fAngle1) * fRadius, 0.0f, cosf(fAngle1) * fRadius);
+		vtx.col = colEdge;
+		m_blobVtx.push_back(vtx);
+	}
+}
+//=============================================================================
+// 丸影の描画処理(全ての丸影を1回で描く)
+//=============================================================================
+void CShadowS::DrawBlobs(void)
+{
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	// ワールドマトリックスは単位行列(頂点はワールド座標で作ってある)
+	D3DXMATRIX mtxWorld;
+	D3DXMatrixIdentity(&mtxWorld);
+	pDevice->SetTransform(D3DTS_WORLD, &mtxWorld);
+
+	// ライトを無効にして頂点カラーをそのまま使う
+	pDevice->SetRenderState(D3DRS_LIGHTING, FALSE);
+
+	// Zバッファへの書き込みを無効にする
+	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, FALSE);
+
+	// 頂点フォーマットの設定
+	pDevice->SetFVF(FVF_VERTEX_3D);
+
+	// テクスチャの設定
+	pDevice->SetTexture(0, nullptr);
+
+	// 丸影の描画
+	pDevice->DrawPrimitiveUP(D3DPT_TRIANGLELIST, (UINT)m_blobVtx.size() / 3, m_blobVtx.data(), sizeof(VERTEX_3D));
+
+	// 状態を元に戻す
+	pDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);
+	pDevice->SetRenderState(D3DRS_LIGHTING, TRUE);
 }
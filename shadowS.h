@@ -1,24 +1,26 @@
 //=============================================================================
 //
-// XeVVhE [shadowS.h]
+// ステンシルシャドウ処理 [shadowS.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _SHADOWS_H_// ̃}N`ĂȂ
-#define _SHADOWS_H_// 2dCN[hh~̃}N`
+#ifndef _SHADOWS_H_// このマクロ定義がされていなかったら
+#define _SHADOWS_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "objectX.h"
 
 //*****************************************************************************
-// XeVVhENX
+// ステンシルシャドウクラス(描画時は登録だけ行い、優先順位の最後にまとめて描く)
 //*****************************************************************************
 class CShadowS : public CObjectX
 {
 public:
-	CShadowS(int nPriority = 4);
+	static constexpr int PRIORITY = 4;	// 描画の優先順位(この優先順位の最後にまとめて描く)
+
+	CShadowS(int nPriority = PRIORITY);
 	~CShadowS();
 
 	static CShadowS* Create(const char* pFilepath, D3DXVECTOR3 size);
@@ -26,15 +28,34 @@ public:
 	void Uninit(void);
 	void Update(void);
 	void Draw(void);
+	static void DrawBatch(void);
+
+	//*****************************************************************************
+	// setter関数
+	//*****************************************************************************
 	void SetPosition(D3DXVECTOR3 pos) { m_pos = pos; }
-	void SetStencilRef(DWORD value) { m_stencilRef = value; }
+	static void SetBlobDistance(float fDistance) { m_fBlobDistance = fDistance; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	CCulling::TYPE GetCullType(void) override { return CCulling::TYPE_CHARACTER; }
+	static float GetBlobDistance(void) { return m_fBlobDistance; }
+
 private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@ւ̃|C^
-	D3DXVECTOR3				m_pos;			// 2D|S`pʒu
-	D3DCOLOR				m_col;			// 2D|S`pF
-	float					m_fWidth;		// (ʃTCY2D|Sp)
-	float					m_fHeight;		// (ʃTCY2D|Sp)
-	DWORD					m_stencilRef;	// XeVobt@̒l
+	static constexpr float	BLOB_DISTANCE	= 1500.0f;	// 丸影に切り替えるカメラからの距離の初期値
+	static constexpr int	BLOB_SEGMENT	= 8;		// 丸影の分割数
+	static constexpr float	BLOB_OFFSET_Y	= 1.0f;		// 丸影を地面から浮かせる量(Zファイティング防止)
+	static constexpr float	SHADOW_ALPHA	= 0.5f;		// 影の濃さ
+
+	static void DrawVolumes(void);
+	static void DrawBlobs(void);
+	void AddBlob(void);
+
+	D3DXVECTOR3 m_pos;	// 位置
 
+	static std::vector<CShadowS*>	m_volumes;			// 今回ステンシルで描く影
+	static std::vector<VERTEX_3D>	m_blobVtx;			// 今回の丸影の頂点(三角形リスト)
+	static float					m_fBlobDistance;	// 丸影に切り替えるカメラからの距離
 };
 #endif
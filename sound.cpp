@@ -1,37 +1,48 @@
 //=============================================================================
 //
-// TEh [sound.cpp]
+// サウンド処理 [sound.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "sound.h"
 #include "manager.h"
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CSound::CSound()
 {
-	// l̃NA
+	// 値のクリア
 	m_pXAudio2			= nullptr;
 	m_pMasteringVoice	= nullptr;
-	m_Listener			= {};					// Xi[̈ʒu
+	m_Listener			= {};					// リスナーの位置
 	m_nextInstanceId	= 0;
+	m_nNumDropped		= 0;					// 空きが無くて再生しなかった回数
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CSound::~CSound()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化の失敗の表示処理(ウィンドウを作らない検査では表示しない)
+//=============================================================================
+static void ShowInitError(HWND hWnd, const char* pText, const char* pCaption, UINT uType)
+{
+	if (hWnd != nullptr)
+	{
+		MessageBox(hWnd, pText, pCaption, uType);
+	}
+}
+//=============================================================================
+// 初期化処理
 //=============================================================================
 HRESULT CSound::Init(HWND hWnd)
 {
@@ -42,7 +53,7 @@ HRESULT CSound::Init(HWND hWnd)
 	hr = XAudio2Create(&m_pXAudio2, 0);
 	if (FAILED(hr))
 	{
-		MessageBox(hWnd, "XAudio2IuWFNg̍쐬ɎsI", "xI", MB_ICONWARNING);
+		ShowInitError(hWnd, "XAudio2オブジェクトの作成に失敗！", "警告！", MB_ICONWARNING);
 		CoUninitialize();
 		return hr;
 	}
@@ -51,7 +62,7 @@ HRESULT CSound::Init(HWND hWnd)
 	hr = m_pXAudio2->GetDeviceDetails(0, &deviceDetails);
 	if (FAILED(hr))
 	{
-		MessageBox(hWnd, "foCX̎擾ɎsI", "xI", MB_ICONWARNING);
+		ShowInitError(hWnd, "デバイス情報の取得に失敗！", "警告！", MB_ICONWARNING);
 		m_pXAudio2->Release();
 		m_pXAudio2 = nullptr;
 		CoUninitialize();
@@ -64,7 +75,7 @@ HRESULT CSound::Init(HWND hWnd)
 	hr = m_pXAudio2->CreateMasteringVoice(&m_pMasteringVoice, channels, sampleRate);
 	if (FAILED(hr))
 	{
-		MessageBox(hWnd, "}X^[{CX̐ɎsI", "xI", MB_ICONWARNING);
+		ShowInitError(hWnd, "マスターボイスの生成に失敗！", "警告！", MB_ICONWARNING);
 		m_pXAudio2->Release();
 		m_pXAudio2 = nullptr;
 		CoUninitialize();
@@ -84,8 +95,8 @@ HRESULT CSound::Init(HWND hWnd)
 		if (FAILED(hr))
 		{
 			char msg[128];
-			sprintf_s(msg, "TEh̓ǂݍ݂Ɏs: %s", m_aSoundInfo[nCnt].pFilename);
-			MessageBox(hWnd, msg, "Error", MB_OK);
+			sprintf_s(msg, "サウンドの読み込みに失敗: %s", m_aSoundInfo[nCnt].pFilename);
+			ShowInitError(hWnd, msg, "Error", MB_OK);
 			Uninit();
 			return hr;
 		}
@@ -93,23 +104,20 @@ HRESULT CSound::Init(HWND hWnd)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CSound::Uninit(void)
 {
-	// SĂSoundInstance~Ej
-	for (auto& inst : m_Instances)
+	// 全てのSoundInstanceを停止・破棄
+	for (auto& inst : m_aInstance)
 	{
-		if (inst.pSourceVoice)
+		if (inst.active)
 		{
-			inst.pSourceVoice->Stop(0);
-			inst.pSourceVoice->DestroyVoice();
-			inst.pSourceVoice = nullptr;
+			FreeInstance(inst);
 		}
 	}
-	m_Instances.clear();
 
-	// eTEh̃I[fBIf[^
+	// 各サウンドのオーディオデータ解放
 	for (int nCnt = 0; nCnt < SOUND_LABEL_MAX; ++nCnt)
 	{
 		if (m_SoundData[nCnt].pAudioData)
@@ -119,25 +127,25 @@ void CSound::Uninit(void)
 		}
 	}
 
-	// }X^[{CX̔j
+	// マスターボイスの破棄
 	if (m_pMasteringVoice)
 	{
 		m_pMasteringVoice->DestroyVoice();
 		m_pMasteringVoice = nullptr;
 	}
 
-	// XAudio2IuWFNg̊J
+	// XAudio2オブジェクトの開放
 	if (m_pXAudio2)
 	{
 		m_pXAudio2->Release();
 		m_pXAudio2 = nullptr;
 	}
 
-	// COMCȕI
+	// COMライブラリの終了処理
 	CoUninitialize();
 }
 //=============================================================================
-// 2DZOgĐ(ĐȂ~)
+// 2Dセグメント再生(再生中なら停止)
 //=============================================================================
 int CSound::Play(SOUND_LABEL label)
 {
@@ -146,6 +154,14 @@ int CSound::Play(SOUND_LABEL label)
 		return -1;
 	}
 
+	// 空いているインスタンスを使う(全て使用中なら鳴らさない)
+	SoundInstance* pInst = AllocInstance();
+
+	if (pInst == nullptr)
+	{
+		return -1;
+	}
+
 	SoundInstance inst = {};
 	inst.id = m_nextInstanceId++;
 	inst.label = label;
@@ -161,11 +177,11 @@ int CSound::Play(SOUND_LABEL label)
 	buffer.AudioBytes = m_SoundData[label].audioBytes;
 	buffer.pAudioData = m_SoundData[label].pAudioData;
 	if (m_aSoundInfo[label].loopCount == XAUDIO2_LOOP_INFINITE)
-	{// [v̎
+	{// ループの時
 		buffer.LoopCount = XAUDIO2_LOOP_INFINITE;
 	}
 	else
-	{// [vȂ
+	{// ループじゃない時
 		buffer.LoopCount = m_aSoundInfo[label].loopCount;
 		buffer.Flags = XAUDIO2_END_OF_STREAM;
 	}
@@ -184,12 +200,12 @@ int CSound::Play(SOUND_LABEL label)
 		return -1;
 	}
 
-	m_Instances.push_back(inst);
+	*pInst = inst;
 
 	return inst.id;
 }
 //=============================================================================
-// 3DZOgĐ(ĐȂ~)
+// 3Dセグメント再生(再生中なら停止)
 //=============================================================================
 int CSound::Play3D(SOUND_LABEL label, D3DXVECTOR3 soundPos, float minDistance, float maxDistance)
 {
@@ -198,6 +214,14 @@ int CSound::Play3D(SOUND_LABEL label, D3DXVECTOR3 soundPos, float minDistance, f
 		return -1;
 	}
 
+	// 空いているインスタンスを使う(全て使用中なら鳴らさない)
+	SoundInstance* pInst = AllocInstance();
+
+	if (pInst == nullptr)
+	{
+		return -1;
+	}
+
 	SoundInstance inst = {};
 	inst.id = m_nextInstanceId++;
 	inst.label = label;
@@ -209,13 +233,13 @@ int CSound::Play3D(SOUND_LABEL label, D3DXVECTOR3 soundPos, float minDistance, f
 		return -1;
 	}
 
-	// G~b^[ݒ
+	// エミッター設定
 	inst.emitter.Position = { soundPos.x, soundPos.y, soundPos.z };
 	inst.emitter.Velocity = { 0.0f, 0.0f, 0.0f };
 	inst.emitter.ChannelCount = 1;
 	inst.emitter.CurveDistanceScaler = 150.0f;
 
-	// ͈͂ۑ
+	// 距離範囲を保存
 	inst.minDistance = minDistance;
 	inst.maxDistance = maxDistance;
 
@@ -224,11 +248,11 @@ int CSound::Play3D(SOUND_LABEL label, D3DXVECTOR3 soundPos, float minDistance, f
 	buffer.pAudioData = m_SoundData[label].pAudioData;
 
 	if (m_aSoundInfo[label].loopCount == XAUDIO2_LOOP_INFINITE)
-	{// [v̎
+	{// ループの時
 		buffer.LoopCount = XAUDIO2_LOOP_INFINITE;
 	}
 	else
-	{// [vȂ
+	{// ループじゃない時
 		buffer.LoopCount = m_aSoundInfo[label].loopCount;
 		buffer.Flags = XAUDIO2_END_OF_STREAM;
 	}
@@ -240,11 +264,11 @@ int CSound::Play3D(SOUND_LABEL label, D3DXVECTOR3 soundPos, float minDistance, f
 		return -1;
 	}
 
-	// 3DpjOsvZ
-	FLOAT32 matrix[8] = {}; // K؂ȃTCYio̓`l~̓`lj
+	// 3Dパンニング行列を計算
+	FLOAT32 matrix[8] = {}; // 適切なサイズ（出力チャンネル×入力チャンネル）
 	CalculateCustomPanning(inst, matrix);
 
-	// pjOKpio̓`l4A1j
+	// パンニング適用（出力チャンネル4、入力1）
 	inst.pSourceVoice->SetOutputMatrix(NULL, 1, 4, matrix);
 
 	hr = inst.pSourceVoice->Start(0);
@@ -254,115 +278,172 @@ int CSound::Play3D(SOUND_LABEL label, D3DXVECTOR3 soundPos, float minDistance, f
 		return -1;
 	}
 
-	m_Instances.push_back(inst);
+	*pInst = inst;
 
 	return inst.id;
 }
 //=============================================================================
-// ꎞ~
+// 再生中のソースボイス数の取得
+//=============================================================================
+int CSound::GetActiveVoiceCount(void) const
+{
+	int nCount = 0;
+
+	for (const auto& inst : m_aInstance)
+	{
+		if (inst.active && inst.pSourceVoice != nullptr)
+		{
+			nCount++;
+		}
+	}
+
+	return nCount;
+}
+//=============================================================================
+// 一時停止
 //=============================================================================
 void CSound::PauseAll(void)
 {
-	for (auto& inst : m_Instances)
+	for (auto& inst : m_aInstance)
 	{
-		if (inst.pSourceVoice)
+		if (inst.active && inst.pSourceVoice)
 		{
-			inst.pSourceVoice->Stop(0); // tO0ňꎞ~
+			inst.pSourceVoice->Stop(0); // フラグ0で一時停止
 		}
 	}
 }
 //=============================================================================
-// ĊJ
+// 再開
 //=============================================================================
 void CSound::ResumeAll(void)
 {
-	for (auto& inst : m_Instances)
+	for (auto& inst : m_aInstance)
 	{
-		if (inst.pSourceVoice)
+		if (inst.active && inst.pSourceVoice)
 		{
-			inst.pSourceVoice->Start(0); // tO0ōĊJ
+			inst.pSourceVoice->Start(0); // フラグ0で再開
 		}
 	}
 }
 //=============================================================================
-// ZOg~(CfbNXw)
+// セグメント停止(インデックス指定)
 //=============================================================================
 void CSound::Stop(int instanceId)
 {
-	for (auto it = m_Instances.begin(); it != m_Instances.end(); it++)
+	for (auto& inst : m_aInstance)
 	{
-		if (it->id == instanceId)
+		if (inst.active && inst.id == instanceId)
 		{
-			if (it->pSourceVoice)
-			{
-				it->pSourceVoice->Stop(0);
-				it->pSourceVoice->FlushSourceBuffers();
-				it->pSourceVoice->DestroyVoice();
-				it->pSourceVoice = nullptr;
-			}
-			m_Instances.erase(it);
+			FreeInstance(inst);
 			return;
 		}
 	}
 }
 //=============================================================================
-// ZOg~(xw)
+// セグメント停止(ラベル指定)
 //=============================================================================
 void CSound::StopByLabel(SOUND_LABEL label)
 {
-	for (auto it = m_Instances.begin(); it != m_Instances.end(); )
+	for (auto& inst : m_aInstance)
 	{
-		if (it->label == label)
+		if (inst.active && inst.label == label)
 		{
-			if (it->pSourceVoice)
-			{
-				it->pSourceVoice->Stop(0);
-				it->pSourceVoice->FlushSourceBuffers();
-				it->pSourceVoice->DestroyVoice();
-			}
-			it = m_Instances.erase(it);
+			FreeInstance(inst);
 		}
-		else
+	}
+}
+//=============================================================================
+// セグメント停止(全て)
+//=============================================================================
+void CSound::Stop(void)
+{
+	for (auto& inst : m_aInstance)
+	{
+		if (inst.active)
 		{
-			it++;
+			FreeInstance(inst);
 		}
 	}
 }
 //=============================================================================
-// ZOg~(S)
+// 空いている再生インスタンスの取得処理(空きが無ければ鳴り終わった物を使い回す)
 //=============================================================================
-void CSound::Stop(void)
+CSound::SoundInstance* CSound::AllocInstance(void)
 {
-	for (auto& inst : m_Instances)
+	for (auto& inst : m_aInstance)
+	{
+		if (!inst.active)
+		{
+			return &inst;
+		}
+	}
+
+	// 鳴り終わったボイスは止められるまで残っているので、ここで破棄する
+	for (auto& inst : m_aInstance)
 	{
-		if (inst.pSourceVoice)
+		if (inst.pSourceVoice == nullptr)
+		{
+			FreeInstance(inst);
+			return &inst;
+		}
+
+		XAUDIO2_VOICE_STATE state;
+		inst.pSourceVoice->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+
+		if (state.BuffersQueued == 0)
 		{
-			inst.pSourceVoice->Stop(0);
-			inst.pSourceVoice->FlushSourceBuffers();
-			inst.pSourceVoice->DestroyVoice();
+			FreeInstance(inst);
+			return &inst;
 		}
 	}
-	m_Instances.clear();  // ꊇŃNA
+
+	m_nNumDropped++;
+
+	return nullptr;
+}
+//=============================================================================
+// 再生インスタンスの解放処理(ボイスを破棄して空きに戻す)
+//=============================================================================
+void CSound::FreeInstance(SoundInstance& inst)
+{
+	if (inst.pSourceVoice)
+	{
+		inst.pSourceVoice->Stop(0);
+		inst.pSourceVoice->FlushSourceBuffers();
+		inst.pSourceVoice->DestroyVoice();
+	}
+
+	inst = SoundInstance();
+}
+//=============================================================================
+// 全体の音量の設定処理
+//=============================================================================
+void CSound::SetMasterVolume(float fVolume)
+{
+	if (m_pMasteringVoice != nullptr)
+	{
+		m_pMasteringVoice->SetVolume(fVolume);
+	}
 }
 //=============================================================================
-// JX^pjO
+// カスタムパンニング
 //=============================================================================
 void CSound::CalculateCustomPanning(SoundInstance& inst, FLOAT32* matrix)
 {
-	// vC[̌iOxNgj
+	// プレイヤーの向き（前方向ベクトル）
 	D3DXVECTOR3 front = m_Listener.OrientFront;
 	D3DXVec3Normalize(&front, &front);
 
-	// xNgiʏ (0, 1, 0)j
+	// 上方向ベクトル（通常は (0, 1, 0)）
 	D3DXVECTOR3 up = m_Listener.OrientTop;
 	D3DXVec3Normalize(&up, &up);
 
-	// ExNg = front ~ upiOςŋ߂j
+	// 右方向ベクトル = front × up（外積で求める）
 	D3DXVECTOR3 right;
 	D3DXVec3Cross(&right, &up, &front);
 	D3DXVec3Normalize(&right, &right);
 
-	// Xi[  ̃xNg
+	// リスナー → 音源のベクトル
 	D3DXVECTOR3 toEmitter =
 	{
 		inst.emitter.Position.x - m_Listener.Position.x,
@@ -370,50 +451,50 @@ void CSound::CalculateCustomPanning(SoundInstance& inst, FLOAT32* matrix)
 		inst.emitter.Position.z - m_Listener.Position.z
 	};
 
-	// vZ
+	// 距離を計算
 	float distance = D3DXVec3Length(&toEmitter);
 
-	// vZ
+	// 距離減衰計算
 	float volumeScale = 1.0f - ((distance - inst.minDistance) / (inst.maxDistance - inst.minDistance));
 	volumeScale = std::max(0.0f, std::min(1.0f, volumeScale));
 
-	// xNg𐳋K
+	// 方向ベクトルを正規化
 	D3DXVec3Normalize(&toEmitter, &toEmitter);
 
-	// EEOpjOq
-	float panLR = D3DXVec3Dot(&right, &toEmitter); // -1 () ` 1 (E)
-	float panFB = D3DXVec3Dot(&front, &toEmitter); // -1 () ` 1 (O)
+	// 左右・前後パンニング因子
+	float panLR = D3DXVec3Dot(&right, &toEmitter); // -1 (左) ～ 1 (右)
+	float panFB = D3DXVec3Dot(&front, &toEmitter); // -1 (後) ～ 1 (前)
 
-	// ␳
-	float lrWeight = panLR * 0.5f; // -0.5 ` +0.5
-	float fbWeight = panFB * 0.5f + 0.5f; // 0iwj`1iʁj
+	// 方向補正
+	float lrWeight = panLR * 0.5f; // -0.5 ～ +0.5
+	float fbWeight = panFB * 0.5f + 0.5f; // 0（背後）～1（正面）
 
-	// włŒc悤ɕ␳
+	// 背後でも最低限音が残るように補正
 	const float minVolume = 0.3f;
 	fbWeight = fbWeight * (1.0f - minVolume) + minVolume;
 	float backWeight = 1.0f - fbWeight;
 
-	// ʐݒ
+	// 音量設定
 	float frontLeft = (0.5f - lrWeight) * fbWeight * volumeScale;
 	float frontRight = (0.5f + lrWeight) * fbWeight * volumeScale;
 	float rearLeft = (0.5f - lrWeight) * backWeight * volumeScale;
 	float rearRight = (0.5f + lrWeight) * backWeight * volumeScale;
 
-	// ʃ}gbNXɃZbgi4ch: FL, FR, RL, RRj
+	// 音量マトリックスにセット（4ch: FL, FR, RL, RR）
 	matrix[0] = frontLeft;
 	matrix[1] = frontRight;
 	matrix[2] = rearLeft;
 	matrix[3] = rearRight;
 }
 //=============================================================================
-// Xi[(J)̍XV
+// リスナー(カメラ)の更新処理
 //=============================================================================
 void CSound::UpdateListener(D3DXVECTOR3 pos)
 {
-	// J̌xNgvZ
+	// カメラの向きベクトルを計算
 	D3DXVECTOR3 forward = CManager::GetCamera()->GetForward();
 
-	// Kđ
+	// 正規化して代入
 	D3DXVec3Normalize(&forward, &forward);
 
 	m_Listener.OrientFront = forward;
@@ -427,21 +508,21 @@ void CSound::UpdateListener(D3DXVECTOR3 pos)
 
 	m_Listener.OrientTop = orienttop;
 
-	m_Listener.Position = { pos.x, pos.y, pos.z };				// Xi[(J)̈ʒu
+	m_Listener.Position = { pos.x, pos.y, pos.z };				// リスナー(カメラ)の位置
 }
 //=============================================================================
-// ̈ʒuXV
+// 音源の位置更新処理
 //=============================================================================
 void CSound::UpdateSoundPosition(int instanceId, D3DXVECTOR3 pos)
 {
-	for (auto& inst : m_Instances)
+	for (auto& inst : m_aInstance)
 	{
-		if (inst.id == instanceId)
+		if (inst.active && inst.id == instanceId)
 		{
-			// ݈̌ʒuKp
+			// 音源の現在位置を適用
 			inst.emitter.Position = { pos.x, pos.y, pos.z };
 
-			// 3DI[fBIvZ
+			// 3Dオーディオ計算
 			X3DAUDIO_DSP_SETTINGS dspSettings = {};
 			FLOAT32 matrix[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 			dspSettings.SrcChannelCount = 1;
@@ -456,16 +537,16 @@ void CSound::UpdateSoundPosition(int instanceId, D3DXVECTOR3 pos)
 				&dspSettings
 			);
 
-			// pjOlNbv
+			// パンニング値をクリップ
 			for (int nCnt = 0; nCnt < 4; nCnt++)
 			{
 				matrix[nCnt] = std::max(0.0f, std::min(1.0f, matrix[nCnt]));
 			}
 
-			// JX^pjOvZ
+			// カスタムパンニング計算
 			CalculateCustomPanning(inst, matrix);
 
-			// o̓}gNXXV
+			// 出力マトリクスを更新
 			if (inst.pSourceVoice)
 			{
 				inst.pSourceVoice->SetOutputMatrix(NULL, 1, 4, matrix);
@@ -475,7 +556,7 @@ void CSound::UpdateSoundPosition(int instanceId, D3DXVECTOR3 pos)
 	}
 }
 //=============================================================================
-// `Ñ`FbN
+// チャンクのチェック
 //=============================================================================
 HRESULT CSound::CheckChunk(HANDLE hFile, DWORD format, DWORD* pChunkSize, DWORD* pChunkDataPosition)
 {
@@ -489,19 +570,19 @@ HRESULT CSound::CheckChunk(HANDLE hFile, DWORD format, DWORD* pChunkSize, DWORD*
 	DWORD dwOffset = 0;
 
 	if (SetFilePointer(hFile, 0, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
-	{// t@C|C^擪Ɉړ
+	{// ファイルポインタを先頭に移動
 		return HRESULT_FROM_WIN32(GetLastError());
 	}
 
 	while (hr == S_OK)
 	{
 		if (ReadFile(hFile, &dwChunkType, sizeof(DWORD), &dwRead, NULL) == 0)
-		{// `N̓ǂݍ
+		{// チャンクの読み込み
 			hr = HRESULT_FROM_WIN32(GetLastError());
 		}
 
 		if (ReadFile(hFile, &dwChunkDataSize, sizeof(DWORD), &dwRead, NULL) == 0)
-		{// `Nf[^̓ǂݍ
+		{// チャンクデータの読み込み
 			hr = HRESULT_FROM_WIN32(GetLastError());
 		}
 
@@ -511,14 +592,14 @@ HRESULT CSound::CheckChunk(HANDLE hFile, DWORD format, DWORD* pChunkSize, DWORD*
 			dwRIFFDataSize = dwChunkDataSize;
 			dwChunkDataSize = 4;
 			if (ReadFile(hFile, &dwFileType, sizeof(DWORD), &dwRead, NULL) == 0)
-			{// t@C^Cv̓ǂݍ
+			{// ファイルタイプの読み込み
 				hr = HRESULT_FROM_WIN32(GetLastError());
 			}
 			break;
 
 		default:
 			if (SetFilePointer(hFile, dwChunkDataSize, NULL, FILE_CURRENT) == INVALID_SET_FILE_POINTER)
-			{// t@C|C^`Nf[^ړ
+			{// ファイルポインタをチャンクデータ分移動
 				return HRESULT_FROM_WIN32(GetLastError());
 			}
 		}
@@ -542,26 +623,26 @@ HRESULT CSound::CheckChunk(HANDLE hFile, DWORD format, DWORD* pChunkSize, DWORD*
 	return S_OK;
 }
 //=============================================================================
-// `Nf[^̓ǂݍ
+// チャンクデータの読み込み
 //=============================================================================
 HRESULT CSound::ReadChunkData(HANDLE hFile, void* pBuffer, DWORD dwBuffersize, DWORD dwBufferoffset)
 {
 	DWORD dwRead;
 
 	if (SetFilePointer(hFile, dwBufferoffset, NULL, FILE_BEGIN) == INVALID_SET_FILE_POINTER)
-	{// t@C|C^wʒu܂ňړ
+	{// ファイルポインタを指定位置まで移動
 		return HRESULT_FROM_WIN32(GetLastError());
 	}
 
 	if (ReadFile(hFile, pBuffer, dwBuffersize, &dwRead, NULL) == 0)
-	{// f[^̓ǂݍ
+	{// データの読み込み
 		return HRESULT_FROM_WIN32(GetLastError());
 	}
 
 	return S_OK;
 }
 //=============================================================================
-// WAVE̓ǂݍ
+// WAVEの読み込み
 //=============================================================================
 HRESULT CSound::LoadWave(SOUND_LABEL label)
 {
@@ -584,14 +665,14 @@ HRESULT CSound::LoadWave(SOUND_LABEL label)
 	DWORD dwChunkSize;
 	DWORD dwChunkPosition;
 
-	// "RIFF" `N`FbN
+	// "RIFF" チャンクチェック
 	if (FAILED(CheckChunk(hFile, 'FFIR', &dwChunkSize, &dwChunkPosition)))
 	{
 		CloseHandle(hFile);
 		return E_FAIL;
 	}
 
-	// "fmt " `N
+	// "fmt " チャンク
 	if (FAILED(CheckChunk(hFile, ' tmf', &dwChunkSize, &dwChunkPosition)))
 	{
 		CloseHandle(hFile);
@@ -605,7 +686,7 @@ HRESULT CSound::LoadWave(SOUND_LABEL label)
 		return E_FAIL;
 	}
 
-	// "data" `N
+	// "data" チャンク
 	if (FAILED(CheckChunk(hFile, 'atad', &dwChunkSize, &dwChunkPosition))) 
 	{
 		CloseHandle(hFile);
@@ -620,7 +701,7 @@ HRESULT CSound::LoadWave(SOUND_LABEL label)
 		return E_FAIL;
 	}
 
-	// \[X{CX쐬
+	// ソースボイス作成
 	IXAudio2SourceVoice* pSourceVoice = nullptr;
 	if (FAILED(m_pXAudio2->CreateSourceVoice(&pSourceVoice, (WAVEFORMATEX*)&wfx)))
 	{
@@ -629,7 +710,7 @@ HRESULT CSound::LoadWave(SOUND_LABEL label)
 		return E_FAIL;
 	}
 
-	// obt@ݒ
+	// バッファ設定
 	XAUDIO2_BUFFER buffer = {};
 	buffer.AudioBytes = dwChunkSize;
 	buffer.pAudioData = pDataBuffer;
@@ -637,10 +718,10 @@ HRESULT CSound::LoadWave(SOUND_LABEL label)
 
 	pSourceVoice->SubmitSourceBuffer(&buffer);
 
-	// ێ
-	m_SoundData[label].pAudioData = pDataBuffer;	// ǂݍPCMf[^̃obt@
-	m_SoundData[label].audioBytes = dwChunkSize;	// f[^̃oCg
-	m_SoundData[label].wfx = wfx;					// tH[}bg
+	// 保持
+	m_SoundData[label].pAudioData = pDataBuffer;	// 読み込んだPCMデータのバッファ
+	m_SoundData[label].audioBytes = dwChunkSize;	// データのバイト数
+	m_SoundData[label].wfx = wfx;					// フォーマット情報
 
 	CloseHandle(hFile);
 	return S_OK;
@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// TEh [sound.h]
+// サウンド処理 [sound.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _SOUND_H_// ̃}N`ĂȂ
-#define _SOUND_H_// 2dCN[hh~̃}N`
+#ifndef _SOUND_H_// このマクロ定義がされていなかったら
+#define _SOUND_H_// 2重インクルード防止のマクロ定義
 
 //*************************************************************************
-// TEhNX
+// サウンドクラス
 //*************************************************************************
 class CSound
 {
@@ -17,11 +17,11 @@ public:
 	~CSound();
 
 	//*************************************************************************
-	// TEhꗗ
+	// サウンド一覧
 	//*************************************************************************
 	typedef enum
 	{
-		SOUND_LABEL_GAMEBGM = 0,	// Q[BGM
+		SOUND_LABEL_GAMEBGM = 0,	// ゲームBGM
 		SOUND_LABEL_TITLEBGM,
 		SOUND_LABEL_TUTORIALBGM,
 		SOUND_LABEL_RESULTSE,
@@ -48,20 +48,26 @@ public:
 	void PauseAll(void);
 	void ResumeAll(void);
 
-	void Stop(int instanceId);			// CfbNXwł̒~(3DTEh)
-	void StopByLabel(SOUND_LABEL label);// xwł̒~(2DTEh)
+	void Stop(int instanceId);			// インデックス指定での停止(3Dサウンド)
+	void StopByLabel(SOUND_LABEL label);// ラベル指定での停止(2Dサウンド)
 	void Stop(void);
 	int Play(SOUND_LABEL label);
 	int Play3D(SOUND_LABEL label,D3DXVECTOR3 soundPos,float minDistance,float maxDistance);
 
 	void UpdateListener(D3DXVECTOR3 pos);
 	void UpdateSoundPosition(int instanceId, D3DXVECTOR3 pos);
+	int GetActiveVoiceCount(void) const;
+	int GetDroppedCount(void) const { return m_nNumDropped; }
+	void SetMasterVolume(float fVolume);
 
 private:
-	// ő哯Đ
+	// 最大同時再生数
 	static constexpr int MAX_SIMULTANEOUS_PLAY = 2;
 
-	// ̃TEhĐCX^X
+	// 同時に持てる再生インスタンスの数(再生のたびに確保しないよう固定で持つ)
+	static constexpr int MAX_INSTANCE = 32;
+
+	// 一つのサウンド再生インスタンス
 	struct SoundInstance
 	{
 		int id = -1;
@@ -69,7 +75,7 @@ private:
 		X3DAUDIO_EMITTER emitter = {};
 		SOUND_LABEL label;
 		bool active = false;
-		float minDistance = 0.0f, maxDistance = 0.0f;		// ŏƍő勗i͈̔́j
+		float minDistance = 0.0f, maxDistance = 0.0f;		// 最小距離と最大距離（距離減衰の範囲）
 	};
 
 	struct SoundData
@@ -86,42 +92,45 @@ private:
 	};
 
 private:
-	IXAudio2* m_pXAudio2;									// XAudio2IuWFNgւ̃C^[tFCX
-	IXAudio2MasteringVoice* m_pMasteringVoice;				// }X^[{CX
+	IXAudio2* m_pXAudio2;									// XAudio2オブジェクトへのインターフェイス
+	IXAudio2MasteringVoice* m_pMasteringVoice;				// マスターボイス
 
-	// TEh̏
+	// サウンドの情報
 	SOUNDINFO m_aSoundInfo[SOUND_LABEL_MAX] =
 	{
-		{"data/BGM/gameBGM.wav", -1},			// Q[BGM
-		{"data/BGM/titleBGM.wav", -1},			// ^CgBGM
-		{"data/BGM/wind.wav", -1},				// `[gABGM
-		{"data/SE/resultSE.wav", 0},			// UgSE
-		{"data/SE/menu.wav", 0},				// |[YSE
-		{"data/SE/select.wav", 0},				// ISE
-		{"data/SE/enter.wav", 0},				// SE
-		{"data/SE/grass.wav", 0},				// SE
-		{"data/SE/water.wav", 0},				// SE
-		{"data/SE/start.wav", 0},				// JnSE
-		{"data/SE/itemget.wav", 0},				// ACe擾SE
-		{"data/SE/step.wav", 0},				// SE
-		{"data/SE/slash_1.wav", 0},				// a1SE
-		{"data/SE/slash_2.wav", 0},				// a2SE
-		{"data/SE/damage.wav", 0},				// _[WSE
-		{"data/SE/gate_open.wav", 0},			// JSE
-		{"data/SE/gear.wav", -1},				// MASE([v)
+		{"data/BGM/gameBGM.wav", -1},			// ゲームBGM
+		{"data/BGM/titleBGM.wav", -1},			// タイトルBGM
+		{"data/BGM/wind.wav", -1},				// チュートリアルBGM
+		{"data/SE/resultSE.wav", 0},			// リザルトSE
+		{"data/SE/menu.wav", 0},				// ポーズSE
+		{"data/SE/select.wav", 0},				// 選択SE
+		{"data/SE/enter.wav", 0},				// 決定SE
+		{"data/SE/grass.wav", 0},				// 草SE
+		{"data/SE/water.wav", 0},				// 水SE
+		{"data/SE/start.wav", 0},				// 開始SE
+		{"data/SE/itemget.wav", 0},				// アイテム取得SE
+		{"data/SE/step.wav", 0},				// 足音SE
+		{"data/SE/slash_1.wav", 0},				// 斬撃1SE
+		{"data/SE/slash_2.wav", 0},				// 斬撃2SE
+		{"data/SE/damage.wav", 0},				// ダメージSE
+		{"data/SE/gate_open.wav", 0},			// 開門SE
+		{"data/SE/gear.wav", -1},				// ギアSE(ループ)
 	};
 
 	SoundData m_SoundData[SOUND_LABEL_MAX];
 
-	// CX^XǗ
-	std::vector<SoundInstance> m_Instances;
+	// インスタンス管理(activeがfalseの物は空き)
+	SoundInstance m_aInstance[MAX_INSTANCE];
 	int m_nextInstanceId;
+	int m_nNumDropped;										// 空きが無くて再生しなかった回数
 
-	X3DAUDIO_HANDLE m_X3DInstance;							// X3DAudio CX^X
-	X3DAUDIO_LISTENER m_Listener;							// Xi[ivC[̈ʒuj
+	X3DAUDIO_HANDLE m_X3DInstance;							// X3DAudio インスタンス
+	X3DAUDIO_LISTENER m_Listener;							// リスナー（プレイヤーの位置）
 
 private:
 	HRESULT LoadWave(SOUND_LABEL label);
+	SoundInstance* AllocInstance(void);
+	void FreeInstance(SoundInstance& inst);
 	void CalculateCustomPanning(SoundInstance& inst, FLOAT32* matrix);
 	HRESULT CheckChunk(HANDLE hFile, DWORD format, DWORD* pChunkSize, DWORD* pChunkDataPosition);
 	HRESULT ReadChunkData(HANDLE hFile, void* pBuffer, DWORD dwBuffersize, DWORD dwBufferoffset);
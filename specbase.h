@@ -1,24 +1,24 @@
 //=============================================================================
 //
-// XybNx[X [specbase.h]
+// スペックベース処理 [specbase.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _SPECBASE_H_// ̃}N`ĂȂ
-#define _SPECBASE_H_// 2dCN[hh~̃}N`
+#ifndef _SPECBASE_H_// このマクロ定義がされていなかったら
+#define _SPECBASE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "motion.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CPlayer;
 
 //*****************************************************************************
-// XybNx[XNX
+// スペックベースクラス
 //*****************************************************************************
 template <class T>
 class Specification
@@ -31,7 +31,7 @@ public:
 };
 
 //*****************************************************************************
-// XybN̍(AND)NX
+// スペックの合成(AND)クラス
 //*****************************************************************************
 template <typename T>
 class AndSpecification : public Specification<T> 
@@ -51,7 +51,7 @@ private:
 };
 
 //*****************************************************************************
-// XybN̍(OR)NX
+// スペックの合成(OR)クラス
 //*****************************************************************************
 template <typename T>
 class OrSpecification : public Specification<T> 
@@ -71,7 +71,7 @@ private:
 };
 
 //*****************************************************************************
-// XybN̍(NOT)NX
+// スペックの合成(NOT)クラス
 //*****************************************************************************
 template <typename T>
 class NotSpecification : public Specification<T> 
@@ -90,7 +90,7 @@ private:
 
 
 //*****************************************************************************
-// vC[HPȂ(ȉ)
+// プレイヤーのHPが少ない(半分以下)
 //*****************************************************************************
 class IsHpFew : public Specification <CPlayer>
 {
@@ -100,13 +100,13 @@ public:
 
 	bool IsSatisfiedBy(const CPlayer& player) const override
 	{
-		// HP̍őʂɐݒ
+		// HPの最大量に設定
 		const float nMaxLife = player.GetMaxHp();
 
-		// ݂HP̎擾
+		// 現在のHPの取得
 		float currentLife = player.GetHp();
 
-		// ȉ
+		// 半分以下だったら
 		return currentLife <= nMaxLife * 0.5f;
 	}
 
@@ -114,7 +114,7 @@ private:
 };
 
 //*****************************************************************************
-// vC[HPƂĂȂ
+// プレイヤーのHPがとても少ない
 //*****************************************************************************
 class IsHpVeryFew : public Specification <CPlayer>
 {
@@ -124,10 +124,10 @@ public:
 
 	bool IsSatisfiedBy(const CPlayer& player) const override
 	{
-		// HP̍őʂɐݒ
+		// HPの最大量に設定
 		const float nMaxLife = player.GetMaxHp();
 
-		// ݂HP̎擾
+		// 現在のHPの取得
 		float currentLife = player.GetHp();
 
 		return currentLife <= VERYFEW_HP;
@@ -138,7 +138,7 @@ private:
 };
 
 //*****************************************************************************
-// vC[XeXԂł͂Ȃ
+// プレイヤーがステルス状態ではない
 //*****************************************************************************
 class IsNotStealthSpec : public Specification<CPlayer>
 {
@@ -150,7 +150,7 @@ public:
 };
 
 //*****************************************************************************
-// vC[XeX
+// プレイヤーがステルス状態
 //*****************************************************************************
 class IsStealthSpec : public Specification<CPlayer>
 {
@@ -162,7 +162,7 @@ public:
 };
 
 //*****************************************************************************
-// vC[ړ
+// プレイヤーが移動中
 //*****************************************************************************
 class IsMovingSpec : public Specification<CPlayer>
 {
@@ -174,7 +174,7 @@ public:
 };
 
 //*****************************************************************************
-// vC[_[W[Vł͂Ȃ
+// プレイヤーがダメージモーション中ではない
 //*****************************************************************************
 class IsNotDamageMotionSpec : public Specification<CPlayer>
 {
@@ -0,0 +1,975 @@
+//=============================================================================
+//
+// 2Dスプライトまとめ描画処理 [spritebatch.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "spritebatch.h"
+#include "renderer.h"
+#include "manager.h"
+#include "random.h"
+#include "algorithm"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::vector<CSpriteBatch::Quad> CSpriteBatch::m_quads;
+std::vector<unsigned long long> CSpriteBatch::m_order;
+std::vector<int> CSpriteBatch::m_groupId;
+std::vector<int> CSpriteBatch::m_atlasId;
+std::vector<int> CSpriteBatch::m_drawOrder;
+std::vector<CSpriteBatch::Group> CSpriteBatch::m_groups;
+std::vector<CSpriteBatch::AtlasEntry> CSpriteBatch::m_atlas;
+LPDIRECT3DTEXTURE9 CSpriteBatch::m_pAtlas = nullptr;
+int CSpriteBatch::m_nShelfX = 0;
+int CSpriteBatch::m_nShelfY = 0;
+int CSpriteBatch::m_nShelfH = 0;
+LPDIRECT3DVERTEXBUFFER9 CSpriteBatch::m_pVtxBuff = nullptr;
+LPDIRECT3DINDEXBUFFER9 CSpriteBatch::m_pIdxBuff = nullptr;
+int CSpriteBatch::m_nVtxCursor = 0;
+int CSpriteBatch::m_nFrameQuad = 0;
+int CSpriteBatch::m_nFrameDrawCall = 0;
+int CSpriteBatch::m_nNumQuad = 0;
+int CSpriteBatch::m_nNumDrawCall = 0;
+
+//=============================================================================
+// 初期化処理
+//=============================================================================
+HRESULT CSpriteBatch::Init(void)
+{
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	// インデックスバッファの生成(中身は変わらないので最初に作っておく)
+	if (FAILED(pDevice->CreateIndexBuffer(sizeof(WORD) * 6 * BATCH_QUAD,
+		D3DUSAGE_WRITEONLY,
+		D3DFMT_INDEX16,
+		D3DPOOL_MANAGED,
+		&m_pIdxBuff,
+		NULL)))
+	{
+		return E_FAIL;
+	}
+
+	WORD* pIdx = nullptr;
+
+	if (SUCCEEDED(m_pIdxBuff->Lock(0, 0, (void**)&pIdx, 0)))
+	{
+		for (int nCnt = 0; nCnt < BATCH_QUAD; nCnt++)
+		{
+			WORD nTop = (WORD)(nCnt * 4);
+
+			// 左上・右上・左下 / 左下・右上・右下
+			pIdx[0] = nTop + 0;
+			pIdx[1] = nTop + 1;
+			pIdx[2] = nTop + 2;
+			pIdx[3] = nTop + 2;
+			pIdx[4] = nTop + 1;
+			pIdx[5] = nTop + 3;
+			pIdx += 6;
+		}
+
+		m_pIdxBuff->Unlock();
+	}
+
+	// アトラスの生成(MANAGEDなのでデバイスリセットで作り直さなくてよい)
+	if (FAILED(pDevice->CreateTexture(ATLAS_SIZE, ATLAS_SIZE, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &m_pAtlas, NULL)))
+	{
+		m_pAtlas = nullptr;
+	}
+
+	ResetAtlas();
+
+	// 毎フレーム確保し直さないように先に広げておく
+	m_quads.reserve(RESERVE_QUAD);
+	m_order.reserve(RESERVE_QUAD);
+	m_groupId.reserve(RESERVE_QUAD);
+	m_atlasId.reserve(RESERVE_QUAD);
+	m_drawOrder.reserve(RESERVE_QUAD);
+	m_groups.reserve(RESERVE_QUAD);
+
+	// 頂点バッファの生成
+	RestoreDevice();
+
+	return S_OK;
+}
+//=============================================================================
+// 終了処理
+//=============================================================================
+void CSpriteBatch::Uninit(void)
+{
+	Clear();
+
+	// 頂点バッファの破棄
+	InvalidateDevice();
+
+	// インデックスバッファの破棄
+	if (m_pIdxBuff != nullptr)
+	{
+		m_pIdxBuff->Release();
+		m_pIdxBuff = nullptr;
+	}
+
+	// アトラスの破棄
+	if (m_pAtlas != nullptr)
+	{
+		m_pAtlas->Release();
+		m_pAtlas = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット前の破棄処理(動的頂点バッファはD3DPOOL_DEFAULTなので作り直す)
+//=============================================================================
+void CSpriteBatch::InvalidateDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		m_pVtxBuff->Release();
+		m_pVtxBuff = nullptr;
+	}
+}
+//=============================================================================
+// デバイスリセット後の生成処理
+//=============================================================================
+void CSpriteBatch::RestoreDevice(void)
+{
+	if (m_pVtxBuff != nullptr)
+	{
+		return;
+	}
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4 * BUFFER_QUAD,
+		D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY,
+		FVF_VERTEX_2D,
+		D3DPOOL_DEFAULT,
+		&m_pVtxBuff,
+		NULL);
+
+	// 次の書き込みで捨てさせる
+	m_nVtxCursor = BUFFER_QUAD;
+}
+//=============================================================================
+// 四角形を積む処理
+//=============================================================================
+void CSpriteBatch::Submit(const VERTEX_2D* pVtx, int nIdxTexture, int nLayer)
+{
+	Quad quad;
+	memcpy(quad.aVtx, pVtx, sizeof(quad.aVtx));
+	quad.nIdxTexture = nIdxTexture;
+	quad.nLayer = std::max(nLayer, 0);
+
+	m_quads.push_back(quad);
+}
+//=============================================================================
+// フレームの開始処理(前回の描画数を確定する)
+//=============================================================================
+void CSpriteBatch::BeginFrame(void)
+{
+	m_nNumQuad = m_nFrameQuad;
+	m_nNumDrawCall = m_nFrameDrawCall;
+
+	m_nFrameQuad = 0;
+	m_nFrameDrawCall = 0;
+}
+//=============================================================================
+// 破棄処理(シーンが変わる時にアトラスも空にする)
+//=============================================================================
+void CSpriteBatch::Clear(void)
+{
+	m_quads.clear();
+
+	ResetAtlas();
+}
+//=============================================================================
+// アトラスに入れるテクスチャの登録処理(読み込みが終わった後の描画で入れる)
+//=============================================================================
+void CSpriteBatch::RegisterAtlas(int nIdxTexture, bool bFit)
+{
+	if (nIdxTexture < 0 || m_pAtlas == nullptr)
+	{
+		return;
+	}
+
+	for (auto& entry : m_atlas)
+	{
+		if (entry.nIdxTexture == nIdxTexture && !entry.bDead)
+		{// 登録済み
+			entry.bFit = entry.bFit || bFit;
+			return;
+		}
+	}
+
+	AtlasEntry entry = {};
+	entry.nIdxTexture = nIdxTexture;
+	entry.bFit = bFit;
+
+	m_atlas.push_back(entry);
+}
+//=============================================================================
+// アトラスに入っているテクスチャ数の取得
+//=============================================================================
+int CSpriteBatch::GetNumAtlas(void)
+{
+	int nNum = 0;
+
+	for (const auto& entry : m_atlas)
+	{
+		if (entry.bPacked && entry.nIdxTexture >= 0)
+		{
+			nNum++;
+		}
+	}
+
+	return nNum;
+}
+//=============================================================================
+// 頂点座標の設定処理(左上・右上・左下・右下)
+//=============================================================================
+void CSpriteBatch::SetRect(VERTEX_2D* pVtx, float fLeft, float fTop, float fRight, float fBottom)
+{
+	pVtx[0].pos = D3DXVECTOR3(fLeft, fTop, 0.0f);
+	pVtx[1].pos = D3DXVECTOR3(fRight, fTop, 0.0f);
+	pVtx[2].pos = D3DXVECTOR3(fLeft, fBottom, 0.0f);
+	pVtx[3].pos = D3DXVECTOR3(fRight, fBottom, 0.0f);
+
+	// rhwの設定
+	for (int nCnt = 0; nCnt < 4; nCnt++)
+	{
+		pVtx[nCnt].rhw = 1.0f;
+	}
+}
+//=============================================================================
+// テクスチャ座標の設定処理
+//=============================================================================
+void CSpriteBatch::SetTexRect(VERTEX_2D* pVtx, float fLeft, float fTop, float fRight, float fBottom)
+{
+	pVtx[0].tex = D3DXVECTOR2(fLeft, fTop);
+	pVtx[1].tex = D3DXVECTOR2(fRight, fTop);
+	pVtx[2].tex = D3DXVECTOR2(fLeft, fBottom);
+	pVtx[3].tex = D3DXVECTOR2(fRight, fBottom);
+}
+//=============================================================================
+// 頂点カラーの設定処理
+//=============================================================================
+void CSpriteBatch::SetColor(VERTEX_2D* pVtx, D3DCOLOR col)
+{
+	for (int nCnt = 0; nCnt < 4; nCnt++)
+	{
+		pVtx[nCnt].col = col;
+	}
+}
+//=============================================================================
+// 積んだ四角形の描画処理
+//=============================================================================
+void CSpriteBatch::Flush(void)
+{
+	if (m_quads.empty())
+	{
+		return;
+	}
+
+	if (m_pVtxBuff == nullptr || m_pIdxBuff == nullptr)
+	{
+		m_quads.clear();
+		return;
+	}
+
+	// テクスチャの取得
+	CTexture* pTexture = CManager::GetTexture();
+
+	// 読み込みが終わったテクスチャをアトラスに入れる
+	UpdateAtlas(pTexture);
+
+	// デバイスの取得
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
+
+	Render(pDevice, pTexture);
+}
+//=============================================================================
+// まとまりごとの描画処理
+//=============================================================================
+void CSpriteBatch::Render(CRenderDevice* pDevice, CTexture* pTexture)
+{
+	// 描く順番とまとまりを決める
+	Build();
+
+	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
+	pDevice->SetIndices(m_pIdxBuff);
+	pDevice->SetFVF(FVF_VERTEX_2D);
+
+	for (const auto& group : m_groups)
+	{
+		LPDIRECT3DTEXTURE9 pTex = nullptr;
+
+		if (group.nKey == ATLAS_KEY)
+		{
+			pTex = m_pAtlas;
+		}
+		else if (pTexture != nullptr)
+		{
+			pTex = pTexture->GetAddress(group.nKey);
+		}
+
+		// テクスチャの設定
+		pDevice->SetTexture(0, pTex);
+
+		int nStart = group.nStart;
+		int nEnd = group.nStart + group.nNum;
+
+		while (nStart < nEnd)
+		{
+			int nNumQuad = std::min(nEnd - nStart, BATCH_QUAD);
+
+			// 残りに入りきらなければ捨てて先頭から使う(描画中の所は上書きしない)
+			DWORD flags = D3DLOCK_NOOVERWRITE;
+
+			if (m_nVtxCursor + nNumQuad > BUFFER_QUAD)
+			{
+				flags = D3DLOCK_DISCARD;
+				m_nVtxCursor = 0;
+			}
+
+			VERTEX_2D* pVtx = nullptr;
+
+			if (FAILED(pDevice->LockVertexBuffer(m_pVtxBuff, sizeof(VERTEX_2D) * 4 * m_nVtxCursor,
+				sizeof(VERTEX_2D) * 4 * nNumQuad, (void**)&pVtx, flags)))
+			{
+				break;
+			}
+
+			Expand(&m_drawOrder[nStart], nNumQuad, pVtx);
+
+			pDevice->UnlockVertexBuffer(m_pVtxBuff);
+
+			pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, m_nVtxCursor * 4, 0, nNumQuad * 4, 0, nNumQuad * 2);
+
+			m_nVtxCursor += nNumQuad;
+			nStart += nNumQuad;
+			m_nFrameDrawCall++;
+		}
+	}
+
+	// テクスチャを外しておく
+	pDevice->SetTexture(0, nullptr);
+
+	m_nFrameQuad += (int)m_quads.size();
+	m_quads.clear();
+}
+//=============================================================================
+// 描く順番の作成処理
+// 重ね順で並べた後、同じテクスチャの前のまとまりに合流させる。
+// 間のまとまりと重なる場合は積んだ順を崩さないように新しいまとまりにする
+//=============================================================================
+void CSpriteBatch::Build(void)
+{
+	int nNum = (int)m_quads.size();
+
+	m_order.resize(nNum);
+	m_groupId.resize(nNum);
+	m_atlasId.resize(nNum);
+	m_drawOrder.resize(nNum);
+	m_groups.clear();
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		m_order[nCnt] = ((unsigned long long)(unsigned int)m_quads[nCnt].nLayer << 32) | (unsigned int)nCnt;
+	}
+
+	std::sort(m_order.begin(), m_order.end());
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		int nIdx = (int)(unsigned int)m_order[nCnt];
+		const Quad& quad = m_quads[nIdx];
+
+		// アトラスに入っていればアトラスでまとめる
+		int nAtlas = FindAtlas(quad);
+		int nKey = (nAtlas >= 0) ? ATLAS_KEY : quad.nIdxTexture;
+
+		m_atlasId[nIdx] = nAtlas;
+
+		// 後ろから同じテクスチャのまとまりを探す
+		int nGroup = -1;
+		int nLast = (int)m_groups.size() - 1;
+
+		for (int nCntGroup = nLast; nCntGroup >= 0 && nCntGroup > nLast - SEARCH_GROUP; nCntGroup--)
+		{
+			const Group& group = m_groups[nCntGroup];
+
+			if (group.nLayer != quad.nLayer)
+			{// 重ね順は越えない
+				break;
+			}
+
+			if (group.nKey == nKey)
+			{
+				nGroup = nCntGroup;
+				break;
+			}
+
+			if (IsOverlap(group, quad))
+			{// 間のまとまりより前には描けない
+				break;
+			}
+		}
+
+		// 四角形の範囲
+		float fLeft, fTop, fRight, fBottom;
+		GetRect(quad, fLeft, fTop, fRight, fBottom);
+
+		if (nGroup < 0)
+		{
+			Group group = { quad.nLayer, nKey, fLeft, fTop, fRight, fBottom, 0, 0 };
+
+			m_groups.push_back(group);
+			nGroup = (int)m_groups.size() - 1;
+		}
+		else
+		{
+			Group& group = m_groups[nGroup];
+
+			group.fLeft = std::min(group.fLeft, fLeft);
+			group.fTop = std::min(group.fTop, fTop);
+			group.fRight = std::max(group.fRight, fRight);
+			group.fBottom = std::max(group.fBottom, fBottom);
+		}
+
+		m_groups[nGroup].nNum++;
+		m_groupId[nCnt] = nGroup;
+	}
+
+	// まとまりごとの先頭を決めて、数は詰める時の位置に使い直す
+	int nStart = 0;
+
+	for (auto& group : m_groups)
+	{
+		group.nStart = nStart;
+		nStart += group.nNum;
+		group.nNum = 0;
+	}
+
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		Group& group = m_groups[m_groupId[nCnt]];
+
+		m_drawOrder[group.nStart + group.nNum] = (int)(unsigned int)m_order[nCnt];
+		group.nNum++;
+	}
+}
+//=============================================================================
+// 頂点の書き込み処理(アトラスに入っていればUVを置き換える)
+//=============================================================================
+void CSpriteBatch::Expand(const int* pOrder, int nNum, VERTEX_2D* pVtx)
+{
+	for (int nCnt = 0; nCnt < nNum; nCnt++)
+	{
+		int nIdx = pOrder[nCnt];
+
+		memcpy(pVtx, m_quads[nIdx].aVtx, sizeof(VERTEX_2D) * 4);
+
+		if (m_atlasId[nIdx] >= 0)
+		{
+			const AtlasEntry& entry = m_atlas[m_atlasId[nIdx]];
+
+			for (int nCntVtx = 0; nCntVtx < 4; nCntVtx++)
+			{
+				float u = std::max(0.0f, std::min(1.0f, pVtx[nCntVtx].tex.x));
+				float v = std::max(0.0f, std::min(1.0f, pVtx[nCntVtx].tex.y));
+
+				pVtx[nCntVtx].tex.x = entry.offset.x + u * entry.scale.x;
+				pVtx[nCntVtx].tex.y = entry.offset.y + v * entry.scale.y;
+			}
+		}
+
+		pVtx += 4;
+	}
+}
+//=============================================================================
+// まとまりと四角形が重なるか(辺が接するだけなら重ならない)
+//=============================================================================
+bool CSpriteBatch::IsOverlap(const Group& group, const Quad& quad)
+{
+	float fLeft, fTop, fRight, fBottom;
+	GetRect(quad, fLeft, fTop, fRight, fBottom);
+
+	return fLeft < group.fRight && fRight > group.fLeft && fTop < group.fBottom && fBottom > group.fTop;
+}
+//=============================================================================
+// 四角形の範囲の取得処理(回転していても囲む範囲で見る)
+//=============================================================================
+void CSpriteBatch::GetRect(const Quad& quad, float& fLeft, float& fTop, float& fRight, float& fBottom)
+{
+	fLeft = fRight = quad.aVtx[0].pos.x;
+	fTop = fBottom = quad.aVtx[0].pos.y;
+
+	for (int nCnt = 1; nCnt < 4; nCnt++)
+	{
+		fLeft = std::min(fLeft, quad.aVtx[nCnt].pos.x);
+		fRight = std::max(fRight, quad.aVtx[nCnt].pos.x);
+		fTop = std::min(fTop, quad.aVtx[nCnt].pos.y);
+		fBottom = std::max(fBottom, quad.aVtx[nCnt].pos.y);
+	}
+}
+//=============================================================================
+// アトラスの番号の取得処理(UVが0～1を超える繰り返しはアトラスでは描けない)
+//=============================================================================
+int CSpriteBatch::FindAtlas(const Quad& quad)
+{
+	for (int nCnt = 0; nCnt < (int)m_atlas.size(); nCnt++)
+	{
+		const AtlasEntry& entry = m_atlas[nCnt];
+
+		if (entry.nIdxTexture != quad.nIdxTexture || !entry.bPacked)
+		{
+			continue;
+		}
+
+		if (quad.nIdxTexture < 0)
+		{// テクスチャ無しは白い所を使う
+			return nCnt;
+		}
+
+		for (int nCntVtx = 0; nCntVtx < 4; nCntVtx++)
+		{
+			const D3DXVECTOR2& tex = quad.aVtx[nCntVtx].tex;
+
+			if (tex.x < -ATLAS_UV_EPSILON || tex.x > 1.0f + ATLAS_UV_EPSILON ||
+				tex.y < -ATLAS_UV_EPSILON || tex.y > 1.0f + ATLAS_UV_EPSILON)
+			{
+				return -1;
+			}
+		}
+
+		return nCnt;
+	}
+
+	return -1;
+}
+//=============================================================================
+// アトラスの更新処理(読み込み済みのものを入れ、差し替わったものは使わない)
+//=============================================================================
+void CSpriteBatch::UpdateAtlas(CTexture* pTexture)
+{
+	if (m_pAtlas == nullptr || pTexture == nullptr)
+	{
+		return;
+	}
+
+	for (auto& entry : m_atlas)
+	{
+		if (entry.nIdxTexture < 0 || entry.bDead)
+		{
+			continue;
+		}
+
+		LPDIRECT3DTEXTURE9 pSource = pTexture->GetAddress(entry.nIdxTexture);
+
+		if (entry.bPacked)
+		{
+			// 解放されたか、番号が別のテクスチャに使われた
+			if (pSource != entry.pSource)
+			{
+				entry.bPacked = false;
+				entry.bDead = true;
+			}
+		}
+		else if (pSource != nullptr)
+		{
+			// 大きすぎるか入りきらなければ元のテクスチャのまま描く
+			if (!PackAtlas(entry, pSource))
+			{
+				entry.bDead = true;
+			}
+		}
+	}
+}
+//=============================================================================
+// アトラスへの書き込み処理(左から詰め、入らなければ次の段に移る)
+//=============================================================================
+bool CSpriteBatch::PackAtlas(AtlasEntry& entry, LPDIRECT3DTEXTURE9 pSource)
+{
+	D3DSURFACE_DESC desc;
+
+	if (FAILED(pSource->GetLevelDesc(0, &desc)))
+	{
+		return false;
+	}
+
+	// 圧縮されたDDSはにじんだまま入るので、圧縮しない画像の一覧に足すよう知らせる
+	if (desc.Format == D3DFMT_DXT1 || desc.Format == D3DFMT_DXT5)
+	{
+		OutputDebugStringA("CSpriteBatch: block compressed texture in atlas, add it to data/TEXTURE/uncompressed.txt\n");
+	}
+
+	int nWidth = (int)desc.Width;
+	int nHeight = (int)desc.Height;
+
+	if (entry.bFit && nWidth > ATLAS_SIZE - ATLAS_PADDING * 2)
+	{// 横長の画像はアトラスの幅まで縮める
+		nHeight = std::max(1, nHeight * (ATLAS_SIZE - ATLAS_PADDING * 2) / nWidth);
+		nWidth = ATLAS_SIZE - ATLAS_PADDING * 2;
+	}
+
+	if ((nWidth > ATLAS_MAX_SOURCE && !entry.bFit) || nHeight > ATLAS_MAX_SOURCE)
+	{
+		return false;
+	}
+
+	// 縮める時だけ補間する
+	DWORD filter = (nWidth == (int)desc.Width && nHeight == (int)desc.Height) ? D3DX_FILTER_NONE : D3DX_FILTER_TRIANGLE;
+
+	int nPackW = nWidth + ATLAS_PADDING * 2;
+	int nPackH = nHeight + ATLAS_PADDING * 2;
+
+	if (m_nShelfX + nPackW > ATLAS_SIZE)
+	{// 次の段へ
+		m_nShelfY += m_nShelfH;
+		m_nShelfX = 0;
+		m_nShelfH = 0;
+	}
+
+	if (m_nShelfY + nPackH > ATLAS_SIZE)
+	{// 一杯
+		return false;
+	}
+
+	int nLeft = m_nShelfX + ATLAS_PADDING;
+	int nTop = m_nShelfY + ATLAS_PADDING;
+	RECT rect = { nLeft, nTop, nLeft + nWidth, nTop + nHeight };
+
+	LPDIRECT3DSURFACE9 pDst = nullptr;
+	LPDIRECT3DSURFACE9 pSrc = nullptr;
+	HRESULT hr = E_FAIL;
+
+	if (SUCCEEDED(m_pAtlas->GetSurfaceLevel(0, &pDst)) && SUCCEEDED(pSource->GetSurfaceLevel(0, &pSrc)))
+	{
+		// 圧縮されたテクスチャもここで展開される
+		hr = D3DXLoadSurfaceFromSurface(pDst, NULL, &rect, pSrc, NULL, NULL, filter, 0);
+	}
+
+	if (pSrc != nullptr)
+	{
+		pSrc->Release();
+	}
+
+	if (pDst != nullptr)
+	{
+		pDst->Release();
+	}
+
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	entry.pSource = pSource;
+	entry.offset = D3DXVECTOR2((float)nLeft / ATLAS_SIZE, (float)nTop / ATLAS_SIZE);
+	entry.scale = D3DXVECTOR2((float)nWidth / ATLAS_SIZE, (float)nHeight / ATLAS_SIZE);
+	entry.bPacked = true;
+
+	m_nShelfX += nPackW;
+	m_nShelfH = std::max(m_nShelfH, nPackH);
+
+	return true;
+}
+//=============================================================================
+// アトラスを空にする処理(左上にテクスチャ無しの四角形用の白い所を作る)
+//=============================================================================
+void CSpriteBatch::ResetAtlas(void)
+{
+	m_atlas.clear();
+	m_nShelfX = 0;
+	m_nShelfY = 0;
+	m_nShelfH = 0;
+
+	if (m_pAtlas == nullptr)
+	{
+		return;
+	}
+
+	D3DLOCKED_RECT lockRect;
+
+	if (FAILED(m_pAtlas->LockRect(0, &lockRect, NULL, 0)))
+	{
+		return;
+	}
+
+	// 透明で埋める
+	for (int nY = 0; nY < ATLAS_SIZE; nY++)
+	{
+		memset((BYTE*)lockRect.pBits + lockRect.Pitch * nY, 0, sizeof(DWORD) * ATLAS_SIZE);
+	}
+
+	// 白い所
+	const int nWhite = ATLAS_PADDING * 2;
+
+	for (int nY = 0; nY < nWhite; nY++)
+	{
+		DWORD* pRow = (DWORD*)((BYTE*)lockRect.pBits + lockRect.Pitch * nY);
+
+		for (int nX = 0; nX < nWhite; nX++)
+		{
+			pRow[nX] = 0xFFFFFFFF;
+		}
+	}
+
+	m_pAtlas->UnlockRect(0);
+
+	// テクスチャ無しは白い所の真ん中だけを使う
+	AtlasEntry white = {};
+	white.nIdxTexture = -1;
+	white.offset = D3DXVECTOR2((float)ATLAS_PADDING / ATLAS_SIZE, (float)ATLAS_PADDING / ATLAS_SIZE);
+	white.scale = D3DXVECTOR2(0.0f, 0.0f);
+	white.bPacked = true;
+
+	m_atlas.push_back(white);
+
+	m_nShelfX = nWhite + ATLAS_PADDING;
+	m_nShelfH = nWhite + ATLAS_PADDING;
+}
+//=============================================================================
+// 確認処理(記録デバイスに描いて描画回数を数え、重なりの順番が守られているかを調べる)
+//=============================================================================
+bool CSpriteBatch::RunTest(const char* filename)
+{
+	// 命令を記録するだけのデバイス
+	CRenderRecorder recorder(nullptr);
+
+	auto add = [&](float fLeft, float fTop, float fRight, float fBottom, int nIdxTexture, int nLayer)
+	{
+		VERTEX_2D aVtx[4];
+		SetRect(aVtx, fLeft, fTop, fRight, fBottom);
+		SetTexRect(aVtx, 0.0f, 0.0f, 1.0f, 1.0f);
+		SetColor(aVtx, D3DCOLOR_ARGB(255, 255, 255, 255));
+		Submit(aVtx, nIdxTexture, nLayer);
+	};
+
+	// 順番が守られているか(重なる2つは積んだ順、重ね順が違えば重ね順)
+	auto checkOrder = [&](void)
+	{
+		int nNum = (int)m_quads.size();
+		std::vector<int> position(nNum, -1);
+
+		for (int nCnt = 0; nCnt < nNum; nCnt++)
+		{
+			if (position[m_drawOrder[nCnt]] >= 0)
+			{// 2回描いている
+				return false;
+			}
+
+			position[m_drawOrder[nCnt]] = nCnt;
+		}
+
+		for (int nCnt = 0; nCnt < nNum; nCnt++)
+		{
+			const Quad& quadA = m_quads[nCnt];
+			Group rect = { quadA.nLayer, 0, quadA.aVtx[0].pos.x, quadA.aVtx[0].pos.y, quadA.aVtx[3].pos.x, quadA.aVtx[3].pos.y, 0, 0 };
+
+			for (int nCnt2 = nCnt + 1; nCnt2 < nNum; nCnt2++)
+			{
+				const Quad& quadB = m_quads[nCnt2];
+
+				bool bBefore = (quadA.nLayer < quadB.nLayer) || (quadA.nLayer == quadB.nLayer && IsOverlap(rect, quadB));
+				bool bAfter = (quadA.nLayer > quadB.nLayer);
+
+				if ((bBefore && position[nCnt] > position[nCnt2]) || (bAfter && position[nCnt] < position[nCnt2]))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	};
+
+	// テスト用にアトラスへ入っていることにする
+	auto fillAtlas = [&](int nFirst, int nLast)
+	{
+		m_atlas.clear();
+
+		AtlasEntry white = {};
+		white.nIdxTexture = -1;
+		white.offset = D3DXVECTOR2((float)ATLAS_PADDING / ATLAS_SIZE, (float)ATLAS_PADDING / ATLAS_SIZE);
+		white.bPacked = true;
+		m_atlas.push_back(white);
+
+		for (int nIdx = nFirst; nIdx <= nLast; nIdx++)
+		{
+			AtlasEntry entry = {};
+			entry.nIdxTexture = nIdx;
+			entry.offset = D3DXVECTOR2((float)(nIdx % 4) * 0.25f, (float)(nIdx / 4) * 0.25f);
+			entry.scale = D3DXVECTOR2(0.125f, 0.125f);
+			entry.bPacked = true;
+			m_atlas.push_back(entry);
+		}
+	};
+
+	// --------------------------
+	// HUD相当の四角形(画面全体の暗幕・時間の数字とコロン・体力ゲージ・操作説明・アイテム欄)
+	// --------------------------
+	auto addHud = [&](void)
+	{
+		add(0.0f, 0.0f, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT, 0, 0);
+
+		for (int nCnt = 0; nCnt < 4; nCnt++)
+		{
+			float fX = 560.0f + nCnt * 40.0f + (nCnt >= 2 ? 20.0f : 0.0f);
+			add(fX, 20.0f, fX + 36.0f, 70.0f, 1, 0);
+		}
+
+		add(640.0f, 20.0f, 656.0f, 70.0f, 2, 0);
+
+		add(40.0f, 40.0f, 440.0f, 70.0f, 3, 0);
+		add(43.0f, 43.0f, 437.0f, 67.0f, -1, 0);
+		add(43.0f, 43.0f, 300.0f, 67.0f, -1, 0);
+
+		for (int nCnt = 0; nCnt < 8; nCnt++)
+		{
+			float fY = 400.0f + nCnt * 36.0f;
+			add(1000.0f, fY, 1032.0f, fY + 32.0f, 4 + nCnt % 3, 0);
+			add(1040.0f, fY, 1240.0f, fY + 32.0f, 7, 0);
+		}
+
+		for (int nCnt = 0; nCnt < 5; nCnt++)
+		{
+			float fX = 400.0f + nCnt * 90.0f;
+			add(fX, 620.0f, fX + 80.0f, 700.0f, 8, 0);
+
+			if (nCnt == 2)
+			{
+				add(fX - 5.0f, 615.0f, fX + 85.0f, 705.0f, 9, 0);
+			}
+
+			add(fX + 8.0f, 628.0f, fX + 72.0f, 692.0f, 10 + nCnt, 0);
+		}
+	};
+
+	addHud();
+
+	int nNumHud = (int)m_quads.size();
+
+	// アトラス無し
+	m_atlas.clear();
+	Build();
+	bool bHudOrder = checkOrder();
+
+	recorder.BeginFrame();
+	Render(&recorder, nullptr);
+
+	int nDrawBatch = recorder.GetDrawCount();
+	int nTexBatch = recorder.GetCount(CRenderRecorder::CMD_SET_TEXTURE);
+	int nUploadBatch = recorder.GetUploadCount();
+
+	// アトラスあり(画面全体の暗幕以外をアトラスに入れる)
+	addHud();
+	fillAtlas(1, 14);
+	Build();
+	bHudOrder = bHudOrder && checkOrder();
+
+	// UVがアトラスの中に置き換わっているか
+	bool bUV = true;
+	std::vector<VERTEX_2D> vtx((size_t)nNumHud * 4);
+	Expand(m_drawOrder.data(), nNumHud, vtx.data());
+
+	for (int nCnt = 0; nCnt < nNumHud; nCnt++)
+	{
+		int nIdx = m_drawOrder[nCnt];
+		int nAtlas = m_atlasId[nIdx];
+
+		if (m_quads[nIdx].nIdxTexture >= 1 && nAtlas < 0)
+		{
+			bUV = false;
+			continue;
+		}
+
+		if (nAtlas < 0)
+		{
+			continue;
+		}
+
+		const AtlasEntry& entry = m_atlas[nAtlas];
+		const D3DXVECTOR2& tex = vtx[(size_t)nCnt * 4 + 3].tex;
+
+		if (fabsf(tex.x - (entry.offset.x + entry.scale.x)) > 1.0e-5f || fabsf(tex.y - (entry.offset.y + entry.scale.y)) > 1.0e-5f)
+		{
+			bUV = false;
+		}
+	}
+
+	recorder.BeginFrame();
+	Render(&recorder, nullptr);
+
+	int nDrawAtlas = recorder.GetDrawCount();
+	int nTexAtlas = recorder.GetCount(CRenderRecorder::CMD_SET_TEXTURE);
+
+	// --------------------------
+	// ランダムな四角形で順番を確かめる
+	// --------------------------
+	bool bRandomOrder = true;
+	int nGroupTotal = 0;
+
+	for (int nSeed = 0; nSeed < TEST_SEED; nSeed++)
+	{
+		CRandom random(100 + nSeed);
+
+		for (int nCnt = 0; nCnt < TEST_RANDOM; nCnt++)
+		{
+			float fX = random.Range(0.0f, (float)SCREEN_WIDTH);
+			float fY = random.Range(0.0f, (float)SCREEN_HEIGHT);
+			float fW = random.Range(8.0f, 160.0f);
+			float fH = random.Range(8.0f, 160.0f);
+
+			add(fX, fY, fX + fW, fY + fH, random.Int(9) - 1, random.Int(3));
+		}
+
+		if (nSeed % 2 == 0)
+		{
+			m_atlas.clear();
+		}
+		else
+		{
+			fillAtlas(0, 3);
+		}
+
+		Build();
+
+		bRandomOrder = bRandomOrder && checkOrder();
+		nGroupTotal += (int)m_groups.size();
+
+		m_quads.clear();
+	}
+
+	m_atlas.clear();
+
+	bool bResult = bHudOrder && bRandomOrder && bUV && nDrawAtlas < nDrawBatch && nDrawBatch < nNumHud;
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "hud quads              : %d\n", nNumHud);
+	fprintf(pFile, "per object             : %d draws, %d texture sets, %d vb locks\n", nNumHud, nNumHud, nNumHud);
+	fprintf(pFile, "batch                  : %d draws, %d texture sets, %d vb locks\n", nDrawBatch, nTexBatch, nUploadBatch);
+	fprintf(pFile, "batch + atlas          : %d draws, %d texture sets\n", nDrawAtlas, nTexAtlas);
+	fprintf(pFile, "hud order kept         : %s\n", bHudOrder ? "yes" : "no");
+	fprintf(pFile, "atlas uv remapped      : %s\n", bUV ? "yes" : "no");
+	fprintf(pFile, "random order kept      : %s (%d seeds x %d quads, %.1f groups avg)\n", bRandomOrder ? "yes" : "no",
+		TEST_SEED, TEST_RANDOM, (float)nGroupTotal / TEST_SEED);
+	fprintf(pFile, "result                 : %s\n", bResult ? "ok" : "NG");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bResult;
+}
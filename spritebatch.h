@@ -0,0 +1,120 @@
+//=============================================================================
+//
+// 2Dスプライトまとめ描画処理 [spritebatch.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _SPRITEBATCH_H_// このマクロ定義がされていなかったら
+#define _SPRITEBATCH_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// 前方宣言
+//*****************************************************************************
+class CRenderDevice;
+class CTexture;
+
+//*****************************************************************************
+// 2Dスプライトまとめ描画クラス(画面座標の四角形を集め、重なりを崩さない範囲でテクスチャごとに1回で描く)
+//*****************************************************************************
+class CSpriteBatch
+{
+public:
+	// 描く四角形(頂点は左上・右上・左下・右下の順)
+	typedef struct
+	{
+		VERTEX_2D	aVtx[4];		// 頂点
+		int			nIdxTexture;	// テクスチャインデックス(-1ならテクスチャ無し)
+		int			nLayer;			// 重ね順(大きいほど後に描く。0～)
+	}Quad;
+
+	static HRESULT Init(void);
+	static void Uninit(void);
+	static void InvalidateDevice(void);
+	static void RestoreDevice(void);
+	static void Submit(const VERTEX_2D* pVtx, int nIdxTexture, int nLayer = 0);
+	static void Flush(void);
+	static void BeginFrame(void);
+	static void Clear(void);
+	static void RegisterAtlas(int nIdxTexture, bool bFit = false);
+	static bool RunTest(const char* filename);
+
+	static void SetRect(VERTEX_2D* pVtx, float fLeft, float fTop, float fRight, float fBottom);
+	static void SetTexRect(VERTEX_2D* pVtx, float fLeft, float fTop, float fRight, float fBottom);
+	static void SetColor(VERTEX_2D* pVtx, D3DCOLOR col);
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static int GetNumQuad(void) { return m_nNumQuad; }
+	static int GetNumDrawCall(void) { return m_nNumDrawCall; }
+	static int GetNumAtlas(void);
+
+private:
+	static constexpr int	BATCH_QUAD		= 4096;				// 1回の描画で描く最大の四角形数(16bitインデックスに収める)
+	static constexpr int	BUFFER_QUAD		= BATCH_QUAD * 2;	// 頂点バッファに入る四角形数(使い切ったら捨てて先頭から使う)
+	static constexpr int	RESERVE_QUAD	= 512;				// 最初に確保しておく四角形の数
+	static constexpr int	SEARCH_GROUP	= 16;				// 前のまとまりに合流できるか遡る数
+	static constexpr int	ATLAS_KEY		= -2;				// アトラスにまとめたテクスチャのキー
+	static constexpr int	ATLAS_SIZE		= 1024;				// アトラスの大きさ
+	static constexpr int	ATLAS_MAX_SOURCE = 256;				// アトラスに入れる画像の最大の大きさ
+	static constexpr int	ATLAS_PADDING	= 2;				// アトラスの画像同士の隙間(にじみ防止)
+	static constexpr float	ATLAS_UV_EPSILON = 0.001f;			// アトラスを使えるUVの範囲の誤差
+	static constexpr int	TEST_RANDOM		= 2000;				// 確認用のランダムな四角形の数
+	static constexpr int	TEST_SEED		= 8;				// 確認用の乱数系列の数
+
+	// 描く順番のまとまり(同じ重ね順・同じテクスチャ)
+	typedef struct
+	{
+		int		nLayer;		// 重ね順
+		int		nKey;		// テクスチャのキー
+		float	fLeft;		// 含む四角形の範囲
+		float	fTop;
+		float	fRight;
+		float	fBottom;
+		int		nNum;		// 四角形の数
+		int		nStart;		// 描く順番の先頭
+	}Group;
+
+	// アトラスに入れたテクスチャ
+	typedef struct
+	{
+		int					nIdxTexture;	// テクスチャインデックス
+		LPDIRECT3DTEXTURE9	pSource;		// 入れた時のテクスチャ(差し替わったら使わない)
+		D3DXVECTOR2			offset;			// アトラス内の左上
+		D3DXVECTOR2			scale;			// アトラス内の大きさ
+		bool				bPacked;		// アトラスに入っているか
+		bool				bDead;			// 入らない・差し替わったので使わない
+		bool				bFit;			// 大きければアトラスの幅に縮めて入れる(数字を横に並べた画像など)
+	}AtlasEntry;
+
+	static void Render(CRenderDevice* pDevice, CTexture* pTexture);
+	static void Build(void);
+	static void Expand(const int* pOrder, int nNum, VERTEX_2D* pVtx);
+	static bool IsOverlap(const Group& group, const Quad& quad);
+	static void GetRect(const Quad& quad, float& fLeft, float& fTop, float& fRight, float& fBottom);
+	static int FindAtlas(const Quad& quad);
+	static void UpdateAtlas(CTexture* pTexture);
+	static bool PackAtlas(AtlasEntry& entry, LPDIRECT3DTEXTURE9 pSource);
+	static void ResetAtlas(void);
+
+	static std::vector<Quad>				m_quads;		// 今回描く四角形
+	static std::vector<unsigned long long>	m_order;		// 重ね順で並べた順番(上位 : 重ね順、下位 : 積んだ順)
+	static std::vector<int>					m_groupId;		// 四角形ごとのまとまりの番号
+	static std::vector<int>					m_atlasId;		// 四角形ごとのアトラスの番号(-1なら使わない)
+	static std::vector<int>					m_drawOrder;	// 実際に描く順番
+	static std::vector<Group>				m_groups;		// まとまり
+	static std::vector<AtlasEntry>			m_atlas;		// アトラスに入れるテクスチャ
+	static LPDIRECT3DTEXTURE9				m_pAtlas;		// アトラス
+	static int								m_nShelfX;		// アトラスの今の段の書き込み位置
+	static int								m_nShelfY;		// アトラスの今の段の上端
+	static int								m_nShelfH;		// アトラスの今の段の高さ
+	static LPDIRECT3DVERTEXBUFFER9			m_pVtxBuff;		// 共通の動的頂点バッファ
+	static LPDIRECT3DINDEXBUFFER9			m_pIdxBuff;		// 四角形のインデックスバッファ
+	static int								m_nVtxCursor;	// 頂点バッファの次に書き込む四角形の位置
+	static int								m_nFrameQuad;		// 今回描いた四角形の数
+	static int								m_nFrameDrawCall;	// 今回の描画回数
+	static int								m_nNumQuad;			// 前回のフレームで描いた四角形の数
+	static int								m_nNumDrawCall;		// 前回のフレームの描画回数
+};
+
+#endif
@@ -1,47 +1,52 @@
 //=============================================================================
 //
-// Xe[g}V [state.h]
+// ステートマシン処理 [state.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 #ifndef _STATE_H_
 #define _STATE_H_
 
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "telemetry.h"
+
 template<typename OwnerType>
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class StateMachine;
 
 //*****************************************************************************
-// SĂ̏Ԃ̊ƂȂNX
+// 全ての状態の基底となるクラス
 //*****************************************************************************
-template<typename OwnerType> // ev[gŏԂǗΏۂ̌^w
+template<typename OwnerType> // テンプレート引数で状態を管理する対象の型を指定
 class StateBase
 {
 protected:
-	friend class StateMachine<OwnerType>; // Xe[g}VȊOĂяo֐ȂǂɃANZXłȂ悤
+	friend class StateMachine<OwnerType>; // ステートマシン以外から呼び出し関数などにアクセスできないように
 
-	// ԂJnƂɈxĂ΂鏈
-	virtual void OnStart(OwnerType* /*a_pOwner*/) {}// Xe[g̎擾ł悤
+	// 状態が開始したときに一度だけ呼ばれる処理
+	virtual void OnStart(OwnerType* /*a_pOwner*/) {}// ステートの持ち主を引数から取得できるように
 
-	// ԂXVƂɌĂ΂鏈
+	// 状態が更新するときに呼ばれる処理
 	virtual void OnUpdate(OwnerType* /*a_pOwner*/) {}
 
-	// ԂIƂɈxĂ΂鏈
+	// 状態が終了したときに一度だけ呼ばれる処理
 	virtual void OnExit(OwnerType* /*a_pOwner*/) {}
 
 private:
 
-	// ̏ԂǗĂXe[g}V[Zbg
+	// この状態を管理しているステートマシーンをセット
 	void SetMachine(StateMachine<OwnerType>* a_pMachine)
 	{
 		m_pMachine = a_pMachine;
 	}
 
-	// Jn֐}VĂԂ߂̊֐
-	void CallStart(OwnerType* a_pOwner) // z֐}VSɌĂԂ߂̊֐ǉ
+	// 開始関数をマシンから呼ぶための関数
+	void CallStart(OwnerType* a_pOwner) // 仮想関数をマシンが安全に呼ぶための関数を追加
 	{
 		if (m_pMachine == nullptr || a_pOwner == nullptr)
 		{
@@ -50,7 +55,7 @@ private:
 		OnStart(a_pOwner);
 	}
 
-	// XV֐}VĂԂ߂̊֐
+	// 更新関数をマシンから呼ぶための関数
 	void CallUpdate(OwnerType* a_pOwner)
 	{
 		if (m_pMachine == nullptr || a_pOwner == nullptr)
@@ -60,7 +65,7 @@ private:
 		OnUpdate(a_pOwner);
 	}
 
-	// I֐}VĂԂ߂̊֐
+	// 終了関数をマシンから呼ぶための関数
 	void CallExit(OwnerType* a_pOwner)
 	{
 		if (m_pMachine == nullptr || a_pOwner == nullptr)
@@ -72,18 +77,18 @@ private:
 
 protected:
 
-	StateMachine<OwnerType>* m_pMachine = nullptr; // ̃Xe[gǗĂXe[g}Ṽ|C^ۑ
+	StateMachine<OwnerType>* m_pMachine = nullptr; // このステートを管理しているステートマシンのポインタを保存
 
-	// I[i[̃|C^
+	// オーナーのポインタ
 	OwnerType* m_pOwner = nullptr;
 };
 
 
 //*****************************************************************************
-// ԂǗNX
+// 状態を管理するクラス
 //*****************************************************************************
-// ev[g͏ԂǗΏۂ̌^
-template<typename OwnerType> // ev[gŏԂǗΏۂ̌^w
+// テンプレート引数は状態を管理する対象の型
+template<typename OwnerType> // テンプレート引数で状態を管理する対象の型を指定
 class StateMachine
 {
 public:
@@ -93,60 +98,63 @@ public:
 
 	}
 
-	// Xe[g}V̊Jn֐
-	void Start(OwnerType* a_pOwner) // ɃI[i[Zbg
+	// ステートマシンの開始関数
+	void Start(OwnerType* a_pOwner) // 初期化時にオーナーをセット
 	{
 		m_pOwner = a_pOwner;
 		m_fnChangeState = []() {};
 	}
 
-	// ԂύX֐
-	// ̓Xe[g̃RXgN^ɓnl
-	// Xe[g̕ύX֐|C^̒ɕߍXVIɌĂ
-	template<typename StateType, typename...ArgType>// Xe[ǧ^w肵֐ŃCX^X쐬ARXgN^ɒln
+	// 状態を変更する関数
+	// 引き数はステートのコンストラクタに渡す値
+	// ステートの変更処理を関数ポインタの中に閉じ込め更新が終わった後に呼ぶ
+	template<typename StateType, typename...ArgType>// ステートの型を指定したら関数内でインスタンスを作成し、コンストラクタに値を渡せる
 	void ChangeState(ArgType...a_args)
 	{
-		// Xe[g̕ύX߂i[
-		m_fnChangeState = [&]() // Xe[g̕ύX߂֐|C^Ɋi[
+		// ステートの変更命令を格納する
+		m_fnChangeState = [&]() // ステートの変更命令を関数ポインタに格納する
 		{
-			// I[i[ZbgĂȂΉȂ
+			// オーナーがセットされてなければ何もしない
 			if (m_pOwner == nullptr)
 			{
 				return;
 			}
 
-			// łɃXe[gZbgĂI
+			// もしすでにステートがセットされてたら終了する
 			if (m_spNowState != nullptr)
 			{
 				m_spNowState->CallExit(m_pOwner);
 				m_spNowState = nullptr;
 			}
 
-			// VXe[g쐬
+			// 新しいステートを作成
 			m_spNowState = std::make_shared<StateType>(a_args...);
 			if (m_spNowState == nullptr)
 			{
 				return;
 			}
 
-			// VXe[gɂ̃}V[Zbg
+			// ステートの遷移回数の計測
+			CTelemetry::Add(CTelemetry::COUNTER_STATE_CHANGE);
+
+			// 新しいステートにこのマシーンをセット
 			m_spNowState->SetMachine(this);
 
-			// Xe[g̊Jn
+			// ステートの開始
 			m_spNowState->CallStart(m_pOwner);
 		};
 	}
 
 
-	// Ԃ̍XV
+	// 状態の更新
 	void Update(void)
 	{
-		// Xe[g̕ύX߂Ώ
-		m_fnChangeState(); // Xe[gXVOɃXe[g̕ύX߂Ύs		
+		// ステートの変更命令があれば処理する
+		m_fnChangeState(); // ステートが更新する前にステートの変更命令があれば実行		
 		m_fnChangeState = []() {};
 
 
-		// Xe[gZbgĂXV
+		// ステートがセットされてたら更新する
 		if (m_spNowState != nullptr)
 		{
 			m_spNowState->CallUpdate(m_pOwner);
@@ -155,13 +163,13 @@ public:
 
 private:
 
-	// Ԃ̎̃|C^
+	// 状態の持ち主のポインタ
 	OwnerType* m_pOwner = nullptr;
 
-	// ̃Xe[g
+	// 今のステート
 	std::shared_ptr<StateBase<OwnerType>> m_spNowState = nullptr;
 
-	// Xe[g̕ύX߂ۑĂ֐IuWFNg
+	// ステートの変更命令を保存しておく関数オブジェクト
 	std::function<void()> m_fnChangeState;
 
 };
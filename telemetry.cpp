@@ -0,0 +1,203 @@
+//=============================================================================
+//
+// 計測カウンター処理 [telemetry.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "telemetry.h"
+#include "manager.h"
+#include "memorymanager.h"
+#include "json.hpp"
+#include "iomanip"
+
+// JSONの使用
+using json = nlohmann::json;
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+const char* CTelemetry::m_apName[COUNTER_MAX] =
+{
+	"object_prio0",
+	"object_prio1",
+	"object_prio2",
+	"object_prio3",
+	"object_prio4",
+	"object_prio5",
+	"object_prio6",
+	"object_prio7",
+	"object_all",
+	"block_draw",
+	"draw_subset",
+	"buffer_lock",
+	"texture_set",
+	"effect",
+	"sound_voice",
+	"contact_pair",
+	"state_change",
+	"shader_switch",
+	"frame_alloc",
+	"frame_alloc_bytes",
+	"cull_block_total",
+	"cull_block_visible",
+	"cull_prop_total",
+	"cull_prop_visible",
+	"cull_chara_total",
+	"cull_chara_visible",
+	"cull_effect_total",
+	"cull_effect_visible",
+	"cull_terrain_total",
+	"cull_terrain_visible",
+	"shadow_volume",
+	"shadow_blob",
+	"light_upload",
+	"orbit_lock",
+};
+std::atomic<int> CTelemetry::m_aCounter[COUNTER_MAX] = {};
+int CTelemetry::m_aLast[COUNTER_MAX] = {};
+int CTelemetry::m_aPeak[COUNTER_MAX] = {};
+long long CTelemetry::m_aSum[COUNTER_MAX] = {};
+int CTelemetry::m_nFrame = 0;
+FILE* CTelemetry::m_pCsv = nullptr;
+
+//=============================================================================
+// フレーム終了処理(値の確定とリセット)
+//=============================================================================
+void CTelemetry::EndFrame(void)
+{
+	// 状態を表すカウンターの取得
+	SampleGauges();
+
+	for (int nCnt = 0; nCnt < COUNTER_MAX; nCnt++)
+	{
+		int nValue = m_aCounter[nCnt].exchange(0, std::memory_order_relaxed);
+
+		m_aLast[nCnt] = nValue;
+		m_aSum[nCnt] += nValue;
+
+		if (nValue > m_aPeak[nCnt])
+		{
+			m_aPeak[nCnt] = nValue;
+		}
+	}
+
+	// CSVに1行書き出す
+	if (m_pCsv != nullptr)
+	{
+		fprintf(m_pCsv, "%d", m_nFrame);
+
+		for (int nCnt = 0; nCnt < COUNTER_MAX; nCnt++)
+		{
+			fprintf(m_pCsv, ",%d", m_aLast[nCnt]);
+		}
+
+		fprintf(m_pCsv, "\n");
+	}
+
+	m_nFrame++;
+}
+//=============================================================================
+// 状態を表すカウンターの取得処理
+//=============================================================================
+void CTelemetry::SampleGauges(void)
+{
+	// 優先順位ごとのオブジェクト数
+	for (int nPriority = 0; nPriority <= COUNTER_OBJECT_PRIO7 - COUNTER_OBJECT_PRIO0; nPriority++)
+	{
+		Set((COUNTER)(COUNTER_OBJECT_PRIO0 + nPriority), CObject::GetNumObject(nPriority));
+	}
+
+	Set(COUNTER_OBJECT_ALL, CObject::GetNumObject());
+
+	// 再生中のソースボイス数
+	CSound* pSound = CManager::GetSound();
+
+	if (pSound != nullptr)
+	{
+		Set(COUNTER_SOUND_VOICE, pSound->GetActiveVoiceCount());
+	}
+
+	// フレームアロケーターの確保状況
+	const CLinearAllocator& frame = CMemoryManager::GetFrameAllocator();
+
+	Set(COUNTER_FRAME_ALLOC, frame.GetAllocCount());
+	Set(COUNTER_FRAME_ALLOC_BYTES, (int)frame.GetUsedBytes());
+}
+//=============================================================================
+// CSV出力の開始処理
+//=============================================================================
+bool CTelemetry::StartCsv(const char* filename)
+{
+	// 書き出し中なら一度閉じる
+	StopCsv();
+
+	m_pCsv = fopen(filename, "w");
+
+	if (m_pCsv == nullptr)
+	{
+		return false;
+	}
+
+	// ヘッダー行
+	fprintf(m_pCsv, "frame");
+
+	for (int nCnt = 0; nCnt < COUNTER_MAX; nCnt++)
+	{
+		fprintf(m_pCsv, ",%s", m_apName[nCnt]);
+	}
+
+	fprintf(m_pCsv, "\n");
+
+	return true;
+}
+//=============================================================================
+// CSV出力の終了処理
+//=============================================================================
+void CTelemetry::StopCsv(void)
+{
+	if (m_pCsv != nullptr)
+	{
+		// ファイルを閉じる
+		fclose(m_pCsv);
+		m_pCsv = nullptr;
+	}
+}
+//=============================================================================
+// 集計結果のJSON出力処理
+//=============================================================================
+bool CTelemetry::SaveJson(const char* filename)
+{
+	// JSONオブジェクト
+	json j;
+
+	j["frames"] = m_nFrame;
+
+	for (int nCnt = 0; nCnt < COUNTER_MAX; nCnt++)
+	{
+		json c;
+		c["last"] = m_aLast[nCnt];
+		c["peak"] = m_aPeak[nCnt];
+		c["avg"] = (m_nFrame > 0) ? (double)m_aSum[nCnt] / m_nFrame : 0.0;
+
+		j["counters"][m_apName[nCnt]] = c;
+	}
+
+	// 出力ファイルストリーム
+	std::ofstream file(filename);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file << std::setw(4) << j;
+
+	// ファイルを閉じる
+	file.close();
+
+	return true;
+}
@@ -0,0 +1,93 @@
+//=============================================================================
+//
+// 計測カウンター処理 [telemetry.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _TELEMETRY_H_// このマクロ定義がされていなかったら
+#define _TELEMETRY_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "atomic"
+
+//*****************************************************************************
+// 計測カウンタークラス(毎フレームリセットされる名前付きカウンター)
+//*****************************************************************************
+class CTelemetry
+{
+public:
+	// カウンターの種類
+	typedef enum
+	{
+		COUNTER_OBJECT_PRIO0 = 0,	// 優先順位ごとのオブジェクト数
+		COUNTER_OBJECT_PRIO1,
+		COUNTER_OBJECT_PRIO2,
+		COUNTER_OBJECT_PRIO3,
+		COUNTER_OBJECT_PRIO4,
+		COUNTER_OBJECT_PRIO5,
+		COUNTER_OBJECT_PRIO6,
+		COUNTER_OBJECT_PRIO7,
+		COUNTER_OBJECT_ALL,			// オブジェクトの総数
+		COUNTER_BLOCK_DRAW,			// 描画したブロック数
+		COUNTER_DRAW_SUBSET,		// DrawSubsetの呼び出し回数
+		COUNTER_BUFFER_LOCK,		// 頂点・インデックスバッファのロック回数
+		COUNTER_TEXTURE_SET,		// テクスチャの設定回数
+		COUNTER_EFFECT,				// 更新したエフェクト数
+		COUNTER_SOUND_VOICE,		// 再生中のソースボイス数
+		COUNTER_CONTACT_PAIR,		// 物理の接触ペア数
+		COUNTER_STATE_CHANGE,		// ステートの遷移回数
+		COUNTER_SHADER_SWITCH,		// シェーダーの切り替え回数
+		COUNTER_FRAME_ALLOC,		// フレームアロケーターの確保回数
+		COUNTER_FRAME_ALLOC_BYTES,	// フレームアロケーターの確保バイト数
+		COUNTER_CULL_BLOCK_TOTAL,	// カリング対象のブロック数(種類ごとに総数・描画数の順で並べる)
+		COUNTER_CULL_BLOCK_VISIBLE,
+		COUNTER_CULL_PROP_TOTAL,	// カリング対象の小物数
+		COUNTER_CULL_PROP_VISIBLE,
+		COUNTER_CULL_CHARA_TOTAL,	// カリング対象のキャラクター数
+		COUNTER_CULL_CHARA_VISIBLE,
+		COUNTER_CULL_EFFECT_TOTAL,	// カリング対象のエフェクト数
+		COUNTER_CULL_EFFECT_VISIBLE,
+		COUNTER_CULL_TERRAIN_TOTAL,	// カリング対象の地形の区画数
+		COUNTER_CULL_TERRAIN_VISIBLE,
+		COUNTER_SHADOW_VOLUME,		// ステンシルで描いた影の数
+		COUNTER_SHADOW_BLOB,		// 丸影で描いた影の数
+		COUNTER_LIGHT_UPLOAD,		// ライトの設定・有効切り替えの回数
+		COUNTER_ORBIT_LOCK,			// 軌跡の頂点バッファのロック回数
+		COUNTER_MAX
+	}COUNTER;
+
+	static void Add(COUNTER counter, int nValue = 1) { m_aCounter[counter].fetch_add(nValue, std::memory_order_relaxed); }
+	static void Set(COUNTER counter, int nValue) { m_aCounter[counter].store(nValue, std::memory_order_relaxed); }
+	static void EndFrame(void);
+	static bool StartCsv(const char* filename);
+	static void StopCsv(void);
+	static bool SaveJson(const char* filename);
+
+	//*****************************************************************************
+	// flagment関数
+	//*****************************************************************************
+	static bool IsRecording(void) { return m_pCsv != nullptr; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	static const char* GetName(COUNTER counter) { return m_apName[counter]; }
+	static int GetValue(COUNTER counter) { return m_aLast[counter]; }
+	static int GetPeak(COUNTER counter) { return m_aPeak[counter]; }
+	static int GetFrame(void) { return m_nFrame; }
+
+private:
+	static void SampleGauges(void);
+
+	static const char*		m_apName[COUNTER_MAX];		// カウンターの名前
+	static std::atomic<int>	m_aCounter[COUNTER_MAX];	// 現在のフレームの値
+	static int				m_aLast[COUNTER_MAX];		// 前フレームの値
+	static int				m_aPeak[COUNTER_MAX];		// 最大値
+	static long long		m_aSum[COUNTER_MAX];		// 合計値(平均算出用)
+	static int				m_nFrame;					// 計測したフレーム数
+	static FILE*			m_pCsv;						// CSV出力先
+};
+
+#endif
@@ -0,0 +1,395 @@
+//=============================================================================
+//
+// 地形のLOD選択処理 [terrainlod.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "terrainlod.h"
+
+//=============================================================================
+// 距離からLODを選ぶ処理
+//=============================================================================
+int CTerrainLod::SelectLod(float fDistance, int nMaxLod)
+{
+	int nLod = 0;
+	float fLimit = LOD_BASE_DISTANCE;
+
+	// 距離が倍になるごとに1段粗くする
+	while (nLod < nMaxLod && fDistance > fLimit)
+	{
+		nLod++;
+		fLimit *= 2.0f;
+	}
+
+	return nLod;
+}
+//=============================================================================
+// チャンクで使える最大LODの計算処理(間隔でセル数が割り切れる段まで)
+//=============================================================================
+int CTerrainLod::CalcMaxLod(int nCellX, int nCellZ)
+{
+	int nLod = 0;
+
+	while (nLod < MAX_LOD)
+	{
+		int nStep = 1 << (nLod + 1);
+
+		if (nCellX % nStep != 0 || nCellZ % nStep != 0)
+		{
+			break;
+		}
+
+		nLod++;
+	}
+
+	return nLod;
+}
+//=============================================================================
+// 辺の頂点間隔の計算処理(隣の方が粗い時だけ隣に合わせる)
+//=============================================================================
+int CTerrainLod::CalcEdgeStep(int nLod, int nNeighborLod)
+{
+	return 1 << std::max(nLod, nNeighborLod);
+}
+//=============================================================================
+// インデックスバッファを共有するためのキーの作成処理
+//=============================================================================
+unsigned long long CTerrainLod::MakeKey(int nCellX, int nCellZ, int nLod, const int anEdgeStep[EDGE_MAX])
+{
+	unsigned long long key = 0;
+
+	key |= (unsigned long long)(nCellX & 0xff);
+	key |= (unsigned long long)(nCellZ & 0xff) << 8;
+	key |= (unsigned long long)(nLod & 0xf) << 16;
+
+	for (int nCnt = 0; nCnt < EDGE_MAX; nCnt++)
+	{
+		key |= (unsigned long long)(anEdgeStep[nCnt] & 0xff) << (20 + nCnt * 8);
+	}
+
+	return key;
+}
+//=============================================================================
+// インデックスの生成処理(三角形リスト、戻り値はポリゴン数)
+//=============================================================================
+int CTerrainLod::BuildIndices(int nCellX, int nCellZ, int nLod, const int anEdgeStep[EDGE_MAX], std::vector<WORD>* pOut)
+{
+	pOut->clear();
+
+	int nStep = 1 << nLod;
+	int nPitch = nCellX + 1;
+
+	// 辺の頂点を隣の間隔に寄せて、隣が粗い時の隙間(Tジャンクション)を無くす
+	auto getIndex = [&](int nX, int nZ)
+	{
+		if (nZ == 0)
+		{
+			nX = Snap(nX, anEdgeStep[EDGE_TOP]);
+		}
+		else if (nZ == nCellZ)
+		{
+			nX = Snap(nX, anEdgeStep[EDGE_BOTTOM]);
+		}
+
+		if (nX == 0)
+		{
+			nZ = Snap(nZ, anEdgeStep[EDGE_LEFT]);
+		}
+		else if (nX == nCellX)
+		{
+			nZ = Snap(nZ, anEdgeStep[EDGE_RIGHT]);
+		}
+
+		return (WORD)(nZ * nPitch + nX);
+	};
+
+	// 三角形の追加(寄せて潰れたものは積まない)
+	auto addTriangle = [&](WORD a, WORD b, WORD c)
+	{
+		if (a == b || b == c || c == a)
+		{
+			return;
+		}
+
+		pOut->push_back(a);
+		pOut->push_back(b);
+		pOut->push_back(c);
+	};
+
+	for (int nZ = 0; nZ < nCellZ; nZ += nStep)
+	{
+		for (int nX = 0; nX < nCellX; nX += nStep)
+		{
+			WORD v00 = getIndex(nX, nZ);
+			WORD v10 = getIndex(nX + nStep, nZ);
+			WORD v01 = getIndex(nX, nZ + nStep);
+			WORD v11 = getIndex(nX + nStep, nZ + nStep);
+
+			// 元の帯状ポリゴンと同じ向き(上から見て時計回り)
+			addTriangle(v01, v00, v11);
+			addTriangle(v11, v00, v10);
+		}
+	}
+
+	return (int)pOut->size() / 3;
+}
+//=============================================================================
+// LOD選択とインデックス生成の確認処理(デバイスを作らずに調べて結果をファイルに書く)
+//=============================================================================
+bool CTerrainLod::RunTest(const char* filename)
+{
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	bool bAllPass = true;
+
+	auto report = [&](const char* pName, bool bPass, const char* pDetail)
+	{
+		fprintf(pFile, "%-28s : %s  %s\n", pName, bPass ? "pass" : "FAIL", pDetail);
+
+		if (!bPass)
+		{
+			bAllPass = false;
+		}
+	};
+
+	char szDetail[256];
+
+	// 距離の境目(LOD_BASE_DISTANCEちょうどまではLOD0、以降は倍ごとに1段。最大LODで止まる)
+	{
+		static const struct
+		{
+			float	fRate;		// LOD_BASE_DISTANCEに対する距離の割合
+			int		nMaxLod;	// 使える最大LOD
+			int		nExpect;	// 選ばれるはずのLOD
+		} CASES[] =
+		{
+			{ 0.0f,		MAX_LOD,	0 },
+			{ 1.0f,		MAX_LOD,	0 },
+			{ 1.001f,	MAX_LOD,	1 },
+			{ 2.0f,		MAX_LOD,	1 },
+			{ 2.001f,	MAX_LOD,	2 },
+			{ 4.0f,		MAX_LOD,	2 },
+			{ 4.001f,	MAX_LOD,	3 },
+			{ 100.0f,	MAX_LOD,	3 },
+			{ 100.0f,	1,			1 },
+			{ 1.001f,	0,			0 },
+		};
+
+		int nNumFailed = 0;
+
+		for (const auto& test : CASES)
+		{
+			if (SelectLod(LOD_BASE_DISTANCE * test.fRate, test.nMaxLod) != test.nExpect)
+			{
+				nNumFailed++;
+			}
+		}
+
+		sprintf_s(szDetail, "%d cases, %d failed", (int)(sizeof(CASES) / sizeof(CASES[0])), nNumFailed);
+		report("select lod thresholds", nNumFailed == 0, szDetail);
+	}
+
+	// マップの端で半端になったチャンクの最大LOD(間隔で両方の辺が割り切れる段まで)
+	{
+		static const struct
+		{
+			int nCellX;		// 横のセル数
+			int nCellZ;		// 縦のセル数
+			int nExpect;	// 最大LOD
+		} CASES[] =
+		{
+			{ 16, 16, 3 },
+			{ 12, 16, 2 },
+			{ 16, 12, 2 },
+			{ 10, 16, 1 },
+			{ 16, 10, 1 },
+			{ 6, 12, 1 },
+			{ 7, 16, 0 },
+			{ 16, 1, 0 },
+			{ 4, 16, 2 },
+			{ 24, 8, 3 },
+		};
+
+		int nNumFailed = 0;
+
+		for (const auto& test : CASES)
+		{
+			if (CalcMaxLod(test.nCellX, test.nCellZ) != test.nExpect)
+			{
+				nNumFailed++;
+			}
+		}
+
+		sprintf_s(szDetail, "%d cases, %d failed", (int)(sizeof(CASES) / sizeof(CASES[0])), nNumFailed);
+		report("max lod for partial chunks", nNumFailed == 0, szDetail);
+	}
+
+	// 辺の間隔の組み合わせを全て作り、隙間・潰れた三角形・向きの乱れが無いかを調べる
+	{
+		static const int SIZES[][2] = { { 16, 16 }, { 12, 16 }, { 16, 10 }, { 6, 12 }, { 7, 16 }, { 4, 16 } };
+
+		int nNumCase = 0;
+		int nNumTJunction = 0;		// 隣の間隔に無い辺の頂点を使った、または隣の頂点を使わなかった辺の数
+		int nNumDegenerate = 0;		// 面積の無い三角形の数
+		int nNumWinding = 0;		// 向きが逆の三角形の数
+		int nNumCoverage = 0;		// 三角形の面積の合計がチャンクと合わない組の数
+		int nNumOutOfRange = 0;		// 範囲外のインデックスを含む組の数
+		std::vector<WORD> indices;
+
+		for (const auto& size : SIZES)
+		{
+			int nCellX = size[0];
+			int nCellZ = size[1];
+			int nPitch = nCellX + 1;
+			int nMaxLod = CalcMaxLod(nCellX, nCellZ);
+
+			// 辺の長さ(左右はZ方向、上下はX方向)
+			const int anEdgeLength[EDGE_MAX] = { nCellZ, nCellZ, nCellX, nCellX };
+
+			for (int nLod = 0; nLod <= nMaxLod; nLod++)
+			{
+				// 辺ごとに使える間隔(自分以上で、隣のチャンクも割り切れる間隔だけ。ゲームでは隣も同じ長さの辺を持つ)
+				std::vector<int> aSteps[EDGE_MAX];
+				int nNumCombo = 1;
+
+				for (int nEdge = 0; nEdge < EDGE_MAX; nEdge++)
+				{
+					for (int nNeighborLod = nLod; nNeighborLod <= MAX_LOD; nNeighborLod++)
+					{
+						int nStep = CalcEdgeStep(nLod, nNeighborLod);
+
+						if (anEdgeLength[nEdge] % nStep == 0)
+						{
+							aSteps[nEdge].push_back(nStep);
+						}
+					}
+
+					nNumCombo *= (int)aSteps[nEdge].size();
+				}
+
+				for (int nCombo = 0; nCombo < nNumCombo; nCombo++)
+				{
+					// 組の番号を辺ごとの間隔に分ける
+					int anEdgeStep[EDGE_MAX];
+					int nRest = nCombo;
+
+					for (int nEdge = 0; nEdge < EDGE_MAX; nEdge++)
+					{
+						anEdgeStep[nEdge] = aSteps[nEdge][nRest % aSteps[nEdge].size()];
+						nRest /= (int)aSteps[nEdge].size();
+					}
+
+					int nNumPrimitive = BuildIndices(nCellX, nCellZ, nLod, anEdgeStep, &indices);
+
+					nNumCase++;
+
+					// 辺ごとに使った頂点の位置
+					std::vector<bool> abUsed[EDGE_MAX];
+
+					for (int nEdge = 0; nEdge < EDGE_MAX; nEdge++)
+					{
+						abUsed[nEdge].assign(anEdgeLength[nEdge] + 1, false);
+					}
+
+					bool bInRange = (nNumPrimitive * 3 == (int)indices.size());
+					long long nArea2 = 0;
+
+					for (size_t nCnt = 0; nCnt + 2 < indices.size(); nCnt += 3)
+					{
+						int anX[3], anZ[3];
+
+						for (int nCorner = 0; nCorner < 3; nCorner++)
+						{
+							int nIdx = indices[nCnt + nCorner];
+
+							if (nIdx >= nPitch * (nCellZ + 1))
+							{
+								bInRange = false;
+								nIdx = 0;
+							}
+
+							anX[nCorner] = nIdx % nPitch;
+							anZ[nCorner] = nIdx / nPitch;
+
+							if (anX[nCorner] == 0) { abUsed[EDGE_LEFT][anZ[nCorner]] = true; }
+							if (anX[nCorner] == nCellX) { abUsed[EDGE_RIGHT][anZ[nCorner]] = true; }
+							if (anZ[nCorner] == 0) { abUsed[EDGE_TOP][anX[nCorner]] = true; }
+							if (anZ[nCorner] == nCellZ) { abUsed[EDGE_BOTTOM][anX[nCorner]] = true; }
+						}
+
+						// 面積の2倍(行が増える向きに+Zを取るので、元の帯状ポリゴンと同じ向きなら正)
+						int nCross = (anX[1] - anX[0]) * (anZ[2] - anZ[0]) - (anZ[1] - anZ[0]) * (anX[2] - anX[0]);
+
+						if (nCross == 0)
+						{
+							nNumDegenerate++;
+						}
+						else if (nCross < 0)
+						{
+							nNumWinding++;
+						}
+
+						nArea2 += nCross;
+					}
+
+					if (!bInRange)
+					{
+						nNumOutOfRange++;
+					}
+
+					// 辺の頂点は隣と同じ間隔の位置だけを、抜けなく使う
+					for (int nEdge = 0; nEdge < EDGE_MAX; nEdge++)
+					{
+						for (int nPos = 0; nPos <= anEdgeLength[nEdge]; nPos++)
+						{
+							if (abUsed[nEdge][nPos] != (nPos % anEdgeStep[nEdge] == 0))
+							{
+								nNumTJunction++;
+								break;
+							}
+						}
+					}
+
+					if (nArea2 != 2LL * nCellX * nCellZ)
+					{
+						nNumCoverage++;
+					}
+				}
+			}
+		}
+
+		sprintf_s(szDetail, "%d cases", nNumCase);
+		report("edge combinations", nNumCase > 0, szDetail);
+
+		sprintf_s(szDetail, "%d edges", nNumTJunction);
+		report("no t-junction on edges", nNumTJunction == 0, szDetail);
+
+		sprintf_s(szDetail, "%d triangles", nNumDegenerate);
+		report("no degenerate triangles", nNumDegenerate == 0, szDetail);
+
+		sprintf_s(szDetail, "%d triangles", nNumWinding);
+		report("consistent winding", nNumWinding == 0, szDetail);
+
+		sprintf_s(szDetail, "%d cases", nNumCoverage);
+		report("area covers chunk", nNumCoverage == 0, szDetail);
+
+		sprintf_s(szDetail, "%d cases", nNumOutOfRange);
+		report("indices in range", nNumOutOfRange == 0, szDetail);
+	}
+
+	fprintf(pFile, "\nresult : %s\n", bAllPass ? "pass" : "FAIL");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bAllPass;
+}
@@ -0,0 +1,41 @@
+//=============================================================================
+//
+// 地形のLOD選択処理 [terrainlod.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _TERRAINLOD_H_// このマクロ定義がされていなかったら
+#define _TERRAINLOD_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// 地形のLODクラス(チャンクのLOD選択とインデックス生成。描画デバイスは使わない)
+//*****************************************************************************
+class CTerrainLod
+{
+public:
+	// チャンクの辺
+	typedef enum
+	{
+		EDGE_LEFT = 0,	// -X側(列0)
+		EDGE_RIGHT,		// +X側(最後の列)
+		EDGE_TOP,		// +Z側(行0)
+		EDGE_BOTTOM,	// -Z側(最後の行)
+		EDGE_MAX
+	}EDGE;
+
+	static constexpr int	CHUNK_CELLS			= 16;		// 1チャンクのセル数(1辺)
+	static constexpr int	MAX_LOD				= 3;		// 最大LOD(間隔は 1 << LOD)
+	static constexpr float	LOD_BASE_DISTANCE	= 600.0f;	// LOD0で描く距離(以降は倍ごとに1段下げる)
+
+	static int SelectLod(float fDistance, int nMaxLod);
+	static int CalcMaxLod(int nCellX, int nCellZ);
+	static int CalcEdgeStep(int nLod, int nNeighborLod);
+	static unsigned long long MakeKey(int nCellX, int nCellZ, int nLod, const int anEdgeStep[EDGE_MAX]);
+	static int BuildIndices(int nCellX, int nCellZ, int nLod, const int anEdgeStep[EDGE_MAX], std::vector<WORD>* pOut);
+	static bool RunTest(const char* filename);
+
+private:
+	static int Snap(int nIdx, int nStep) { return (nIdx / nStep) * nStep; }
+};
+
+#endif
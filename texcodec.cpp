@@ -0,0 +1,705 @@
+//=============================================================================
+//
+// テクスチャ圧縮処理 [texcodec.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "texcodec.h"
+#include "algorithm"
+#include "cctype"
+#include "cmath"
+#include "cstdio"
+#include "cstdlib"
+#include "cstring"
+#include "fstream"
+#include "sstream"
+
+//*****************************************************************************
+// 定数宣言
+//*****************************************************************************
+namespace
+{
+	constexpr unsigned int DDS_MAGIC				= 0x20534444;	// "DDS "
+	constexpr unsigned int DDS_HEADER_SIZE			= 124;			// ヘッダーの大きさ
+	constexpr unsigned int DDS_PIXELFORMAT_SIZE		= 32;			// 画素形式の大きさ
+	constexpr unsigned int DDSD_CAPS				= 0x00000001;
+	constexpr unsigned int DDSD_HEIGHT				= 0x00000002;
+	constexpr unsigned int DDSD_WIDTH				= 0x00000004;
+	constexpr unsigned int DDSD_PITCH				= 0x00000008;
+	constexpr unsigned int DDSD_PIXELFORMAT			= 0x00001000;
+	constexpr unsigned int DDSD_MIPMAPCOUNT			= 0x00020000;
+	constexpr unsigned int DDSD_LINEARSIZE			= 0x00080000;
+	constexpr unsigned int DDPF_ALPHAPIXELS			= 0x00000001;
+	constexpr unsigned int DDPF_FOURCC				= 0x00000004;
+	constexpr unsigned int DDPF_RGB					= 0x00000040;
+	constexpr unsigned int DDSCAPS_COMPLEX			= 0x00000008;
+	constexpr unsigned int DDSCAPS_TEXTURE			= 0x00001000;
+	constexpr unsigned int DDSCAPS_MIPMAP			= 0x00400000;
+	constexpr unsigned int FOURCC_DXT1				= 0x31545844;	// "DXT1"
+	constexpr unsigned int FOURCC_DXT5				= 0x35545844;	// "DXT5"
+	constexpr int			BLOCK_PIXELS			= 16;			// 1ブロックの画素数
+	constexpr int			POWER_ITERATION			= 8;			// 主軸を求める反復回数
+}
+
+//=============================================================================
+// ミップマップの作成処理(2x2の平均で1x1まで縮小する。奇数の端は最後の画素を繰り返す)
+//=============================================================================
+void CTexCodec::BuildMips(const Image& top, std::vector<Image>* pOut)
+{
+	pOut->clear();
+	pOut->push_back(top);
+
+	while (pOut->back().nWidth > 1 || pOut->back().nHeight > 1)
+	{
+		const Image& src = pOut->back();
+
+		Image dst;
+		dst.nWidth = std::max(1, src.nWidth / 2);
+		dst.nHeight = std::max(1, src.nHeight / 2);
+		dst.pixels.resize((size_t)dst.nWidth * dst.nHeight * 4);
+
+		for (int nY = 0; nY < dst.nHeight; nY++)
+		{
+			int nY0 = std::min(nY * 2, src.nHeight - 1);
+			int nY1 = std::min(nY * 2 + 1, src.nHeight - 1);
+
+			for (int nX = 0; nX < dst.nWidth; nX++)
+			{
+				int nX0 = std::min(nX * 2, src.nWidth - 1);
+				int nX1 = std::min(nX * 2 + 1, src.nWidth - 1);
+
+				const unsigned char* p00 = &src.pixels[((size_t)nY0 * src.nWidth + nX0) * 4];
+				const unsigned char* p01 = &src.pixels[((size_t)nY0 * src.nWidth + nX1) * 4];
+				const unsigned char* p10 = &src.pixels[((size_t)nY1 * src.nWidth + nX0) * 4];
+				const unsigned char* p11 = &src.pixels[((size_t)nY1 * src.nWidth + nX1) * 4];
+				unsigned char* pDst = &dst.pixels[((size_t)nY * dst.nWidth + nX) * 4];
+
+				for (int nCh = 0; nCh < 4; nCh++)
+				{
+					pDst[nCh] = (unsigned char)((p00[nCh] + p01[nCh] + p10[nCh] + p11[nCh] + 2) / 4);
+				}
+			}
+		}
+
+		pOut->push_back(std::move(dst));
+	}
+}
+//=============================================================================
+// 透明な画素があるかの判定処理
+//=============================================================================
+bool CTexCodec::HasAlpha(const Image& image)
+{
+	for (size_t nCnt = 3; nCnt < image.pixels.size(); nCnt += 4)
+	{
+		if (image.pixels[nCnt] != 0xff)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+//=============================================================================
+// BC1(DXT1)の圧縮処理(1ブロック8バイト。透明は使わない)
+//=============================================================================
+void CTexCodec::EncodeBC1(const Image& image, std::vector<unsigned char>* pOut)
+{
+	int nBlockW = std::max(1, (image.nWidth + BLOCK_SIZE - 1) / BLOCK_SIZE);
+	int nBlockH = std::max(1, (image.nHeight + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+	pOut->resize((size_t)nBlockW * nBlockH * 8);
+
+	unsigned char aBlock[BLOCK_PIXELS * 4];
+
+	for (int nBlockY = 0; nBlockY < nBlockH; nBlockY++)
+	{
+		for (int nBlockX = 0; nBlockX < nBlockW; nBlockX++)
+		{
+			FetchBlock(image, nBlockX, nBlockY, aBlock);
+			EncodeColorBlock(aBlock, &(*pOut)[((size_t)nBlockY * nBlockW + nBlockX) * 8]);
+		}
+	}
+}
+//=============================================================================
+// BC3(DXT5)の圧縮処理(1ブロック16バイト。アルファ8バイト+色8バイト)
+//=============================================================================
+void CTexCodec::EncodeBC3(const Image& image, std::vector<unsigned char>* pOut)
+{
+	int nBlockW = std::max(1, (image.nWidth + BLOCK_SIZE - 1) / BLOCK_SIZE);
+	int nBlockH = std::max(1, (image.nHeight + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+	pOut->resize((size_t)nBlockW * nBlockH * 16);
+
+	unsigned char aBlock[BLOCK_PIXELS * 4];
+
+	for (int nBlockY = 0; nBlockY < nBlockH; nBlockY++)
+	{
+		for (int nBlockX = 0; nBlockX < nBlockW; nBlockX++)
+		{
+			unsigned char* pDst = &(*pOut)[((size_t)nBlockY * nBlockW + nBlockX) * 16];
+
+			FetchBlock(image, nBlockX, nBlockY, aBlock);
+			EncodeAlphaBlock(aBlock, pDst);
+			EncodeColorBlock(aBlock, pDst + 8);
+		}
+	}
+}
+//=============================================================================
+// DDSの書き出し処理(ミップマップは先頭から順に全て書く)
+//=============================================================================
+bool CTexCodec::WriteDDS(const char* pFilename, FORMAT format, const std::vector<Image>& mips)
+{
+	if (mips.empty() || format < 0 || format >= FORMAT_MAX)
+	{
+		return false;
+	}
+
+	const Image& top = mips[0];
+	bool bCompressed = (format != FORMAT_A8R8G8B8);
+	bool bMip = (mips.size() > 1);
+
+	// ヘッダー(リトルエンディアンで書く)
+	std::vector<unsigned char> data;
+
+	auto put = [&data](unsigned int nValue)
+	{
+		data.push_back((unsigned char)(nValue & 0xff));
+		data.push_back((unsigned char)((nValue >> 8) & 0xff));
+		data.push_back((unsigned char)((nValue >> 16) & 0xff));
+		data.push_back((unsigned char)((nValue >> 24) & 0xff));
+	};
+
+	unsigned int nBlockBytes = (format == FORMAT_DXT1) ? 8 : 16;
+	unsigned int nPitch = bCompressed
+		? (unsigned int)(std::max(1, (top.nWidth + BLOCK_SIZE - 1) / BLOCK_SIZE) * std::max(1, (top.nHeight + BLOCK_SIZE - 1) / BLOCK_SIZE)) * nBlockBytes
+		: (unsigned int)top.nWidth * 4;
+
+	put(DDS_MAGIC);
+	put(DDS_HEADER_SIZE);
+	put(DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT |
+		(bMip ? DDSD_MIPMAPCOUNT : 0) | (bCompressed ? DDSD_LINEARSIZE : DDSD_PITCH));
+	put((unsigned int)top.nHeight);
+	put((unsigned int)top.nWidth);
+	put(nPitch);
+	put(0);												// 深さ
+	put((unsigned int)mips.size());
+
+	for (int nCnt = 0; nCnt < 11; nCnt++)
+	{
+		put(0);											// 予約
+	}
+
+	// 画素形式
+	put(DDS_PIXELFORMAT_SIZE);
+
+	if (bCompressed)
+	{
+		put(DDPF_FOURCC);
+		put(format == FORMAT_DXT1 ? FOURCC_DXT1 : FOURCC_DXT5);
+		put(0);
+		put(0);
+		put(0);
+		put(0);
+		put(0);
+	}
+	else
+	{
+		put(DDPF_RGB | DDPF_ALPHAPIXELS);
+		put(0);
+		put(32);
+		put(0x00ff0000);
+		put(0x0000ff00);
+		put(0x000000ff);
+		put(0xff000000);
+	}
+
+	put(DDSCAPS_TEXTURE | (bMip ? (DDSCAPS_COMPLEX | DDSCAPS_MIPMAP) : 0));
+	put(0);
+	put(0);
+	put(0);
+	put(0);
+
+	// 画素
+	std::vector<unsigned char> blocks;
+
+	for (const auto& mip : mips)
+	{
+		switch (format)
+		{
+		case FORMAT_DXT1:
+			EncodeBC1(mip, &blocks);
+			data.insert(data.end(), blocks.begin(), blocks.end());
+			break;
+
+		case FORMAT_DXT5:
+			EncodeBC3(mip, &blocks);
+			data.insert(data.end(), blocks.begin(), blocks.end());
+			break;
+
+		default:
+			data.insert(data.end(), mip.pixels.begin(), mip.pixels.end());
+			break;
+		}
+	}
+
+	FILE* pFile = fopen(pFilename, "wb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	bool bWrite = (fwrite(data.data(), 1, data.size(), pFile) == data.size());
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bWrite;
+}
+//=============================================================================
+// 形式の名前の取得(変換結果の一覧に書く名前)
+//=============================================================================
+const char* CTexCodec::GetFormatName(FORMAT format)
+{
+	switch (format)
+	{
+	case FORMAT_A8R8G8B8:
+		return "A8R8G8B8";
+
+	case FORMAT_DXT1:
+		return "DXT1";
+
+	case FORMAT_DXT5:
+		return "DXT5";
+
+	default:
+		return "";
+	}
+}
+//=============================================================================
+// 変換結果の一覧の読み込み処理(タブ区切りで ハッシュ 更新日時 大きさ 形式 元画像 変換後)
+//=============================================================================
+bool CTexCodec::LoadManifest(const char* pFilename, std::vector<ManifestEntry>* pOut)
+{
+	pOut->clear();
+
+	std::ifstream ifs(pFilename);
+
+	if (!ifs)
+	{
+		return false;
+	}
+
+	std::string line;
+
+	while (std::getline(ifs, line))
+	{
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+
+		std::vector<std::string> fields;
+		std::istringstream iss(line);
+		std::string field;
+
+		while (std::getline(iss, field, '\t'))
+		{
+			fields.push_back(field);
+		}
+
+		// 古い形式の行は更新日時が無いので使わない(変換し直すまで元画像を読む)
+		if (fields.size() != 6)
+		{
+			continue;
+		}
+
+		ManifestEntry entry;
+		entry.hash = strtoull(fields[0].c_str(), nullptr, 16);
+		entry.time = strtoull(fields[1].c_str(), nullptr, 16);
+		entry.size = strtoull(fields[2].c_str(), nullptr, 10);
+		entry.format = fields[3];
+		entry.source = fields[4];
+		entry.cooked = fields[5];
+		pOut->push_back(entry);
+	}
+
+	return true;
+}
+//=============================================================================
+// 変換結果の一覧の書き出し処理
+//=============================================================================
+bool CTexCodec::SaveManifest(const char* pFilename, const std::vector<ManifestEntry>& entries)
+{
+	FILE* pFile = fopen(pFilename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "# texture cooker v%u\n", COOKER_VERSION);
+
+	for (const auto& entry : entries)
+	{
+		fprintf(pFile, "%016llx\t%016llx\t%llu\t%s\t%s\t%s\n",
+			entry.hash, entry.time, entry.size, entry.format.c_str(), entry.source.c_str(), entry.cooked.c_str());
+	}
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return true;
+}
+//=============================================================================
+// ファイルのハッシュの計算処理(FNV-1a、変換方法の版も混ぜる)
+//=============================================================================
+unsigned long long CTexCodec::HashFile(const char* pFilename, bool* pSuccess)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	hash = (hash ^ COOKER_VERSION) * 1099511628211ULL;
+
+	std::ifstream ifs(pFilename, std::ios::binary);
+
+	*pSuccess = (bool)ifs;
+
+	if (!ifs)
+	{
+		return 0;
+	}
+
+	char aBuf[4096];
+
+	while (ifs.read(aBuf, sizeof(aBuf)) || ifs.gcount() > 0)
+	{
+		for (std::streamsize nCnt = 0; nCnt < ifs.gcount(); nCnt++)
+		{
+			hash = (hash ^ (unsigned char)aBuf[nCnt]) * 1099511628211ULL;
+		}
+	}
+
+	return hash;
+}
+//=============================================================================
+// 圧縮しない画像の一覧の読み込み処理(1行に1つファイル名を書く。#から後は無視)
+//=============================================================================
+bool CTexCodec::LoadRules(const char* pFilename, std::vector<std::string>* pOut)
+{
+	pOut->clear();
+
+	std::ifstream ifs(pFilename);
+
+	if (!ifs)
+	{
+		return false;
+	}
+
+	std::string line;
+
+	while (std::getline(ifs, line))
+	{
+		size_t nComment = line.find('#');
+
+		if (nComment != std::string::npos)
+		{
+			line.erase(nComment);
+		}
+
+		size_t nBegin = line.find_first_not_of(" \t\r");
+		size_t nEnd = line.find_last_not_of(" \t\r");
+
+		if (nBegin == std::string::npos)
+		{
+			continue;
+		}
+
+		pOut->push_back(line.substr(nBegin, nEnd - nBegin + 1));
+	}
+
+	return true;
+}
+//=============================================================================
+// 圧縮しない画像かの判定処理(一覧にファイル名があるか。大文字と小文字は区別しない)
+//=============================================================================
+bool CTexCodec::IsUncompressed(const std::vector<std::string>& rules, const std::string& source)
+{
+	size_t nSlash = source.find_last_of("/\\");
+	std::string name = (nSlash != std::string::npos) ? source.substr(nSlash + 1) : source;
+
+	auto lower = [](std::string str)
+	{
+		for (auto& c : str)
+		{
+			c = (char)tolower((unsigned char)c);
+		}
+
+		return str;
+	};
+
+	name = lower(name);
+
+	for (const auto& rule : rules)
+	{
+		if (lower(rule) == name)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+//=============================================================================
+// 色ブロックの圧縮処理(色の主軸の両端を端点にし、4色の中から近い物を選ぶ)
+//=============================================================================
+void CTexCodec::EncodeColorBlock(const unsigned char* pBlock, unsigned char* pOut)
+{
+	// 平均
+	float afMean[3] = {};
+
+	for (int nCnt = 0; nCnt < BLOCK_PIXELS; nCnt++)
+	{
+		for (int nCh = 0; nCh < 3; nCh++)
+		{
+			afMean[nCh] += pBlock[nCnt * 4 + nCh];
+		}
+	}
+
+	for (int nCh = 0; nCh < 3; nCh++)
+	{
+		afMean[nCh] /= BLOCK_PIXELS;
+	}
+
+	// 共分散
+	float afCov[6] = {};	// bb bg br gg gr rr
+
+	for (int nCnt = 0; nCnt < BLOCK_PIXELS; nCnt++)
+	{
+		float fB = pBlock[nCnt * 4 + 0] - afMean[0];
+		float fG = pBlock[nCnt * 4 + 1] - afMean[1];
+		float fR = pBlock[nCnt * 4 + 2] - afMean[2];
+
+		afCov[0] += fB * fB;
+		afCov[1] += fB * fG;
+		afCov[2] += fB * fR;
+		afCov[3] += fG * fG;
+		afCov[4] += fG * fR;
+		afCov[5] += fR * fR;
+	}
+
+	// 主軸(べき乗法。一番ばらつく成分の列から始めると、逆向きに相関する色でも0にならない)
+	float afAxis[3];
+
+	if (afCov[0] >= afCov[3] && afCov[0] >= afCov[5])
+	{
+		afAxis[0] = afCov[0];
+		afAxis[1] = afCov[1];
+		afAxis[2] = afCov[2];
+	}
+	else if (afCov[3] >= afCov[5])
+	{
+		afAxis[0] = afCov[1];
+		afAxis[1] = afCov[3];
+		afAxis[2] = afCov[4];
+	}
+	else
+	{
+		afAxis[0] = afCov[2];
+		afAxis[1] = afCov[4];
+		afAxis[2] = afCov[5];
+	}
+
+	for (int nIter = 0; nIter < POWER_ITERATION; nIter++)
+	{
+		float fB = afAxis[0] * afCov[0] + afAxis[1] * afCov[1] + afAxis[2] * afCov[2];
+		float fG = afAxis[0] * afCov[1] + afAxis[1] * afCov[3] + afAxis[2] * afCov[4];
+		float fR = afAxis[0] * afCov[2] + afAxis[1] * afCov[4] + afAxis[2] * afCov[5];
+		float fMax = std::max(std::max(fabsf(fB), fabsf(fG)), fabsf(fR));
+
+		if (fMax <= 0.0f)
+		{
+			break;
+		}
+
+		afAxis[0] = fB / fMax;
+		afAxis[1] = fG / fMax;
+		afAxis[2] = fR / fMax;
+	}
+
+	// 主軸上で一番遠い2点を端点にする
+	float fMinDot = 0.0f, fMaxDot = 0.0f;
+	int nMin = 0, nMax = 0;
+
+	for (int nCnt = 0; nCnt < BLOCK_PIXELS; nCnt++)
+	{
+		float fDot = pBlock[nCnt * 4 + 0] * afAxis[0] + pBlock[nCnt * 4 + 1] * afAxis[1] + pBlock[nCnt * 4 + 2] * afAxis[2];
+
+		if (nCnt == 0 || fDot < fMinDot)
+		{
+			fMinDot = fDot;
+			nMin = nCnt;
+		}
+
+		if (nCnt == 0 || fDot > fMaxDot)
+		{
+			fMaxDot = fDot;
+			nMax = nCnt;
+		}
+	}
+
+	const unsigned char* pMax = &pBlock[nMax * 4];
+	const unsigned char* pMin = &pBlock[nMin * 4];
+
+	unsigned short color0 = PackColor565(pMax[2], pMax[1], pMax[0]);
+	unsigned short color1 = PackColor565(pMin[2], pMin[1], pMin[0]);
+
+	// color0 > color1 で4色になる(同じなら全て0番)
+	if (color0 < color1)
+	{
+		std::swap(color0, color1);
+	}
+
+	pOut[0] = (unsigned char)(color0 & 0xff);
+	pOut[1] = (unsigned char)(color0 >> 8);
+	pOut[2] = (unsigned char)(color1 & 0xff);
+	pOut[3] = (unsigned char)(color1 >> 8);
+
+	unsigned int nIndices = 0;
+
+	if (color0 != color1)
+	{
+		// 4色(端点を量子化した後の色で選ぶ)
+		int aPalette[4][3];
+		UnpackColor565(color0, &aPalette[0][2], &aPalette[0][1], &aPalette[0][0]);
+		UnpackColor565(color1, &aPalette[1][2], &aPalette[1][1], &aPalette[1][0]);
+
+		for (int nCh = 0; nCh < 3; nCh++)
+		{
+			aPalette[2][nCh] = (aPalette[0][nCh] * 2 + aPalette[1][nCh]) / 3;
+			aPalette[3][nCh] = (aPalette[0][nCh] + aPalette[1][nCh] * 2) / 3;
+		}
+
+		for (int nCnt = 0; nCnt < BLOCK_PIXELS; nCnt++)
+		{
+			int nBest = 0, nBestDist = 0;
+
+			for (int nPal = 0; nPal < 4; nPal++)
+			{
+				int nDist = 0;
+
+				for (int nCh = 0; nCh < 3; nCh++)
+				{
+					int nDiff = pBlock[nCnt * 4 + nCh] - aPalette[nPal][nCh];
+					nDist += nDiff * nDiff;
+				}
+
+				if (nPal == 0 || nDist < nBestDist)
+				{
+					nBest = nPal;
+					nBestDist = nDist;
+				}
+			}
+
+			nIndices |= (unsigned int)nBest << (nCnt * 2);
+		}
+	}
+
+	pOut[4] = (unsigned char)(nIndices & 0xff);
+	pOut[5] = (unsigned char)((nIndices >> 8) & 0xff);
+	pOut[6] = (unsigned char)((nIndices >> 16) & 0xff);
+	pOut[7] = (unsigned char)((nIndices >> 24) & 0xff);
+}
+//=============================================================================
+// アルファブロックの圧縮処理(最大と最小を端点にした8段階)
+//=============================================================================
+void CTexCodec::EncodeAlphaBlock(const unsigned char* pBlock, unsigned char* pOut)
+{
+	int nAlpha0 = 0, nAlpha1 = 255;
+
+	for (int nCnt = 0; nCnt < BLOCK_PIXELS; nCnt++)
+	{
+		nAlpha0 = std::max(nAlpha0, (int)pBlock[nCnt * 4 + 3]);
+		nAlpha1 = std::min(nAlpha1, (int)pBlock[nCnt * 4 + 3]);
+	}
+
+	pOut[0] = (unsigned char)nAlpha0;
+	pOut[1] = (unsigned char)nAlpha1;
+
+	unsigned long long nIndices = 0;
+
+	if (nAlpha0 != nAlpha1)
+	{
+		// alpha0 > alpha1 の時は端点の間を6段階で補間する
+		int aPalette[8];
+		aPalette[0] = nAlpha0;
+		aPalette[1] = nAlpha1;
+
+		for (int nPal = 2; nPal < 8; nPal++)
+		{
+			aPalette[nPal] = ((8 - nPal) * nAlpha0 + (nPal - 1) * nAlpha1) / 7;
+		}
+
+		for (int nCnt = 0; nCnt < BLOCK_PIXELS; nCnt++)
+		{
+			int nBest = 0, nBestDist = 256;
+
+			for (int nPal = 0; nPal < 8; nPal++)
+			{
+				int nDist = abs(pBlock[nCnt * 4 + 3] - aPalette[nPal]);
+
+				if (nDist < nBestDist)
+				{
+					nBest = nPal;
+					nBestDist = nDist;
+				}
+			}
+
+			nIndices |= (unsigned long long)nBest << (nCnt * 3);
+		}
+	}
+
+	for (int nCnt = 0; nCnt < 6; nCnt++)
+	{
+		pOut[2 + nCnt] = (unsigned char)((nIndices >> (nCnt * 8)) & 0xff);
+	}
+}
+//=============================================================================
+// 4x4ブロックの取り出し処理(画像の外は端の画素を繰り返す)
+//=============================================================================
+void CTexCodec::FetchBlock(const Image& image, int nBlockX, int nBlockY, unsigned char* pBlock)
+{
+	for (int nY = 0; nY < BLOCK_SIZE; nY++)
+	{
+		int nSrcY = std::min(nBlockY * BLOCK_SIZE + nY, image.nHeight - 1);
+
+		for (int nX = 0; nX < BLOCK_SIZE; nX++)
+		{
+			int nSrcX = std::min(nBlockX * BLOCK_SIZE + nX, image.nWidth - 1);
+
+			memcpy(&pBlock[(nY * BLOCK_SIZE + nX) * 4], &image.pixels[((size_t)nSrcY * image.nWidth + nSrcX) * 4], 4);
+		}
+	}
+}
+//=============================================================================
+// 565形式への変換
+//=============================================================================
+unsigned short CTexCodec::PackColor565(int nR, int nG, int nB)
+{
+	return (unsigned short)((((nR * 31 + 127) / 255) << 11) | (((nG * 63 + 127) / 255) << 5) | ((nB * 31 + 127) / 255));
+}
+//=============================================================================
+// 565形式からの変換
+//=============================================================================
+void CTexCodec::UnpackColor565(unsigned short color, int* pR, int* pG, int* pB)
+{
+	int nR = (color >> 11) & 0x1f;
+	int nG = (color >> 5) & 0x3f;
+	int nB = color & 0x1f;
+
+	*pR = (nR << 3) | (nR >> 2);
+	*pG = (nG << 2) | (nG >> 4);
+	*pB = (nB << 3) | (nB >> 2);
+}
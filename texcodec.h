@@ -0,0 +1,75 @@
+//=============================================================================
+//
+// テクスチャ圧縮処理 [texcodec.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _TEXCODEC_H_// このマクロ定義がされていなかったら
+#define _TEXCODEC_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "string"
+#include "vector"
+
+//*****************************************************************************
+// テクスチャ圧縮クラス(デバイスもD3DXも使わずに、ミップマップ・BC圧縮・DDSの書き出しを行う。
+// ゲームの-cooktexと、Linuxでも動く変換ツール(tools/texcook)の両方から使う)
+//*****************************************************************************
+class CTexCodec
+{
+public:
+	// 変換後の形式
+	typedef enum
+	{
+		FORMAT_A8R8G8B8 = 0,	// 圧縮しない
+		FORMAT_DXT1,			// BC1(不透明)
+		FORMAT_DXT5,			// BC3(透明あり)
+		FORMAT_MAX
+	}FORMAT;
+
+	// 画像(1画素はメモリ上でB・G・R・Aの順。D3DFMT_A8R8G8B8と同じ並び)
+	typedef struct
+	{
+		int							nWidth;		// 幅
+		int							nHeight;	// 高さ
+		std::vector<unsigned char>	pixels;		// 画素
+	}Image;
+
+	// 変換結果の一覧の1行
+	typedef struct
+	{
+		unsigned long long	hash;		// 元画像のハッシュ
+		unsigned long long	time;		// 元画像の更新日時(FILETIMEと同じ100ns単位)
+		unsigned long long	size;		// 元画像の大きさ
+		std::string			format;		// 変換後の形式(DXT1・DXT5・A8R8G8B8)
+		std::string			source;		// 元画像のパス
+		std::string			cooked;		// 変換後のパス
+	}ManifestEntry;
+
+	static constexpr unsigned int	COOKER_VERSION	= 3;	// 変換方法を変えたら上げる(全て変換し直す)
+	static constexpr int			BLOCK_SIZE		= 4;	// 圧縮の1ブロックの大きさ
+
+	static void BuildMips(const Image& top, std::vector<Image>* pOut);
+	static bool HasAlpha(const Image& image);
+	static void EncodeBC1(const Image& image, std::vector<unsigned char>* pOut);
+	static void EncodeBC3(const Image& image, std::vector<unsigned char>* pOut);
+	static bool WriteDDS(const char* pFilename, FORMAT format, const std::vector<Image>& mips);
+	static const char* GetFormatName(FORMAT format);
+
+	static bool LoadManifest(const char* pFilename, std::vector<ManifestEntry>* pOut);
+	static bool SaveManifest(const char* pFilename, const std::vector<ManifestEntry>& entries);
+	static unsigned long long HashFile(const char* pFilename, bool* pSuccess);
+	static bool LoadRules(const char* pFilename, std::vector<std::string>* pOut);
+	static bool IsUncompressed(const std::vector<std::string>& rules, const std::string& source);
+
+private:
+	static void EncodeColorBlock(const unsigned char* pBlock, unsigned char* pOut);
+	static void EncodeAlphaBlock(const unsigned char* pBlock, unsigned char* pOut);
+	static void FetchBlock(const Image& image, int nBlockX, int nBlockY, unsigned char* pBlock);
+	static unsigned short PackColor565(int nR, int nG, int nB);
+	static void UnpackColor565(unsigned short color, int* pR, int* pG, int* pB);
+};
+
+#endif
@@ -1,125 +1,404 @@
 //=============================================================================
 //
-// eNX` [texture.cpp]
+// テクスチャ処理 [texture.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "texture.h"
 #include "renderer.h"
 #include "manager.h"
-
-//*****************************************************************************
-// ÓIoϐ錾
-//*****************************************************************************
-int CTexture::m_nNumAll = 0;
+#include "assetloader.h"
+#include "algorithm"
+#include "texturecooker.h"
+#include "cassert"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CTexture::CTexture()
 {
-	// l̃NA
-	for (int nCnt = 0; nCnt < MAX_TEXTURE; nCnt++)
-	{
-		m_apTexture[nCnt] = {};
-	}
+	// 値のクリア
+	m_textures.clear();		// テクスチャ
+	m_indexMap.clear();		// パスから番号への対応
+	m_freeList.clear();		// 解放して空いた番号
+	m_pending.clear();		// 読み込み待ちの番号
+	m_nNumAll = 0;			// 登録済みの数
+	m_bAsync = true;		// ワーカーで先読みしてから作るか
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CTexture::~CTexture()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// eNX`̓ǂݍ
+// テクスチャの読み込み(テクスチャ自体は必要になった時にRegisterDynamicで読み込む)
 //=============================================================================
 HRESULT CTexture::Load(void)
 {
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	m_cookedMap.clear();
+
+	// 変換済みDDSの一覧(無ければ元画像をそのまま使う)
+	std::vector<CTexCodec::ManifestEntry> entries;
+	CTexCodec::LoadManifest(CTextureCooker::MANIFEST_FILE, &entries);
 
-	// SẴeNX`̓ǂݍ
-	for (int nCnt = 0; nCnt < MAX_TEXTURE; nCnt++)
+	for (const auto& entry : entries)
 	{
-		if (!TEXTURE[nCnt].empty()) // 󕶎񂶂Ȃ΃[h
+		if (GetFileAttributesA(entry.cooked.c_str()) == INVALID_FILE_ATTRIBUTES)
 		{
-			HRESULT hr = D3DXCreateTextureFromFile(
-				pDevice,
-				TEXTURE[nCnt].c_str(),
-				&m_apTexture[nCnt]);
-
-			if (FAILED(hr))
-			{
-				m_apTexture[nCnt] = nullptr;
-			}
+			continue;
 		}
-		else
+
+		// 変換後に元画像が更新されていたら、変換し直すまで元画像を読む
+		unsigned long long time = 0, size = 0;
+
+		if (CTextureCooker::GetFileStamp(entry.source.c_str(), &time, &size) &&
+			(time != entry.time || size != entry.size))
 		{
-			m_apTexture[nCnt] = nullptr;
+			continue;
 		}
+
+		m_cookedMap[MakeKey(entry.source.c_str())] = entry.cooked;
 	}
 
 	return S_OK;
 }
 //=============================================================================
-// eNX`̔j
+// テクスチャの破棄
 //=============================================================================
 void CTexture::Unload(void)
 {
-	// SẴeNX`̔j
-	for (int nCnt = 0; nCnt < MAX_TEXTURE; nCnt++)
+	// 全てのテクスチャの破棄
+	for (auto& tex : m_textures)
 	{
-		// NA
-		TEXTURE[nCnt].clear();
-		if (m_apTexture[nCnt] != nullptr)
+		if (tex.pTexture != nullptr)
 		{
-			m_apTexture[nCnt]->Release();
-			m_apTexture[nCnt] = nullptr;
+			tex.pTexture->Release();
+			tex.pTexture = nullptr;
 		}
 	}
+
+	// クリア
+	m_textures.clear();
+	m_indexMap.clear();
+	m_freeList.clear();
+	m_pending.clear();
+	m_nNumAll = 0;
 }
 //=============================================================================
-// eNX`̎w
+// テクスチャの指定(読み込み済みなら参照数を増やして同じ番号を返す。
+// 先読みする場合は番号だけ先に返し、テクスチャはUpdateで作る)
 //=============================================================================
 int CTexture::RegisterDynamic(const char* pFilename)
 {
-	// łɃ[hς݂ȂCfbNXԂ
-	for (int nCnt = 0; nCnt < m_nNumAll; nCnt++)
+	if (pFilename == nullptr || pFilename[0] == '\0')
 	{
-		if (!TEXTURE[nCnt].empty() && TEXTURE[nCnt] == pFilename)
+		return -1;
+	}
+
+	std::string key = MakeKey(pFilename);
+
+	// すでにロード済みならインデックス返す
+	auto it = m_indexMap.find(key);
+
+	if (it != m_indexMap.end())
+	{
+		m_textures[it->second].nRef++;
+		return it->second;
+	}
+
+	// 変換済みのDDSがあればそちらを読む(ミップマップ付きで圧縮済み)
+	auto cooked = m_cookedMap.find(key);
+	std::string file = (cooked != m_cookedMap.end()) ? cooked->second : std::string(pFilename);
+
+	bool bAsync = m_bAsync && CAssetLoader::IsRunning();
+	LPDIRECT3DTEXTURE9 pTexture = nullptr;
+
+	if (bAsync)
+	{// ワーカーに読み込みを頼む
+		CAssetLoader::Request(file.c_str());
+	}
+	else
+	{
+		pTexture = Create(file.c_str());
+
+		if (pTexture == nullptr)
 		{
-			return nCnt;
+			return -1;
 		}
 	}
 
-	// VXbgɃ[h
-	if (m_nNumAll < MAX_TEXTURE)
+	// 空いた番号があれば使い回す
+	int nIdx = -1;
+
+	if (!m_freeList.empty())
+	{
+		nIdx = m_freeList.back();
+		m_freeList.pop_back();
+	}
+	else
+	{
+		nIdx = (int)m_textures.size();
+		m_textures.push_back(TextureInfo());
+	}
+
+	m_textures[nIdx].path = key;
+	m_textures[nIdx].file = file;
+	m_textures[nIdx].pTexture = pTexture;
+	m_textures[nIdx].nRef = 1;
+
+	m_indexMap[key] = nIdx;
+	m_nNumAll++;
+
+	if (bAsync)
+	{
+		m_pending.push_back(nIdx);
+	}
+
+	return nIdx;
+}
+//=============================================================================
+// テクスチャの参照を外す処理(0になってもすぐには破棄せず、ReleaseUnusedでまとめて破棄する)
+//=============================================================================
+void CTexture::Release(int nIdx)
+{
+	if (nIdx < 0 || nIdx >= (int)m_textures.size() || m_textures[nIdx].path.empty())
+	{// 範囲外
+		return;
+	}
+
+	if (m_textures[nIdx].nRef > 0)
 	{
-		// foCX̎擾
-		LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+		m_textures[nIdx].nRef--;
+	}
+}
+//=============================================================================
+// 参照されていないテクスチャの破棄処理(戻り値は破棄した数)
+//=============================================================================
+int CTexture::ReleaseUnused(void)
+{
+	int nNumFree = 0;
 
-		if (SUCCEEDED(D3DXCreateTextureFromFile(pDevice, pFilename, &m_apTexture[m_nNumAll])))
+	for (int nCnt = 0; nCnt < (int)m_textures.size(); nCnt++)
+	{
+		if (!m_textures[nCnt].path.empty() && m_textures[nCnt].nRef <= 0)
 		{
-			TEXTURE[m_nNumAll] = pFilename;  // std::string ɑ
-			return m_nNumAll++;
+			Free(nCnt);
+			nNumFree++;
 		}
 	}
-	return -1;
+
+	return nNumFree;
 }
 //=============================================================================
-// eNX`̃AhX擾
+// シーンで使ったテクスチャの破棄処理(オブジェクトを全て破棄した後に呼ぶ)
+//=============================================================================
+void CTexture::ReleaseScene(void)
+{
+	ReleaseUnused();
+
+	// 残っている物は参照を外し忘れている(番号を持ったまま次のシーンに行くので破棄しない)
+	int nNumLive = 0;
+
+	for (const auto& tex : m_textures)
+	{
+		if (tex.path.empty())
+		{
+			continue;
+		}
+
+		char szBuf[512];
+		sprintf_s(szBuf, "CTexture::ReleaseScene : 参照が残っています %s (%d)\n", tex.path.c_str(), tex.nRef);
+		OutputDebugStringA(szBuf);
+		nNumLive++;
+	}
+
+	assert(nNumLive == 0);
+}
+//=============================================================================
+// 読み込みが終わったテクスチャの作成処理(毎フレーム、メッシュと共通の時間の上限まで)
+//=============================================================================
+void CTexture::Update(void)
+{
+	if (m_pending.empty())
+	{
+		return;
+	}
+
+	size_t nCnt = 0;
+	std::vector<int> remain;
+
+	for (; nCnt < m_pending.size(); nCnt++)
+	{
+		// 上限を超えたら次のフレームに回す
+		if (!CAssetLoader::CanUpload())
+		{
+			break;
+		}
+
+		int nIdx = m_pending[nCnt];
+
+		if (!CAssetLoader::IsReady(m_textures[nIdx].file.c_str()))
+		{// 読み込みの順番は前後するので、待たずに次を見る
+			remain.push_back(nIdx);
+			continue;
+		}
+
+		// 失敗した時はテクスチャ無しのまま
+		m_textures[nIdx].pTexture = Create(m_textures[nIdx].file.c_str());
+	}
+
+	// 作らなかった物は次のフレームに残す
+	remain.insert(remain.end(), m_pending.begin() + nCnt, m_pending.end());
+	m_pending.swap(remain);
+}
+//=============================================================================
+// テクスチャのアドレス取得
 //=============================================================================
 LPDIRECT3DTEXTURE9 CTexture::GetAddress(int nIdx)
 {
-	if (nIdx < 0 || nIdx >= MAX_TEXTURE)
-	{// ͈͊O
+	if (nIdx < 0 || nIdx >= (int)m_textures.size())
+	{// 範囲外
 		return nullptr;
 	}
 
-	return m_apTexture[nIdx];
-}
\ No newline at end of file
+	return m_textures[nIdx].pTexture;
+}
+//=============================================================================
+// 検索用のパスの作成処理(.xの中のパスは区切りや大文字小文字が揃っていないため)
+//=============================================================================
+std::string CTexture::MakeKey(const char* pFilename)
+{
+	std::string key = pFilename;
+
+	for (auto& c : key)
+	{
+		if (c == '\\')
+		{
+			c = '/';
+		}
+		else if (c >= 'A' && c <= 'Z')
+		{
+			c = (char)(c - 'A' + 'a');
+		}
+	}
+
+	return key;
+}
+//=============================================================================
+// テクスチャの作成処理(ワーカーが展開した画素があれば写すだけ。無い形式はここでD3DXで展開する)
+//=============================================================================
+LPDIRECT3DTEXTURE9 CTexture::Create(const char* pFilename)
+{
+	CAssetLoader::FileData pData = CAssetLoader::GetFile(pFilename);
+
+	if (!pData)
+	{
+		CAssetLoader::Discard(pFilename);
+		return nullptr;
+	}
+
+	// デバイスの取得
+	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+
+	LPDIRECT3DTEXTURE9 pTexture = nullptr;
+	double fStart = CAssetLoader::GetTimeMs();
+
+	CAssetLoader::ImageData pImage = CAssetLoader::GetImage(pFilename);
+
+	if (pImage)
+	{
+		pTexture = CreateFromImage(pDevice, *pImage);
+	}
+
+	if (pTexture == nullptr &&
+		FAILED(D3DXCreateTextureFromFileInMemory(pDevice, pData->data(), (UINT)pData->size(), &pTexture)))
+	{
+		pTexture = nullptr;
+	}
+
+	CAssetLoader::EndUpload(CAssetLoader::GetTimeMs() - fStart);
+
+	// 作り終えたら中身はいらない
+	CAssetLoader::Discard(pFilename);
+
+	return pTexture;
+}
+//=============================================================================
+// 展開済みの画素からのテクスチャ作成処理(作れない時はnullptrを返し、D3DXで展開し直す)
+//=============================================================================
+LPDIRECT3DTEXTURE9 CTexture::CreateFromImage(LPDIRECT3DDEVICE9 pDevice, const CAssetLoader::Image& image)
+{
+	const CAssetLoader::ImageLevel& top = image.levels[0];
+
+	// 2のべき乗しか使えないデバイスではD3DXに伸ばしてもらう
+	D3DCAPS9 caps;
+	pDevice->GetDeviceCaps(&caps);
+
+	bool bPow2 = ((top.nWidth & (top.nWidth - 1)) == 0) && ((top.nHeight & (top.nHeight - 1)) == 0);
+
+	if ((caps.TextureCaps & D3DPTEXTURECAPS_POW2) && !bPow2)
+	{
+		return nullptr;
+	}
+
+	LPDIRECT3DTEXTURE9 pTexture = nullptr;
+
+	if (FAILED(pDevice->CreateTexture(top.nWidth, top.nHeight, (UINT)image.levels.size(), 0,
+		image.format, D3DPOOL_MANAGED, &pTexture, nullptr)))
+	{
+		return nullptr;
+	}
+
+	for (UINT nLevel = 0; nLevel < (UINT)image.levels.size(); nLevel++)
+	{
+		const CAssetLoader::ImageLevel& level = image.levels[nLevel];
+		D3DLOCKED_RECT rect;
+
+		if (FAILED(pTexture->LockRect(nLevel, &rect, nullptr, 0)))
+		{
+			pTexture->Release();
+			return nullptr;
+		}
+
+		// 1行ずつ写す(テクスチャ側の行の幅は揃っているとは限らない)
+		for (UINT nRow = 0; nRow < level.nRows; nRow++)
+		{
+			memcpy((BYTE*)rect.pBits + (size_t)nRow * rect.Pitch, &level.data[(size_t)nRow * level.nPitch], level.nPitch);
+		}
+
+		pTexture->UnlockRect(nLevel);
+	}
+
+	return pTexture;
+}
+//=============================================================================
+// 1つのテクスチャの破棄処理(番号は空きに戻す)
+//=============================================================================
+void CTexture::Free(int nIdx)
+{
+	TextureInfo& tex = m_textures[nIdx];
+
+	if (tex.pTexture != nullptr)
+	{
+		tex.pTexture->Release();
+		tex.pTexture = nullptr;
+	}
+
+	tex.nRef = 0;
+
+	m_indexMap.erase(tex.path);
+	tex.path.clear();
+	tex.file.clear();
+
+	// 読み込み待ちからも外す
+	m_pending.erase(std::remove(m_pending.begin(), m_pending.end(), nIdx), m_pending.end());
+
+	m_freeList.push_back(nIdx);
+	m_nNumAll--;
+}
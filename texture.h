@@ -1,18 +1,20 @@
 //=============================================================================
 //
-// eNX` [texture.h]
+// テクスチャ処理 [texture.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _TEXTURE_H_// ̃}N`ĂȂ
-#define _TEXTURE_H_// 2dCN[hh~̃}N`
+#ifndef _TEXTURE_H_// このマクロ定義がされていなかったら
+#define _TEXTURE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
+#include "unordered_map"
+#include "assetloader.h"
 
 //*****************************************************************************
-// eNX`NX
+// テクスチャクラス(パスのハッシュから番号を引き、参照数で管理する)
 //*****************************************************************************
 class CTexture
 {
@@ -23,14 +25,46 @@ public:
 	HRESULT Load(void);
 	void Unload(void);
 	int RegisterDynamic(const char* pFilename);
+	void Release(int nIdx);
+	int ReleaseUnused(void);
+	void ReleaseScene(void);
+	void Update(void);
 	LPDIRECT3DTEXTURE9 GetAddress(int nIdx);
 
+	//*****************************************************************************
+	// setter関数
+	//*****************************************************************************
+	void SetAsync(bool bAsync) { m_bAsync = bAsync; }
+
+	//*****************************************************************************
+	// getter関数
+	//*****************************************************************************
+	int GetNumLoaded(void) const { return m_nNumAll; }
+	int GetNumSlot(void) const { return (int)m_textures.size(); }
+	int GetNumPending(void) const { return (int)m_pending.size(); }
+
 private:
-	static constexpr int MAX_TEXTURE = 128;			// eNX`̍ő吔
+	// テクスチャ情報
+	typedef struct
+	{
+		std::string			path;		// 検索用のパス(小文字、区切りは'/')
+		std::string			file;		// 読み込むファイルのパス
+		LPDIRECT3DTEXTURE9	pTexture;	// テクスチャ(読み込み中はnullptrで、描画はテクスチャ無しになる)
+		int					nRef;		// 参照数
+	}TextureInfo;
+
+	static std::string MakeKey(const char* pFilename);
+	static LPDIRECT3DTEXTURE9 Create(const char* pFilename);
+	static LPDIRECT3DTEXTURE9 CreateFromImage(LPDIRECT3DDEVICE9 pDevice, const CAssetLoader::Image& image);
+	void Free(int nIdx);
 
-	std::string			TEXTURE[MAX_TEXTURE];		// eNX`pXi[
-	LPDIRECT3DTEXTURE9	m_apTexture[MAX_TEXTURE];	// eNX`z
-	static int			m_nNumAll;					// 
+	std::vector<TextureInfo>				m_textures;		// テクスチャ(番号は解放されるまで変わらない)
+	std::unordered_map<std::string, int>	m_indexMap;		// パスから番号への対応
+	std::vector<int>						m_freeList;		// 解放して空いた番号
+	std::vector<int>						m_pending;		// 読み込み待ちの番号
+	std::unordered_map<std::string, std::string>	m_cookedMap;	// 元画像から変換済みDDSへの対応
+	int										m_nNumAll;		// 登録済みの数
+	bool									m_bAsync;		// ワーカーで先読みしてから作るか
 };
 
-#endif
\ No newline at end of file
+#endif
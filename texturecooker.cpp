@@ -0,0 +1,376 @@
+//=============================================================================
+//
+// テクスチャ変換処理 [texturecooker.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "texturecooker.h"
+#include "fstream"
+#include "sstream"
+
+//=============================================================================
+// 変換処理(ウィンドウを出さずに、変わった画像だけDDSに変換して終了する)
+//=============================================================================
+bool CTextureCooker::Run(const char* pLogFile)
+{
+	// 変換用のデバイスを作る(描画はしないのでNULLREFで良い)
+	LPDIRECT3D9 pD3D = Direct3DCreate9(D3D_SDK_VERSION);
+
+	if (pD3D == nullptr)
+	{
+		return false;
+	}
+
+	D3DPRESENT_PARAMETERS d3dpp;
+	ZeroMemory(&d3dpp, sizeof(d3dpp));
+	d3dpp.BackBufferWidth = 1;
+	d3dpp.BackBufferHeight = 1;
+	d3dpp.BackBufferFormat = D3DFMT_UNKNOWN;
+	d3dpp.SwapEffect = D3DSWAPEFFECT_DISCARD;
+	d3dpp.Windowed = TRUE;
+
+	LPDIRECT3DDEVICE9 pDevice = nullptr;
+
+	if (FAILED(pD3D->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_NULLREF, GetDesktopWindow(),
+		D3DCREATE_SOFTWARE_VERTEXPROCESSING, &d3dpp, &pDevice)))
+	{
+		if (FAILED(pD3D->CreateDevice(D3DADAPTER_DEFAULT, D3DDEVTYPE_REF, GetDesktopWindow(),
+			D3DCREATE_SOFTWARE_VERTEXPROCESSING, &d3dpp, &pDevice)))
+		{
+			pD3D->Release();
+			return false;
+		}
+	}
+
+	CreateDirectoryA(COOKED_DIR, nullptr);
+
+	// 前回の変換結果
+	std::vector<CTexCodec::ManifestEntry> oldEntries;
+	CTexCodec::LoadManifest(MANIFEST_FILE, &oldEntries);
+
+	std::unordered_map<std::string, CTexCodec::ManifestEntry> oldMap;
+
+	for (const auto& entry : oldEntries)
+	{
+		oldMap[entry.source] = entry;
+	}
+
+	// 元画像を集める
+	std::vector<std::string> sources;
+	WIN32_FIND_DATAA findData;
+	HANDLE hFind = FindFirstFileA((std::string(SOURCE_DIR) + "*").c_str(), &findData);
+
+	if (hFind != INVALID_HANDLE_VALUE)
+	{
+		do
+		{
+			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			{
+				continue;
+			}
+
+			std::string name = findData.cFileName;
+			size_t nDot = name.find_last_of('.');
+			std::string ext = (nDot != std::string::npos) ? name.substr(nDot + 1) : "";
+
+			for (auto& c : ext)
+			{
+				c = (char)tolower((unsigned char)c);
+			}
+
+			if (ext == "png" || ext == "jpg" || ext == "jpeg" || ext == "tga" || ext == "bmp")
+			{
+				sources.push_back(std::string(SOURCE_DIR) + name);
+			}
+		} while (FindNextFileA(hFind, &findData));
+
+		FindClose(hFind);
+	}
+
+	// 圧縮しない画像の一覧(無ければ全て圧縮する)
+	std::vector<std::string> rules;
+	CTexCodec::LoadRules(RULES_FILE, &rules);
+
+	std::vector<CTexCodec::ManifestEntry> newEntries;
+	std::ostringstream log;
+	int nNumCooked = 0, nNumUpToDate = 0, nNumSkipped = 0, nNumFailed = 0, nNumFallback = 0;
+
+	for (const auto& source : sources)
+	{
+		bool bRead = false;
+		unsigned long long hash = CTexCodec::HashFile(source.c_str(), &bRead);
+
+		if (!bRead)
+		{
+			log << "failed   " << source << " (read)\n";
+			nNumFailed++;
+			continue;
+		}
+
+		unsigned long long time = 0, size = 0;
+		GetFileStamp(source.c_str(), &time, &size);
+
+		std::string stem = source.substr(strlen(SOURCE_DIR));
+		stem = stem.substr(0, stem.find_last_of('.'));
+		std::string cooked = std::string(COOKED_DIR) + stem + ".dds";
+
+		// 前回から変わっていなければそのまま使う
+		auto it = oldMap.find(source);
+
+		if (it != oldMap.end() && it->second.hash == hash && it->second.cooked == cooked &&
+			GetFileAttributesA(cooked.c_str()) != INVALID_FILE_ATTRIBUTES)
+		{
+			// 中身が同じでも更新日時は変わっている事があるので記録し直す
+			newEntries.push_back(it->second);
+			newEntries.back().time = time;
+			newEntries.back().size = size;
+			nNumUpToDate++;
+			continue;
+		}
+
+		std::string format;
+		bool bFallback = false;
+
+		if (!Cook(pDevice, source, cooked, rules, &format, &bFallback))
+		{
+			log << "failed   " << source << "\n";
+			nNumFailed++;
+			continue;
+		}
+
+		if (format.empty())
+		{// 圧縮できない大きさなので元画像のまま使う
+			DeleteFileA(cooked.c_str());
+			log << "skipped  " << source << " (size is not a multiple of 4)\n";
+			nNumSkipped++;
+			continue;
+		}
+
+		CTexCodec::ManifestEntry entry;
+		entry.hash = hash;
+		entry.time = time;
+		entry.size = size;
+		entry.format = format;
+		entry.source = source;
+		entry.cooked = cooked;
+		newEntries.push_back(entry);
+
+		log << "cooked   " << source << " -> " << cooked << " (" << format << (bFallback ? ", d3dx" : "") << ")\n";
+		nNumCooked++;
+		nNumFallback += bFallback ? 1 : 0;
+	}
+
+	// 元画像が無くなった物のDDSは消す
+	for (const auto& entry : oldEntries)
+	{
+		if (GetFileAttributesA(entry.source.c_str()) == INVALID_FILE_ATTRIBUTES)
+		{
+			DeleteFileA(entry.cooked.c_str());
+		}
+	}
+
+	bool bSaved = CTexCodec::SaveManifest(MANIFEST_FILE, newEntries);
+
+	pDevice->Release();
+	pD3D->Release();
+
+	// 結果の書き出し
+	FILE* pFile = fopen(pLogFile, "w");
+
+	if (pFile != nullptr)
+	{
+		fprintf(pFile, "sources          : %d\n", (int)sources.size());
+		fprintf(pFile, "cooked           : %d\n", nNumCooked);
+		fprintf(pFile, "up to date       : %d\n", nNumUpToDate);
+		fprintf(pFile, "d3dx fallback    : %d\n", nNumFallback);
+		fprintf(pFile, "skipped          : %d\n", nNumSkipped);
+		fprintf(pFile, "failed           : %d\n", nNumFailed);
+		fprintf(pFile, "manifest saved   : %s\n\n", bSaved ? "yes" : "no");
+		fprintf(pFile, "%s", log.str().c_str());
+
+		// ファイルを閉じる
+		fclose(pFile);
+	}
+
+	return bSaved && nNumFailed == 0;
+}
+//=============================================================================
+// ファイルの更新日時と大きさの取得処理(読み込み時に変換後が古くなっていないかの判定に使う)
+//=============================================================================
+bool CTextureCooker::GetFileStamp(const char* pFilename, unsigned long long* pTime, unsigned long long* pSize)
+{
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+
+	if (!GetFileAttributesExA(pFilename, GetFileExInfoStandard, &attr))
+	{
+		*pTime = 0;
+		*pSize = 0;
+		return false;
+	}
+
+	*pTime = ((unsigned long long)attr.ftLastWriteTime.dwHighDateTime << 32) | attr.ftLastWriteTime.dwLowDateTime;
+	*pSize = ((unsigned long long)attr.nFileSizeHigh << 32) | attr.nFileSizeLow;
+
+	return true;
+}
+//=============================================================================
+// 1枚の変換処理(不透明ならDXT1、透明があればDXT5。ミップマップは最後まで作る。
+// 圧縮しない一覧にある画像は縮小して描かないのでミップマップを作らず、A8R8G8B8のまま残す)
+//=============================================================================
+bool CTextureCooker::Cook(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::string& cooked,
+	const std::vector<std::string>& rules, std::string* pFormat, bool* pFallback)
+{
+	pFormat->clear();
+	*pFallback = false;
+
+	bool bUncompressed = CTexCodec::IsUncompressed(rules, source);
+
+	// 画素を読み出せなければD3DXで変換する
+	CTexCodec::Image image;
+
+	if (!ReadPixels(pDevice, source, &image))
+	{
+		*pFallback = true;
+		return CookD3DX(pDevice, source, cooked, bUncompressed, pFormat);
+	}
+
+	std::vector<CTexCodec::Image> mips;
+	CTexCodec::FORMAT format = CTexCodec::FORMAT_A8R8G8B8;
+
+	if (bUncompressed)
+	{
+		mips.push_back(std::move(image));
+	}
+	else
+	{
+		// 圧縮は4x4単位なので割り切れない物は変換しない
+		if (image.nWidth % CTexCodec::BLOCK_SIZE != 0 || image.nHeight % CTexCodec::BLOCK_SIZE != 0)
+		{
+			return true;
+		}
+
+		format = CTexCodec::HasAlpha(image) ? CTexCodec::FORMAT_DXT5 : CTexCodec::FORMAT_DXT1;
+		CTexCodec::BuildMips(image, &mips);
+	}
+
+	if (!CTexCodec::WriteDDS(cooked.c_str(), format, mips))
+	{
+		return false;
+	}
+
+	*pFormat = CTexCodec::GetFormatName(format);
+
+	return true;
+}
+//=============================================================================
+// D3DXでの1枚の変換処理(画素を読み出せなかった時だけ使う)
+//=============================================================================
+bool CTextureCooker::CookD3DX(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::string& cooked,
+	bool bUncompressed, std::string* pFormat)
+{
+	D3DXIMAGE_INFO info;
+
+	if (FAILED(D3DXGetImageInfoFromFileA(source.c_str(), &info)))
+	{
+		return false;
+	}
+
+	if (!bUncompressed && (info.Width % CTexCodec::BLOCK_SIZE != 0 || info.Height % CTexCodec::BLOCK_SIZE != 0))
+	{
+		return true;
+	}
+
+	// 透明があるかは調べられないので、アルファを持つ形式ならDXT5にする
+	bool bAlpha = true;
+
+	switch (info.Format)
+	{
+	case D3DFMT_R8G8B8:
+	case D3DFMT_X8R8G8B8:
+	case D3DFMT_X8B8G8R8:
+	case D3DFMT_R5G6B5:
+	case D3DFMT_X1R5G5B5:
+	case D3DFMT_L8:
+	case D3DFMT_L16:
+	case D3DFMT_DXT1:
+		bAlpha = false;
+		break;
+
+	default:
+		break;
+	}
+
+	D3DFORMAT format = bUncompressed ? D3DFMT_A8R8G8B8 : (bAlpha ? D3DFMT_DXT5 : D3DFMT_DXT1);
+	LPDIRECT3DTEXTURE9 pTexture = nullptr;
+
+	if (FAILED(D3DXCreateTextureFromFileExA(pDevice, source.c_str(),
+		info.Width, info.Height,
+		bUncompressed ? 1 : D3DX_DEFAULT,		// ミップマップは1x1まで
+		0, format, D3DPOOL_SCRATCH,
+		D3DX_FILTER_NONE,						// 大きさは変えない
+		D3DX_FILTER_BOX,						// ミップマップは平均で縮小
+		0, nullptr, nullptr, &pTexture)))
+	{
+		return false;
+	}
+
+	HRESULT hr = D3DXSaveTextureToFileA(cooked.c_str(), D3DXIFF_DDS, pTexture, nullptr);
+
+	pTexture->Release();
+
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	*pFormat = bUncompressed ? "A8R8G8B8" : (bAlpha ? "DXT5" : "DXT1");
+
+	return true;
+}
+//=============================================================================
+// 元画像の画素の読み出し処理(A8R8G8B8に展開して1段目だけ写す)
+//=============================================================================
+bool CTextureCooker::ReadPixels(LPDIRECT3DDEVICE9 pDevice, const std::string& source, CTexCodec::Image* pOut)
+{
+	D3DXIMAGE_INFO info;
+
+	if (FAILED(D3DXGetImageInfoFromFileA(source.c_str(), &info)))
+	{
+		return false;
+	}
+
+	LPDIRECT3DTEXTURE9 pTexture = nullptr;
+
+	if (FAILED(D3DXCreateTextureFromFileExA(pDevice, source.c_str(),
+		info.Width, info.Height, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_SCRATCH,
+		D3DX_FILTER_NONE, D3DX_FILTER_NONE, 0, nullptr, nullptr, &pTexture)))
+	{
+		return false;
+	}
+
+	D3DLOCKED_RECT rect;
+
+	if (FAILED(pTexture->LockRect(0, &rect, nullptr, D3DLOCK_READONLY)))
+	{
+		pTexture->Release();
+		return false;
+	}
+
+	pOut->nWidth = (int)info.Width;
+	pOut->nHeight = (int)info.Height;
+	pOut->pixels.resize((size_t)info.Width * info.Height * 4);
+
+	for (UINT nY = 0; nY < info.Height; nY++)
+	{
+		memcpy(&pOut->pixels[(size_t)nY * info.Width * 4], (const BYTE*)rect.pBits + rect.Pitch * nY, (size_t)info.Width * 4);
+	}
+
+	pTexture->UnlockRect(0);
+	pTexture->Release();
+
+	return true;
+}
@@ -0,0 +1,39 @@
+//=============================================================================
+//
+// テクスチャ変換処理 [texturecooker.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _TEXTURECOOKER_H_// このマクロ定義がされていなかったら
+#define _TEXTURECOOKER_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "unordered_map"
+#include "texcodec.h"
+
+//*****************************************************************************
+// テクスチャ変換クラス(元画像をミップマップ付きの圧縮DDSに事前変換する。UIは圧縮せずにDDSにする。
+// 画像の読み込みだけD3DXで行い、ミップマップ・圧縮・DDSの書き出しはCTexCodecで行う)
+//*****************************************************************************
+class CTextureCooker
+{
+public:
+	static constexpr const char* SOURCE_DIR		= "data/TEXTURE/";					// 元画像のフォルダ
+	static constexpr const char* COOKED_DIR		= "data/TEXTURE/cooked/";			// 変換後のフォルダ
+	static constexpr const char* MANIFEST_FILE	= "data/TEXTURE/cooked/manifest.txt";	// 変換結果の一覧
+	static constexpr const char* RULES_FILE		= "data/TEXTURE/uncompressed.txt";		// 圧縮しない画像の一覧
+
+	static bool Run(const char* pLogFile);
+	static bool GetFileStamp(const char* pFilename, unsigned long long* pTime, unsigned long long* pSize);
+
+private:
+	static bool Cook(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::string& cooked,
+		const std::vector<std::string>& rules, std::string* pFormat, bool* pFallback);
+	static bool CookD3DX(LPDIRECT3DDEVICE9 pDevice, const std::string& source, const std::string& cooked,
+		bool bUncompressed, std::string* pFormat);
+	static bool ReadPixels(LPDIRECT3DDEVICE9 pDevice, const std::string& source, CTexCodec::Image* pOut);
+};
+
+#endif
@@ -0,0 +1,749 @@
+//=============================================================================
+//
+// サムネイルキャッシュ処理 [thumbnailcache.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "thumbnailcache.h"
+#include "texturecooker.h"
+#include "fstream"
+#include "algorithm"
+
+//*****************************************************************************
+// 静的メンバ変数宣言
+//*****************************************************************************
+std::unordered_map<std::string, CThumbnailCache::FileHash> CThumbnailCache::m_fileHash;
+
+//=============================================================================
+// 鍵の作成処理(モデルファイルが読めなければfalse)
+//=============================================================================
+bool CThumbnailCache::MakeKey(const char* pModelPath, const Param& param, Key* pKey)
+{
+	if (pModelPath == nullptr || pModelPath[0] == '\0' || param.nWidth <= 0 || param.nHeight <= 0)
+	{
+		return false;
+	}
+
+	if (!HashModel(pModelPath, &pKey->modelHash))
+	{
+		return false;
+	}
+
+	pKey->paramHash = HashParam(param);
+	pKey->width = (DWORD)param.nWidth;
+	pKey->height = (DWORD)param.nHeight;
+
+	return true;
+}
+//=============================================================================
+// 描き方のハッシュ
+//=============================================================================
+unsigned long long CThumbnailCache::HashParam(const Param& param)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+
+	auto mix = [&](const void* pData, size_t size)
+	{
+		const unsigned char* p = (const unsigned char*)pData;
+
+		for (size_t nCnt = 0; nCnt < size; nCnt++)
+		{
+			hash = (hash ^ p[nCnt]) * 1099511628211ULL;
+		}
+	};
+
+	DWORD version = RENDER_VERSION;
+
+	mix(&version, sizeof(version));
+	mix(&param.nWidth, sizeof(param.nWidth));
+	mix(&param.nHeight, sizeof(param.nHeight));
+	mix(&param.eye, sizeof(param.eye));
+	mix(&param.at, sizeof(param.at));
+	mix(&param.fFov, sizeof(param.fFov));
+	mix(&param.fNear, sizeof(param.fNear));
+	mix(&param.fFar, sizeof(param.fFar));
+	mix(&param.clearCol, sizeof(param.clearCol));
+
+	return hash;
+}
+//=============================================================================
+// モデルファイルのハッシュ(参照しているテクスチャの中身も混ぜる。
+// モデルとテクスチャの更新日時と大きさが前回と同じなら読み直さない)
+//=============================================================================
+bool CThumbnailCache::HashModel(const char* pModelPath, unsigned long long* pHash)
+{
+	Stamp model;
+
+	if (!GetStamp(pModelPath, &model))
+	{
+		return false;
+	}
+
+	// 今回の起動で計算済み
+	auto it = m_fileHash.find(pModelPath);
+
+	if (it != m_fileHash.end() && IsFresh(it->second, model))
+	{
+		*pHash = it->second.hash;
+		return true;
+	}
+
+	// 前回までの起動でキャッシュファイルに残した物
+	FileHash entry;
+
+	if (ReadSource(GetCachePath(pModelPath).c_str(), &entry) && IsFresh(entry, model))
+	{
+		m_fileHash[pModelPath] = entry;
+
+		*pHash = entry.hash;
+		return true;
+	}
+
+	// モデルを読み直す
+	std::ifstream ifs(pModelPath, std::ios::binary);
+
+	if (!ifs)
+	{
+		return false;
+	}
+
+	std::vector<char> data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+	unsigned long long hash = 14695981039346656037ULL;
+
+	auto mix = [&](const void* pData, size_t size)
+	{
+		const unsigned char* p = (const unsigned char*)pData;
+
+		for (size_t nCnt = 0; nCnt < size; nCnt++)
+		{
+			hash = (hash ^ p[nCnt]) * 1099511628211ULL;
+		}
+	};
+
+	mix(data.data(), data.size());
+
+	// 参照しているテクスチャ(読めない物は無い物として混ぜる)
+	entry.model = model;
+	entry.textures.clear();
+	entry.texStamps.clear();
+	FindTextures(data, &entry.textures);
+
+	for (const auto& texture : entry.textures)
+	{
+		Stamp stamp = {};
+		GetStamp(texture.c_str(), &stamp);
+		entry.texStamps.push_back(stamp);
+
+		bool bRead = false;
+		unsigned long long texHash = CTexCodec::HashFile(texture.c_str(), &bRead);
+
+		if (!bRead)
+		{
+			texHash = 0;
+		}
+
+		mix(texture.c_str(), texture.size() + 1);
+		mix(&texHash, sizeof(texHash));
+	}
+
+	entry.hash = hash;
+	m_fileHash[pModelPath] = entry;
+
+	*pHash = hash;
+
+	return true;
+}
+//=============================================================================
+// ファイルの更新日時と大きさの取得
+//=============================================================================
+bool CThumbnailCache::GetStamp(const char* pFilename, Stamp* pStamp)
+{
+	return CTextureCooker::GetFileStamp(pFilename, &pStamp->time, &pStamp->size);
+}
+//=============================================================================
+// モデルと参照しているテクスチャが前回から変わっていないかの判定
+//=============================================================================
+bool CThumbnailCache::IsFresh(const FileHash& entry, const Stamp& model)
+{
+	if (entry.model.time != model.time || entry.model.size != model.size)
+	{
+		return false;
+	}
+
+	for (size_t nCnt = 0; nCnt < entry.textures.size(); nCnt++)
+	{
+		// 無くなったテクスチャは0同士で比べる
+		Stamp stamp = {};
+		GetStamp(entry.textures[nCnt].c_str(), &stamp);
+
+		if (stamp.time != entry.texStamps[nCnt].time || stamp.size != entry.texStamps[nCnt].size)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+//=============================================================================
+// キャッシュファイルから鍵を作った時のモデルとテクスチャの記録を読む処理
+//=============================================================================
+bool CThumbnailCache::ReadSource(const char* pFilename, FileHash* pOut)
+{
+	FILE* pFile = fopen(pFilename, "rb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	Header header;
+	bool bValid = (fread(&header, sizeof(Header), 1, pFile) == 1) &&
+		memcmp(header.magic, "NJTH", 4) == 0 && header.version == FORMAT_VERSION && header.numTexture <= MAX_TEXTURE;
+
+	// 記録が無い(書いた時にハッシュを持っていなかった)物は使わない
+	bValid = bValid && header.model.size != 0;
+
+	if (bValid)
+	{
+		pOut->model = header.model;
+		pOut->hash = header.key.modelHash;
+		pOut->textures.clear();
+		pOut->texStamps.clear();
+	}
+
+	for (DWORD nCnt = 0; bValid && nCnt < header.numTexture; nCnt++)
+	{
+		TextureRecord record;
+		char aName[MAX_NAME];
+
+		bValid = (fread(&record, sizeof(record), 1, pFile) == 1) && record.nameLen < MAX_NAME &&
+			fread(aName, 1, record.nameLen, pFile) == record.nameLen;
+
+		if (bValid)
+		{
+			pOut->textures.push_back(std::string(aName, record.nameLen));
+			pOut->texStamps.push_back(record.stamp);
+		}
+	}
+
+	fclose(pFile);
+
+	return bValid;
+}
+//=============================================================================
+// モデルファイルから参照しているテクスチャのパスを探す処理
+// (テキスト形式の.xのTextureFilenameだけを見る。バイナリ形式の.xではモデルの中身だけが鍵になる)
+//=============================================================================
+void CThumbnailCache::FindTextures(const std::vector<char>& data, std::vector<std::string>* pOut)
+{
+	static constexpr const char* TAG = "TextureFilename";
+	static constexpr const char* TEMPLATE = "template";
+
+	pOut->clear();
+
+	std::string text(data.begin(), data.end());
+	size_t nPos = 0;
+
+	while ((nPos = text.find(TAG, nPos)) != std::string::npos)
+	{
+		size_t nTag = nPos;
+		nPos += strlen(TAG);
+
+		// テンプレートの宣言は飛ばす
+		size_t nLineStart = text.find_last_of('\n', nTag);
+		nLineStart = (nLineStart == std::string::npos) ? 0 : nLineStart + 1;
+
+		if (text.find(TEMPLATE, nLineStart) < nTag)
+		{
+			continue;
+		}
+
+		// { "パス"; } の中身
+		size_t nOpen = text.find('"', nPos);
+		size_t nBrace = text.find('}', nPos);
+
+		if (nOpen == std::string::npos || nOpen > nBrace)
+		{
+			continue;
+		}
+
+		size_t nClose = text.find('"', nOpen + 1);
+
+		if (nClose == std::string::npos || nClose - nOpen - 1 >= MAX_NAME)
+		{
+			continue;
+		}
+
+		std::string name = text.substr(nOpen + 1, nClose - nOpen - 1);
+
+		if (std::find(pOut->begin(), pOut->end(), name) == pOut->end() && pOut->size() < MAX_TEXTURE)
+		{
+			pOut->push_back(name);
+		}
+
+		nPos = nClose + 1;
+	}
+}
+//=============================================================================
+// キャッシュのパスの取得(モデルのパスのハッシュをファイル名にする)
+//=============================================================================
+std::string CThumbnailCache::GetCachePath(const char* pModelPath)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+
+	for (const char* p = pModelPath; *p != '\0'; p++)
+	{
+		// 区切り文字と大文字小文字の違いは同じパスとして扱う
+		char c = (*p == '\\') ? '/' : (char)tolower((unsigned char)*p);
+		hash = (hash ^ (unsigned char)c) * 1099511628211ULL;
+	}
+
+	char aName[32];
+	snprintf(aName, sizeof(aName), "%016llx", hash);
+
+	return std::string(CACHE_DIR) + aName + CACHE_EXT;
+}
+//=============================================================================
+// ファイルの読み込み処理(鍵と形式が一致しなければfalse)
+//=============================================================================
+bool CThumbnailCache::Read(const char* pFilename, const Key& key, std::vector<DWORD>* pPixels)
+{
+	FILE* pFile = fopen(pFilename, "rb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	Header header;
+	bool bValid = (fread(&header, sizeof(Header), 1, pFile) == 1);
+
+	size_t dataSize = (size_t)key.width * key.height * sizeof(DWORD);
+
+	// 形式の確認
+	bValid = bValid && memcmp(header.magic, "NJTH", 4) == 0 && header.version == FORMAT_VERSION;
+
+	// 鍵の確認(モデルか描き方が変わっていれば使わない)
+	bValid = bValid && header.key.modelHash == key.modelHash && header.key.paramHash == key.paramHash &&
+		header.key.width == key.width && header.key.height == key.height && header.dataSize == dataSize &&
+		header.numTexture <= MAX_TEXTURE;
+
+	// テクスチャの記録は鍵を作る時に読むのでここでは飛ばす
+	for (DWORD nCnt = 0; bValid && nCnt < header.numTexture; nCnt++)
+	{
+		TextureRecord record;
+
+		bValid = (fread(&record, sizeof(record), 1, pFile) == 1) && record.nameLen < MAX_NAME &&
+			fseek(pFile, (long)record.nameLen, SEEK_CUR) == 0;
+	}
+
+	if (bValid)
+	{
+		pPixels->resize((size_t)key.width * key.height);
+
+		// 途中で切れていれば使わない
+		bValid = (fread(pPixels->data(), 1, dataSize, pFile) == dataSize);
+	}
+
+	fclose(pFile);
+
+	if (!bValid)
+	{
+		pPixels->clear();
+	}
+
+	return bValid;
+}
+//=============================================================================
+// ファイルの書き出し処理(鍵を作った時のモデルとテクスチャの更新日時と大きさも残す)
+//=============================================================================
+bool CThumbnailCache::Write(const char* pFilename, const char* pModelPath, const Key& key, const std::vector<DWORD>& pixels)
+{
+	if (pixels.size() != (size_t)key.width * key.height)
+	{
+		return false;
+	}
+
+	// 鍵と同じハッシュを作った時の記録(無ければ次の起動で読み直す)
+	auto it = m_fileHash.find(pModelPath);
+	const FileHash* pSource = (it != m_fileHash.end() && it->second.hash == key.modelHash) ? &it->second : nullptr;
+
+	Header header;
+	ZeroMemory(&header, sizeof(header));
+	memcpy(header.magic, "NJTH", 4);
+	header.version = FORMAT_VERSION;
+	header.key = key;
+	header.dataSize = (DWORD)(pixels.size() * sizeof(DWORD));
+
+	if (pSource != nullptr)
+	{
+		header.model = pSource->model;
+		header.numTexture = (DWORD)pSource->textures.size();
+	}
+
+	FILE* pFile = fopen(pFilename, "wb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	bool bResult = (fwrite(&header, sizeof(Header), 1, pFile) == 1);
+
+	for (DWORD nCnt = 0; bResult && nCnt < header.numTexture; nCnt++)
+	{
+		const std::string& name = pSource->textures[nCnt];
+
+		TextureRecord record;
+		ZeroMemory(&record, sizeof(record));
+		record.stamp = pSource->texStamps[nCnt];
+		record.nameLen = (DWORD)name.size();
+
+		bResult = (fwrite(&record, sizeof(record), 1, pFile) == 1) &&
+			(fwrite(name.data(), 1, name.size(), pFile) == name.size());
+	}
+
+	bResult = bResult && (fwrite(pixels.data(), 1, header.dataSize, pFile) == header.dataSize);
+
+	fclose(pFile);
+
+	// 書き損じたファイルは残さない
+	if (!bResult)
+	{
+		DeleteFileA(pFilename);
+	}
+
+	return bResult;
+}
+//=============================================================================
+// キャッシュからテクスチャを作る処理(無い・古い時はnullptr)
+//=============================================================================
+LPDIRECT3DTEXTURE9 CThumbnailCache::Load(LPDIRECT3DDEVICE9 pDevice, const char* pModelPath, const Key& key)
+{
+	if (pDevice == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::vector<DWORD> pixels;
+
+	if (!Read(GetCachePath(pModelPath).c_str(), key, &pixels))
+	{
+		return nullptr;
+	}
+
+	// デバイスが消えても残るようにMANAGEDで作る
+	LPDIRECT3DTEXTURE9 pTexture = nullptr;
+
+	if (FAILED(pDevice->CreateTexture(key.width, key.height, 1, 0, D3DFMT_A8R8G8B8,
+		D3DPOOL_MANAGED, &pTexture, nullptr)))
+	{
+		return nullptr;
+	}
+
+	D3DLOCKED_RECT rect;
+
+	if (FAILED(pTexture->LockRect(0, &rect, nullptr, 0)))
+	{
+		pTexture->Release();
+		return nullptr;
+	}
+
+	for (DWORD nCntY = 0; nCntY < key.height; nCntY++)
+	{
+		memcpy((BYTE*)rect.pBits + nCntY * rect.Pitch, &pixels[(size_t)nCntY * key.width], key.width * sizeof(DWORD));
+	}
+
+	pTexture->UnlockRect(0);
+
+	return pTexture;
+}
+//=============================================================================
+// 描いたサムネイルをキャッシュへ書き出す処理
+//=============================================================================
+bool CThumbnailCache::Save(LPDIRECT3DDEVICE9 pDevice, LPDIRECT3DTEXTURE9 pTexture, const char* pModelPath, const Key& key)
+{
+	if (pDevice == nullptr || pTexture == nullptr)
+	{
+		return false;
+	}
+
+	LPDIRECT3DSURFACE9 pRT = nullptr;
+	LPDIRECT3DSURFACE9 pSys = nullptr;
+
+	if (FAILED(pTexture->GetSurfaceLevel(0, &pRT)))
+	{
+		return false;
+	}
+
+	// レンダーターゲットは直接読めないのでシステムメモリへ写す
+	bool bResult = SUCCEEDED(pDevice->CreateOffscreenPlainSurface(key.width, key.height, D3DFMT_A8R8G8B8,
+		D3DPOOL_SYSTEMMEM, &pSys, nullptr)) && SUCCEEDED(pDevice->GetRenderTargetData(pRT, pSys));
+
+	std::vector<DWORD> pixels;
+	D3DLOCKED_RECT rect;
+
+	if (bResult && SUCCEEDED(pSys->LockRect(&rect, nullptr, D3DLOCK_READONLY)))
+	{
+		pixels.resize((size_t)key.width * key.height);
+
+		for (DWORD nCntY = 0; nCntY < key.height; nCntY++)
+		{
+			memcpy(&pixels[(size_t)nCntY * key.width], (const BYTE*)rect.pBits + nCntY * rect.Pitch, key.width * sizeof(DWORD));
+		}
+
+		pSys->UnlockRect();
+	}
+	else
+	{
+		bResult = false;
+	}
+
+	if (pSys) pSys->Release();
+	if (pRT)  pRT->Release();
+
+	if (!bResult)
+	{
+		return false;
+	}
+
+	CreateDirectoryA(CACHE_DIR, nullptr);
+
+	return Write(GetCachePath(pModelPath).c_str(), pModelPath, key, pixels);
+}
+//=============================================================================
+// 確認処理(デバイスを作らずにファイルの形式と有効判定を確かめて終了する)
+//=============================================================================
+bool CThumbnailCache::RunTest(const char* filename)
+{
+	const char* pModel = "thumbtest_model.tmp";
+	const char* pCache = "thumbtest_cache.tmp";
+	const char* pTexture = "thumbtest_texture.tmp";
+
+	auto writeFile = [&](const char* pPath, const char* pText)
+	{
+		FILE* pFile = fopen(pPath, "wb");
+
+		if (pFile != nullptr)
+		{
+			fputs(pText, pFile);
+			fclose(pFile);
+		}
+	};
+
+	Param param;
+	param.nWidth = 100;
+	param.nHeight = 100;
+	param.eye = D3DXVECTOR3(-120.0f, 100.0f, -120.0f);
+	param.at = D3DXVECTOR3(0.0f, 0.0f, 0.0f);
+	param.fFov = 60.0f;
+	param.fNear = 1.0f;
+	param.fFar = 1000.0f;
+	param.clearCol = D3DCOLOR_XRGB(50, 50, 50);
+
+	// 描き方のハッシュ(同じなら同じ、どこか変われば違う)
+	Param moved = param;
+	moved.eye.y += 1.0f;
+
+	Param resized = param;
+	resized.nWidth = 128;
+
+	bool bParamHash = HashParam(param) == HashParam(param) &&
+		HashParam(param) != HashParam(moved) && HashParam(param) != HashParam(resized);
+
+	// モデルの鍵(中身が変われば変わる)
+	ClearHash();
+	writeFile(pModel, "xof 0303txt 0032\nMesh {}\n");
+
+	Key key;
+	bool bKey = MakeKey(pModel, param, &key);
+
+	Key keyAgain;
+	bool bKeyStable = MakeKey(pModel, param, &keyAgain) && keyAgain.modelHash == key.modelHash;
+
+	writeFile(pModel, "xof 0303txt 0032\nMesh { 1; }\n");
+
+	Key keyEdited;
+	bool bKeyEdited = MakeKey(pModel, param, &keyEdited) && keyEdited.modelHash != key.modelHash;
+
+	Key keyMissing;
+	bool bKeyMissing = !MakeKey("thumbtest_missing.tmp", param, &keyMissing);
+
+	// 参照しているテクスチャが変われば変わる
+	writeFile(pTexture, "aaaa");
+	writeFile(pModel, "xof 0303txt 0032\nMaterial { TextureFilename { \"thumbtest_texture.tmp\"; } }\n");
+
+	Key keyTexture, keyTextureEdited;
+	bool bKeyTexture = MakeKey(pModel, param, &keyTexture);
+
+	writeFile(pTexture, "bbbbbbbb");
+
+	bKeyTexture = bKeyTexture && MakeKey(pModel, param, &keyTextureEdited) &&
+		keyTextureEdited.modelHash != keyTexture.modelHash;
+
+	// 起動し直しても、更新日時と大きさが同じならキャッシュファイルの記録を使って読み直さない
+	// (同じ大きさで中身を変えて更新日時を戻し、前の鍵のままなら読んでいない)
+	std::string stored = GetCachePath(pModel);
+	CreateDirectoryA(CACHE_DIR, nullptr);
+
+	std::vector<DWORD> blank((size_t)keyTextureEdited.width * keyTextureEdited.height, 0);
+	bool bKeyStored = Write(stored.c_str(), pModel, keyTextureEdited, blank);
+
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+	bKeyStored = bKeyStored && GetFileAttributesExA(pModel, GetFileExInfoStandard, &attr);
+
+	writeFile(pModel, "xof 0303txt 0032\nMATERIAL { TextureFilename { \"thumbtest_texture.tmp\"; } }\n");
+
+	HANDLE hFile = CreateFileA(pModel, FILE_WRITE_ATTRIBUTES, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+
+	if (hFile != INVALID_HANDLE_VALUE)
+	{
+		SetFileTime(hFile, nullptr, nullptr, &attr.ftLastWriteTime);
+		CloseHandle(hFile);
+	}
+
+	ClearHash();
+
+	Key keyStored;
+	bKeyStored = bKeyStored && MakeKey(pModel, param, &keyStored) && keyStored.modelHash == keyTextureEdited.modelHash;
+
+	// 大きさが変われば読み直す
+	writeFile(pModel, "xof 0303txt 0032\nMaterial { TextureFilename { \"thumbtest_texture.tmp\"; } }\nMesh {}\n");
+	ClearHash();
+
+	Key keyReread;
+	bool bKeyReread = MakeKey(pModel, param, &keyReread) && keyReread.modelHash != keyTextureEdited.modelHash;
+
+	DeleteFileA(stored.c_str());
+	DeleteFileA(pTexture);
+
+	// 書き出しと読み戻し
+	std::vector<DWORD> pixels((size_t)key.width * key.height);
+
+	for (size_t nCnt = 0; nCnt < pixels.size(); nCnt++)
+	{
+		pixels[nCnt] = (DWORD)(nCnt * 2654435761u);
+	}
+
+	std::vector<DWORD> readBack;
+	bool bRoundTrip = Write(pCache, pModel, key, pixels) && Read(pCache, key, &readBack) && readBack == pixels;
+
+	// 鍵が違えば使わない
+	Key other = key;
+	other.modelHash ^= 1;
+	bool bRejectModel = !Read(pCache, other, &readBack);
+
+	other = key;
+	other.paramHash = HashParam(moved);
+	bool bRejectParam = !Read(pCache, other, &readBack);
+
+	other = key;
+	other.width = 64;
+	bool bRejectSize = !Read(pCache, other, &readBack);
+
+	// ファイルが壊れていれば使わない
+	auto patch = [&](long offset, const void* pData, size_t size)
+	{
+		Write(pCache, pModel, key, pixels);
+
+		FILE* pFile = fopen(pCache, "r+b");
+
+		if (pFile != nullptr)
+		{
+			fseek(pFile, offset, SEEK_SET);
+			fwrite(pData, 1, size, pFile);
+			fclose(pFile);
+		}
+
+		return !Read(pCache, key, &readBack);
+	};
+
+	bool bRejectMagic = patch(0, "XXXX", 4);
+
+	DWORD badVersion = FORMAT_VERSION + 1;
+	bool bRejectVersion = patch(4, &badVersion, sizeof(badVersion));
+
+	// 途中で切れたファイル
+	bool bRejectTruncated = false;
+
+	if (Write(pCache, pModel, key, pixels))
+	{
+		std::vector<BYTE> data;
+		FILE* pFile = fopen(pCache, "rb");
+
+		if (pFile != nullptr)
+		{
+			fseek(pFile, 0, SEEK_END);
+			data.resize((size_t)ftell(pFile));
+			fseek(pFile, 0, SEEK_SET);
+			data.resize(fread(data.data(), 1, data.size(), pFile));
+			fclose(pFile);
+		}
+
+		pFile = fopen(pCache, "wb");
+
+		if (pFile != nullptr && data.size() > 16)
+		{
+			fwrite(data.data(), 1, data.size() - 16, pFile);
+			fclose(pFile);
+
+			bRejectTruncated = !Read(pCache, key, &readBack);
+		}
+		else if (pFile != nullptr)
+		{
+			fclose(pFile);
+		}
+	}
+
+	bool bRejectMissing = !Read("thumbtest_missing.tmp", key, &readBack);
+
+	// キャッシュのパス(区切り文字と大文字小文字の違いは同じ)
+	bool bPath = GetCachePath("data/MODELS/Block/box.x") == GetCachePath("DATA\\models\\block\\BOX.X") &&
+		GetCachePath("data/MODELS/Block/box.x") != GetCachePath("data/MODELS/Block/box2.x");
+
+	DeleteFileA(pModel);
+	DeleteFileA(pCache);
+	ClearHash();
+
+	bool bResult = bParamHash && bKey && bKeyStable && bKeyEdited && bKeyMissing &&
+		bKeyTexture && bKeyStored && bKeyReread && bRoundTrip &&
+		bRejectModel && bRejectParam && bRejectSize && bRejectMagic && bRejectVersion &&
+		bRejectTruncated && bRejectMissing && bPath;
+
+	// 結果の書き出し
+	FILE* pFile = fopen(filename, "w");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "param hash             : %s\n", bParamHash ? "yes" : "no");
+	fprintf(pFile, "model key              : %s\n", bKey ? "yes" : "no");
+	fprintf(pFile, "model key stable       : %s\n", bKeyStable ? "yes" : "no");
+	fprintf(pFile, "model key after edit   : %s\n", bKeyEdited ? "yes" : "no");
+	fprintf(pFile, "missing model          : %s\n", bKeyMissing ? "yes" : "no");
+	fprintf(pFile, "key after texture edit : %s\n", bKeyTexture ? "yes" : "no");
+	fprintf(pFile, "key from cache file    : %s\n", bKeyStored ? "yes" : "no");
+	fprintf(pFile, "rehash after model edit: %s\n", bKeyReread ? "yes" : "no");
+	fprintf(pFile, "write / read           : %s\n", bRoundTrip ? "yes" : "no");
+	fprintf(pFile, "reject model hash      : %s\n", bRejectModel ? "yes" : "no");
+	fprintf(pFile, "reject param hash      : %s\n", bRejectParam ? "yes" : "no");
+	fprintf(pFile, "reject size            : %s\n", bRejectSize ? "yes" : "no");
+	fprintf(pFile, "reject magic           : %s\n", bRejectMagic ? "yes" : "no");
+	fprintf(pFile, "reject version         : %s\n", bRejectVersion ? "yes" : "no");
+	fprintf(pFile, "reject truncated       : %s\n", bRejectTruncated ? "yes" : "no");
+	fprintf(pFile, "reject missing file    : %s\n", bRejectMissing ? "yes" : "no");
+	fprintf(pFile, "cache path             : %s\n", bPath ? "yes" : "no");
+	fprintf(pFile, "result                 : %s\n", bResult ? "ok" : "NG");
+
+	// ファイルを閉じる
+	fclose(pFile);
+
+	return bResult;
+}
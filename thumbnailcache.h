@@ -0,0 +1,106 @@
+//=============================================================================
+//
+// サムネイルキャッシュ処理 [thumbnailcache.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _THUMBNAILCACHE_H_// このマクロ定義がされていなかったら
+#define _THUMBNAILCACHE_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "unordered_map"
+
+//*****************************************************************************
+// サムネイルキャッシュクラス(描いたサムネイルをモデルのハッシュと描き方を鍵にしてファイルへ残す)
+//*****************************************************************************
+class CThumbnailCache
+{
+public:
+	// サムネイルの描き方(変わったら作り直す)
+	typedef struct
+	{
+		int			nWidth;		// 幅
+		int			nHeight;	// 高さ
+		D3DXVECTOR3	eye;		// 視点
+		D3DXVECTOR3	at;			// 注視点
+		float		fFov;		// 視野角(度)
+		float		fNear;		// 近クリップ面
+		float		fFar;		// 遠クリップ面
+		D3DCOLOR	clearCol;	// 背景色
+	}Param;
+
+	// キャッシュの鍵(全て一致した時だけ使う)
+	typedef struct
+	{
+		unsigned long long	modelHash;	// モデルファイルと参照しているテクスチャのハッシュ
+		unsigned long long	paramHash;	// 描き方のハッシュ
+		DWORD				width;		// 幅
+		DWORD				height;		// 高さ
+	}Key;
+
+	static constexpr const char* CACHE_DIR	= "data/THUMBNAIL/";	// キャッシュのフォルダ
+	static constexpr const char* CACHE_EXT	= ".njt";				// キャッシュの拡張子
+
+	static bool MakeKey(const char* pModelPath, const Param& param, Key* pKey);
+	static unsigned long long HashParam(const Param& param);
+	static std::string GetCachePath(const char* pModelPath);
+	static LPDIRECT3DTEXTURE9 Load(LPDIRECT3DDEVICE9 pDevice, const char* pModelPath, const Key& key);
+	static bool Save(LPDIRECT3DDEVICE9 pDevice, LPDIRECT3DTEXTURE9 pTexture, const char* pModelPath, const Key& key);
+	static bool Read(const char* pFilename, const Key& key, std::vector<DWORD>* pPixels);
+	static bool Write(const char* pFilename, const char* pModelPath, const Key& key, const std::vector<DWORD>& pixels);
+	static void ClearHash(void) { m_fileHash.clear(); }
+	static bool RunTest(const char* filename);
+
+private:
+	static constexpr DWORD	FORMAT_VERSION	= 2;	// ファイルの形式を変えたら上げる
+	static constexpr DWORD	RENDER_VERSION	= 1;	// ライトなどParamに無い描き方を変えたら上げる(全て作り直す)
+	static constexpr DWORD	MAX_TEXTURE		= 64;	// 記録するテクスチャの最大数
+	static constexpr DWORD	MAX_NAME		= 260;	// テクスチャのパスの最大の長さ
+
+	// ファイルの更新日時と大きさ
+	typedef struct
+	{
+		unsigned long long	time;	// 更新日時
+		unsigned long long	size;	// 大きさ
+	}Stamp;
+
+	// ファイルの先頭(この後にテクスチャの記録、画素が続く)
+	typedef struct
+	{
+		char	magic[4];	// "NJTH"
+		DWORD	version;	// 形式の版
+		Key		key;		// 鍵
+		Stamp	model;		// 鍵を作った時のモデルファイルの更新日時と大きさ
+		DWORD	numTexture;	// テクスチャの記録の数
+		DWORD	dataSize;	// 画素のバイト数
+	}Header;
+
+	// テクスチャの記録(この後にパスが続く)
+	typedef struct
+	{
+		Stamp	stamp;		// 鍵を作った時の更新日時と大きさ
+		DWORD	nameLen;	// パスの長さ
+		DWORD	reserved;	// 予約(0)
+	}TextureRecord;
+
+	// モデルファイルのハッシュ(モデルと参照しているテクスチャの更新日時と大きさが同じなら読み直さない)
+	typedef struct
+	{
+		Stamp						model;		// モデルファイル
+		std::vector<std::string>	textures;	// 参照しているテクスチャのパス
+		std::vector<Stamp>			texStamps;	// 参照しているテクスチャ
+		unsigned long long			hash;		// ハッシュ
+	}FileHash;
+
+	static bool HashModel(const char* pModelPath, unsigned long long* pHash);
+	static bool GetStamp(const char* pFilename, Stamp* pStamp);
+	static bool IsFresh(const FileHash& entry, const Stamp& model);
+	static bool ReadSource(const char* pFilename, FileHash* pOut);
+	static void FindTextures(const std::vector<char>& data, std::vector<std::string>* pOut);
+
+	static std::unordered_map<std::string, FileHash> m_fileHash;	// パスごとのモデルファイルのハッシュ
+};
+
+#endif
@@ -1,53 +1,51 @@
 //=============================================================================
 //
-// ^C [time.cpp]
+// タイム処理 [time.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "time.h"
 #include "renderer.h"
 #include "manager.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CTime::CTime(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	memset(m_apNumber, 0, sizeof(m_apNumber));	// e̐\p
-	m_nMinutes		= 0;						// 
-	m_nSeconds		= 0;						// b
-	m_nFrameCount	= 0;						// t[JEg
-	m_digitWidth	= 0.0f;						// 1̕
-	m_digitHeight	= 0.0f;						// 1̍
-	m_basePos		= INIT_VEC3;				// \̊Jnʒu
-	m_pColon		= nullptr;					// R
-	m_nIdxTexture	= 0;						// eNX`CfbNX
-	m_nStartMinutes = 0;						// oߎԂ̊̌ʑp
-	m_nStartSeconds = 0;						// oߎԂ̊̌ʑp
-	m_isTimeUp		= false;					// ^CAbvtO
-	m_isActive		= false;					// ANeButO
-	m_isVisible		= true;						// \tO
+	// 値のクリア
+	m_pNumber		= nullptr;					// 数字表示用
+	m_nMinutes		= 0;						// 分
+	m_nSeconds		= 0;						// 秒
+	m_nFrameCount	= 0;						// フレームカウント
+	m_digitWidth	= 0.0f;						// 数字1桁あたりの幅
+	m_digitHeight	= 0.0f;						// 数字1桁あたりの高さ
+	m_basePos		= INIT_VEC3;				// 表示の開始位置
+	m_nStartMinutes = 0;						// 経過時間の割合の結果代入用
+	m_nStartSeconds = 0;						// 経過時間の割合の結果代入用
+	m_isTimeUp		= false;					// タイムアップフラグ
+	m_isActive		= false;					// アクティブフラグ
+	m_isVisible		= true;						// 表示フラグ
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CTime::~CTime()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CTime* CTime::Create(int minutes, int seconds,float baseX,float baseY,float digitWidth,float digitHeight, bool visibleFlag)
 {
 	CTime* pTime = new CTime;
 
-	// nullptr
+	// nullptrだったら
 	if (pTime == nullptr)
 	{
 		return nullptr;
@@ -61,11 +59,11 @@ CTime* CTime::Create(int minutes, int seconds,float baseX,float baseY,float digi
 	pTime->m_digitHeight = digitHeight;
 	pTime->m_isVisible = visibleFlag;
 
-	// oߎԂ̊߂邽߂ɕϐɑ
+	// 経過時間の割合を求めるために変数に代入
 	pTime->m_nStartMinutes = pTime->m_nMinutes;
 	pTime->m_nStartSeconds = pTime->m_nSeconds;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pTime->Init()))
 	{
 		return nullptr;
@@ -74,115 +72,73 @@ CTime* CTime::Create(int minutes, int seconds,float baseX,float baseY,float digi
 	return pTime;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CTime::Init(void)
 {
-	// ̐i0,1j
-	for (int nCnt = 0; nCnt < 2; nCnt++)
-	{
-		float posX = m_basePos.x + nCnt * m_digitWidth;
-		float posY = m_basePos.y;
-
-		// io[̐
-		m_apNumber[nCnt] = CNumber::Create(posX, posY, m_digitWidth, m_digitHeight);
-
-		if (!m_apNumber[nCnt])
-		{
-			return E_FAIL;
-		}
-	}
+	// 分と秒をコロンで区切って1つのナンバーで並べる
+	m_pNumber = CNumber::Create(m_basePos.x, m_basePos.y, m_digitWidth, m_digitHeight);
 
-	// R̐
-	CColon::Create(D3DXVECTOR3(m_basePos.x + 2 * m_digitWidth, m_basePos.y, 0.0f), m_digitWidth / 2, m_digitHeight, m_isVisible);
-
-	// R̕
-	float colonWidth = m_digitWidth / 2;
-
-	// b̐̓R̕Eɂ炷
-	for (int nCnt = 2; nCnt < DIGITS; nCnt++)
+	if (!m_pNumber)
 	{
-		float posX = m_basePos.x + colonWidth + nCnt * m_digitWidth;
-		float posY = m_basePos.y;
-
-		m_apNumber[nCnt] = CNumber::Create(posX, posY, m_digitWidth, m_digitHeight);
-
-		if (!m_apNumber[nCnt])
-		{
-			return E_FAIL;
-		}
+		return E_FAIL;
 	}
 
-	// eNX`蓖
-	CTexture* pTexture = CManager::GetTexture();
-	m_nIdxTexture = pTexture->RegisterDynamic("data/TEXTURE/num_01.png");
+	m_pNumber->SetTime(m_nMinutes, m_nSeconds);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CTime::Uninit(void)
 {
-	for (int nCnt = 0; nCnt < DIGITS; nCnt++)
+	if (m_pNumber != nullptr)
 	{
-		if (m_apNumber[nCnt] != nullptr)
-		{
-			// io[̏I
-			m_apNumber[nCnt]->Uninit();
+		// ナンバーの終了処理
+		m_pNumber->Uninit();
 
-			delete m_apNumber[nCnt];
-			m_apNumber[nCnt] = nullptr;
-		}
+		delete m_pNumber;
+		m_pNumber = nullptr;
 	}
 
-	// IuWFNg̔j(g)
+	// オブジェクトの破棄(自分自身)
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CTime::Update(void)
 {
 	if (m_isActive)
 	{
-		// ^C}[JEg_E
+		// タイマーカウントダウン処理
 		Countdown();
 	}
 
-	// e̕\lvZ
-	int min10 = m_nMinutes / 10;
-	int min1 = m_nMinutes % 10;
-	int sec10 = m_nSeconds / 10;
-	int sec1 = m_nSeconds % 10;
-
-	// io[IuWFNgɔf
-	if (m_apNumber[0]) m_apNumber[0]->SetDigit(min10);
-	if (m_apNumber[1]) m_apNumber[1]->SetDigit(min1);
-	if (m_apNumber[2]) m_apNumber[2]->SetDigit(sec10);
-	if (m_apNumber[3]) m_apNumber[3]->SetDigit(sec1);
-
-	for (int nCnt = 0; nCnt < DIGITS; nCnt++)
+	// 表示する時間を反映(変わった時だけ並べ直される)
+	if (m_pNumber)
 	{
-		m_apNumber[nCnt]->Update();  // UVXV
+		m_pNumber->SetTime(m_nMinutes, m_nSeconds);
+		m_pNumber->Update();
 	}
 }
 //=============================================================================
-// ^C}[JEgAbv
+// タイマーカウントアップ処理
 //=============================================================================
 void CTime::Countup(void)
 {
-	// t[JEg
+	// フレームカウント
 	m_nFrameCount++;
 
-	// 60t[o߂1bZ
+	// 60フレーム経過したら1秒加算
 	if (m_nFrameCount >= 60)
 	{
 		m_nFrameCount = 0;
 
 		m_nSeconds++;
 
-		// 60b1Jグ
+		// 60秒で1分繰り上げ
 		if (m_nSeconds >= 60)
 		{
 			m_nSeconds = 0;
@@ -191,26 +147,26 @@ void CTime::Countup(void)
 	}
 }
 //=============================================================================
-// ^C}[JEg_E
+// タイマーカウントダウン処理
 //=============================================================================
 void CTime::Countdown(void)
 {
-	// t[JEg
+	// フレームカウント
 	m_nFrameCount++;
 
-	// 60t[o߂1bZ
+	// 60フレーム経過したら1秒加算
 	if (m_nFrameCount >= 60)
 	{
 		m_nFrameCount = 0;
 
-		// b1炷
+		// 秒を1減らす
 		if (m_nSeconds > 0)
 		{
 			m_nSeconds--;
 		}
 		else
 		{
-			// b0̏ꍇA1炵ĕb59ɂ
+			// 秒が0の場合、分を1減らして秒を59にする
 			if (m_nMinutes > 0)
 			{
 				m_nMinutes--;
@@ -218,7 +174,7 @@ void CTime::Countdown(void)
 			}
 			else
 			{
-				// 0Ȃ^CAbv
+				// 分も0ならタイムアップ
 				m_nSeconds = 0;
 
 				m_isTimeUp = true;
@@ -227,60 +183,48 @@ void CTime::Countdown(void)
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CTime::Draw(void)
 {
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// \OFF̏ꍇ̓XLbv
+	// 表示OFFの場合はスキップ
 	if (!m_isVisible)
 	{
 		return;
 	}
 
-	for (int nCnt = 0; nCnt < DIGITS; nCnt++)
+	if (m_pNumber)
 	{
-		if (m_apNumber[nCnt])
-		{
-			// eNX`̐ݒ
-			pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-			// io[̕`揈
-			m_apNumber[nCnt]->Draw();
-		}
+		// ナンバーの描画処理
+		m_pNumber->Draw();
 	}
 }
 //=============================================================================
-// oߊ擾֐i0.0f ` 1.0fj
+// 経過割合を取得する関数（0.0f ～ 1.0f）
 //=============================================================================
 float CTime::GetProgress(void) const
 {
-	// Jn̑t[
+	// 開始時の総フレーム数
 	int totalFrames = (m_nStartMinutes * 60 + m_nStartSeconds) * 60;
 
-	// ݂̎ct[
+	// 現在の残りフレーム数
 	int currentFrames = (m_nMinutes * 60 + m_nSeconds) * 60 + (60 - m_nFrameCount);
 
-	// oߗvZi0.0 = JnA1.0 = Ij
+	// 経過率を計算（0.0 = 開始、1.0 = 終了）
 	float progress = 1.0f - (float)currentFrames / (float)totalFrames;
 
-	// ͈͂𐧌
+	// 範囲を制限
 	if (progress < 0.0f) progress = 0.0f;
 	if (progress > 1.0f) progress = 1.0f;
 
 	return progress;
 }
 //=============================================================================
-// ̔菈
+// 夜の判定処理
 //=============================================================================
 bool CTime::IsNight(void) const
 {
-	// oߎԂ̊擾
+	// 経過時間の割合を取得
 	float progress = GetProgress();
 
 	if (progress >= NIGHT_START_RATE && progress < NIGHT_END_RATE)
@@ -290,157 +234,3 @@ bool CTime::IsNight(void) const
 
 	return false;
 }
-
-
-//=============================================================================
-// R̃RXgN^
-//=============================================================================
-CColon::CColon(int nPriority) : CObject(nPriority)
-{
-	// l̃NA
-	m_pVtxBuff		= nullptr;		// _obt@
-	m_pos			= INIT_VEC3;	// ʒu
-	m_fWidth		= 0.0f;			// 
-	m_fHeight		= 0.0f;			// 
-	m_nIdxTexture	= 0;			// eNX`CfbNX
-	m_isVisible		= true;			// \tO
-}
-//=============================================================================
-// R̃fXgN^
-//=============================================================================
-CColon::~CColon()
-{
-	// Ȃ
-}
-//=============================================================================
-// R̐
-//=============================================================================
-CColon* CColon::Create(D3DXVECTOR3 pos, float fWidth, float fHeight, bool visibleFlag)
-{
-	CColon* pColon = new CColon;
-
-	// nullptr
-	if (pColon == nullptr)
-	{
-		return nullptr;
-	}
-
-	pColon->m_pos = pos;
-	pColon->m_fWidth = fWidth;
-	pColon->m_fHeight = fHeight;
-	pColon->SetVisible(visibleFlag);
-
-	// s
-	if (FAILED(pColon->Init()))
-	{
-		return nullptr;
-	}
-
-	return pColon;
-}
-//=============================================================================
-// Ȑ
-//=============================================================================
-HRESULT CColon::Init(void)
-{
-	// foCX擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`̓o^
-	m_nIdxTexture = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/colon.png");
-
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
-
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-
-	// _W̐ݒ
-	pVtx[0].pos = D3DXVECTOR3(m_pos.x, m_pos.y, 0.0f);
-	pVtx[1].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y, 0.0f);
-	pVtx[2].pos = D3DXVECTOR3(m_pos.x, m_pos.y + m_fHeight, 0.0f);
-	pVtx[3].pos = D3DXVECTOR3(m_pos.x + m_fWidth, m_pos.y + m_fHeight, 0.0f);
-
-	// rhw̐ݒ
-	pVtx[0].rhw = 1.0f;
-	pVtx[1].rhw = 1.0f;
-	pVtx[2].rhw = 1.0f;
-	pVtx[3].rhw = 1.0f;
-
-	// _J[̐ݒ
-	pVtx[0].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[1].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[2].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-	pVtx[3].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
-
-	// eNX`W̐ݒ
-	pVtx[0].tex = D3DXVECTOR2(0.0f, 0.0f);
-	pVtx[1].tex = D3DXVECTOR2(1.0f, 0.0f);
-	pVtx[2].tex = D3DXVECTOR2(0.0f, 1.0f);
-	pVtx[3].tex = D3DXVECTOR2(1.0f, 1.0f);
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-
-	return S_OK;
-}
-//=============================================================================
-// ȐI
-//=============================================================================
-void CColon::Uninit(void)
-{
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
-
-	CObject::Release();
-}
-//=============================================================================
-// R̍XV
-//=============================================================================
-void CColon::Update(void)
-{
-
-
-
-
-}
-//=============================================================================
-// R̕`揈
-//=============================================================================
-void CColon::Draw(void)
-{
-	// eNX`̎擾
-	CTexture* pTexture = CManager::GetTexture();
-
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// \OFF̏ꍇ̓XLbv
-	if (!m_isVisible)
-	{
-		return;
-	}
-
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_2D);
-
-	// eNX`̐ݒ
-	pDevice->SetTexture(0, pTexture->GetAddress(m_nIdxTexture));
-
-	// |S̕`
-	pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, 0, 2);
-}
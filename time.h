@@ -1,26 +1,20 @@
 //=============================================================================
 //
-// ^C [time.h]
+// タイム処理 [time.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _TIME_H_// ̃}N`ĂȂ
-#define _TIME_H_// 2dCN[hh~̃}N`
+#ifndef _TIME_H_// このマクロ定義がされていなかったら
+#define _TIME_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 #include "number.h"
 
-
-//*****************************************************************************
-// O錾
 //*****************************************************************************
-class CColon;
-
-//*****************************************************************************
-// ^CNX
+// タイムクラス
 //*****************************************************************************
 class CTime : public CObject
 {
@@ -28,8 +22,8 @@ public:
 	CTime(int nPriority = 6);
 	~CTime();
 
-	static constexpr float	NIGHT_START_RATE	= 0.30f;	// Jn
-	static constexpr float	NIGHT_END_RATE		= 0.90f;	// I
+	static constexpr float	NIGHT_START_RATE	= 0.30f;	// 夜開始割合
+	static constexpr float	NIGHT_END_RATE		= 0.90f;	// 夜終了割合
 
 	static CTime* Create(int minutes, int seconds, float baseX, float baseY, float digitWidth, float digitHeight, bool visibleFlag);
 	HRESULT Init(void);
@@ -50,49 +44,18 @@ public:
 	int GetnSeconds(void) { return m_nSeconds; }
 
 private:
-	static constexpr int	DIGITS				= 4;		// (2,b2)
-
-	CNumber*	m_apNumber[DIGITS];			// io[ւ̃|C^
-	int			m_nMinutes;					// 
-	int			m_nSeconds;					// b
-	int			m_nFrameCount;				// t[JEg
-	float		m_digitWidth;				// 1̕
-	float		m_digitHeight;				// 1̍
-	D3DXVECTOR3 m_basePos;					// \̊Jnʒu
-	CColon*		m_pColon;					// Rւ̃|C^
-	int			m_nIdxTexture;				// eNX`CfbNX
-	int			m_nStartMinutes;			// Jn̕
-	int			m_nStartSeconds;			// Jn̕b
-	bool		m_isActive;					// ANeButO
-	bool		m_isTimeUp;					// ^CAbvtO
-	bool		m_isVisible;				// \tO
-};
-
-//*****************************************************************************
-// RNX
-//*****************************************************************************
-class CColon : public CObject
-{
-public:
-	CColon(int nPriority = 6);
-	~CColon();
-
-	static CColon* Create(D3DXVECTOR3 pos, float fWidth, float fHeight, bool visibleFlag);
-	HRESULT Init(void);
-	void Uninit(void);
-	void Update(void);
-	void Draw(void);
-
-	void SetVisible(bool flag) { m_isVisible = flag; }
-
-private:
-	LPDIRECT3DVERTEXBUFFER9 m_pVtxBuff;		// _obt@
-	D3DXVECTOR3				m_pos;			// ʒu
-	float					m_fWidth;		// 
-	float					m_fHeight;		// 
-	int						m_nIdxTexture;	// eNX`CfbNX
-	bool					m_isVisible;	// \tO
-
+	CNumber*	m_pNumber;					// ナンバーへのポインタ(mm:ss)
+	int			m_nMinutes;					// 分
+	int			m_nSeconds;					// 秒
+	int			m_nFrameCount;				// フレームカウント
+	float		m_digitWidth;				// 数字1桁あたりの幅
+	float		m_digitHeight;				// 数字1桁あたりの高さ
+	D3DXVECTOR3 m_basePos;					// 表示の開始位置
+	int			m_nStartMinutes;			// 開始時の分
+	int			m_nStartSeconds;			// 開始時の秒
+	bool		m_isActive;					// アクティブフラグ
+	bool		m_isTimeUp;					// タイムアップフラグ
+	bool		m_isVisible;				// 表示フラグ
 };
 
 #endif
\ No newline at end of file
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// ^Cg [title.cpp]
+// タイトル処理 [title.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "title.h"
 #include "input.h"
@@ -14,90 +14,83 @@
 #include "dummyPlayer.h"
 #include "particle.h"
 #include "meshdome.h"
+#include "spritebatch.h"
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-CBlockManager* CTitle::m_pBlockManager = nullptr;		// ubN}l[W[ւ̃|C^
+CBlockManager* CTitle::m_pBlockManager = nullptr;		// ブロックマネージャーへのポインタ
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CTitle::CTitle() : CScene(CScene::MODE_TITLE)
 {
-	// l̃NA
-	m_pVtxBuff			= nullptr;		// _obt@ւ̃|C^
-	m_nIdxTextureTitle	= 0;			// eNX`CfbNX
-	m_pLight			= nullptr;		// Cgւ̃|C^
-	m_timer				= 0;			// ^C}[
+	// 値のクリア
+	memset(m_aVtx, 0, sizeof(m_aVtx));	// 頂点
+	m_nIdxTextureTitle	= -1;			// テクスチャインデックス
+	m_pLight			= nullptr;		// ライトへのポインタ
+	m_nLightGeneration	= 0;			// 登録した時のライトの世代
+	m_timer				= 0;			// タイマー
 
 	for (int nCnt = 0; nCnt < TYPE_MAX; nCnt++)
 	{
-		m_vertexRanges[nCnt] = { -1, -1 }; // gplŏ
+		m_vertexRanges[nCnt] = { -1, -1 }; // 未使用値で初期化
+	}
+
+	for (int nCnt = 0; nCnt < LIGHT_MAX; nCnt++)
+	{
+		m_anLight[nCnt] = -1;		// 登録したライトの番号
 	}
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CTitle::~CTitle()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CTitle::Init(void)
 {
-	// }EXJ[\\
+	// マウスカーソルを表示する
 	CManager::GetInputMouse()->SetCursorVisibility(true);
 
-	// ubN}l[W[̐
+	// ブロックマネージャーの生成
 	m_pBlockManager = new CBlockManager;
 
-	// ubN}l[W[̏
+	// ブロックマネージャーの初期化
 	m_pBlockManager->Init();
 
-	// Cg̐
+	// ライトの生成
 	m_pLight = new CLight;
 
-	// Cg̏
+	// ライトの初期化
 	m_pLight->Init();
 
-	// Cg̍Đݒ菈
+	// ライトの再設定処理
 	ResetLight();
 
-	// JSON̓ǂݍ
+	// JSONの読み込み
 	m_pBlockManager->LoadFromJson("data/title_blockinfo.json");
 
-	// _~[vC[̐
+	// ダミープレイヤーの生成
 	CDummyPlayer::Create(D3DXVECTOR3(300.0f, 110.0f, -10.0f), D3DXVECTOR3(0.0f, 180.0f, 0.0f), CDummyPlayer::NEUTRAL);
 
-	// bVh[̐
+	// メッシュドームの生成
 	CMeshDome::Create(D3DXVECTOR3(0.0f, -50.0f, 0.0f), 2800);
 
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// eNX`̎擾
+	// テクスチャの取得
 	m_nIdxTextureTitle = CManager::GetTexture()->RegisterDynamic("data/TEXTURE/title.png");
 
-	m_vertexRanges[TYPE_FIRST] = { 0, 3 }; // ^Cg
+	m_vertexRanges[TYPE_FIRST] = { 0, 3 }; // タイトル
 
-	// _obt@̐
-	pDevice->CreateVertexBuffer(sizeof(VERTEX_2D) * 4 * TITLE_ITEM_NUM,
-		D3DUSAGE_WRITEONLY,
-		FVF_VERTEX_2D,
-		D3DPOOL_MANAGED,
-		&m_pVtxBuff,
-		NULL);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
-	
-	// obNobt@TCY̎擾
+	// バックバッファサイズの取得
 	float screenW = (float)CManager::GetRenderer()->GetBackBufferWidth();
 	float screenH = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
@@ -114,19 +107,19 @@ HRESULT CTitle::Init(void)
 
 	for (int nCnt = 0; nCnt < TITLE_ITEM_NUM; nCnt++)
 	{
-		// _W̐ݒ
+		// 頂点座標の設定
 		pVtx[0].pos = D3DXVECTOR3(images[nCnt].pos.x - images[nCnt].width, images[nCnt].pos.y - images[nCnt].height, 0.0f);
 		pVtx[1].pos = D3DXVECTOR3(images[nCnt].pos.x + images[nCnt].width, images[nCnt].pos.y - images[nCnt].height, 0.0f);
 		pVtx[2].pos = D3DXVECTOR3(images[nCnt].pos.x - images[nCnt].width, images[nCnt].pos.y + images[nCnt].height, 0.0f);
 		pVtx[3].pos = D3DXVECTOR3(images[nCnt].pos.x + images[nCnt].width, images[nCnt].pos.y + images[nCnt].height, 0.0f);
 
-		// rhw̐ݒ
+		// rhwの設定
 		pVtx[0].rhw = 1.0f;
 		pVtx[1].rhw = 1.0f;
 		pVtx[2].rhw = 1.0f;
 		pVtx[3].rhw = 1.0f;
 
-		//_J[̐ݒ
+		//頂点カラーの設定
 		pVtx[0].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 		pVtx[1].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
 		pVtx[2].col = D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f);
@@ -140,28 +133,25 @@ HRESULT CTitle::Init(void)
 		pVtx += 4;
 	}
 
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
-
-	// ڑI̐
+	// 項目選択の生成
 	m_pItemSelect = std::make_unique<CItemSelect>();
 
-	// ڑȈ
+	// 項目選択の初期化処理
 	m_pItemSelect->Init();
 
-	// J̎擾
+	// カメラの取得
 	CCamera* pCamera = CManager::GetCamera();
 
-	// J̏ʒuݒ肵Ă
+	// カメラの初期位置を設定しておく
 	pCamera->SetCamParameter(D3DXVECTOR3(437.4f, 116.0f, 90.3f),
 		D3DXVECTOR3(124.0f, 265.5f, -630.5f),
 		D3DXVECTOR3(-0.19f, 0.41f, 0.0f),
 		0.0f);
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// ^CgBGM̍Đ
+	// タイトルBGMの再生
 	if (pSound)
 	{
 		pSound->Play(CSound::SOUND_LABEL_TITLEBGM);
@@ -170,11 +160,15 @@ HRESULT CTitle::Init(void)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CTitle::Uninit(void)
 {
-	// ubN}l[W[̔j
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_nIdxTextureTitle);
+	m_nIdxTextureTitle = -1;
+
+	// ブロックマネージャーの破棄
 	if (m_pBlockManager != nullptr)
 	{
 		m_pBlockManager->Uninit();
@@ -183,51 +177,44 @@ void CTitle::Uninit(void)
 		m_pBlockManager = nullptr;
 	}
 
-	// Cg̔j
+	// ライトの破棄
 	if (m_pLight != nullptr)
 	{
 		delete m_pLight;
 		m_pLight = nullptr;
 	}
-
-	// _obt@̔j
-	if (m_pVtxBuff != nullptr)
-	{
-		m_pVtxBuff->Release();
-		m_pVtxBuff = nullptr;
-	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CTitle::Update(void)
 {
-	// S̍XV
+	// ロゴの更新処理
 	UpdateLogoVertex();
 
 	m_timer++;
 
-	if (m_timer >= BLOSSOM_INTERVAL)// ԊuŐ
-	{// o̐
-		// Zbg
+	if (m_timer >= BLOSSOM_INTERVAL)// 一定間隔で生成
+	{// 塵の生成
+		// リセット
 		m_timer = 0;
 
-		// p[eBN
+		// パーティクル生成
 		CParticle::Create<CBlossomParticle>(INIT_VEC3, CManager::GetCamera()->GetPosR(), D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.8f), 0, 1);
 	}
 
-	// ڑI̍XV
+	// 項目選択の更新処理
 	m_pItemSelect->Update();
 
-	// ubN}l[W[̍XV
+	// ブロックマネージャーの更新処理
 	m_pBlockManager->Update();
 }
 //=============================================================================
-// S̍XV
+// ロゴの更新処理
 //=============================================================================
 void CTitle::UpdateLogoVertex(void)
 {
-	// obNobt@TCY̎擾
+	// バックバッファサイズの取得
 	float screenW = (float)CManager::GetRenderer()->GetBackBufferWidth();
 	float screenH = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
@@ -237,118 +224,94 @@ void CTitle::UpdateLogoVertex(void)
 	float cx = screenW * ANCHOR_X;
 	float cy = screenH * ANCHOR_Y;
 
-	VERTEX_2D* pVtx;// _ւ̃|C^
-
-	// _obt@bNA_ւ̃|C^擾
-	m_pVtxBuff->Lock(0, 0, (void**)&pVtx, 0);
+	VERTEX_2D* pVtx = m_aVtx;// 頂点情報へのポインタ
 
 	pVtx[0].pos = { cx - logoW, cy - logoH, 0.0f };
 	pVtx[1].pos = { cx + logoW, cy - logoH, 0.0f };
 	pVtx[2].pos = { cx - logoW, cy + logoH, 0.0f };
 	pVtx[3].pos = { cx + logoW, cy + logoH, 0.0f };
-
-	// _obt@AbN
-	m_pVtxBuff->Unlock();
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CTitle::Draw(void)
 {
-	// J̎擾
+	// カメラの取得
 	CCamera* pCamera = CManager::GetCamera();
 
 	if (!pCamera->GetMode() == CCamera::MODE_EDIT)
 	{
-		// J̐ݒ
+		// カメラの設定
 		pCamera->SetCamParameter(D3DXVECTOR3(437.4f, 116.0f, 90.3f),
 			D3DXVECTOR3(124.0f, 265.5f, -630.5f),
 			D3DXVECTOR3(-0.19f, 0.41f, 0.0f),
 			0.0f);
 	}
 
-	// foCX̎擾
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-	// _obt@f[^Xg[ɐݒ
-	pDevice->SetStreamSource(0, m_pVtxBuff, 0, sizeof(VERTEX_2D));
-
-	// _tH[}bg̐ݒ
-	pDevice->SetFVF(FVF_VERTEX_2D);
-
-	// eNX`CfbNXz
+	// テクスチャインデックス配列
 	int textures[1] = { m_nIdxTextureTitle };
 
-	// eeNX`Ƃɕ`
+	// 各テクスチャごとにまとめ描画に積む
 	for (int nCnt = 0; nCnt < TYPE_MAX; nCnt++)
 	{
-		// eNX`̐ݒ
-		pDevice->SetTexture(0, CManager::GetTexture()->GetAddress(textures[nCnt]));
-
-		// |S̕`
-		pDevice->DrawPrimitive(D3DPT_TRIANGLESTRIP, m_vertexRanges[nCnt].start, 2);
+		CSpriteBatch::Submit(&m_aVtx[m_vertexRanges[nCnt].start], textures[nCnt]);
 	}
 }
 //=============================================================================
-// Cgݒ菈
+// ライト設定処理(登録済みなら色と向きだけ書き換える)
 //=============================================================================
 void CTitle::ResetLight(void)
 {
-	// Cg폜Ă
-	CLight::Uninit();
-
-	// gFE΂߉
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f),    // IWn
-		D3DXVECTOR3(-0.3f, -0.8f, 0.2f),       // ̂悤Ɏ΂
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
-
-	// gF
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f),    // IWn
-		D3DXVECTOR3(0.0f, -0.8f, -0.2f),
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
-
-	// 
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.3f, 0.35f, 0.5f, 1.0f),    // [̋̊F
-		D3DXVECTOR3(0.0f, 1.0f, 0.0f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
-
-	// Iȕ⏕
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.5f, 0.4f, 0.4f, 1.0f),     // _炩߂̐Ԍn
-		D3DXVECTOR3(0.3f, -0.2f, -0.3f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
+	// 暖色・斜め下方向(オレンジ系で西日のように斜め)
+	SetSceneLight(LIGHT_SUNSET, D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f), D3DXVECTOR3(-0.3f, -0.8f, 0.2f), D3DXVECTOR3(0.0f, 300.0f, 0.0f));
+
+	// 暖色(オレンジ系)
+	SetSceneLight(LIGHT_WARM, D3DXCOLOR(1.0f, 0.65f, 0.4f, 1.0f), D3DXVECTOR3(0.0f, -0.8f, -0.2f), D3DXVECTOR3(0.0f, 300.0f, 0.0f));
+
+	// 薄い青(夕方の空の寒色寄り)
+	SetSceneLight(LIGHT_SKY, D3DXCOLOR(0.3f, 0.35f, 0.5f, 1.0f), D3DXVECTOR3(0.0f, 1.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 環境的な補助光(柔らかめの赤系)
+	SetSceneLight(LIGHT_FILL, D3DXCOLOR(0.5f, 0.4f, 0.4f, 1.0f), D3DXVECTOR3(0.3f, -0.2f, -0.3f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 登録した世代を覚えておく
+	m_nLightGeneration = CLight::GetGeneration();
+}
+//=============================================================================
+// シーンライトの設定処理(登録は1回だけ行い、以降は色と向きだけ書き換える)
+//=============================================================================
+void CTitle::SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos)
+{
+	// ライトが作り直されていたら登録し直す
+	if (m_anLight[light] < 0 || m_nLightGeneration != CLight::GetGeneration())
+	{
+		m_anLight[light] = CLight::AddLight(D3DLIGHT_DIRECTIONAL, col, dir, pos);
+		return;
+	}
+
+	CLight::SetLightDiffuse(m_anLight[light], col);
+	CLight::SetLightDirection(m_anLight[light], dir);
 }
 //=============================================================================
-// foCXZbgʒm
+// デバイスリセット通知
 //=============================================================================
 void CTitle::OnDeviceReset(void)
 {
-	// Cg̍Đݒ菈
+	// ライトの再設定処理
 	ResetLight();
 }
 //=============================================================================
-// TlC[Xʒm
+// サムネイルリリース通知
 //=============================================================================
 void CTitle::ReleaseThumbnail(void)
 {
 	m_pBlockManager->ReleaseThumbnailRenderTarget();
 }
 //=============================================================================
-// TlCZbgʒm
+// サムネイルリセット通知
 //=============================================================================
 void CTitle::ResetThumbnail(void)
 {
 	m_pBlockManager->InitThumbnailRenderTarget(CManager::GetRenderer()->GetDevice());
-	m_pBlockManager->GenerateThumbnailsForResources(); // LbVč쐬
+	m_pBlockManager->GenerateThumbnailsForResources(); // キャッシュも再作成
 }
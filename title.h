@@ -1,14 +1,14 @@
 //=============================================================================
 //
-// ^Cg [title.h]
+// タイトル処理 [title.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _TITLE_H_// ̃}N`ĂȂ
-#define _TITLE_H_// 2dCN[hh~̃}N`
+#ifndef _TITLE_H_// このマクロ定義がされていなかったら
+#define _TITLE_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 #include "blockmanager.h"
@@ -16,15 +16,15 @@
 #include "itemselect.h"
 
 //*****************************************************************************
-// ^CgNX
+// タイトルクラス
 //*****************************************************************************
 class CTitle : public CScene
 {
 public:
-	//^Cg̎
+	//タイトルの種類
 	typedef enum
 	{
-		TYPE_FIRST = 0,	// ^Cg
+		TYPE_FIRST = 0,	// タイトル
 		TYPE_MAX
 	}TYPE;
 
@@ -45,7 +45,7 @@ public:
 
 private:
 
-	// e摜̍\
+	// 各画像の構造体
 	struct ImageInfo
 	{
 		D3DXVECTOR3 pos;
@@ -53,7 +53,7 @@ private:
 		float height;
 	};
 
-	// _͈̔͂`\
+	// 頂点の範囲を定義する構造体
 	typedef struct
 	{
 		int start;
@@ -61,20 +61,34 @@ private:
 	}VertexRange;
 
 private:
-	static constexpr int	TITLE_ITEM_NUM		= 1;			// ^CgUI
-	static constexpr float	ANCHOR_X			= 0.25f;		// ʒui%j
-	static constexpr float	ANCHOR_Y			= 0.3f;			// cʒui%j
-	static constexpr float	LOGO_WRATE			= 0.4f;			// ʕɑ΂Ă̍ڕ
-	static constexpr float	LOGO_HRATE			= 0.3f;			// ʍɑ΂Ă̍ڍ
-	static constexpr int	BLOSSOM_INTERVAL	= 15;			// ̐C^[o
+	static constexpr int	TITLE_ITEM_NUM		= 1;			// タイトルのUI数
+	static constexpr float	ANCHOR_X			= 0.25f;		// 横位置（%）
+	static constexpr float	ANCHOR_Y			= 0.3f;			// 縦位置（%）
+	static constexpr float	LOGO_WRATE			= 0.4f;			// 画面幅に対しての項目幅率
+	static constexpr float	LOGO_HRATE			= 0.3f;			// 画面高さに対しての項目高さ率
+	static constexpr int	BLOSSOM_INTERVAL	= 15;			// 桜の生成インターバル
 
-	VertexRange					 m_vertexRanges[TYPE_MAX];	// ^CvƂɒ_͈͂ݒ
-	LPDIRECT3DVERTEXBUFFER9		 m_pVtxBuff;				// _obt@ւ̃|C^
-	int							 m_nIdxTextureTitle;		// eNX`CfbNX
-	static CBlockManager*		 m_pBlockManager;			// ubN}l[W[ւ̃|C^
-	CLight*						 m_pLight;					// Cgւ̃|C^
-	int							 m_timer;					// p[eBN^C}[
-	std::unique_ptr<CItemSelect> m_pItemSelect;				// ڑIւ̃|C^
+	// タイトルで使うライト
+	typedef enum
+	{
+		LIGHT_SUNSET = 0,	// 暖色・斜め下方向
+		LIGHT_WARM,			// 暖色
+		LIGHT_SKY,			// 薄い青
+		LIGHT_FILL,			// 環境的な補助光
+		LIGHT_MAX
+	}LIGHT;
+
+	void SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos);
+
+	VertexRange					 m_vertexRanges[TYPE_MAX];	// タイプごとに頂点範囲を設定
+	VERTEX_2D					 m_aVtx[4 * TITLE_ITEM_NUM];// 頂点
+	int							 m_nIdxTextureTitle;		// テクスチャインデックス
+	static CBlockManager*		 m_pBlockManager;			// ブロックマネージャーへのポインタ
+	CLight*						 m_pLight;					// ライトへのポインタ
+	int							 m_anLight[LIGHT_MAX];		// 登録したライトの番号
+	unsigned int				 m_nLightGeneration;		// 登録した時のライトの世代
+	int							 m_timer;					// パーティクル生成タイマー
+	std::unique_ptr<CItemSelect> m_pItemSelect;				// 項目選択へのポインタ
 
 };
 
@@ -0,0 +1,190 @@
+//=============================================================================
+//
+// メッシュ変換ツール [meshcook.cpp]
+// Author : RIKU TANEKAWA
+//
+// 使い方 : meshcook [リポジトリのフォルダ] [結果のファイル]
+// ゲームの-cookmeshと同じく data/MODELS 以下の.xを全て同じ場所の.xmbに変換する。
+// 読めるのはテキスト形式で1つのMeshだけを持つ.x(バイナリ形式やフレームの階層はゲームで変換する)
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "xmesh.h"
+#include "algorithm"
+#include "cstdio"
+#include "cstring"
+#include "fstream"
+#include "iterator"
+#include "sstream"
+#include "dirent.h"
+#include "sys/stat.h"
+#include "unistd.h"
+
+//*****************************************************************************
+// 定数宣言
+//*****************************************************************************
+namespace
+{
+	const char* const SOURCE_DIR	= "data/MODELS/";	// 元の.xのフォルダ(サブフォルダも含む)
+	const char* const COOKED_EXT	= ".xmb";			// 変換後の拡張子
+}
+
+//=============================================================================
+// .xを集める処理(サブフォルダも探す)
+//=============================================================================
+static void FindSources(const std::string& dir, std::vector<std::string>* pOut)
+{
+	DIR* pDir = opendir(dir.c_str());
+
+	if (pDir == nullptr)
+	{
+		return;
+	}
+
+	while (dirent* pEntry = readdir(pDir))
+	{
+		std::string name = pEntry->d_name;
+
+		if (name == "." || name == "..")
+		{
+			continue;
+		}
+
+		struct stat st;
+
+		if (stat((dir + name).c_str(), &st) != 0)
+		{
+			continue;
+		}
+
+		if (S_ISDIR(st.st_mode))
+		{
+			FindSources(dir + name + "/", pOut);
+		}
+		else if (name.size() > 2 && strcasecmp(name.c_str() + name.size() - 2, ".x") == 0)
+		{
+			pOut->push_back(dir + name);
+		}
+	}
+
+	closedir(pDir);
+}
+//=============================================================================
+// 1ファイルの変換処理
+//=============================================================================
+static bool Cook(const std::string& source, std::string* pLog)
+{
+	*pLog = source + ",0,0,0,-,no,0,0";
+
+	std::ifstream ifs(source, std::ios::binary);
+
+	if (!ifs)
+	{
+		*pLog += ",read";
+		return false;
+	}
+
+	std::vector<char> text((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+	CXMesh::Mesh mesh;
+	std::string error;
+
+	if (!CXMesh::Parse(text.data(), text.size(), &mesh, &error))
+	{
+		*pLog += "," + error;
+		return false;
+	}
+
+	float fSourceAcmr = CXMesh::CalcACMR(mesh);
+	CXMesh::Optimize(&mesh);
+	float fCookedAcmr = CXMesh::CalcACMR(mesh);
+
+	std::vector<unsigned char> out;
+	CXMesh::Serialize(mesh, &out);
+
+	// 書き出してから読み戻して確認する
+	std::string cooked = source.substr(0, source.size() - 2) + COOKED_EXT;
+	std::ofstream ofs(cooked, std::ios::binary);
+
+	if (!ofs)
+	{
+		*pLog += ",write";
+		return false;
+	}
+
+	ofs.write((const char*)out.data(), out.size());
+	ofs.close();
+
+	std::ifstream back(cooked, std::ios::binary);
+	std::vector<unsigned char> data((std::istreambuf_iterator<char>(back)), std::istreambuf_iterator<char>());
+	bool bValid = (data == out) && CXMesh::Validate(data.data(), data.size());
+
+	unsigned int nNumVertices = CXMesh::GetNumVertices(mesh);
+	char aLine[512];
+	snprintf(aLine, sizeof(aLine), "%s,%u,%u,%u,%s,%s,%.3f,%.3f",
+		source.c_str(), nNumVertices, (unsigned int)(mesh.indices.size() / 3), (unsigned int)mesh.table.size(),
+		nNumVertices > 0xffff ? "32" : "16", bValid ? "yes" : "no", fSourceAcmr, fCookedAcmr);
+	*pLog = aLine;
+
+	return bValid;
+}
+//=============================================================================
+// メイン関数
+//=============================================================================
+int main(int argc, char* argv[])
+{
+	const char* pRoot = (argc > 1) ? argv[1] : ".";
+	const char* pLogFile = (argc > 2) ? argv[2] : "cookmesh.txt";
+
+	// 結果のファイルは呼び出した場所に書くので、先に開いておく
+	FILE* pFile = fopen(pLogFile, "w");
+
+	if (chdir(pRoot) != 0)
+	{
+		fprintf(stderr, "meshcook: cannot open %s\n", pRoot);
+
+		if (pFile != nullptr)
+		{
+			fclose(pFile);
+		}
+
+		return 1;
+	}
+
+	std::vector<std::string> sources;
+	FindSources(SOURCE_DIR, &sources);
+	std::sort(sources.begin(), sources.end());
+
+	std::ostringstream log;
+	int nNumFailed = 0;
+
+	for (const auto& source : sources)
+	{
+		std::string line;
+
+		if (!Cook(source, &line))
+		{
+			nNumFailed++;
+		}
+
+		log << line << "\n";
+	}
+
+	// 結果の書き出し
+	if (pFile != nullptr)
+	{
+		fprintf(pFile, "sources          : %d\n", (int)sources.size());
+		fprintf(pFile, "failed           : %d\n", nNumFailed);
+		fprintf(pFile, "acmr fifo        : %d\n\n", CXMesh::FIFO_SIZE);
+		fprintf(pFile, "file,vertices,faces,subsets,index,valid,x_acmr,xmb_acmr\n");
+		fprintf(pFile, "%s", log.str().c_str());
+
+		// ファイルを閉じる
+		fclose(pFile);
+	}
+
+	return nNumFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,1218 @@
+//=============================================================================
+//
+// .x解析処理 [xmesh.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "xmesh.h"
+#include "algorithm"
+#include "cfloat"
+#include "cmath"
+#include "cstdlib"
+#include "cstring"
+#include "map"
+#include "unordered_map"
+
+//*****************************************************************************
+// 字句解析(区切りの , と ; は数の並びを数で読むので空白と同じに扱う)
+//*****************************************************************************
+namespace
+{
+	class CTokenizer
+	{
+	public:
+		CTokenizer(const char* pText, size_t size) : m_p(pText), m_pEnd(pText + size) {}
+
+		// 次の字句の取得(終わりなら空)
+		std::string Next(void)
+		{
+			SkipSpace();
+
+			if (m_p >= m_pEnd)
+			{
+				return std::string();
+			}
+
+			if (*m_p == '{' || *m_p == '}')
+			{
+				return std::string(1, *m_p++);
+			}
+
+			if (*m_p == '"')
+			{// 文字列は " を含めて返す
+				const char* pStart = m_p++;
+
+				while (m_p < m_pEnd && *m_p != '"')
+				{
+					m_p++;
+				}
+
+				m_p = std::min(m_p + 1, m_pEnd);
+
+				return std::string(pStart, m_p);
+			}
+
+			if (*m_p == '<')
+			{// GUID
+				const char* pStart = m_p;
+
+				while (m_p < m_pEnd && *m_p != '>')
+				{
+					m_p++;
+				}
+
+				m_p = std::min(m_p + 1, m_pEnd);
+
+				return std::string(pStart, m_p);
+			}
+
+			const char* pStart = m_p;
+
+			while (m_p < m_pEnd && !IsSeparator(*m_p))
+			{
+				m_p++;
+			}
+
+			return std::string(pStart, m_p);
+		}
+
+		// 整数の読み込み
+		bool ReadUInt(unsigned int* pOut)
+		{
+			std::string token = Next();
+			char* pEnd = nullptr;
+			unsigned long nValue = strtoul(token.c_str(), &pEnd, 10);
+
+			if (token.empty() || *pEnd != '\0')
+			{
+				return false;
+			}
+
+			*pOut = (unsigned int)nValue;
+
+			return true;
+		}
+
+		// 小数の読み込み
+		bool ReadFloat(float* pOut)
+		{
+			std::string token = Next();
+			char* pEnd = nullptr;
+			*pOut = strtof(token.c_str(), &pEnd);
+
+			return !token.empty() && *pEnd == '\0';
+		}
+
+		// { から対応する } までを読み飛ばす({ は読んだ後)
+		bool SkipBlock(void)
+		{
+			int nDepth = 1;
+
+			while (nDepth > 0)
+			{
+				std::string token = Next();
+
+				if (token.empty())
+				{
+					return false;
+				}
+
+				nDepth += (token == "{") ? 1 : (token == "}") ? -1 : 0;
+			}
+
+			return true;
+		}
+
+		// 次の { までの名前を読む(名前が無ければ空)
+		bool ReadOpen(std::string* pName)
+		{
+			pName->clear();
+			std::string token = Next();
+
+			if (token != "{")
+			{
+				*pName = token;
+				token = Next();
+			}
+
+			return token == "{";
+		}
+
+	private:
+		static bool IsSeparator(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' || c == ';' || c == '{' || c == '}' || c == '"';
+		}
+
+		void SkipSpace(void)
+		{
+			while (m_p < m_pEnd)
+			{
+				if (*m_p == '#' || (*m_p == '/' && m_p + 1 < m_pEnd && m_p[1] == '/'))
+				{// 行末までコメント
+					while (m_p < m_pEnd && *m_p != '\n')
+					{
+						m_p++;
+					}
+				}
+				else if (*m_p == ' ' || *m_p == '\t' || *m_p == '\r' || *m_p == '\n' || *m_p == ',' || *m_p == ';')
+				{
+					m_p++;
+				}
+				else
+				{
+					break;
+				}
+			}
+		}
+
+		const char* m_p;	// 今の位置
+		const char* m_pEnd;	// 終わり
+	};
+
+	// .xの面(多角形のまま持つ)
+	typedef struct
+	{
+		std::vector<unsigned int> position;	// 位置の番号
+		std::vector<unsigned int> normal;	// 法線の番号(無ければ空)
+	}Face;
+
+	// .xのメッシュ
+	typedef struct
+	{
+		std::vector<float>				positions;		// 位置
+		std::vector<float>				normals;		// 法線
+		std::vector<float>				texcoords;		// UV(位置と同じ番号)
+		std::vector<Face>				faces;			// 面
+		std::vector<unsigned int>		faceMaterial;	// 面ごとのマテリアル
+		std::vector<CXMesh::Material>	materials;		// マテリアル
+		bool							bNormal;		// 法線があるか
+		bool							bTexcoord;		// UVがあるか
+	}SourceMesh;
+
+	//=========================================================================
+	// マテリアルの読み込み({ の後から)
+	//=========================================================================
+	bool ReadMaterial(CTokenizer& tok, CXMesh::Material* pOut)
+	{
+		*pOut = CXMesh::Material();
+
+		for (int nCnt = 0; nCnt < 4; nCnt++)
+		{
+			if (!tok.ReadFloat(&pOut->diffuse[nCnt]))
+			{
+				return false;
+			}
+		}
+
+		if (!tok.ReadFloat(&pOut->power))
+		{
+			return false;
+		}
+
+		for (int nCnt = 0; nCnt < 3; nCnt++)
+		{
+			if (!tok.ReadFloat(&pOut->specular[nCnt]))
+			{
+				return false;
+			}
+		}
+
+		for (int nCnt = 0; nCnt < 3; nCnt++)
+		{
+			if (!tok.ReadFloat(&pOut->emissive[nCnt]))
+			{
+				return false;
+			}
+		}
+
+		// 子(テクスチャ名だけ使う)
+		while (true)
+		{
+			std::string token = tok.Next();
+
+			if (token == "}")
+			{
+				return true;
+			}
+
+			if (token.empty())
+			{
+				return false;
+			}
+
+			std::string name;
+
+			if (token != "{" && !tok.ReadOpen(&name))
+			{
+				return false;
+			}
+
+			if (token == "TextureFilename" || token == "TextureFileName")
+			{
+				std::string str = tok.Next();
+
+				if (str.size() >= 2 && str.front() == '"' && str.back() == '"')
+				{
+					pOut->texture = str.substr(1, str.size() - 2);
+				}
+
+				if (tok.Next() != "}")
+				{
+					return false;
+				}
+			}
+			else if (!tok.SkipBlock())
+			{
+				return false;
+			}
+		}
+	}
+
+	//=========================================================================
+	// 面の並びの読み込み(数・[頂点数・番号...]...)
+	//=========================================================================
+	bool ReadFaces(CTokenizer& tok, std::vector<std::vector<unsigned int>>* pOut)
+	{
+		unsigned int nNumFaces = 0;
+
+		if (!tok.ReadUInt(&nNumFaces))
+		{
+			return false;
+		}
+
+		pOut->resize(nNumFaces);
+
+		for (auto& face : *pOut)
+		{
+			unsigned int nNumIdx = 0;
+
+			if (!tok.ReadUInt(&nNumIdx) || nNumIdx < 3)
+			{
+				return false;
+			}
+
+			face.resize(nNumIdx);
+
+			for (auto& nIdx : face)
+			{
+				if (!tok.ReadUInt(&nIdx))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	//=========================================================================
+	// メッシュの読み込み({ の後から)
+	//=========================================================================
+	bool ReadMesh(CTokenizer& tok, const std::map<std::string, CXMesh::Material>& named, SourceMesh* pOut, std::string* pError)
+	{
+		unsigned int nNumVertices = 0;
+
+		if (!tok.ReadUInt(&nNumVertices))
+		{
+			*pError = "Mesh: vertex count";
+			return false;
+		}
+
+		pOut->positions.resize((size_t)nNumVertices * 3);
+
+		for (auto& fValue : pOut->positions)
+		{
+			if (!tok.ReadFloat(&fValue))
+			{
+				*pError = "Mesh: vertices";
+				return false;
+			}
+		}
+
+		std::vector<std::vector<unsigned int>> faces;
+
+		if (!ReadFaces(tok, &faces))
+		{
+			*pError = "Mesh: faces";
+			return false;
+		}
+
+		pOut->faces.resize(faces.size());
+
+		for (size_t nCnt = 0; nCnt < faces.size(); nCnt++)
+		{
+			for (unsigned int nIdx : faces[nCnt])
+			{
+				if (nIdx >= nNumVertices)
+				{
+					*pError = "Mesh: face index out of range";
+					return false;
+				}
+			}
+
+			pOut->faces[nCnt].position = faces[nCnt];
+		}
+
+		// 子
+		while (true)
+		{
+			std::string token = tok.Next();
+
+			if (token == "}")
+			{
+				break;
+			}
+
+			if (token.empty())
+			{
+				*pError = "Mesh: unexpected end";
+				return false;
+			}
+
+			std::string name;
+
+			if (token != "{" && !tok.ReadOpen(&name))
+			{
+				*pError = "Mesh: " + token;
+				return false;
+			}
+
+			if (token == "MeshNormals")
+			{
+				unsigned int nNumNormals = 0;
+
+				if (!tok.ReadUInt(&nNumNormals))
+				{
+					*pError = "MeshNormals: count";
+					return false;
+				}
+
+				pOut->normals.resize((size_t)nNumNormals * 3);
+
+				for (auto& fValue : pOut->normals)
+				{
+					if (!tok.ReadFloat(&fValue))
+					{
+						*pError = "MeshNormals: normals";
+						return false;
+					}
+				}
+
+				std::vector<std::vector<unsigned int>> normalFaces;
+
+				if (!ReadFaces(tok, &normalFaces) || normalFaces.size() != pOut->faces.size())
+				{
+					*pError = "MeshNormals: faces";
+					return false;
+				}
+
+				for (size_t nCnt = 0; nCnt < normalFaces.size(); nCnt++)
+				{
+					if (normalFaces[nCnt].size() != pOut->faces[nCnt].position.size())
+					{
+						*pError = "MeshNormals: face size";
+						return false;
+					}
+
+					for (unsigned int nIdx : normalFaces[nCnt])
+					{
+						if (nIdx >= nNumNormals)
+						{
+							*pError = "MeshNormals: index out of range";
+							return false;
+						}
+					}
+
+					pOut->faces[nCnt].normal = normalFaces[nCnt];
+				}
+
+				pOut->bNormal = true;
+
+				if (tok.Next() != "}")
+				{
+					*pError = "MeshNormals: }";
+					return false;
+				}
+			}
+			else if (token == "MeshTextureCoords")
+			{
+				unsigned int nNumCoords = 0;
+
+				if (!tok.ReadUInt(&nNumCoords) || nNumCoords != nNumVertices)
+				{
+					*pError = "MeshTextureCoords: count";
+					return false;
+				}
+
+				pOut->texcoords.resize((size_t)nNumCoords * 2);
+
+				for (auto& fValue : pOut->texcoords)
+				{
+					if (!tok.ReadFloat(&fValue))
+					{
+						*pError = "MeshTextureCoords: coords";
+						return false;
+					}
+				}
+
+				pOut->bTexcoord = true;
+
+				if (tok.Next() != "}")
+				{
+					*pError = "MeshTextureCoords: }";
+					return false;
+				}
+			}
+			else if (token == "MeshMaterialList")
+			{
+				unsigned int nNumMaterials = 0, nNumIndices = 0;
+
+				if (!tok.ReadUInt(&nNumMaterials) || !tok.ReadUInt(&nNumIndices))
+				{
+					*pError = "MeshMaterialList: count";
+					return false;
+				}
+
+				pOut->faceMaterial.resize(nNumIndices);
+
+				for (auto& nIdx : pOut->faceMaterial)
+				{
+					if (!tok.ReadUInt(&nIdx) || nIdx >= nNumMaterials)
+					{
+						*pError = "MeshMaterialList: index";
+						return false;
+					}
+				}
+
+				// マテリアル本体か、名前での参照
+				while (true)
+				{
+					std::string child = tok.Next();
+
+					if (child == "}")
+					{
+						break;
+					}
+
+					if (child == "{")
+					{
+						std::string ref = tok.Next();
+						auto it = named.find(ref);
+
+						if (it == named.end() || tok.Next() != "}")
+						{
+							*pError = "MeshMaterialList: unknown material " + ref;
+							return false;
+						}
+
+						pOut->materials.push_back(it->second);
+						continue;
+					}
+
+					std::string childName;
+
+					if (!tok.ReadOpen(&childName))
+					{
+						*pError = "MeshMaterialList: " + child;
+						return false;
+					}
+
+					if (child != "Material")
+					{
+						tok.SkipBlock();
+						continue;
+					}
+
+					CXMesh::Material material;
+
+					if (!ReadMaterial(tok, &material))
+					{
+						*pError = "Material";
+						return false;
+					}
+
+					pOut->materials.push_back(material);
+				}
+
+				if (pOut->materials.size() != nNumMaterials)
+				{
+					*pError = "MeshMaterialList: material count";
+					return false;
+				}
+			}
+			else if (!tok.SkipBlock())
+			{// 頂点色などは使わない
+				*pError = "Mesh: " + token;
+				return false;
+			}
+		}
+
+		// マテリアルの番号が面より少なければ最後の番号を続ける(D3DXと同じ)
+		if (pOut->materials.empty())
+		{
+			CXMesh::Material material = {};
+			material.diffuse[0] = material.diffuse[1] = material.diffuse[2] = material.diffuse[3] = 1.0f;
+			pOut->materials.push_back(material);
+		}
+
+		unsigned int nLast = pOut->faceMaterial.empty() ? 0 : pOut->faceMaterial.back();
+		pOut->faceMaterial.resize(pOut->faces.size(), nLast);
+
+		return true;
+	}
+}
+
+//=============================================================================
+// テキスト形式の.xの解析処理(1つのMeshだけ読む。フレームの階層・バイナリ形式は扱わない。
+// 面は.xの順のままなので、書き出す前にOptimizeで属性テーブルと境界を作る)
+//=============================================================================
+bool CXMesh::Parse(const char* pText, size_t size, Mesh* pOut, std::string* pError)
+{
+	pError->clear();
+
+	if (size < 16 || memcmp(pText, "xof ", 4) != 0)
+	{
+		*pError = "not a .x file";
+		return false;
+	}
+
+	if (memcmp(pText + 8, "txt ", 4) != 0)
+	{
+		*pError = "binary or compressed .x is not supported (use -cookmesh in the game)";
+		return false;
+	}
+
+	CTokenizer tok(pText + 16, size - 16);
+	std::map<std::string, Material> named;
+	SourceMesh src = {};
+	bool bMesh = false;
+
+	while (true)
+	{
+		std::string token = tok.Next();
+
+		if (token.empty())
+		{
+			break;
+		}
+
+		std::string name;
+
+		if (token == "{" || !tok.ReadOpen(&name))
+		{
+			*pError = "unexpected " + token;
+			return false;
+		}
+
+		if (token == "template" || token == "Header")
+		{
+			tok.SkipBlock();
+		}
+		else if (token == "Material")
+		{// 名前付きのマテリアル(MeshMaterialListから参照される)
+			Material material;
+
+			if (!ReadMaterial(tok, &material))
+			{
+				*pError = "Material";
+				return false;
+			}
+
+			named[name] = material;
+		}
+		else if (token == "Mesh")
+		{
+			if (bMesh)
+			{
+				*pError = "more than one Mesh is not supported";
+				return false;
+			}
+
+			if (!ReadMesh(tok, named, &src, pError))
+			{
+				return false;
+			}
+
+			bMesh = true;
+		}
+		else if (token == "Frame")
+		{
+			*pError = "Frame hierarchy is not supported (use -cookmesh in the game)";
+			return false;
+		}
+		else
+		{
+			tok.SkipBlock();
+		}
+	}
+
+	if (!bMesh || src.faces.empty())
+	{
+		*pError = "no Mesh";
+		return false;
+	}
+
+	// 位置と法線の組ごとに頂点を作る(位置が同じでも法線が違えば分ける)
+	pOut->fvf = FVF_XYZ | (src.bNormal ? FVF_NORMAL : 0) | (src.bTexcoord ? FVF_TEX1 : 0);
+	pOut->vertexSize = GetFVFSize(pOut->fvf);
+	pOut->vertices.clear();
+	pOut->indices.clear();
+	pOut->attributes.clear();
+	pOut->table.clear();
+	pOut->materials = src.materials;
+
+	std::unordered_map<unsigned long long, unsigned int> vertexMap;
+
+	auto addVertex = [&](unsigned int nPos, unsigned int nNormal)
+	{
+		unsigned long long key = ((unsigned long long)nPos << 32) | nNormal;
+		auto it = vertexMap.find(key);
+
+		if (it != vertexMap.end())
+		{
+			return it->second;
+		}
+
+		unsigned int nIdx = (unsigned int)vertexMap.size();
+		vertexMap[key] = nIdx;
+
+		pOut->vertices.insert(pOut->vertices.end(), &src.positions[nPos * 3], &src.positions[nPos * 3] + 3);
+
+		if (src.bNormal)
+		{
+			pOut->vertices.insert(pOut->vertices.end(), &src.normals[nNormal * 3], &src.normals[nNormal * 3] + 3);
+		}
+
+		if (src.bTexcoord)
+		{
+			pOut->vertices.insert(pOut->vertices.end(), &src.texcoords[nPos * 2], &src.texcoords[nPos * 2] + 2);
+		}
+
+		return nIdx;
+	};
+
+	// 多角形は扇形に三角形へ分ける
+	for (size_t nFace = 0; nFace < src.faces.size(); nFace++)
+	{
+		const Face& face = src.faces[nFace];
+		std::vector<unsigned int> corner(face.position.size());
+
+		for (size_t nCnt = 0; nCnt < face.position.size(); nCnt++)
+		{
+			corner[nCnt] = addVertex(face.position[nCnt], src.bNormal ? face.normal[nCnt] : 0);
+		}
+
+		for (size_t nCnt = 1; nCnt + 1 < corner.size(); nCnt++)
+		{
+			pOut->indices.push_back(corner[0]);
+			pOut->indices.push_back(corner[nCnt]);
+			pOut->indices.push_back(corner[nCnt + 1]);
+			pOut->attributes.push_back(src.faceMaterial[nFace]);
+		}
+	}
+
+	return true;
+}
+//=============================================================================
+// 最適化処理(属性ごとに面をまとめ、属性ごとに頂点キャッシュ向けに並べ、頂点を使う順に並べ直す)
+//=============================================================================
+void CXMesh::Optimize(Mesh* pMesh)
+{
+	unsigned int nNumFaces = (unsigned int)pMesh->attributes.size();
+	unsigned int nFloats = pMesh->vertexSize / sizeof(float);
+	unsigned int nNumVertices = GetNumVertices(*pMesh);
+
+	// 属性で並べる(同じ属性の中は元の順)
+	std::vector<unsigned int> order(nNumFaces);
+
+	for (unsigned int nCnt = 0; nCnt < nNumFaces; nCnt++)
+	{
+		order[nCnt] = nCnt;
+	}
+
+	std::stable_sort(order.begin(), order.end(), [pMesh](unsigned int a, unsigned int b)
+	{
+		return pMesh->attributes[a] < pMesh->attributes[b];
+	});
+
+	std::vector<unsigned int> indices;
+	std::vector<unsigned int> attributes;
+	std::vector<float> vertices;
+	std::vector<unsigned int> remap(nNumVertices);
+	std::vector<unsigned int> remapAttr(nNumVertices, 0xffffffff);
+
+	pMesh->table.clear();
+
+	for (unsigned int nStart = 0; nStart < nNumFaces;)
+	{
+		unsigned int nAttr = pMesh->attributes[order[nStart]];
+		unsigned int nEnd = nStart;
+
+		while (nEnd < nNumFaces && pMesh->attributes[order[nEnd]] == nAttr)
+		{
+			nEnd++;
+		}
+
+		// 属性の中の面を頂点キャッシュ向けに並べる
+		std::vector<unsigned int> subset;
+
+		for (unsigned int nCnt = nStart; nCnt < nEnd; nCnt++)
+		{
+			const unsigned int* pFace = &pMesh->indices[order[nCnt] * 3];
+			subset.insert(subset.end(), pFace, pFace + 3);
+		}
+
+		OptimizeSubset(&subset, nNumVertices);
+
+		// 頂点は属性ごとに使う順に並べ直す(属性をまたぐ頂点は複製して、属性ごとの範囲を重ねない)
+		AttributeRange range;
+		range.attribId = nAttr;
+		range.faceStart = (unsigned int)(indices.size() / 3);
+		range.faceCount = nEnd - nStart;
+		range.vertexStart = (unsigned int)(vertices.size() / nFloats);
+
+		for (unsigned int nIdx : subset)
+		{
+			if (remapAttr[nIdx] != nAttr)
+			{
+				remapAttr[nIdx] = nAttr;
+				remap[nIdx] = (unsigned int)(vertices.size() / nFloats);
+				vertices.insert(vertices.end(), &pMesh->vertices[(size_t)nIdx * nFloats], &pMesh->vertices[(size_t)nIdx * nFloats] + nFloats);
+			}
+
+			indices.push_back(remap[nIdx]);
+		}
+
+		range.vertexCount = (unsigned int)(vertices.size() / nFloats) - range.vertexStart;
+		attributes.insert(attributes.end(), range.faceCount, nAttr);
+		pMesh->table.push_back(range);
+
+		nStart = nEnd;
+	}
+
+	pMesh->vertices.swap(vertices);
+	pMesh->indices.swap(indices);
+	pMesh->attributes.swap(attributes);
+
+	// 境界
+	for (int nAxis = 0; nAxis < 3; nAxis++)
+	{
+		pMesh->vMin[nAxis] = FLT_MAX;
+		pMesh->vMax[nAxis] = -FLT_MAX;
+	}
+
+	for (size_t nCnt = 0; nCnt < pMesh->vertices.size(); nCnt += nFloats)
+	{
+		for (int nAxis = 0; nAxis < 3; nAxis++)
+		{
+			pMesh->vMin[nAxis] = std::min(pMesh->vMin[nAxis], pMesh->vertices[nCnt + nAxis]);
+			pMesh->vMax[nAxis] = std::max(pMesh->vMax[nAxis], pMesh->vertices[nCnt + nAxis]);
+		}
+	}
+}
+//=============================================================================
+// 1つの属性の面の並べ替え処理(キャッシュに残っている頂点と、使い残しの少ない頂点を持つ面から選ぶ)
+//=============================================================================
+void CXMesh::OptimizeSubset(std::vector<unsigned int>* pIndices, unsigned int nNumVertices)
+{
+	unsigned int nNumFaces = (unsigned int)(pIndices->size() / 3);
+
+	if (nNumFaces <= 1)
+	{
+		return;
+	}
+
+	const std::vector<unsigned int>& in = *pIndices;
+
+	// 頂点ごとの残りの面
+	std::vector<int> numRemain(nNumVertices, 0);
+	std::vector<std::vector<unsigned int>> vertexFaces(nNumVertices);
+
+	for (unsigned int nFace = 0; nFace < nNumFaces; nFace++)
+	{
+		for (int nCnt = 0; nCnt < 3; nCnt++)
+		{
+			numRemain[in[nFace * 3 + nCnt]]++;
+			vertexFaces[in[nFace * 3 + nCnt]].push_back(nFace);
+		}
+	}
+
+	std::vector<int> cachePos(nNumVertices, -1);
+	std::vector<float> vertexScore(nNumVertices, 0.0f);
+	std::vector<bool> abDone(nNumFaces, false);
+	std::vector<unsigned int> cache;
+	std::vector<unsigned int> out;
+	out.reserve(in.size());
+
+	for (unsigned int nIdx : in)
+	{
+		vertexScore[nIdx] = ScoreVertex(-1, numRemain[nIdx]);
+	}
+
+	auto faceScore = [&](unsigned int nFace)
+	{
+		return vertexScore[in[nFace * 3]] + vertexScore[in[nFace * 3 + 1]] + vertexScore[in[nFace * 3 + 2]];
+	};
+
+	unsigned int nNext = 0;
+
+	for (unsigned int nCount = 0; nCount < nNumFaces; nCount++)
+	{
+		// キャッシュの頂点を持つ面から一番良い物を選び、無ければ全体から探す
+		int nBest = -1;
+		float fBest = -1.0f;
+
+		for (unsigned int nVtx : cache)
+		{
+			for (unsigned int nFace : vertexFaces[nVtx])
+			{
+				if (!abDone[nFace] && faceScore(nFace) > fBest)
+				{
+					fBest = faceScore(nFace);
+					nBest = (int)nFace;
+				}
+			}
+		}
+
+		if (nBest < 0)
+		{
+			while (abDone[nNext])
+			{
+				nNext++;
+			}
+
+			for (unsigned int nFace = nNext; nFace < nNumFaces; nFace++)
+			{
+				if (!abDone[nFace] && faceScore(nFace) > fBest)
+				{
+					fBest = faceScore(nFace);
+					nBest = (int)nFace;
+				}
+			}
+		}
+
+		abDone[nBest] = true;
+
+		// 面を出してキャッシュの先頭に入れる
+		std::vector<unsigned int> newCache;
+
+		for (int nCnt = 0; nCnt < 3; nCnt++)
+		{
+			unsigned int nVtx = in[nBest * 3 + nCnt];
+			out.push_back(nVtx);
+			numRemain[nVtx]--;
+			newCache.push_back(nVtx);
+		}
+
+		for (unsigned int nVtx : cache)
+		{
+			if (std::find(newCache.begin(), newCache.end(), nVtx) == newCache.end())
+			{
+				newCache.push_back(nVtx);
+			}
+		}
+
+		// 溢れた頂点はキャッシュから外す
+		for (size_t nCnt = CACHE_SIZE; nCnt < newCache.size(); nCnt++)
+		{
+			cachePos[newCache[nCnt]] = -1;
+			vertexScore[newCache[nCnt]] = ScoreVertex(-1, numRemain[newCache[nCnt]]);
+		}
+
+		newCache.resize(std::min<size_t>(newCache.size(), CACHE_SIZE));
+		cache.swap(newCache);
+
+		for (size_t nCnt = 0; nCnt < cache.size(); nCnt++)
+		{
+			cachePos[cache[nCnt]] = (int)nCnt;
+			vertexScore[cache[nCnt]] = ScoreVertex((int)nCnt, numRemain[cache[nCnt]]);
+		}
+	}
+
+	pIndices->swap(out);
+}
+//=============================================================================
+// 頂点の点数(キャッシュの前にあるほど高く、残りの面が少ないほど高い)
+//=============================================================================
+float CXMesh::ScoreVertex(int nCachePos, int nNumRemain)
+{
+	if (nNumRemain <= 0)
+	{
+		return -1.0f;
+	}
+
+	float fScore = 0.0f;
+
+	if (nCachePos >= 0)
+	{
+		if (nCachePos < 3)
+		{// 直前の面の頂点(すぐ使うと同じ3つを回すだけになるので少し下げる)
+			fScore = 0.75f;
+		}
+		else
+		{
+			fScore = powf(1.0f - (float)(nCachePos - 3) / (CACHE_SIZE - 3), 1.5f);
+		}
+	}
+
+	return fScore + 2.0f * powf((float)nNumRemain, -0.5f);
+}
+//=============================================================================
+// .xmbへの書き出し処理(CMeshCooker::Cookと同じ並び。リトルエンディアン)
+//=============================================================================
+void CXMesh::Serialize(const Mesh& mesh, std::vector<unsigned char>* pOut)
+{
+	pOut->clear();
+
+	auto putU32 = [pOut](unsigned int nValue)
+	{
+		for (int nCnt = 0; nCnt < 4; nCnt++)
+		{
+			pOut->push_back((unsigned char)((nValue >> (nCnt * 8)) & 0xff));
+		}
+	};
+
+	auto putF32 = [&putU32](float fValue)
+	{
+		unsigned int nBits = 0;
+		memcpy(&nBits, &fValue, sizeof(nBits));
+		putU32(nBits);
+	};
+
+	unsigned int nNumVertices = GetNumVertices(mesh);
+	bool bIndex32 = nNumVertices > 0xffff;
+
+	// ヘッダー
+	pOut->insert(pOut->end(), { 'N', 'J', 'M', 'B' });
+	putU32(FORMAT_VERSION);
+	putU32(mesh.fvf);
+	putU32(mesh.vertexSize);
+	putU32(nNumVertices);
+	putU32((unsigned int)(mesh.indices.size() / 3));
+	putU32(bIndex32 ? 1 : 0);
+	putU32((unsigned int)mesh.table.size());
+	putU32((unsigned int)mesh.materials.size());
+
+	for (int nAxis = 0; nAxis < 3; nAxis++)
+	{
+		putF32(mesh.vMin[nAxis]);
+	}
+
+	for (int nAxis = 0; nAxis < 3; nAxis++)
+	{
+		putF32(mesh.vMax[nAxis]);
+	}
+
+	// 頂点・インデックス・属性・属性テーブル
+	for (float fValue : mesh.vertices)
+	{
+		putF32(fValue);
+	}
+
+	for (unsigned int nIdx : mesh.indices)
+	{
+		if (bIndex32)
+		{
+			putU32(nIdx);
+		}
+		else
+		{
+			pOut->push_back((unsigned char)(nIdx & 0xff));
+			pOut->push_back((unsigned char)((nIdx >> 8) & 0xff));
+		}
+	}
+
+	for (unsigned int nAttr : mesh.attributes)
+	{
+		putU32(nAttr);
+	}
+
+	for (const auto& range : mesh.table)
+	{
+		putU32(range.attribId);
+		putU32(range.faceStart);
+		putU32(range.faceCount);
+		putU32(range.vertexStart);
+		putU32(range.vertexCount);
+	}
+
+	// マテリアルとテクスチャ名
+	for (const auto& material : mesh.materials)
+	{
+		for (float fValue : material.diffuse)
+		{
+			putF32(fValue);
+		}
+
+		for (float fValue : material.ambient)
+		{
+			putF32(fValue);
+		}
+
+		for (float fValue : material.specular)
+		{
+			putF32(fValue);
+		}
+
+		for (float fValue : material.emissive)
+		{
+			putF32(fValue);
+		}
+
+		putF32(material.power);
+		putU32((unsigned int)material.texture.size());
+		pOut->insert(pOut->end(), material.texture.begin(), material.texture.end());
+	}
+}
+//=============================================================================
+// .xmbの確認処理(CMeshCooker::Parseと同じ条件で読めるか)
+//=============================================================================
+bool CXMesh::Validate(const unsigned char* pData, size_t size)
+{
+	if (pData == nullptr || size < HEADER_SIZE)
+	{
+		return false;
+	}
+
+	auto getU32 = [pData](size_t nOffset)
+	{
+		return (unsigned int)pData[nOffset] | ((unsigned int)pData[nOffset + 1] << 8) |
+			((unsigned int)pData[nOffset + 2] << 16) | ((unsigned int)pData[nOffset + 3] << 24);
+	};
+
+	unsigned int nVersion = getU32(4), fvf = getU32(8), nVertexSize = getU32(12);
+	unsigned int nNumVertices = getU32(16), nNumFaces = getU32(20), nIndex32 = getU32(24);
+	unsigned int nNumSubsets = getU32(28), nNumMaterials = getU32(32);
+
+	if (memcmp(pData, "NJMB", 4) != 0 || nVersion != FORMAT_VERSION)
+	{
+		return false;
+	}
+
+	if (nVertexSize == 0 || nVertexSize != GetFVFSize(fvf))
+	{
+		return false;
+	}
+
+	size_t idxSize = nIndex32 ? 4 : 2;
+	size_t remain = size - HEADER_SIZE;
+
+	if (nNumVertices == 0 || nNumFaces == 0 ||
+		nNumVertices > remain / nVertexSize ||
+		nNumFaces > remain / (idxSize * 3 + 4) ||
+		nNumSubsets > remain / RANGE_SIZE ||
+		nNumMaterials > remain / (MATERIAL_SIZE + 4))
+	{
+		return false;
+	}
+
+	if (nIndex32 == 0 && nNumVertices > 0x10000)
+	{
+		return false;
+	}
+
+	size_t vtxBytes = (size_t)nNumVertices * nVertexSize;
+	size_t idxBytes = (size_t)nNumFaces * 3 * idxSize;
+	size_t attrBytes = (size_t)nNumFaces * 4;
+	size_t tableBytes = (size_t)nNumSubsets * RANGE_SIZE;
+
+	if (remain < vtxBytes + idxBytes + attrBytes + tableBytes)
+	{
+		return false;
+	}
+
+	size_t nOffset = HEADER_SIZE + vtxBytes;
+
+	for (unsigned int nCnt = 0; nCnt < nNumFaces * 3; nCnt++)
+	{
+		unsigned int nIdx = nIndex32 ? getU32(nOffset + nCnt * 4) : (unsigned int)(pData[nOffset + nCnt * 2] | (pData[nOffset + nCnt * 2 + 1] << 8));
+
+		if (nIdx >= nNumVertices)
+		{
+			return false;
+		}
+	}
+
+	nOffset += idxBytes + attrBytes;
+
+	for (unsigned int nCnt = 0; nCnt < nNumSubsets; nCnt++)
+	{
+		size_t nRange = nOffset + (size_t)nCnt * RANGE_SIZE;
+
+		if ((size_t)getU32(nRange + 4) + getU32(nRange + 8) > nNumFaces ||
+			(size_t)getU32(nRange + 12) + getU32(nRange + 16) > nNumVertices)
+		{
+			return false;
+		}
+	}
+
+	nOffset += tableBytes;
+
+	for (unsigned int nCnt = 0; nCnt < nNumMaterials; nCnt++)
+	{
+		if (size - nOffset < MATERIAL_SIZE + 4)
+		{
+			return false;
+		}
+
+		unsigned int nLen = getU32(nOffset + MATERIAL_SIZE);
+		nOffset += MATERIAL_SIZE + 4;
+
+		if (size - nOffset < nLen)
+		{
+			return false;
+		}
+
+		nOffset += nLen;
+	}
+
+	return true;
+}
+//=============================================================================
+// 頂点キャッシュの効き具合の計測(FIFOで1面あたりに変換する頂点数。少ないほど良い)
+//=============================================================================
+float CXMesh::CalcACMR(const Mesh& mesh)
+{
+	if (mesh.indices.empty())
+	{
+		return 0.0f;
+	}
+
+	std::vector<unsigned int> fifo;
+	unsigned int nNumMiss = 0;
+
+	for (unsigned int nIdx : mesh.indices)
+	{
+		if (std::find(fifo.begin(), fifo.end(), nIdx) != fifo.end())
+		{
+			continue;
+		}
+
+		nNumMiss++;
+		fifo.push_back(nIdx);
+
+		if (fifo.size() > FIFO_SIZE)
+		{
+			fifo.erase(fifo.begin());
+		}
+	}
+
+	return (float)nNumMiss / (mesh.indices.size() / 3);
+}
+//=============================================================================
+// 頂点フォーマットから1頂点のバイト数を求める(このツールが作る組み合わせだけ)
+//=============================================================================
+unsigned int CXMesh::GetFVFSize(unsigned int fvf)
+{
+	if ((fvf & ~(FVF_XYZ | FVF_NORMAL | FVF_TEX1)) != 0 || (fvf & FVF_XYZ) == 0)
+	{
+		return 0;
+	}
+
+	return 12 + ((fvf & FVF_NORMAL) ? 12 : 0) + ((fvf & FVF_TEX1) ? 8 : 0);
+}
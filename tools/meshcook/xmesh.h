@@ -0,0 +1,81 @@
+//=============================================================================
+//
+// .x解析処理 [xmesh.h]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+#ifndef _XMESH_H_// このマクロ定義がされていなかったら
+#define _XMESH_H_// 2重インクルード防止のマクロ定義
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "string"
+#include "vector"
+
+//*****************************************************************************
+// .x解析クラス(D3DXを使わずにテキスト形式の.xを読み、ゲームのCMeshCookerと同じ.xmbを作る)
+//*****************************************************************************
+class CXMesh
+{
+public:
+	static constexpr unsigned int FVF_XYZ		= 0x002;	// D3DFVF_XYZ
+	static constexpr unsigned int FVF_NORMAL	= 0x010;	// D3DFVF_NORMAL
+	static constexpr unsigned int FVF_TEX1		= 0x100;	// D3DFVF_TEX1
+	static constexpr unsigned int FORMAT_VERSION	= 1;	// CMeshCooker::FORMAT_VERSIONと同じ
+	static constexpr int		CACHE_SIZE		= 32;		// 並べ替えで想定する頂点キャッシュの大きさ
+	static constexpr int		FIFO_SIZE		= 16;		// ACMRの計測に使うキャッシュの大きさ
+
+	// 属性テーブルの1つ(D3DXATTRIBUTERANGEと同じ並び)
+	typedef struct
+	{
+		unsigned int	attribId;		// 属性
+		unsigned int	faceStart;		// 最初の面
+		unsigned int	faceCount;		// 面数
+		unsigned int	vertexStart;	// 最初の頂点
+		unsigned int	vertexCount;	// 頂点数
+	}AttributeRange;
+
+	// マテリアル(D3DMATERIAL9と同じ並び + テクスチャ名)
+	typedef struct
+	{
+		float			diffuse[4];		// 拡散色
+		float			ambient[4];		// 環境色(.xには無いのでD3DXと同じく0)
+		float			specular[4];	// 鏡面反射色
+		float			emissive[4];	// 放射色
+		float			power;			// 鏡面反射の強さ
+		std::string		texture;		// テクスチャ名(無ければ空)
+	}Material;
+
+	// メッシュ
+	typedef struct
+	{
+		unsigned int				fvf;			// 頂点フォーマット
+		unsigned int				vertexSize;		// 1頂点のバイト数
+		std::vector<float>			vertices;		// 頂点(位置・法線・UVの順に詰める)
+		std::vector<unsigned int>	indices;		// インデックス(3つで1面)
+		std::vector<unsigned int>	attributes;		// 面ごとの属性
+		std::vector<AttributeRange>	table;			// 属性テーブル
+		std::vector<Material>		materials;		// マテリアル
+		float						vMin[3];		// 境界の最小
+		float						vMax[3];		// 境界の最大
+	}Mesh;
+
+	static bool Parse(const char* pText, size_t size, Mesh* pOut, std::string* pError);
+	static void Optimize(Mesh* pMesh);
+	static void Serialize(const Mesh& mesh, std::vector<unsigned char>* pOut);
+	static bool Validate(const unsigned char* pData, size_t size);
+	static float CalcACMR(const Mesh& mesh);
+	static unsigned int GetNumVertices(const Mesh& mesh) { return (unsigned int)(mesh.vertices.size() / (mesh.vertexSize / sizeof(float))); }
+
+private:
+	static constexpr int HEADER_SIZE	= 60;	// CMeshCooker::Headerの大きさ
+	static constexpr int RANGE_SIZE		= 20;	// D3DXATTRIBUTERANGEの大きさ
+	static constexpr int MATERIAL_SIZE	= 68;	// D3DMATERIAL9の大きさ
+
+	static void OptimizeSubset(std::vector<unsigned int>* pIndices, unsigned int nNumVertices);
+	static float ScoreVertex(int nCachePos, int nNumRemain);
+	static unsigned int GetFVFSize(unsigned int fvf);
+};
+
+#endif
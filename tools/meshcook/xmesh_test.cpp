@@ -0,0 +1,262 @@
+//=============================================================================
+//
+// .x解析処理の確認 [xmesh_test.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "xmesh.h"
+#include "algorithm"
+#include "array"
+#include "cstdio"
+#include "cstring"
+
+//*****************************************************************************
+// グローバル変数
+//*****************************************************************************
+static int g_nNumFailed = 0;	// 失敗した確認の数
+
+//*****************************************************************************
+// マクロ定義
+//*****************************************************************************
+#define CHECK(expr) \
+	do { if (!(expr)) { fprintf(stderr, "%s(%d): %s\n", __FILE__, __LINE__, #expr); g_nNumFailed++; } } while (0)
+
+//*****************************************************************************
+// 確認用の.x(四角形1つと三角形1つ。頂点0は面ごとに法線が違う)
+//*****************************************************************************
+static const char* const TEST_X =
+	"xof 0302txt 0064\n"
+	"template Header {\n"
+	" <3D82AB43-62DA-11cf-AB39-0020AF71E433>\n"
+	" WORD major;\n"
+	" [...]\n"
+	"}\n"
+	"Header{\n1;\n0;\n1;\n}\n"
+	"// 名前付きのマテリアル\n"
+	"Material Red {\n"
+	" 1.0;0.0;0.0;1.0;;\n 5.0;\n 0.0;0.0;0.0;;\n 0.0;0.0;0.0;;\n"
+	"}\n"
+	"Mesh {\n"
+	" 5;\n"
+	" 0.0;0.0;0.0;,\n 1.0;0.0;0.0;,\n 1.0;1.0;0.0;,\n 0.0;1.0;0.0;,\n -1.0;0.5;2.0;;\n"
+	" 2;\n"
+	" 4;0,1,2,3;,\n 3;0,3,4;;\n"
+	" MeshMaterialList {\n"
+	"  2;\n  2;\n  1,\n  0;;\n"
+	"  { Red }\n"
+	"  Material {\n"
+	"   0.5;0.5;0.5;0.25;;\n 1.0;\n 0.1;0.2;0.3;;\n 0.0;0.0;0.0;;\n"
+	"   TextureFilename {\n    \"data/TEXTURE/wood.jpg\";\n   }\n"
+	"  }\n"
+	" }\n"
+	" MeshNormals {\n"
+	"  2;\n  0.0;0.0;-1.0;,\n  -1.0;0.0;0.0;;\n"
+	"  2;\n  4;0,0,0,0;,\n  3;1,1,1;;\n"
+	" }\n"
+	" MeshTextureCoords {\n"
+	"  5;\n  0.0;1.0;,\n 1.0;1.0;,\n 1.0;0.0;,\n 0.0;0.0;,\n 0.5;0.5;;\n"
+	" }\n"
+	" MeshVertexColors {\n  1;\n  0;1.0;1.0;1.0;1.0;;\n }\n"
+	"}\n";
+
+//=============================================================================
+// 面の位置の組の取得(並べ替えの前後で同じ面があるかを比べる)
+//=============================================================================
+static std::vector<std::array<float, 9>> GetTriangles(const CXMesh::Mesh& mesh)
+{
+	unsigned int nFloats = mesh.vertexSize / sizeof(float);
+	std::vector<std::array<float, 9>> out;
+
+	for (size_t nFace = 0; nFace < mesh.indices.size() / 3; nFace++)
+	{
+		std::array<std::array<float, 3>, 3> corner;
+
+		for (int nCnt = 0; nCnt < 3; nCnt++)
+		{
+			const float* pPos = &mesh.vertices[(size_t)mesh.indices[nFace * 3 + nCnt] * nFloats];
+			corner[nCnt] = { pPos[0], pPos[1], pPos[2] };
+		}
+
+		// 向きを保ったまま一番小さい頂点を先頭にする
+		int nFirst = (int)(std::min_element(corner.begin(), corner.end()) - corner.begin());
+		std::array<float, 9> tri;
+
+		for (int nCnt = 0; nCnt < 3; nCnt++)
+		{
+			memcpy(&tri[nCnt * 3], corner[(nFirst + nCnt) % 3].data(), sizeof(float) * 3);
+		}
+
+		out.push_back(tri);
+	}
+
+	std::sort(out.begin(), out.end());
+
+	return out;
+}
+//=============================================================================
+// 解析の確認
+//=============================================================================
+static void TestParse(void)
+{
+	CXMesh::Mesh mesh;
+	std::string error;
+
+	CHECK(CXMesh::Parse(TEST_X, strlen(TEST_X), &mesh, &error));
+	CHECK(error.empty());
+
+	if (!error.empty())
+	{
+		fprintf(stderr, "  %s\n", error.c_str());
+		return;
+	}
+
+	CHECK(mesh.fvf == (CXMesh::FVF_XYZ | CXMesh::FVF_NORMAL | CXMesh::FVF_TEX1));
+	CHECK(mesh.vertexSize == 32);
+
+	// 四角形は2つ、三角形は1つ
+	CHECK(mesh.indices.size() == 9);
+	CHECK(mesh.attributes.size() == 3);
+	CHECK(mesh.attributes[0] == 1 && mesh.attributes[1] == 1 && mesh.attributes[2] == 0);
+
+	// 位置0と3は法線が2種類あるので分かれる(4 + 3 = 7頂点)
+	CHECK(CXMesh::GetNumVertices(mesh) == 7);
+
+	// マテリアル(参照と本体)
+	CHECK(mesh.materials.size() == 2);
+	CHECK(mesh.materials[0].diffuse[0] == 1.0f && mesh.materials[0].power == 5.0f && mesh.materials[0].texture.empty());
+	CHECK(mesh.materials[1].diffuse[3] == 0.25f && mesh.materials[1].specular[2] == 0.3f);
+	CHECK(mesh.materials[1].texture == "data/TEXTURE/wood.jpg");
+	CHECK(mesh.materials[1].ambient[0] == 0.0f);
+
+	std::vector<std::array<float, 9>> before = GetTriangles(mesh);
+
+	CXMesh::Optimize(&mesh);
+
+	// 属性0が先、属性ごとに面と頂点の範囲が分かれる
+	CHECK(mesh.table.size() == 2);
+	CHECK(mesh.table[0].attribId == 0 && mesh.table[0].faceStart == 0 && mesh.table[0].faceCount == 1);
+	CHECK(mesh.table[1].attribId == 1 && mesh.table[1].faceStart == 1 && mesh.table[1].faceCount == 2);
+	CHECK(mesh.table[0].vertexStart == 0 && mesh.table[0].vertexCount == 3);
+	CHECK(mesh.table[1].vertexStart == 3 && mesh.table[1].vertexCount == 4);
+	CHECK(mesh.attributes[0] == 0 && mesh.attributes[1] == 1 && mesh.attributes[2] == 1);
+
+	for (const auto& range : mesh.table)
+	{
+		for (unsigned int nCnt = range.faceStart * 3; nCnt < (range.faceStart + range.faceCount) * 3; nCnt++)
+		{
+			CHECK(mesh.indices[nCnt] >= range.vertexStart && mesh.indices[nCnt] < range.vertexStart + range.vertexCount);
+		}
+	}
+
+	CHECK(GetTriangles(mesh) == before);
+
+	// 境界
+	CHECK(mesh.vMin[0] == -1.0f && mesh.vMin[1] == 0.0f && mesh.vMin[2] == 0.0f);
+	CHECK(mesh.vMax[0] == 1.0f && mesh.vMax[1] == 1.0f && mesh.vMax[2] == 2.0f);
+
+	// 書き出しと確認(ヘッダー60 + 頂点7*32 + インデックス9*2 + 属性3*4 + 属性テーブル2*20 + マテリアル2*72 + 名前)
+	std::vector<unsigned char> out;
+	CXMesh::Serialize(mesh, &out);
+
+	CHECK(out.size() == 60 + 7 * 32 + 9 * 2 + 3 * 4 + 2 * 20 + 2 * 72 + strlen("data/TEXTURE/wood.jpg"));
+	CHECK(memcmp(out.data(), "NJMB", 4) == 0);
+	CHECK(CXMesh::Validate(out.data(), out.size()));
+
+	// 壊れたファイルは読まない
+	CHECK(!CXMesh::Validate(out.data(), out.size() - 1));
+	CHECK(!CXMesh::Validate(out.data(), 59));
+
+	std::vector<unsigned char> broken = out;
+	broken[60 + 7 * 32] = 7;	// 最初のインデックスを範囲外にする
+	CHECK(!CXMesh::Validate(broken.data(), broken.size()));
+
+	broken = out;
+	broken[12] += 4;			// 頂点の大きさ
+	CHECK(!CXMesh::Validate(broken.data(), broken.size()));
+}
+//=============================================================================
+// 扱わない.xの確認
+//=============================================================================
+static void TestUnsupported(void)
+{
+	CXMesh::Mesh mesh;
+	std::string error;
+
+	const char* pBinary = "xof 0302bin 0032\x01\x02\x03";
+	CHECK(!CXMesh::Parse(pBinary, 19, &mesh, &error));
+	CHECK(error.find("binary") != std::string::npos);
+
+	const char* pFrame = "xof 0302txt 0064\nFrame Root {\n Mesh {\n 0;\n 0;;\n }\n}\n";
+	CHECK(!CXMesh::Parse(pFrame, strlen(pFrame), &mesh, &error));
+	CHECK(error.find("Frame") != std::string::npos);
+
+	const char* pOutOfRange = "xof 0302txt 0064\nMesh {\n 3;\n 0;0;0;,\n 1;0;0;,\n 0;1;0;;\n 1;\n 3;0,1,3;;\n}\n";
+	CHECK(!CXMesh::Parse(pOutOfRange, strlen(pOutOfRange), &mesh, &error));
+}
+//=============================================================================
+// 頂点キャッシュ向けの並べ替えの確認(ばらばらの順の格子が良くなる)
+//=============================================================================
+static void TestVertexCache(void)
+{
+	const int GRID = 24;
+
+	CXMesh::Mesh mesh = {};
+	mesh.fvf = CXMesh::FVF_XYZ;
+	mesh.vertexSize = 12;
+
+	for (int nY = 0; nY <= GRID; nY++)
+	{
+		for (int nX = 0; nX <= GRID; nX++)
+		{
+			mesh.vertices.insert(mesh.vertices.end(), { (float)nX, (float)nY, 0.0f });
+		}
+	}
+
+	// 面を飛び飛びの順に並べる
+	std::vector<unsigned int> quads;
+
+	for (int nCnt = 0; nCnt < GRID * GRID; nCnt++)
+	{
+		quads.push_back((unsigned int)((nCnt * 7919) % (GRID * GRID)));
+	}
+
+	for (unsigned int nQuad : quads)
+	{
+		unsigned int nX = nQuad % GRID, nY = nQuad / GRID;
+		unsigned int n0 = nY * (GRID + 1) + nX, n1 = n0 + 1, n2 = n0 + GRID + 1, n3 = n2 + 1;
+
+		mesh.indices.insert(mesh.indices.end(), { n0, n2, n1, n1, n2, n3 });
+		mesh.attributes.insert(mesh.attributes.end(), { 0, 0 });
+	}
+
+	std::vector<std::array<float, 9>> before = GetTriangles(mesh);
+	float fBefore = CXMesh::CalcACMR(mesh);
+
+	CXMesh::Optimize(&mesh);
+
+	float fAfter = CXMesh::CalcACMR(mesh);
+
+	CHECK(GetTriangles(mesh) == before);
+	CHECK(CXMesh::GetNumVertices(mesh) == (GRID + 1) * (GRID + 1));
+	CHECK(fBefore > 1.5f);
+	CHECK(fAfter < 0.9f);
+
+	printf("grid acmr     : %.3f -> %.3f\n", fBefore, fAfter);
+}
+//=============================================================================
+// メイン関数
+//=============================================================================
+int main(void)
+{
+	TestParse();
+	TestUnsupported();
+	TestVertexCache();
+
+	printf("xmesh_test    : %s\n", g_nNumFailed == 0 ? "pass" : "FAIL");
+
+	return g_nNumFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,336 @@
+//=============================================================================
+//
+// テクスチャ圧縮処理の確認 [texcodec_test.cpp]
+// Author : RIKU TANEKAWA
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "texcodec.h"
+#include "algorithm"
+#include "cstdio"
+#include "cstdlib"
+#include "cstring"
+
+//*****************************************************************************
+// グローバル変数
+//*****************************************************************************
+static int g_nNumFailed = 0;	// 失敗した確認の数
+
+//*****************************************************************************
+// マクロ定義
+//*****************************************************************************
+#define CHECK(expr) \
+	do { if (!(expr)) { fprintf(stderr, "%s(%d): %s\n", __FILE__, __LINE__, #expr); g_nNumFailed++; } } while (0)
+
+//=============================================================================
+// 確認用の画像の作成(横に色、縦にアルファが変わる)
+//=============================================================================
+static CTexCodec::Image MakeGradient(int nWidth, int nHeight, bool bAlpha)
+{
+	CTexCodec::Image image;
+	image.nWidth = nWidth;
+	image.nHeight = nHeight;
+	image.pixels.resize((size_t)nWidth * nHeight * 4);
+
+	for (int nY = 0; nY < nHeight; nY++)
+	{
+		for (int nX = 0; nX < nWidth; nX++)
+		{
+			unsigned char* p = &image.pixels[((size_t)nY * nWidth + nX) * 4];
+			p[0] = (unsigned char)(nX * 255 / std::max(1, nWidth - 1));
+			p[1] = (unsigned char)(255 - nX * 255 / std::max(1, nWidth - 1));
+			p[2] = 64;
+			p[3] = bAlpha ? (unsigned char)(nY * 255 / std::max(1, nHeight - 1)) : 0xff;
+		}
+	}
+
+	return image;
+}
+//=============================================================================
+// 565の展開
+//=============================================================================
+static void Unpack565(unsigned short color, int* pColor)
+{
+	int nR = (color >> 11) & 0x1f, nG = (color >> 5) & 0x3f, nB = color & 0x1f;
+	pColor[2] = (nR << 3) | (nR >> 2);
+	pColor[1] = (nG << 2) | (nG >> 4);
+	pColor[0] = (nB << 3) | (nB >> 2);
+}
+//=============================================================================
+// 色ブロックの展開(4色のみ。B・G・Rの順に16画素)
+//=============================================================================
+static void DecodeColorBlock(const unsigned char* pBlock, int aOut[16][3])
+{
+	unsigned short color0 = (unsigned short)(pBlock[0] | (pBlock[1] << 8));
+	unsigned short color1 = (unsigned short)(pBlock[2] | (pBlock[3] << 8));
+	unsigned int nIndices = pBlock[4] | (pBlock[5] << 8) | (pBlock[6] << 16) | ((unsigned int)pBlock[7] << 24);
+
+	int aPalette[4][3];
+	Unpack565(color0, aPalette[0]);
+	Unpack565(color1, aPalette[1]);
+
+	for (int nCh = 0; nCh < 3; nCh++)
+	{
+		aPalette[2][nCh] = (aPalette[0][nCh] * 2 + aPalette[1][nCh]) / 3;
+		aPalette[3][nCh] = (aPalette[0][nCh] + aPalette[1][nCh] * 2) / 3;
+	}
+
+	for (int nCnt = 0; nCnt < 16; nCnt++)
+	{
+		memcpy(aOut[nCnt], aPalette[(nIndices >> (nCnt * 2)) & 3], sizeof(aOut[nCnt]));
+	}
+}
+//=============================================================================
+// アルファブロックの展開(8段階のみ)
+//=============================================================================
+static void DecodeAlphaBlock(const unsigned char* pBlock, int* pOut)
+{
+	int aPalette[8] = { pBlock[0], pBlock[1] };
+
+	for (int nPal = 2; nPal < 8; nPal++)
+	{
+		aPalette[nPal] = ((8 - nPal) * pBlock[0] + (nPal - 1) * pBlock[1]) / 7;
+	}
+
+	unsigned long long nIndices = 0;
+
+	for (int nCnt = 0; nCnt < 6; nCnt++)
+	{
+		nIndices |= (unsigned long long)pBlock[2 + nCnt] << (nCnt * 8);
+	}
+
+	for (int nCnt = 0; nCnt < 16; nCnt++)
+	{
+		pOut[nCnt] = aPalette[(nIndices >> (nCnt * 3)) & 7];
+	}
+}
+//=============================================================================
+// ミップマップの確認(1x1まで半分ずつ。平均が保たれる)
+//=============================================================================
+static void TestMips(void)
+{
+	CTexCodec::Image image = MakeGradient(64, 16, false);
+	std::vector<CTexCodec::Image> mips;
+
+	CTexCodec::BuildMips(image, &mips);
+
+	CHECK(mips.size() == 7);
+	CHECK(mips[1].nWidth == 32 && mips[1].nHeight == 8);
+	CHECK(mips[4].nWidth == 4 && mips[4].nHeight == 1);
+	CHECK(mips[6].nWidth == 1 && mips[6].nHeight == 1);
+	CHECK(mips[6].pixels.size() == 4);
+	CHECK(abs(mips[6].pixels[0] - 127) <= 2);
+	CHECK(mips[6].pixels[2] == 64 && mips[6].pixels[3] == 0xff);
+
+	// 奇数の大きさ
+	CTexCodec::BuildMips(MakeGradient(5, 3, false), &mips);
+	CHECK(mips.size() == 3);
+	CHECK(mips[1].nWidth == 2 && mips[1].nHeight == 1);
+}
+//=============================================================================
+// BC1の確認(単色はそのまま、グラデーションは誤差が小さい)
+//=============================================================================
+static void TestBC1(void)
+{
+	CTexCodec::Image solid;
+	solid.nWidth = 4;
+	solid.nHeight = 4;
+	solid.pixels.assign(64, 0);
+
+	for (int nCnt = 0; nCnt < 16; nCnt++)
+	{
+		solid.pixels[nCnt * 4 + 0] = 0;
+		solid.pixels[nCnt * 4 + 1] = 255;
+		solid.pixels[nCnt * 4 + 2] = 255;
+		solid.pixels[nCnt * 4 + 3] = 255;
+	}
+
+	std::vector<unsigned char> blocks;
+	CTexCodec::EncodeBC1(solid, &blocks);
+
+	CHECK(blocks.size() == 8);
+
+	int aDecoded[16][3];
+	DecodeColorBlock(blocks.data(), aDecoded);
+	CHECK(aDecoded[5][0] == 0 && aDecoded[5][1] == 255 && aDecoded[5][2] == 255);
+
+	// 端点は4色になる順(color0 >= color1)
+	CTexCodec::Image image = MakeGradient(16, 8, false);
+	CTexCodec::EncodeBC1(image, &blocks);
+
+	CHECK(blocks.size() == 4 * 2 * 8);
+
+	int nMaxError = 0;
+
+	for (int nBlock = 0; nBlock < 8; nBlock++)
+	{
+		const unsigned char* pBlock = &blocks[nBlock * 8];
+		CHECK((pBlock[0] | (pBlock[1] << 8)) >= (pBlock[2] | (pBlock[3] << 8)));
+
+		DecodeColorBlock(pBlock, aDecoded);
+
+		int nBlockX = nBlock % 4, nBlockY = nBlock / 4;
+
+		for (int nCnt = 0; nCnt < 16; nCnt++)
+		{
+			int nX = nBlockX * 4 + nCnt % 4, nY = nBlockY * 4 + nCnt / 4;
+			const unsigned char* p = &image.pixels[((size_t)nY * image.nWidth + nX) * 4];
+
+			for (int nCh = 0; nCh < 3; nCh++)
+			{
+				nMaxError = std::max(nMaxError, abs(aDecoded[nCnt][nCh] - p[nCh]));
+			}
+		}
+	}
+
+	CHECK(nMaxError <= 12);
+
+	// 4で割り切れない小さいミップマップも1ブロックになる
+	CTexCodec::EncodeBC1(MakeGradient(2, 1, false), &blocks);
+	CHECK(blocks.size() == 8);
+}
+//=============================================================================
+// BC3の確認(アルファの誤差が小さい)
+//=============================================================================
+static void TestBC3(void)
+{
+	CTexCodec::Image image = MakeGradient(4, 4, true);
+	std::vector<unsigned char> blocks;
+
+	CTexCodec::EncodeBC3(image, &blocks);
+
+	CHECK(blocks.size() == 16);
+	CHECK(blocks[0] == 255 && blocks[1] == 0);
+
+	int aAlpha[16];
+	DecodeAlphaBlock(blocks.data(), aAlpha);
+
+	int nMaxError = 0;
+
+	for (int nCnt = 0; nCnt < 16; nCnt++)
+	{
+		nMaxError = std::max(nMaxError, abs(aAlpha[nCnt] - image.pixels[nCnt * 4 + 3]));
+	}
+
+	CHECK(nMaxError <= 18);
+	CHECK(CTexCodec::HasAlpha(image));
+	CHECK(!CTexCodec::HasAlpha(MakeGradient(4, 4, false)));
+}
+//=============================================================================
+// DDSの確認(ヘッダーとファイルの大きさ)
+//=============================================================================
+static void TestDDS(void)
+{
+	const char* pFilename = "texcodec_test.dds";
+
+	std::vector<CTexCodec::Image> mips;
+	CTexCodec::BuildMips(MakeGradient(16, 8, true), &mips);
+
+	CHECK(CTexCodec::WriteDDS(pFilename, CTexCodec::FORMAT_DXT5, mips));
+
+	FILE* pFile = fopen(pFilename, "rb");
+	CHECK(pFile != nullptr);
+
+	if (pFile == nullptr)
+	{
+		return;
+	}
+
+	std::vector<unsigned char> data;
+	unsigned char aBuf[256];
+	size_t nRead = 0;
+
+	while ((nRead = fread(aBuf, 1, sizeof(aBuf), pFile)) > 0)
+	{
+		data.insert(data.end(), aBuf, aBuf + nRead);
+	}
+
+	fclose(pFile);
+	remove(pFilename);
+
+	auto get = [&data](size_t nOffset)
+	{
+		return (unsigned int)data[nOffset] | ((unsigned int)data[nOffset + 1] << 8) |
+			((unsigned int)data[nOffset + 2] << 16) | ((unsigned int)data[nOffset + 3] << 24);
+	};
+
+	// 16x8 8x4 4x2 2x1 1x1 = 8 + 2 + 1 + 1 + 1 ブロック
+	CHECK(data.size() == 128 + 13 * 16);
+	CHECK(memcmp(data.data(), "DDS ", 4) == 0);
+	CHECK(get(4) == 124);
+	CHECK(get(12) == 8 && get(16) == 16);
+	CHECK(get(20) == 8 * 16);
+	CHECK(get(28) == 5);
+	CHECK(memcmp(&data[84], "DXT5", 4) == 0);
+
+	// 圧縮しない形式はミップマップ無しで画素をそのまま書く
+	std::vector<CTexCodec::Image> single(1, MakeGradient(4, 4, true));
+	CHECK(CTexCodec::WriteDDS(pFilename, CTexCodec::FORMAT_A8R8G8B8, single));
+
+	pFile = fopen(pFilename, "rb");
+	CHECK(pFile != nullptr);
+
+	if (pFile != nullptr)
+	{
+		fseek(pFile, 0, SEEK_END);
+		CHECK(ftell(pFile) == 128 + 64);
+		fclose(pFile);
+	}
+
+	remove(pFilename);
+}
+//=============================================================================
+// 圧縮しない画像の一覧と変換結果の一覧の確認
+//=============================================================================
+static void TestRulesAndManifest(void)
+{
+	const char* pRules = "texcodec_test_rules.txt";
+	FILE* pFile = fopen(pRules, "w");
+	CHECK(pFile != nullptr);
+
+	if (pFile != nullptr)
+	{
+		fprintf(pFile, "# comment\n\nui_start.png\r\n  Title.png  # trailing\n");
+		fclose(pFile);
+	}
+
+	std::vector<std::string> rules;
+	CHECK(CTexCodec::LoadRules(pRules, &rules));
+	remove(pRules);
+
+	CHECK(rules.size() == 2);
+	CHECK(CTexCodec::IsUncompressed(rules, "data/TEXTURE/ui_start.png"));
+	CHECK(CTexCodec::IsUncompressed(rules, "data\\TEXTURE\\title.png"));
+	CHECK(!CTexCodec::IsUncompressed(rules, "data/TEXTURE/ui_start2.png"));
+	CHECK(!CTexCodec::IsUncompressed(rules, "data/TEXTURE/soil.jpg"));
+
+	const char* pManifest = "texcodec_test_manifest.txt";
+	CTexCodec::ManifestEntry entry = { 0x0123456789abcdefULL, 0x01d0000000000001ULL, 1234, "DXT1", "data/TEXTURE/soil.jpg", "data/TEXTURE/cooked/soil.dds" };
+	std::vector<CTexCodec::ManifestEntry> entries(1, entry);
+
+	CHECK(CTexCodec::SaveManifest(pManifest, entries));
+	CHECK(CTexCodec::LoadManifest(pManifest, &entries));
+	remove(pManifest);
+
+	CHECK(entries.size() == 1);
+	CHECK(entries[0].hash == entry.hash && entries[0].time == entry.time && entries[0].size == entry.size);
+	CHECK(entries[0].format == entry.format && entries[0].source == entry.source && entries[0].cooked == entry.cooked);
+}
+//=============================================================================
+// メイン関数
+//=============================================================================
+int main(void)
+{
+	TestMips();
+	TestBC1();
+	TestBC3();
+	TestDDS();
+	TestRulesAndManifest();
+
+	printf("texcodec_test : %s\n", g_nNumFailed == 0 ? "pass" : "FAIL");
+
+	return g_nNumFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,383 @@
+//=============================================================================
+//
+// テクスチャ変換ツール [texcook.cpp]
+// Author : RIKU TANEKAWA
+//
+// 使い方 : texcook [リポジトリのフォルダ] [結果のファイル]
+// ゲームの-cooktexと同じく data/TEXTURE の画像を data/TEXTURE/cooked にDDSで書き出し、
+// 同じ形式の変換結果の一覧を書く(ゲームはどちらで作った一覧でも読める)
+//
+//=============================================================================
+
+//*****************************************************************************
+// インクルードファイル
+//*****************************************************************************
+#include "texcodec.h"
+#include "algorithm"
+#include "cstdio"
+#include "cstring"
+#include "sstream"
+#include "unordered_map"
+#include "dirent.h"
+#include "sys/stat.h"
+#include "unistd.h"
+#include "png.h"
+#include "jpeglib.h"
+
+//*****************************************************************************
+// 定数宣言
+//*****************************************************************************
+namespace
+{
+	const char* const SOURCE_DIR	= "data/TEXTURE/";						// 元画像のフォルダ
+	const char* const COOKED_DIR	= "data/TEXTURE/cooked/";				// 変換後のフォルダ
+	const char* const MANIFEST_FILE	= "data/TEXTURE/cooked/manifest.txt";	// 変換結果の一覧
+	const char* const RULES_FILE	= "data/TEXTURE/uncompressed.txt";		// 圧縮しない画像の一覧
+
+	constexpr unsigned long long FILETIME_UNIX_EPOCH	= 116444736000000000ULL;	// 1601年から1970年までの100ns単位
+	constexpr unsigned long long FILETIME_PER_SECOND	= 10000000ULL;			// 1秒の100ns単位
+}
+
+//=============================================================================
+// 拡張子の取得(小文字にする)
+//=============================================================================
+static std::string GetExtension(const std::string& name)
+{
+	size_t nDot = name.find_last_of('.');
+	std::string ext = (nDot != std::string::npos) ? name.substr(nDot + 1) : "";
+
+	for (auto& c : ext)
+	{
+		c = (char)tolower((unsigned char)c);
+	}
+
+	return ext;
+}
+//=============================================================================
+// ファイルの更新日時と大きさの取得処理(ゲームと比べられるようにFILETIMEの単位にする)
+//=============================================================================
+static bool GetFileStamp(const char* pFilename, unsigned long long* pTime, unsigned long long* pSize)
+{
+	struct stat st;
+
+	if (stat(pFilename, &st) != 0)
+	{
+		*pTime = 0;
+		*pSize = 0;
+		return false;
+	}
+
+	*pTime = FILETIME_UNIX_EPOCH + (unsigned long long)st.st_mtim.tv_sec * FILETIME_PER_SECOND + (unsigned long long)st.st_mtim.tv_nsec / 100;
+	*pSize = (unsigned long long)st.st_size;
+
+	return true;
+}
+//=============================================================================
+// ファイルがあるかの判定
+//=============================================================================
+static bool FileExists(const std::string& filename)
+{
+	struct stat st;
+
+	return stat(filename.c_str(), &st) == 0;
+}
+//=============================================================================
+// pngの読み込み処理(B・G・R・Aに展開する)
+//=============================================================================
+static bool LoadPng(const std::string& source, CTexCodec::Image* pOut)
+{
+	png_image image;
+	memset(&image, 0, sizeof(image));
+	image.version = PNG_IMAGE_VERSION;
+
+	if (!png_image_begin_read_from_file(&image, source.c_str()))
+	{
+		return false;
+	}
+
+	image.format = PNG_FORMAT_BGRA;
+
+	pOut->nWidth = (int)image.width;
+	pOut->nHeight = (int)image.height;
+	pOut->pixels.resize(PNG_IMAGE_SIZE(image));
+
+	if (!png_image_finish_read(&image, nullptr, pOut->pixels.data(), 0, nullptr))
+	{
+		png_image_free(&image);
+		return false;
+	}
+
+	return true;
+}
+//=============================================================================
+// jpgの読み込み処理(B・G・R・Aに展開する。アルファは全て不透明)
+//=============================================================================
+static bool LoadJpeg(const std::string& source, CTexCodec::Image* pOut)
+{
+	FILE* pFile = fopen(source.c_str(), "rb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	jpeg_decompress_struct cinfo;
+	jpeg_error_mgr jerr;
+
+	cinfo.err = jpeg_std_error(&jerr);
+	jpeg_create_decompress(&cinfo);
+	jpeg_stdio_src(&cinfo, pFile);
+
+	if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+	{
+		jpeg_destroy_decompress(&cinfo);
+		fclose(pFile);
+		return false;
+	}
+
+	cinfo.out_color_space = JCS_RGB;
+	jpeg_start_decompress(&cinfo);
+
+	pOut->nWidth = (int)cinfo.output_width;
+	pOut->nHeight = (int)cinfo.output_height;
+	pOut->pixels.resize((size_t)pOut->nWidth * pOut->nHeight * 4);
+
+	std::vector<unsigned char> row((size_t)pOut->nWidth * 3);
+
+	while (cinfo.output_scanline < cinfo.output_height)
+	{
+		int nY = (int)cinfo.output_scanline;
+		JSAMPROW pRow = row.data();
+
+		jpeg_read_scanlines(&cinfo, &pRow, 1);
+
+		unsigned char* pDst = &pOut->pixels[(size_t)nY * pOut->nWidth * 4];
+
+		for (int nX = 0; nX < pOut->nWidth; nX++)
+		{
+			pDst[nX * 4 + 0] = row[nX * 3 + 2];
+			pDst[nX * 4 + 1] = row[nX * 3 + 1];
+			pDst[nX * 4 + 2] = row[nX * 3 + 0];
+			pDst[nX * 4 + 3] = 0xff;
+		}
+	}
+
+	jpeg_finish_decompress(&cinfo);
+	jpeg_destroy_decompress(&cinfo);
+	fclose(pFile);
+
+	return true;
+}
+//=============================================================================
+// 1枚の変換処理(ゲームのCTextureCooker::Cookと同じ判定)
+//=============================================================================
+static bool Cook(const std::string& source, const std::string& cooked, const std::vector<std::string>& rules, std::string* pFormat)
+{
+	pFormat->clear();
+
+	CTexCodec::Image image;
+	std::string ext = GetExtension(source);
+	bool bLoad = (ext == "png") ? LoadPng(source, &image) : LoadJpeg(source, &image);
+
+	if (!bLoad)
+	{
+		return false;
+	}
+
+	std::vector<CTexCodec::Image> mips;
+	CTexCodec::FORMAT format = CTexCodec::FORMAT_A8R8G8B8;
+
+	if (CTexCodec::IsUncompressed(rules, source))
+	{
+		mips.push_back(std::move(image));
+	}
+	else
+	{
+		// 圧縮は4x4単位なので割り切れない物は変換しない
+		if (image.nWidth % CTexCodec::BLOCK_SIZE != 0 || image.nHeight % CTexCodec::BLOCK_SIZE != 0)
+		{
+			return true;
+		}
+
+		format = CTexCodec::HasAlpha(image) ? CTexCodec::FORMAT_DXT5 : CTexCodec::FORMAT_DXT1;
+		CTexCodec::BuildMips(image, &mips);
+	}
+
+	if (!CTexCodec::WriteDDS(cooked.c_str(), format, mips))
+	{
+		return false;
+	}
+
+	*pFormat = CTexCodec::GetFormatName(format);
+
+	return true;
+}
+//=============================================================================
+// メイン関数
+//=============================================================================
+int main(int argc, char* argv[])
+{
+	const char* pRoot = (argc > 1) ? argv[1] : ".";
+	const char* pLogFile = (argc > 2) ? argv[2] : "cooktex.txt";
+
+	// 結果のファイルは呼び出した場所に書くので、先に開いておく
+	FILE* pFile = fopen(pLogFile, "w");
+
+	if (chdir(pRoot) != 0)
+	{
+		fprintf(stderr, "texcook: cannot open %s\n", pRoot);
+
+		if (pFile != nullptr)
+		{
+			fclose(pFile);
+		}
+
+		return 1;
+	}
+
+	mkdir(COOKED_DIR, 0755);
+
+	// 前回の変換結果
+	std::vector<CTexCodec::ManifestEntry> oldEntries;
+	CTexCodec::LoadManifest(MANIFEST_FILE, &oldEntries);
+
+	std::unordered_map<std::string, CTexCodec::ManifestEntry> oldMap;
+
+	for (const auto& entry : oldEntries)
+	{
+		oldMap[entry.source] = entry;
+	}
+
+	// 元画像を集める(D3DXを使わないので読めるのはpngとjpgだけ)
+	std::vector<std::string> sources;
+	int nNumUnsupported = 0;
+	DIR* pDir = opendir(SOURCE_DIR);
+
+	if (pDir != nullptr)
+	{
+		while (dirent* pEntry = readdir(pDir))
+		{
+			std::string name = pEntry->d_name;
+			std::string path = std::string(SOURCE_DIR) + name;
+			struct stat st;
+
+			if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+			{
+				continue;
+			}
+
+			std::string ext = GetExtension(name);
+
+			if (ext == "png" || ext == "jpg" || ext == "jpeg")
+			{
+				sources.push_back(path);
+			}
+			else if (ext == "tga" || ext == "bmp")
+			{// ゲームの-cooktexで変換する
+				nNumUnsupported++;
+			}
+		}
+
+		closedir(pDir);
+	}
+
+	std::sort(sources.begin(), sources.end());
+
+	// 圧縮しない画像の一覧(無ければ全て圧縮する)
+	std::vector<std::string> rules;
+	CTexCodec::LoadRules(RULES_FILE, &rules);
+
+	std::vector<CTexCodec::ManifestEntry> newEntries;
+	std::ostringstream log;
+	int nNumCooked = 0, nNumUpToDate = 0, nNumSkipped = 0, nNumFailed = 0;
+
+	for (const auto& source : sources)
+	{
+		bool bRead = false;
+		unsigned long long hash = CTexCodec::HashFile(source.c_str(), &bRead);
+
+		if (!bRead)
+		{
+			log << "failed   " << source << " (read)\n";
+			nNumFailed++;
+			continue;
+		}
+
+		unsigned long long time = 0, size = 0;
+		GetFileStamp(source.c_str(), &time, &size);
+
+		std::string stem = source.substr(strlen(SOURCE_DIR));
+		stem = stem.substr(0, stem.find_last_of('.'));
+		std::string cooked = std::string(COOKED_DIR) + stem + ".dds";
+
+		// 前回から変わっていなければそのまま使う
+		auto it = oldMap.find(source);
+
+		if (it != oldMap.end() && it->second.hash == hash && it->second.cooked == cooked && FileExists(cooked))
+		{
+			newEntries.push_back(it->second);
+			newEntries.back().time = time;
+			newEntries.back().size = size;
+			nNumUpToDate++;
+			continue;
+		}
+
+		std::string format;
+
+		if (!Cook(source, cooked, rules, &format))
+		{
+			log << "failed   " << source << "\n";
+			nNumFailed++;
+			continue;
+		}
+
+		if (format.empty())
+		{// 圧縮できない大きさなので元画像のまま使う
+			remove(cooked.c_str());
+			log << "skipped  " << source << " (size is not a multiple of 4)\n";
+			nNumSkipped++;
+			continue;
+		}
+
+		CTexCodec::ManifestEntry entry;
+		entry.hash = hash;
+		entry.time = time;
+		entry.size = size;
+		entry.format = format;
+		entry.source = source;
+		entry.cooked = cooked;
+		newEntries.push_back(entry);
+
+		log << "cooked   " << source << " -> " << cooked << " (" << format << ")\n";
+		nNumCooked++;
+	}
+
+	// 元画像が無くなった物のDDSは消す
+	for (const auto& entry : oldEntries)
+	{
+		if (!FileExists(entry.source))
+		{
+			remove(entry.cooked.c_str());
+		}
+	}
+
+	bool bSaved = CTexCodec::SaveManifest(MANIFEST_FILE, newEntries);
+
+	// 結果の書き出し
+	if (pFile != nullptr)
+	{
+		fprintf(pFile, "sources          : %d\n", (int)sources.size());
+		fprintf(pFile, "cooked           : %d\n", nNumCooked);
+		fprintf(pFile, "up to date       : %d\n", nNumUpToDate);
+		fprintf(pFile, "skipped          : %d\n", nNumSkipped);
+		fprintf(pFile, "failed           : %d\n", nNumFailed);
+		fprintf(pFile, "tga/bmp (game)   : %d\n", nNumUnsupported);
+		fprintf(pFile, "manifest saved   : %s\n\n", bSaved ? "yes" : "no");
+		fprintf(pFile, "%s", log.str().c_str());
+
+		// ファイルを閉じる
+		fclose(pFile);
+	}
+
+	return (bSaved && nNumFailed == 0) ? 0 : 1;
+}
@@ -1,12 +1,12 @@
 //=============================================================================
 //
-// `[gA [tutorial.cpp]
+// チュートリアル処理 [tutorial.cpp]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "tutorial.h"
 #include "manager.h"
@@ -21,112 +21,118 @@
 
 
 //*****************************************************************************
-// ÓIoϐ錾
+// 静的メンバ変数宣言
 //*****************************************************************************
-CTime* CTutorial::m_pTime = nullptr;					// ^Cւ̃|C^
-CBlock* CTutorial::m_pBlock = nullptr;					// ubNւ̃|C^
-CBlockManager* CTutorial::m_pBlockManager = nullptr;	// ubN}l[W[ւ̃|C^
+CTime* CTutorial::m_pTime = nullptr;					// タイムへのポインタ
+CBlock* CTutorial::m_pBlock = nullptr;					// ブロックへのポインタ
+CBlockManager* CTutorial::m_pBlockManager = nullptr;	// ブロックマネージャーへのポインタ
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CTutorial::CTutorial() : CScene(CScene::MODE_TUTORIAL)
 {
-	// l̃NA
-	m_pLight	= nullptr;	// Cgւ̃|C^
-	m_timer		= 0;		// ^C}[
+	// 値のクリア
+	m_pLight	= nullptr;	// ライトへのポインタ
+	m_nLightGeneration = 0;	// 登録した時のライトの世代
+	m_timer		= 0;		// タイマー
+
+	for (int nCnt = 0; nCnt < LIGHT_MAX; nCnt++)
+	{
+		m_anLight[nCnt] = -1;	// 登録したライトの番号
+	}
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CTutorial::~CTutorial()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CTutorial::Init(void)
 {
-	// ubN}l[W[̐
+	// ブロックマネージャーの生成
 	m_pBlockManager = new CBlockManager;
 
-	// ubN}l[W[̏
+	// ブロックマネージャーの初期化
 	m_pBlockManager->Init();
 
-	// Cg̐
+	// ライトの生成
 	m_pLight = new CLight;
 
-	// Cg̏
+	// ライトの初期化
 	m_pLight->Init();
 
-	// Cg̐ݒ菈
+	// ライトの設定処理
 	ResetLight();
 
-	// zu̓ǂݍ
+	// 配置情報の読み込み
 	m_pBlockManager->LoadFromJson("data/tutorial_blockinfo.json");
 
-	// _n`
+	// ランダム地形生成
 	CGenerateMap::GetInstance()->GenerateRandomTerrain(TUTORIAL_SEED);
 
-	// LN^[}l[W[̐
+	// キャラクターマネージャーの生成
 	auto& charaMgr = CCharacterManager::GetInstance();
 
-	// vC[̐
+	// プレイヤーの生成
 	m_pPlayer = CPlayer::Create(D3DXVECTOR3(0.0f, 30.0f, -300.0f), D3DXVECTOR3(0.0f, 180.0f, 0.0f));
 	charaMgr.AddCharacter(m_pPlayer);
 
-	// ^C̐
+	// タイムの生成
 	m_pTime = CTime::Create(3, 0, 760.0f, 10.0f, 42.0f, 58.0f, false);
 
-	// bVh[̐
+	// メッシュドームの生成
 	CMeshDome::Create(D3DXVECTOR3(0.0f, 0.0f, 0.0f), 1000);
 
-	// u`[gAvUI
+	// 「チュートリアル」UI生成
 	auto tutorial = CUITexture::Create("data/TEXTURE/ui_tutorial.png", 0.57f, 0.57f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.15f, 0.12f);
 
-	// XLbvUI
+	// スキップUI生成
 	auto skip_xinput = CUITexture::Create("data/TEXTURE/ui_skip_xinput.png", 0.9f, 0.9f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.09f, 0.06f);
 	auto skip_keyboard = CUITexture::Create("data/TEXTURE/ui_skip_keyboard.png", 0.9f, 0.9f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.09f, 0.06f);
 
-	// JnUI
+	// 開始UI生成
 	auto start_xinput = CUITexture::Create("data/TEXTURE/ui_mission_start_xinput.png", 0.57f, 0.85f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.1f, 0.06f);
 	auto start_keyboard = CUITexture::Create("data/TEXTURE/ui_mission_start_keyboard.png", 0.57f, 0.85f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.1f, 0.06f);
 
-	// [UI
+	// ルールUI生成
 	auto rule_1 = CUITexture::Create("data/TEXTURE/ui_rule1.png", 0.18f, 0.2f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.05f);
 	auto rule_2 = CUITexture::Create("data/TEXTURE/ui_rule2.png", 0.18f, 0.35f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.05f);
 	auto rule_3 = CUITexture::Create("data/TEXTURE/ui_rule3.png", 0.18f, 0.5f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.05f);
 
-	// UI
+	// 操作UI生成
 	auto dush_xinput = CUITexture::Create("data/TEXTURE/ui_operation_dush_xinput.png", 0.95f, 0.2f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.045f);
 	auto stealth_xinput = CUITexture::Create("data/TEXTURE/ui_operation_stealth_xinput.png", 0.95f, 0.35f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.045f);
 	auto dush_keyboard = CUITexture::Create("data/TEXTURE/ui_operation_dush_keyboard.png", 0.95f, 0.2f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.045f);
 	auto stealth_keyboard = CUITexture::Create("data/TEXTURE/ui_operation_stealth_keyboard.png", 0.95f, 0.35f, D3DXCOLOR(1.0f, 1.0f, 1.0f, 1.0f), 0.12f, 0.045f);
 
-	// u`[gAvUIo^
+	// 「チュートリアル」UI登録
 	CUIManager::GetInstance()->AddUI("Tutorial", tutorial);
 
-	// XLbvUIo^
+	// スキップUI登録
 	CUIManager::GetInstance()->AddUI("Skip_XInput", skip_xinput);
 	CUIManager::GetInstance()->AddUI("Skip_Keyboard", skip_keyboard);
 
-	// JnUIo^
+	// 開始UI登録
 	CUIManager::GetInstance()->AddUI("Start_XInput", start_xinput);
 	CUIManager::GetInstance()->AddUI("Start_Keyboard", start_keyboard);
 
-	// [UIo^
+	// ルールUI登録
 	CUIManager::GetInstance()->AddUI("Rule_1", rule_1);
 	CUIManager::GetInstance()->AddUI("Rule_2", rule_2);
 	CUIManager::GetInstance()->AddUI("Rule_3", rule_3);
 
-	// UIo^
+	// 操作UI登録
 	CUIManager::GetInstance()->AddUI("Dush_xinput", dush_xinput);
 	CUIManager::GetInstance()->AddUI("Stealth_xinput", stealth_xinput);
 	CUIManager::GetInstance()->AddUI("Dush_keyboard", dush_keyboard);
 	CUIManager::GetInstance()->AddUI("Stealth_keyboard", stealth_keyboard);
 
-	// UIݒ
+	// UI初期設定
 	tutorial->Hide();
 	skip_xinput->Show();
 	skip_keyboard->Hide();
@@ -138,13 +144,13 @@ HRESULT CTutorial::Init(void)
 	stealth_keyboard->Hide();
 
 	m_startState = StartState::WaitStart;
-	m_stateTimer = 190;   // Jn̏ҋ@
+	m_stateTimer = 190;   // 開始時の初期待機
 	m_canControl = false;
 
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// `[gABGM̍Đ
+	// チュートリアルBGMの再生
 	if (pSound)
 	{
 		pSound->Play(CSound::SOUND_LABEL_TUTORIALBGM);
@@ -153,14 +159,14 @@ HRESULT CTutorial::Init(void)
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CTutorial::Uninit(void)
 {
-	// LN^[}l[W[̔j
+	// キャラクターマネージャーの破棄
 	CCharacterManager::GetInstance().Destroy();
 
-	// ubN}l[W[̔j
+	// ブロックマネージャーの破棄
 	if (m_pBlockManager != nullptr)
 	{
 		m_pBlockManager->Uninit();
@@ -169,7 +175,7 @@ void CTutorial::Uninit(void)
 		m_pBlockManager = nullptr;
 	}
 
-	// Cg̔j
+	// ライトの破棄
 	if (m_pLight != nullptr)
 	{
 		delete m_pLight;
@@ -177,27 +183,27 @@ void CTutorial::Uninit(void)
 	}
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CTutorial::Update(void)
 {
 	m_timer++;
 
-	if (m_timer >= BLOSSOM_INTERVAL)// ԊuŐ
-	{// ̐
-		// Zbg
+	if (m_timer >= BLOSSOM_INTERVAL)// 一定間隔で生成
+	{// 桜の生成
+		// リセット
 		m_timer = 0;
 
-		// vC[̈ʒuɐ
+		// プレイヤーの位置を基準に生成
 		D3DXVECTOR3 playerPos(0.0f, 0.0f, 0.0f);
 
 		if (m_pPlayer)
 		{
-			// vC[̈ʒu擾
+			// プレイヤーの位置を取得
 			playerPos = m_pPlayer->GetPos();
 		}
 
-		// p[eBN
+		// パーティクル生成
 		CParticle::Create<CBlossomParticle>(INIT_VEC3, m_pPlayer->GetPos(), D3DXCOLOR(0.8f, 0.8f, 0.8f, 0.8f), 0, 1);
 	}
 
@@ -205,7 +211,7 @@ void CTutorial::Update(void)
 	CInputKeyboard* pKeyboard = CManager::GetInputKeyboard();
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
-	// UI̎擾
+	// UIの取得
 	auto skip_xinput = CUIManager::GetInstance()->GetUI("Skip_XInput");
 	auto skip_keyboard = CUIManager::GetInstance()->GetUI("Skip_Keyboard");
 	auto dush_xinput = CUIManager::GetInstance()->GetUI("Dush_xinput");
@@ -213,10 +219,10 @@ void CTutorial::Update(void)
 	auto stealth_xinput = CUIManager::GetInstance()->GetUI("Stealth_xinput");
 	auto stealth_keyboard = CUIManager::GetInstance()->GetUI("Stealth_keyboard");
 
-	// ̓foCXɉUI؂ւ
+	// 入力デバイスに応じてUIを切り替える
 	if (pJoypad->GetAnyTrigger() || pJoypad->GetStick())
 	{
-		// L[{[h\OFFɂXInput\
+		// キーボード表示をOFFにしてXInput表示
 		skip_keyboard->Hide();
 		dush_keyboard->Hide();
 		stealth_keyboard->Hide();
@@ -227,7 +233,7 @@ void CTutorial::Update(void)
 	}
 	else if (pKeyboard->GetAnyKeyTrigger())
 	{
-		// XInput\OFFɂăL[{[h\
+		// XInput表示をOFFにしてキーボード表示
 		skip_xinput->Hide();
 		dush_xinput->Hide();
 		stealth_xinput->Hide();
@@ -239,56 +245,56 @@ void CTutorial::Update(void)
 
 	if (m_pPlayer)
 	{
-		// UI̍XV
+		// UIの更新
 		UIUpdate();
 	}
 
-	// ubN}l[W[̍XV
+	// ブロックマネージャーの更新処理
 	m_pBlockManager->Update();
 
-	// Cӂ̃{^Ƃ
+	// 任意のボタンを押したとき
 	if (pFade->GetFade() == CFade::FADE_NONE &&
 		(pKeyboard->GetTrigger(DIK_TAB) || pJoypad->GetTrigger(CInputJoypad::JOYKEY_START)))
 	{
-		// [r[ʂɈڍs
+		// ムービー画面に移行
 		pFade->SetFade(MODE_MOVIE);
 	}
 
-	// JnUI̎擾
+	// 開始UIの取得
 	auto start_xinput = CUIManager::GetInstance()->GetUI("Start_XInput");
 	auto start_keyboard = CUIManager::GetInstance()->GetUI("Start_Keyboard");
 
-	// --- EoA͈͓mF ---
+	// --- 脱出したか、範囲内か確認 ---
 	auto exitBlocks = CBlockManager::GetBlocksOfType<CExitBlock>();
 
 	for (CExitBlock* exit : exitBlocks)
 	{
 		if (pFade->GetFade() == CFade::FADE_NONE && exit->IsEscape())
 		{
-			// [r[ʂɈڍs
+			// ムービー画面に移行
 			pFade->SetFade(MODE_MOVIE);
 		}
 
-		// ͈͓̂Ƃ
+		// 範囲内のとき
 		if (exit->IsIn())
 		{
-			// ̓foCXɉUI؂ւ
+			// 入力デバイスに応じてUIを切り替える
 			if (pJoypad->GetAnyTrigger() || pJoypad->GetStick())
 			{
-				// \
+				// 表示
 				start_keyboard->Hide();
 				start_xinput->Show();
 			}
 			else if (pKeyboard->GetAnyKeyTrigger())
 			{
-				// \
+				// 表示
 				start_xinput->Hide();
 				start_keyboard->Show();
 			}
 		}
 		else
 		{
-			// \
+			// 非表示
 			start_xinput->Hide();
 			start_keyboard->Hide();
 		}
@@ -299,61 +305,61 @@ void CTutorial::Update(void)
 
 	if (pFade->GetFade() == CFade::FADE_NONE && pInputKeyboard->GetTrigger(DIK_RETURN))
 	{
-		// Q[ʂɈڍs
+		// ゲーム画面に移行
 		pFade->SetFade(MODE_MOVIE);
 	}
 #endif
 
 }
 //=============================================================================
-// Cg̐ݒ菈
+// ライトの設定処理(登録済みなら色と向きだけ書き換える)
 //=============================================================================
 void CTutorial::ResetLight(void)
 {
-	// CCgF
-	D3DXCOLOR evening(1.0f, 0.65f, 0.35f, 1.0f); // [
+	// メインライト色
+	D3DXCOLOR evening(1.0f, 0.65f, 0.35f, 1.0f); // 夕方
 
-	// ̌
+	// 光の向き
 	D3DXVECTOR3 dirEvening(0.5f, -1.0f, 0.3f);
 
-	// Đݒ
-	CLight::Uninit();
+	// メインライト
+	SetSceneLight(LIGHT_MAIN, evening, dirEvening, D3DXVECTOR3(0.0f, 300.0f, 0.0f));
 
-	// ubN}l[W[̍XV
-	m_pBlockManager->UpdateLight();
+	// サブライト
+	D3DXCOLOR skyEvening(0.4f, 0.45f, 0.8f, 1.0f);
 
-	// CCg
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		evening,
-		dirEvening,
-		D3DXVECTOR3(0.0f, 300.0f, 0.0f)
-	);
+	SetSceneLight(LIGHT_SKY, skyEvening, D3DXVECTOR3(0.0f, -1.0f, 0.0f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
 
-	// TuCg
-	D3DXCOLOR skyEvening(0.4f, 0.45f, 0.8f, 1.0f);
+	// 補助光
+	SetSceneLight(LIGHT_FILL, D3DXCOLOR(0.7f, 0.3f, 0.25f, 1.0f), D3DXVECTOR3(-0.3f, 0.0f, -0.7f), D3DXVECTOR3(0.0f, 0.0f, 0.0f));
+
+	// 登録した世代を覚えておく
+	m_nLightGeneration = CLight::GetGeneration();
+
+	// 灯籠などのライトの更新
+	m_pBlockManager->UpdateLight();
+}
+//=============================================================================
+// シーンライトの設定処理(登録は1回だけ行い、以降は色と向きだけ書き換える)
+//=============================================================================
+void CTutorial::SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos)
+{
+	// ライトが作り直されていたら登録し直す
+	if (m_anLight[light] < 0 || m_nLightGeneration != CLight::GetGeneration())
+	{
+		m_anLight[light] = CLight::AddLight(D3DLIGHT_DIRECTIONAL, col, dir, pos);
+		return;
+	}
 
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		skyEvening,
-		D3DXVECTOR3(0.0f, -1.0f, 0.0f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
-
-	// ⏕
-	CLight::AddLight(
-		D3DLIGHT_DIRECTIONAL,
-		D3DXCOLOR(0.7f, 0.3f, 0.25f, 1.0f),
-		D3DXVECTOR3(-0.3f, 0.0f, -0.7f),
-		D3DXVECTOR3(0.0f, 0.0f, 0.0f)
-	);
+	CLight::SetLightDiffuse(m_anLight[light], col);
+	CLight::SetLightDirection(m_anLight[light], dir);
 }
 //=============================================================================
-// UI̍XV
+// UIの更新処理
 //=============================================================================
 void CTutorial::UIUpdate(void)
 {
-	// UI̎擾
+	// UIの取得
 	auto tutorial = CUIManager::GetInstance()->GetUI("Tutorial");
 
 	switch (m_startState)
@@ -363,20 +369,20 @@ void CTutorial::UIUpdate(void)
 
 		if (m_stateTimer <= 0.0f)
 		{
-			// ̎擾
+			// 音の取得
 			CSound* pSound = CManager::GetSound();
 
-			// JnSE̍Đ
+			// 開始SEの再生
 			if (pSound)
 			{
 				pSound->Play(CSound::SOUND_LABEL_START);
 			}
 
-			// UI\
+			// UI表示
 			tutorial->Show();
 
 			m_startState = StartState::Hidden;
-			m_stateTimer = 180;  // UI\
+			m_stateTimer = 180;  // UI表示時間
 		}
 		break;
 
@@ -385,10 +391,10 @@ void CTutorial::UIUpdate(void)
 
 		if (m_stateTimer <= 0.0f)
 		{
-			// UI\
+			// UI非表示
 			tutorial->FadeOut(60.0f);
 
-			// tOtrueɂ
+			// 操作フラグをtrueにする
 			m_pPlayer->SetControlFlag(true);
 
 			m_startState = StartState::Idle;
@@ -401,33 +407,33 @@ void CTutorial::UIUpdate(void)
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CTutorial::Draw(void)
 {
 
 }
 //=============================================================================
-// foCXZbgʒm
+// デバイスリセット通知
 //=============================================================================
 void CTutorial::OnDeviceReset(void)
 {
-	// Cg̐ݒ菈
+	// ライトの設定処理
 	ResetLight();
 }
 //=============================================================================
-// TlC[Xʒm
+// サムネイルリリース通知
 //=============================================================================
 void CTutorial::ReleaseThumbnail(void)
 {
 	m_pBlockManager->ReleaseThumbnailRenderTarget();
 }
 //=============================================================================
-// TlCZbgʒm
+// サムネイルリセット通知
 //=============================================================================
 void CTutorial::ResetThumbnail(void)
 {
 	m_pBlockManager->InitThumbnailRenderTarget(CManager::GetRenderer()->GetDevice());
-	m_pBlockManager->GenerateThumbnailsForResources(); // LbVč쐬
+	m_pBlockManager->GenerateThumbnailsForResources(); // キャッシュも再作成
 }
 
@@ -1,28 +1,28 @@
 //=============================================================================
 //
-// `[gA [tutorial.h]
+// チュートリアル処理 [tutorial.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _TUTORIAL_H_// ̃}N`ĂȂ
-#define _TUTORIAL_H_// 2dCN[hh~̃}N`
+#ifndef _TUTORIAL_H_// このマクロ定義がされていなかったら
+#define _TUTORIAL_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "scene.h"
 #include "blockmanager.h"
 #include "block.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CPlayer;
 class CLight;
 class CTime;
 
 //*****************************************************************************
-// `[gANX
+// チュートリアルクラス
 //*****************************************************************************
 class CTutorial : public CScene
 {
@@ -32,9 +32,9 @@ public:
 
 	enum StartState
 	{
-		WaitStart,      // ҂
-		Hidden,			// UI\
-		Idle,			// AChO
+		WaitStart,      // 少し待つ
+		Hidden,			// UI非表示
+		Idle,			// アイドリング
 	};
 
 	HRESULT Init(void);
@@ -51,18 +51,31 @@ public:
 	static CBlockManager* GetBlockManager(void) { return m_pBlockManager; }
 
 private:
-	static constexpr int TUTORIAL_SEED		= 1767579496;	// `[gAŎgCɓ̃V[hl
-	static constexpr int BLOSSOM_INTERVAL	= 15;			// ̐C^[o
+	static constexpr int TUTORIAL_SEED		= 1767579496;	// チュートリアルで使うお気に入りのシード値
+	static constexpr int BLOSSOM_INTERVAL	= 15;			// 桜の生成インターバル
 
-	CPlayer*				m_pPlayer;			// vC[ւ̃|C^
-	static CTime*			m_pTime;			// ^Cւ̃|C^
-	static CBlock*			m_pBlock;			// ubNւ̃|C^
-	static CBlockManager*	m_pBlockManager;	// ubN}l[W[ւ̃|C^
-	CLight*					m_pLight;			// Cgւ̃|C^
-	int						m_timer;			// p[eBN^C}[
-	StartState				m_startState;		// UȈ
-	float					m_stateTimer;		// UIx^C}[
-	bool					m_canControl;		// \tO
+	// チュートリアルで使うライト
+	typedef enum
+	{
+		LIGHT_MAIN = 0,	// メインライト
+		LIGHT_SKY,		// サブライト
+		LIGHT_FILL,		// 補助光
+		LIGHT_MAX
+	}LIGHT;
+
+	void SetSceneLight(LIGHT light, const D3DXCOLOR& col, const D3DXVECTOR3& dir, const D3DXVECTOR3& pos);
+
+	CPlayer*				m_pPlayer;			// プレイヤーへのポインタ
+	static CTime*			m_pTime;			// タイムへのポインタ
+	static CBlock*			m_pBlock;			// ブロックへのポインタ
+	static CBlockManager*	m_pBlockManager;	// ブロックマネージャーへのポインタ
+	CLight*					m_pLight;			// ライトへのポインタ
+	int						m_anLight[LIGHT_MAX];	// 登録したライトの番号
+	unsigned int			m_nLightGeneration;	// 登録した時のライトの世代
+	int						m_timer;			// パーティクル生成タイマー
+	StartState				m_startState;		// UIの状態
+	float					m_stateTimer;		// UI遅延タイマー
+	bool					m_canControl;		// 操作可能フラグ
 };
 
 #endif
@@ -1,20 +1,21 @@
 //=============================================================================
 //
-// UI [ui.h]
+// UI処理 [ui.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "ui.h"
 #include "manager.h"
 #include "result.h"
 #include "easing.h"
+#include "spritebatch.h"
 
 //=============================================================================
-// UI}l[W[̃CX^X
+// UIマネージャーのインスタンス生成
 //=============================================================================
 CUIManager* CUIManager::GetInstance(void)
 {
@@ -22,18 +23,18 @@ CUIManager* CUIManager::GetInstance(void)
     return &inst;
 }
 //=============================================================================
-// UI}l[W[̏
+// UIマネージャーの初期化処理
 //=============================================================================
 HRESULT CUIManager::Init(void)
 {
-    // Xgɂ
+    // リストを空にする
     m_uiList.clear();
     m_uiMap.clear();
 
     return S_OK;
 }
 //=============================================================================
-// UI}l[W[̏I
+// UIマネージャーの終了処理
 //=============================================================================
 void CUIManager::Uninit(void)
 {
@@ -46,12 +47,12 @@ void CUIManager::Uninit(void)
         }
     }
 
-    // Xgɂ
+    // リストを空にする
     m_uiList.clear();
     m_uiMap.clear();
 }
 //=============================================================================
-// UI}l[W[̍XV
+// UIマネージャーの更新処理
 //=============================================================================
 void CUIManager::Update(void)
 {
@@ -64,13 +65,13 @@ void CUIManager::Update(void)
     }
 }
 //=============================================================================
-// UI}l[W[̕`揈
+// UIマネージャーの描画処理
 //=============================================================================
 void CUIManager::Draw(void)
 {
     for (auto ui : m_uiList)
     {
-        // \trueUÎݕ`
+        // 表示がtrueのUIのみ描画
         if (ui && ui->IsVisible())
         {
             ui->Draw();
@@ -78,9 +79,9 @@ void CUIManager::Draw(void)
     }
 }
 //=============================================================================
-// UIǉ
+// UI追加
 //=============================================================================
-void CUIManager::AddUI(const std::string& name, CUIBase* ui)
+void CUIManager::AddUI(const char* name, CUIBase* ui)
 {
     if (!ui)
     {
@@ -88,14 +89,14 @@ void CUIManager::AddUI(const std::string& name, CUIBase* ui)
     }
 
     m_uiList.push_back(ui);
-    m_uiMap[name] = ui;
+    m_uiMap[MakeKey(name)] = ui;
 }
 //=============================================================================
-// o^OUI擾
+// 登録した名前でUIを取得
 //=============================================================================
-CUIBase* CUIManager::GetUI(const std::string& name)
+CUIBase* CUIManager::GetUI(const char* name)
 {
-    auto it = m_uiMap.find(name);
+    auto it = m_uiMap.find(MakeKey(name));
 
     if (it != m_uiMap.end())
     {
@@ -104,43 +105,58 @@ CUIBase* CUIManager::GetUI(const std::string& name)
 
     return nullptr;
 }
+//=============================================================================
+// 名前のハッシュの計算処理(FNV-1a)
+//=============================================================================
+unsigned int CUIManager::MakeKey(const char* name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (const char* p = name; *p != '\0'; p++)
+    {
+        hash ^= (unsigned char)*p;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
 
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CUIBase::CUIBase(int nPriority) : CObject2D(nPriority)
 {
-	// l̃NA
-    memset(m_szPath, 0, sizeof(m_szPath));  // t@CpX
-    m_nIdxTexture   = 0;                    // eNX`CfbNX
-    m_bVisible      = true;                 // \tO
-    m_parent        = nullptr;              // e|C^
-    m_alpha         = 0.0f;                 // At@l
-    m_fadeSpeed     = 0.0f;                 // tF[hXs[h
-    m_fadeMode      = FadeMode::None;       // tF[h[h
-    m_slideMode     = SlideMode::None;      // XCh[h
-    m_slideT        = 0.0f;                 // XCh
-    m_slideSpeed    = 0.0f;                 // XChXs[h
-    m_useLayout     = false;                // CAEg̎gptO
-    m_layoutPos     = INIT_VEC3;            // CAEgpʒu
-    m_slideOffset   = INIT_VEC3;            // ItZbgʒu
+	// 値のクリア
+    memset(m_szPath, 0, sizeof(m_szPath));  // ファイルパス
+    m_nIdxTexture   = -1;                   // テクスチャインデックス
+    m_bVisible      = true;                 // 表示フラグ
+    m_parent        = nullptr;              // 親ポインタ
+    m_alpha         = 0.0f;                 // アルファ値
+    m_fadeSpeed     = 0.0f;                 // フェードスピード
+    m_fadeMode      = FadeMode::None;       // フェードモード
+    m_slideMode     = SlideMode::None;      // スライドモード
+    m_slideT        = 0.0f;                 // スライド割合
+    m_slideSpeed    = 0.0f;                 // スライドスピード
+    m_useLayout     = false;                // レイアウトの使用フラグ
+    m_layoutPos     = INIT_VEC3;            // レイアウト用位置
+    m_slideOffset   = INIT_VEC3;            // オフセット位置
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CUIBase::~CUIBase()
 {
-	// Ȃ
+	// なし
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CUIBase* CUIBase::Create(float x, float y, D3DXCOLOR col, float width, float height)
 {
     CUIBase* pUi = new CUIBase;
 
-    // nullptr
+    // nullptrだったら
     if (pUi == nullptr)
     {
         return nullptr;
@@ -150,7 +166,7 @@ CUIBase* CUIBase::Create(float x, float y, D3DXCOLOR col, float width, float hei
     pUi->SetCol(col);
     pUi->SetSize(width, height);
 
-    // s
+    // 初期化失敗時
     if (FAILED(pUi->Init()))
     {
         return nullptr;
@@ -159,41 +175,48 @@ CUIBase* CUIBase::Create(float x, float y, D3DXCOLOR col, float width, float hei
     return pUi;
 }
 //=============================================================================
-// 
+// 初期化処理処理
 //=============================================================================
 HRESULT CUIBase::Init(void)
 {
-    // eNX`̎擾
+    // テクスチャの取得
     m_nIdxTexture = CManager::GetTexture()->RegisterDynamic(m_szPath);
 
-    // 2DIuWFNg̏
+    // UIの画像はまとめて描けるようにアトラスへ入れる
+    CSpriteBatch::RegisterAtlas(m_nIdxTexture);
+
+    // 2Dオブジェクトの初期化処理
     CObject2D::Init();
 
     return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CUIBase::Uninit(void)
 {
+    // テクスチャの参照を外す
+    CManager::GetTexture()->Release(m_nIdxTexture);
+    m_nIdxTexture = -1;
+
     for (auto child : m_children)
     {
         child->Uninit();
         delete child;
     }
 
-    // Xgɂ
+    // リストを空にする
     m_children.clear();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CUIBase::Update(void)
 {
-    // CAEggpꍇ
+    // レイアウトを使用する場合
     if (m_useLayout)
     {
-        // obNobt@TCY̎擾
+        // バックバッファサイズの取得
         float sw = (float)CManager::GetRenderer()->GetBackBufferWidth();
         float sh = (float)CManager::GetRenderer()->GetBackBufferHeight();
 
@@ -208,7 +231,7 @@ void CUIBase::Update(void)
         //SetPos({ x, y, 0.0f });
     }
 
-    // tF[h
+    // フェード制御
     if (m_fadeMode == FadeMode::FadeIn)
     {
         m_alpha += m_fadeSpeed;
@@ -229,13 +252,13 @@ void CUIBase::Update(void)
         {
             m_alpha = 0.0f;
             m_fadeMode = FadeMode::None;
-            m_bVisible = false; // Sɏ\Ԃ
+            m_bVisible = false; // 完全に消えたら非表示状態に
         }
 
         ApplyAlpha();
     }
 
-    // XCh
+    // スライド制御
     if (m_slideMode != SlideMode::None)
     {
         m_slideT += m_slideSpeed;
@@ -247,22 +270,22 @@ void CUIBase::Update(void)
 
             if (!m_bVisible)
             {
-                // SlideOutɔ\ɂꍇ
+                // SlideOut完了後に非表示にする場合
                 // m_bVisible = false;
             }
         }
 
-        // C[WO
+        // イージング
         float t = CEasing::Ease(0.0f, 1.0f, m_slideT, CEasing::EaseOutQuint);
 
         m_slideOffset =
             m_slideStartPos + (m_slideEndPos - m_slideStartPos) * t;
     }
 
-    // ŏIWčXV
+    // 最終座標を合成して更新
     SetPos(m_layoutPos + m_slideOffset);
 
-    // 2DIuWFNg̍XV
+    // 2Dオブジェクトの更新処理
     CObject2D::Update();
 
     for (auto child : m_children)
@@ -271,17 +294,14 @@ void CUIBase::Update(void)
     }
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CUIBase::Draw(void)
 {
-    // foCX̎擾
-    LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
-
-    // eNX`̐ݒ
-    pDevice->SetTexture(0, CManager::GetTexture()->GetAddress(m_nIdxTexture));
+    // テクスチャの設定
+    SetIdxTexture(m_nIdxTexture);
 
-    // 2DIuWFNg̕`揈
+    // 2Dオブジェクトの描画処理
     CObject2D::Draw();
 
     for (auto child : m_children)
@@ -290,14 +310,14 @@ void CUIBase::Draw(void)
     }
 }
 //=============================================================================
-// At@lKp
+// アルファ値適用処理
 //=============================================================================
 void CUIBase::ApplyAlpha(void)
 {
     SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, m_alpha));
 }
 //=============================================================================
-// \E\()
+// 表示・非表示処理(即時)
 //=============================================================================
 void CUIBase::Show(void)
 {
@@ -314,13 +334,13 @@ void CUIBase::Hide(void)
     ApplyAlpha();
 }
 //=============================================================================
-// \E\(tF[h)
+// 表示・非表示処理(フェード)
 //=============================================================================
 void CUIBase::FadeIn(float duration)
 {
     m_bVisible = true;
 
-    // tF[hJnɃAt@0ɂ
+    // フェード開始時にアルファを0にする
     m_alpha = 0.0f;
     ApplyAlpha();
 
@@ -329,7 +349,7 @@ void CUIBase::FadeIn(float duration)
 }
 void CUIBase::FadeOut(float duration)
 {
-    // tF[hJnɃAt@1ɂ
+    // フェード開始時にアルファを1にする
     m_alpha = 1.0f;
     ApplyAlpha();
 
@@ -337,7 +357,7 @@ void CUIBase::FadeOut(float duration)
     m_fadeSpeed = 1.0f / duration;
 }
 //=============================================================================
-// XChCEAEg
+// スライドイン・アウト処理
 //=============================================================================
 void CUIBase::SlideIn(const D3DXVECTOR3& from, const D3DXVECTOR3& to, float duration)
 {
@@ -358,7 +378,7 @@ void CUIBase::SlideOut(const D3DXVECTOR3& to, float duration)
     m_slideMode     = SlideMode::SlideOut;
 }
 //=============================================================================
-// }EXJ[\
+// マウスカーソル判定
 //=============================================================================
 bool CUIBase::IsMouseOver(void)
 {
@@ -367,17 +387,17 @@ bool CUIBase::IsMouseOver(void)
         return false;
     }
 
-    // }EXʒu擾iXN[Wj
+    // マウス位置を取得（スクリーン座標）
     POINT cursorPos;
     GetCursorPos(&cursorPos);
 
-    // EBhEnh擾
+    // ウィンドウハンドルを取得
     HWND hwnd = GetActiveWindow();
 
-    // XN[WNCAgWɕϊ
+    // スクリーン座標をクライアント座標に変換
     ScreenToClient(hwnd, &cursorPos);
 
-    // UI ͈̔͂vZ
+    // UI の範囲を計算
     float left = GetPos().x - GetWidth();
     float right = GetPos().x + GetWidth();
     float top = GetPos().y - GetHeight();
@@ -389,28 +409,28 @@ bool CUIBase::IsMouseOver(void)
 
 
 //=============================================================================
-// UIeNX`̃RXgN^
+// UIテクスチャのコンストラクタ
 //=============================================================================
 CUITexture::CUITexture()
 {
-    // l̃NA
+    // 値のクリア
     m_isUVDirty = false;
 }
 //=============================================================================
-// UIeNX`̃fXgN^
+// UIテクスチャのデストラクタ
 //=============================================================================
 CUITexture::~CUITexture()
 {
-    // Ȃ
+    // なし
 }
 //=============================================================================
-// UIeNX`(ʒuw)
+// UIテクスチャ生成処理(位置割合指定)
 //=============================================================================
 CUITexture* CUITexture::Create(const char* path, float anchorX, float anchorY, D3DXCOLOR col, float widthRate, float heightRate)
 {
     CUITexture* pUi = new CUITexture;
 
-    // nullptr
+    // nullptrだったら
     if (pUi == nullptr)
     {
         return nullptr;
@@ -421,7 +441,7 @@ CUITexture* CUITexture::Create(const char* path, float anchorX, float anchorY, D
     pUi->SetCol(col);
     pUi->SetSizeRate(widthRate, heightRate);
 
-    // s
+    // 初期化失敗時
     if (FAILED(pUi->Init()))
     {
         return nullptr;
@@ -430,29 +450,29 @@ CUITexture* CUITexture::Create(const char* path, float anchorX, float anchorY, D
     return pUi;
 }
 //=============================================================================
-// UIeNX`
+// UIテクスチャ初期化処理
 //=============================================================================
 HRESULT CUITexture::Init(void)
 {
-    // UIx[X̏
+    // UIベースの初期化
     CUIBase::Init();
 
     return S_OK;
 }
 //=============================================================================
-// UIeNX`I
+// UIテクスチャ終了処理
 //=============================================================================
 void CUITexture::Uninit(void)
 {
-    // UIx[X̏I
+    // UIベースの終了
     CUIBase::Uninit();
 }
 //=============================================================================
-// UIeNX`XV
+// UIテクスチャ更新処理
 //=============================================================================
 void CUITexture::Update(void)
 {
-    // UIx[X̍XV
+    // UIベースの更新
     CUIBase::Update();
 
     if (!m_isUVDirty)
@@ -464,94 +484,94 @@ void CUITexture::Update(void)
     int treasureCount = CResult::GetTreasureCount();
     int soundCount = CResult::GetSoundCount();
 
-    // ɉɉă[g𗎂Ƃ
-    float EvaluationRate = 1.0f - soundCount * 0.01f;// 1%ቺ
-    EvaluationRate = std::max(EvaluationRate, 0.0f); // ő0%܂ŉ
+    // 次に音発生数に応じてレートを落とす
+    float EvaluationRate = 1.0f - soundCount * 0.01f;// 1%ずつ低下
+    EvaluationRate = std::max(EvaluationRate, 0.0f); // 最大0%まで下がる
 
-    // ̌ŕ]ɉŃ[gāAŏI肷
-    if (treasureCount >= 8)// SN
-    {// 8ȏ
+    // 埋蔵金の個数で評価した後に音発生数でレートを下げて、最終決定する
+    if (treasureCount >= 8)// Sランク
+    {// 埋蔵金8個以上
         uvLeft = 0.0f;   // S
 
         if (EvaluationRate < 0.9f && EvaluationRate >= 0.8f)
-        {// [g90%菬  80%ȏ
+        {// レートが90%より小さい かつ 80%以上
             uvLeft = UV_1;  // A
         }
         else if (EvaluationRate < 0.8f && EvaluationRate >= 0.6f)
-        {// [g80%菬  60%ȏ
+        {// レートが80%より小さい かつ 60%以上
             uvLeft = UV_2;   // B
         }
         else if(EvaluationRate <= 0.6f)
-        {// [g50%ȉ
+        {// レートが50%以下
             uvLeft = UV_3;  // C
         }
     }
-    else if (treasureCount >= 5 && treasureCount <= 7)// AN
-    {// 5ȏ7ȉ
+    else if (treasureCount >= 5 && treasureCount <= 7)// Aランク
+    {// 埋蔵金5個以上7個以下
         uvLeft = UV_1;  // A
 
         if (EvaluationRate < 0.8f && EvaluationRate >= 0.6f)
-        {// [g80%菬  60%ȏ
+        {// レートが80%より小さい かつ 60%以上
             uvLeft = UV_2;   // B
         }
         else if(EvaluationRate <= 0.6f)
-        {// [g60%ȉ
+        {// レートが60%以下
             uvLeft = UV_3;  // C
         }
     }
-    else if (treasureCount >= 3 && treasureCount <= 4)// BN
-    {// 3ȏ4ȉ
+    else if (treasureCount >= 3 && treasureCount <= 4)// Bランク
+    {// 埋蔵金3個以上4個以下
         uvLeft = UV_2;   // B
 
         if (EvaluationRate <= 0.8f)
-        {// [g80%ȉ
+        {// レートが80%以下
             uvLeft = UV_3;  // C
         }
     }
     else
-    {// ȊO
+    {// それ以外
         uvLeft = UV_3;  // C
     }
 
-    // eNX`UVړ
+    // テクスチャUV移動処理
     CObject2D::MoveTexUV(uvLeft, 0.0f, UV_1, 1.0f);
 }
 //=============================================================================
-// UIeNX``揈
+// UIテクスチャ描画処理
 //=============================================================================
 void CUITexture::Draw(void)
 {
-    // UIx[X̕`
+    // UIベースの描画
     CUIBase::Draw();
 }
 
 
 //=============================================================================
-// UĨRXgN^
+// UI文字のコンストラクタ
 //=============================================================================
 CUIText::CUIText(int nPriority) : CUIBase(nPriority)
 {
-    // l̃NA
+    // 値のクリア
     m_pFont = nullptr;
     m_fontSize = 24;
     m_color = D3DXCOLOR(1, 1, 1, 1);
     m_text = "";
 }
 //=============================================================================
-// UĨfXgN^
+// UI文字のデストラクタ
 //=============================================================================
 CUIText::~CUIText()
 {
-    // Ȃ
+    // なし
 }
 //=============================================================================
-// UI̐
+// UI文字の生成処理
 //=============================================================================
 CUIText* CUIText::Create(const std::string& text, float x, float y, int fontSize, D3DXCOLOR col)
 {
     CUIText* ui = new CUIText;
 
-    // nullptr
+    // nullptrだったら
     if (ui == nullptr)
     {
         return nullptr;
@@ -562,34 +582,34 @@ CUIText* CUIText::Create(const std::string& text, float x, float y, int fontSize
     ui->m_fontSize = fontSize;
     ui->m_color = col;
 
-    // s
+    // 初期失敗時
     if (FAILED(ui->Init()))
     {
         return nullptr;
     }
 
-    // eLXg`TCYɍ킹ă|STCY𒲐
+    // テキスト矩形サイズに合わせてポリゴンサイズを調整
     RECT rc = { 0,0,0,0 };
     ui->m_pFont->DrawText(nullptr, ui->m_text.c_str(), -1, &rc, DT_CALCRECT, D3DCOLOR_ARGB(0, 0, 0, 0));
 
-    // |STCYeLXgTCYɍ킹
+    // ポリゴンサイズをテキストサイズに合わせる
     float width = static_cast<float>(rc.right - rc.left);
     float height = static_cast<float>(rc.bottom - rc.top);
 
-    // }EXp|STCY̐ݒ
+    // マウス判定用ポリゴンサイズの設定
     ui->SetSize(width * 0.5f, height * 0.5f);
 
-    // }EXp|S͓
+    // マウス判定用ポリゴンは透明
     ui->SetCol(D3DXCOLOR(1.0f, 1.0f, 1.0f, 0.0f));
 
     return ui;
 }
 //=============================================================================
-// UȈ
+// UI文字の初期化処理
 //=============================================================================
 HRESULT CUIText::Init(void)
 {
-    // tHg
+    // フォント生成
     HDC hDC = GetDC(NULL);
     ReleaseDC(NULL, hDC);
 
@@ -608,17 +628,17 @@ HRESULT CUIText::Init(void)
         &m_pFont
     );
 
-    // UIx[X̏
+    // UIベースの初期化
     CUIBase::Init();
 
     return S_OK;
 }
 //=============================================================================
-// UȈI
+// UI文字の終了処理
 //=============================================================================
 void CUIText::Uninit(void)
 {
-    // tHg̔j
+    // フォントの破棄
     if (m_pFont != nullptr)
     {
         m_pFont->Release();
@@ -626,11 +646,11 @@ void CUIText::Uninit(void)
         m_pFont = nullptr;
     }
 
-    // UIx[X̏
+    // UIベースの初期化
     CUIBase::Uninit();
 }
 //=============================================================================
-// UI̍XV
+// UI文字の更新処理
 //=============================================================================
 void CUIText::Update(void)
 {
@@ -646,16 +666,16 @@ void CUIText::Update(void)
     {
         if (pMouse->GetTrigger(0))
         {
-            // UgʂɈڍs
+            // リザルト画面に移行
             pFade->SetFade(CScene::MODE_RESULT);
         }
     }
 
-    // UIx[X̍XV
+    // UIベースの更新
     CUIBase::Update();
 }
 //=============================================================================
-// UI̕`揈
+// UI文字の描画処理
 //=============================================================================
 void CUIText::Draw(void)
 {
@@ -669,21 +689,24 @@ void CUIText::Draw(void)
         return;
     }
 
-    // TCYvZ
+    // 文字サイズを計算
     RECT rcCalc = { 0, 0, 0, 0 };
     m_pFont->DrawText(nullptr, m_text.c_str(), -1, &rcCalc, DT_CALCRECT, 0);
 
     float textWidth = static_cast<float>(rcCalc.right - rcCalc.left);
     float textHeight = static_cast<float>(rcCalc.bottom - rcCalc.top);
 
-    // |SS (pos) ɍ킹čWvZ
+    // ポリゴン中心 (pos) に合わせて左上座標を計算
     RECT rect;
     rect.left = static_cast<LONG>(GetPos().x - textWidth / 2.0f);
     rect.top = static_cast<LONG>(GetPos().y - textHeight / 2.0f);
     rect.right = rect.left + static_cast<LONG>(textWidth);
     rect.bottom = rect.top + static_cast<LONG>(textHeight);
 
-    // `
+    // 文字はまとめ描画を通らないので、先に積んだ2Dを描いて重なりを守る
+    CSpriteBatch::Flush();
+
+    // 文字描画
     m_pFont->DrawTextA(
         nullptr,
         m_text.c_str(),
@@ -693,18 +716,18 @@ void CUIText::Draw(void)
         m_color
     );
 
-    // UIx[X̕`
+    // UIベースの描画
     CUIBase::Draw();
 }
 
 //=============================================================================
-// tHgTCYύX
+// フォントサイズ変更
 //=============================================================================
 void CUIText::SetFontSize(int size)
 {
     m_fontSize = size;
 
-    // fobO\ptHg̔j
+    // デバッグ表示用フォントの破棄
     if (m_pFont != nullptr)
     {
         m_pFont->Release();
@@ -712,6 +735,6 @@ void CUIText::SetFontSize(int size)
         m_pFont = nullptr;
     }
 
-    // 
+    // 初期化
     Init();
 }
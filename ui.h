@@ -1,24 +1,24 @@
 //=============================================================================
 //
-// UI [ui.h]
+// UI処理 [ui.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _UI_H_// ̃}N`ĂȂ
-#define _UI_H_// 2dCN[hh~̃}N`
+#ifndef _UI_H_// このマクロ定義がされていなかったら
+#define _UI_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "Object2D.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CUIBase;
 
 //*****************************************************************************
-// UI}l[W[NX
+// UIマネージャークラス
 //*****************************************************************************
 class CUIManager
 {
@@ -30,24 +30,26 @@ public:
     void Update(void);
     void Draw(void);
 
-    // UI o^
-    void AddUI(const std::string& name, CUIBase* ui);
+    // UI 登録
+    void AddUI(const char* name, CUIBase* ui);
 
-    // OŎ擾
-    CUIBase* GetUI(const std::string& name);
+    // 名前で取得(毎フレーム呼ばれるので文字列を作らずにハッシュで引く)
+    CUIBase* GetUI(const char* name);
     const std::vector<CUIBase*>& GetAllUI(void) { return m_uiList; }
 
 private:
     CUIManager() {}
     ~CUIManager() {}
 
+    static unsigned int MakeKey(const char* name);
+
 private:
     std::vector<CUIBase*> m_uiList;
-    std::unordered_map<std::string, CUIBase*> m_uiMap;
+    std::unordered_map<unsigned int, CUIBase*> m_uiMap;   // 名前のハッシュからUI
 };
 
 //*****************************************************************************
-// UIx[XNX
+// UIベースクラス
 //*****************************************************************************
 class CUIBase : public CObject2D
 {
@@ -55,7 +57,7 @@ public:
 	CUIBase(int nPriority = 6);
 	virtual ~CUIBase();
 
-    // tF[h̎
+    // フェードの種類
     enum class FadeMode
     {
         None,
@@ -63,7 +65,7 @@ public:
         FadeOut
     };
 
-    // XCh̎
+    // スライドの種類
     enum class SlideMode
     {
         None,
@@ -71,12 +73,12 @@ public:
         SlideOut
     };
 
-    // UICAEg\
+    // UIレイアウト構造体
     struct UILayout
     {
-        float anchorX;   // 0.0`1.0
-        float anchorY;   // 0.0`1.0
-        float widthRate; // ʔ䗦
+        float anchorX;   // 0.0～1.0
+        float anchorY;   // 0.0～1.0
+        float widthRate; // 画面比率
         float heightRate;
     };
 
@@ -98,56 +100,56 @@ public:
     }
     void SetAnchor(float x, float y)
     { 
-        m_useLayout = true;// CAEggp
+        m_useLayout = true;// レイアウト使用
         m_layout.anchorX = x; 
         m_layout.anchorY = y; 
     }
 
     void SetSizeRate(float width, float height) { m_layout.widthRate = width; m_layout.heightRate = height; }
 
-    // \E\()
+    // 表示・非表示(即時)
     void Show(void);
     void Hide(void);
     bool IsVisible(void) const { return m_bVisible; }
 
-    // \E\(tF[h)
+    // 表示・非表示(フェード)
     void FadeIn(float duration);
     void FadeOut(float duration);
 
-    // XChCEAEg
+    // スライドイン・アウト処理
     void SlideIn(const D3DXVECTOR3& from, const D3DXVECTOR3& to, float duration);
     void SlideOut(const D3DXVECTOR3& to, float duration);
 
     bool IsMouseOver(void);
 
-    //// eq UI
+    //// 親子 UI
     //void AddChild(CUIBase* child);
 
 protected:
-    void ApplyAlpha(void); // alphaSetCol֔f
+    void ApplyAlpha(void); // alphaをSetColへ反映
 
 private:
-    int         m_nIdxTexture;		    // eNX`CfbNX
-    char        m_szPath[MAX_PATH];     // t@CpX
-    bool        m_bVisible;             // \tO
-    CUIBase*    m_parent;               // eUI
-    std::vector<CUIBase*> m_children;   // qUI
-    float       m_alpha;                // ݂̓x
-    float       m_fadeSpeed;            // XVŉZl
-    FadeMode    m_fadeMode;             // tF[h[h
-    D3DXVECTOR3 m_slideStartPos;        // XChJnʒu
-    D3DXVECTOR3 m_slideEndPos;          // XChIʒu
-    float       m_slideT;               // 0.0f ` 1.0f
-    float       m_slideSpeed;           // XChXs[h
-    SlideMode   m_slideMode;            // XCh[h
-    bool        m_useLayout;            // CAEg̎gptO
-    UILayout    m_layout;               // CAEg\̕ϐ
-    D3DXVECTOR3 m_layoutPos;            // CAEgpʒu
-    D3DXVECTOR3 m_slideOffset;          // ItZbgʒu
+    int         m_nIdxTexture;		    // テクスチャインデックス
+    char        m_szPath[MAX_PATH];     // ファイルパス
+    bool        m_bVisible;             // 表示フラグ
+    CUIBase*    m_parent;               // 親UI
+    std::vector<CUIBase*> m_children;   // 子UI
+    float       m_alpha;                // 現在の透明度
+    float       m_fadeSpeed;            // 更新で加算する値
+    FadeMode    m_fadeMode;             // フェードモード
+    D3DXVECTOR3 m_slideStartPos;        // スライド開始位置
+    D3DXVECTOR3 m_slideEndPos;          // スライド終了位置
+    float       m_slideT;               // 0.0f ～ 1.0f
+    float       m_slideSpeed;           // スライドスピード
+    SlideMode   m_slideMode;            // スライドモード
+    bool        m_useLayout;            // レイアウトの使用フラグ
+    UILayout    m_layout;               // レイアウト構造体変数
+    D3DXVECTOR3 m_layoutPos;            // レイアウト用位置
+    D3DXVECTOR3 m_slideOffset;          // オフセット位置
 };
 
 //*****************************************************************************
-// UIeNX`NX
+// UIテクスチャクラス
 //*****************************************************************************
 class CUITexture : public CUIBase
 {
@@ -165,16 +167,16 @@ public:
     void SetUVDirtyUse(bool flag) { m_isUVDirty = flag; }
 
 private:
-    static constexpr float UV_1 = 0.25f;    // UVW1
-    static constexpr float UV_2 = 0.5f;     // UVW2
-    static constexpr float UV_3 = 0.75f;    // UVW3
+    static constexpr float UV_1 = 0.25f;    // UV座標1
+    static constexpr float UV_2 = 0.5f;     // UV座標2
+    static constexpr float UV_3 = 0.75f;    // UV座標3
 
 
     bool m_isUVDirty;
 };
 
 //*****************************************************************************
-// UINX
+// UI文字クラス
 //*****************************************************************************
 class CUIText : public CUIBase
 {
@@ -189,16 +191,16 @@ public:
     virtual void Update(void) override;
     virtual void Draw(void) override;
 
-    // eLXgݒ
+    // テキスト設定
     void SetText(const std::string& text) { m_text = text; }
     void SetColor(D3DXCOLOR col) { m_color = col; }
     void SetFontSize(int size);
 
 private:
-    std::string     m_text;         // 
-    D3DXCOLOR       m_color;        // F
-    int             m_fontSize;     // tHgTCY
-    LPD3DXFONT      m_pFont;        // tHgւ̃|C^
+    std::string     m_text;         // 文字
+    D3DXCOLOR       m_color;        // 色
+    int             m_fontSize;     // フォントサイズ
+    LPD3DXFONT      m_pFont;        // フォントへのポインタ
     RECT            m_drawRect;     // RECT
 };
 
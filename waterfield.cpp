@@ -1,61 +1,63 @@
 //=============================================================================
 //
-// tB[h [ waterfield.cpp ]
+// 水フィールド処理 [ waterfield.cpp ]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "waterfield.h"
 #include "manager.h"
 #include "texture.h"
-#include "meshcylinder.h"
+#include "ripplesystem.h"
 #include "player.h"
 #include "specbase.h"
 #include "motion.h"
 #include "particle.h"
+#include "random.h"
 
 //=============================================================================
-// RXgN^
+// コンストラクタ
 //=============================================================================
 CWaterField::CWaterField(int nPriority) : CObject(nPriority)
 {
-	// l̃NA
-	m_pIdx			= nullptr;		// CfbNXobt@
-	m_pVtx			= nullptr;		// _obt@
-	m_pos			= INIT_VEC3;	// ʒu
-	m_rot			= INIT_VEC3;	// 
-	m_mtxWorld		= {};			// [h}gbNX
-	m_WaterFiled	= {};			// \̕ϐ
-	m_UVOffsetU		= 0.0f;			// UṼItZbg(U)
-	m_UVOffsetV		= 0.0f;			// UṼItZbg(V)
-	m_FlowDir		= INIT_VEC3;	// ̗
-	m_FlowSpeed		= FLOW_SPEED;	// ̗鑬x
+	// 値のクリア
+	m_pIdx			= nullptr;		// インデックスバッファ
+	m_pVtx			= nullptr;		// 頂点バッファ
+	m_pos			= INIT_VEC3;	// 位置
+	m_rot			= INIT_VEC3;	// 向き
+	m_mtxWorld		= {};			// ワールドマトリックス
+	m_WaterFiled	= {};			// 構造体変数
+	m_WaterFiled.nTexIdx = -1;		// テクスチャインデックス
+	m_UVOffsetU		= 0.0f;			// UVのオフセット(U)
+	m_UVOffsetV		= 0.0f;			// UVのオフセット(V)
+	m_FlowDir		= INIT_VEC3;	// 川の流れる方向
+	m_FlowSpeed		= FLOW_SPEED;	// 川の流れる速度
 }
 //=============================================================================
-// fXgN^
+// デストラクタ
 //=============================================================================
 CWaterField::~CWaterField()
 {
-	// 
+	// 無し
 }
 //=============================================================================
-// 
+// 生成処理
 //=============================================================================
 CWaterField* CWaterField::Create(D3DXVECTOR3 pos, float fRadiusX, float fRadiusZ, int nNumX, int nNumZ)
 {
-	// CX^X
+	// インスタンス生成
 	CWaterField* pWaterField = new CWaterField;
 
-	// nullptr
+	// nullptrだったら
 	if (pWaterField == nullptr)
 	{
 		return nullptr;
 	}
 
-	// IuWFNgݒ
+	// オブジェクト設定
 	pWaterField->m_pos = pos;
 	pWaterField->m_WaterFiled.fRadiusX = fRadiusX;
 	pWaterField->m_WaterFiled.fRadiusZ = fRadiusZ;
@@ -63,7 +65,7 @@ CWaterField* CWaterField::Create(D3DXVECTOR3 pos, float fRadiusX, float fRadiusZ
 	pWaterField->m_WaterFiled.nNumZ = nNumZ;
 	pWaterField->m_WaterFiled.fSurfaceHeight = pos.y;
 
-	// s
+	// 初期化失敗時
 	if (FAILED(pWaterField->Init()))
 	{
 		return nullptr;
@@ -72,25 +74,25 @@ CWaterField* CWaterField::Create(D3DXVECTOR3 pos, float fRadiusX, float fRadiusZ
 	return pWaterField;
 }
 //=============================================================================
-// 
+// 初期化処理
 //=============================================================================
 HRESULT CWaterField::Init(void)
 {
-	// foCX̃|C^
+	// デバイスのポインタ
 	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
 
-	// eNX`|C^擾
+	// テクスチャポインタ取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// eNX`蓖
+	// テクスチャ割り当て
 	m_WaterFiled.nTexIdx = pTexture->RegisterDynamic("data/TEXTURE/river.jpg");
 
-	// _vZ
-	m_WaterFiled.nNumAllVtx = ((m_WaterFiled.nNumX + 1) * (m_WaterFiled.nNumZ + 1)); // _
-	m_WaterFiled.nNumPrimitive = (((m_WaterFiled.nNumX * m_WaterFiled.nNumZ) * 2)) + (4 * (m_WaterFiled.nNumZ - 1)); // |S
-	m_WaterFiled.nNumIdx = m_WaterFiled.nNumPrimitive + 2; // CfbNX
+	// 頂点計算
+	m_WaterFiled.nNumAllVtx = ((m_WaterFiled.nNumX + 1) * (m_WaterFiled.nNumZ + 1)); // 頂点数
+	m_WaterFiled.nNumPrimitive = (((m_WaterFiled.nNumX * m_WaterFiled.nNumZ) * 2)) + (4 * (m_WaterFiled.nNumZ - 1)); // ポリゴン数
+	m_WaterFiled.nNumIdx = m_WaterFiled.nNumPrimitive + 2; // インデックス数
 
-	// _obt@̐
+	// 頂点バッファの生成
 	pDevice->CreateVertexBuffer(sizeof(VERTEX_3D) * m_WaterFiled.nNumAllVtx,
 		D3DUSAGE_WRITEONLY,
 		FVF_VERTEX_3D,
@@ -98,7 +100,7 @@ HRESULT CWaterField::Init(void)
 		&m_pVtx,
 		NULL);
 
-	// CfbNXobt@̐
+	// インデックスバッファの生成
 	pDevice->CreateIndexBuffer(sizeof(WORD) * m_WaterFiled.nNumIdx,
 		D3DUSAGE_WRITEONLY,
 		D3DFMT_INDEX16,
@@ -106,64 +108,64 @@ HRESULT CWaterField::Init(void)
 		&m_pIdx,
 		NULL);
 
-	// ϐ̏
+	// 変数の初期化
 	m_rot = INIT_VEC3;
 
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	//_obt@bN
-	m_pVtx->Lock(0, 0, (void**)&pVtx, 0);
+	//頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtx, 0, 0, (void**)&pVtx, 0);
 
-	// eNX`WvZϐ
+	// テクスチャ座標を計算する変数
 	float fTexX = 1.0f / m_WaterFiled.nNumX;
 	float fTexY = 1.0f / m_WaterFiled.nNumZ;
 	int nCnt = 0;
 
 	D3DXVECTOR3 MathPos = m_pos;
 
-	// c
+	// 縦
 	for (int nCntZ = 0; nCntZ <= m_WaterFiled.nNumZ; nCntZ++)
 	{
-		// 
+		// 横
 		for (int nCntX = 0; nCntX <= m_WaterFiled.nNumX; nCntX++)
 		{
-			// _WvZ
+			// 頂点座標を計算
 			MathPos.x = ((m_WaterFiled.fRadiusX / m_WaterFiled.nNumX) * nCntX) - (m_WaterFiled.fRadiusX * 0.5f);
 			MathPos.y = m_pos.y;
 			MathPos.z = m_WaterFiled.fRadiusZ - ((m_WaterFiled.fRadiusZ / m_WaterFiled.nNumZ) * nCntZ) - (m_WaterFiled.fRadiusZ * 0.5f);
 
-			// _W̐ݒ
+			// 頂点座標の設定
 			pVtx[nCnt].pos = MathPos;
 
-			// @xNg̐ݒ
+			// 法線ベクトルの設定
 			pVtx[nCnt].nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
 
-			// _J[̐ݒ
-			pVtx[nCnt].col = D3DXCOLOR(0.0f, 0.6f, 1.0f, 0.5f);// ̐F;
+			// 頂点カラーの設定
+			pVtx[nCnt].col = D3DXCOLOR(0.0f, 0.6f, 1.0f, 0.5f);// 半透明の水色;
 
-			// eNX`W̐ݒ
+			// テクスチャ座標の設定
 			pVtx[nCnt].tex = D3DXVECTOR2(fTexX * nCntX, nCntZ * fTexY);
 
-			// Z
+			// 加算
 			nCnt++;
 		}
 	}
 
-	// AbN
-	m_pVtx->Unlock();
+	// アンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtx);
 
-	// CfbNXobt@̃|C^
+	// インデックスバッファのポインタ
 	WORD* pIdx;
 
-	// CfbNXobt@̃bN
-	m_pIdx->Lock(0, 0, (void**)&pIdx, 0);
+	// インデックスバッファのロック
+	CManager::GetRenderer()->GetBackend()->LockIndexBuffer(m_pIdx, 0, 0, (void**)&pIdx, 0);
 
 	WORD IndxNum = m_WaterFiled.nNumX + 1;// X
-	WORD IdxCnt	= 0;// z
+	WORD IdxCnt	= 0;// 配列
 	WORD Num = 0;
 
-	// CfbNX̐ݒ
+	// インデックスの設定
 	for (int IndxCount1 = 0; IndxCount1 < m_WaterFiled.nNumZ; IndxCount1++)
 	{
 		for (int IndxCount2 = 0; IndxCount2 <= m_WaterFiled.nNumX; IndxCount2++, IndxNum++, Num++)
@@ -173,7 +175,7 @@ HRESULT CWaterField::Init(void)
 			IdxCnt += 2;
 		}
 
-		// Ō̍sȂ
+		// 最後の行じゃなかったら
 		if (IndxCount1 < m_WaterFiled.nNumZ - 1)
 		{
 			pIdx[IdxCnt] = Num - 1;
@@ -182,109 +184,113 @@ HRESULT CWaterField::Init(void)
 		}
 	}
 
-	// CfbNXobt@̃AbN
-	m_pIdx->Unlock();
+	// インデックスバッファのアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockIndexBuffer(m_pIdx);
 
 	return S_OK;
 }
 //=============================================================================
-// I
+// 終了処理
 //=============================================================================
 void CWaterField::Uninit(void)
 {
-	// _obt@̔j
+	// テクスチャの参照を外す
+	CManager::GetTexture()->Release(m_WaterFiled.nTexIdx);
+	m_WaterFiled.nTexIdx = -1;
+
+	// 頂点バッファの破棄
 	if (m_pVtx != nullptr)
 	{
 		m_pVtx->Release();
 		m_pVtx = nullptr;
 	}
 
-	// CfbNXobt@̔j
+	// インデックスバッファの破棄
 	if (m_pIdx != nullptr)
 	{
 		m_pIdx->Release();
 		m_pIdx = nullptr;
 	}
 
-	// g̔j
+	// 自身の破棄
 	this->Release();
 }
 //=============================================================================
-// XV
+// 更新処理
 //=============================================================================
 void CWaterField::Update(void)
 {
 	//============================
-	// UV XN[
+	// UV スクロール
 	//============================
 
-	// X  UAZ  V ɑΉ
+	// X方向 → U、Z方向 → V に対応させる
 	m_UVOffsetU += m_FlowDir.x * m_FlowSpeed;
 	m_UVOffsetV += m_FlowDir.z * m_FlowSpeed;
 
-	// 0`1 Ƀbv
+	// 0～1 にラップ
 	m_UVOffsetU = fmodf(m_UVOffsetU, 1.0f);
 	m_UVOffsetV = fmodf(m_UVOffsetV, 1.0f);
 
-	// _̃|C^錾
+	// 頂点情報のポインタを宣言
 	VERTEX_3D* pVtx = nullptr;
 
-	//_obt@bN
-	m_pVtx->Lock(0, 0, (void**)&pVtx, 0);
+	//頂点バッファをロック
+	CManager::GetRenderer()->GetBackend()->LockVertexBuffer(m_pVtx, 0, 0, (void**)&pVtx, 0);
 
-	// eNX`WvZϐ
+	// テクスチャ座標を計算する変数
 	float fTexX = UV_RATE_X / m_WaterFiled.nNumX;
 	float fTexY = UV_RATE_Y / m_WaterFiled.nNumZ;
 	int nCnt = 0;
 
 	D3DXVECTOR3 MathPos = m_pos;
 
-	//c
+	//縦
 	for (int nCntZ = 0; nCntZ <= m_WaterFiled.nNumZ; nCntZ++)
 	{
-		//
+		//横
 		for (int nCntX = 0; nCntX <= m_WaterFiled.nNumX; nCntX++)
 		{
-			// _WvZ
+			// 頂点座標を計算
 			MathPos.x = ((m_WaterFiled.fRadiusX / m_WaterFiled.nNumX) * nCntX) - (m_WaterFiled.fRadiusX * 0.5f);
 			MathPos.y = m_pos.y;
 			MathPos.z = m_WaterFiled.fRadiusZ - ((m_WaterFiled.fRadiusZ / m_WaterFiled.nNumZ) * nCntZ) - (m_WaterFiled.fRadiusZ * 0.5f);
 
-			// _W̐ݒ
+			// 頂点座標の設定
 			pVtx[nCnt].pos = MathPos;
 
-			// @xNg̐ݒ
+			// 法線ベクトルの設定
 			pVtx[nCnt].nor = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
 
-			// _J[̐ݒ
-			pVtx[nCnt].col = D3DXCOLOR(0.0f, 0.6f, 1.0f, 0.5f);// ̐F
+			// 頂点カラーの設定
+			pVtx[nCnt].col = D3DXCOLOR(0.0f, 0.6f, 1.0f, 0.5f);// 半透明の水色
 
-			// eNX`W̐ݒ
+			// テクスチャ座標の設定
 			pVtx[nCnt].tex = D3DXVECTOR2(
 				fTexX * nCntX + m_UVOffsetU,
 				nCntZ * fTexY + m_UVOffsetV);
 
-			// Z
+			// 加算
 			nCnt++;
 		}
 	}
 
-	// AbN
-	m_pVtx->Unlock();
+	// アンロック
+	CManager::GetRenderer()->GetBackend()->UnlockVertexBuffer(m_pVtx);
 
-	// CfbNXobt@̃|C^
+	// インデックスバッファのポインタ
 	WORD* pIdx;
 
-	// CfbNXobt@̃bN
-	m_pIdx->Lock(0, 0, (void**)&pIdx, 0);
+	// インデックスバッファのロック
+	CManager::GetRenderer()->GetBackend()->LockIndexBuffer(m_pIdx, 0, 0, (void**)&pIdx, 0);
 
 	WORD IndxNum = m_WaterFiled.nNumX + 1;// X
 
-	WORD IdxCnt = 0;// z
+	WORD IdxCnt = 0;// 配列
 
 	WORD Num = 0;
 
-	// CfbNX̐ݒ
+	// インデックスの設定
 	for (int IndxCount1 = 0; IndxCount1 < m_WaterFiled.nNumZ; IndxCount1++)
 	{
 		for (int IndxCount2 = 0; IndxCount2 <= m_WaterFiled.nNumX; IndxCount2++, IndxNum++, Num++)
@@ -294,7 +300,7 @@ void CWaterField::Update(void)
 			IdxCnt += 2;
 		}
 
-		// Ō̍sȂ
+		// 最後の行じゃなかったら
 		if (IndxCount1 < m_WaterFiled.nNumZ - 1)
 		{
 			pIdx[IdxCnt] = Num - 1;
@@ -303,80 +309,80 @@ void CWaterField::Update(void)
 		}
 	}
 
-	// CfbNXobt@̃AbN
-	m_pIdx->Unlock();
+	// インデックスバッファのアンロック
+	CManager::GetRenderer()->GetBackend()->UnlockIndexBuffer(m_pIdx);
 
-	// vC[̈ʒu擾āAg𐶐
+	// プレイヤーの位置を取得して、波紋を生成する
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
-	// nullptr΂
+	// nullptrだったら飛ばす
 	if (!pPlayer)
 	{
 		return;
 	}
 
-	// ʒu擾
+	// 位置取得
 	D3DXVECTOR3 playerPos = pPlayer->GetPos();
 
-	// ̒ɂ
+	// 水の中にいたら
 	if (IsInWater(playerPos))
 	{
-		// g䐶
+		// 波紋生成
 		SpawnCylinder();
 	}
 }
 //=============================================================================
-// `揈
+// 描画処理
 //=============================================================================
 void CWaterField::Draw(void)
 {
-	// foCX̃|C^
-	LPDIRECT3DDEVICE9 pDevice = CManager::GetRenderer()->GetDevice();
+	// デバイスのポインタ
+	CRenderDevice* pDevice = CManager::GetRenderer()->GetBackend();
 
-	// eNX`̎擾
+	// テクスチャの取得
 	CTexture* pTexture = CManager::GetTexture();
 
-	// vZp̃}gbNX錾
+	// 計算用のマトリックスを宣言
 	D3DXMATRIX mtxRot, mtxTrans;
 
-	// [h}gbNX̏
+	// ワールドマトリックスの初期化
 	D3DXMatrixIdentity(&m_mtxWorld);
 
-	// 𔽉f
+	// 向きを反映
 	D3DXMatrixRotationYawPitchRoll(&mtxRot, m_rot.y, m_rot.x, m_rot.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxRot);
 
-	// ʒu𔽉f
+	// 位置を反映
 	D3DXMatrixTranslation(&mtxTrans, m_pos.x, m_pos.y, m_pos.z);
 	D3DXMatrixMultiply(&m_mtxWorld, &m_mtxWorld, &mtxTrans);
 
-	// [h}gbNX̐ݒ
+	// ワールドマトリックスの設定
 	pDevice->SetTransform(D3DTS_WORLD, &m_mtxWorld);
 
-	// _obt@foCX̃f[^Xg[ɐݒ
+	// 頂点バッファをデバイスのデータストリームに設定
 	pDevice->SetStreamSource(0, m_pVtx, 0, sizeof(VERTEX_3D));
 
-	// CfbNXobt@f[^Xg[ɐݒ
+	// インデックスバッファをデータストリームに設定
 	pDevice->SetIndices(m_pIdx);
 
-	// eNX`tH[}bg̐ݒ
+	// テクスチャフォーマットの設定
 	pDevice->SetFVF(FVF_VERTEX_3D);
 
-	// eNX`蓖
+	// テクスチャ割り当て
 	pDevice->SetTexture(0, pTexture->GetAddress(m_WaterFiled.nTexIdx));
 
-	// |S̕`
+	// ポリゴンの描画
 	pDevice->DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, 0, 0, m_WaterFiled.nNumAllVtx, 0, m_WaterFiled.nNumPrimitive);
 }
 //=============================================================================
-// g䐶
+// 波紋生成処理
 //=============================================================================
 void CWaterField::SpawnCylinder(void)
 {
-	// ̎擾
+	// 音の取得
 	CSound* pSound = CManager::GetSound();
 
-	// vC[̑ɔg𐶐邽߁AvC[̎擾
+	// プレイヤーの足元に波紋を生成するため、プレイヤーの取得をする
 	CPlayer* pPlayer = CCharacterManager::GetInstance().GetCharacter<CPlayer>();
 
 	if (!pPlayer)
@@ -384,71 +390,71 @@ void CWaterField::SpawnCylinder(void)
 		return;
 	}
 
-	// ړĂƂɐ邽߁A͂擾
+	// 移動しているときに生成するため、入力を取得する
 	CPlayer::InputData input = pPlayer->GatherInput();
 
-	// g䐶֐
+	// 波紋生成関数
 	auto spawnCylinder = [&]()
 	{
-		// vC[̈ʒu
+		// プレイヤーの位置
 		D3DXVECTOR3 pos = pPlayer->GetPos();
 		pos.y += OFFSET_POS;
 
-		// a߂ă_ʒuɃX|[
+		// 半径を決めてランダム位置にスポーン
 		float radiusMax = SPAWN_RADIUS;
 
-		// 0.0`1.0 ̗
-		float r = (rand() % 10000) / 10000.0f;
+		// 0.0～1.0 の乱数
+		float r = CRandom::Get(CRandom::STREAM_EFFECT).Float();
 
-		// ċψɕz
+		// 平方根を取って均一に分布させる
 		float radius = sqrtf(r) * radiusMax;
 
-		// px
-		float angle = ((rand() % 360) / 180.0f) * D3DX_PI;
+		// 角度
+		float angle = CRandom::Get(CRandom::STREAM_EFFECT).Angle();
 
-		// ʒu
+		// 位置
 		pos.x = pos.x + cosf(angle) * radius;
 		pos.y += OFFSET_POS;
 		pos.z = pos.z + sinf(angle) * radius;
 
-		// SE̍Đ
+		// 水SEの再生
 		if (pSound)
 		{
-			// ~čĐ
+			// 停止して再生
 			pSound->StopByLabel(CSound::SOUND_LABEL_WATER);
 			pSound->Play(CSound::SOUND_LABEL_WATER);
 		}
 
-		// g̐
-		CMeshCylinder::Create(pos, D3DXCOLOR(0.3f, 0.7f, 1.0f, 0.9f), 5.0f, 8.0f, 0.5f, 50, 0.03f);
+		// 波紋の生成
+		CRippleSystem::Emit(pos, D3DXCOLOR(0.3f, 0.7f, 1.0f, 0.9f), 5.0f, 8.0f, 0.5f, 50, 0.03f);
 
-		// Ԃp[eBN
+		// 水しぶきパーティクル生成
 		CParticle::Create<CWaterParticle>(INIT_VEC3, pos, D3DXCOLOR(0.3f, 0.6f, 1.0f, 0.8f), 120, 10);
 		CParticle::Create<CWaterParticle>(INIT_VEC3, pos, D3DXCOLOR(0.3f, 0.5f, 1.0f, 0.5f), 120, 10);
 	};
 
-	IsNotStealthSpec        notStealth;								// XeXȂ
-	IsMovingSpec            isMoving;								// ړ
-	IsNotDamageMotionSpec   notDamage;								// _[W[VȂ
+	IsNotStealthSpec        notStealth;								// ステルス中じゃない
+	IsMovingSpec            isMoving;								// 移動中
+	IsNotDamageMotionSpec   notDamage;								// ダメージモーションじゃない
 
-	AndSpecification<CPlayer> cond1(notStealth, isMoving);			// ̍(XeXȂ && ړ)
-	AndSpecification<CPlayer> playerConditionSpec(cond1, notDamage);// ̍(cond1 && _[W[VȂ)
+	AndSpecification<CPlayer> cond1(notStealth, isMoving);			// 条件の合成(ステルス中じゃない && 移動中)
+	AndSpecification<CPlayer> playerConditionSpec(cond1, notDamage);// 条件の合成(cond1 && ダメージモーションじゃない)
 
-	// vC[tO
+	// プレイヤー条件フラグ
 	bool playerCondition = playerConditionSpec.IsSatisfiedBy(*pPlayer);
 
-	// WCpbh̎擾
+	// ジョイパッドの取得
 	CInputJoypad* pJoypad = CManager::GetInputJoypad();
 
 	if (pPlayer && playerCondition)
 	{
-		// SE̍Đ
+		// 水SEの再生
 		if (pPlayer->GetMotion()->EventMotionRange(CPlayer::MOVE, 1, 9) ||
 			pPlayer->GetMotion()->EventMotionRange(CPlayer::INJURY, 1, 20))
 		{
 			spawnCylinder();
 
-			// U
+			// 振動させる
 			pJoypad->SetVibration(10000, 10000, 10);
 		}
 		else if (pPlayer->GetMotion()->EventMotionRange(CPlayer::MOVE, 3, 9) ||
@@ -456,17 +462,17 @@ void CWaterField::SpawnCylinder(void)
 		{
 			spawnCylinder();
 
-			// U
+			// 振動させる
 			pJoypad->SetVibration(10000, 10000, 10);
 		}
 	}
 }
 //=============================================================================
-// 菈
+// 水中判定処理
 //=============================================================================
 bool CWaterField::IsInWater(const D3DXVECTOR3& pos)
 {
-	// XZ͈̓`FbN
+	// XZ範囲チェック
 	float halfX = m_WaterFiled.fRadiusX * 0.5f;
 	float halfZ = m_WaterFiled.fRadiusZ * 0.5f;
 
@@ -480,7 +486,7 @@ bool CWaterField::IsInWater(const D3DXVECTOR3& pos)
 		return false;
 	}
 
-	// Y`FbNiʂ艺j
+	// Yチェック（水面より下か）
 	if (pos.y > m_WaterFiled.fSurfaceHeight)
 	{
 		return false;
@@ -1,6 +1,6 @@
 //=============================================================================
 //
-// tB[h [ waterfield.h ]
+// 水フィールド処理 [ waterfield.h ]
 // Author: RIKU TANEKAWA
 //
 //=============================================================================
@@ -8,31 +8,31 @@
 #define _WATERFIELD_H_
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "object.h"
 
 //*****************************************************************************
-// tB[hNX
+// 水フィールドクラス
 //*****************************************************************************
 class CWaterField : public CObject
 {
 public:
 
 	//*************************************************************************
-	// \̐錾
+	// 構造体宣言
 	//*************************************************************************
 	struct WaterField
 	{
-		float	fRadiusX;			// X̔a
-		float	fRadiusZ;			// Z̔a
-		int		nNumPrimitive;		// v~eBu
-		int		nNumIdx;			// CfbNX
-		int		nNumAllVtx;			// S̒_
-		int		nNumX;				// X_
-		int		nNumZ;				// Z_
-		int		nTexIdx;			// eNX`CfbNX
-		float	fSurfaceHeight;		// ʍ
+		float	fRadiusX;			// X方向の半径
+		float	fRadiusZ;			// Z方向の半径
+		int		nNumPrimitive;		// プリミティブ数
+		int		nNumIdx;			// インデックス数
+		int		nNumAllVtx;			// 全体頂点数
+		int		nNumX;				// X頂点
+		int		nNumZ;				// Z頂点
+		int		nTexIdx;			// テクスチャインデックス
+		float	fSurfaceHeight;		// 水面高さ
 	};	
 
 	CWaterField(int nPriority = 4);
@@ -46,12 +46,12 @@ public:
 	void SpawnCylinder(void);
 
 	//*************************************************************************
-	// flagment֐
+	// flagment関数
 	//*************************************************************************
 	bool IsInWater(const D3DXVECTOR3& pos);
 
 	//*************************************************************************
-	// setter֐
+	// setter関数
 	//*************************************************************************
 	void SetPos(D3DXVECTOR3 pos) { m_pos = pos; }
 	void SetRaiusZ(float fRadius) { m_WaterFiled.fRadiusZ = fRadius; }
@@ -60,35 +60,35 @@ public:
 	{
 		m_FlowDir = dir;
 
-		// K
+		// 正規化する
 		D3DXVec3Normalize(&m_FlowDir, &m_FlowDir);
 	}
 
 	//*************************************************************************
-	// getter֐
+	// getter関数
 	//*************************************************************************
 	D3DXVECTOR3 GetPos(void) { return m_pos; }
 	float GetRadiusX(void) { return m_WaterFiled.fRadiusX; }
 	float GetRadiusZ(void) { return m_WaterFiled.fRadiusZ; }
 
 private:
-	static constexpr int	SPAWN_TIME		= 7;		// Ԋu(t[)
-	static constexpr float	SPAWN_RADIUS	= 10.0f;	// a
-	static constexpr float	UV_RATE_X		= 5.0f;		// eNX`W̊X
-	static constexpr float	UV_RATE_Y		= 5.0f;		// eNX`W̊Y
-	static constexpr float	OFFSET_POS		= 10.0f;	// g䐶ItZbgʒu
-	static constexpr float	FLOW_SPEED		= 0.002f;	// ̗鑬x
+	static constexpr int	SPAWN_TIME		= 7;		// 生成間隔(フレーム)
+	static constexpr float	SPAWN_RADIUS	= 10.0f;	// 生成半径
+	static constexpr float	UV_RATE_X		= 5.0f;		// テクスチャ座標の割合X
+	static constexpr float	UV_RATE_Y		= 5.0f;		// テクスチャ座標の割合Y
+	static constexpr float	OFFSET_POS		= 10.0f;	// 波紋生成オフセット位置
+	static constexpr float	FLOW_SPEED		= 0.002f;	// 川の流れる速度
 
-	LPDIRECT3DINDEXBUFFER9	m_pIdx;						// CfbNXobt@
-	LPDIRECT3DVERTEXBUFFER9 m_pVtx;						// _obt@
-	D3DXVECTOR3				m_pos;						// W
-	D3DXVECTOR3				m_rot;						// px
-	D3DXMATRIX				m_mtxWorld;					// [h}gbNX
-	WaterField				m_WaterFiled;				// \̕ϐ
-	float					m_UVOffsetU;				// UṼItZbg(U)
-	float					m_UVOffsetV;				// UṼItZbg(V)
-	D3DXVECTOR3				m_FlowDir;					// ̗
-	float					m_FlowSpeed;				// ̗鑬x
+	LPDIRECT3DINDEXBUFFER9	m_pIdx;						// インデックスバッファ
+	LPDIRECT3DVERTEXBUFFER9 m_pVtx;						// 頂点バッファ
+	D3DXVECTOR3				m_pos;						// 座標
+	D3DXVECTOR3				m_rot;						// 角度
+	D3DXMATRIX				m_mtxWorld;					// ワールドマトリックス
+	WaterField				m_WaterFiled;				// 構造体変数
+	float					m_UVOffsetU;				// UVのオフセット(U)
+	float					m_UVOffsetV;				// UVのオフセット(V)
+	D3DXVECTOR3				m_FlowDir;					// 川の流れる方向
+	float					m_FlowSpeed;				// 川の流れる速度
 };
 
 #endif
\ No newline at end of file
@@ -1,25 +1,25 @@
 //=============================================================================
 //
-// ̓蔻菈 [weaponcollider.h]
+// 武器の当たり判定処理 [weaponcollider.h]
 // Author : RIKU TANEKAWA
 //
 //=============================================================================
-#ifndef _WEAPONCOLLIDER_H_// ̃}N`ĂȂ
-#define _WEAPONCOLLIDER_H_// 2dCN[hh~̃}N`
+#ifndef _WEAPONCOLLIDER_H_// このマクロ定義がされていなかったら
+#define _WEAPONCOLLIDER_H_// 2重インクルード防止のマクロ定義
 
 //*****************************************************************************
-// CN[ht@C
+// インクルードファイル
 //*****************************************************************************
 #include "collisionUtils.h"
 
 //*****************************************************************************
-// O錾
+// 前方宣言
 //*****************************************************************************
 class CCharacter;
 class CModel;
 
 //*****************************************************************************
-// RC_[NX
+// 武器コライダークラス
 //*****************************************************************************
 class CWeaponCollider
 {
@@ -35,21 +35,22 @@ public:
 
     D3DXVECTOR3 GetCurrentBasePos(void) { return m_currBase; }
     D3DXVECTOR3 GetCurrentTipPos(void) { return m_currTip; }
+    float GetRadius(void) const { return m_fRadius; }
 
-    // 蔻̍XV
+    // 当たり判定の更新処理
     void Update(CModel* pWeapon, float tip, float base);
 
-    // 蔻菈
+    // 当たり判定処理
     void CheckHit(CCharacter* pCharacter, float fDamage, float radius);
 
 private:
-    D3DXVECTOR3 m_prevBase; // O̍̔̈ʒu
-    D3DXVECTOR3 m_prevTip;  // O̐[̔̈ʒu
-    D3DXVECTOR3 m_currBase; // ݂̍̔̈ʒu
-    D3DXVECTOR3 m_currTip;  // ݂̐[̔̈ʒu
-    bool        m_bActive;  // RC_[ONtO
-    bool        m_bHasHit;  // ǂ
-    float       m_fRadius;  // 蔻蔼a
+    D3DXVECTOR3 m_prevBase; // 前回の根元の判定の位置
+    D3DXVECTOR3 m_prevTip;  // 前回の先端の判定の位置
+    D3DXVECTOR3 m_currBase; // 現在の根元の判定の位置
+    D3DXVECTOR3 m_currTip;  // 現在の先端の判定の位置
+    bool        m_bActive;  // コライダーONフラグ
+    bool        m_bHasHit;  // 当たったかどうか
+    float       m_fRadius;  // 当たり判定半径
 };
 
 #endif